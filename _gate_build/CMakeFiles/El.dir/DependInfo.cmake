@@ -0,0 +1,499 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/global.c" "CMakeFiles/El.dir/src/core/global.c.o" "gcc" "CMakeFiles/El.dir/src/core/global.c.o.d"
+  "/root/repo/src/blas_like/algorithms.cpp" "CMakeFiles/El.dir/src/blas_like/algorithms.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/algorithms.cpp.o.d"
+  "/root/repo/src/blas_like/batch-C.cpp" "CMakeFiles/El.dir/src/blas_like/batch-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/batch-C.cpp.o.d"
+  "/root/repo/src/blas_like/blocksizes.cpp" "CMakeFiles/El.dir/src/blas_like/blocksizes.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/blocksizes.cpp.o.d"
+  "/root/repo/src/blas_like/level1-C.cpp" "CMakeFiles/El.dir/src/blas_like/level1-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1-C.cpp.o.d"
+  "/root/repo/src/blas_like/level1/ColumnMinAbs.cpp" "CMakeFiles/El.dir/src/blas_like/level1/ColumnMinAbs.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/ColumnMinAbs.cpp.o.d"
+  "/root/repo/src/blas_like/level1/ColumnNorms.cpp" "CMakeFiles/El.dir/src/blas_like/level1/ColumnNorms.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/ColumnNorms.cpp.o.d"
+  "/root/repo/src/blas_like/level1/Copy.cpp" "CMakeFiles/El.dir/src/blas_like/level1/Copy.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/Copy.cpp.o.d"
+  "/root/repo/src/blas_like/level1/EntrywiseReductions.cpp" "CMakeFiles/El.dir/src/blas_like/level1/EntrywiseReductions.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/EntrywiseReductions.cpp.o.d"
+  "/root/repo/src/blas_like/level1/GetSubgraph.cpp" "CMakeFiles/El.dir/src/blas_like/level1/GetSubgraph.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/GetSubgraph.cpp.o.d"
+  "/root/repo/src/blas_like/level1/HilbertSchmidt.cpp" "CMakeFiles/El.dir/src/blas_like/level1/HilbertSchmidt.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/HilbertSchmidt.cpp.o.d"
+  "/root/repo/src/blas_like/level1/Instantiate.cpp" "CMakeFiles/El.dir/src/blas_like/level1/Instantiate.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/Instantiate.cpp.o.d"
+  "/root/repo/src/blas_like/level1/Max.cpp" "CMakeFiles/El.dir/src/blas_like/level1/Max.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/Max.cpp.o.d"
+  "/root/repo/src/blas_like/level1/MaxAbs.cpp" "CMakeFiles/El.dir/src/blas_like/level1/MaxAbs.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/MaxAbs.cpp.o.d"
+  "/root/repo/src/blas_like/level1/MaxAbsLoc.cpp" "CMakeFiles/El.dir/src/blas_like/level1/MaxAbsLoc.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/MaxAbsLoc.cpp.o.d"
+  "/root/repo/src/blas_like/level1/MaxLoc.cpp" "CMakeFiles/El.dir/src/blas_like/level1/MaxLoc.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/MaxLoc.cpp.o.d"
+  "/root/repo/src/blas_like/level1/Min.cpp" "CMakeFiles/El.dir/src/blas_like/level1/Min.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/Min.cpp.o.d"
+  "/root/repo/src/blas_like/level1/MinAbsLoc.cpp" "CMakeFiles/El.dir/src/blas_like/level1/MinAbsLoc.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/MinAbsLoc.cpp.o.d"
+  "/root/repo/src/blas_like/level1/MinLoc.cpp" "CMakeFiles/El.dir/src/blas_like/level1/MinLoc.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/MinLoc.cpp.o.d"
+  "/root/repo/src/blas_like/level1/RowMinAbs.cpp" "CMakeFiles/El.dir/src/blas_like/level1/RowMinAbs.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/RowMinAbs.cpp.o.d"
+  "/root/repo/src/blas_like/level1/RowNorms.cpp" "CMakeFiles/El.dir/src/blas_like/level1/RowNorms.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/RowNorms.cpp.o.d"
+  "/root/repo/src/blas_like/level1/Swap.cpp" "CMakeFiles/El.dir/src/blas_like/level1/Swap.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/Swap.cpp.o.d"
+  "/root/repo/src/blas_like/level1/Symmetric2x2Inv.cpp" "CMakeFiles/El.dir/src/blas_like/level1/Symmetric2x2Inv.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/Symmetric2x2Inv.cpp.o.d"
+  "/root/repo/src/blas_like/level1/Transform2x2.cpp" "CMakeFiles/El.dir/src/blas_like/level1/Transform2x2.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level1/Transform2x2.cpp.o.d"
+  "/root/repo/src/blas_like/level2-C.cpp" "CMakeFiles/El.dir/src/blas_like/level2-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2-C.cpp.o.d"
+  "/root/repo/src/blas_like/level2/ApplyGivensSequence.cpp" "CMakeFiles/El.dir/src/blas_like/level2/ApplyGivensSequence.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/ApplyGivensSequence.cpp.o.d"
+  "/root/repo/src/blas_like/level2/BandedGemv.cpp" "CMakeFiles/El.dir/src/blas_like/level2/BandedGemv.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/BandedGemv.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Gemv.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Gemv.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Gemv.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Ger.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Ger.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Ger.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Geru.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Geru.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Geru.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Hemv.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Hemv.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Hemv.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Her.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Her.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Her.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Her2.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Her2.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Her2.cpp.o.d"
+  "/root/repo/src/blas_like/level2/QuasiTrsv.cpp" "CMakeFiles/El.dir/src/blas_like/level2/QuasiTrsv.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/QuasiTrsv.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Symv.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Symv.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Symv.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Syr.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Syr.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Syr.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Syr2.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Syr2.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Syr2.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Trmv.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Trmv.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Trmv.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Trr.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Trr.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Trr.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Trr2.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Trr2.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Trr2.cpp.o.d"
+  "/root/repo/src/blas_like/level2/Trsv.cpp" "CMakeFiles/El.dir/src/blas_like/level2/Trsv.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level2/Trsv.cpp.o.d"
+  "/root/repo/src/blas_like/level3-C.cpp" "CMakeFiles/El.dir/src/blas_like/level3-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3-C.cpp.o.d"
+  "/root/repo/src/blas_like/level3/BandedGemm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/BandedGemm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/BandedGemm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Gemm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Gemm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Gemm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Hemm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Hemm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Hemm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Her2k.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Her2k.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Her2k.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Herk.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Herk.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Herk.cpp.o.d"
+  "/root/repo/src/blas_like/level3/HermitianFromEVD.cpp" "CMakeFiles/El.dir/src/blas_like/level3/HermitianFromEVD.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/HermitianFromEVD.cpp.o.d"
+  "/root/repo/src/blas_like/level3/MultiShiftQuasiTrsm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/MultiShiftQuasiTrsm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/MultiShiftQuasiTrsm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/MultiShiftTrsm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/MultiShiftTrsm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/MultiShiftTrsm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Multiply.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Multiply.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Multiply.cpp.o.d"
+  "/root/repo/src/blas_like/level3/NormalFromEVD.cpp" "CMakeFiles/El.dir/src/blas_like/level3/NormalFromEVD.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/NormalFromEVD.cpp.o.d"
+  "/root/repo/src/blas_like/level3/QuasiTrsm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/QuasiTrsm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/QuasiTrsm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/RFP.cpp" "CMakeFiles/El.dir/src/blas_like/level3/RFP.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/RFP.cpp.o.d"
+  "/root/repo/src/blas_like/level3/SafeMultiShiftTrsm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/SafeMultiShiftTrsm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/SafeMultiShiftTrsm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Symm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Symm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Symm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Syr2k.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Syr2k.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Syr2k.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Syrk.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Syrk.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Syrk.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Trdtrmm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Trdtrmm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Trdtrmm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Trmm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Trmm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Trmm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Trr2k.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Trr2k.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Trr2k.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Trrk.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Trrk.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Trrk.cpp.o.d"
+  "/root/repo/src/blas_like/level3/TrrkMulti.cpp" "CMakeFiles/El.dir/src/blas_like/level3/TrrkMulti.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/TrrkMulti.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Trsm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Trsm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Trsm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Trstrm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Trstrm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Trstrm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/Trtrmm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/Trtrmm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/Trtrmm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/TwoSidedTrmm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/TwoSidedTrmm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/TwoSidedTrmm.cpp.o.d"
+  "/root/repo/src/blas_like/level3/TwoSidedTrsm.cpp" "CMakeFiles/El.dir/src/blas_like/level3/TwoSidedTrsm.cpp.o" "gcc" "CMakeFiles/El.dir/src/blas_like/level3/TwoSidedTrsm.cpp.o.d"
+  "/root/repo/src/control-C.cpp" "CMakeFiles/El.dir/src/control-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/control-C.cpp.o.d"
+  "/root/repo/src/control/Kronecker.cpp" "CMakeFiles/El.dir/src/control/Kronecker.cpp.o" "gcc" "CMakeFiles/El.dir/src/control/Kronecker.cpp.o.d"
+  "/root/repo/src/control/Lyapunov.cpp" "CMakeFiles/El.dir/src/control/Lyapunov.cpp.o" "gcc" "CMakeFiles/El.dir/src/control/Lyapunov.cpp.o.d"
+  "/root/repo/src/control/Riccati.cpp" "CMakeFiles/El.dir/src/control/Riccati.cpp.o" "gcc" "CMakeFiles/El.dir/src/control/Riccati.cpp.o.d"
+  "/root/repo/src/control/Sylvester.cpp" "CMakeFiles/El.dir/src/control/Sylvester.cpp.o" "gcc" "CMakeFiles/El.dir/src/control/Sylvester.cpp.o.d"
+  "/root/repo/src/control/TriangularSylvester.cpp" "CMakeFiles/El.dir/src/control/TriangularSylvester.cpp.o" "gcc" "CMakeFiles/El.dir/src/control/TriangularSylvester.cpp.o.d"
+  "/root/repo/src/core/Compress.cpp" "CMakeFiles/El.dir/src/core/Compress.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Compress.cpp.o.d"
+  "/root/repo/src/core/CpuFeatures.cpp" "CMakeFiles/El.dir/src/core/CpuFeatures.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/CpuFeatures.cpp.o.d"
+  "/root/repo/src/core/DistGraph-C.cpp" "CMakeFiles/El.dir/src/core/DistGraph-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistGraph-C.cpp.o.d"
+  "/root/repo/src/core/DistGraph.cpp" "CMakeFiles/El.dir/src/core/DistGraph.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistGraph.cpp.o.d"
+  "/root/repo/src/core/DistMap.cpp" "CMakeFiles/El.dir/src/core/DistMap.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMap.cpp.o.d"
+  "/root/repo/src/core/DistMatrix-C.cpp" "CMakeFiles/El.dir/src/core/DistMatrix-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix-C.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Abstract.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Abstract.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Abstract.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/CIRC_CIRC.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/CIRC_CIRC.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/CIRC_CIRC.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/MC_MR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/MC_MR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/MC_MR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/MC_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/MC_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/MC_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/MD_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/MD_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/MD_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/MR_MC.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/MR_MC.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/MR_MC.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/MR_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/MR_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/MR_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/STAR_MC.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MC.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MC.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/STAR_MD.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MD.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MD.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/STAR_MR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/STAR_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/STAR_VC.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_VC.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_VC.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/STAR_VR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_VR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_VR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/VC_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/VC_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/VC_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Block/VR_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Block/VR_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Block/VR_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/CIRC_CIRC.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/CIRC_CIRC.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/CIRC_CIRC.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/MC_MR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/MC_MR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/MC_MR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/MC_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/MC_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/MC_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/MD_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/MD_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/MD_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/MR_MC.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/MR_MC.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/MR_MC.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/MR_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/MR_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/MR_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/STAR_MC.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MC.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MC.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/STAR_MD.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MD.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MD.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/STAR_MR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/STAR_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/STAR_VC.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_VC.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_VC.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/STAR_VR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_VR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_VR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/VC_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/VC_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/VC_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMatrix/Element/VR_STAR.cpp" "CMakeFiles/El.dir/src/core/DistMatrix/Element/VR_STAR.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMatrix/Element/VR_STAR.cpp.o.d"
+  "/root/repo/src/core/DistMultiVec-C.cpp" "CMakeFiles/El.dir/src/core/DistMultiVec-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistMultiVec-C.cpp.o.d"
+  "/root/repo/src/core/DistSparseMatrix-C.cpp" "CMakeFiles/El.dir/src/core/DistSparseMatrix-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/DistSparseMatrix-C.cpp.o.d"
+  "/root/repo/src/core/Element-C.cpp" "CMakeFiles/El.dir/src/core/Element-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Element-C.cpp.o.d"
+  "/root/repo/src/core/Element.cpp" "CMakeFiles/El.dir/src/core/Element.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Element.cpp.o.d"
+  "/root/repo/src/core/FlamePart/Merge-C.cpp" "CMakeFiles/El.dir/src/core/FlamePart/Merge-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/FlamePart/Merge-C.cpp.o.d"
+  "/root/repo/src/core/FlamePart/Merge.cpp" "CMakeFiles/El.dir/src/core/FlamePart/Merge.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/FlamePart/Merge.cpp.o.d"
+  "/root/repo/src/core/FlamePart/Partition-C.cpp" "CMakeFiles/El.dir/src/core/FlamePart/Partition-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/FlamePart/Partition-C.cpp.o.d"
+  "/root/repo/src/core/FlamePart/Partition.cpp" "CMakeFiles/El.dir/src/core/FlamePart/Partition.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/FlamePart/Partition.cpp.o.d"
+  "/root/repo/src/core/FlamePart/Repartition-C.cpp" "CMakeFiles/El.dir/src/core/FlamePart/Repartition-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/FlamePart/Repartition-C.cpp.o.d"
+  "/root/repo/src/core/FlamePart/Repartition.cpp" "CMakeFiles/El.dir/src/core/FlamePart/Repartition.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/FlamePart/Repartition.cpp.o.d"
+  "/root/repo/src/core/FlamePart/SlidePartition-C.cpp" "CMakeFiles/El.dir/src/core/FlamePart/SlidePartition-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/FlamePart/SlidePartition-C.cpp.o.d"
+  "/root/repo/src/core/FlamePart/SlidePartition.cpp" "CMakeFiles/El.dir/src/core/FlamePart/SlidePartition.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/FlamePart/SlidePartition.cpp.o.d"
+  "/root/repo/src/core/Graph-C.cpp" "CMakeFiles/El.dir/src/core/Graph-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Graph-C.cpp.o.d"
+  "/root/repo/src/core/Graph.cpp" "CMakeFiles/El.dir/src/core/Graph.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Graph.cpp.o.d"
+  "/root/repo/src/core/Grid-C.cpp" "CMakeFiles/El.dir/src/core/Grid-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Grid-C.cpp.o.d"
+  "/root/repo/src/core/Grid.cpp" "CMakeFiles/El.dir/src/core/Grid.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Grid.cpp.o.d"
+  "/root/repo/src/core/Instantiate.cpp" "CMakeFiles/El.dir/src/core/Instantiate.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Instantiate.cpp.o.d"
+  "/root/repo/src/core/Matrix-C.cpp" "CMakeFiles/El.dir/src/core/Matrix-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Matrix-C.cpp.o.d"
+  "/root/repo/src/core/Memory.cpp" "CMakeFiles/El.dir/src/core/Memory.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Memory.cpp.o.d"
+  "/root/repo/src/core/Proxy.cpp" "CMakeFiles/El.dir/src/core/Proxy.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Proxy.cpp.o.d"
+  "/root/repo/src/core/ReproducibleSum.cpp" "CMakeFiles/El.dir/src/core/ReproducibleSum.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/ReproducibleSum.cpp.o.d"
+  "/root/repo/src/core/Serialize.cpp" "CMakeFiles/El.dir/src/core/Serialize.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Serialize.cpp.o.d"
+  "/root/repo/src/core/SparseMatrix-C.cpp" "CMakeFiles/El.dir/src/core/SparseMatrix-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/SparseMatrix-C.cpp.o.d"
+  "/root/repo/src/core/Timer.cpp" "CMakeFiles/El.dir/src/core/Timer.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/Timer.cpp.o.d"
+  "/root/repo/src/core/View-C.cpp" "CMakeFiles/El.dir/src/core/View-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/View-C.cpp.o.d"
+  "/root/repo/src/core/callStack.cpp" "CMakeFiles/El.dir/src/core/callStack.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/callStack.cpp.o.d"
+  "/root/repo/src/core/environment.cpp" "CMakeFiles/El.dir/src/core/environment.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/environment.cpp.o.d"
+  "/root/repo/src/core/global-C.cpp" "CMakeFiles/El.dir/src/core/global-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/global-C.cpp.o.d"
+  "/root/repo/src/core/imports/blas.cpp" "CMakeFiles/El.dir/src/core/imports/blas.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/blas.cpp.o.d"
+  "/root/repo/src/core/imports/cublas.cpp" "CMakeFiles/El.dir/src/core/imports/cublas.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/cublas.cpp.o.d"
+  "/root/repo/src/core/imports/flame.cpp" "CMakeFiles/El.dir/src/core/imports/flame.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/flame.cpp.o.d"
+  "/root/repo/src/core/imports/lapack.cpp" "CMakeFiles/El.dir/src/core/imports/lapack.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/lapack.cpp.o.d"
+  "/root/repo/src/core/imports/mkl.cpp" "CMakeFiles/El.dir/src/core/imports/mkl.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/mkl.cpp.o.d"
+  "/root/repo/src/core/imports/mpfr.cpp" "CMakeFiles/El.dir/src/core/imports/mpfr.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/mpfr.cpp.o.d"
+  "/root/repo/src/core/imports/mpfr/BigFloat.cpp" "CMakeFiles/El.dir/src/core/imports/mpfr/BigFloat.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/mpfr/BigFloat.cpp.o.d"
+  "/root/repo/src/core/imports/mpfr/BigInt.cpp" "CMakeFiles/El.dir/src/core/imports/mpfr/BigInt.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/mpfr/BigInt.cpp.o.d"
+  "/root/repo/src/core/imports/mpi-C.cpp" "CMakeFiles/El.dir/src/core/imports/mpi-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/mpi-C.cpp.o.d"
+  "/root/repo/src/core/imports/mpi.cpp" "CMakeFiles/El.dir/src/core/imports/mpi.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/mpi.cpp.o.d"
+  "/root/repo/src/core/imports/openblas.cpp" "CMakeFiles/El.dir/src/core/imports/openblas.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/openblas.cpp.o.d"
+  "/root/repo/src/core/imports/pmrrr.cpp" "CMakeFiles/El.dir/src/core/imports/pmrrr.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/pmrrr.cpp.o.d"
+  "/root/repo/src/core/imports/qd.cpp" "CMakeFiles/El.dir/src/core/imports/qd.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/qd.cpp.o.d"
+  "/root/repo/src/core/imports/qt5.cpp" "CMakeFiles/El.dir/src/core/imports/qt5.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/qt5.cpp.o.d"
+  "/root/repo/src/core/imports/scalapack.cpp" "CMakeFiles/El.dir/src/core/imports/scalapack.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/scalapack.cpp.o.d"
+  "/root/repo/src/core/imports/scalapack/blacs.cpp" "CMakeFiles/El.dir/src/core/imports/scalapack/blacs.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/scalapack/blacs.cpp.o.d"
+  "/root/repo/src/core/imports/scalapack/pblas.cpp" "CMakeFiles/El.dir/src/core/imports/scalapack/pblas.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/imports/scalapack/pblas.cpp.o.d"
+  "/root/repo/src/core/indent.cpp" "CMakeFiles/El.dir/src/core/indent.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/indent.cpp.o.d"
+  "/root/repo/src/core/logging.cpp" "CMakeFiles/El.dir/src/core/logging.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/logging.cpp.o.d"
+  "/root/repo/src/core/mpi_register.cpp" "CMakeFiles/El.dir/src/core/mpi_register.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/mpi_register.cpp.o.d"
+  "/root/repo/src/core/random.cpp" "CMakeFiles/El.dir/src/core/random.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/random.cpp.o.d"
+  "/root/repo/src/core/types.cpp" "CMakeFiles/El.dir/src/core/types.cpp.o" "gcc" "CMakeFiles/El.dir/src/core/types.cpp.o.d"
+  "/root/repo/src/io-C.cpp" "CMakeFiles/El.dir/src/io-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/io-C.cpp.o.d"
+  "/root/repo/src/io.cpp" "CMakeFiles/El.dir/src/io.cpp.o" "gcc" "CMakeFiles/El.dir/src/io.cpp.o.d"
+  "/root/repo/src/io/Checkpoint.cpp" "CMakeFiles/El.dir/src/io/Checkpoint.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/Checkpoint.cpp.o.d"
+  "/root/repo/src/io/ColorMap.cpp" "CMakeFiles/El.dir/src/io/ColorMap.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/ColorMap.cpp.o.d"
+  "/root/repo/src/io/ComplexDisplayWindow.cpp" "CMakeFiles/El.dir/src/io/ComplexDisplayWindow.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/ComplexDisplayWindow.cpp.o.d"
+  "/root/repo/src/io/Display.cpp" "CMakeFiles/El.dir/src/io/Display.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/Display.cpp.o.d"
+  "/root/repo/src/io/DisplayWidget.cpp" "CMakeFiles/El.dir/src/io/DisplayWidget.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/DisplayWidget.cpp.o.d"
+  "/root/repo/src/io/DisplayWindow.cpp" "CMakeFiles/El.dir/src/io/DisplayWindow.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/DisplayWindow.cpp.o.d"
+  "/root/repo/src/io/Downsample.cpp" "CMakeFiles/El.dir/src/io/Downsample.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/Downsample.cpp.o.d"
+  "/root/repo/src/io/File.cpp" "CMakeFiles/El.dir/src/io/File.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/File.cpp.o.d"
+  "/root/repo/src/io/Print.cpp" "CMakeFiles/El.dir/src/io/Print.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/Print.cpp.o.d"
+  "/root/repo/src/io/Read.cpp" "CMakeFiles/El.dir/src/io/Read.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/Read.cpp.o.d"
+  "/root/repo/src/io/Spy.cpp" "CMakeFiles/El.dir/src/io/Spy.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/Spy.cpp.o.d"
+  "/root/repo/src/io/SpyWidget.cpp" "CMakeFiles/El.dir/src/io/SpyWidget.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/SpyWidget.cpp.o.d"
+  "/root/repo/src/io/SpyWindow.cpp" "CMakeFiles/El.dir/src/io/SpyWindow.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/SpyWindow.cpp.o.d"
+  "/root/repo/src/io/Write.cpp" "CMakeFiles/El.dir/src/io/Write.cpp.o" "gcc" "CMakeFiles/El.dir/src/io/Write.cpp.o.d"
+  "/root/repo/src/lapack_like/condense-C.cpp" "CMakeFiles/El.dir/src/lapack_like/condense-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/condense-C.cpp.o.d"
+  "/root/repo/src/lapack_like/condense/Bidiag.cpp" "CMakeFiles/El.dir/src/lapack_like/condense/Bidiag.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/condense/Bidiag.cpp.o.d"
+  "/root/repo/src/lapack_like/condense/HermitianTridiag.cpp" "CMakeFiles/El.dir/src/lapack_like/condense/HermitianTridiag.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/condense/HermitianTridiag.cpp.o.d"
+  "/root/repo/src/lapack_like/condense/Hessenberg.cpp" "CMakeFiles/El.dir/src/lapack_like/condense/Hessenberg.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/condense/Hessenberg.cpp.o.d"
+  "/root/repo/src/lapack_like/equilibrate/GeomEquil.cpp" "CMakeFiles/El.dir/src/lapack_like/equilibrate/GeomEquil.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/equilibrate/GeomEquil.cpp.o.d"
+  "/root/repo/src/lapack_like/equilibrate/RuizEquil.cpp" "CMakeFiles/El.dir/src/lapack_like/equilibrate/RuizEquil.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/equilibrate/RuizEquil.cpp.o.d"
+  "/root/repo/src/lapack_like/equilibrate/SymmetricDiagonalEquil.cpp" "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricDiagonalEquil.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricDiagonalEquil.cpp.o.d"
+  "/root/repo/src/lapack_like/equilibrate/SymmetricGeomEquil.cpp" "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricGeomEquil.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricGeomEquil.cpp.o.d"
+  "/root/repo/src/lapack_like/equilibrate/SymmetricRuizEquil.cpp" "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricRuizEquil.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricRuizEquil.cpp.o.d"
+  "/root/repo/src/lapack_like/euclidean_min-C.cpp" "CMakeFiles/El.dir/src/lapack_like/euclidean_min-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/euclidean_min-C.cpp.o.d"
+  "/root/repo/src/lapack_like/euclidean_min/GLM.cpp" "CMakeFiles/El.dir/src/lapack_like/euclidean_min/GLM.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/euclidean_min/GLM.cpp.o.d"
+  "/root/repo/src/lapack_like/euclidean_min/LSE.cpp" "CMakeFiles/El.dir/src/lapack_like/euclidean_min/LSE.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/euclidean_min/LSE.cpp.o.d"
+  "/root/repo/src/lapack_like/euclidean_min/LeastSquares.cpp" "CMakeFiles/El.dir/src/lapack_like/euclidean_min/LeastSquares.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/euclidean_min/LeastSquares.cpp.o.d"
+  "/root/repo/src/lapack_like/euclidean_min/Ridge.cpp" "CMakeFiles/El.dir/src/lapack_like/euclidean_min/Ridge.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/euclidean_min/Ridge.cpp.o.d"
+  "/root/repo/src/lapack_like/euclidean_min/Tikhonov.cpp" "CMakeFiles/El.dir/src/lapack_like/euclidean_min/Tikhonov.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/euclidean_min/Tikhonov.cpp.o.d"
+  "/root/repo/src/lapack_like/factor-C.cpp" "CMakeFiles/El.dir/src/lapack_like/factor-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor-C.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/Cholesky.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/Cholesky.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/Cholesky.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/CholeskyRFP.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/CholeskyRFP.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/CholeskyRFP.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/GQR.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/GQR.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/GQR.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/GRQ.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/GRQ.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/GRQ.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/ID.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/ID.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/ID.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/ChangeFrontType.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/ChangeFrontType.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/ChangeFrontType.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/CompressFronts.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/CompressFronts.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/CompressFronts.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/Determinant.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/Determinant.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/Determinant.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/DiagonalScale.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DiagonalScale.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DiagonalScale.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/DiagonalSolve.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DiagonalSolve.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DiagonalSolve.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/DistFront.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistFront.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistFront.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/DistMatrixNode.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistMatrixNode.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistMatrixNode.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/DistMultiVecNode.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistMultiVecNode.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistMultiVecNode.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/DistSparseLDLFactorization.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistSparseLDLFactorization.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistSparseLDLFactorization.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/Front.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/Front.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/Front.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/FrontType.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/FrontType.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/FrontType.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/InverseDiagonal.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/InverseDiagonal.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/InverseDiagonal.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/MatrixNode.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/MatrixNode.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/MatrixNode.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/ModifyFactorization.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/ModifyFactorization.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/ModifyFactorization.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/SparseLDLFactorization.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/SparseLDLFactorization.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/SparseLDLFactorization.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/numeric/SpillFronts.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/SpillFronts.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/SpillFronts.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/symbolic/Analysis.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/Analysis.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/Analysis.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/symbolic/NaturalNestedDissection.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NaturalNestedDissection.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NaturalNestedDissection.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/symbolic/NestedDissection.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NestedDissection.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NestedDissection.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/symbolic/NodeInfo.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NodeInfo.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NodeInfo.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LDL/sparse/symbolic/Separator.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/Separator.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/Separator.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LQ.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LQ.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LQ.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/LU.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/LU.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/LU.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/Monitor.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/Monitor.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/Monitor.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/QR.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/QR.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/QR.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/RQ.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/RQ.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/RQ.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/RegularizedLDL/SolveAfter.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/RegularizedLDL/SolveAfter.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/RegularizedLDL/SolveAfter.cpp.o.d"
+  "/root/repo/src/lapack_like/factor/Skeleton.cpp" "CMakeFiles/El.dir/src/lapack_like/factor/Skeleton.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/factor/Skeleton.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs-C.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs-C.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/Exponential.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/Exponential.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/Exponential.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/HermitianFunction.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/HermitianFunction.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/HermitianFunction.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/Inverse/General.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/General.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/General.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/Inverse/HPD.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/HPD.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/HPD.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/Inverse/Hermitian.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Hermitian.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Hermitian.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/Inverse/Symmetric.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Symmetric.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Symmetric.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/Inverse/Triangular.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Triangular.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Triangular.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/Pseudoinverse.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/Pseudoinverse.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/Pseudoinverse.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/RandomizedPseudoinverse.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/RandomizedPseudoinverse.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/RandomizedPseudoinverse.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/Sign.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/Sign.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/Sign.cpp.o.d"
+  "/root/repo/src/lapack_like/funcs/SquareRoot.cpp" "CMakeFiles/El.dir/src/lapack_like/funcs/SquareRoot.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/funcs/SquareRoot.cpp.o.d"
+  "/root/repo/src/lapack_like/perm-C.cpp" "CMakeFiles/El.dir/src/lapack_like/perm-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/perm-C.cpp.o.d"
+  "/root/repo/src/lapack_like/perm/DistPermutation.cpp" "CMakeFiles/El.dir/src/lapack_like/perm/DistPermutation.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/perm/DistPermutation.cpp.o.d"
+  "/root/repo/src/lapack_like/perm/Permutation.cpp" "CMakeFiles/El.dir/src/lapack_like/perm/Permutation.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/perm/Permutation.cpp.o.d"
+  "/root/repo/src/lapack_like/perm/PermutationMeta.cpp" "CMakeFiles/El.dir/src/lapack_like/perm/PermutationMeta.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/perm/PermutationMeta.cpp.o.d"
+  "/root/repo/src/lapack_like/perm/PivotsToPartialPermutation.cpp" "CMakeFiles/El.dir/src/lapack_like/perm/PivotsToPartialPermutation.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/perm/PivotsToPartialPermutation.cpp.o.d"
+  "/root/repo/src/lapack_like/props-C.cpp" "CMakeFiles/El.dir/src/lapack_like/props-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props-C.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Condition.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Condition.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Condition.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Condition/Frobenius.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Condition/Frobenius.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Condition/Frobenius.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Condition/Infinity.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Condition/Infinity.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Condition/Infinity.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Condition/Max.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Condition/Max.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Condition/Max.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Condition/One.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Condition/One.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Condition/One.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Condition/Two.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Condition/Two.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Condition/Two.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Determinant.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Determinant.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Determinant.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Inertia.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Inertia.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Inertia.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/Entrywise.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Entrywise.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Entrywise.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/Frobenius.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Frobenius.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Frobenius.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/Infinity.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Infinity.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Infinity.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/KyFan.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/KyFan.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/KyFan.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/KyFanSchatten.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/KyFanSchatten.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/KyFanSchatten.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/Max.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Max.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Max.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/Nuclear.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Nuclear.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Nuclear.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/One.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/One.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/One.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/OneEstimate.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/OneEstimate.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/OneEstimate.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/Schatten.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Schatten.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Schatten.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/Two.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Two.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Two.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/TwoEstimate.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/TwoEstimate.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/TwoEstimate.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Norm/Zero.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Zero.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Norm/Zero.cpp.o.d"
+  "/root/repo/src/lapack_like/props/Trace.cpp" "CMakeFiles/El.dir/src/lapack_like/props/Trace.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/Trace.cpp.o.d"
+  "/root/repo/src/lapack_like/props/TraceEstimate.cpp" "CMakeFiles/El.dir/src/lapack_like/props/TraceEstimate.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/props/TraceEstimate.cpp.o.d"
+  "/root/repo/src/lapack_like/reflect-C.cpp" "CMakeFiles/El.dir/src/lapack_like/reflect-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/reflect-C.cpp.o.d"
+  "/root/repo/src/lapack_like/reflect/ApplyPacked.cpp" "CMakeFiles/El.dir/src/lapack_like/reflect/ApplyPacked.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/reflect/ApplyPacked.cpp.o.d"
+  "/root/repo/src/lapack_like/reflect/ExpandPacked.cpp" "CMakeFiles/El.dir/src/lapack_like/reflect/ExpandPacked.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/reflect/ExpandPacked.cpp.o.d"
+  "/root/repo/src/lapack_like/reflect/Householder.cpp" "CMakeFiles/El.dir/src/lapack_like/reflect/Householder.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/reflect/Householder.cpp.o.d"
+  "/root/repo/src/lapack_like/reflect/Hyperbolic.cpp" "CMakeFiles/El.dir/src/lapack_like/reflect/Hyperbolic.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/reflect/Hyperbolic.cpp.o.d"
+  "/root/repo/src/lapack_like/solve-C.cpp" "CMakeFiles/El.dir/src/lapack_like/solve-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve-C.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/Banded.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/Banded.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/Banded.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/HPD.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/HPD.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/HPD.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/Hermitian.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/Hermitian.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/Hermitian.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/Linear.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/Linear.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/Linear.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/MixedPrecision.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/MixedPrecision.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/MixedPrecision.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/MultiShiftHess.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/MultiShiftHess.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/MultiShiftHess.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/Multicolor.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/Multicolor.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/Multicolor.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/SPAI.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/SPAI.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/SPAI.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/SQSD.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/SQSD.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/SQSD.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/Speculative.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/Speculative.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/Speculative.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/Symmetric.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/Symmetric.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/Symmetric.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/Toeplitz.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/Toeplitz.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/Toeplitz.cpp.o.d"
+  "/root/repo/src/lapack_like/solve/TwoLevelAggregation.cpp" "CMakeFiles/El.dir/src/lapack_like/solve/TwoLevelAggregation.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/solve/TwoLevelAggregation.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral-C.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral-C.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/BidiagSVD.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/BidiagSVD.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/BidiagSVD.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/CubicSecular.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/CubicSecular.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/CubicSecular.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/Eig.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/Eig.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/Eig.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/ExtremalSingValEst.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/ExtremalSingValEst.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/ExtremalSingValEst.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/FilteredSubspace.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/FilteredSubspace.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/FilteredSubspace.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/HermitianEig.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianEig.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianEig.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/HermitianGenDefEig.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianGenDefEig.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianGenDefEig.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/HermitianSVD.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianSVD.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianSVD.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/HermitianTridiagEig.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianTridiagEig.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianTridiagEig.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/HessenbergSchur.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/HessenbergSchur.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/HessenbergSchur.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/ImageAndKernel.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/ImageAndKernel.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/ImageAndKernel.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/IncrementalSVD.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/IncrementalSVD.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/IncrementalSVD.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/Lanczos.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/Lanczos.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/Lanczos.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/Polar.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/Polar.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/Polar.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/ProductLanczos.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/ProductLanczos.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/ProductLanczos.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/Pseudospectra.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/Pseudospectra.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/Pseudospectra.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/SVD.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/SVD.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/SVD.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/Schur.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/Schur.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/Schur.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/SecularEVD.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/SecularEVD.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/SecularEVD.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/SecularSVD.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/SecularSVD.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/SecularSVD.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/SkewHermitianEig.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/SkewHermitianEig.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/SkewHermitianEig.cpp.o.d"
+  "/root/repo/src/lapack_like/spectral/TriangEig.cpp" "CMakeFiles/El.dir/src/lapack_like/spectral/TriangEig.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/spectral/TriangEig.cpp.o.d"
+  "/root/repo/src/lapack_like/util-C.cpp" "CMakeFiles/El.dir/src/lapack_like/util-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/util-C.cpp.o.d"
+  "/root/repo/src/lapack_like/util/Bisect.cpp" "CMakeFiles/El.dir/src/lapack_like/util/Bisect.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/util/Bisect.cpp.o.d"
+  "/root/repo/src/lapack_like/util/Median.cpp" "CMakeFiles/El.dir/src/lapack_like/util/Median.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/util/Median.cpp.o.d"
+  "/root/repo/src/lapack_like/util/NaturalBisect.cpp" "CMakeFiles/El.dir/src/lapack_like/util/NaturalBisect.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/util/NaturalBisect.cpp.o.d"
+  "/root/repo/src/lapack_like/util/Sort.cpp" "CMakeFiles/El.dir/src/lapack_like/util/Sort.cpp.o" "gcc" "CMakeFiles/El.dir/src/lapack_like/util/Sort.cpp.o.d"
+  "/root/repo/src/matrices-C.cpp" "CMakeFiles/El.dir/src/matrices-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices-C.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Cauchy.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Cauchy.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Cauchy.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/CauchyLike.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/CauchyLike.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/CauchyLike.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Diagonal.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Diagonal.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Diagonal.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Egorov.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Egorov.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Egorov.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Fiedler.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Fiedler.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Fiedler.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Fourier.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Fourier.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Fourier.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/GCDMatrix.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/GCDMatrix.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/GCDMatrix.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Hankel.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Hankel.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Hankel.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Hilbert.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Hilbert.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Hilbert.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Identity.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Identity.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Identity.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Jordan.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Jordan.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Jordan.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/MatrixFreeOperator.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/MatrixFreeOperator.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/MatrixFreeOperator.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Ones.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Ones.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Ones.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Toeplitz.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Toeplitz.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Toeplitz.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Walsh.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Walsh.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Walsh.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/classical/Zeros.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Zeros.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/classical/Zeros.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/integral/FoxLi.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/integral/FoxLi.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/integral/FoxLi.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Demmel.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Demmel.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Demmel.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/DruinskyToledo.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/DruinskyToledo.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/DruinskyToledo.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/DynamicRegCounter.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/DynamicRegCounter.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/DynamicRegCounter.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Ehrenfest.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Ehrenfest.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Ehrenfest.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/ExtendedKahan.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/ExtendedKahan.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/ExtendedKahan.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/GEPPGrowth.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/GEPPGrowth.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/GEPPGrowth.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/GKS.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/GKS.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/GKS.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Gear.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Gear.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Gear.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Hanowa.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Hanowa.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Hanowa.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/JordanCholesky.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/JordanCholesky.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/JordanCholesky.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/KMS.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/KMS.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/KMS.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Kahan.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Kahan.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Kahan.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Lauchli.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lauchli.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lauchli.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Legendre.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Legendre.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Legendre.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Lehmer.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lehmer.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lehmer.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Lotkin.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lotkin.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lotkin.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/MinIJ.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/MinIJ.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/MinIJ.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Parter.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Parter.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Parter.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Pei.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Pei.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Pei.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Redheffer.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Redheffer.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Redheffer.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Riffle.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Riffle.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Riffle.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Ris.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Ris.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Ris.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/misc/Wilkinson.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Wilkinson.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/misc/Wilkinson.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/pde/Helmholtz.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/pde/Helmholtz.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/pde/Helmholtz.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/pde/HelmholtzPML.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/pde/HelmholtzPML.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/pde/HelmholtzPML.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/pde/Laplacian.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/pde/Laplacian.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/pde/Laplacian.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/sparse_toeplitz/BullsHead.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/BullsHead.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/BullsHead.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/sparse_toeplitz/Forsythe.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Forsythe.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Forsythe.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/sparse_toeplitz/Grcar.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Grcar.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Grcar.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/sparse_toeplitz/OneTwoOne.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/OneTwoOne.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/OneTwoOne.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/sparse_toeplitz/TrefethenEmbree.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/TrefethenEmbree.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/TrefethenEmbree.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/sparse_toeplitz/TriW.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/TriW.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/TriW.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/sparse_toeplitz/Triangle.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Triangle.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Triangle.cpp.o.d"
+  "/root/repo/src/matrices/deterministic/sparse_toeplitz/Whale.cpp" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Whale.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Whale.cpp.o.d"
+  "/root/repo/src/matrices/random/independent/Bernoulli.cpp" "CMakeFiles/El.dir/src/matrices/random/independent/Bernoulli.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/independent/Bernoulli.cpp.o.d"
+  "/root/repo/src/matrices/random/independent/Gaussian.cpp" "CMakeFiles/El.dir/src/matrices/random/independent/Gaussian.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/independent/Gaussian.cpp.o.d"
+  "/root/repo/src/matrices/random/independent/Rademacher.cpp" "CMakeFiles/El.dir/src/matrices/random/independent/Rademacher.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/independent/Rademacher.cpp.o.d"
+  "/root/repo/src/matrices/random/independent/ThreeValued.cpp" "CMakeFiles/El.dir/src/matrices/random/independent/ThreeValued.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/independent/ThreeValued.cpp.o.d"
+  "/root/repo/src/matrices/random/independent/Uniform.cpp" "CMakeFiles/El.dir/src/matrices/random/independent/Uniform.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/independent/Uniform.cpp.o.d"
+  "/root/repo/src/matrices/random/lattice/AjtaiTypeBasis.cpp" "CMakeFiles/El.dir/src/matrices/random/lattice/AjtaiTypeBasis.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/lattice/AjtaiTypeBasis.cpp.o.d"
+  "/root/repo/src/matrices/random/lattice/KnapsackTypeBasis.cpp" "CMakeFiles/El.dir/src/matrices/random/lattice/KnapsackTypeBasis.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/lattice/KnapsackTypeBasis.cpp.o.d"
+  "/root/repo/src/matrices/random/misc/Haar.cpp" "CMakeFiles/El.dir/src/matrices/random/misc/Haar.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/misc/Haar.cpp.o.d"
+  "/root/repo/src/matrices/random/misc/HatanoNelson.cpp" "CMakeFiles/El.dir/src/matrices/random/misc/HatanoNelson.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/misc/HatanoNelson.cpp.o.d"
+  "/root/repo/src/matrices/random/misc/HermitianUniformSpectrum.cpp" "CMakeFiles/El.dir/src/matrices/random/misc/HermitianUniformSpectrum.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/misc/HermitianUniformSpectrum.cpp.o.d"
+  "/root/repo/src/matrices/random/misc/NormalUniformSpectrum.cpp" "CMakeFiles/El.dir/src/matrices/random/misc/NormalUniformSpectrum.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/misc/NormalUniformSpectrum.cpp.o.d"
+  "/root/repo/src/matrices/random/misc/UniformHelmholtzGreens.cpp" "CMakeFiles/El.dir/src/matrices/random/misc/UniformHelmholtzGreens.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/misc/UniformHelmholtzGreens.cpp.o.d"
+  "/root/repo/src/matrices/random/misc/Wigner.cpp" "CMakeFiles/El.dir/src/matrices/random/misc/Wigner.cpp.o" "gcc" "CMakeFiles/El.dir/src/matrices/random/misc/Wigner.cpp.o.d"
+  "/root/repo/src/number_theory/TrialDivSieve.cpp" "CMakeFiles/El.dir/src/number_theory/TrialDivSieve.cpp.o" "gcc" "CMakeFiles/El.dir/src/number_theory/TrialDivSieve.cpp.o.d"
+  "/root/repo/src/number_theory/lattice-C.cpp" "CMakeFiles/El.dir/src/number_theory/lattice-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/number_theory/lattice-C.cpp.o.d"
+  "/root/repo/src/number_theory/lattice/AlgebraicRelationSearch.cpp" "CMakeFiles/El.dir/src/number_theory/lattice/AlgebraicRelationSearch.cpp.o" "gcc" "CMakeFiles/El.dir/src/number_theory/lattice/AlgebraicRelationSearch.cpp.o.d"
+  "/root/repo/src/number_theory/lattice/Coordinates.cpp" "CMakeFiles/El.dir/src/number_theory/lattice/Coordinates.cpp.o" "gcc" "CMakeFiles/El.dir/src/number_theory/lattice/Coordinates.cpp.o.d"
+  "/root/repo/src/number_theory/lattice/Enumerate.cpp" "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate.cpp.o" "gcc" "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate.cpp.o.d"
+  "/root/repo/src/number_theory/lattice/Enumerate/GNR.cpp" "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate/GNR.cpp.o" "gcc" "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate/GNR.cpp.o.d"
+  "/root/repo/src/number_theory/lattice/Enumerate/Phase.cpp" "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate/Phase.cpp.o" "gcc" "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate/Phase.cpp.o.d"
+  "/root/repo/src/number_theory/lattice/ImageAndKernel.cpp" "CMakeFiles/El.dir/src/number_theory/lattice/ImageAndKernel.cpp.o" "gcc" "CMakeFiles/El.dir/src/number_theory/lattice/ImageAndKernel.cpp.o.d"
+  "/root/repo/src/number_theory/lattice/LogPotential.cpp" "CMakeFiles/El.dir/src/number_theory/lattice/LogPotential.cpp.o" "gcc" "CMakeFiles/El.dir/src/number_theory/lattice/LogPotential.cpp.o.d"
+  "/root/repo/src/number_theory/lattice/ZDependenceSearch.cpp" "CMakeFiles/El.dir/src/number_theory/lattice/ZDependenceSearch.cpp.o" "gcc" "CMakeFiles/El.dir/src/number_theory/lattice/ZDependenceSearch.cpp.o.d"
+  "/root/repo/src/optimization/models-C.cpp" "CMakeFiles/El.dir/src/optimization/models-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models-C.cpp.o.d"
+  "/root/repo/src/optimization/models/BP.cpp" "CMakeFiles/El.dir/src/optimization/models/BP.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/BP.cpp.o.d"
+  "/root/repo/src/optimization/models/BPDN.cpp" "CMakeFiles/El.dir/src/optimization/models/BPDN.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/BPDN.cpp.o.d"
+  "/root/repo/src/optimization/models/CP.cpp" "CMakeFiles/El.dir/src/optimization/models/CP.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/CP.cpp.o.d"
+  "/root/repo/src/optimization/models/DS.cpp" "CMakeFiles/El.dir/src/optimization/models/DS.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/DS.cpp.o.d"
+  "/root/repo/src/optimization/models/EN.cpp" "CMakeFiles/El.dir/src/optimization/models/EN.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/EN.cpp.o.d"
+  "/root/repo/src/optimization/models/LAV.cpp" "CMakeFiles/El.dir/src/optimization/models/LAV.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/LAV.cpp.o.d"
+  "/root/repo/src/optimization/models/LongOnlyPortfolio.cpp" "CMakeFiles/El.dir/src/optimization/models/LongOnlyPortfolio.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/LongOnlyPortfolio.cpp.o.d"
+  "/root/repo/src/optimization/models/NMF.cpp" "CMakeFiles/El.dir/src/optimization/models/NMF.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/NMF.cpp.o.d"
+  "/root/repo/src/optimization/models/NNLS.cpp" "CMakeFiles/El.dir/src/optimization/models/NNLS.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/NNLS.cpp.o.d"
+  "/root/repo/src/optimization/models/RLS.cpp" "CMakeFiles/El.dir/src/optimization/models/RLS.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/RLS.cpp.o.d"
+  "/root/repo/src/optimization/models/RNNLS.cpp" "CMakeFiles/El.dir/src/optimization/models/RNNLS.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/RNNLS.cpp.o.d"
+  "/root/repo/src/optimization/models/RPCA.cpp" "CMakeFiles/El.dir/src/optimization/models/RPCA.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/RPCA.cpp.o.d"
+  "/root/repo/src/optimization/models/SVM.cpp" "CMakeFiles/El.dir/src/optimization/models/SVM.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/SVM.cpp.o.d"
+  "/root/repo/src/optimization/models/SparseInvCov.cpp" "CMakeFiles/El.dir/src/optimization/models/SparseInvCov.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/SparseInvCov.cpp.o.d"
+  "/root/repo/src/optimization/models/TV.cpp" "CMakeFiles/El.dir/src/optimization/models/TV.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/models/TV.cpp.o.d"
+  "/root/repo/src/optimization/prox-c.cpp" "CMakeFiles/El.dir/src/optimization/prox-c.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/prox-c.cpp.o.d"
+  "/root/repo/src/optimization/prox/Clip.cpp" "CMakeFiles/El.dir/src/optimization/prox/Clip.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/prox/Clip.cpp.o.d"
+  "/root/repo/src/optimization/prox/FrobeniusProx.cpp" "CMakeFiles/El.dir/src/optimization/prox/FrobeniusProx.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/prox/FrobeniusProx.cpp.o.d"
+  "/root/repo/src/optimization/prox/HingeLossProx.cpp" "CMakeFiles/El.dir/src/optimization/prox/HingeLossProx.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/prox/HingeLossProx.cpp.o.d"
+  "/root/repo/src/optimization/prox/LogisticProx.cpp" "CMakeFiles/El.dir/src/optimization/prox/LogisticProx.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/prox/LogisticProx.cpp.o.d"
+  "/root/repo/src/optimization/prox/SVT.cpp" "CMakeFiles/El.dir/src/optimization/prox/SVT.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/prox/SVT.cpp.o.d"
+  "/root/repo/src/optimization/prox/SoftThreshold.cpp" "CMakeFiles/El.dir/src/optimization/prox/SoftThreshold.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/prox/SoftThreshold.cpp.o.d"
+  "/root/repo/src/optimization/solvers-C.cpp" "CMakeFiles/El.dir/src/optimization/solvers-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers-C.cpp.o.d"
+  "/root/repo/src/optimization/solvers/LP.cpp" "CMakeFiles/El.dir/src/optimization/solvers/LP.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/LP.cpp.o.d"
+  "/root/repo/src/optimization/solvers/LP/affine/IPM/Mehrotra.cpp" "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/Mehrotra.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/Mehrotra.cpp.o.d"
+  "/root/repo/src/optimization/solvers/LP/affine/IPM/util/FullKKT.cpp" "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/util/FullKKT.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/util/FullKKT.cpp.o.d"
+  "/root/repo/src/optimization/solvers/LP/affine/IPM/util/Initialize.cpp" "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/util/Initialize.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/util/Initialize.cpp.o.d"
+  "/root/repo/src/optimization/solvers/LP/direct/ADMM.cpp" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/ADMM.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/ADMM.cpp.o.d"
+  "/root/repo/src/optimization/solvers/LP/direct/IPM/Mehrotra.cpp" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/Mehrotra.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/Mehrotra.cpp.o.d"
+  "/root/repo/src/optimization/solvers/LP/direct/IPM/util/AugmentedKKT.cpp" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/AugmentedKKT.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/AugmentedKKT.cpp.o.d"
+  "/root/repo/src/optimization/solvers/LP/direct/IPM/util/FullKKT.cpp" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/FullKKT.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/FullKKT.cpp.o.d"
+  "/root/repo/src/optimization/solvers/LP/direct/IPM/util/Initialize.cpp" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/Initialize.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/Initialize.cpp.o.d"
+  "/root/repo/src/optimization/solvers/LP/direct/IPM/util/NormalKKT.cpp" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/NormalKKT.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/NormalKKT.cpp.o.d"
+  "/root/repo/src/optimization/solvers/QP.cpp" "CMakeFiles/El.dir/src/optimization/solvers/QP.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/QP.cpp.o.d"
+  "/root/repo/src/optimization/solvers/QP/affine/IPM/Mehrotra.cpp" "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/Mehrotra.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/Mehrotra.cpp.o.d"
+  "/root/repo/src/optimization/solvers/QP/affine/IPM/util/FullKKT.cpp" "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/util/FullKKT.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/util/FullKKT.cpp.o.d"
+  "/root/repo/src/optimization/solvers/QP/affine/IPM/util/Initialize.cpp" "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/util/Initialize.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/util/Initialize.cpp.o.d"
+  "/root/repo/src/optimization/solvers/QP/box/ADMM.cpp" "CMakeFiles/El.dir/src/optimization/solvers/QP/box/ADMM.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/QP/box/ADMM.cpp.o.d"
+  "/root/repo/src/optimization/solvers/QP/direct/IPM/Mehrotra.cpp" "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/Mehrotra.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/Mehrotra.cpp.o.d"
+  "/root/repo/src/optimization/solvers/QP/direct/IPM/util/AugmentedKKT.cpp" "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/AugmentedKKT.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/AugmentedKKT.cpp.o.d"
+  "/root/repo/src/optimization/solvers/QP/direct/IPM/util/FullKKT.cpp" "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/FullKKT.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/FullKKT.cpp.o.d"
+  "/root/repo/src/optimization/solvers/QP/direct/IPM/util/Initialize.cpp" "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/Initialize.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/Initialize.cpp.o.d"
+  "/root/repo/src/optimization/solvers/SOCP.cpp" "CMakeFiles/El.dir/src/optimization/solvers/SOCP.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/SOCP.cpp.o.d"
+  "/root/repo/src/optimization/solvers/SOCP/affine/IPM/Mehrotra.cpp" "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/Mehrotra.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/Mehrotra.cpp.o.d"
+  "/root/repo/src/optimization/solvers/SOCP/affine/IPM/util/FullKKT.cpp" "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/util/FullKKT.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/util/FullKKT.cpp.o.d"
+  "/root/repo/src/optimization/solvers/SOCP/affine/IPM/util/Initialize.cpp" "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/util/Initialize.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/util/Initialize.cpp.o.d"
+  "/root/repo/src/optimization/solvers/SOCP/direct/IPM/Mehrotra.cpp" "CMakeFiles/El.dir/src/optimization/solvers/SOCP/direct/IPM/Mehrotra.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/solvers/SOCP/direct/IPM/Mehrotra.cpp.o.d"
+  "/root/repo/src/optimization/util-C.cpp" "CMakeFiles/El.dir/src/optimization/util-C.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util-C.cpp.o.d"
+  "/root/repo/src/optimization/util/Coherence.cpp" "CMakeFiles/El.dir/src/optimization/util/Coherence.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/Coherence.cpp.o.d"
+  "/root/repo/src/optimization/util/Cone/AllReduce.cpp" "CMakeFiles/El.dir/src/optimization/util/Cone/AllReduce.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/Cone/AllReduce.cpp.o.d"
+  "/root/repo/src/optimization/util/Cone/Broadcast.cpp" "CMakeFiles/El.dir/src/optimization/util/Cone/Broadcast.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/Cone/Broadcast.cpp.o.d"
+  "/root/repo/src/optimization/util/Cone/GeomEquil.cpp" "CMakeFiles/El.dir/src/optimization/util/Cone/GeomEquil.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/Cone/GeomEquil.cpp.o.d"
+  "/root/repo/src/optimization/util/Cone/RuizEquil.cpp" "CMakeFiles/El.dir/src/optimization/util/Cone/RuizEquil.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/Cone/RuizEquil.cpp.o.d"
+  "/root/repo/src/optimization/util/Covariance.cpp" "CMakeFiles/El.dir/src/optimization/util/Covariance.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/Covariance.cpp.o.d"
+  "/root/repo/src/optimization/util/LogBarrier.cpp" "CMakeFiles/El.dir/src/optimization/util/LogBarrier.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/LogBarrier.cpp.o.d"
+  "/root/repo/src/optimization/util/LogDetDiv.cpp" "CMakeFiles/El.dir/src/optimization/util/LogDetDiv.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/LogDetDiv.cpp.o.d"
+  "/root/repo/src/optimization/util/PosOrth/ComplementRatio.cpp" "CMakeFiles/El.dir/src/optimization/util/PosOrth/ComplementRatio.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/PosOrth/ComplementRatio.cpp.o.d"
+  "/root/repo/src/optimization/util/PosOrth/MaxStep.cpp" "CMakeFiles/El.dir/src/optimization/util/PosOrth/MaxStep.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/PosOrth/MaxStep.cpp.o.d"
+  "/root/repo/src/optimization/util/PosOrth/NesterovTodd.cpp" "CMakeFiles/El.dir/src/optimization/util/PosOrth/NesterovTodd.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/PosOrth/NesterovTodd.cpp.o.d"
+  "/root/repo/src/optimization/util/PosOrth/NumOutside.cpp" "CMakeFiles/El.dir/src/optimization/util/PosOrth/NumOutside.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/PosOrth/NumOutside.cpp.o.d"
+  "/root/repo/src/optimization/util/PosOrth/PushPairInto.cpp" "CMakeFiles/El.dir/src/optimization/util/PosOrth/PushPairInto.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/PosOrth/PushPairInto.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/Apply.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/Apply.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/Apply.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/ApplyQuadratic.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/ApplyQuadratic.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/ApplyQuadratic.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/Degree.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/Degree.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/Degree.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/Dets.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/Dets.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/Dets.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/Dots.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/Dots.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/Dots.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/EmbeddingMaps.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/EmbeddingMaps.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/EmbeddingMaps.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/Identity.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/Identity.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/Identity.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/Inverse.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/Inverse.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/Inverse.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/LowerNorms.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/LowerNorms.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/LowerNorms.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/MaxEig.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/MaxEig.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/MaxEig.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/MaxStep.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/MaxStep.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/MaxStep.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/MinEig.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/MinEig.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/MinEig.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/NesterovTodd.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/NesterovTodd.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/NesterovTodd.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/NumOutside.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/NumOutside.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/NumOutside.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/PushInto.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/PushInto.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/PushInto.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/PushPairInto.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/PushPairInto.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/PushPairInto.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/Reflect.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/Reflect.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/Reflect.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/Shift.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/Shift.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/Shift.cpp.o.d"
+  "/root/repo/src/optimization/util/SOC/SquareRoot.cpp" "CMakeFiles/El.dir/src/optimization/util/SOC/SquareRoot.cpp.o" "gcc" "CMakeFiles/El.dir/src/optimization/util/SOC/SquareRoot.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build/libEl.so" "/root/repo/_gate_build/libEl.so.88-dev"
+  "/root/repo/_gate_build/libEl.so.0" "/root/repo/_gate_build/libEl.so.88-dev"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/external/pmrrr/CMakeFiles/pmrrr.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,955 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/El.dir/src/blas_like/algorithms.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/algorithms.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/batch-C.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/batch-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/blocksizes.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/blocksizes.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1-C.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/ColumnMinAbs.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/ColumnMinAbs.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/ColumnNorms.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/ColumnNorms.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/Copy.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/Copy.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/EntrywiseReductions.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/EntrywiseReductions.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/GetSubgraph.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/GetSubgraph.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/HilbertSchmidt.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/HilbertSchmidt.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/Instantiate.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/Instantiate.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/Max.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/Max.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/MaxAbs.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/MaxAbs.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/MaxAbsLoc.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/MaxAbsLoc.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/MaxLoc.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/MaxLoc.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/Min.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/Min.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/MinAbsLoc.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/MinAbsLoc.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/MinLoc.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/MinLoc.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/RowMinAbs.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/RowMinAbs.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/RowNorms.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/RowNorms.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/Swap.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/Swap.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/Symmetric2x2Inv.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/Symmetric2x2Inv.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level1/Transform2x2.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level1/Transform2x2.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2-C.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/ApplyGivensSequence.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/ApplyGivensSequence.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/BandedGemv.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/BandedGemv.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Gemv.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Gemv.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Ger.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Ger.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Geru.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Geru.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Hemv.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Hemv.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Her.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Her.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Her2.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Her2.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/QuasiTrsv.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/QuasiTrsv.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Symv.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Symv.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Syr.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Syr.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Syr2.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Syr2.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Trmv.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Trmv.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Trr.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Trr.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Trr2.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Trr2.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level2/Trsv.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level2/Trsv.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3-C.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/BandedGemm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/BandedGemm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Gemm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Gemm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Hemm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Hemm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Her2k.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Her2k.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Herk.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Herk.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/HermitianFromEVD.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/HermitianFromEVD.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/MultiShiftQuasiTrsm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/MultiShiftQuasiTrsm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/MultiShiftTrsm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/MultiShiftTrsm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Multiply.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Multiply.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/NormalFromEVD.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/NormalFromEVD.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/QuasiTrsm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/QuasiTrsm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/RFP.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/RFP.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/SafeMultiShiftTrsm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/SafeMultiShiftTrsm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Symm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Symm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Syr2k.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Syr2k.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Syrk.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Syrk.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trdtrmm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trdtrmm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trmm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trmm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trr2k.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trr2k.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trrk.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trrk.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/TrrkMulti.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/TrrkMulti.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trsm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trsm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trstrm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trstrm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trtrmm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/Trtrmm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/TwoSidedTrmm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/TwoSidedTrmm.cpp.o.d"
+  "CMakeFiles/El.dir/src/blas_like/level3/TwoSidedTrsm.cpp.o"
+  "CMakeFiles/El.dir/src/blas_like/level3/TwoSidedTrsm.cpp.o.d"
+  "CMakeFiles/El.dir/src/control-C.cpp.o"
+  "CMakeFiles/El.dir/src/control-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/control/Kronecker.cpp.o"
+  "CMakeFiles/El.dir/src/control/Kronecker.cpp.o.d"
+  "CMakeFiles/El.dir/src/control/Lyapunov.cpp.o"
+  "CMakeFiles/El.dir/src/control/Lyapunov.cpp.o.d"
+  "CMakeFiles/El.dir/src/control/Riccati.cpp.o"
+  "CMakeFiles/El.dir/src/control/Riccati.cpp.o.d"
+  "CMakeFiles/El.dir/src/control/Sylvester.cpp.o"
+  "CMakeFiles/El.dir/src/control/Sylvester.cpp.o.d"
+  "CMakeFiles/El.dir/src/control/TriangularSylvester.cpp.o"
+  "CMakeFiles/El.dir/src/control/TriangularSylvester.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Compress.cpp.o"
+  "CMakeFiles/El.dir/src/core/Compress.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/CpuFeatures.cpp.o"
+  "CMakeFiles/El.dir/src/core/CpuFeatures.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistGraph-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistGraph-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistGraph.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistGraph.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMap.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMap.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Abstract.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Abstract.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/CIRC_CIRC.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/CIRC_CIRC.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/MC_MR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/MC_MR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/MC_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/MC_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/MD_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/MD_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/MR_MC.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/MR_MC.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/MR_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/MR_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MC.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MC.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MD.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MD.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_MR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_VC.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_VC.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_VR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/STAR_VR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/VC_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/VC_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/VR_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Block/VR_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/CIRC_CIRC.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/CIRC_CIRC.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/MC_MR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/MC_MR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/MC_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/MC_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/MD_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/MD_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/MR_MC.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/MR_MC.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/MR_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/MR_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MC.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MC.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MD.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MD.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_MR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_VC.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_VC.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_VR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/STAR_VR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/VC_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/VC_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/VR_STAR.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMatrix/Element/VR_STAR.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistMultiVec-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistMultiVec-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/DistSparseMatrix-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/DistSparseMatrix-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Element-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/Element-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Element.cpp.o"
+  "CMakeFiles/El.dir/src/core/Element.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/FlamePart/Merge-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/FlamePart/Merge-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/FlamePart/Merge.cpp.o"
+  "CMakeFiles/El.dir/src/core/FlamePart/Merge.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/FlamePart/Partition-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/FlamePart/Partition-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/FlamePart/Partition.cpp.o"
+  "CMakeFiles/El.dir/src/core/FlamePart/Partition.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/FlamePart/Repartition-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/FlamePart/Repartition-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/FlamePart/Repartition.cpp.o"
+  "CMakeFiles/El.dir/src/core/FlamePart/Repartition.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/FlamePart/SlidePartition-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/FlamePart/SlidePartition-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/FlamePart/SlidePartition.cpp.o"
+  "CMakeFiles/El.dir/src/core/FlamePart/SlidePartition.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Graph-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/Graph-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Graph.cpp.o"
+  "CMakeFiles/El.dir/src/core/Graph.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Grid-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/Grid-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Grid.cpp.o"
+  "CMakeFiles/El.dir/src/core/Grid.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Instantiate.cpp.o"
+  "CMakeFiles/El.dir/src/core/Instantiate.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Matrix-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/Matrix-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Memory.cpp.o"
+  "CMakeFiles/El.dir/src/core/Memory.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Proxy.cpp.o"
+  "CMakeFiles/El.dir/src/core/Proxy.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/ReproducibleSum.cpp.o"
+  "CMakeFiles/El.dir/src/core/ReproducibleSum.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Serialize.cpp.o"
+  "CMakeFiles/El.dir/src/core/Serialize.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/SparseMatrix-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/SparseMatrix-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/Timer.cpp.o"
+  "CMakeFiles/El.dir/src/core/Timer.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/View-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/View-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/callStack.cpp.o"
+  "CMakeFiles/El.dir/src/core/callStack.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/environment.cpp.o"
+  "CMakeFiles/El.dir/src/core/environment.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/global-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/global-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/global.c.o"
+  "CMakeFiles/El.dir/src/core/global.c.o.d"
+  "CMakeFiles/El.dir/src/core/imports/blas.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/blas.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/cublas.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/cublas.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/flame.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/flame.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/lapack.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/lapack.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/mkl.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/mkl.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/mpfr.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/mpfr.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/mpfr/BigFloat.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/mpfr/BigFloat.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/mpfr/BigInt.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/mpfr/BigInt.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/mpi-C.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/mpi-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/mpi.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/mpi.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/openblas.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/openblas.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/pmrrr.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/pmrrr.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/qd.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/qd.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/qt5.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/qt5.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/scalapack.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/scalapack.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/scalapack/blacs.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/scalapack/blacs.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/imports/scalapack/pblas.cpp.o"
+  "CMakeFiles/El.dir/src/core/imports/scalapack/pblas.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/indent.cpp.o"
+  "CMakeFiles/El.dir/src/core/indent.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/logging.cpp.o"
+  "CMakeFiles/El.dir/src/core/logging.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/mpi_register.cpp.o"
+  "CMakeFiles/El.dir/src/core/mpi_register.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/random.cpp.o"
+  "CMakeFiles/El.dir/src/core/random.cpp.o.d"
+  "CMakeFiles/El.dir/src/core/types.cpp.o"
+  "CMakeFiles/El.dir/src/core/types.cpp.o.d"
+  "CMakeFiles/El.dir/src/io-C.cpp.o"
+  "CMakeFiles/El.dir/src/io-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/io.cpp.o"
+  "CMakeFiles/El.dir/src/io.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/Checkpoint.cpp.o"
+  "CMakeFiles/El.dir/src/io/Checkpoint.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/ColorMap.cpp.o"
+  "CMakeFiles/El.dir/src/io/ColorMap.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/ComplexDisplayWindow.cpp.o"
+  "CMakeFiles/El.dir/src/io/ComplexDisplayWindow.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/Display.cpp.o"
+  "CMakeFiles/El.dir/src/io/Display.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/DisplayWidget.cpp.o"
+  "CMakeFiles/El.dir/src/io/DisplayWidget.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/DisplayWindow.cpp.o"
+  "CMakeFiles/El.dir/src/io/DisplayWindow.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/Downsample.cpp.o"
+  "CMakeFiles/El.dir/src/io/Downsample.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/File.cpp.o"
+  "CMakeFiles/El.dir/src/io/File.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/Print.cpp.o"
+  "CMakeFiles/El.dir/src/io/Print.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/Read.cpp.o"
+  "CMakeFiles/El.dir/src/io/Read.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/Spy.cpp.o"
+  "CMakeFiles/El.dir/src/io/Spy.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/SpyWidget.cpp.o"
+  "CMakeFiles/El.dir/src/io/SpyWidget.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/SpyWindow.cpp.o"
+  "CMakeFiles/El.dir/src/io/SpyWindow.cpp.o.d"
+  "CMakeFiles/El.dir/src/io/Write.cpp.o"
+  "CMakeFiles/El.dir/src/io/Write.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/condense-C.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/condense-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/condense/Bidiag.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/condense/Bidiag.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/condense/HermitianTridiag.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/condense/HermitianTridiag.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/condense/Hessenberg.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/condense/Hessenberg.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/equilibrate/GeomEquil.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/equilibrate/GeomEquil.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/equilibrate/RuizEquil.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/equilibrate/RuizEquil.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricDiagonalEquil.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricDiagonalEquil.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricGeomEquil.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricGeomEquil.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricRuizEquil.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/equilibrate/SymmetricRuizEquil.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min-C.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min/GLM.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min/GLM.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min/LSE.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min/LSE.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min/LeastSquares.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min/LeastSquares.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min/Ridge.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min/Ridge.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min/Tikhonov.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/euclidean_min/Tikhonov.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor-C.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/Cholesky.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/Cholesky.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/CholeskyRFP.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/CholeskyRFP.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/GQR.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/GQR.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/GRQ.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/GRQ.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/ID.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/ID.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/ChangeFrontType.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/ChangeFrontType.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/CompressFronts.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/CompressFronts.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/Determinant.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/Determinant.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DiagonalScale.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DiagonalScale.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DiagonalSolve.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DiagonalSolve.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistFront.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistFront.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistMatrixNode.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistMatrixNode.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistMultiVecNode.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistMultiVecNode.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistSparseLDLFactorization.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/DistSparseLDLFactorization.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/Front.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/Front.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/FrontType.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/FrontType.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/InverseDiagonal.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/InverseDiagonal.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/MatrixNode.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/MatrixNode.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/ModifyFactorization.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/ModifyFactorization.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/SparseLDLFactorization.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/SparseLDLFactorization.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/SpillFronts.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/numeric/SpillFronts.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/Analysis.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/Analysis.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NaturalNestedDissection.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NaturalNestedDissection.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NestedDissection.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NestedDissection.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NodeInfo.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/NodeInfo.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/Separator.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LDL/sparse/symbolic/Separator.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LQ.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LQ.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LU.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/LU.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/Monitor.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/Monitor.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/QR.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/QR.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/RQ.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/RQ.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/RegularizedLDL/SolveAfter.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/RegularizedLDL/SolveAfter.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/factor/Skeleton.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/factor/Skeleton.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs-C.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Exponential.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Exponential.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/HermitianFunction.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/HermitianFunction.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/General.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/General.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/HPD.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/HPD.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Hermitian.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Hermitian.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Symmetric.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Symmetric.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Triangular.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Inverse/Triangular.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Pseudoinverse.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Pseudoinverse.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/RandomizedPseudoinverse.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/RandomizedPseudoinverse.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Sign.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/Sign.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/SquareRoot.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/funcs/SquareRoot.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/perm-C.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/perm-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/perm/DistPermutation.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/perm/DistPermutation.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/perm/Permutation.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/perm/Permutation.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/perm/PermutationMeta.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/perm/PermutationMeta.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/perm/PivotsToPartialPermutation.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/perm/PivotsToPartialPermutation.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props-C.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition/Frobenius.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition/Frobenius.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition/Infinity.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition/Infinity.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition/Max.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition/Max.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition/One.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition/One.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition/Two.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Condition/Two.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Determinant.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Determinant.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Inertia.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Inertia.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Entrywise.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Entrywise.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Frobenius.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Frobenius.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Infinity.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Infinity.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/KyFan.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/KyFan.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/KyFanSchatten.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/KyFanSchatten.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Max.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Max.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Nuclear.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Nuclear.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/One.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/One.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/OneEstimate.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/OneEstimate.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Schatten.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Schatten.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Two.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Two.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/TwoEstimate.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/TwoEstimate.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Zero.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Norm/Zero.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/Trace.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/Trace.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/props/TraceEstimate.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/props/TraceEstimate.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/reflect-C.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/reflect-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/reflect/ApplyPacked.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/reflect/ApplyPacked.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/reflect/ExpandPacked.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/reflect/ExpandPacked.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/reflect/Householder.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/reflect/Householder.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/reflect/Hyperbolic.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/reflect/Hyperbolic.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve-C.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Banded.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Banded.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/HPD.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/HPD.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Hermitian.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Hermitian.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Linear.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Linear.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/MixedPrecision.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/MixedPrecision.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/MultiShiftHess.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/MultiShiftHess.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Multicolor.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Multicolor.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/SPAI.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/SPAI.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/SQSD.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/SQSD.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Speculative.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Speculative.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Symmetric.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Symmetric.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Toeplitz.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/Toeplitz.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/solve/TwoLevelAggregation.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/solve/TwoLevelAggregation.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral-C.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/BidiagSVD.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/BidiagSVD.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/CubicSecular.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/CubicSecular.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/Eig.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/Eig.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/ExtremalSingValEst.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/ExtremalSingValEst.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/FilteredSubspace.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/FilteredSubspace.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianEig.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianEig.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianGenDefEig.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianGenDefEig.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianSVD.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianSVD.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianTridiagEig.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/HermitianTridiagEig.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/HessenbergSchur.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/HessenbergSchur.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/ImageAndKernel.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/ImageAndKernel.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/IncrementalSVD.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/IncrementalSVD.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/Lanczos.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/Lanczos.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/Polar.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/Polar.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/ProductLanczos.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/ProductLanczos.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/Pseudospectra.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/Pseudospectra.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/SVD.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/SVD.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/Schur.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/Schur.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/SecularEVD.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/SecularEVD.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/SecularSVD.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/SecularSVD.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/SkewHermitianEig.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/SkewHermitianEig.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/TriangEig.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/spectral/TriangEig.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/util-C.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/util-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/util/Bisect.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/util/Bisect.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/util/Median.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/util/Median.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/util/NaturalBisect.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/util/NaturalBisect.cpp.o.d"
+  "CMakeFiles/El.dir/src/lapack_like/util/Sort.cpp.o"
+  "CMakeFiles/El.dir/src/lapack_like/util/Sort.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices-C.cpp.o"
+  "CMakeFiles/El.dir/src/matrices-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Cauchy.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Cauchy.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/CauchyLike.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/CauchyLike.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Diagonal.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Diagonal.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Egorov.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Egorov.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Fiedler.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Fiedler.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Fourier.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Fourier.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/GCDMatrix.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/GCDMatrix.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Hankel.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Hankel.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Hilbert.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Hilbert.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Identity.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Identity.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Jordan.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Jordan.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/MatrixFreeOperator.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/MatrixFreeOperator.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Ones.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Ones.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Toeplitz.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Toeplitz.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Walsh.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Walsh.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Zeros.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/classical/Zeros.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/integral/FoxLi.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/integral/FoxLi.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Demmel.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Demmel.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/DruinskyToledo.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/DruinskyToledo.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/DynamicRegCounter.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/DynamicRegCounter.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Ehrenfest.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Ehrenfest.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/ExtendedKahan.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/ExtendedKahan.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/GEPPGrowth.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/GEPPGrowth.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/GKS.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/GKS.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Gear.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Gear.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Hanowa.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Hanowa.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/JordanCholesky.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/JordanCholesky.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/KMS.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/KMS.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Kahan.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Kahan.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lauchli.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lauchli.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Legendre.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Legendre.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lehmer.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lehmer.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lotkin.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Lotkin.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/MinIJ.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/MinIJ.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Parter.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Parter.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Pei.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Pei.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Redheffer.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Redheffer.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Riffle.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Riffle.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Ris.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Ris.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Wilkinson.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/misc/Wilkinson.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/pde/Helmholtz.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/pde/Helmholtz.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/pde/HelmholtzPML.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/pde/HelmholtzPML.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/pde/Laplacian.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/pde/Laplacian.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/BullsHead.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/BullsHead.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Forsythe.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Forsythe.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Grcar.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Grcar.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/OneTwoOne.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/OneTwoOne.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/TrefethenEmbree.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/TrefethenEmbree.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/TriW.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/TriW.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Triangle.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Triangle.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Whale.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/deterministic/sparse_toeplitz/Whale.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/independent/Bernoulli.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/independent/Bernoulli.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/independent/Gaussian.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/independent/Gaussian.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/independent/Rademacher.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/independent/Rademacher.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/independent/ThreeValued.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/independent/ThreeValued.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/independent/Uniform.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/independent/Uniform.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/lattice/AjtaiTypeBasis.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/lattice/AjtaiTypeBasis.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/lattice/KnapsackTypeBasis.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/lattice/KnapsackTypeBasis.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/misc/Haar.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/misc/Haar.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/misc/HatanoNelson.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/misc/HatanoNelson.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/misc/HermitianUniformSpectrum.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/misc/HermitianUniformSpectrum.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/misc/NormalUniformSpectrum.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/misc/NormalUniformSpectrum.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/misc/UniformHelmholtzGreens.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/misc/UniformHelmholtzGreens.cpp.o.d"
+  "CMakeFiles/El.dir/src/matrices/random/misc/Wigner.cpp.o"
+  "CMakeFiles/El.dir/src/matrices/random/misc/Wigner.cpp.o.d"
+  "CMakeFiles/El.dir/src/number_theory/TrialDivSieve.cpp.o"
+  "CMakeFiles/El.dir/src/number_theory/TrialDivSieve.cpp.o.d"
+  "CMakeFiles/El.dir/src/number_theory/lattice-C.cpp.o"
+  "CMakeFiles/El.dir/src/number_theory/lattice-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/number_theory/lattice/AlgebraicRelationSearch.cpp.o"
+  "CMakeFiles/El.dir/src/number_theory/lattice/AlgebraicRelationSearch.cpp.o.d"
+  "CMakeFiles/El.dir/src/number_theory/lattice/Coordinates.cpp.o"
+  "CMakeFiles/El.dir/src/number_theory/lattice/Coordinates.cpp.o.d"
+  "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate.cpp.o"
+  "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate.cpp.o.d"
+  "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate/GNR.cpp.o"
+  "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate/GNR.cpp.o.d"
+  "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate/Phase.cpp.o"
+  "CMakeFiles/El.dir/src/number_theory/lattice/Enumerate/Phase.cpp.o.d"
+  "CMakeFiles/El.dir/src/number_theory/lattice/ImageAndKernel.cpp.o"
+  "CMakeFiles/El.dir/src/number_theory/lattice/ImageAndKernel.cpp.o.d"
+  "CMakeFiles/El.dir/src/number_theory/lattice/LogPotential.cpp.o"
+  "CMakeFiles/El.dir/src/number_theory/lattice/LogPotential.cpp.o.d"
+  "CMakeFiles/El.dir/src/number_theory/lattice/ZDependenceSearch.cpp.o"
+  "CMakeFiles/El.dir/src/number_theory/lattice/ZDependenceSearch.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models-C.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/BP.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/BP.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/BPDN.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/BPDN.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/CP.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/CP.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/DS.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/DS.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/EN.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/EN.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/LAV.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/LAV.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/LongOnlyPortfolio.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/LongOnlyPortfolio.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/NMF.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/NMF.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/NNLS.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/NNLS.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/RLS.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/RLS.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/RNNLS.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/RNNLS.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/RPCA.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/RPCA.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/SVM.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/SVM.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/SparseInvCov.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/SparseInvCov.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/models/TV.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/models/TV.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/prox-c.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/prox-c.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/prox/Clip.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/prox/Clip.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/prox/FrobeniusProx.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/prox/FrobeniusProx.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/prox/HingeLossProx.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/prox/HingeLossProx.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/prox/LogisticProx.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/prox/LogisticProx.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/prox/SVT.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/prox/SVT.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/prox/SoftThreshold.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/prox/SoftThreshold.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers-C.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/Mehrotra.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/Mehrotra.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/util/FullKKT.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/util/FullKKT.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/util/Initialize.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/affine/IPM/util/Initialize.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/ADMM.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/ADMM.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/Mehrotra.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/Mehrotra.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/AugmentedKKT.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/AugmentedKKT.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/FullKKT.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/FullKKT.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/Initialize.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/Initialize.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/NormalKKT.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/LP/direct/IPM/util/NormalKKT.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/Mehrotra.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/Mehrotra.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/util/FullKKT.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/util/FullKKT.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/util/Initialize.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/affine/IPM/util/Initialize.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/box/ADMM.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/box/ADMM.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/Mehrotra.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/Mehrotra.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/AugmentedKKT.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/AugmentedKKT.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/FullKKT.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/FullKKT.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/Initialize.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/QP/direct/IPM/util/Initialize.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/SOCP.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/SOCP.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/Mehrotra.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/Mehrotra.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/util/FullKKT.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/util/FullKKT.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/util/Initialize.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/SOCP/affine/IPM/util/Initialize.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/solvers/SOCP/direct/IPM/Mehrotra.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/solvers/SOCP/direct/IPM/Mehrotra.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util-C.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util-C.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/Coherence.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/Coherence.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/Cone/AllReduce.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/Cone/AllReduce.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/Cone/Broadcast.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/Cone/Broadcast.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/Cone/GeomEquil.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/Cone/GeomEquil.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/Cone/RuizEquil.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/Cone/RuizEquil.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/Covariance.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/Covariance.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/LogBarrier.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/LogBarrier.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/LogDetDiv.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/LogDetDiv.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/PosOrth/ComplementRatio.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/PosOrth/ComplementRatio.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/PosOrth/MaxStep.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/PosOrth/MaxStep.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/PosOrth/NesterovTodd.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/PosOrth/NesterovTodd.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/PosOrth/NumOutside.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/PosOrth/NumOutside.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/PosOrth/PushPairInto.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/PosOrth/PushPairInto.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Apply.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Apply.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/ApplyQuadratic.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/ApplyQuadratic.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Degree.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Degree.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Dets.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Dets.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Dots.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Dots.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/EmbeddingMaps.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/EmbeddingMaps.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Identity.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Identity.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Inverse.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Inverse.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/LowerNorms.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/LowerNorms.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/MaxEig.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/MaxEig.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/MaxStep.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/MaxStep.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/MinEig.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/MinEig.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/NesterovTodd.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/NesterovTodd.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/NumOutside.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/NumOutside.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/PushInto.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/PushInto.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/PushPairInto.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/PushPairInto.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Reflect.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Reflect.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Shift.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/Shift.cpp.o.d"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/SquareRoot.cpp.o"
+  "CMakeFiles/El.dir/src/optimization/util/SOC/SquareRoot.cpp.o.d"
+  "libEl.pdb"
+  "libEl.so"
+  "libEl.so.0"
+  "libEl.so.88-dev"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/El.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
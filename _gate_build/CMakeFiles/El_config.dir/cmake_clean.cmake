@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/El_config"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/El_config.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FortranCInterface.dir/call_mod.f90.o"
+  "CMakeFiles/FortranCInterface.dir/call_sub.f.o"
+  "CMakeFiles/FortranCInterface.dir/main.F.o"
+  "FortranCInterface"
+  "FortranCInterface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/FortranCInterface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1 @@
+set(FortranCInterface_EXE "/root/repo/_gate_build/CMakeFiles/FortranCInterface/VerifyCXX/CMakeFiles/FortranCInterface/FortranCInterface")
@@ -0,0 +1,4 @@
+const char* _QMmy_modulePmy_sub(void)
+{
+  return "INFO:symbol[_QMmy_modulePmy_sub]";
+}
@@ -0,0 +1,4 @@
+const char* _QMmymodulePmysub(void)
+{
+  return "INFO:symbol[_QMmymodulePmysub]";
+}
@@ -0,0 +1,4 @@
+const char* my_sub(void)
+{
+  return "INFO:symbol[my_sub]";
+}
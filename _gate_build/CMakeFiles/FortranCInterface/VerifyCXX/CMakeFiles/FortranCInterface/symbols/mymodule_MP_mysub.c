@@ -0,0 +1,4 @@
+const char* mymodule_MP_mysub(void)
+{
+  return "INFO:symbol[mymodule_MP_mysub]";
+}
@@ -0,0 +1,4 @@
+const char* MYSUB(void)
+{
+  return "INFO:symbol[MYSUB]";
+}
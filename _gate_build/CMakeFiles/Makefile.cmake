@@ -0,0 +1,235 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/.git/HEAD"
+  "/root/repo/.git/refs/heads/master"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeFortranCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/FortranCInterface/Output.cmake"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "/root/repo/cmake/CreateElVars.cmake"
+  "/root/repo/cmake/configure_files/ElVars.in"
+  "/root/repo/cmake/configure_files/ElementalConfig.cmake.in"
+  "/root/repo/cmake/configure_files/ElementalConfigVersion.cmake.in"
+  "/root/repo/cmake/configure_files/calibration.h.in"
+  "/root/repo/cmake/configure_files/config.h.in"
+  "/root/repo/cmake/configure_files/environment.py.in"
+  "/root/repo/cmake/detect/CXX.cmake"
+  "/root/repo/cmake/detect/Calibration.cmake"
+  "/root/repo/cmake/detect/Fortran.cmake"
+  "/root/repo/cmake/detect/MPI.cmake"
+  "/root/repo/cmake/detect/OpenMP.cmake"
+  "/root/repo/cmake/detect/Qt5.cmake"
+  "/root/repo/cmake/external_projects/ElMath.cmake"
+  "/root/repo/cmake/external_projects/ElMath/METIS.cmake"
+  "/root/repo/cmake/external_projects/ElMath/OpenBLAS.cmake"
+  "/root/repo/cmake/modules/ElCheckCSourceCompiles.cmake"
+  "/root/repo/cmake/modules/ElCheckFunctionExists.cmake"
+  "/root/repo/cmake/modules/ElLibraryName.cmake"
+  "/root/repo/cmake/modules/FindCXXFeatures.cmake"
+  "/root/repo/cmake/modules/FindGMP.cmake"
+  "/root/repo/cmake/modules/FindMETIS.cmake"
+  "/root/repo/cmake/modules/FindMPFR.cmake"
+  "/root/repo/cmake/modules/FindQD.cmake"
+  "/root/repo/cmake/modules/FindValgrind.cmake"
+  "/root/repo/cmake/modules/GetGitRevisionDescription.cmake"
+  "/root/repo/cmake/modules/GetGitRevisionDescription.cmake.in"
+  "/root/repo/cmake/modules/language_support_v2.cmake"
+  "/root/repo/external/pmrrr/CMakeLists.txt"
+  "/root/repo/external/suite_sparse/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFortranInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFortranFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBLAS.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLAPACK.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMPI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface.cmake"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Detect.cmake"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Input.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Macro.h.in"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/git-data/HEAD"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "CMakeFiles/git-data/head-ref"
+  "CMakeFiles/FortranCInterface/Input.cmake"
+  "include/El/FCMangle.h"
+  "conf/ElVars"
+  "include/El/config.h"
+  "include/El/calibration.h"
+  "python/core/environment.py"
+  "DartConfiguration.tcl"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "ElementalConfig.cmake"
+  "ElementalConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/pmrrr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "external/suite_sparse/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/El_config.dir/DependInfo.cmake"
+  "CMakeFiles/El.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/sandbox-test.dir/DependInfo.cmake"
+  "CMakeFiles/tests-core-BasicBlockDistMatrix.dir/DependInfo.cmake"
+  "CMakeFiles/tests-core-Constants.dir/DependInfo.cmake"
+  "CMakeFiles/tests-core-DifferentGrids.dir/DependInfo.cmake"
+  "CMakeFiles/tests-core-DistMatrix.dir/DependInfo.cmake"
+  "CMakeFiles/tests-core-Matrix.dir/DependInfo.cmake"
+  "CMakeFiles/tests-core-Pow.dir/DependInfo.cmake"
+  "CMakeFiles/tests-core-QDToInt.dir/DependInfo.cmake"
+  "CMakeFiles/tests-core-SafeDiv.dir/DependInfo.cmake"
+  "CMakeFiles/tests-core-Version.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Axpy.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-BasicGemm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-ColumnNorms.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Dot.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-EntrywiseMap.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Gemm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Hadamard.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-MaxAbs.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-MultiShiftQuasiTrsm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-MultiShiftTrsm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Multiply.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-QuasiTrsm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-SafeMultiShiftTrsm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Symm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Symv.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Syr2k.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Syrk.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Trmm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Trsm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-Trsv.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-TwoSidedTrmm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-blas_like-TwoSidedTrsm.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-ApplyPackedReflectors.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-Bidiag.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-BidiagDCSVD.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-Bisection.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-Cholesky.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-CholeskyMod.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-CholeskyQR.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-Eig.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-HermitianEig.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-HermitianGenDefEig.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-HermitianTridiag.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-HermitianTridiagEig.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-Hessenberg.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-HessenbergSchur.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-LDL.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-LQ.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-LU.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-LUMod.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-LeastSquares.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-MultiShiftHessSolve.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-NestedDissection.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-QR.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-RQ.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-SVD.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-SVDTwoByTwoUpper.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-Schur.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-SchurSwap.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-SecularEVD.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-SecularSVD.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-SparseLDL.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-SparseLDLRange.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-SparseLDLRefactor.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-SparseSymmetricSolve.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-TSQR.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-TSSVD.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-TriangEig.dir/DependInfo.cmake"
+  "CMakeFiles/tests-lapack_like-TriangularInverse.dir/DependInfo.cmake"
+  "CMakeFiles/tests-optimization-TSSVT.dir/DependInfo.cmake"
+  "external/pmrrr/CMakeFiles/pmrrr.dir/DependInfo.cmake"
+  "external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/sandbox/test.cpp" "CMakeFiles/sandbox-test.dir/sandbox/test.cpp.o" "gcc" "CMakeFiles/sandbox-test.dir/sandbox/test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/CMakeFiles/El.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/external/pmrrr/CMakeFiles/pmrrr.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/external/suite_sparse/CMakeFiles/ElSuiteSparse.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Axpy.dir/tests/blas_like/Axpy.cpp.o"
+  "CMakeFiles/tests-blas_like-Axpy.dir/tests/blas_like/Axpy.cpp.o.d"
+  "bin/tests/blas_like/Axpy"
+  "bin/tests/blas_like/Axpy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Axpy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
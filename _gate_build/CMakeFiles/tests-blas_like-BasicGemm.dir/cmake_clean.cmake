@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-BasicGemm.dir/tests/blas_like/BasicGemm.cpp.o"
+  "CMakeFiles/tests-blas_like-BasicGemm.dir/tests/blas_like/BasicGemm.cpp.o.d"
+  "bin/tests/blas_like/BasicGemm"
+  "bin/tests/blas_like/BasicGemm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-BasicGemm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-ColumnNorms.dir/tests/blas_like/ColumnNorms.cpp.o"
+  "CMakeFiles/tests-blas_like-ColumnNorms.dir/tests/blas_like/ColumnNorms.cpp.o.d"
+  "bin/tests/blas_like/ColumnNorms"
+  "bin/tests/blas_like/ColumnNorms.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-ColumnNorms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Dot.dir/tests/blas_like/Dot.cpp.o"
+  "CMakeFiles/tests-blas_like-Dot.dir/tests/blas_like/Dot.cpp.o.d"
+  "bin/tests/blas_like/Dot"
+  "bin/tests/blas_like/Dot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Dot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
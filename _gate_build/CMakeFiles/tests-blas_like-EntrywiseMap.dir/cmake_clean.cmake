@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-EntrywiseMap.dir/tests/blas_like/EntrywiseMap.cpp.o"
+  "CMakeFiles/tests-blas_like-EntrywiseMap.dir/tests/blas_like/EntrywiseMap.cpp.o.d"
+  "bin/tests/blas_like/EntrywiseMap"
+  "bin/tests/blas_like/EntrywiseMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-EntrywiseMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
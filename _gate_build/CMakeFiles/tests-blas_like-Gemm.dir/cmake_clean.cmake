@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Gemm.dir/tests/blas_like/Gemm.cpp.o"
+  "CMakeFiles/tests-blas_like-Gemm.dir/tests/blas_like/Gemm.cpp.o.d"
+  "bin/tests/blas_like/Gemm"
+  "bin/tests/blas_like/Gemm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Gemm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Hadamard.dir/tests/blas_like/Hadamard.cpp.o"
+  "CMakeFiles/tests-blas_like-Hadamard.dir/tests/blas_like/Hadamard.cpp.o.d"
+  "bin/tests/blas_like/Hadamard"
+  "bin/tests/blas_like/Hadamard.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Hadamard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
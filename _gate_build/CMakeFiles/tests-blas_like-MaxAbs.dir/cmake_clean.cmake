@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-MaxAbs.dir/tests/blas_like/MaxAbs.cpp.o"
+  "CMakeFiles/tests-blas_like-MaxAbs.dir/tests/blas_like/MaxAbs.cpp.o.d"
+  "bin/tests/blas_like/MaxAbs"
+  "bin/tests/blas_like/MaxAbs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-MaxAbs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
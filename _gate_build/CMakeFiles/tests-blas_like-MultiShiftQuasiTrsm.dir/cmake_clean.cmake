@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-MultiShiftQuasiTrsm.dir/tests/blas_like/MultiShiftQuasiTrsm.cpp.o"
+  "CMakeFiles/tests-blas_like-MultiShiftQuasiTrsm.dir/tests/blas_like/MultiShiftQuasiTrsm.cpp.o.d"
+  "bin/tests/blas_like/MultiShiftQuasiTrsm"
+  "bin/tests/blas_like/MultiShiftQuasiTrsm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-MultiShiftQuasiTrsm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
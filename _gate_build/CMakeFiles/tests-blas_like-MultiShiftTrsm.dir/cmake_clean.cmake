@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-MultiShiftTrsm.dir/tests/blas_like/MultiShiftTrsm.cpp.o"
+  "CMakeFiles/tests-blas_like-MultiShiftTrsm.dir/tests/blas_like/MultiShiftTrsm.cpp.o.d"
+  "bin/tests/blas_like/MultiShiftTrsm"
+  "bin/tests/blas_like/MultiShiftTrsm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-MultiShiftTrsm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
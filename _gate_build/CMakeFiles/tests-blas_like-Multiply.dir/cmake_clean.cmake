@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Multiply.dir/tests/blas_like/Multiply.cpp.o"
+  "CMakeFiles/tests-blas_like-Multiply.dir/tests/blas_like/Multiply.cpp.o.d"
+  "bin/tests/blas_like/Multiply"
+  "bin/tests/blas_like/Multiply.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Multiply.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-QuasiTrsm.dir/tests/blas_like/QuasiTrsm.cpp.o"
+  "CMakeFiles/tests-blas_like-QuasiTrsm.dir/tests/blas_like/QuasiTrsm.cpp.o.d"
+  "bin/tests/blas_like/QuasiTrsm"
+  "bin/tests/blas_like/QuasiTrsm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-QuasiTrsm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-SafeMultiShiftTrsm.dir/tests/blas_like/SafeMultiShiftTrsm.cpp.o"
+  "CMakeFiles/tests-blas_like-SafeMultiShiftTrsm.dir/tests/blas_like/SafeMultiShiftTrsm.cpp.o.d"
+  "bin/tests/blas_like/SafeMultiShiftTrsm"
+  "bin/tests/blas_like/SafeMultiShiftTrsm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-SafeMultiShiftTrsm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
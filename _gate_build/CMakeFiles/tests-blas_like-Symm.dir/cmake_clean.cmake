@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Symm.dir/tests/blas_like/Symm.cpp.o"
+  "CMakeFiles/tests-blas_like-Symm.dir/tests/blas_like/Symm.cpp.o.d"
+  "bin/tests/blas_like/Symm"
+  "bin/tests/blas_like/Symm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Symm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
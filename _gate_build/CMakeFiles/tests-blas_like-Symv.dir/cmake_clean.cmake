@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Symv.dir/tests/blas_like/Symv.cpp.o"
+  "CMakeFiles/tests-blas_like-Symv.dir/tests/blas_like/Symv.cpp.o.d"
+  "bin/tests/blas_like/Symv"
+  "bin/tests/blas_like/Symv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Symv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Syr2k.dir/tests/blas_like/Syr2k.cpp.o"
+  "CMakeFiles/tests-blas_like-Syr2k.dir/tests/blas_like/Syr2k.cpp.o.d"
+  "bin/tests/blas_like/Syr2k"
+  "bin/tests/blas_like/Syr2k.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Syr2k.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Syrk.dir/tests/blas_like/Syrk.cpp.o"
+  "CMakeFiles/tests-blas_like-Syrk.dir/tests/blas_like/Syrk.cpp.o.d"
+  "bin/tests/blas_like/Syrk"
+  "bin/tests/blas_like/Syrk.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Syrk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
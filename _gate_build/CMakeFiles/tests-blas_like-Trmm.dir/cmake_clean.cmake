@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Trmm.dir/tests/blas_like/Trmm.cpp.o"
+  "CMakeFiles/tests-blas_like-Trmm.dir/tests/blas_like/Trmm.cpp.o.d"
+  "bin/tests/blas_like/Trmm"
+  "bin/tests/blas_like/Trmm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Trmm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Trsm.dir/tests/blas_like/Trsm.cpp.o"
+  "CMakeFiles/tests-blas_like-Trsm.dir/tests/blas_like/Trsm.cpp.o.d"
+  "bin/tests/blas_like/Trsm"
+  "bin/tests/blas_like/Trsm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Trsm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-Trsv.dir/tests/blas_like/Trsv.cpp.o"
+  "CMakeFiles/tests-blas_like-Trsv.dir/tests/blas_like/Trsv.cpp.o.d"
+  "bin/tests/blas_like/Trsv"
+  "bin/tests/blas_like/Trsv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-Trsv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-TwoSidedTrmm.dir/tests/blas_like/TwoSidedTrmm.cpp.o"
+  "CMakeFiles/tests-blas_like-TwoSidedTrmm.dir/tests/blas_like/TwoSidedTrmm.cpp.o.d"
+  "bin/tests/blas_like/TwoSidedTrmm"
+  "bin/tests/blas_like/TwoSidedTrmm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-TwoSidedTrmm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
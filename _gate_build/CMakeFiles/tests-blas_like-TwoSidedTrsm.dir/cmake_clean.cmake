@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-blas_like-TwoSidedTrsm.dir/tests/blas_like/TwoSidedTrsm.cpp.o"
+  "CMakeFiles/tests-blas_like-TwoSidedTrsm.dir/tests/blas_like/TwoSidedTrsm.cpp.o.d"
+  "bin/tests/blas_like/TwoSidedTrsm"
+  "bin/tests/blas_like/TwoSidedTrsm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-blas_like-TwoSidedTrsm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-core-BasicBlockDistMatrix.dir/tests/core/BasicBlockDistMatrix.cpp.o"
+  "CMakeFiles/tests-core-BasicBlockDistMatrix.dir/tests/core/BasicBlockDistMatrix.cpp.o.d"
+  "bin/tests/core/BasicBlockDistMatrix"
+  "bin/tests/core/BasicBlockDistMatrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-core-BasicBlockDistMatrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-core-Constants.dir/tests/core/Constants.cpp.o"
+  "CMakeFiles/tests-core-Constants.dir/tests/core/Constants.cpp.o.d"
+  "bin/tests/core/Constants"
+  "bin/tests/core/Constants.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-core-Constants.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-core-DifferentGrids.dir/tests/core/DifferentGrids.cpp.o"
+  "CMakeFiles/tests-core-DifferentGrids.dir/tests/core/DifferentGrids.cpp.o.d"
+  "bin/tests/core/DifferentGrids"
+  "bin/tests/core/DifferentGrids.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-core-DifferentGrids.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-core-DistMatrix.dir/tests/core/DistMatrix.cpp.o"
+  "CMakeFiles/tests-core-DistMatrix.dir/tests/core/DistMatrix.cpp.o.d"
+  "bin/tests/core/DistMatrix"
+  "bin/tests/core/DistMatrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-core-DistMatrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-core-Matrix.dir/tests/core/Matrix.cpp.o"
+  "CMakeFiles/tests-core-Matrix.dir/tests/core/Matrix.cpp.o.d"
+  "bin/tests/core/Matrix"
+  "bin/tests/core/Matrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-core-Matrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-core-Pow.dir/tests/core/Pow.cpp.o"
+  "CMakeFiles/tests-core-Pow.dir/tests/core/Pow.cpp.o.d"
+  "bin/tests/core/Pow"
+  "bin/tests/core/Pow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-core-Pow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
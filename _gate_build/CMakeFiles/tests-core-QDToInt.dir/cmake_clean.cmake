@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-core-QDToInt.dir/tests/core/QDToInt.cpp.o"
+  "CMakeFiles/tests-core-QDToInt.dir/tests/core/QDToInt.cpp.o.d"
+  "bin/tests/core/QDToInt"
+  "bin/tests/core/QDToInt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-core-QDToInt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
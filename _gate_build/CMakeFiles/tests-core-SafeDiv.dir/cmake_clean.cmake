@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-core-SafeDiv.dir/tests/core/SafeDiv.cpp.o"
+  "CMakeFiles/tests-core-SafeDiv.dir/tests/core/SafeDiv.cpp.o.d"
+  "bin/tests/core/SafeDiv"
+  "bin/tests/core/SafeDiv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-core-SafeDiv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
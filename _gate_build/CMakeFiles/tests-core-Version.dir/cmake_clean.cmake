@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-core-Version.dir/tests/core/Version.cpp.o"
+  "CMakeFiles/tests-core-Version.dir/tests/core/Version.cpp.o.d"
+  "bin/tests/core/Version"
+  "bin/tests/core/Version.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-core-Version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
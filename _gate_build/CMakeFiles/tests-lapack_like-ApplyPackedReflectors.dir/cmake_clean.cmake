@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-ApplyPackedReflectors.dir/tests/lapack_like/ApplyPackedReflectors.cpp.o"
+  "CMakeFiles/tests-lapack_like-ApplyPackedReflectors.dir/tests/lapack_like/ApplyPackedReflectors.cpp.o.d"
+  "bin/tests/lapack_like/ApplyPackedReflectors"
+  "bin/tests/lapack_like/ApplyPackedReflectors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-ApplyPackedReflectors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-Bidiag.dir/tests/lapack_like/Bidiag.cpp.o"
+  "CMakeFiles/tests-lapack_like-Bidiag.dir/tests/lapack_like/Bidiag.cpp.o.d"
+  "bin/tests/lapack_like/Bidiag"
+  "bin/tests/lapack_like/Bidiag.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-Bidiag.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
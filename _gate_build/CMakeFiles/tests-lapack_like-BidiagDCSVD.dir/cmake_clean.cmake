@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-BidiagDCSVD.dir/tests/lapack_like/BidiagDCSVD.cpp.o"
+  "CMakeFiles/tests-lapack_like-BidiagDCSVD.dir/tests/lapack_like/BidiagDCSVD.cpp.o.d"
+  "bin/tests/lapack_like/BidiagDCSVD"
+  "bin/tests/lapack_like/BidiagDCSVD.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-BidiagDCSVD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-Bisection.dir/tests/lapack_like/Bisection.cpp.o"
+  "CMakeFiles/tests-lapack_like-Bisection.dir/tests/lapack_like/Bisection.cpp.o.d"
+  "bin/tests/lapack_like/Bisection"
+  "bin/tests/lapack_like/Bisection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-Bisection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
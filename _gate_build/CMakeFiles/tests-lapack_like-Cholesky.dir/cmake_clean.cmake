@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-Cholesky.dir/tests/lapack_like/Cholesky.cpp.o"
+  "CMakeFiles/tests-lapack_like-Cholesky.dir/tests/lapack_like/Cholesky.cpp.o.d"
+  "bin/tests/lapack_like/Cholesky"
+  "bin/tests/lapack_like/Cholesky.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-Cholesky.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-CholeskyMod.dir/tests/lapack_like/CholeskyMod.cpp.o"
+  "CMakeFiles/tests-lapack_like-CholeskyMod.dir/tests/lapack_like/CholeskyMod.cpp.o.d"
+  "bin/tests/lapack_like/CholeskyMod"
+  "bin/tests/lapack_like/CholeskyMod.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-CholeskyMod.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
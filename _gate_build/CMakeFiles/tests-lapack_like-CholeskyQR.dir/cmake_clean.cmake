@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-CholeskyQR.dir/tests/lapack_like/CholeskyQR.cpp.o"
+  "CMakeFiles/tests-lapack_like-CholeskyQR.dir/tests/lapack_like/CholeskyQR.cpp.o.d"
+  "bin/tests/lapack_like/CholeskyQR"
+  "bin/tests/lapack_like/CholeskyQR.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-CholeskyQR.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-Eig.dir/tests/lapack_like/Eig.cpp.o"
+  "CMakeFiles/tests-lapack_like-Eig.dir/tests/lapack_like/Eig.cpp.o.d"
+  "bin/tests/lapack_like/Eig"
+  "bin/tests/lapack_like/Eig.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-Eig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
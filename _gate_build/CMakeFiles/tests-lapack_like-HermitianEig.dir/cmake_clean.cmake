@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-HermitianEig.dir/tests/lapack_like/HermitianEig.cpp.o"
+  "CMakeFiles/tests-lapack_like-HermitianEig.dir/tests/lapack_like/HermitianEig.cpp.o.d"
+  "bin/tests/lapack_like/HermitianEig"
+  "bin/tests/lapack_like/HermitianEig.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-HermitianEig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-HermitianGenDefEig.dir/tests/lapack_like/HermitianGenDefEig.cpp.o"
+  "CMakeFiles/tests-lapack_like-HermitianGenDefEig.dir/tests/lapack_like/HermitianGenDefEig.cpp.o.d"
+  "bin/tests/lapack_like/HermitianGenDefEig"
+  "bin/tests/lapack_like/HermitianGenDefEig.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-HermitianGenDefEig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-HermitianTridiag.dir/tests/lapack_like/HermitianTridiag.cpp.o"
+  "CMakeFiles/tests-lapack_like-HermitianTridiag.dir/tests/lapack_like/HermitianTridiag.cpp.o.d"
+  "bin/tests/lapack_like/HermitianTridiag"
+  "bin/tests/lapack_like/HermitianTridiag.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-HermitianTridiag.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-HermitianTridiagEig.dir/tests/lapack_like/HermitianTridiagEig.cpp.o"
+  "CMakeFiles/tests-lapack_like-HermitianTridiagEig.dir/tests/lapack_like/HermitianTridiagEig.cpp.o.d"
+  "bin/tests/lapack_like/HermitianTridiagEig"
+  "bin/tests/lapack_like/HermitianTridiagEig.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-HermitianTridiagEig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-Hessenberg.dir/tests/lapack_like/Hessenberg.cpp.o"
+  "CMakeFiles/tests-lapack_like-Hessenberg.dir/tests/lapack_like/Hessenberg.cpp.o.d"
+  "bin/tests/lapack_like/Hessenberg"
+  "bin/tests/lapack_like/Hessenberg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-Hessenberg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
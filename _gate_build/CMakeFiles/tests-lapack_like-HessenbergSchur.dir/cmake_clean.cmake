@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-HessenbergSchur.dir/tests/lapack_like/HessenbergSchur.cpp.o"
+  "CMakeFiles/tests-lapack_like-HessenbergSchur.dir/tests/lapack_like/HessenbergSchur.cpp.o.d"
+  "bin/tests/lapack_like/HessenbergSchur"
+  "bin/tests/lapack_like/HessenbergSchur.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-HessenbergSchur.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
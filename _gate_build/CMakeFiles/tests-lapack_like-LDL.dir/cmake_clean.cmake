@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-LDL.dir/tests/lapack_like/LDL.cpp.o"
+  "CMakeFiles/tests-lapack_like-LDL.dir/tests/lapack_like/LDL.cpp.o.d"
+  "bin/tests/lapack_like/LDL"
+  "bin/tests/lapack_like/LDL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-LDL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-LQ.dir/tests/lapack_like/LQ.cpp.o"
+  "CMakeFiles/tests-lapack_like-LQ.dir/tests/lapack_like/LQ.cpp.o.d"
+  "bin/tests/lapack_like/LQ"
+  "bin/tests/lapack_like/LQ.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-LQ.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-LU.dir/tests/lapack_like/LU.cpp.o"
+  "CMakeFiles/tests-lapack_like-LU.dir/tests/lapack_like/LU.cpp.o.d"
+  "bin/tests/lapack_like/LU"
+  "bin/tests/lapack_like/LU.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-LU.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
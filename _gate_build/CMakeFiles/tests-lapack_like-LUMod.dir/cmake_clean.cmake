@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-LUMod.dir/tests/lapack_like/LUMod.cpp.o"
+  "CMakeFiles/tests-lapack_like-LUMod.dir/tests/lapack_like/LUMod.cpp.o.d"
+  "bin/tests/lapack_like/LUMod"
+  "bin/tests/lapack_like/LUMod.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-LUMod.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
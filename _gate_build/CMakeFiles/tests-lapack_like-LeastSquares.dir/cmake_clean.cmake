@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-LeastSquares.dir/tests/lapack_like/LeastSquares.cpp.o"
+  "CMakeFiles/tests-lapack_like-LeastSquares.dir/tests/lapack_like/LeastSquares.cpp.o.d"
+  "bin/tests/lapack_like/LeastSquares"
+  "bin/tests/lapack_like/LeastSquares.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-LeastSquares.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
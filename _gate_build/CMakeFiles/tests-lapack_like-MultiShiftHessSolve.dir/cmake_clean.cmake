@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-MultiShiftHessSolve.dir/tests/lapack_like/MultiShiftHessSolve.cpp.o"
+  "CMakeFiles/tests-lapack_like-MultiShiftHessSolve.dir/tests/lapack_like/MultiShiftHessSolve.cpp.o.d"
+  "bin/tests/lapack_like/MultiShiftHessSolve"
+  "bin/tests/lapack_like/MultiShiftHessSolve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-MultiShiftHessSolve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
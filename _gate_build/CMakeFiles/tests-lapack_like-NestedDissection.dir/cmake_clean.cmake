@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-NestedDissection.dir/tests/lapack_like/NestedDissection.cpp.o"
+  "CMakeFiles/tests-lapack_like-NestedDissection.dir/tests/lapack_like/NestedDissection.cpp.o.d"
+  "bin/tests/lapack_like/NestedDissection"
+  "bin/tests/lapack_like/NestedDissection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-NestedDissection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-QR.dir/tests/lapack_like/QR.cpp.o"
+  "CMakeFiles/tests-lapack_like-QR.dir/tests/lapack_like/QR.cpp.o.d"
+  "bin/tests/lapack_like/QR"
+  "bin/tests/lapack_like/QR.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-QR.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
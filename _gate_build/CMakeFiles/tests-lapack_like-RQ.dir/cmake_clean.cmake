@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-RQ.dir/tests/lapack_like/RQ.cpp.o"
+  "CMakeFiles/tests-lapack_like-RQ.dir/tests/lapack_like/RQ.cpp.o.d"
+  "bin/tests/lapack_like/RQ"
+  "bin/tests/lapack_like/RQ.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-RQ.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
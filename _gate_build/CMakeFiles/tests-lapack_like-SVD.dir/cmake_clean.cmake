@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-SVD.dir/tests/lapack_like/SVD.cpp.o"
+  "CMakeFiles/tests-lapack_like-SVD.dir/tests/lapack_like/SVD.cpp.o.d"
+  "bin/tests/lapack_like/SVD"
+  "bin/tests/lapack_like/SVD.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-SVD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-SVDTwoByTwoUpper.dir/tests/lapack_like/SVDTwoByTwoUpper.cpp.o"
+  "CMakeFiles/tests-lapack_like-SVDTwoByTwoUpper.dir/tests/lapack_like/SVDTwoByTwoUpper.cpp.o.d"
+  "bin/tests/lapack_like/SVDTwoByTwoUpper"
+  "bin/tests/lapack_like/SVDTwoByTwoUpper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-SVDTwoByTwoUpper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-Schur.dir/tests/lapack_like/Schur.cpp.o"
+  "CMakeFiles/tests-lapack_like-Schur.dir/tests/lapack_like/Schur.cpp.o.d"
+  "bin/tests/lapack_like/Schur"
+  "bin/tests/lapack_like/Schur.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-Schur.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
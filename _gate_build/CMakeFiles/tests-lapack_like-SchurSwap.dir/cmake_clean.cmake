@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-SchurSwap.dir/tests/lapack_like/SchurSwap.cpp.o"
+  "CMakeFiles/tests-lapack_like-SchurSwap.dir/tests/lapack_like/SchurSwap.cpp.o.d"
+  "bin/tests/lapack_like/SchurSwap"
+  "bin/tests/lapack_like/SchurSwap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-SchurSwap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-SecularEVD.dir/tests/lapack_like/SecularEVD.cpp.o"
+  "CMakeFiles/tests-lapack_like-SecularEVD.dir/tests/lapack_like/SecularEVD.cpp.o.d"
+  "bin/tests/lapack_like/SecularEVD"
+  "bin/tests/lapack_like/SecularEVD.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-SecularEVD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-SecularSVD.dir/tests/lapack_like/SecularSVD.cpp.o"
+  "CMakeFiles/tests-lapack_like-SecularSVD.dir/tests/lapack_like/SecularSVD.cpp.o.d"
+  "bin/tests/lapack_like/SecularSVD"
+  "bin/tests/lapack_like/SecularSVD.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-SecularSVD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
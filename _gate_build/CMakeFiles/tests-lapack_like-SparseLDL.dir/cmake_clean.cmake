@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-SparseLDL.dir/tests/lapack_like/SparseLDL.cpp.o"
+  "CMakeFiles/tests-lapack_like-SparseLDL.dir/tests/lapack_like/SparseLDL.cpp.o.d"
+  "bin/tests/lapack_like/SparseLDL"
+  "bin/tests/lapack_like/SparseLDL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-SparseLDL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
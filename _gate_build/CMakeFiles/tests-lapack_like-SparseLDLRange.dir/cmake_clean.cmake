@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-SparseLDLRange.dir/tests/lapack_like/SparseLDLRange.cpp.o"
+  "CMakeFiles/tests-lapack_like-SparseLDLRange.dir/tests/lapack_like/SparseLDLRange.cpp.o.d"
+  "bin/tests/lapack_like/SparseLDLRange"
+  "bin/tests/lapack_like/SparseLDLRange.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-SparseLDLRange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-SparseLDLRefactor.dir/tests/lapack_like/SparseLDLRefactor.cpp.o"
+  "CMakeFiles/tests-lapack_like-SparseLDLRefactor.dir/tests/lapack_like/SparseLDLRefactor.cpp.o.d"
+  "bin/tests/lapack_like/SparseLDLRefactor"
+  "bin/tests/lapack_like/SparseLDLRefactor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-SparseLDLRefactor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
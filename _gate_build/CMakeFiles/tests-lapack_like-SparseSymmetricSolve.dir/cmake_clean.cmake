@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-SparseSymmetricSolve.dir/tests/lapack_like/SparseSymmetricSolve.cpp.o"
+  "CMakeFiles/tests-lapack_like-SparseSymmetricSolve.dir/tests/lapack_like/SparseSymmetricSolve.cpp.o.d"
+  "bin/tests/lapack_like/SparseSymmetricSolve"
+  "bin/tests/lapack_like/SparseSymmetricSolve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-SparseSymmetricSolve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-TSQR.dir/tests/lapack_like/TSQR.cpp.o"
+  "CMakeFiles/tests-lapack_like-TSQR.dir/tests/lapack_like/TSQR.cpp.o.d"
+  "bin/tests/lapack_like/TSQR"
+  "bin/tests/lapack_like/TSQR.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-TSQR.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-TSSVD.dir/tests/lapack_like/TSSVD.cpp.o"
+  "CMakeFiles/tests-lapack_like-TSSVD.dir/tests/lapack_like/TSSVD.cpp.o.d"
+  "bin/tests/lapack_like/TSSVD"
+  "bin/tests/lapack_like/TSSVD.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-TSSVD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
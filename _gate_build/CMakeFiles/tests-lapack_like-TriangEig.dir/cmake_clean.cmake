@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-TriangEig.dir/tests/lapack_like/TriangEig.cpp.o"
+  "CMakeFiles/tests-lapack_like-TriangEig.dir/tests/lapack_like/TriangEig.cpp.o.d"
+  "bin/tests/lapack_like/TriangEig"
+  "bin/tests/lapack_like/TriangEig.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-TriangEig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
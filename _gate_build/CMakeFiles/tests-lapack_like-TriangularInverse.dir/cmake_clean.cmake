@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-lapack_like-TriangularInverse.dir/tests/lapack_like/TriangularInverse.cpp.o"
+  "CMakeFiles/tests-lapack_like-TriangularInverse.dir/tests/lapack_like/TriangularInverse.cpp.o.d"
+  "bin/tests/lapack_like/TriangularInverse"
+  "bin/tests/lapack_like/TriangularInverse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-lapack_like-TriangularInverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests-optimization-TSSVT.dir/tests/optimization/TSSVT.cpp.o"
+  "CMakeFiles/tests-optimization-TSSVT.dir/tests/optimization/TSSVT.cpp.o.d"
+  "bin/tests/optimization/TSSVT"
+  "bin/tests/optimization/TSSVT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests-optimization-TSSVT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,144 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Tests/core/BasicBlockDistMatrix "/root/repo/_gate_build/bin/tests/core/BasicBlockDistMatrix" "-platform" "offscreen")
+set_tests_properties(Tests/core/BasicBlockDistMatrix PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/core" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/core/Constants "/root/repo/_gate_build/bin/tests/core/Constants" "-platform" "offscreen")
+set_tests_properties(Tests/core/Constants PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/core" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/core/DifferentGrids "/root/repo/_gate_build/bin/tests/core/DifferentGrids" "-platform" "offscreen")
+set_tests_properties(Tests/core/DifferentGrids PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/core" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/core/DistMatrix "/root/repo/_gate_build/bin/tests/core/DistMatrix" "-platform" "offscreen")
+set_tests_properties(Tests/core/DistMatrix PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/core" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/core/Matrix "/root/repo/_gate_build/bin/tests/core/Matrix" "-platform" "offscreen")
+set_tests_properties(Tests/core/Matrix PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/core" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/core/Pow "/root/repo/_gate_build/bin/tests/core/Pow" "-platform" "offscreen")
+set_tests_properties(Tests/core/Pow PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/core" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/core/QDToInt "/root/repo/_gate_build/bin/tests/core/QDToInt" "-platform" "offscreen")
+set_tests_properties(Tests/core/QDToInt PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/core" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/core/SafeDiv "/root/repo/_gate_build/bin/tests/core/SafeDiv" "-platform" "offscreen")
+set_tests_properties(Tests/core/SafeDiv PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/core" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/core/Version "/root/repo/_gate_build/bin/tests/core/Version" "-platform" "offscreen")
+set_tests_properties(Tests/core/Version PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/core" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Axpy "/root/repo/_gate_build/bin/tests/blas_like/Axpy" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Axpy PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/BasicGemm "/root/repo/_gate_build/bin/tests/blas_like/BasicGemm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/BasicGemm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/ColumnNorms "/root/repo/_gate_build/bin/tests/blas_like/ColumnNorms" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/ColumnNorms PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Dot "/root/repo/_gate_build/bin/tests/blas_like/Dot" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Dot PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/EntrywiseMap "/root/repo/_gate_build/bin/tests/blas_like/EntrywiseMap" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/EntrywiseMap PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Gemm "/root/repo/_gate_build/bin/tests/blas_like/Gemm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Gemm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Hadamard "/root/repo/_gate_build/bin/tests/blas_like/Hadamard" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Hadamard PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/MaxAbs "/root/repo/_gate_build/bin/tests/blas_like/MaxAbs" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/MaxAbs PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/MultiShiftQuasiTrsm "/root/repo/_gate_build/bin/tests/blas_like/MultiShiftQuasiTrsm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/MultiShiftQuasiTrsm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/MultiShiftTrsm "/root/repo/_gate_build/bin/tests/blas_like/MultiShiftTrsm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/MultiShiftTrsm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Multiply "/root/repo/_gate_build/bin/tests/blas_like/Multiply" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Multiply PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/QuasiTrsm "/root/repo/_gate_build/bin/tests/blas_like/QuasiTrsm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/QuasiTrsm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/SafeMultiShiftTrsm "/root/repo/_gate_build/bin/tests/blas_like/SafeMultiShiftTrsm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/SafeMultiShiftTrsm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Symm "/root/repo/_gate_build/bin/tests/blas_like/Symm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Symm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Symv "/root/repo/_gate_build/bin/tests/blas_like/Symv" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Symv PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Syr2k "/root/repo/_gate_build/bin/tests/blas_like/Syr2k" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Syr2k PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Syrk "/root/repo/_gate_build/bin/tests/blas_like/Syrk" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Syrk PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Trmm "/root/repo/_gate_build/bin/tests/blas_like/Trmm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Trmm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Trsm "/root/repo/_gate_build/bin/tests/blas_like/Trsm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Trsm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/Trsv "/root/repo/_gate_build/bin/tests/blas_like/Trsv" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/Trsv PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/TwoSidedTrmm "/root/repo/_gate_build/bin/tests/blas_like/TwoSidedTrmm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/TwoSidedTrmm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/blas_like/TwoSidedTrsm "/root/repo/_gate_build/bin/tests/blas_like/TwoSidedTrsm" "-platform" "offscreen")
+set_tests_properties(Tests/blas_like/TwoSidedTrsm PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/blas_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/ApplyPackedReflectors "/root/repo/_gate_build/bin/tests/lapack_like/ApplyPackedReflectors" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/ApplyPackedReflectors PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/Bidiag "/root/repo/_gate_build/bin/tests/lapack_like/Bidiag" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/Bidiag PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/BidiagDCSVD "/root/repo/_gate_build/bin/tests/lapack_like/BidiagDCSVD" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/BidiagDCSVD PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/Bisection "/root/repo/_gate_build/bin/tests/lapack_like/Bisection" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/Bisection PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/Cholesky "/root/repo/_gate_build/bin/tests/lapack_like/Cholesky" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/Cholesky PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/CholeskyMod "/root/repo/_gate_build/bin/tests/lapack_like/CholeskyMod" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/CholeskyMod PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/CholeskyQR "/root/repo/_gate_build/bin/tests/lapack_like/CholeskyQR" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/CholeskyQR PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/Eig "/root/repo/_gate_build/bin/tests/lapack_like/Eig" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/Eig PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/HermitianEig "/root/repo/_gate_build/bin/tests/lapack_like/HermitianEig" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/HermitianEig PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/HermitianGenDefEig "/root/repo/_gate_build/bin/tests/lapack_like/HermitianGenDefEig" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/HermitianGenDefEig PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/HermitianTridiag "/root/repo/_gate_build/bin/tests/lapack_like/HermitianTridiag" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/HermitianTridiag PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/HermitianTridiagEig "/root/repo/_gate_build/bin/tests/lapack_like/HermitianTridiagEig" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/HermitianTridiagEig PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/Hessenberg "/root/repo/_gate_build/bin/tests/lapack_like/Hessenberg" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/Hessenberg PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/HessenbergSchur "/root/repo/_gate_build/bin/tests/lapack_like/HessenbergSchur" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/HessenbergSchur PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/LDL "/root/repo/_gate_build/bin/tests/lapack_like/LDL" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/LDL PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/LQ "/root/repo/_gate_build/bin/tests/lapack_like/LQ" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/LQ PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/LU "/root/repo/_gate_build/bin/tests/lapack_like/LU" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/LU PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/LUMod "/root/repo/_gate_build/bin/tests/lapack_like/LUMod" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/LUMod PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/LeastSquares "/root/repo/_gate_build/bin/tests/lapack_like/LeastSquares" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/LeastSquares PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/MultiShiftHessSolve "/root/repo/_gate_build/bin/tests/lapack_like/MultiShiftHessSolve" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/MultiShiftHessSolve PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/NestedDissection "/root/repo/_gate_build/bin/tests/lapack_like/NestedDissection" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/NestedDissection PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/QR "/root/repo/_gate_build/bin/tests/lapack_like/QR" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/QR PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/RQ "/root/repo/_gate_build/bin/tests/lapack_like/RQ" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/RQ PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/SVD "/root/repo/_gate_build/bin/tests/lapack_like/SVD" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/SVD PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/SVDTwoByTwoUpper "/root/repo/_gate_build/bin/tests/lapack_like/SVDTwoByTwoUpper" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/SVDTwoByTwoUpper PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/Schur "/root/repo/_gate_build/bin/tests/lapack_like/Schur" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/Schur PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/SchurSwap "/root/repo/_gate_build/bin/tests/lapack_like/SchurSwap" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/SchurSwap PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/SecularEVD "/root/repo/_gate_build/bin/tests/lapack_like/SecularEVD" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/SecularEVD PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/SecularSVD "/root/repo/_gate_build/bin/tests/lapack_like/SecularSVD" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/SecularSVD PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/SparseLDL "/root/repo/_gate_build/bin/tests/lapack_like/SparseLDL" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/SparseLDL PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/SparseLDLRefactor "/root/repo/_gate_build/bin/tests/lapack_like/SparseLDLRefactor" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/SparseLDLRefactor PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/SparseSymmetricSolve "/root/repo/_gate_build/bin/tests/lapack_like/SparseSymmetricSolve" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/SparseSymmetricSolve PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/TSQR "/root/repo/_gate_build/bin/tests/lapack_like/TSQR" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/TSQR PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/TSSVD "/root/repo/_gate_build/bin/tests/lapack_like/TSSVD" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/TSSVD PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/TriangEig "/root/repo/_gate_build/bin/tests/lapack_like/TriangEig" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/TriangEig PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/lapack_like/TriangularInverse "/root/repo/_gate_build/bin/tests/lapack_like/TriangularInverse" "-platform" "offscreen")
+set_tests_properties(Tests/lapack_like/TriangularInverse PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/lapack_like" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Tests/optimization/TSSVT "/root/repo/_gate_build/bin/tests/optimization/TSSVT" "-platform" "offscreen")
+set_tests_properties(Tests/optimization/TSSVT PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build/bin/tests/optimization" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;718;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("external/pmrrr")
+subdirs("external/suite_sparse")
@@ -0,0 +1,69 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/pmrrr/src/blas/odcpy.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/blas/odcpy.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/blas/odcpy.c.o.d"
+  "/root/repo/external/pmrrr/src/blas/odscal.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/blas/odscal.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/blas/odscal.c.o.d"
+  "/root/repo/external/pmrrr/src/blas/odswap.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/blas/odswap.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/blas/odswap.c.o.d"
+  "/root/repo/external/pmrrr/src/core/counter.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/core/counter.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/core/counter.c.o.d"
+  "/root/repo/external/pmrrr/src/core/queue.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/core/queue.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/core/queue.c.o.d"
+  "/root/repo/external/pmrrr/src/core/rrr.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/core/rrr.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/core/rrr.c.o.d"
+  "/root/repo/external/pmrrr/src/core/tasks.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/core/tasks.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/core/tasks.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/ode2.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/ode2.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/ode2.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odebz.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odebz.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odebz.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odev2.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odev2.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odev2.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odnan.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odnan.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odnan.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odneg.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odneg.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odneg.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odnst.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odnst.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odnst.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odr1v.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odr1v.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odr1v.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrnv.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrnv.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrnv.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrra.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrra.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrra.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrrb.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrb.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrb.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrrc.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrc.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrc.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrrd.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrd.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrd.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrre.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrre.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrre.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrrf.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrf.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrf.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrrj.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrj.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrj.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrrk.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrk.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrk.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrrr.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrr.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrr.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odrrv.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrv.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odrrv.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odruv.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odruv.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odruv.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odset.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odset.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odset.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odsnan.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsnan.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsnan.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odsq2.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsq2.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsq2.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odsq3.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsq3.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsq3.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odsq4.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsq4.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsq4.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odsq5.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsq5.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsq5.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odsq6.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsq6.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsq6.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odsrt.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsrt.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odsrt.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odssq.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odssq.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odssq.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/odstmr.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odstmr.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/odstmr.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/oerbla.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/oerbla.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/oerbla.c.o.d"
+  "/root/repo/external/pmrrr/src/lapack/olsame.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/olsame.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/lapack/olsame.c.o.d"
+  "/root/repo/external/pmrrr/src/plarre.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/plarre.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/plarre.c.o.d"
+  "/root/repo/external/pmrrr/src/plarrv.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/plarrv.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/plarrv.c.o.d"
+  "/root/repo/external/pmrrr/src/pmrrr.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/pmrrr.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/pmrrr.c.o.d"
+  "/root/repo/external/pmrrr/src/process_c_task.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/process_c_task.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/process_c_task.c.o.d"
+  "/root/repo/external/pmrrr/src/process_r_task.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/process_r_task.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/process_r_task.c.o.d"
+  "/root/repo/external/pmrrr/src/process_s_task.c" "external/pmrrr/CMakeFiles/pmrrr.dir/src/process_s_task.c.o" "gcc" "external/pmrrr/CMakeFiles/pmrrr.dir/src/process_s_task.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build/external/pmrrr/libpmrrr.so" "/root/repo/_gate_build/external/pmrrr/libpmrrr.so.88-dev"
+  "/root/repo/_gate_build/external/pmrrr/libpmrrr.so.0" "/root/repo/_gate_build/external/pmrrr/libpmrrr.so.88-dev"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
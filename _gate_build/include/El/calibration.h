@@ -0,0 +1,22 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CALIBRATION_H
+#define EL_CALIBRATION_H
+
+/* Machine-specific kernel parameters, either measured at configure time by
+   the EL_CALIBRATE microbenchmarks (see cmake/detect/Calibration.cmake) or
+   fallen back to the historical constants */
+/* #undef EL_CALIBRATED */
+
+#define EL_DEFAULT_BLOCKSIZE     128
+#define EL_LOCAL_SYMV_BLOCKSIZE  64
+#define EL_LOCAL_TRRK_BLOCKSIZE  64
+#define EL_LOCAL_TRR2K_BLOCKSIZE 64
+
+#endif /* ifndef EL_CALIBRATION_H */
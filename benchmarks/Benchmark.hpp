@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BENCHMARKS_BENCHMARK_HPP
+#define EL_BENCHMARKS_BENCHMARK_HPP
+
+// Shared scaffolding for the performance drivers in this directory: a
+// machine-readable JSON reporter and a handful of helpers for timing and
+// for weak/strong scaling sweeps. Every driver emits one JSON object per
+// (kernel, type, size) measurement so that runs of different job sizes can
+// be concatenated and tracked over time.
+
+#include <El.hpp>
+
+namespace El {
+namespace bench {
+
+// A single measurement, serialized incrementally as JSON key/value pairs
+class Record
+{
+public:
+    Record& Field( const string& key, const string& value )
+    { Append( key, "\""+value+"\"" ); return *this; }
+
+    Record& Field( const string& key, const char* value )
+    { return Field( key, string(value) ); }
+
+    Record& Field( const string& key, double value )
+    {
+        char buf[64];
+        snprintf( buf, sizeof(buf), "%.17g", value );
+        Append( key, buf );
+        return *this;
+    }
+
+    // A template avoids ambiguity between 'Int' and 'int' when they coincide
+    template<typename T,typename=EnableIf<std::is_integral<T>>>
+    Record& Field( const string& key, T value )
+    { Append( key, std::to_string(value) ); return *this; }
+
+    const string& Str() const { return body_; }
+
+private:
+    void Append( const string& key, const string& serialized )
+    {
+        if( !body_.empty() )
+            body_ += ", ";
+        body_ += "\""+key+"\": "+serialized;
+    }
+
+    string body_;
+};
+
+// Collects records and writes them as a JSON array on the root rank
+class Reporter
+{
+public:
+    Reporter( mpi::Comm comm, const string& filename )
+    : comm_(comm), filename_(filename)
+    { }
+
+    ~Reporter()
+    {
+        if( mpi::Rank(comm_) != 0 )
+            return;
+        std::ostream* os = &std::cout;
+        std::ofstream file;
+        if( filename_ != "" )
+        {
+            file.open( filename_.c_str() );
+            if( file.is_open() )
+                os = &file;
+        }
+        *os << "[\n";
+        for( size_t i=0; i<records_.size(); ++i )
+            *os << "  { " << records_[i] << " }"
+                << ( i+1 < records_.size() ? ",\n" : "\n" );
+        *os << "]" << std::endl;
+    }
+
+    void Add( const Record& record )
+    { records_.push_back( record.Str() ); }
+
+private:
+    mpi::Comm comm_;
+    string filename_;
+    vector<string> records_;
+};
+
+// Time a kernel with surrounding barriers and return the root's measurement
+// (which, thanks to the trailing barrier, bounds the slowest rank)
+inline double Time( const function<void()>& kernel, mpi::Comm comm )
+{
+    Timer timer;
+    mpi::Barrier( comm );
+    timer.Start();
+    kernel();
+    mpi::Barrier( comm );
+    return timer.Stop();
+}
+
+// The minimum over several trials, which filters out system noise
+inline double
+BestTime( const function<void()>& kernel, mpi::Comm comm, Int numTrials )
+{
+    double best = limits::Max<double>();
+    for( Int trial=0; trial<numTrials; ++trial )
+        best = Min( best, Time( kernel, comm ) );
+    return best;
+}
+
+// For a weak-scaling sweep the base problem size is inflated so that the
+// memory per rank stays constant; 'exponent' is the rate at which storage
+// grows with the dimension (1/2 for dense matrices, 1/3 for 3D grids)
+inline Int ScaledSize( Int base, bool weak, int commSize, double exponent )
+{
+    if( !weak )
+        return base;
+    return Int( double(base)*Pow( double(commSize), exponent ) );
+}
+
+// The common sweep options shared by every driver
+struct Sweep
+{
+    Int minSize, maxSize, growthFactor, numTrials;
+    bool weak;
+    string output;
+
+    Sweep( Int minSizeDefault, Int maxSizeDefault )
+    {
+        minSize = Input("--minSize","smallest problem size",minSizeDefault);
+        maxSize = Input("--maxSize","largest problem size",maxSizeDefault);
+        growthFactor = Input("--growthFactor","size growth per step",Int(2));
+        numTrials = Input("--trials","trials per measurement",Int(3));
+        weak = Input("--weak","weak (rather than strong) scaling?",false);
+        output = Input("--output","JSON output filename",string(""));
+    }
+};
+
+} // namespace bench
+} // namespace El
+
+#endif // ifndef EL_BENCHMARKS_BENCHMARK_HPP
@@ -0,0 +1,84 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkGemm
+( Orientation orientA, Orientation orientB,
+  Int n, Int numTrials, const Grid& grid, bench::Reporter& reporter )
+{
+    DistMatrix<F> A(grid), B(grid), C(grid);
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Uniform( C, n, n );
+
+    const double time = bench::BestTime
+      ( [&]() { Gemm( orientA, orientB, F(3), A, B, F(2), C ); },
+        grid.Comm(), numTrials );
+    double gFlops = (2.*n*n*n)/(time*1.e9);
+    if( IsComplex<F>::value )
+        gFlops *= 4;
+
+    if( grid.Rank() == 0 )
+        Output(TypeName<F>()," Gemm, n=",n,": ",time," secs (",
+               gFlops," GFlop/s)");
+    reporter.Add
+    ( bench::Record()
+      .Field( "kernel", "Gemm" )
+      .Field( "orientA", string(1,OrientationToChar(orientA)) )
+      .Field( "orientB", string(1,OrientationToChar(orientB)) )
+      .Field( "field", TypeName<F>() )
+      .Field( "n", n )
+      .Field( "commSize", grid.Size() )
+      .Field( "gridHeight", grid.Height() )
+      .Field( "time", time )
+      .Field( "gflops", gFlops ) );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const mpi::Comm comm;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        bench::Sweep sweep( 1000, 4000 );
+        const char transA = Input("--transA","orientation of A: N/T/C",'N');
+        const char transB = Input("--transB","orientation of B: N/T/C",'N');
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        ProcessInput();
+
+        const Orientation orientA = CharToOrientation( transA );
+        const Orientation orientB = CharToOrientation( transB );
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( commSize );
+        const Grid grid( mpi::COMM_WORLD, gridHeight );
+        if( commRank == 0 )
+            Output("grid is ",grid.Height()," x ",grid.Width());
+
+        bench::Reporter reporter( comm, sweep.output );
+        for( Int base=sweep.minSize; base<=sweep.maxSize;
+             base*=sweep.growthFactor )
+        {
+            const Int n = bench::ScaledSize( base, sweep.weak, commSize, 0.5 );
+            BenchmarkGemm<float>
+            ( orientA, orientB, n, sweep.numTrials, grid, reporter );
+            BenchmarkGemm<double>
+            ( orientA, orientB, n, sweep.numTrials, grid, reporter );
+            BenchmarkGemm<Complex<double>>
+            ( orientA, orientB, n, sweep.numTrials, grid, reporter );
+        }
+    } catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Int n, Int numRHS, Int numTrials, const Grid& grid,
+  bench::Reporter& reporter )
+{
+    DistMatrix<F> A(grid), BOrig(grid), B(grid);
+    // A well-conditioned triangular matrix avoids overflow over the sweep
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(2*n) );
+    if( side == LEFT )
+        Uniform( BOrig, n, numRHS );
+    else
+        Uniform( BOrig, numRHS, n );
+
+    const double time = bench::BestTime
+      ( [&]() { B = BOrig;
+                Trsm( side, uplo, NORMAL, NON_UNIT, F(1), A, B ); },
+        grid.Comm(), numTrials );
+    double gFlops = (1.*n*n*numRHS)/(time*1.e9);
+    if( IsComplex<F>::value )
+        gFlops *= 4;
+
+    if( grid.Rank() == 0 )
+        Output(TypeName<F>()," Trsm, n=",n,", numRHS=",numRHS,": ",time,
+               " secs (",gFlops," GFlop/s)");
+    reporter.Add
+    ( bench::Record()
+      .Field( "kernel", "Trsm" )
+      .Field( "side", side==LEFT ? "L" : "R" )
+      .Field( "uplo", uplo==LOWER ? "L" : "U" )
+      .Field( "field", TypeName<F>() )
+      .Field( "n", n )
+      .Field( "numRHS", numRHS )
+      .Field( "commSize", grid.Size() )
+      .Field( "gridHeight", grid.Height() )
+      .Field( "time", time )
+      .Field( "gflops", gFlops ) );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const mpi::Comm comm;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        bench::Sweep sweep( 1000, 4000 );
+        const char sideChar = Input("--side","side to solve from: L/R",'L');
+        const char uploChar = Input("--uplo","lower/upper storage: L/U",'L');
+        const Int numRHS = Input("--numRHS","number of right-hand sides",
+                                 Int(1000));
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        ProcessInput();
+
+        const LeftOrRight side = CharToLeftOrRight( sideChar );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( commSize );
+        const Grid grid( mpi::COMM_WORLD, gridHeight );
+        if( commRank == 0 )
+            Output("grid is ",grid.Height()," x ",grid.Width());
+
+        bench::Reporter reporter( comm, sweep.output );
+        for( Int base=sweep.minSize; base<=sweep.maxSize;
+             base*=sweep.growthFactor )
+        {
+            const Int n = bench::ScaledSize( base, sweep.weak, commSize, 0.5 );
+            BenchmarkTrsm<float>
+            ( side, uplo, n, numRHS, sweep.numTrials, grid, reporter );
+            BenchmarkTrsm<double>
+            ( side, uplo, n, numRHS, sweep.numTrials, grid, reporter );
+            BenchmarkTrsm<Complex<double>>
+            ( side, uplo, n, numRHS, sweep.numTrials, grid, reporter );
+        }
+    } catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkCholesky
+( UpperOrLower uplo, Int n, Int numTrials, const Grid& grid,
+  bench::Reporter& reporter )
+{
+    DistMatrix<F> AOrig(grid), A(grid);
+    HermitianUniformSpectrum( AOrig, n, 1, 10 );
+
+    const double time = bench::BestTime
+      ( [&]() { A = AOrig; Cholesky( uplo, A ); },
+        grid.Comm(), numTrials );
+    double gFlops = (1.*n*n*n)/(3.*time*1.e9);
+    if( IsComplex<F>::value )
+        gFlops *= 4;
+
+    if( grid.Rank() == 0 )
+        Output(TypeName<F>()," Cholesky, n=",n,": ",time," secs (",
+               gFlops," GFlop/s)");
+    reporter.Add
+    ( bench::Record()
+      .Field( "kernel", "Cholesky" )
+      .Field( "uplo", uplo==LOWER ? "L" : "U" )
+      .Field( "field", TypeName<F>() )
+      .Field( "n", n )
+      .Field( "commSize", grid.Size() )
+      .Field( "gridHeight", grid.Height() )
+      .Field( "time", time )
+      .Field( "gflops", gFlops ) );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const mpi::Comm comm;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        bench::Sweep sweep( 1000, 4000 );
+        const char uploChar = Input("--uplo","lower/upper storage: L/U",'L');
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        ProcessInput();
+
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( commSize );
+        const Grid grid( mpi::COMM_WORLD, gridHeight );
+        if( commRank == 0 )
+            Output("grid is ",grid.Height()," x ",grid.Width());
+
+        bench::Reporter reporter( comm, sweep.output );
+        for( Int base=sweep.minSize; base<=sweep.maxSize;
+             base*=sweep.growthFactor )
+        {
+            const Int n = bench::ScaledSize( base, sweep.weak, commSize, 0.5 );
+            BenchmarkCholesky<float>
+            ( uplo, n, sweep.numTrials, grid, reporter );
+            BenchmarkCholesky<double>
+            ( uplo, n, sweep.numTrials, grid, reporter );
+            BenchmarkCholesky<Complex<double>>
+            ( uplo, n, sweep.numTrials, grid, reporter );
+        }
+    } catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
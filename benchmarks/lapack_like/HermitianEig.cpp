@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkHermitianEig
+( UpperOrLower uplo, bool onlyEigvals, Int n, Int numTrials,
+  const Grid& grid, bench::Reporter& reporter )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> AOrig(grid), A(grid), Q(grid);
+    HermitianUniformSpectrum( AOrig, n, -10, 10 );
+
+    DistMatrix<Real,VR,STAR> w(grid);
+    const double time = bench::BestTime
+      ( [&]() { A = AOrig;
+                if( onlyEigvals )
+                    HermitianEig( uplo, A, w );
+                else
+                    HermitianEig( uplo, A, w, Q ); },
+        grid.Comm(), numTrials );
+
+    if( grid.Rank() == 0 )
+        Output(TypeName<F>()," HermitianEig, n=",n,
+               ( onlyEigvals ? " (eigenvalues only)" : "" ),": ",
+               time," secs");
+    reporter.Add
+    ( bench::Record()
+      .Field( "kernel", "HermitianEig" )
+      .Field( "uplo", uplo==LOWER ? "L" : "U" )
+      .Field( "onlyEigvals", onlyEigvals ? "true" : "false" )
+      .Field( "field", TypeName<F>() )
+      .Field( "n", n )
+      .Field( "commSize", grid.Size() )
+      .Field( "gridHeight", grid.Height() )
+      .Field( "time", time ) );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const mpi::Comm comm;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        bench::Sweep sweep( 500, 2000 );
+        const char uploChar = Input("--uplo","lower/upper storage: L/U",'L');
+        const bool onlyEigvals =
+          Input("--onlyEigvals","only compute eigenvalues?",false);
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        ProcessInput();
+
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( commSize );
+        const Grid grid( mpi::COMM_WORLD, gridHeight );
+        if( commRank == 0 )
+            Output("grid is ",grid.Height()," x ",grid.Width());
+
+        bench::Reporter reporter( comm, sweep.output );
+        for( Int base=sweep.minSize; base<=sweep.maxSize;
+             base*=sweep.growthFactor )
+        {
+            const Int n = bench::ScaledSize( base, sweep.weak, commSize, 0.5 );
+            BenchmarkHermitianEig<float>
+            ( uplo, onlyEigvals, n, sweep.numTrials, grid, reporter );
+            BenchmarkHermitianEig<double>
+            ( uplo, onlyEigvals, n, sweep.numTrials, grid, reporter );
+            BenchmarkHermitianEig<Complex<double>>
+            ( uplo, onlyEigvals, n, sweep.numTrials, grid, reporter );
+        }
+    } catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
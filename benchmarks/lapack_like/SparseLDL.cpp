@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void BenchmarkSparseLDL
+( Int n1, Int n2, Int n3, Int numRHS, Int numTrials,
+  const Grid& grid, bench::Reporter& reporter )
+{
+    const Int N = n1*n2*n3;
+    DistSparseMatrix<F> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -F(1);
+
+    DistMultiVec<F> X( N, numRHS, grid ), Y( N, numRHS, grid );
+    MakeUniform( X );
+    Zero( Y );
+    Multiply( NORMAL, F(1), A, X, F(0), Y );
+
+    // The three phases are timed separately since they scale differently;
+    // analysis and factorization are rerun from scratch each trial
+    double analysisTime = limits::Max<double>();
+    double factorTime = limits::Max<double>();
+    double solveTime = limits::Max<double>();
+    const bool hermitian = true;
+    for( Int trial=0; trial<numTrials; ++trial )
+    {
+        DistSparseLDLFactorization<F> sparseLDLFact;
+        analysisTime = Min( analysisTime,
+          bench::Time
+          ( [&]() { sparseLDLFact.Initialize( A, hermitian ); },
+            grid.Comm() ) );
+        factorTime = Min( factorTime,
+          bench::Time
+          ( [&]() { sparseLDLFact.Factor(); }, grid.Comm() ) );
+        DistMultiVec<F> YCopy( Y );
+        solveTime = Min( solveTime,
+          bench::Time
+          ( [&]() { sparseLDLFact.Solve( YCopy ); }, grid.Comm() ) );
+    }
+
+    if( grid.Rank() == 0 )
+        Output(TypeName<F>()," SparseLDL, ",n1," x ",n2," x ",n3,
+               " grid: analysis=",analysisTime,", factor=",factorTime,
+               ", solve=",solveTime," secs");
+    reporter.Add
+    ( bench::Record()
+      .Field( "kernel", "SparseLDL" )
+      .Field( "field", TypeName<F>() )
+      .Field( "n1", n1 )
+      .Field( "n2", n2 )
+      .Field( "n3", n3 )
+      .Field( "numRHS", numRHS )
+      .Field( "commSize", grid.Size() )
+      .Field( "analysisTime", analysisTime )
+      .Field( "factorTime", factorTime )
+      .Field( "solveTime", solveTime ) );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const mpi::Comm comm;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        bench::Sweep sweep( 20, 80 );
+        const Int n3 = Input("--n3","third grid dimension (0: use sweep)",
+                             Int(0));
+        const Int numRHS = Input("--numRHS","number of right-hand sides",
+                                 Int(10));
+        ProcessInput();
+
+        const Grid grid( mpi::COMM_WORLD );
+        bench::Reporter reporter( comm, sweep.output );
+        for( Int base=sweep.minSize; base<=sweep.maxSize;
+             base*=sweep.growthFactor )
+        {
+            // A 3D Laplacian's storage grows with the vertex count, so the
+            // per-dimension size is scaled by the cube root for weak scaling
+            const Int n =
+              bench::ScaledSize( base, sweep.weak, commSize, 1./3. );
+            BenchmarkSparseLDL<double>
+            ( n, n, ( n3 == 0 ? n : n3 ), numRHS, sweep.numTrials,
+              grid, reporter );
+        }
+    } catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../Benchmark.hpp"
+using namespace El;
+
+// A primal-dual feasible pair is generated so that Mehrotra's method is
+// guaranteed a bounded optimum: b is the image of a strictly positive
+// point, and c = A^T y + z for a strictly positive z
+template<typename Real>
+void BenchmarkIPM
+( Int m, Int n, Int numTrials, const Grid& grid,
+  bench::Reporter& reporter )
+{
+    DirectLPProblem<DistMatrix<Real>,DistMatrix<Real>> problem;
+    ForceSimpleAlignments( problem, grid );
+    Uniform( problem.A, m, n );
+
+    DistMatrix<Real> xFeas(grid), yFeas(grid), zFeas(grid);
+    Uniform( xFeas, n, 1, Real(1), Real(0.5) );
+    Uniform( yFeas, m, 1 );
+    Uniform( zFeas, n, 1, Real(1), Real(0.5) );
+    Zeros( problem.b, m, 1 );
+    Gemv( NORMAL, Real(1), problem.A, xFeas, Real(0), problem.b );
+    Zeros( problem.c, n, 1 );
+    Gemv( TRANSPOSE, Real(1), problem.A, yFeas, Real(0), problem.c );
+    problem.c += zFeas;
+
+    lp::direct::Ctrl<Real> ctrl(false);
+    const double time = bench::BestTime
+      ( [&]() { DirectLPSolution<DistMatrix<Real>> solution;
+                ForceSimpleAlignments( solution, grid );
+                LP( problem, solution, ctrl ); },
+        grid.Comm(), numTrials );
+
+    if( grid.Rank() == 0 )
+        Output(TypeName<Real>()," direct LP IPM, ",m," x ",n,": ",time,
+               " secs");
+    reporter.Add
+    ( bench::Record()
+      .Field( "kernel", "DirectLPIPM" )
+      .Field( "field", TypeName<Real>() )
+      .Field( "m", m )
+      .Field( "n", n )
+      .Field( "commSize", grid.Size() )
+      .Field( "gridHeight", grid.Height() )
+      .Field( "time", time ) );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const mpi::Comm comm;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        bench::Sweep sweep( 250, 1000 );
+        const double aspect =
+          Input("--aspect","row/column ratio of A",0.5);
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        ProcessInput();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( commSize );
+        const Grid grid( mpi::COMM_WORLD, gridHeight );
+        if( commRank == 0 )
+            Output("grid is ",grid.Height()," x ",grid.Width());
+
+        bench::Reporter reporter( comm, sweep.output );
+        for( Int base=sweep.minSize; base<=sweep.maxSize;
+             base*=sweep.growthFactor )
+        {
+            const Int n = bench::ScaledSize( base, sweep.weak, commSize, 0.5 );
+            const Int m = Int(aspect*n);
+            BenchmarkIPM<double>( m, n, sweep.numTrials, grid, reporter );
+        }
+    } catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
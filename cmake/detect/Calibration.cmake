@@ -0,0 +1,53 @@
+#
+#  Copyright 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+
+# Optionally run cache-blocking microbenchmarks on the target machine at
+# configure time and bake the selected parameters into the generated
+# El/calibration.h consumed by the blocked local kernels and the default
+# algorithmic blocksize.
+option(EL_CALIBRATE
+  "Microbenchmark kernel parameters on this machine at configure time" OFF)
+
+# The historical (x86-tuned) constants serve as the fallbacks
+set(EL_DEFAULT_BLOCKSIZE 128)
+set(EL_LOCAL_SYMV_BLOCKSIZE 64)
+set(EL_LOCAL_TRRK_BLOCKSIZE 64)
+set(EL_LOCAL_TRR2K_BLOCKSIZE 64)
+
+if(EL_CALIBRATE)
+  if(CMAKE_CROSSCOMPILING)
+    message(WARNING
+      "Skipping EL_CALIBRATE since the microbenchmarks cannot run on the host while cross-compiling; the default kernel parameters will be used")
+  else()
+    message(STATUS "Calibrating kernel parameters (this may take a minute)")
+    try_run(EL_CALIBRATE_RUN EL_CALIBRATE_COMPILE
+      "${PROJECT_BINARY_DIR}/calibration"
+      "${PROJECT_SOURCE_DIR}/cmake/detect/calibrate.cpp"
+      CMAKE_FLAGS "-DCMAKE_CXX_FLAGS:STRING=-O2"
+      COMPILE_OUTPUT_VARIABLE EL_CALIBRATE_BUILD_OUTPUT
+      RUN_OUTPUT_VARIABLE EL_CALIBRATE_OUTPUT)
+    if(EL_CALIBRATE_COMPILE AND EL_CALIBRATE_RUN EQUAL 0)
+      foreach(param
+          EL_DEFAULT_BLOCKSIZE
+          EL_LOCAL_SYMV_BLOCKSIZE
+          EL_LOCAL_TRRK_BLOCKSIZE
+          EL_LOCAL_TRR2K_BLOCKSIZE)
+        if(EL_CALIBRATE_OUTPUT MATCHES "${param} ([0-9]+)")
+          set(${param} ${CMAKE_MATCH_1})
+        endif()
+      endforeach()
+      set(EL_CALIBRATED TRUE)
+      message(STATUS
+        "Calibrated blocksizes: default=${EL_DEFAULT_BLOCKSIZE}, symv=${EL_LOCAL_SYMV_BLOCKSIZE}, trrk=${EL_LOCAL_TRRK_BLOCKSIZE}, trr2k=${EL_LOCAL_TRR2K_BLOCKSIZE}")
+    else()
+      message(WARNING
+        "The kernel calibration microbenchmarks failed to build or run; the default kernel parameters will be used")
+    endif()
+  endif()
+endif()
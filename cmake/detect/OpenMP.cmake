@@ -47,6 +47,31 @@ else()
   set(EL_HAVE_OMP_COLLAPSE FALSE)
 endif()
 
+# See if we have 'task' support, which was introduced in OpenMP 3.0
+if(EL_HAVE_OPENMP)
+  set(CMAKE_REQUIRED_FLAGS ${OpenMP_CXX_FLAGS})
+  set(OMP_TASK_CODE
+      "#include <omp.h>
+       int main( int argc, char* argv[] )
+       {
+           int k = 0;
+       #pragma omp parallel
+           {
+       #pragma omp single
+               {
+       #pragma omp task
+                   k = 1;
+       #pragma omp taskwait
+               }
+           }
+           return k;
+       }")
+  check_cxx_source_compiles("${OMP_TASK_CODE}" EL_HAVE_OMP_TASK)
+  set(CMAKE_REQUIRED_FLAGS)
+else()
+  set(EL_HAVE_OMP_TASK FALSE)
+endif()
+
 # See if we have 'simd' support, which was introduced in OpenMP 4.0
 if(EL_HAVE_OPENMP)
   set(CMAKE_REQUIRED_FLAGS ${OpenMP_CXX_FLAGS})
@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// A standalone microbenchmark, run on the target machine at configure time
+// by cmake/detect/Calibration.cmake, which selects cache-blocking
+// parameters for the blocked local kernels and the default algorithmic
+// blocksize. On success it prints one "NAME value" line per parameter,
+// which the CMake module parses into the generated El/calibration.h.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// Prevent the compiler from discarding the benchmark results
+volatile double sink = 0;
+
+double Elapsed( const Clock::time_point& start )
+{
+    return std::chrono::duration_cast<std::chrono::duration<double>>
+           ( Clock::now() - start ).count();
+}
+
+// A jj/kk-blocked matrix-matrix multiply, C += A B, over column-major
+// buffers; a proxy for the panel width of the blocked algorithms
+double BlockedGemmTime( int n, int b, int reps )
+{
+    std::vector<double> A( n*n, 1. ), B( n*n, 1. ), C( n*n, 0. );
+    double best = 1.e30;
+    for( int rep=0; rep<reps; ++rep )
+    {
+        const auto start = Clock::now();
+        for( int jj=0; jj<n; jj+=b )
+            for( int kk=0; kk<n; kk+=b )
+                for( int j=jj; j<std::min(jj+b,n); ++j )
+                    for( int k=kk; k<std::min(kk+b,n); ++k )
+                    {
+                        const double beta = B[k+j*n];
+                        const double* a = &A[k*n];
+                        double* c = &C[j*n];
+                        for( int i=0; i<n; ++i )
+                            c[i] += beta*a[i];
+                    }
+        best = std::min( best, Elapsed(start) );
+        sink = sink + C[0];
+    }
+    return best;
+}
+
+// A tiled symmetric matrix-vector multiply which only touches the lower
+// triangle; a proxy for the LocalSymv blocksize
+double BlockedSymvTime( int n, int b, int reps )
+{
+    std::vector<double> A( n*n, 1. ), x( n, 1. ), y( n, 0. );
+    double best = 1.e30;
+    for( int rep=0; rep<reps; ++rep )
+    {
+        const auto start = Clock::now();
+        for( int jj=0; jj<n; jj+=b )
+            for( int ii=jj; ii<n; ii+=b )
+                for( int j=jj; j<std::min(jj+b,n); ++j )
+                {
+                    const double xj = x[j];
+                    double acc = 0;
+                    const int iBeg = std::max( ii, j );
+                    const int iEnd = std::min( ii+b, n );
+                    for( int i=iBeg; i<iEnd; ++i )
+                    {
+                        y[i] += A[i+j*n]*xj;
+                        acc += A[i+j*n]*x[i];
+                    }
+                    y[j] += acc;
+                }
+        best = std::min( best, Elapsed(start) );
+        sink = sink + y[0];
+    }
+    return best;
+}
+
+// A k-panel-blocked rank-k update of a lower triangle, C += A B^T; a proxy
+// for the LocalTrrk (and LocalTrr2k) blocksizes
+double BlockedTrrkTime( int n, int b, int reps )
+{
+    std::vector<double> A( n*n, 1. ), B( n*n, 1. ), C( n*n, 0. );
+    double best = 1.e30;
+    for( int rep=0; rep<reps; ++rep )
+    {
+        const auto start = Clock::now();
+        for( int kk=0; kk<n; kk+=b )
+            for( int j=0; j<n; ++j )
+                for( int k=kk; k<std::min(kk+b,n); ++k )
+                {
+                    const double beta = B[j+k*n];
+                    const double* a = &A[k*n];
+                    double* c = &C[j*n];
+                    for( int i=j; i<n; ++i )
+                        c[i] += beta*a[i];
+                }
+        best = std::min( best, Elapsed(start) );
+        sink = sink + C[0];
+    }
+    return best;
+}
+
+template<typename Benchmark>
+int BestCandidate
+( const Benchmark& benchmark, const std::vector<int>& candidates,
+  int n, int reps )
+{
+    int best = candidates.front();
+    double bestTime = 1.e30;
+    for( const int candidate : candidates )
+    {
+        const double time = benchmark( n, candidate, reps );
+        if( time < bestTime )
+        {
+            bestTime = time;
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+} // anonymous namespace
+
+int main()
+{
+    const int reps = 3;
+
+    const int defaultBlocksize =
+      BestCandidate( BlockedGemmTime, {64,96,128,192,256}, 384, reps );
+    const int symvBlocksize =
+      BestCandidate( BlockedSymvTime, {16,32,64,128}, 1024, reps );
+    const int trrkBlocksize =
+      BestCandidate( BlockedTrrkTime, {32,64,128,192}, 384, reps );
+
+    std::printf( "EL_DEFAULT_BLOCKSIZE %d\n", defaultBlocksize );
+    std::printf( "EL_LOCAL_SYMV_BLOCKSIZE %d\n", symvBlocksize );
+    std::printf( "EL_LOCAL_TRRK_BLOCKSIZE %d\n", trrkBlocksize );
+    // The two-sided rank-k update has the same blocking behavior
+    std::printf( "EL_LOCAL_TRR2K_BLOCKSIZE %d\n", trrkBlocksize );
+    return 0;
+}
@@ -12,5 +12,6 @@
 #include <El/blas_like/level1.h>
 #include <El/blas_like/level2.h>
 #include <El/blas_like/level3.h>
+#include <El/blas_like/batch.h>
 
 #endif /* ifndef EL_BLAS_C_H */
@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_BATCH_C_H
+#define EL_BLAS_BATCH_C_H
+
+#include <El/core/DistMatrix.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* An ElBatch call executes a short sequence of level-1 and level-3
+   operations in a single library crossing, which is useful for wrappers
+   (e.g., over an FFI) where the per-call overhead is measurable relative
+   to the cost of small matrix operations. Each entry describes one
+   operation; fields which are irrelevant to the given operation are
+   ignored and may be left uninitialized. The supported operations are:
+
+     EL_BATCH_ZERO:  C := 0
+     EL_BATCH_SCALE: C := alpha C
+     EL_BATCH_COPY:  C := A
+     EL_BATCH_AXPY:  C := alpha A + C
+     EL_BATCH_GEMM:  C := alpha op(A) op(B) + beta C
+     EL_BATCH_TRSM:  C := alpha op(A)^-1 C or C := alpha C op(A)^-1,
+                     where A is triangular (not supported for integral data)
+
+   The entries are executed in order, so the output of one operation may
+   be used as an input of a later one. */
+
+typedef enum {
+  EL_BATCH_ZERO,
+  EL_BATCH_SCALE,
+  EL_BATCH_COPY,
+  EL_BATCH_AXPY,
+  EL_BATCH_GEMM,
+  EL_BATCH_TRSM
+} ElBatchOpType;
+
+typedef struct
+{
+  ElBatchOpType op;
+  ElLeftOrRight side;           /* EL_BATCH_TRSM */
+  ElUpperOrLower uplo;          /* EL_BATCH_TRSM */
+  ElOrientation orientationOfA; /* EL_BATCH_GEMM and EL_BATCH_TRSM */
+  ElOrientation orientationOfB; /* EL_BATCH_GEMM */
+  ElUnitOrNonUnit diag;         /* EL_BATCH_TRSM */
+  ElInt alpha, beta;
+  ElConstMatrix_i A, B;
+  ElMatrix_i C;
+} ElBatchEntry_i;
+typedef struct
+{
+  ElBatchOpType op;
+  ElLeftOrRight side;
+  ElUpperOrLower uplo;
+  ElOrientation orientationOfA;
+  ElOrientation orientationOfB;
+  ElUnitOrNonUnit diag;
+  float alpha, beta;
+  ElConstMatrix_s A, B;
+  ElMatrix_s C;
+} ElBatchEntry_s;
+typedef struct
+{
+  ElBatchOpType op;
+  ElLeftOrRight side;
+  ElUpperOrLower uplo;
+  ElOrientation orientationOfA;
+  ElOrientation orientationOfB;
+  ElUnitOrNonUnit diag;
+  double alpha, beta;
+  ElConstMatrix_d A, B;
+  ElMatrix_d C;
+} ElBatchEntry_d;
+typedef struct
+{
+  ElBatchOpType op;
+  ElLeftOrRight side;
+  ElUpperOrLower uplo;
+  ElOrientation orientationOfA;
+  ElOrientation orientationOfB;
+  ElUnitOrNonUnit diag;
+  complex_float alpha, beta;
+  ElConstMatrix_c A, B;
+  ElMatrix_c C;
+} ElBatchEntry_c;
+typedef struct
+{
+  ElBatchOpType op;
+  ElLeftOrRight side;
+  ElUpperOrLower uplo;
+  ElOrientation orientationOfA;
+  ElOrientation orientationOfB;
+  ElUnitOrNonUnit diag;
+  complex_double alpha, beta;
+  ElConstMatrix_z A, B;
+  ElMatrix_z C;
+} ElBatchEntry_z;
+
+typedef struct
+{
+  ElBatchOpType op;
+  ElLeftOrRight side;
+  ElUpperOrLower uplo;
+  ElOrientation orientationOfA;
+  ElOrientation orientationOfB;
+  ElUnitOrNonUnit diag;
+  ElInt alpha, beta;
+  ElConstDistMatrix_i A, B;
+  ElDistMatrix_i C;
+} ElBatchEntryDist_i;
+typedef struct
+{
+  ElBatchOpType op;
+  ElLeftOrRight side;
+  ElUpperOrLower uplo;
+  ElOrientation orientationOfA;
+  ElOrientation orientationOfB;
+  ElUnitOrNonUnit diag;
+  float alpha, beta;
+  ElConstDistMatrix_s A, B;
+  ElDistMatrix_s C;
+} ElBatchEntryDist_s;
+typedef struct
+{
+  ElBatchOpType op;
+  ElLeftOrRight side;
+  ElUpperOrLower uplo;
+  ElOrientation orientationOfA;
+  ElOrientation orientationOfB;
+  ElUnitOrNonUnit diag;
+  double alpha, beta;
+  ElConstDistMatrix_d A, B;
+  ElDistMatrix_d C;
+} ElBatchEntryDist_d;
+typedef struct
+{
+  ElBatchOpType op;
+  ElLeftOrRight side;
+  ElUpperOrLower uplo;
+  ElOrientation orientationOfA;
+  ElOrientation orientationOfB;
+  ElUnitOrNonUnit diag;
+  complex_float alpha, beta;
+  ElConstDistMatrix_c A, B;
+  ElDistMatrix_c C;
+} ElBatchEntryDist_c;
+typedef struct
+{
+  ElBatchOpType op;
+  ElLeftOrRight side;
+  ElUpperOrLower uplo;
+  ElOrientation orientationOfA;
+  ElOrientation orientationOfB;
+  ElUnitOrNonUnit diag;
+  complex_double alpha, beta;
+  ElConstDistMatrix_z A, B;
+  ElDistMatrix_z C;
+} ElBatchEntryDist_z;
+
+EL_EXPORT ElError ElBatch_i
+( const ElBatchEntry_i* entries, ElInt numEntries );
+EL_EXPORT ElError ElBatch_s
+( const ElBatchEntry_s* entries, ElInt numEntries );
+EL_EXPORT ElError ElBatch_d
+( const ElBatchEntry_d* entries, ElInt numEntries );
+EL_EXPORT ElError ElBatch_c
+( const ElBatchEntry_c* entries, ElInt numEntries );
+EL_EXPORT ElError ElBatch_z
+( const ElBatchEntry_z* entries, ElInt numEntries );
+
+EL_EXPORT ElError ElBatchDist_i
+( const ElBatchEntryDist_i* entries, ElInt numEntries );
+EL_EXPORT ElError ElBatchDist_s
+( const ElBatchEntryDist_s* entries, ElInt numEntries );
+EL_EXPORT ElError ElBatchDist_d
+( const ElBatchEntryDist_d* entries, ElInt numEntries );
+EL_EXPORT ElError ElBatchDist_c
+( const ElBatchEntryDist_c* entries, ElInt numEntries );
+EL_EXPORT ElError ElBatchDist_z
+( const ElBatchEntryDist_z* entries, ElInt numEntries );
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* ifndef EL_BLAS_BATCH_C_H */
@@ -0,0 +1,226 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_AXPBY_HPP
+#define EL_BLAS_AXPBY_HPP
+
+namespace El {
+
+// Fused forms of the level-1 update chains which dominate Krylov methods:
+// 'Axpby' computes Y := alpha X + beta Y, and 'Axpbypcz' computes
+// Z := alpha X + beta Y + gamma Z, each in a single pass over memory where
+// the equivalent Scale/Axpy sequences would make one full pass per call.
+
+template<typename T,typename S>
+void Axpby( S alphaS, const Matrix<T>& X, S betaS, Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+          LogicError("Nonconformal Axpby");
+    )
+    const T alpha = T(alphaS);
+    const T beta = T(betaS);
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int ldX = X.LDim();
+    const Int ldY = Y.LDim();
+    const T* XBuf = X.LockedBuffer();
+          T* YBuf = Y.Buffer();
+
+    // Iterate over a single loop if X and Y are both contiguous in
+    // memory. Otherwise iterate over a double loop.
+    if( ldX == m && ldY == m )
+    {
+        EL_PARALLEL_FOR
+        for( Int i=0; i<m*n; ++i )
+            YBuf[i] = alpha*XBuf[i] + beta*YBuf[i];
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
+        {
+            EL_SIMD
+            for( Int i=0; i<m; ++i )
+            {
+                YBuf[i+j*ldY] = alpha*XBuf[i+j*ldX] + beta*YBuf[i+j*ldY];
+            }
+        }
+    }
+}
+
+template<typename T,typename S>
+void Axpby
+( S alphaS, const ElementalMatrix<T>& X, S betaS, ElementalMatrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( X, Y ))
+    if( X.DistData() == Y.DistData() )
+    {
+        Axpby( alphaS, X.LockedMatrix(), betaS, Y.Matrix() );
+    }
+    else
+    {
+        unique_ptr<ElementalMatrix<T>> XCopy( Y.Construct(Y.Grid(),Y.Root()) );
+        XCopy->AlignWith( Y.DistData() );
+        Copy( X, *XCopy );
+        Axpby( alphaS, XCopy->LockedMatrix(), betaS, Y.Matrix() );
+    }
+}
+
+template<typename T,typename S>
+void Axpby
+( S alphaS, const DistMultiVec<T>& X, S betaS, DistMultiVec<T>& Y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !mpi::Congruent( X.Grid().Comm(), Y.Grid().Comm() ) )
+          LogicError("X and Y must have congruent communicators");
+    )
+    Axpby( alphaS, X.LockedMatrix(), betaS, Y.Matrix() );
+}
+
+template<typename T,typename S>
+void Axpbypcz
+( S alphaS, const Matrix<T>& X,
+  S betaS,  const Matrix<T>& Y,
+  S gammaS,       Matrix<T>& Z )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( X.Height() != Z.Height() || X.Width() != Z.Width() ||
+          Y.Height() != Z.Height() || Y.Width() != Z.Width() )
+          LogicError("Nonconformal Axpbypcz");
+    )
+    const T alpha = T(alphaS);
+    const T beta = T(betaS);
+    const T gamma = T(gammaS);
+    const Int m = Z.Height();
+    const Int n = Z.Width();
+    const Int ldX = X.LDim();
+    const Int ldY = Y.LDim();
+    const Int ldZ = Z.LDim();
+    const T* XBuf = X.LockedBuffer();
+    const T* YBuf = Y.LockedBuffer();
+          T* ZBuf = Z.Buffer();
+
+    if( ldX == m && ldY == m && ldZ == m )
+    {
+        EL_PARALLEL_FOR
+        for( Int i=0; i<m*n; ++i )
+            ZBuf[i] = alpha*XBuf[i] + beta*YBuf[i] + gamma*ZBuf[i];
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
+        {
+            EL_SIMD
+            for( Int i=0; i<m; ++i )
+            {
+                ZBuf[i+j*ldZ] =
+                  alpha*XBuf[i+j*ldX] + beta*YBuf[i+j*ldY] +
+                  gamma*ZBuf[i+j*ldZ];
+            }
+        }
+    }
+}
+
+template<typename T,typename S>
+void Axpbypcz
+( S alphaS, const ElementalMatrix<T>& X,
+  S betaS,  const ElementalMatrix<T>& Y,
+  S gammaS,       ElementalMatrix<T>& Z )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( X, Y, Z ))
+    const bool XAligned = ( X.DistData() == Z.DistData() );
+    const bool YAligned = ( Y.DistData() == Z.DistData() );
+    if( XAligned && YAligned )
+    {
+        Axpbypcz
+        ( alphaS, X.LockedMatrix(), betaS, Y.LockedMatrix(),
+          gammaS, Z.Matrix() );
+    }
+    else
+    {
+        unique_ptr<ElementalMatrix<T>> XCopy, YCopy;
+        if( !XAligned )
+        {
+            XCopy.reset( Z.Construct(Z.Grid(),Z.Root()) );
+            XCopy->AlignWith( Z.DistData() );
+            Copy( X, *XCopy );
+        }
+        if( !YAligned )
+        {
+            YCopy.reset( Z.Construct(Z.Grid(),Z.Root()) );
+            YCopy->AlignWith( Z.DistData() );
+            Copy( Y, *YCopy );
+        }
+        Axpbypcz
+        ( alphaS, ( XAligned ? X.LockedMatrix() : XCopy->LockedMatrix() ),
+          betaS,  ( YAligned ? Y.LockedMatrix() : YCopy->LockedMatrix() ),
+          gammaS, Z.Matrix() );
+    }
+}
+
+template<typename T,typename S>
+void Axpbypcz
+( S alphaS, const DistMultiVec<T>& X,
+  S betaS,  const DistMultiVec<T>& Y,
+  S gammaS,       DistMultiVec<T>& Z )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !mpi::Congruent( X.Grid().Comm(), Z.Grid().Comm() ) ||
+          !mpi::Congruent( Y.Grid().Comm(), Z.Grid().Comm() ) )
+          LogicError("X, Y, and Z must have congruent communicators");
+    )
+    Axpbypcz
+    ( alphaS, X.LockedMatrix(), betaS, Y.LockedMatrix(), gammaS, Z.Matrix() );
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template void Axpby \
+  ( T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ); \
+  EL_EXTERN template void Axpby \
+  ( T alpha, const ElementalMatrix<T>& X, T beta, ElementalMatrix<T>& Y ); \
+  EL_EXTERN template void Axpby \
+  ( T alpha, const DistMultiVec<T>& X, T beta, DistMultiVec<T>& Y ); \
+  EL_EXTERN template void Axpbypcz \
+  ( T alpha, const Matrix<T>& X, \
+    T beta,  const Matrix<T>& Y, \
+    T gamma,       Matrix<T>& Z ); \
+  EL_EXTERN template void Axpbypcz \
+  ( T alpha, const ElementalMatrix<T>& X, \
+    T beta,  const ElementalMatrix<T>& Y, \
+    T gamma,       ElementalMatrix<T>& Z ); \
+  EL_EXTERN template void Axpbypcz \
+  ( T alpha, const DistMultiVec<T>& X, \
+    T beta,  const DistMultiVec<T>& Y, \
+    T gamma,       DistMultiVec<T>& Z );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_AXPBY_HPP
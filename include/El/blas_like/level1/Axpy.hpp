@@ -41,7 +41,7 @@ void Axpy( S alphaS, const Matrix<T>& X, Matrix<T>& Y )
         )
         EL_PARALLEL_FOR
         for( Int i=0; i<XLength; ++i )
-            YBuf[i*YStride] += alpha*XBuf[i*XStride];
+            AddMul( alpha, XBuf[i*XStride], YBuf[i*YStride] );
     }
     else
     {
@@ -51,7 +51,7 @@ void Axpy( S alphaS, const Matrix<T>& X, Matrix<T>& Y )
         {
             EL_PARALLEL_FOR
             for( Int i=0; i<mX*nX; ++i )
-                YBuf[i] += alpha*XBuf[i];
+                AddMul( alpha, XBuf[i], YBuf[i] );
         }
         else
         {
@@ -61,7 +61,7 @@ void Axpy( S alphaS, const Matrix<T>& X, Matrix<T>& Y )
                 EL_SIMD
                 for( Int i=0; i<mX; ++i )
                 {
-                    YBuf[i+j*ldY] += alpha*XBuf[i+j*ldX];
+                    AddMul( alpha, XBuf[i+j*ldX], YBuf[i+j*ldY] );
                 }
             }
         }
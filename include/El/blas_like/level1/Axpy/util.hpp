@@ -27,6 +27,30 @@ void InterleaveMatrixUpdate
           &B[rowStrideB*j], colStrideB );
 }
 
+// For the common precisions, dispatch to the runtime CPU-feature-selected
+// kernels (see core/CpuFeatures.hpp); the per-column runs are typically too
+// short to amortize a BLAS call
+inline void InterleaveMatrixUpdate
+( float alpha, Int height, Int width,
+  const float* A, Int colStrideA, Int rowStrideA,
+        float* B, Int colStrideB, Int rowStrideB )
+{
+    for( Int j=0; j<width; ++j )
+        simd::StridedAxpy
+        ( alpha, &A[rowStrideA*j], colStrideA,
+          &B[rowStrideB*j], colStrideB, height );
+}
+inline void InterleaveMatrixUpdate
+( double alpha, Int height, Int width,
+  const double* A, Int colStrideA, Int rowStrideA,
+        double* B, Int colStrideB, Int rowStrideB )
+{
+    for( Int j=0; j<width; ++j )
+        simd::StridedAxpy
+        ( alpha, &A[rowStrideA*j], colStrideA,
+          &B[rowStrideB*j], colStrideB, height );
+}
+
 template<typename T>
 void UpdateWithLocalData
 ( T alpha, const ElementalMatrix<T>& A, DistMatrix<T,STAR,STAR>& B )
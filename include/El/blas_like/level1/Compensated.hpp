@@ -0,0 +1,233 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COMPENSATED_HPP
+#define EL_BLAS_COMPENSATED_HPP
+
+// Compensated kernels built on error-free transformations: TwoSum is
+// Knuth's branch-free six-flop summation, TwoProd uses a Veltkamp split
+// (with the splitter derived from the mantissa length, so that the
+// transformations remain exact for any of the supported real types), and
+// the dot/Gemv/residual drivers accumulate in the style of Ogita, Rump,
+// and Oishi's Dot2. The results are as accurate as if the accumulations
+// had been performed in twice the working precision, at roughly two to
+// three times the cost of a naive loop -- far cheaper than promoting an
+// entire solve to software quad arithmetic -- which makes them natural
+// residual kernels for iterative refinement of ill-conditioned systems.
+
+namespace El {
+
+// s + err = a + b exactly, with s = fl(a+b)
+template<typename Real>
+void TwoSum( Real a, Real b, Real& s, Real& err )
+{
+    s = a + b;
+    const Real bVirtual = s - a;
+    const Real aVirtual = s - bVirtual;
+    err = (a-aVirtual) + (b-bVirtual);
+}
+
+template<typename Real>
+void TwoSum
+( const Complex<Real>& a,
+  const Complex<Real>& b,
+        Complex<Real>& s,
+        Complex<Real>& err )
+{
+    Real sReal, sImag, errReal, errImag;
+    TwoSum( a.real(), b.real(), sReal, errReal );
+    TwoSum( a.imag(), b.imag(), sImag, errImag );
+    s = Complex<Real>(sReal,sImag);
+    err = Complex<Real>(errReal,errImag);
+}
+
+// p + err = a*b exactly, with p = fl(a*b)
+template<typename Real>
+void TwoProd( Real a, Real b, Real& p, Real& err )
+{
+    p = a*b;
+    // Veltkamp split of both factors
+    const Int half = (NumMantissaBits<Real>()+1)/2;
+    const Real splitter =
+      ( half < 62 ? Real(double(1LL<<half))
+                  : Pow(Real(2),Real(half)) ) + Real(1);
+    const Real aScaled = splitter*a;
+    const Real aHi = aScaled - (aScaled-a);
+    const Real aLo = a - aHi;
+    const Real bScaled = splitter*b;
+    const Real bHi = bScaled - (bScaled-b);
+    const Real bLo = b - bHi;
+    err = ((aHi*bHi-p) + aHi*bLo + aLo*bHi) + aLo*bLo;
+}
+
+// The error term of a complex product is itself accumulated in the working
+// precision, which suffices for doubled-precision accumulation
+template<typename Real>
+void TwoProd
+( const Complex<Real>& a,
+  const Complex<Real>& b,
+        Complex<Real>& p,
+        Complex<Real>& err )
+{
+    Real p1, p2, p3, p4, e1, e2, e3, e4, sReal, sImag, eReal, eImag;
+    TwoProd( a.real(), b.real(), p1, e1 );
+    TwoProd( a.imag(), b.imag(), p2, e2 );
+    TwoSum( p1, -p2, sReal, eReal );
+    TwoProd( a.real(), b.imag(), p3, e3 );
+    TwoProd( a.imag(), b.real(), p4, e4 );
+    TwoSum( p3, p4, sImag, eImag );
+    p = Complex<Real>(sReal,sImag);
+    err = Complex<Real>((e1-e2)+eReal,(e3+e4)+eImag);
+}
+
+// Compute sum_{i,j} conj(A(i,j)) B(i,j) as if in doubled precision
+template<typename Field>
+Field CompensatedDot( const Matrix<Field>& A, const Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("Matrices must be the same size");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Field s=0, c=0, p, errProd, errSum;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            TwoProd( Conj(A(i,j)), B(i,j), p, errProd );
+            TwoSum( s, p, s, errSum );
+            c += errProd + errSum;
+        }
+    }
+    return s + c;
+}
+
+// Overwrite y := alpha op(A) x + beta y with each entry of op(A) x
+// accumulated in doubled precision and rounded once at the end
+template<typename Field>
+void CompensatedGemv
+( Orientation orientation,
+  Field alpha,
+  const Matrix<Field>& A,
+  const Matrix<Field>& x,
+  Field beta,
+        Matrix<Field>& y )
+{
+    EL_DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    const Int yHeight = ( normal ? A.Height() : A.Width() );
+    const Int innerLength = ( normal ? A.Width() : A.Height() );
+    if( x.Height() != innerLength || x.Width() != 1 )
+        LogicError("x was the wrong size");
+    if( y.Height() != yHeight || y.Width() != 1 )
+        LogicError("y was the wrong size");
+    const bool conjugate = ( orientation == ADJOINT );
+    Field s, c, p, q, t, errProd, errSum;
+    for( Int i=0; i<yHeight; ++i )
+    {
+        s = 0;
+        c = 0;
+        for( Int k=0; k<innerLength; ++k )
+        {
+            Field entry = ( normal ? A(i,k) : A(k,i) );
+            if( conjugate )
+                entry = Conj(entry);
+            TwoProd( entry, x(k), p, errProd );
+            TwoSum( s, p, s, errSum );
+            c += errProd + errSum;
+        }
+        // y(i) := alpha*(s+c) + beta*y(i)
+        TwoProd( alpha, s, p, errProd );
+        c = alpha*c + errProd;
+        TwoProd( beta, y(i), q, errProd );
+        c += errProd;
+        TwoSum( p, q, t, errSum );
+        y(i) = t + (c+errSum);
+    }
+}
+
+// Overwrite R := B - A X with each entry accumulated in doubled precision
+template<typename Field>
+void CompensatedResidual
+( const Matrix<Field>& B,
+  const Matrix<Field>& A,
+  const Matrix<Field>& X,
+        Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numRHS = B.Width();
+    if( X.Height() != n || X.Width() != numRHS || B.Height() != m )
+        LogicError("Nonconformal residual");
+    R.Resize( m, numRHS );
+    Field p, errProd, errSum;
+    vector<Field> s( m ), c( m );
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            s[i] = B(i,j);
+            c[i] = 0;
+        }
+        for( Int l=0; l<n; ++l )
+        {
+            const Field xVal = X(l,j);
+            for( Int i=0; i<m; ++i )
+            {
+                TwoProd( A(i,l), xVal, p, errProd );
+                TwoSum( s[i], -p, s[i], errSum );
+                c[i] += errSum - errProd;
+            }
+        }
+        for( Int i=0; i<m; ++i )
+            R(i,j) = s[i] + c[i];
+    }
+}
+
+template<typename Field>
+void CompensatedResidual
+( const Matrix<Field>& B,
+  const SparseMatrix<Field>& A,
+  const Matrix<Field>& X,
+        Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numRHS = B.Width();
+    if( X.Height() != n || X.Width() != numRHS || B.Height() != m )
+        LogicError("Nonconformal residual");
+    R.Resize( m, numRHS );
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const Field* valueBuf = A.LockedValueBuffer();
+    Field s, c, p, errProd, errSum;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            s = B(i,j);
+            c = 0;
+            const Int rowOff = offsetBuf[i];
+            const Int numConn = offsetBuf[i+1] - rowOff;
+            for( Int e=0; e<numConn; ++e )
+            {
+                TwoProd( valueBuf[rowOff+e], X(targetBuf[rowOff+e],j),
+                         p, errProd );
+                TwoSum( s, -p, s, errSum );
+                c += errSum - errProd;
+            }
+            R(i,j) = s + c;
+        }
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COMPENSATED_HPP
@@ -10,6 +10,7 @@
 #define EL_BLAS_COPY_HPP
 
 #include <El/blas_like/level1/Copy/internal_decl.hpp>
+#include <El/blas_like/level1/Copy/BlockCyclic.hpp>
 #include <El/blas_like/level1/Copy/GeneralPurpose.hpp>
 #include <El/blas_like/level1/Copy/util.hpp>
 
@@ -55,6 +56,16 @@ void Copy( const Matrix<T>& A, Matrix<T>& B )
 
 }
 
+// An rvalue source donates its buffer rather than being copied entry-wise
+// (the move assignment safely degrades to a deep copy when either side is
+// a view)
+template<typename T>
+void Copy( Matrix<T>&& A, Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    B = std::move(A);
+}
+
 template<typename S,typename T,
          typename/*=EnableIf<CanCast<S,T>>*/>
 void Copy( const Matrix<S>& A, Matrix<T>& B )
@@ -168,12 +179,34 @@ void Copy( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
         auto& BCast = static_cast<BlockMatrix<T>&>(B);
         Copy( ACast, BCast );
     }
+    else if( A.Grid() == B.Grid() &&
+             A.ColDist() == MC && A.RowDist() == MR &&
+             B.ColDist() == MC && B.RowDist() == MR )
+    {
+        // Both wraps are 2D block-cyclic over the same grid (the elemental
+        // wrap with unit block size), so the conversion can be performed in
+        // bulk rather than entry-wise
+        copy::BlockCyclic( A, B );
+    }
     else
     {
         copy::GeneralPurpose( A, B );
     }
 }
 
+// An rvalue source with a matching distribution donates its buffer (and its
+// alignments) rather than being redistributed; mismatched distributions fall
+// back to the usual deep copy
+template<typename T>
+void Copy( AbstractDistMatrix<T>&& A, AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    if( A.DistData() == B.DistData() )
+        B = std::move(A);
+    else
+        Copy( static_cast<const AbstractDistMatrix<T>&>(A), B );
+}
+
 template<typename S,typename T,
          typename/*=EnableIf<CanCast<S,T>>*/>
 void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B )
@@ -549,7 +582,11 @@ void CopyFromNonRoot( const DistMultiVec<T>& XDist, int root )
   EL_EXTERN template void Copy \
   ( const Matrix<T>& A, Matrix<T>& B ); \
   EL_EXTERN template void Copy \
+  ( Matrix<T>&& A, Matrix<T>& B ); \
+  EL_EXTERN template void Copy \
   ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
+  EL_EXTERN template void Copy \
+  ( AbstractDistMatrix<T>&& A, AbstractDistMatrix<T>& B ); \
   EL_EXTERN template void CopyFromRoot \
   ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B, bool includingViewers ); \
   EL_EXTERN template void CopyFromNonRoot \
@@ -0,0 +1,166 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_BLOCKCYCLIC_HPP
+#define EL_BLAS_COPY_BLOCKCYCLIC_HPP
+
+namespace El {
+namespace copy {
+
+// Convert between two [MC,MR] matrices over the same grid whose block sizes
+// disagree, e.g., between an elemental matrix and the block-cyclic wrapper
+// demanded by a ScaLAPACK descriptor. Both layouts are 2D block-cyclic over
+// the same process grid (the elemental case is simply the unit block size),
+// and so every process can compute the entire communication pattern locally:
+// the entries are packed into contiguous column runs, exchanged with a single
+// AllToAll, and unpacked with the mirrored traversal. No indices are
+// transmitted, as the receiver regenerates the deterministic packing order.
+template<typename T>
+void BlockCyclic
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Grid() != B.Grid() )
+          LogicError("A and B must be distributed over the same grid");
+      if( A.ColDist() != MC || A.RowDist() != MR ||
+          B.ColDist() != MC || B.RowDist() != MR )
+          LogicError("BlockCyclic requires [MC,MR] distributions");
+    )
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Grid& g = A.Grid();
+    B.Resize( height, width );
+    if( !g.InGrid() )
+        return;
+
+    // When the block sizes, alignments, and cuts already agree, the two
+    // layouts coincide and the "conversion" is a purely local copy (this is
+    // what allows an aligned matrix to be reinterpreted in place)
+    if( A.BlockHeight() == B.BlockHeight() &&
+        A.BlockWidth() == B.BlockWidth() &&
+        A.ColAlign() == B.ColAlign() && A.RowAlign() == B.RowAlign() &&
+        A.ColCut() == B.ColCut() && A.RowCut() == B.RowCut() )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return;
+    }
+
+    mpi::Comm comm = g.VCComm();
+    const int commSize = mpi::Size( comm );
+    const int colStride = B.ColStride();
+    const int rowStride = B.RowStride();
+    const int distSize = colStride*rowStride;
+
+    // Translate the (row,col) owner coordinates of each distribution into
+    // ranks in the VC communicator
+    vector<int> distAToVC(distSize), distBToVC(distSize);
+    for( int distRank=0; distRank<distSize; ++distRank )
+    {
+        distAToVC[distRank] =
+          g.CoordsToVC( A.ColDist(), A.RowDist(), distRank, A.Root(), 0 );
+        distBToVC[distRank] =
+          g.CoordsToVC( B.ColDist(), B.RowDist(), distRank, B.Root(), 0 );
+    }
+
+    // Compute the destination coordinates of our local rows and columns
+    const Int localHeightA = A.LocalHeight();
+    const Int localWidthA = A.LocalWidth();
+    vector<int> ownerRows(localHeightA), ownerCols(localWidthA);
+    vector<int> rowCounts(colStride,0);
+    for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
+    {
+        ownerRows[iLoc] = B.RowOwner( A.GlobalRow(iLoc) );
+        ++rowCounts[ownerRows[iLoc]];
+    }
+    for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
+        ownerCols[jLoc] = B.ColOwner( A.GlobalCol(jLoc) );
+
+    vector<int> sendCounts(commSize,0);
+    for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
+        for( int row=0; row<colStride; ++row )
+            sendCounts[distBToVC[row+colStride*ownerCols[jLoc]]] +=
+              rowCounts[row];
+
+    // Pack the data one contiguous row run at a time
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<T> sendBuf;
+    FastResize( sendBuf, totalSend );
+    auto& ALoc = A.LockedMatrix();
+    auto offs = sendOffs;
+    for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
+    {
+        const int ownerCol = ownerCols[jLoc];
+        for( Int iLoc=0; iLoc<localHeightA; )
+        {
+            const int ownerRow = ownerRows[iLoc];
+            Int runEnd = iLoc+1;
+            while( runEnd < localHeightA && ownerRows[runEnd] == ownerRow )
+                ++runEnd;
+            const int owner = distBToVC[ownerRow+colStride*ownerCol];
+            MemCopy( &sendBuf[offs[owner]], &ALoc(iLoc,jLoc), runEnd-iLoc );
+            offs[owner] += runEnd-iLoc;
+            iLoc = runEnd;
+        }
+    }
+
+    // Compute the source coordinates of the local rows and columns of B
+    // (which also determines the receive counts without any communication)
+    const Int localHeightB = B.LocalHeight();
+    const Int localWidthB = B.LocalWidth();
+    vector<int> srcRows(localHeightB), srcCols(localWidthB);
+    vector<int> srcRowCounts(colStride,0);
+    for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+    {
+        srcRows[iLoc] = A.RowOwner( B.GlobalRow(iLoc) );
+        ++srcRowCounts[srcRows[iLoc]];
+    }
+    for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
+        srcCols[jLoc] = A.ColOwner( B.GlobalCol(jLoc) );
+    vector<int> recvCounts(commSize,0);
+    for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
+        for( int row=0; row<colStride; ++row )
+            recvCounts[distAToVC[row+colStride*srcCols[jLoc]]] +=
+              srcRowCounts[row];
+
+    // Exchange the data
+    vector<int> recvOffs;
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    vector<T> recvBuf;
+    FastResize( recvBuf, totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+    SwapClear( sendBuf );
+
+    // Unpack with the traversal which mirrors the senders' packing order
+    auto& BLoc = B.Matrix();
+    offs = recvOffs;
+    for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
+    {
+        const int srcCol = srcCols[jLoc];
+        for( Int iLoc=0; iLoc<localHeightB; )
+        {
+            const int srcRow = srcRows[iLoc];
+            Int runEnd = iLoc+1;
+            while( runEnd < localHeightB && srcRows[runEnd] == srcRow )
+                ++runEnd;
+            const int owner = distAToVC[srcRow+colStride*srcCol];
+            MemCopy( &BLoc(iLoc,jLoc), &recvBuf[offs[owner]], runEnd-iLoc );
+            offs[owner] += runEnd-iLoc;
+            iLoc = runEnd;
+        }
+    }
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_BLOCKCYCLIC_HPP
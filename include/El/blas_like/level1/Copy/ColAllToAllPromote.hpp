@@ -33,9 +33,23 @@ void ColAllToAllPromote
     const Int colRankPart = A.PartialColRank();
     const Int colDiff = B.ColAlign() - Mod(A.ColAlign(),colStridePart);
 
-    const Int maxLocalHeight = MaxLength(height,colStride);
-    const Int maxLocalWidth = MaxLength(width,colStrideUnion);
-    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    RedistPlan* plan = FetchRedistPlan( MakeRedistPlanKey(A,B) );
+    Int portionSize;
+    if( plan != nullptr && plan->haveMeta )
+    {
+        portionSize = plan->portionSize;
+    }
+    else
+    {
+        const Int maxLocalHeight = MaxLength(height,colStride);
+        const Int maxLocalWidth = MaxLength(width,colStrideUnion);
+        portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+        if( plan != nullptr )
+        {
+            plan->portionSize = portionSize;
+            plan->haveMeta = true;
+        }
+    }
 
     if( colDiff == 0 )
     {
@@ -46,9 +60,17 @@ void ColAllToAllPromote
         else
         {
             vector<T> buffer;
-            FastResize( buffer, 2*colStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[colStrideUnion*portionSize];
+            T* firstBuf;
+            if( plan != nullptr )
+            {
+                firstBuf = plan->Scratch<T>( 2*colStrideUnion*portionSize );
+            }
+            else
+            {
+                FastResize( buffer, 2*colStrideUnion*portionSize );
+                firstBuf = &buffer[0];
+            }
+            T* secondBuf = firstBuf + colStrideUnion*portionSize;
 
             // Pack
             util::RowStridedPack
@@ -82,9 +104,17 @@ void ColAllToAllPromote
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
         vector<T> buffer;
-        FastResize( buffer, 2*colStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[colStrideUnion*portionSize];
+        T* firstBuf;
+        if( plan != nullptr )
+        {
+            firstBuf = plan->Scratch<T>( 2*colStrideUnion*portionSize );
+        }
+        else
+        {
+            FastResize( buffer, 2*colStrideUnion*portionSize );
+            firstBuf = &buffer[0];
+        }
+        T* secondBuf = firstBuf + colStrideUnion*portionSize;
 
         // Pack
         util::RowStridedPack
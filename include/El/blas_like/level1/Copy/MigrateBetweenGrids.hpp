@@ -0,0 +1,288 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_MIGRATEBETWEENGRIDS_HPP
+#define EL_BLAS_COPY_MIGRATEBETWEENGRIDS_HPP
+
+namespace El {
+namespace copy {
+
+// Grid-to-grid migration
+// ======================
+// Migrates an [MC,MR] matrix between two grids over overlapping viewing
+// communicators, e.g., when an elastically scheduled job grows or shrinks
+// its process allotment mid-run. The schedule is derived once into a
+// GridMigrationPlan, which classifies every piece of the exchange; pieces
+// whose owner is unchanged between the two distributions are moved with a
+// local strided copy and never touch MPI, so that migrations between
+// compatible grid shapes (matching strides and alignments in either
+// dimension) cost only the data which genuinely changes hands. The MPI
+// rounds replay the schedule of copy::TranslateBetweenGrids, which remains
+// the fallback for distributions without a specialized migration.
+
+template<typename T>
+GridMigrationPlan MakeGridMigrationPlan
+( const DistMatrix<T,MC,MR>& A,
+  const DistMatrix<T,MC,MR>& B )
+{
+    EL_DEBUG_CSE
+    GridMigrationPlan plan;
+    plan.height = A.Height();
+    plan.width = A.Width();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int mLocA = A.LocalHeight();
+    const Int nLocA = A.LocalWidth();
+    mpi::Comm viewingCommB = B.Grid().ViewingComm();
+    mpi::Group owningGroupA = A.Grid().OwningGroup();
+
+    const Int colStride = B.ColStride();
+    const Int rowStride = B.RowStride();
+    const Int colShiftB = B.ColShift();
+    const Int rowShiftB = B.RowShift();
+    const Int colRank = B.ColRank();
+    const Int rowRank = B.RowRank();
+    const Int colRankA = A.ColRank();
+    const Int rowRankA = A.RowRank();
+    const Int colStrideA = A.ColStride();
+    const Int rowStrideA = A.RowStride();
+    const Int colGCD = GCD( colStride, colStrideA );
+    const Int rowGCD = GCD( rowStride, rowStrideA );
+    const Int colLCM = colStride*colStrideA / colGCD;
+    const Int rowLCM = rowStride*rowStrideA / rowGCD;
+    const Int numColSends = colStride / colGCD;
+    const Int numRowSends = rowStride / rowGCD;
+
+    const Int colAlignA = A.ColAlign();
+    const Int rowAlignA = A.RowAlign();
+    const Int colAlignB = B.ColAlign();
+    const Int rowAlignB = B.RowAlign();
+
+    const bool inAGrid = A.Participating();
+    const bool inBGrid = B.Participating();
+    plan.numRounds = numColSends*numRowSends;
+    if( !inAGrid && !inBGrid )
+        return plan;
+
+    // Translate the ranks of A's owning group into B's viewing communicator
+    // exactly as in TranslateBetweenGrids, so that the send and receive
+    // schedules name the same peers
+    const int sizeA = A.Grid().Size();
+    vector<int> rankMap(sizeA), ranks(sizeA);
+    if( A.Grid().Order() == COLUMN_MAJOR )
+    {
+        for( int j=0; j<sizeA; ++j )
+            ranks[j] = j;
+    }
+    else
+    {
+        for( int i=0; i<colStrideA; ++i )
+            for( int j=0; j<rowStrideA; ++j )
+                ranks[i+j*colStrideA] = j+i*rowStrideA;
+    }
+    mpi::Translate
+    ( owningGroupA, sizeA, ranks.data(), viewingCommB, rankMap.data() );
+
+    const int viewingRank = mpi::Rank( viewingCommB );
+
+    Int recvRow = 0;
+    if( inAGrid )
+        recvRow = Mod(Mod(colRankA-colAlignA,colStrideA)+colAlignB,colStride);
+    Int round = 0;
+    for( Int colSend=0; colSend<numColSends; ++colSend )
+    {
+        Int recvCol = 0;
+        if( inAGrid )
+            recvCol=Mod(Mod(rowRankA-rowAlignA,rowStrideA)+rowAlignB,rowStride);
+        for( Int rowSend=0; rowSend<numRowSends; ++rowSend, ++round )
+        {
+            if( inAGrid )
+            {
+                GridMigrationPlan::Piece send;
+                send.round = round;
+                send.height = Length(mLocA,colSend,numColSends);
+                send.width = Length(nLocA,rowSend,numRowSends);
+                send.colOffset = colSend;
+                send.rowOffset = rowSend;
+                send.colStride = numColSends;
+                send.rowStride = numRowSends;
+                const Int recvVCRank = recvRow + recvCol*colStride;
+                send.rank = B.Grid().VCToViewing( recvVCRank );
+                send.local = ( send.rank == viewingRank );
+                plan.maxPieceSize =
+                  Max( plan.maxPieceSize, send.height*send.width );
+                plan.sends.push_back( send );
+            }
+            if( inBGrid )
+            {
+                const Int sendColOffset = colAlignA;
+                const Int recvColOffset =
+                  Mod(colSend*colStrideA+colAlignB,colStride);
+                const Int sendRowOffset = rowAlignA;
+                const Int recvRowOffset =
+                  Mod(rowSend*rowStrideA+rowAlignB,rowStride);
+
+                const Int colShift = Mod( colRank-recvColOffset, colStride );
+                const Int rowShift = Mod( rowRank-recvRowOffset, rowStride );
+
+                const Int firstSendRow = Mod(colShift+sendColOffset,colStrideA);
+                const Int firstSendCol = Mod(rowShift+sendRowOffset,rowStrideA);
+
+                const Int numColRecvs = Length(colStrideA,colShift,colStride);
+                const Int numRowRecvs = Length(rowStrideA,rowShift,rowStride);
+
+                Int sendRow = firstSendRow;
+                for( Int colRecv=0; colRecv<numColRecvs; ++colRecv )
+                {
+                    const Int sendColShift =
+                      Shift( sendRow, colAlignA, colStrideA ) +
+                      colSend*colStrideA;
+                    const Int sendHeight = Length( m, sendColShift, colLCM );
+                    const Int localColOffset =
+                      (sendColShift-colShiftB) / colStride;
+
+                    Int sendCol = firstSendCol;
+                    for( Int rowRecv=0; rowRecv<numRowRecvs; ++rowRecv )
+                    {
+                        const Int sendRowShift =
+                          Shift( sendCol, rowAlignA, rowStrideA ) +
+                          rowSend*rowStrideA;
+                        const Int sendWidth = Length( n, sendRowShift, rowLCM );
+                        const Int localRowOffset =
+                          (sendRowShift-rowShiftB) / rowStride;
+
+                        const Int sendVCRank = sendRow+sendCol*colStrideA;
+
+                        GridMigrationPlan::Piece recv;
+                        recv.round = round;
+                        recv.rank = rankMap[sendVCRank];
+                        recv.local = ( recv.rank == viewingRank );
+                        recv.height = sendHeight;
+                        recv.width = sendWidth;
+                        recv.colOffset = localColOffset;
+                        recv.rowOffset = localRowOffset;
+                        recv.colStride = colLCM/colStride;
+                        recv.rowStride = rowLCM/rowStride;
+                        plan.maxPieceSize =
+                          Max( plan.maxPieceSize, sendHeight*sendWidth );
+                        plan.recvs.push_back( recv );
+
+                        sendCol = Mod(sendCol+rowStride,rowStrideA);
+                    }
+                    sendRow = Mod(sendRow+colStride,colStrideA);
+                }
+            }
+            if( inAGrid )
+                recvCol = Mod(recvCol+rowStrideA,rowStride);
+        }
+        if( inAGrid )
+            recvRow = Mod(recvRow+colStrideA,colStride);
+    }
+    return plan;
+}
+
+template<typename T>
+void MigrateBetweenGrids
+( const DistMatrix<T,MC,MR>& A,
+        DistMatrix<T,MC,MR>& B,
+  const GridMigrationPlan& plan )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != plan.height || A.Width() != plan.width )
+          LogicError("Migration plan was derived for different dimensions");
+    )
+    B.Resize( plan.height, plan.width );
+    mpi::Comm viewingCommB = B.Grid().ViewingComm();
+
+    // Pieces which stay on this process move with a strided local copy; the
+    // matching send entry of the same round supplies the pack geometry
+    for( const auto& recv : plan.recvs )
+    {
+        if( !recv.local )
+            continue;
+        const auto& send = plan.sends[recv.round];
+        copy::util::InterleaveMatrix
+        ( recv.height, recv.width,
+          A.LockedBuffer(send.colOffset,send.rowOffset),
+          send.colStride, send.rowStride*A.LDim(),
+          B.Buffer(recv.colOffset,recv.rowOffset),
+          recv.colStride, recv.rowStride*B.LDim() );
+    }
+
+    vector<T> auxBuf;
+    FastResize( auxBuf, 2*plan.maxPieceSize );
+    T* sendBuf = auxBuf.data();
+    T* recvBuf = auxBuf.data() + plan.maxPieceSize;
+
+    // Replay the remaining rounds of the TranslateBetweenGrids schedule,
+    // with the local pieces excised from both sides
+    Int recvIdx = 0;
+    for( Int round=0; round<plan.numRounds; ++round )
+    {
+        mpi::Request<T> sendRequest;
+        bool sendInFlight = false;
+        if( round < Int(plan.sends.size()) )
+        {
+            const auto& send = plan.sends[round];
+            if( !send.local )
+            {
+                copy::util::InterleaveMatrix
+                ( send.height, send.width,
+                  A.LockedBuffer(send.colOffset,send.rowOffset),
+                  send.colStride, send.rowStride*A.LDim(),
+                  sendBuf, 1, send.height );
+                mpi::ISend
+                ( sendBuf, send.height*send.width, send.rank,
+                  viewingCommB, sendRequest );
+                sendInFlight = true;
+            }
+        }
+        for( ; recvIdx<Int(plan.recvs.size()) &&
+               plan.recvs[recvIdx].round == round; ++recvIdx )
+        {
+            const auto& recv = plan.recvs[recvIdx];
+            if( recv.local )
+                continue;
+            mpi::Recv
+            ( recvBuf, recv.height*recv.width, recv.rank, viewingCommB );
+            copy::util::InterleaveMatrix
+            ( recv.height, recv.width,
+              recvBuf, 1, recv.height,
+              B.Buffer(recv.colOffset,recv.rowOffset),
+              recv.colStride, recv.rowStride*B.LDim() );
+        }
+        if( sendInFlight )
+            mpi::Wait( sendRequest );
+    }
+}
+
+template<typename T>
+void MigrateBetweenGrids
+( const DistMatrix<T,MC,MR>& A,
+        DistMatrix<T,MC,MR>& B )
+{
+    EL_DEBUG_CSE
+    const GridMigrationPlan plan = MakeGridMigrationPlan( A, B );
+    MigrateBetweenGrids( A, B, plan );
+}
+
+template<typename T,Dist U,Dist V>
+void MigrateBetweenGrids
+( const DistMatrix<T,U,V>& A,
+        DistMatrix<T,U,V>& B )
+{
+    EL_DEBUG_CSE
+    TranslateBetweenGrids( A, B );
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_MIGRATEBETWEENGRIDS_HPP
@@ -0,0 +1,92 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_PLANCACHE_HPP
+#define EL_BLAS_COPY_PLANCACHE_HPP
+
+#include <tuple>
+
+namespace El {
+namespace copy {
+
+// Redistribution-plan cache
+// =========================
+// Iterative solvers tend to redistribute identically-shaped and -aligned
+// matrices over the same grid many times; the packing metadata and the
+// exchange buffer for such a copy are identical on every repetition. When
+// the cache is enabled, redistribution kernels fetch a plan keyed on the
+// full (distribution, shape, alignment, grid) signature and replay its
+// metadata and scratch storage rather than rederiving and reallocating.
+
+struct RedistPlanKey
+{
+    int distA, distB; // packed (colDist,rowDist) pairs
+    Int height, width;
+    int colAlignA, rowAlignA, colAlignB, rowAlignB;
+    const void* grid;
+    size_t wordSize;
+
+    bool operator<( const RedistPlanKey& key ) const
+    {
+        return std::tie(distA,distB,height,width,
+                        colAlignA,rowAlignA,colAlignB,rowAlignB,
+                        grid,wordSize) <
+               std::tie(key.distA,key.distB,key.height,key.width,
+                        key.colAlignA,key.rowAlignA,
+                        key.colAlignB,key.rowAlignB,
+                        key.grid,key.wordSize);
+    }
+};
+
+struct RedistPlan
+{
+    bool haveMeta=false;
+    Int portionSize=0;
+    vector<byte> scratch;
+
+    // Persistent pack/exchange workspace (grows monotonically per plan)
+    template<typename T>
+    T* Scratch( size_t numEntries )
+    {
+        if( scratch.size() < numEntries*sizeof(T) )
+            scratch.resize( numEntries*sizeof(T) );
+        return reinterpret_cast<T*>( scratch.data() );
+    }
+};
+
+void EnableRedistPlanCache();
+void DisableRedistPlanCache();
+bool RedistPlanCacheEnabled();
+// Drop the calling thread's cached plans (and their scratch buffers)
+void FlushRedistPlanCache();
+
+// Returns nullptr when the cache is disabled
+RedistPlan* FetchRedistPlan( const RedistPlanKey& key );
+
+template<typename T>
+RedistPlanKey MakeRedistPlanKey
+( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B )
+{
+    RedistPlanKey key;
+    key.distA = int(A.ColDist())*16 + int(A.RowDist());
+    key.distB = int(B.ColDist())*16 + int(B.RowDist());
+    key.height = A.Height();
+    key.width = A.Width();
+    key.colAlignA = A.ColAlign();
+    key.rowAlignA = A.RowAlign();
+    key.colAlignB = B.ColAlign();
+    key.rowAlignB = B.RowAlign();
+    key.grid = &A.Grid();
+    key.wordSize = sizeof(T);
+    return key;
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_PLANCACHE_HPP
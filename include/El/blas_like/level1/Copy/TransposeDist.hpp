@@ -181,28 +181,162 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
     }
     else
     {
-        if( A.Height() >= A.Width() )
+        // Perform the entire redistribution as a single AllToAll over the
+        // vector communicator rather than routing through the product
+        // distributions (e.g., [VC,STAR] and [VR,STAR]), whose chain of
+        // exchanges costs three communication phases and two intermediate
+        // matrices. Each process directly packs, for every peer, the
+        // doubly-strided submatrix of its local data that the peer owns
+        // under the transposed distribution.
+        const Int colStrideB = B.ColStride();
+        const Int rowStrideB = B.RowStride();
+        const Int localHeightA = A.LocalHeight();
+        const Int localWidthA = A.LocalWidth();
+        const Int localHeightB = B.LocalHeight();
+        const Int localWidthB = B.LocalWidth();
+        const T* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
+        T* BBuf = B.Buffer();
+        const Int BLDim = B.LDim();
+
+        // The local indices assigned to a peer under the other distribution
+        // form an arithmetic progression; return the first member (or -1 if
+        // the residues are incompatible). The strides are grid dimensions,
+        // so the scan is trivial.
+        auto firstMatch =
+          [] ( Int myShift, Int myStride, Int peerShift, Int peerStride )
+          {
+              for( Int loc=0; loc<peerStride; ++loc )
+                  if( Mod( myShift+loc*myStride, peerStride ) == peerShift )
+                      return loc;
+              return Int(-1);
+          };
+        auto gcd =
+          [] ( Int a, Int b ) { while( b ) { Int t=Mod(a,b); a=b; b=t; } return a; };
+        const Int commonStride = gcd( colStrideA, rowStrideA );
+        // The within-progression strides of the local row and column indices
+        const Int rowPeriodA = rowStrideA / commonStride;
+        const Int colPeriodA = colStrideA / commonStride;
+
+        // Map each vector-comm rank to its grid position; A and B place
+        // their column distribution over opposite grid dimensions
+        const Int gridHeight = g.Height();
+        auto gridRowOf = [&]( Int q ) { return Mod( q, gridHeight ); };
+        auto gridColOf = [&]( Int q ) { return q / gridHeight; };
+        const bool colMajorA = ( colStrideA == gridHeight );
+
+        // Compute the send counts and pack each peer's submatrix
+        vector<int> sendCounts(distSize,0), sendDispls(distSize,0),
+                    recvCounts(distSize,0), recvDispls(distSize,0);
+        vector<Int> sendRowFirst(distSize,-1), sendColFirst(distSize,-1),
+                    sendHeights(distSize,0),   sendWidths(distSize,0);
+        for( Int q=0; q<distSize; ++q )
+        {
+            const Int peerColRankB =
+              ( colMajorA ? gridColOf(q) : gridRowOf(q) );
+            const Int peerRowRankB =
+              ( colMajorA ? gridRowOf(q) : gridColOf(q) );
+            const Int peerColShiftB =
+              Shift_( peerColRankB, B.ColAlign(), colStrideB );
+            const Int peerRowShiftB =
+              Shift_( peerRowRankB, B.RowAlign(), rowStrideB );
+            const Int rowFirst =
+              firstMatch
+              ( A.ColShift(), colStrideA, peerColShiftB, colStrideB );
+            const Int colFirst =
+              firstMatch
+              ( A.RowShift(), rowStrideA, peerRowShiftB, rowStrideB );
+            if( rowFirst == -1 || colFirst == -1 )
+                continue;
+            const Int sendHeight =
+              Length_( localHeightA, rowFirst, rowPeriodA );
+            const Int sendWidth = Length_( localWidthA, colFirst, colPeriodA );
+            sendRowFirst[q] = rowFirst;
+            sendColFirst[q] = colFirst;
+            sendHeights[q] = sendHeight;
+            sendWidths[q] = sendWidth;
+            sendCounts[q] = int(sendHeight*sendWidth);
+        }
+        Int sendTotal=0, recvTotal=0;
+        for( Int q=0; q<distSize; ++q )
+        {
+            sendDispls[q] = int(sendTotal);
+            sendTotal += sendCounts[q];
+        }
+
+        // Compute the receive counts from the symmetric intersection
+        vector<Int> recvRowFirst(distSize,-1), recvColFirst(distSize,-1),
+                    recvHeights(distSize,0),   recvWidths(distSize,0);
+        for( Int q=0; q<distSize; ++q )
+        {
+            const Int peerColRankA =
+              ( colMajorA ? gridRowOf(q) : gridColOf(q) );
+            const Int peerRowRankA =
+              ( colMajorA ? gridColOf(q) : gridRowOf(q) );
+            const Int peerColShiftA =
+              Shift_( peerColRankA, A.ColAlign(), colStrideA );
+            const Int peerRowShiftA =
+              Shift_( peerRowRankA, A.RowAlign(), rowStrideA );
+            const Int rowFirst =
+              firstMatch
+              ( B.ColShift(), colStrideB, peerColShiftA, colStrideA );
+            const Int colFirst =
+              firstMatch
+              ( B.RowShift(), rowStrideB, peerRowShiftA, rowStrideA );
+            if( rowFirst == -1 || colFirst == -1 )
+                continue;
+            const Int recvHeight =
+              Length_( localHeightB, rowFirst, colPeriodA );
+            const Int recvWidth = Length_( localWidthB, colFirst, rowPeriodA );
+            recvRowFirst[q] = rowFirst;
+            recvColFirst[q] = colFirst;
+            recvHeights[q] = recvHeight;
+            recvWidths[q] = recvWidth;
+            recvCounts[q] = int(recvHeight*recvWidth);
+        }
+        for( Int q=0; q<distSize; ++q )
         {
-            DistMatrix<T,ProductDist<U,V>(),ProductDistPartner<U,V>()>
-              A_ProdDistA( A );
-            DistMatrix<T,ProductDist<V,U>(),ProductDistPartner<V,U>()>
-              A_ProdDistB( g );
-            A_ProdDistB.AlignColsWith( B );
-            A_ProdDistB = A_ProdDistA;
-            A_ProdDistA.Empty();
-            B = A_ProdDistB;
+            recvDispls[q] = int(recvTotal);
+            recvTotal += recvCounts[q];
         }
-        else
+
+        vector<T> buffer;
+        FastResize( buffer, sendTotal+recvTotal );
+        T* sendBuf = &buffer[0];
+        T* recvBuf = &buffer[sendTotal];
+
+        // Pack (merged: each entry is touched exactly once)
+        EL_PARALLEL_FOR
+        for( Int q=0; q<distSize; ++q )
+        {
+            if( sendCounts[q] == 0 )
+                continue;
+            util::InterleaveMatrix
+            ( sendHeights[q], sendWidths[q],
+              &ABuf[sendRowFirst[q]+sendColFirst[q]*ALDim],
+              rowPeriodA, colPeriodA*ALDim,
+              &sendBuf[sendDispls[q]], 1, sendHeights[q] );
+        }
+
+        // The lone communication phase, over whichever of the two vector
+        // communicators is ordered column-major with respect to the grid
+        // (matching the rank enumeration above)
+        mpi::Comm vcComm = ( colMajorA ? A.DistComm() : B.DistComm() );
+        mpi::AllToAll
+        ( sendBuf, sendCounts.data(), sendDispls.data(),
+          recvBuf, recvCounts.data(), recvDispls.data(), vcComm );
+
+        // Unpack
+        EL_PARALLEL_FOR
+        for( Int q=0; q<distSize; ++q )
         {
-            DistMatrix<T,ProductDistPartner<V,U>(),ProductDist<V,U>()>
-                A_ProdDistB( A );
-            DistMatrix<T,ProductDistPartner<U,V>(),ProductDist<U,V>()>
-                A_ProdDistA( g );
-
-            A_ProdDistA.AlignRowsWith( B );
-            A_ProdDistA = A_ProdDistB;
-            A_ProdDistB.Empty();
-            B = A_ProdDistA;
+            if( recvCounts[q] == 0 )
+                continue;
+            util::InterleaveMatrix
+            ( recvHeights[q], recvWidths[q],
+              &recvBuf[recvDispls[q]], 1, recvHeights[q],
+              &BBuf[recvRowFirst[q]+recvColFirst[q]*BLDim],
+              colPeriodA, rowPeriodA*BLDim );
         }
     }
 }
@@ -22,6 +22,14 @@ void GeneralPurpose
 ( const AbstractDistMatrix<T>& A,
         AbstractDistMatrix<T>& B );
 
+// Bulk conversion between two [MC,MR] block-cyclic layouts over the same
+// grid, e.g., between an elemental matrix and a block matrix destined for
+// a ScaLAPACK descriptor
+template<typename T>
+void BlockCyclic
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B );
+
 template<typename T>
 void Exchange
 ( const ElementalMatrix<T>& A,
@@ -45,6 +53,43 @@ template<typename T,Dist U,Dist V>
 void TranslateBetweenGrids
 ( const DistMatrix<T,U,V>& A, DistMatrix<T,U,V>& B );
 
+// A precomputed schedule for migrating an [MC,MR] matrix between two grids
+// over overlapping viewing communicators. Pieces whose owner is unchanged
+// between the two distributions are marked local and are moved with a
+// strided copy rather than through MPI.
+struct GridMigrationPlan
+{
+    struct Piece
+    {
+        int rank=0;    // the peer in the target grid's viewing communicator
+        bool local=false;         // the peer is this process
+        Int round=0;              // the exchange round of this piece
+        Int height=0, width=0;    // the piece extent
+        Int colOffset=0, rowOffset=0; // the pack/unpack origin
+        Int colStride=0, rowStride=0; // the pack/unpack strides
+    };
+
+    Int height=0, width=0;
+    Int numRounds=0;
+    Int maxPieceSize=0;
+    vector<Piece> sends, recvs;
+};
+
+template<typename T>
+GridMigrationPlan MakeGridMigrationPlan
+( const DistMatrix<T,MC,MR>& A, const DistMatrix<T,MC,MR>& B );
+template<typename T>
+void MigrateBetweenGrids
+( const DistMatrix<T,MC,MR>& A, DistMatrix<T,MC,MR>& B,
+  const GridMigrationPlan& plan );
+template<typename T>
+void MigrateBetweenGrids
+( const DistMatrix<T,MC,MR>& A, DistMatrix<T,MC,MR>& B );
+// The fallback case that defers to TranslateBetweenGrids
+template<typename T,Dist U,Dist V>
+void MigrateBetweenGrids
+( const DistMatrix<T,U,V>& A, DistMatrix<T,U,V>& B );
+
 // NOTE: Only instantiated for (U,V)=(MC,MR) and (U,V)=(MR,MC)
 template<typename T,Dist U,Dist V>
 void ColwiseVectorExchange
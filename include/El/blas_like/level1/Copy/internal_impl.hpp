@@ -9,6 +9,8 @@
 #ifndef EL_BLAS1_COPY_INTERNAL_IMPL_HPP
 #define EL_BLAS1_COPY_INTERNAL_IMPL_HPP
 
+#include <El/blas_like/level1/Copy/PlanCache.hpp>
+
 #include <El/blas_like/level1/Copy/AllGather.hpp>
 #include <El/blas_like/level1/Copy/ColAllGather.hpp>
 #include <El/blas_like/level1/Copy/ColAllToAllDemote.hpp>
@@ -28,6 +30,7 @@
 #include <El/blas_like/level1/Copy/RowFilter.hpp>
 #include <El/blas_like/level1/Copy/Scatter.hpp>
 #include <El/blas_like/level1/Copy/TranslateBetweenGrids.hpp>
+#include <El/blas_like/level1/Copy/MigrateBetweenGrids.hpp>
 #include <El/blas_like/level1/Copy/Translate.hpp>
 #include <El/blas_like/level1/Copy/TransposeDist.hpp>
 
@@ -21,7 +21,12 @@ void InterleaveMatrix
 {
     if( colStrideA == 1 && colStrideB == 1 )
     {
-        lapack::Copy( 'F', height, width, A, rowStrideA, B, rowStrideB );
+        // When both sides are a single contiguous run, a memcpy beats the
+        // column-at-a-time copy
+        if( rowStrideA == height && rowStrideB == height )
+            MemCopy( B, A, std::size_t(height)*std::size_t(width) );
+        else
+            lapack::Copy( 'F', height, width, A, rowStrideA, B, rowStrideB );
     }
     else
     {
@@ -46,6 +51,7 @@ void ColStridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<colStride; ++k )
     {
         const Int colShift = Shift_( k, colAlign, colStride );
@@ -65,6 +71,7 @@ void ColStridedColumnPack
   const T* A,
         T* BPortions, Int portionSize )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<colStride; ++k )
     {
         const Int colShift = Shift_( k, colAlign, colStride );
@@ -82,6 +89,7 @@ void ColStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<colStride; ++k )
     {
         const Int colShift = Shift_( k, colAlign, colStride );
@@ -102,6 +110,7 @@ void BlockedColStridedUnpack
         T* B,         Int BLDim )
 {
     const Int firstBlockHeight = blockHeight - colCut;
+    EL_PARALLEL_FOR
     for( Int portion=0; portion<colStride; ++portion )
     {
         const T* APortion = &APortions[portion*portionSize];
@@ -142,6 +151,7 @@ void PartialColStridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<colStrideUnion; ++k )
     {
         const Int colShift =
@@ -164,6 +174,7 @@ void PartialColStridedColumnPack
   const T* A,
         T* BPortions, Int portionSize )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<colStrideUnion; ++k )
     {
         const Int colShift =
@@ -185,6 +196,7 @@ void PartialColStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<colStrideUnion; ++k )
     {
         const Int colShift =
@@ -207,6 +219,7 @@ void PartialColStridedColumnUnpack
   const T* APortions, Int portionSize,
         T* B )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<colStrideUnion; ++k )
     {
         const Int colShift =
@@ -226,6 +239,7 @@ void RowStridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<rowStride; ++k )
     {
         const Int rowShift = Shift_( k, rowAlign, rowStride );
@@ -244,6 +258,7 @@ void RowStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<rowStride; ++k )
     {
         const Int rowShift = Shift_( k, rowAlign, rowStride );
@@ -264,6 +279,7 @@ void BlockedRowStridedUnpack
         T* B,         Int BLDim )
 {
     const Int firstBlockWidth = blockWidth - rowCut;
+    EL_PARALLEL_FOR
     for( Int portion=0; portion<rowStride; ++portion )
     {
         const T* APortion = &APortions[portion*portionSize];
@@ -372,6 +388,7 @@ void PartialRowStridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<rowStrideUnion; ++k )
     {
         const Int rowShift =
@@ -393,6 +410,7 @@ void PartialRowStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
+    EL_PARALLEL_FOR
     for( Int k=0; k<rowStrideUnion; ++k )
     {
         const Int rowShift =
@@ -415,19 +433,21 @@ void StridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize )
 {
-    for( Int l=0; l<rowStride; ++l )
+    // Flatten the two portion loops so that the parallelism covers all
+    // colStride x rowStride packets
+    EL_PARALLEL_FOR
+    for( Int portion=0; portion<colStride*rowStride; ++portion )
     {
+        const Int k = portion % colStride;
+        const Int l = portion / colStride;
+        const Int colShift = Shift_( k, colAlign, colStride );
         const Int rowShift = Shift_( l, rowAlign, rowStride );
+        const Int localHeight = Length_( height, colShift, colStride );
         const Int localWidth = Length_( width, rowShift, rowStride );
-        for( Int k=0; k<colStride; ++k )
-        {
-            const Int colShift = Shift_( k, colAlign, colStride );
-            const Int localHeight = Length_( height, colShift, colStride );
-            InterleaveMatrix
-            ( localHeight, localWidth,
-              &A[colShift+rowShift*ALDim], colStride, rowStride*ALDim,
-              &BPortions[(k+l*colStride)*portionSize], 1, localHeight );
-        }
+        InterleaveMatrix
+        ( localHeight, localWidth,
+          &A[colShift+rowShift*ALDim], colStride, rowStride*ALDim,
+          &BPortions[portion*portionSize], 1, localHeight );
     }
 }
 
@@ -440,19 +460,21 @@ void StridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
-    for( Int l=0; l<rowStride; ++l )
+    // Flatten the two portion loops so that the parallelism covers all
+    // colStride x rowStride packets
+    EL_PARALLEL_FOR
+    for( Int portion=0; portion<colStride*rowStride; ++portion )
     {
+        const Int k = portion % colStride;
+        const Int l = portion / colStride;
+        const Int colShift = Shift_( k, colAlign, colStride );
         const Int rowShift = Shift_( l, rowAlign, rowStride );
+        const Int localHeight = Length_( height, colShift, colStride );
         const Int localWidth = Length_( width, rowShift, rowStride );
-        for( Int k=0; k<colStride; ++k )
-        {
-            const Int colShift = Shift_( k, colAlign, colStride );
-            const Int localHeight = Length_( height, colShift, colStride );
-            InterleaveMatrix
-            ( localHeight, localWidth,
-              &APortions[(k+l*colStride)*portionSize], 1, localHeight,
-              &B[colShift+rowShift*BLDim], colStride, rowStride*BLDim );
-        }
+        InterleaveMatrix
+        ( localHeight, localWidth,
+          &APortions[portion*portionSize], 1, localHeight,
+          &B[colShift+rowShift*BLDim], colStride, rowStride*BLDim );
     }
 }
 
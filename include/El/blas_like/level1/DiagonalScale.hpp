@@ -22,17 +22,31 @@ void DiagonalScale
     const Int m = A.Height();
     const Int n = A.Width();
     const bool conj = ( orientation == ADJOINT );
+    const TDiag* dBuf = d.LockedBuffer();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
     if( side == LEFT )
     {
         EL_DEBUG_ONLY(
           if( d.Height() != m )
               LogicError("Invalid left diagonal scaling dimension");
         )
-        for( Int i=0; i<m; ++i )
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
         {
-            const T delta = ( conj ? Conj(d(i)) : d(i) );
-            for( Int j=0; j<n; ++j )
-                A(i,j) *= delta;
+            T* ACol = &ABuf[j*ALDim];
+            if( conj )
+            {
+                EL_SIMD
+                for( Int i=0; i<m; ++i )
+                    ACol[i] *= T(Conj(dBuf[i]));
+            }
+            else
+            {
+                EL_SIMD
+                for( Int i=0; i<m; ++i )
+                    ACol[i] *= T(dBuf[i]);
+            }
         }
     }
     else
@@ -41,11 +55,14 @@ void DiagonalScale
           if( d.Height() != n )
               LogicError("Invalid right diagonal scaling dimension");
         )
+        EL_PARALLEL_FOR
         for( Int j=0; j<n; ++j )
         {
-            const T delta = ( conj ? Conj(d(j)) : d(j) );
+            const T delta = ( conj ? Conj(dBuf[j]) : dBuf[j] );
+            T* ACol = &ABuf[j*ALDim];
+            EL_SIMD
             for( Int i=0; i<m; ++i )
-                A(i,j) *= delta;
+                ACol[i] *= delta;
         }
     }
 }
@@ -45,7 +45,7 @@ T Dotu( const Matrix<T>& A, const Matrix<T>& B )
     const Int height = A.Height();
     for( Int j=0; j<width; ++j )
         for( Int i=0; i<height; ++i )
-            sum += A(i,j)*B(i,j);
+            AddMul( A(i,j), B(i,j), sum );
     return sum;
 }
 
@@ -73,7 +73,7 @@ T Dotu( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B )
         const Int localWidth = A.LocalWidth();
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
             for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                localInnerProd += ALoc(iLoc,jLoc)*BLoc(iLoc,jLoc);
+                AddMul( ALoc(iLoc,jLoc), BLoc(iLoc,jLoc), localInnerProd );
         innerProd = mpi::AllReduce( localInnerProd, A.DistComm() );
     }
     mpi::Broadcast( innerProd, A.Root(), A.CrossComm() );
@@ -100,7 +100,7 @@ T Dotu( const DistMultiVec<T>& A, const DistMultiVec<T>& B )
     auto& BLoc = B.LockedMatrix();
     for( Int j=0; j<width; ++j )
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            localInnerProd += ALoc(iLoc,j)*BLoc(iLoc,j);
+            AddMul( ALoc(iLoc,j), BLoc(iLoc,j), localInnerProd );
     return mpi::AllReduce( localInnerProd, A.Grid().Comm() );
 }
 
@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_ENTRYWISEKERNEL_HPP
+#define EL_BLAS_ENTRYWISEKERNEL_HPP
+
+namespace El {
+
+// These kernels are elementwise analogues of the level-1 BLAS: the type of
+// the callable is kept as a template parameter rather than being erased
+// behind std::function, so that the compiler can inline it into the loop
+// bodies and vectorize them with whichever instruction set it is targeting.
+// The std::function-based EntrywiseMap interface is routed through them,
+// but performance-sensitive callers should invoke them directly with a
+// lambda or function object.
+
+template<typename T,class UnaryFunc>
+void EntrywiseKernel( T* ABuf, Int m, Int n, Int ALDim, UnaryFunc func )
+{
+    // Iterate over a single loop if memory is contiguous. Otherwise
+    // iterate over a double loop.
+    if( ALDim == m )
+    {
+        const Int size = m*n;
+        EL_PARALLEL_FOR
+        for( Int i=0; i<size; ++i )
+        {
+            ABuf[i] = func(ABuf[i]);
+        }
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
+        {
+            EL_SIMD
+            for( Int i=0; i<m; ++i )
+            {
+                ABuf[i+j*ALDim] = func(ABuf[i+j*ALDim]);
+            }
+        }
+    }
+}
+
+template<typename T,class UnaryFunc>
+void EntrywiseKernel( Matrix<T>& A, UnaryFunc func )
+{
+    EL_DEBUG_CSE
+    EntrywiseKernel( A.Buffer(), A.Height(), A.Width(), A.LDim(), func );
+}
+
+template<typename S,typename T,class UnaryFunc>
+void EntrywiseKernel
+( const S* ABuf, Int m, Int n, Int ALDim,
+        T* BBuf,               Int BLDim,
+  UnaryFunc func )
+{
+    if( ALDim == m && BLDim == m )
+    {
+        const Int size = m*n;
+        EL_PARALLEL_FOR
+        for( Int i=0; i<size; ++i )
+        {
+            BBuf[i] = func(ABuf[i]);
+        }
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
+        {
+            EL_SIMD
+            for( Int i=0; i<m; ++i )
+            {
+                BBuf[i+j*BLDim] = func(ABuf[i+j*ALDim]);
+            }
+        }
+    }
+}
+
+// Apply 'func' to each entry of A and simultaneously accumulate the scaled
+// square of the results (in the same overflow-resistant representation used
+// by FrobeniusNorm), so that callers which need the norm of the transformed
+// matrix -- such as the proximal updates inside ADMM loops -- avoid
+// streaming the data through memory a second time. The caller is expected
+// to initialize (scale,scaledSquare) to (0,1); the result of the norm is
+// then scale*Sqrt(scaledSquare).
+template<typename T,class UnaryFunc>
+void EntrywiseKernelScaledSquare
+( T* ABuf, Int m, Int n, Int ALDim, UnaryFunc func,
+  Base<T>& scale, Base<T>& scaledSquare )
+{
+    typedef Base<T> Real;
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    {
+        Real scaleLoc = 0;
+        Real scaledSquareLoc = 1;
+        if( ALDim == m )
+        {
+            const Int size = m*n;
+            #pragma omp for
+            for( Int i=0; i<size; ++i )
+            {
+                ABuf[i] = func(ABuf[i]);
+                UpdateScaledSquare( ABuf[i], scaleLoc, scaledSquareLoc );
+            }
+        }
+        else
+        {
+            #pragma omp for
+            for( Int j=0; j<n; ++j )
+            {
+                for( Int i=0; i<m; ++i )
+                {
+                    ABuf[i+j*ALDim] = func(ABuf[i+j*ALDim]);
+                    UpdateScaledSquare
+                    ( ABuf[i+j*ALDim], scaleLoc, scaledSquareLoc );
+                }
+            }
+        }
+        #pragma omp critical (EntrywiseKernelScaledSquare)
+        {
+            if( scaleLoc > scale )
+            {
+                const Real relScale = scale/scaleLoc;
+                scaledSquare = scaledSquare*relScale*relScale +
+                  scaledSquareLoc;
+                scale = scaleLoc;
+            }
+            else if( scaleLoc != Real(0) )
+            {
+                const Real relScale = scaleLoc/scale;
+                scaledSquare += scaledSquareLoc*relScale*relScale;
+            }
+        }
+    }
+#else
+    if( ALDim == m )
+    {
+        const Int size = m*n;
+        for( Int i=0; i<size; ++i )
+        {
+            ABuf[i] = func(ABuf[i]);
+            UpdateScaledSquare( ABuf[i], scale, scaledSquare );
+        }
+    }
+    else
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int i=0; i<m; ++i )
+            {
+                ABuf[i+j*ALDim] = func(ABuf[i+j*ALDim]);
+                UpdateScaledSquare( ABuf[i+j*ALDim], scale, scaledSquare );
+            }
+        }
+    }
+#endif
+}
+
+template<typename T,class UnaryFunc>
+void EntrywiseKernelScaledSquare
+( Matrix<T>& A, UnaryFunc func, Base<T>& scale, Base<T>& scaledSquare )
+{
+    EL_DEBUG_CSE
+    EntrywiseKernelScaledSquare
+    ( A.Buffer(), A.Height(), A.Width(), A.LDim(), func,
+      scale, scaledSquare );
+}
+
+template<typename S,typename T,class UnaryFunc>
+void EntrywiseKernel( const Matrix<S>& A, Matrix<T>& B, UnaryFunc func )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    B.Resize( m, n );
+    EntrywiseKernel
+    ( A.LockedBuffer(), m, n, A.LDim(), B.Buffer(), B.LDim(), func );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_ENTRYWISEKERNEL_HPP
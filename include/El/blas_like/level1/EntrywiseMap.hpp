@@ -15,33 +15,7 @@ template<typename T>
 void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
 {
     EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
-    T* ABuf = A.Buffer();
-    const Int ALDim = A.LDim();
-
-    // Iterate over single loop if memory is contiguous. Otherwise
-    // iterate over double loop.
-    if( ALDim == m )
-    {
-        EL_PARALLEL_FOR
-        for( Int i=0; i<m*n; ++i )
-        {
-            ABuf[i] = func(ABuf[i]);
-        }
-    }
-    else
-    {
-        EL_PARALLEL_FOR
-        for( Int j=0; j<n; ++j )
-        {
-            EL_SIMD
-            for( Int i=0; i<m; ++i )
-            {
-                ABuf[i+j*ALDim] = func(ABuf[i+j*ALDim]);
-            }
-        }
-    }
+    EntrywiseKernel( A.Buffer(), A.Height(), A.Width(), A.LDim(), func );
 }
 
 template<typename T>
@@ -82,19 +56,8 @@ void EntrywiseMap
     const Int m = A.Height();
     const Int n = A.Width();
     B.Resize( m, n );
-    const S* ABuf = A.LockedBuffer();
-    T* BBuf = B.Buffer();
-    const Int ALDim = A.LDim();
-    const Int BLDim = B.LDim();
-    EL_PARALLEL_FOR
-    for( Int j=0; j<n; ++j )
-    {
-        EL_SIMD
-        for( Int i=0; i<m; ++i )
-        {
-            BBuf[i+j*BLDim] = func(ABuf[i+j*ALDim]);
-        }
-    }
+    EntrywiseKernel
+    ( A.LockedBuffer(), m, n, A.LDim(), B.Buffer(), B.LDim(), func );
 }
 
 template<typename S,typename T>
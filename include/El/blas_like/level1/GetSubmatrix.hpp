@@ -25,6 +25,19 @@ void GetSubmatrix
     ASub = ASubView;
 }
 
+// Return by value (the result is moved out rather than copied)
+template<typename T>
+Matrix<T> GetSubmatrix
+( const Matrix<T>& A,
+        Range<Int> I,
+        Range<Int> J )
+{
+    EL_DEBUG_CSE
+    Matrix<T> ASub;
+    GetSubmatrix( A, I, J, ASub );
+    return ASub;
+}
+
 template<typename T>
 void GetSubmatrix
 ( const ElementalMatrix<T>& A,
@@ -343,6 +356,19 @@ void GetSubmatrix
     }
 }
 
+// Return by value (the result is moved out rather than copied)
+template<typename T>
+Matrix<T> GetSubmatrix
+( const Matrix<T>& A,
+  const vector<Int>& I,
+  const vector<Int>& J )
+{
+    EL_DEBUG_CSE
+    Matrix<T> ASub;
+    GetSubmatrix( A, I, J, ASub );
+    return ASub;
+}
+
 template<typename T>
 void GetSubmatrix
 ( const AbstractDistMatrix<T>& A,
@@ -559,6 +585,14 @@ void GetSubmatrix
           Range<Int> I, \
           Range<Int> J,  \
           Matrix<T>& ASub ); \
+  EL_EXTERN template Matrix<T> GetSubmatrix \
+  ( const Matrix<T>& A, \
+          Range<Int> I, \
+          Range<Int> J ); \
+  EL_EXTERN template Matrix<T> GetSubmatrix \
+  ( const Matrix<T>& A, \
+    const vector<Int>& I, \
+    const vector<Int>& J ); \
   EL_EXTERN template void GetSubmatrix \
   ( const ElementalMatrix<T>& A, \
           Range<Int> I, \
@@ -0,0 +1,228 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_PERMUTESYMMETRICALLY_HPP
+#define EL_BLAS_PERMUTESYMMETRICALLY_HPP
+
+namespace El {
+
+namespace permute_symmetrically {
+
+// Sort each row segment of a freshly scattered CSR structure; the counting
+// sort by row leaves the targets within a row in the order of arrival
+template<typename T>
+void SortRowSegments
+( Int numRows, const Int* offsetBuf, Int* targetBuf, T* valBuf )
+{
+    EL_DEBUG_CSE
+    vector<pair<Int,T>> rowBuf;
+    for( Int i=0; i<numRows; ++i )
+    {
+        const Int start = offsetBuf[i];
+        const Int end = offsetBuf[i+1];
+        if( std::is_sorted( &targetBuf[start], &targetBuf[end] ) )
+            continue;
+        rowBuf.resize( end-start );
+        for( Int e=start; e<end; ++e )
+            rowBuf[e-start] = pair<Int,T>(targetBuf[e],valBuf[e]);
+        std::sort
+        ( rowBuf.begin(), rowBuf.end(),
+          []( const pair<Int,T>& a, const pair<Int,T>& b )
+          { return a.first < b.first; } );
+        for( Int e=start; e<end; ++e )
+        {
+            targetBuf[e] = rowBuf[e-start].first;
+            valBuf[e] = rowBuf[e-start].second;
+        }
+    }
+}
+
+} // namespace permute_symmetrically
+
+template<typename T>
+void PermuteSymmetrically
+( const SparseMatrix<T>& A,
+  const vector<Int>& perm,
+        SparseMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Symmetric permutation requires a square matrix");
+    if( Int(perm.size()) != n )
+        LogicError("Permutation was not conformal with the matrix");
+    const Int numEntries = A.NumEntries();
+    B.Resize( n, n );
+
+    // Scatter B(perm(i),perm(j)) := A(i,j) with a counting sort over the
+    // permuted rows rather than routing the entries through the update
+    // queues; a bijective map cannot introduce duplicates, so only the
+    // targets within each row remain to be sorted afterwards
+    B.ForceNumEntries( numEntries );
+    Int* BSourceBuf = B.SourceBuffer();
+    Int* BTargetBuf = B.TargetBuffer();
+    T* BValBuf = B.ValueBuffer();
+    vector<Int> cursors( n, 0 );
+    for( Int e=0; e<numEntries; ++e )
+        ++cursors[perm[A.Row(e)]];
+    Int offset = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        const Int count = cursors[i];
+        cursors[i] = offset;
+        offset += count;
+    }
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int iNew = perm[A.Row(e)];
+        const Int pos = cursors[iNew]++;
+        BSourceBuf[pos] = iNew;
+        BTargetBuf[pos] = perm[A.Col(e)];
+        BValBuf[pos] = A.Value(e);
+    }
+    B.Graph().ComputeSourceOffsets();
+    permute_symmetrically::SortRowSegments
+    ( n, B.LockedOffsetBuffer(), BTargetBuf, BValBuf );
+    B.ForceConsistency();
+}
+
+template<typename T>
+void PermuteSymmetrically
+( const DistSparseMatrix<T>& A,
+  const DistMap& perm,
+        DistSparseMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Symmetric permutation requires a square matrix");
+    if( perm.NumSources() != n )
+        LogicError("Permutation was not conformal with the matrix");
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    B.SetGrid( A.Grid() );
+    B.Resize( n, n );
+
+    // Collectively translate the local row block and the distinct local
+    // column indices through the map
+    vector<Int> rowImages(localHeight);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rowImages[iLoc] = firstLocalRow + iLoc;
+    perm.Translate( rowImages );
+    vector<Int> cols;
+    cols.reserve( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+        cols.push_back( A.Col(e) );
+    std::sort( cols.begin(), cols.end() );
+    cols.erase( std::unique( cols.begin(), cols.end() ), cols.end() );
+    vector<Int> colImages( cols );
+    perm.Translate( colImages );
+    auto colImage =
+      [&]( Int j ) -> Int
+      {
+          const auto it = std::lower_bound( cols.begin(), cols.end(), j );
+          return colImages[it-cols.begin()];
+      };
+
+    // Bucket the local entries by the owner of their permuted row, fusing
+    // the index translation into the packing
+    vector<int> sendCounts(commSize,0), sendDispls(commSize);
+    for( Int e=0; e<numLocalEntries; ++e )
+        ++sendCounts[B.RowOwner(rowImages[A.Row(e)-firstLocalRow])];
+    const int totalSend = Scan( sendCounts, sendDispls );
+    vector<Int> sendSources(totalSend), sendTargets(totalSend);
+    vector<T> sendVals(totalSend);
+    auto offs = sendDispls;
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int iNew = rowImages[A.Row(e)-firstLocalRow];
+        const int pos = offs[B.RowOwner(iNew)]++;
+        sendSources[pos] = iNew;
+        sendTargets[pos] = colImage(A.Col(e));
+        sendVals[pos] = A.Value(e);
+    }
+
+    // A single exchange redistributes the permuted entries
+    vector<int> recvCounts(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    vector<int> recvDispls(commSize);
+    const int totalRecv = Scan( recvCounts, recvDispls );
+    vector<Int> recvSources(totalRecv), recvTargets(totalRecv);
+    vector<T> recvVals(totalRecv);
+    mpi::AllToAll
+    ( sendSources.data(), sendCounts.data(), sendDispls.data(),
+      recvSources.data(), recvCounts.data(), recvDispls.data(), comm );
+    mpi::AllToAll
+    ( sendTargets.data(), sendCounts.data(), sendDispls.data(),
+      recvTargets.data(), recvCounts.data(), recvDispls.data(), comm );
+    mpi::AllToAll
+    ( sendVals.data(), sendCounts.data(), sendDispls.data(),
+      recvVals.data(), recvCounts.data(), recvDispls.data(), comm );
+
+    // Counting-sort the received triples by local row and then sort the
+    // targets within each row segment
+    const Int localHeightB = B.LocalHeight();
+    const Int firstLocalRowB = B.FirstLocalRow();
+    B.ForceNumLocalEntries( totalRecv );
+    Int* BSourceBuf = B.SourceBuffer();
+    Int* BTargetBuf = B.TargetBuffer();
+    T* BValBuf = B.ValueBuffer();
+    vector<Int> cursors( localHeightB, 0 );
+    for( Int q=0; q<totalRecv; ++q )
+        ++cursors[recvSources[q]-firstLocalRowB];
+    Int offset = 0;
+    for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+    {
+        const Int count = cursors[iLoc];
+        cursors[iLoc] = offset;
+        offset += count;
+    }
+    for( Int q=0; q<totalRecv; ++q )
+    {
+        const Int pos = cursors[recvSources[q]-firstLocalRowB]++;
+        BSourceBuf[pos] = recvSources[q];
+        BTargetBuf[pos] = recvTargets[q];
+        BValBuf[pos] = recvVals[q];
+    }
+    B.DistGraph().ComputeSourceOffsets();
+    permute_symmetrically::SortRowSegments
+    ( localHeightB, B.LockedOffsetBuffer(), BTargetBuf, BValBuf );
+    B.ForceConsistency();
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template void PermuteSymmetrically \
+  ( const SparseMatrix<T>& A, \
+    const vector<Int>& perm, \
+          SparseMatrix<T>& B ); \
+  EL_EXTERN template void PermuteSymmetrically \
+  ( const DistSparseMatrix<T>& A, \
+    const DistMap& perm, \
+          DistSparseMatrix<T>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_PERMUTESYMMETRICALLY_HPP
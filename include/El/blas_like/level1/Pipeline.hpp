@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_PIPELINE_HPP
+#define EL_BLAS_PIPELINE_HPP
+
+namespace El {
+
+// Deferred composition of distributed stages
+// ==========================================
+// Chained drivers typically each proxy the operand into their preferred
+// distribution and materialize the result back into the caller's, so that a
+// pipeline such as equilibrate/factor/solve pays an [MC,MR] -> [VC,STAR] ->
+// [MC,MR] round-trip at every stage boundary. A DistPipeline instead owns a
+// single working operand and queues its stages: each stage declares the
+// distribution it prefers, nothing runs until the result is demanded, and a
+// redistribution is performed only at a boundary where the declared
+// preference actually changes. Consecutive stages which agree on a
+// distribution therefore share the operand with no data movement at all,
+// and the initial copy of the input doubles as the first redistribution.
+//
+// For example,
+//
+//   DistPipeline<Real> pipe( A );
+//   pipe.Then<MC,MR>( [&]( DistMatrix<Real,MC,MR>& X )
+//                     { DiagonalScale( LEFT, NORMAL, d, X ); } )
+//       .Then<MC,MR>( [&]( DistMatrix<Real,MC,MR>& X )
+//                     { Cholesky( LOWER, X ); } );
+//   pipe.Realize( L );
+//
+// performs exactly one redistribution (from A's distribution, if it is not
+// already [MC,MR]) rather than one per stage.
+template<typename T>
+class DistPipeline
+{
+public:
+    // The input is captured by reference and is first read when the queued
+    // stages are forced, so it must outlive the pipeline (or at least its
+    // first Get/Realize)
+    explicit DistPipeline( const ElementalMatrix<T>& A )
+    : input_(&A), grid_(&A.Grid())
+    { }
+
+    // Queue a stage which prefers the [U,V] distribution; the stage runs
+    // in place on the working operand
+    template<Dist U,Dist V>
+    DistPipeline<T>& Then( function<void(DistMatrix<T,U,V>&)> stage )
+    {
+        stages_.push_back(
+          [this,stage]()
+          {
+              if( operand_ == nullptr ||
+                  operand_->ColDist() != U || operand_->RowDist() != V )
+              {
+                  auto next = MakeUnique<DistMatrix<T,U,V>>( *grid_ );
+                  Copy( operand_==nullptr ? *input_ : *operand_, *next );
+                  operand_ = std::move(next);
+              }
+              stage( static_cast<DistMatrix<T,U,V>&>(*operand_) );
+          });
+        return *this;
+    }
+
+    // Force the queued stages and return the working operand in the
+    // distribution declared by the last stage
+    const ElementalMatrix<T>& Get()
+    {
+        Flush();
+        if( operand_ == nullptr )
+            LogicError("Demanded the result of an empty DistPipeline");
+        return *operand_;
+    }
+
+    // Force the queued stages and redistribute the result into B
+    void Realize( ElementalMatrix<T>& B )
+    { Copy( Get(), B ); }
+
+private:
+    void Flush()
+    {
+        EL_DEBUG_CSE
+        for( auto& stage : stages_ )
+            stage();
+        stages_.clear();
+    }
+
+    const ElementalMatrix<T>* input_;
+    const Grid* grid_;
+    unique_ptr<ElementalMatrix<T>> operand_;
+    vector<function<void()>> stages_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_PIPELINE_HPP
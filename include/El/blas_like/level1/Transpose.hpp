@@ -67,32 +67,18 @@ void PartialColAllGather
 ( const BlockMatrix<T>& A,
         BlockMatrix<T>& B, bool conjugate );
 
-} // namespace transpose
-
+// Blocked matrix transpose of a tile
+// Note: block size should be a multiple of cache line size and
+// should be small enough to fit in L1 cache. On recent Intel
+// CPUs, cache line size is 64 B and L1 cache is 32 KB per core.
 template<typename T>
-void Transpose( const Matrix<T>& A, Matrix<T>& B, bool conjugate )
+void BlockedKernel
+( Int m, Int n,
+  const T* ABuf, Int ldA,
+        T* BBuf, Int ldB,
+  bool conjugate )
 {
-    EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
-    B.Resize( n, m );
-#ifdef EL_HAVE_MKL
-    Orientation orient = ( conjugate ? ADJOINT : TRANSPOSE );
-    mkl::omatcopy
-    ( orient, m, n, T(1), A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
-#else
-    // OpenBLAS's {i,o}matcopy routines where disabled for the reasons detailed
-    // in src/core/imports/openblas.cpp
-    
-    // Blocked matrix transpose
-    // Note: block size should be a multiple of cache line size and
-    // should be small enough to fit in L1 cache. On recent Intel
-    // CPUs, cache line size is 64 B and L1 cache is 32 KB per core.
     const Int bsize = Max( 64 / sizeof(T), 1 );
-    const T* ABuf = A.LockedBuffer();
-          T* BBuf = B.Buffer();
-    const Int ldA = A.LDim();
-    const Int ldB = B.LDim();
     if( conjugate )
     {
         EL_PARALLEL_FOR_COLLAPSE2
@@ -127,9 +113,145 @@ void Transpose( const Matrix<T>& A, Matrix<T>& B, bool conjugate )
             }
         }
     }
+}
+
+// Cache-oblivious traversal: halve the larger dimension until a tile is
+// small enough for the blocked kernel, so that the depth-first tile order
+// keeps both the read and the write footprints compact regardless of the
+// leading dimensions. A row of cache-line blocks across a very wide panel
+// would otherwise touch a new page per block on the strided side.
+template<typename T>
+void RecursiveKernel
+( Int m, Int n,
+  const T* ABuf, Int ldA,
+        T* BBuf, Int ldB,
+  bool conjugate )
+{
+    // A leaf tile and its transpose each span at most 128 KiB of doubles,
+    // comfortably within L2; the blocked kernel handles L1 from there
+    const Int leafSize = 128;
+    if( m <= leafSize && n <= leafSize )
+    {
+        BlockedKernel( m, n, ABuf, ldA, BBuf, ldB, conjugate );
+    }
+    else if( m >= n )
+    {
+        const Int mHalf = m / 2;
+        RecursiveKernel( mHalf, n, ABuf, ldA, BBuf, ldB, conjugate );
+        RecursiveKernel
+        ( m-mHalf, n, &ABuf[mHalf], ldA, &BBuf[mHalf*ldB], ldB, conjugate );
+    }
+    else
+    {
+        const Int nHalf = n / 2;
+        RecursiveKernel( m, nHalf, ABuf, ldA, BBuf, ldB, conjugate );
+        RecursiveKernel
+        ( m, n-nHalf, &ABuf[nHalf*ldA], ldA, &BBuf[nHalf], ldB, conjugate );
+    }
+}
+
+} // namespace transpose
+
+template<typename T>
+void Transpose( const Matrix<T>& A, Matrix<T>& B, bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    B.Resize( n, m );
+#ifdef EL_HAVE_MKL
+    Orientation orient = ( conjugate ? ADJOINT : TRANSPOSE );
+    mkl::omatcopy
+    ( orient, m, n, T(1), A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+#else
+    // OpenBLAS's {i,o}matcopy routines where disabled for the reasons detailed
+    // in src/core/imports/openblas.cpp
+    transpose::RecursiveKernel
+    ( m, n, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim(), conjugate );
 #endif
 }
 
+template<typename T>
+void TransposeInPlace( Matrix<T>& A, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("In-place transposition requires a square matrix");
+    const Int n = A.Height();
+    T* ABuf = A.Buffer();
+    const Int ldA = A.LDim();
+    // Exchange the strictly lower and upper triangles in cache-line blocks
+    // so that no scratch matrix is required
+    const Int bsize = Max( 64 / sizeof(T), 1 );
+    if( conjugate )
+    {
+        for( Int j=0; j<n; j+=bsize )
+        {
+            const Int njb = Min( bsize, n - j );
+            // Conjugate-transpose the diagonal tile
+            for( Int jb=0; jb<njb; ++jb )
+            {
+                ABuf[(j+jb)+(j+jb)*ldA] = Conj(ABuf[(j+jb)+(j+jb)*ldA]);
+                for( Int ib=jb+1; ib<njb; ++ib )
+                {
+                    const T tmp = ABuf[(j+ib)+(j+jb)*ldA];
+                    ABuf[(j+ib)+(j+jb)*ldA] = Conj(ABuf[(j+jb)+(j+ib)*ldA]);
+                    ABuf[(j+jb)+(j+ib)*ldA] = Conj(tmp);
+                }
+            }
+            // Swap the conjugate-transposed off-diagonal tile pairs
+            for( Int i=j+bsize; i<n; i+=bsize )
+            {
+                const Int nib = Min( bsize, n - i );
+                T* ALowerBuf = &ABuf[i+j*ldA];
+                T* AUpperBuf = &ABuf[j+i*ldA];
+                for( Int jb=0; jb<njb; ++jb )
+                {
+                    for( Int ib=0; ib<nib; ++ib )
+                    {
+                        const T tmp = ALowerBuf[ib+jb*ldA];
+                        ALowerBuf[ib+jb*ldA] = Conj(AUpperBuf[jb+ib*ldA]);
+                        AUpperBuf[jb+ib*ldA] = Conj(tmp);
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        for( Int j=0; j<n; j+=bsize )
+        {
+            const Int njb = Min( bsize, n - j );
+            // Transpose the diagonal tile
+            for( Int jb=0; jb<njb; ++jb )
+            {
+                for( Int ib=jb+1; ib<njb; ++ib )
+                {
+                    const T tmp = ABuf[(j+ib)+(j+jb)*ldA];
+                    ABuf[(j+ib)+(j+jb)*ldA] = ABuf[(j+jb)+(j+ib)*ldA];
+                    ABuf[(j+jb)+(j+ib)*ldA] = tmp;
+                }
+            }
+            // Swap the transposed off-diagonal tile pairs
+            for( Int i=j+bsize; i<n; i+=bsize )
+            {
+                const Int nib = Min( bsize, n - i );
+                T* ALowerBuf = &ABuf[i+j*ldA];
+                T* AUpperBuf = &ABuf[j+i*ldA];
+                for( Int jb=0; jb<njb; ++jb )
+                {
+                    for( Int ib=0; ib<nib; ++ib )
+                    {
+                        const T tmp = ALowerBuf[ib+jb*ldA];
+                        ALowerBuf[ib+jb*ldA] = AUpperBuf[jb+ib*ldA];
+                        AUpperBuf[jb+ib*ldA] = tmp;
+                    }
+                }
+            }
+        }
+    }
+}
+
 template<typename T>
 void Transpose
 ( const ElementalMatrix<T>& A,
@@ -302,9 +424,38 @@ void Transpose
 ( const SparseMatrix<T>& A, SparseMatrix<T>& B, bool conjugate )
 {
     EL_DEBUG_CSE
-    B.Resize( A.Width(), A.Height() );
-    Zero( B, false );
-    TransposeAxpy( T(1), A, B, conjugate );
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    B.Resize( n, A.Height() );
+
+    // Transpose the CSR structure with a counting sort over the columns of
+    // A rather than routing the entries through the update queues. Since A
+    // is traversed in row-major order and the scatter is stable, each row
+    // of B is produced with its targets already sorted (and A being
+    // consistent rules out duplicates), so no comparison sort is needed.
+    B.ForceNumEntries( numEntries );
+    Int* BSourceBuf = B.SourceBuffer();
+    Int* BTargetBuf = B.TargetBuffer();
+    T* BValBuf = B.ValueBuffer();
+    vector<Int> cursors( n, 0 );
+    for( Int e=0; e<numEntries; ++e )
+        ++cursors[A.Col(e)];
+    Int offset = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        const Int count = cursors[j];
+        cursors[j] = offset;
+        offset += count;
+    }
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int pos = cursors[A.Col(e)]++;
+        BSourceBuf[pos] = A.Col(e);
+        BTargetBuf[pos] = A.Row(e);
+        BValBuf[pos] = conjugate ? Conj(A.Value(e)) : A.Value(e);
+    }
+    B.Graph().ComputeSourceOffsets();
+    B.ForceConsistency();
 }
 
 template<typename T>
@@ -312,10 +463,75 @@ void Transpose
 ( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B, bool conjugate )
 {
     EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
     B.SetGrid( A.Grid() );
     B.Resize( A.Width(), A.Height() );
-    Zero( B, false );
-    TransposeAxpy( T(1), A, B, conjugate );
+
+    // Bucket the local entries by the owner of their transposed row,
+    // fusing the index swap into the packing
+    const Int numLocalEntries = A.NumLocalEntries();
+    vector<int> sendCounts(commSize,0), sendDispls(commSize);
+    for( Int e=0; e<numLocalEntries; ++e )
+        ++sendCounts[B.RowOwner(A.Col(e))];
+    const int totalSend = Scan( sendCounts, sendDispls );
+    vector<Int> sendSources(totalSend), sendTargets(totalSend);
+    vector<T> sendVals(totalSend);
+    auto offs = sendDispls;
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const int pos = offs[B.RowOwner(A.Col(e))]++;
+        sendSources[pos] = A.Col(e);
+        sendTargets[pos] = A.Row(e);
+        sendVals[pos] = conjugate ? Conj(A.Value(e)) : A.Value(e);
+    }
+
+    // A single exchange redistributes the transposed entries
+    vector<int> recvCounts(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    vector<int> recvDispls(commSize);
+    const int totalRecv = Scan( recvCounts, recvDispls );
+    vector<Int> recvSources(totalRecv), recvTargets(totalRecv);
+    vector<T> recvVals(totalRecv);
+    mpi::AllToAll
+    ( sendSources.data(), sendCounts.data(), sendDispls.data(),
+      recvSources.data(), recvCounts.data(), recvDispls.data(), comm );
+    mpi::AllToAll
+    ( sendTargets.data(), sendCounts.data(), sendDispls.data(),
+      recvTargets.data(), recvCounts.data(), recvDispls.data(), comm );
+    mpi::AllToAll
+    ( sendVals.data(), sendCounts.data(), sendDispls.data(),
+      recvVals.data(), recvCounts.data(), recvDispls.data(), comm );
+
+    // Counting-sort the received triples by local row. Every sender packed
+    // its contributions in row-major order of A and the senders are visited
+    // in order of their (contiguous) row blocks, so the stable scatter
+    // leaves each row of B with sorted targets and no duplicates.
+    const Int localHeight = B.LocalHeight();
+    const Int firstLocalRow = B.FirstLocalRow();
+    B.ForceNumLocalEntries( totalRecv );
+    Int* BSourceBuf = B.SourceBuffer();
+    Int* BTargetBuf = B.TargetBuffer();
+    T* BValBuf = B.ValueBuffer();
+    vector<Int> cursors( localHeight, 0 );
+    for( Int q=0; q<totalRecv; ++q )
+        ++cursors[recvSources[q]-firstLocalRow];
+    Int offset = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int count = cursors[iLoc];
+        cursors[iLoc] = offset;
+        offset += count;
+    }
+    for( Int q=0; q<totalRecv; ++q )
+    {
+        const Int pos = cursors[recvSources[q]-firstLocalRow]++;
+        BSourceBuf[pos] = recvSources[q];
+        BTargetBuf[pos] = recvTargets[q];
+        BValBuf[pos] = recvVals[q];
+    }
+    B.DistGraph().ComputeSourceOffsets();
+    B.ForceConsistency();
 }
 
 template<typename T>
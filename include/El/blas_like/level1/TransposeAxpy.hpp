@@ -11,6 +11,75 @@
 
 namespace El {
 
+namespace transpose_axpy {
+
+// Update a tile small enough for its strided operand to stay TLB-resident
+template<typename T>
+void BlockedKernel
+( Int m, Int n,
+  const T& alpha,
+  const T* XBuf, Int ldX,
+        T* YBuf, Int ldY,
+  bool conjugate )
+{
+    if( n <= m )
+    {
+        if( conjugate )
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<m; ++i )
+                    YBuf[j+i*ldY] += alpha*Conj(XBuf[i+j*ldX]);
+        else
+            for( Int j=0; j<n; ++j )
+                blas::Axpy( m, alpha, &XBuf[j*ldX], 1, &YBuf[j], ldY );
+    }
+    else
+    {
+        if( conjugate )
+            for( Int i=0; i<m; ++i )
+                for( Int j=0; j<n; ++j )
+                    YBuf[j+i*ldY] += alpha*Conj(XBuf[i+j*ldX]);
+        else
+            for( Int i=0; i<m; ++i )
+                blas::Axpy( n, alpha, &XBuf[i], ldX, &YBuf[i*ldY], 1 );
+    }
+}
+
+// Cache-oblivious traversal matching transpose::RecursiveKernel: halving
+// the larger dimension keeps the strided operand's page footprint bounded
+// even when one of the matrices is a very wide panel
+template<typename T>
+void RecursiveKernel
+( Int m, Int n,
+  const T& alpha,
+  const T* XBuf, Int ldX,
+        T* YBuf, Int ldY,
+  bool conjugate )
+{
+    const Int leafSize = 128;
+    if( m <= leafSize && n <= leafSize )
+    {
+        BlockedKernel( m, n, alpha, XBuf, ldX, YBuf, ldY, conjugate );
+    }
+    else if( m >= n )
+    {
+        const Int mHalf = m / 2;
+        RecursiveKernel( mHalf, n, alpha, XBuf, ldX, YBuf, ldY, conjugate );
+        RecursiveKernel
+        ( m-mHalf, n, alpha, &XBuf[mHalf], ldX, &YBuf[mHalf*ldY], ldY,
+          conjugate );
+    }
+    else
+    {
+        const Int nHalf = n / 2;
+        RecursiveKernel( m, nHalf, alpha, XBuf, ldX, YBuf, ldY, conjugate );
+        RecursiveKernel
+        ( m, n-nHalf, alpha, &XBuf[nHalf*ldX], ldX, &YBuf[nHalf], ldY,
+          conjugate );
+    }
+}
+
+} // namespace transpose_axpy
+
 template<typename T,typename S>
 void TransposeAxpy
 (       S alphaS,
@@ -53,26 +122,8 @@ void TransposeAxpy
           if( mX != nY || nX != mY )
               LogicError("Nonconformal TransposeAxpy");
         )
-        if( nX <= mX )
-        {
-            if( conjugate )
-                for( Int j=0; j<nX; ++j )
-                    for( Int i=0; i<mX; ++i )
-                        YBuf[j+i*ldY] += alpha*Conj(XBuf[i+j*ldX]);
-            else
-                for( Int j=0; j<nX; ++j )
-                    blas::Axpy( mX, alpha, &XBuf[j*ldX], 1, &YBuf[j], ldY );
-        }
-        else
-        {
-            if( conjugate )
-                for( Int i=0; i<mX; ++i )
-                    for( Int j=0; j<nX; ++j )
-                        YBuf[j+i*ldY] += alpha*Conj(XBuf[i+j*ldX]);
-            else
-                for( Int i=0; i<mX; ++i )
-                    blas::Axpy( nX, alpha, &XBuf[i], ldX, &YBuf[i*ldY], 1 );
-        }
+        transpose_axpy::RecursiveKernel
+        ( mX, nX, alpha, XBuf, ldX, YBuf, ldY, conjugate );
     }
 }
 
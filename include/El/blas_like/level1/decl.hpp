@@ -209,6 +209,55 @@ template<typename Field>
 void ColumnTwoNorms
 ( const DistSparseMatrix<Field>& X, DistMultiVec<Base<Field>>& norms );
 
+// Fused kernels for repeated orthogonalization
+// ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+// Compute the column norms of X and rescale each column to unit norm while
+// it is still in cache (columns with zero norm are left untouched)
+template<typename Field>
+void ColumnTwoNormsAndNormalize
+( Matrix<Field>& X, Matrix<Base<Field>>& norms );
+template<typename Field,Dist U,Dist V,DistWrap W>
+void ColumnTwoNormsAndNormalize
+( DistMatrix<Field,U,V,W>& X, DistMatrix<Base<Field>,V,STAR,W>& norms );
+
+// Form Y := Y + alpha X and the column norms of the result in one pass
+template<typename Field>
+void AxpyColumnTwoNorms
+( Field alpha,
+  const Matrix<Field>& X,
+        Matrix<Field>& Y,
+        Matrix<Base<Field>>& norms );
+template<typename Field,Dist U,Dist V,DistWrap W>
+void AxpyColumnTwoNorms
+( Field alpha,
+  const DistMatrix<Field,U,V,W>& X,
+        DistMatrix<Field,U,V,W>& Y,
+        DistMatrix<Base<Field>,V,STAR,W>& norms );
+
+// Deferred-reduction column two-norms: the local contributions of several
+// matrices sharing a column communicator may be queued so that their norm
+// reductions are batched into a single pair of AllReduces
+template<typename Field>
+class ColumnTwoNormBatch
+{
+public:
+    // Queues the local contribution of X; the result is written into
+    // 'norms' by Process
+    void Queue
+    ( const DistMatrix<Field>& X, DistMatrix<Base<Field>,MR,STAR>& norms );
+    // Completes every queued computation with one MAX and one SUM AllReduce
+    void Process();
+
+private:
+    struct Entry
+    {
+        DistMatrix<Base<Field>,MR,STAR>* norms;
+        Matrix<Base<Field>> localScales, localScaledSquares;
+    };
+    vector<Entry> entries_;
+    mpi::Comm comm_;
+};
+
 // Separated complex data
 // ^^^^^^^^^^^^^^^^^^^^^^
 template<typename Real,
@@ -486,6 +535,11 @@ void Contract( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
 template<typename T>
 void Copy( const Matrix<T>& A, Matrix<T>& B );
+// An rvalue source donates its buffer rather than being copied entry-wise
+// (the move assignment safely degrades to a deep copy when either side is
+// a view)
+template<typename T>
+void Copy( Matrix<T>&& A, Matrix<T>& B );
 template<typename S,typename T,
          typename=EnableIf<And< CanCast<S,T>, Not<IsSame<S,T>> >>>
 void Copy( const Matrix<S>& A, Matrix<T>& B );
@@ -500,6 +554,8 @@ void Copy( const BlockMatrix<S>& A, BlockMatrix<T>& B );
 
 template<typename T>
 void Copy( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+template<typename T>
+void Copy( AbstractDistMatrix<T>&& A, AbstractDistMatrix<T>& B );
 template<typename S,typename T,
          typename=EnableIf<And< CanCast<S,T>, Not<IsSame<S,T>> >>>
 void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
@@ -1016,6 +1072,20 @@ void GetSubgraph
   const vector<Int>& J,
         DistGraph& subgraph );
 
+// Batched extraction: filter many index-range pairs in one pass over the
+// (distributed) edge list, aggregating the edge exchanges of all of the
+// subgraphs into a single AllToAll
+void GetSubgraphs
+( const Graph& graph,
+  const vector<Range<Int>>& I,
+  const vector<Range<Int>>& J,
+        vector<Graph>& subgraphs );
+void GetSubgraphs
+( const DistGraph& graph,
+  const vector<Range<Int>>& I,
+  const vector<Range<Int>>& J,
+        vector<DistGraph>& subgraphs );
+
 // GetSubmatrix
 // ============
 
@@ -1027,6 +1097,12 @@ void GetSubmatrix
         Range<Int> I,
         Range<Int> J,
         Matrix<T>& ASub );
+// Return by value (the result is moved out rather than copied)
+template<typename T>
+Matrix<T> GetSubmatrix
+( const Matrix<T>& A,
+        Range<Int> I,
+        Range<Int> J );
 template<typename T>
 void GetSubmatrix
 ( const ElementalMatrix<T>& A,
@@ -1054,6 +1130,12 @@ void GetSubmatrix
   const vector<Int>& I,
   const vector<Int>& J,
         Matrix<T>& ASub );
+// Return by value (the result is moved out rather than copied)
+template<typename T>
+Matrix<T> GetSubmatrix
+( const Matrix<T>& A,
+  const vector<Int>& I,
+  const vector<Int>& J );
 
 template<typename T>
 void GetSubmatrix
@@ -1480,6 +1562,26 @@ template<typename Ring>
 Entry<Base<Ring>>
 SymmetricMinAbsLoc( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A );
 
+// EntrywiseReductions
+// ===================
+// Convergence tests frequently need max |alpha_{i,j}|, min |alpha_{i,j}|,
+// and || A ||_F at the same time; computing them together requires a
+// single pass over the entries and two fused AllReduces rather than one
+// pass and one collective apiece
+template<typename Real>
+struct EntrywiseReductions
+{
+    Real maxAbs=Real(0);
+    Real minAbs=Real(0);
+    Real frobeniusNorm=Real(0);
+};
+
+template<typename Ring>
+EntrywiseReductions<Base<Ring>> EntrywiseReduce( const Matrix<Ring>& A );
+template<typename Ring>
+EntrywiseReductions<Base<Ring>> EntrywiseReduce
+( const AbstractDistMatrix<Ring>& A );
+
 // Nrm2
 // ====
 template<typename Field>
@@ -1489,6 +1591,24 @@ Base<Field> Nrm2( const AbstractDistMatrix<Field>& x );
 template<typename Field>
 Base<Field> Nrm2( const DistMultiVec<Field>& x );
 
+// PermuteSymmetrically
+// ====================
+// Form B := P A P^T for sparse A, where the permutation P maps row and
+// column i to perm(i) (e.g., an ordering produced by NestedDissection).
+// The entries are rebucketed with a counting sort and, in the distributed
+// case, redistributed with a single AllToAll per buffer rather than routed
+// through the per-entry update queues.
+template<typename T>
+void PermuteSymmetrically
+( const SparseMatrix<T>& A,
+  const vector<Int>& perm,
+        SparseMatrix<T>& B );
+template<typename T>
+void PermuteSymmetrically
+( const DistSparseMatrix<T>& A,
+  const DistMap& perm,
+        DistSparseMatrix<T>& B );
+
 // QuasiDiagonalScale
 // ==================
 template<typename Field,typename FieldMain>
@@ -1981,6 +2101,10 @@ void Transpose
         DistSparseMatrix<T>& B,
   bool conjugate=false );
 
+// A := A^T (or A^H) of a square matrix without a scratch matrix
+template<typename T>
+void TransposeInPlace( Matrix<T>& A, bool conjugate=false );
+
 // TransposeContract
 // =================
 template<typename T>
@@ -10,10 +10,12 @@
 #define EL_BLAS1_IMPL_HPP
 
 #include <El/blas_like/level1/AllReduce.hpp>
+#include <El/blas_like/level1/Axpby.hpp>
 #include <El/blas_like/level1/Axpy.hpp>
 #include <El/blas_like/level1/AxpyContract.hpp>
 #include <El/blas_like/level1/AxpyTrapezoid.hpp>
 #include <El/blas_like/level1/Broadcast.hpp>
+#include <El/blas_like/level1/Compensated.hpp>
 #include <El/blas_like/level1/Concatenate.hpp>
 #include <El/blas_like/level1/Conjugate.hpp>
 #include <El/blas_like/level1/ConjugateDiagonal.hpp>
@@ -25,6 +27,7 @@
 #include <El/blas_like/level1/DiagonalSolve.hpp>
 #include <El/blas_like/level1/Dot.hpp>
 #include <El/blas_like/level1/EntrywiseFill.hpp>
+#include <El/blas_like/level1/EntrywiseKernel.hpp>
 #include <El/blas_like/level1/EntrywiseMap.hpp>
 #include <El/blas_like/level1/Fill.hpp>
 #include <El/blas_like/level1/FillDiagonal.hpp>
@@ -44,6 +47,8 @@
 #include <El/blas_like/level1/MakeSymmetric.hpp>
 #include <El/blas_like/level1/MakeTrapezoidal.hpp>
 #include <El/blas_like/level1/Nrm2.hpp>
+#include <El/blas_like/level1/PermuteSymmetrically.hpp>
+#include <El/blas_like/level1/Pipeline.hpp>
 #include <El/blas_like/level1/QuasiDiagonalScale.hpp>
 #include <El/blas_like/level1/QuasiDiagonalSolve.hpp>
 #include <El/blas_like/level1/RealPart.hpp>
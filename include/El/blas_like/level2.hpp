@@ -65,6 +65,41 @@ void LocalGemv
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& x,
   T beta,        AbstractDistMatrix<T>& y );
 
+// BandedGemv
+// ==========
+// y := alpha op(A) x + beta y, where A is stored as a dense matrix but is
+// known to vanish outside of a band of lowerBandwidth subdiagonals and
+// upperBandwidth superdiagonals, so that the flops on the known zeros of
+// structured intermediate forms (e.g., the Hessenberg and band matrices
+// left behind by the condensed reductions) can be skipped
+template<typename T>
+void BandedGemv
+( Orientation orientation, Int lowerBandwidth, Int upperBandwidth,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& x,
+  T beta,        Matrix<T>& y );
+template<typename T>
+void BandedGemv
+( Orientation orientation, Int lowerBandwidth, Int upperBandwidth,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& x,
+  T beta,        AbstractDistMatrix<T>& y );
+
+// The Hessenberg special cases (a single subdiagonal for UPPER, a single
+// superdiagonal for LOWER)
+template<typename T>
+void HessenbergGemv
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const Matrix<T>& H,
+           const Matrix<T>& x,
+  T beta,        Matrix<T>& y );
+template<typename T>
+void HessenbergGemv
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const AbstractDistMatrix<T>& H,
+           const AbstractDistMatrix<T>& x,
+  T beta,        AbstractDistMatrix<T>& y );
+
 // Ger
 // ===
 template<typename T>
@@ -273,11 +308,50 @@ void ApplyGivensSequence
   Matrix<F>& A );
 template<typename F>
 void ApplyGivensSequence
-( LeftOrRight side, GivensSequenceType seqType, ForwardOrBackward direction, 
+( LeftOrRight side, GivensSequenceType seqType, ForwardOrBackward direction,
   const Matrix<Base<F>>& cList,
   const Matrix<Base<F>>& sList,
   Matrix<F>& A );
 
+// Accumulate several variable rotation sequences and apply them in a single
+// cache-blocked pass, so that each panel of the target matrix is loaded once
+// for all of the queued sweeps rather than once per sweep. The sweeps are
+// applied in the order in which they were queued and the queue is cleared
+// after each call to Apply.
+template<typename F>
+class GivensBatch
+{
+public:
+    GivensBatch( LeftOrRight side, ForwardOrBackward direction );
+
+    void Queue( const Matrix<Base<F>>& cList, const Matrix<F>& sList );
+    // Queue a sweep whose sines are real even though F is complex
+    template<typename S=F,typename=DisableIf<IsReal<S>>>
+    void Queue( const Matrix<Base<F>>& cList, const Matrix<Base<F>>& sList )
+    { QueueReal( cList, sList ); }
+
+    void Apply( Matrix<F>& A );
+
+    Int NumQueued() const;
+    void Clear();
+
+private:
+    struct Entry
+    {
+        Matrix<Base<F>> cList;
+        Matrix<F> sList;
+        Matrix<Base<F>> sRealList;
+        bool sIsReal=false;
+    };
+
+    void QueueReal
+    ( const Matrix<Base<F>>& cList, const Matrix<Base<F>>& sList );
+
+    LeftOrRight side_;
+    ForwardOrBackward direction_;
+    vector<Entry> entries_;
+};
+
 } // namespace El
 
 #endif // ifndef EL_BLAS2_HPP
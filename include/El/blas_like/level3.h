@@ -23,6 +23,8 @@ typedef enum {
   EL_GEMM_SUMMA_B,
   EL_GEMM_SUMMA_C,
   EL_GEMM_SUMMA_DOT,
+  EL_GEMM_SUMMA_PIPE,
+  EL_GEMM_SUMMA_25D,
   EL_GEMM_CANNON
 } ElGemmAlgorithm;
 
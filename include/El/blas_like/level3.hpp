@@ -26,11 +26,26 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_SUMMA_PIPE,
+  GEMM_SUMMA_25D,
+  GEMM_CANNON,
+  GEMM_STRASSEN
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The number of process layers used by GEMM_SUMMA_25D (which falls back to
+// the standard 2D algorithm when the grid cannot be evenly layered)
+void SetGemmReplication( Int numLayers );
+Int GemmReplication();
+
+// The subproblem dimension at which GEMM_STRASSEN's recursion (which is
+// only supported for the normal/normal case) hands off to classical SUMMA.
+// Accuracy-sensitive callers should keep the default algorithm, as Strassen
+// weakens the componentwise error bound.
+void SetStrassenCutoff( Int cutoff );
+Int StrassenCutoff();
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -41,11 +56,24 @@ void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C );
 
+// Conversion-based products for the 16-bit storage types: the operands are
+// widened to single-precision, the accumulation runs through the standard
+// float BLAS, and the result is rounded back down to 16 bits.
+void Gemm
+( Orientation orientA, Orientation orientB,
+  float alpha, const Matrix<Half>& A, const Matrix<Half>& B,
+  float beta,        Matrix<Half>& C );
+void Gemm
+( Orientation orientA, Orientation orientB,
+  float alpha, const Matrix<BFloat>& A, const Matrix<BFloat>& B,
+  float beta,        Matrix<BFloat>& C );
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
-  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT,
+  const TuningCtrl& tuning=TuningCtrl() );
 
 template<typename T>
 void Gemm
@@ -66,6 +94,26 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// BandedGemm
+// ==========
+// C := alpha op(A) B + beta C, where A is stored as a dense matrix but is
+// known to vanish outside of a band of lowerBandwidth subdiagonals and
+// upperBandwidth superdiagonals: the product is formed from one GEMM per
+// column block of A, each restricted to the rows that intersect the band,
+// so that none of the known zeros participate
+template<typename T>
+void BandedGemm
+( Orientation orientA, Int lowerBandwidth, Int upperBandwidth,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C );
+template<typename T>
+void BandedGemm
+( Orientation orientA, Int lowerBandwidth, Int upperBandwidth,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C );
+
 // Hemm
 // ====
 template<typename T>
@@ -94,7 +142,8 @@ template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
   Base<T> alpha, const AbstractDistMatrix<T>& A,
-  Base<T> beta,        AbstractDistMatrix<T>& C );
+  Base<T> beta,        AbstractDistMatrix<T>& C,
+  const TuningCtrl& tuning=TuningCtrl() );
 template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
@@ -122,6 +171,46 @@ void Herk
   Base<T> alpha, const DistSparseMatrix<T>& A,
                        DistSparseMatrix<T>& C );
 
+// Accumulate C := alpha A_t A_t^H + C over a stream of batches while holding
+// C in the [MC,MR] distribution used internally by Herk, so that only the
+// final materialization (rather than every batch) pays for redistributing
+// C's triangular structure. Passing conjugate=false to Initialize yields the
+// transposed (Syrk) update instead.
+template<typename T>
+class HerkAccumulator
+{
+public:
+    HerkAccumulator();
+    HerkAccumulator
+    ( UpperOrLower uplo, Orientation orientation, Int n, const Grid& grid,
+      bool conjugate=true );
+
+    HerkAccumulator( const HerkAccumulator<T>& ) = delete;
+    HerkAccumulator<T>& operator=( const HerkAccumulator<T>& ) = delete;
+
+    void Initialize
+    ( UpperOrLower uplo, Orientation orientation, Int n, const Grid& grid,
+      bool conjugate=true );
+
+    void Accumulate( Base<T> alpha, const AbstractDistMatrix<T>& A );
+
+    // Form C := alpha S + beta C, where S is the accumulated sum
+    void Materialize
+    ( Base<T> alpha, Base<T> beta, AbstractDistMatrix<T>& C ) const;
+    void Materialize( AbstractDistMatrix<T>& C ) const;
+
+    Int Height() const EL_NO_EXCEPT;
+    bool Initialized() const EL_NO_EXCEPT;
+    void Clear();
+
+private:
+    UpperOrLower uplo_=LOWER;
+    Orientation orientation_=NORMAL;
+    bool conjugate_=true;
+    bool initialized_=false;
+    DistMatrix<T,MC,MR> C_;
+};
+
 // Her2k
 // =====
 template<typename T>
@@ -165,6 +254,13 @@ void Multiply
   T alpha, const Graph& A, const Matrix<T>& X,
   T beta,                        Matrix<T>& Y );
 
+// Register-blocked multiplication with block-sparse (BSR) storage
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const BSRMatrix<T>& A, const Matrix<T>& X,
+  T beta,                               Matrix<T>& Y );
+
 template<typename T>
 void Multiply
 ( Orientation orientation,
@@ -173,6 +269,19 @@ void Multiply
   const DistMultiVec<T>& X,
   T beta,
         DistMultiVec<T>& Y );
+
+// A native sparse-dense product with the dense operands distributed as
+// [VC,* ]: the needed rows of X are gathered with a single aggregated
+// exchange over the sparse row structure and the product rows are scattered
+// directly onto the cyclic distribution, so neither operand is reformatted
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistMatrix<T,VC,STAR>& X,
+  T beta,
+        DistMatrix<T,VC,STAR>& Y );
 template<typename T>
 void Multiply
 ( Orientation orientation,
@@ -182,6 +291,123 @@ void Multiply
   T beta,
         AbstractDistMatrix<T>& Y );
 
+// Y := alpha A^T X + beta Y (or A^H X when 'conjugate' is true) without
+// materializing the transpose: the exchange of the NORMAL product is simply
+// reversed over the same storage, so solvers which alternate A and A^T
+// applies (e.g., LSQR) need only a single copy of the matrix
+template<typename T>
+void MultiplyTranspose
+( T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistMultiVec<T>& X,
+  T beta,
+        DistMultiVec<T>& Y,
+  bool conjugate=false );
+
+// A reusable communication schedule for repeated products with a fixed
+// DistSparseMatrix (e.g., the matvecs of a Krylov solver). The exchange
+// metadata is scaled to the requested width once, the pack and receive
+// buffers are allocated once, and, for packed datatypes, the messages are
+// posted as MPI persistent requests which each product merely restarts, so
+// that none of the per-call setup or tag-matching cost of the one-shot
+// Multiply is paid inside an iteration loop. The transposed exchange is the
+// reversal of the NORMAL exchange, so a single plan serves both A and A^T
+// applies over shared buffers (with its own set of persistent requests for
+// the reverse direction).
+template<typename T>
+class DistSparseMultPlan
+{
+public:
+    DistSparseMultPlan();
+    DistSparseMultPlan( const DistSparseMatrix<T>& A, Int width=1 );
+    ~DistSparseMultPlan();
+
+    // The persistent requests hold pointers into our buffers
+    DistSparseMultPlan( const DistSparseMultPlan<T>& ) = delete;
+    DistSparseMultPlan<T>& operator=( const DistSparseMultPlan<T>& ) = delete;
+
+    // (Re)build the schedule for products with 'width' right-hand sides
+    void Build( const DistSparseMatrix<T>& A, Int width=1 );
+
+    // Y := alpha op(A) X + beta Y, replaying the prebuilt schedule.
+    // The width of X must match that of Build and the matrix must not have
+    // been modified since the schedule was built.
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const DistMultiVec<T>& X, T beta, DistMultiVec<T>& Y );
+
+    Int Width() const EL_NO_EXCEPT;
+    bool Ready() const EL_NO_EXCEPT;
+    // Release the buffers and any persistent requests
+    void Clear();
+
+private:
+    const DistSparseMatrix<T>* A_=nullptr;
+    Int width_=0;
+    // Whether MPI persistent requests were formed (they are avoided for
+    // datatypes which would require serialization before every replay)
+    bool persistent_=false;
+
+    // The multMeta sizes and offsets scaled by the width
+    vector<int> sendSizes_, sendOffs_, recvSizes_, recvOffs_;
+    // The buffers attached to the schedule: the NORMAL product packs into
+    // 'sendVals_' and receives into 'recvVals_', while the transposed
+    // product reuses the same two buffers with their roles reversed
+    vector<T> sendVals_, recvVals_;
+    vector<mpi::Request<T>> forwardRequests_, reverseRequests_;
+};
+
+// Communication-avoiding matrix-powers kernel: Build computes the k-level
+// overlap of the local row block from the distributed graph and replicates
+// the boundary rows (structure and values) of the first k-1 levels, so
+// that Powers can form [A X, A^2 X, ..., A^k X] with a single widened
+// ghost exchange instead of one halo exchange per power -- the standard
+// primitive of polynomial preconditioners and s-step Krylov methods. The
+// replicated rows capture A's values at Build time, so the plan must be
+// rebuilt after the values change, and the extra memory and flops grow
+// with the overlap, which is the usual communication-avoiding trade.
+template<typename T>
+class DistSparsePowersPlan
+{
+public:
+    DistSparsePowersPlan();
+    DistSparsePowersPlan( const DistSparseMatrix<T>& A, Int numPowers );
+    ~DistSparsePowersPlan();
+
+    // (Re)build the overlap and replicate the boundary rows
+    void Build( const DistSparseMatrix<T>& A, Int numPowers );
+
+    // Fill powers[l-1] with A^l X for l=1,...,numPowers using one exchange
+    void Powers
+    ( const DistMultiVec<T>& X, vector<DistMultiVec<T>>& powers ) const;
+
+    Int NumPowers() const EL_NO_EXCEPT;
+    bool Ready() const EL_NO_EXCEPT;
+    void Clear();
+
+private:
+    const DistSparseMatrix<T>* A_=nullptr;
+    Int numPowers_=0;
+
+    // The sorted global indices of the overlap (levels 1..k), whose values
+    // arrive in a single exchange per application; workspace slot
+    // localHeight+g holds ghostInds_[g]
+    vector<Int> ghostInds_;
+    // The value exchange: the local rows that each peer needs from us
+    vector<Int> sendInds_;
+    vector<int> sendSizes_, sendOffs_, recvSizes_, recvOffs_;
+
+    // The replicated boundary rows (levels 1..k-1) in level order:
+    // ghostRowSlots_[r] is row r's workspace slot, levelOffs_[l] counts the
+    // rows of level at most l, and the CSR columns are workspace slots
+    vector<Int> ghostRowSlots_, levelOffs_;
+    vector<Int> ghostRowOffs_, ghostRowCols_;
+    vector<T> ghostRowVals_;
+    // The local rows' column indices remapped to workspace slots (aligned
+    // with the matrix's value buffer)
+    vector<Int> localCols_;
+};
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
@@ -208,6 +434,17 @@ void MultiShiftQuasiTrsm
   const AbstractDistMatrix<Complex<Real>>& shifts,
         AbstractDistMatrix<Real>& BReal, AbstractDistMatrix<Real>& BImag );
 
+// Solve against several independent shift groups in a single sweep of A,
+// advancing every group through each panel of the factor while it is
+// cache-resident, so that the factor traffic is independent of the number
+// of groups
+template<typename F>
+void MultiShiftQuasiTrsm
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  F alpha, const Matrix<F>& A,
+  const vector<const Matrix<F>*>& shiftGroups,
+  const vector<Matrix<F>*>& BGroups );
+
 template<typename F>
 void LocalMultiShiftQuasiTrsm
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
@@ -320,6 +557,76 @@ void LocalAccumulateRU
 
 } // namespace symm
 
+// Rectangular Full Packed (RFP) storage
+// =====================================
+// A symmetric/Hermitian matrix is stored in roughly half the memory of full
+// storage by packing its lower triangle into an ordinary rectangle: with
+// n1 = n - n/2 and n2 = n/2, the rectangle holds the lower triangles of A11
+// and all of A21 in its first n1 columns and the upper triangle of A22 in
+// its top-right corner (an extra row is prepended when n is even so that the
+// trailing triangle fits). Since every block is an ordinary (triangular)
+// view of the rectangle, the packed kernels below run at near full-storage
+// speed. Only uplo=LOWER is currently supported.
+inline Int RFPHeight( Int n ) EL_NO_EXCEPT
+{ return ( n % 2 == 0 ? n+1 : n ); }
+inline Int RFPWidth( Int n ) EL_NO_EXCEPT
+{ return n - n/2; }
+inline Int RFPDimension( Int height, Int width )
+{
+    if( height == 2*width+1 )
+        return height-1;
+    else if( height == 2*width-1 )
+        return height;
+    LogicError("Invalid RFP dimensions: ",height," x ",width);
+    return -1;
+}
+
+// Pack the lower triangle of A; 'conjugate' should be true when A is
+// Hermitian rather than symmetric so that the trailing triangle is stored
+// with the correct conjugation
+template<typename T>
+void PackRFP
+( UpperOrLower uplo, const Matrix<T>& A, Matrix<T>& ARFP,
+  bool conjugate=false );
+template<typename T>
+void PackRFP
+( UpperOrLower uplo, const AbstractDistMatrix<T>& A,
+  AbstractDistMatrix<T>& ARFP, bool conjugate=false );
+
+// Unpack into the lower triangle of A (the strictly upper triangle is
+// explicitly zeroed)
+template<typename T>
+void UnpackRFP
+( UpperOrLower uplo, const Matrix<T>& ARFP, Matrix<T>& A,
+  bool conjugate=false );
+template<typename T>
+void UnpackRFP
+( UpperOrLower uplo, const AbstractDistMatrix<T>& ARFP,
+  AbstractDistMatrix<T>& A, bool conjugate=false );
+
+// C := alpha A B + beta C (or B A for side=RIGHT) with A in RFP storage
+template<typename T>
+void SymmRFP
+( LeftOrRight side, UpperOrLower uplo,
+  T alpha, const Matrix<T>& ARFP, const Matrix<T>& B, T beta, Matrix<T>& C,
+  bool conjugate=false );
+template<typename T>
+void SymmRFP
+( LeftOrRight side, UpperOrLower uplo,
+  T alpha, const AbstractDistMatrix<T>& ARFP, const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C, bool conjugate=false );
+
+// C := alpha A A^H + beta C (or A^H A) accumulated directly in RFP storage
+template<typename T>
+void HerkRFP
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const Matrix<T>& A, Base<T> beta, Matrix<T>& CRFP );
+template<typename T>
+void HerkRFP
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const AbstractDistMatrix<T>& A,
+  Base<T> beta,        AbstractDistMatrix<T>& CRFP );
+
 // Syrk
 // ====
 template<typename T>
@@ -465,7 +772,8 @@ void Trsm
   F alpha,
   const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<F>& B,
-  bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
+  bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT,
+  const TuningCtrl& tuning=TuningCtrl() );
 
 template<typename F>
 void LocalTrsm
@@ -529,6 +837,16 @@ void LocalTwoSidedTrmm
 
 // TwoSidedTrsm
 // ============
+
+// The number of block steps whose triangular-panel redistributions are
+// aggregated into a single pair of (larger) collectives by the distributed
+// algorithm. Since the triangular matrix is a read-only input, its panel
+// broadcasts have no dependence on the two-sided updates and batching them
+// amortizes their latency at large grid widths; a depth of one recovers the
+// original step-by-step staging
+void SetTwoSidedTrsmAggDepth( Int depth );
+Int TwoSidedTrsmAggDepth() EL_NO_EXCEPT;
+
 template<typename F>
 void TwoSidedTrsm
 ( UpperOrLower uplo, UnitOrNonUnit diag,
@@ -588,6 +906,41 @@ void LocalTrrk
            const DistMatrix<T,MR,  STAR>& B,
   T beta,        DistMatrix<T,MC,  MR  >& C );
 
+// TrrkMulti
+// =========
+// Apply a fused sequence of triangular rank-k updates,
+//
+//   C := beta C + sum_u alpha_u op_u(A_u) op_u(B_u),
+//
+// in a single traversal of the triangular portion of C, so that each block of
+// C is only brought into cache once regardless of the number of updates
+template<typename T>
+struct TrrkUpdate
+{
+    Orientation orientA=NORMAL, orientB=NORMAL;
+    T alpha=T(1);
+    const Matrix<T>* A=nullptr;
+    const Matrix<T>* B=nullptr;
+};
+template<typename T>
+struct DistTrrkUpdate
+{
+    Orientation orientA=NORMAL, orientB=NORMAL;
+    T alpha=T(1);
+    const AbstractDistMatrix<T>* A=nullptr;
+    const AbstractDistMatrix<T>* B=nullptr;
+};
+template<typename T>
+void TrrkMulti
+( UpperOrLower uplo,
+  const vector<TrrkUpdate<T>>& updates,
+  T beta, Matrix<T>& C );
+template<typename T>
+void TrrkMulti
+( UpperOrLower uplo,
+  const vector<DistTrrkUpdate<T>>& updates,
+  T beta, AbstractDistMatrix<T>& C );
+
 // Trr2k
 // =====
 /*
@@ -77,11 +77,128 @@ void Sylvester
 template<typename F>
 void Sylvester
 ( const ElementalMatrix<F>& A,
-  const ElementalMatrix<F>& B, 
+  const ElementalMatrix<F>& B,
   const ElementalMatrix<F>& C,
-        ElementalMatrix<F>& X, 
+        ElementalMatrix<F>& X,
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+// Triangular Sylvester and Lyapunov
+// =================================
+// Solve A X + X op(B) = C, overwriting C with X, where A and B are upper
+// triangular and op is controlled by 'orientB'. The solver recurses on the
+// larger dimension (RECSY style), so that all but the leaf subproblems are
+// rank-k Gemm updates and the distributed solves are level-3-bound rather
+// than latency-bound. Real quasi-triangular inputs (2x2 diagonal bumps
+// from a real Schur form) are not handled; use a complex Schur form
+// instead. A RuntimeError is thrown when A and -op(B) share an eigenvalue.
+template<typename F>
+void TriangularSylvester
+( Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& C,
+  Int blockSize=64 );
+template<typename F>
+void TriangularSylvester
+( Orientation orientB,
+  const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+        ElementalMatrix<F>& C,
+  Int blockSize=64 );
+
+// Solve A X + X A^H = C, overwriting C with X, where A is upper triangular
+template<typename F>
+void TriangularLyapunov
+( const Matrix<F>& A,
+        Matrix<F>& C,
+  Int blockSize=64 );
+template<typename F>
+void TriangularLyapunov
+( const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& C,
+  Int blockSize=64 );
+
+// Kronecker-product operators
+// ===========================
+// A lazy representation of sum_k A_k (x) B_k which applies the operator
+// through the identity (A (x) B) vec(X) = vec(B X A^T) -- a reshape and two
+// Gemms per term -- rather than materializing the (mA mB) x (nA nB)
+// product. Direct solves avoid materialization as well: a single term
+// factors into independent solves with the two factors, and a two-term
+// operator collapses onto a Sylvester equation handled by the sign-function
+// machinery above. Least-squares solves with a single term exploit
+// pinv(A (x) B) = pinv(A) (x) pinv(B).
+
+template<typename Field>
+class KroneckerOperator
+{
+public:
+    KroneckerOperator();
+
+    // Append the term A (x) B; all terms must have matching factor shapes
+    void AddTerm( const Matrix<Field>& A, const Matrix<Field>& B );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int NumTerms() const EL_NO_EXCEPT;
+
+    // Y := (sum_k A_k (x) B_k) X, one vec'd column at a time
+    void Apply( const Matrix<Field>& X, Matrix<Field>& Y ) const;
+    // Y := (sum_k A_k (x) B_k)^H X
+    void AdjointApply( const Matrix<Field>& X, Matrix<Field>& Y ) const;
+
+    // Form the operator as an explicit dense matrix (testing and small
+    // problems only)
+    void Materialize( Matrix<Field>& S ) const;
+
+    // Overwrite each column of B with the solution of the corresponding
+    // linear system (supported for one or two square-factor terms)
+    void Solve
+    ( Matrix<Field>& B,
+      SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() ) const;
+
+    // Overwrite X with the least-squares solution (single term only)
+    void LeastSquares( const Matrix<Field>& B, Matrix<Field>& X ) const;
+
+private:
+    Int mA_=0, nA_=0, mB_=0, nB_=0;
+    vector<Matrix<Field>> AFactors_, BFactors_;
+};
+
+template<typename Field>
+class DistKroneckerOperator
+{
+public:
+    DistKroneckerOperator( const El::Grid& g=El::Grid::Default() );
+
+    void AddTerm
+    ( const ElementalMatrix<Field>& A, const ElementalMatrix<Field>& B );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int NumTerms() const EL_NO_EXCEPT;
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+
+    void Apply
+    ( const ElementalMatrix<Field>& X, ElementalMatrix<Field>& Y ) const;
+    void AdjointApply
+    ( const ElementalMatrix<Field>& X, ElementalMatrix<Field>& Y ) const;
+
+    void Materialize( ElementalMatrix<Field>& S ) const;
+
+    void Solve
+    ( ElementalMatrix<Field>& B,
+      SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() ) const;
+
+    void LeastSquares
+    ( const ElementalMatrix<Field>& B, ElementalMatrix<Field>& X ) const;
+
+private:
+    const El::Grid* grid_;
+    Int mA_=0, nA_=0, mB_=0, nB_=0;
+    vector<DistMatrix<Field>> AFactors_, BFactors_;
+};
+
 } // namespace El
 
 #endif // ifndef EL_CONTROL_HPP
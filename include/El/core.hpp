@@ -41,6 +41,20 @@
 # define EL_RELEASE_ONLY(cmd)
 #endif
 
+// EL_SAMPLED_DEBUG provides a middle ground between the debug and release
+// builds: the cheap argument checks guarded by EL_DEBUG_ONLY remain, the
+// call stack is only pushed for a (thread-local) 1-in-N sample of scopes,
+// and the expensive consistency scans guarded by EL_HEAVY_DEBUG_ONLY are
+// compiled out
+#if defined(EL_RELEASE) && defined(EL_SAMPLED_DEBUG)
+# error EL_SAMPLED_DEBUG is meaningless in a release build
+#endif
+#if defined(EL_RELEASE) || defined(EL_SAMPLED_DEBUG)
+# define EL_HEAVY_DEBUG_ONLY(cmd)
+#else
+# define EL_HEAVY_DEBUG_ONLY(cmd) cmd;
+#endif
+
 #ifdef EL_HAVE_NO_EXCEPT
 # define EL_NO_EXCEPT noexcept
 #else
@@ -247,12 +261,16 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/imports/mpfr.hpp>
 #include <El/core/imports/qt5.hpp>
 
+#include <El/core/Half.hpp>
 #include <El/core/Element/decl.hpp>
 #include <El/core/Serialize.hpp>
 #include <El/core/imports/mpi.hpp>
 #include <El/core/imports/choice.hpp>
 #include <El/core/imports/mpi_choice.hpp>
 #include <El/core/environment/decl.hpp>
+#include <El/core/CpuFeatures.hpp>
+#include <El/core/Compress.hpp>
+#include <El/core/ReproducibleSum.hpp>
 
 #include <El/core/Timer.hpp>
 #include <El/core/indexing/decl.hpp>
@@ -261,6 +279,7 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/imports/flame.hpp>
 #include <El/core/imports/mkl.hpp>
 #include <El/core/imports/openblas.hpp>
+#include <El/core/imports/cublas.hpp>
 #include <El/core/imports/pmrrr.hpp>
 #include <El/core/imports/scalapack.hpp>
 
@@ -287,12 +306,14 @@ class DistMatrix;
 #include <El/core/DistMap/decl.hpp>
 #include <El/core/DistGraph/decl.hpp>
 #include <El/core/SparseMatrix/decl.hpp>
+#include <El/core/BSRMatrix/decl.hpp>
 #include <El/core/DistSparseMatrix/decl.hpp>
 #include <El/core/DistMultiVec/decl.hpp>
 #include <El/core/View/decl.hpp>
 #include <El/blas_like/level1/decl.hpp>
 
 #include <El/core/Matrix/impl.hpp>
+#include <El/core/BatchedMatrix.hpp>
 #include <El/core/Grid.hpp>
 #include <El/core/DistMatrix.hpp>
 #include <El/core/Proxy.hpp>
@@ -312,6 +333,7 @@ class DistMatrix;
 // TODO: Sequential map
 //#include <El/core/Map.hpp>
 #include <El/core/SparseMatrix/impl.hpp>
+#include <El/core/BSRMatrix/impl.hpp>
 
 #include <El/core/DistMap.hpp>
 #include <El/core/DistMultiVec/impl.hpp>
@@ -320,4 +342,6 @@ class DistMatrix;
 #include <El/core/Permutation.hpp>
 #include <El/core/DistPermutation.hpp>
 
+#include <El/core/AxpyInterface.hpp>
+
 #endif // ifndef EL_CORE_HPP
@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_AXPYINTERFACE_HPP
+#define EL_CORE_AXPYINTERFACE_HPP
+
+namespace El {
+
+// A one-sided assembly interface: the attached matrix's local buffer is
+// exposed through an MPI window, and each Axpy call accumulates its dense
+// submatrix directly into the owners' memory with passive-target
+// MPI_Accumulate. There is no rendezvous between the scattering processes
+// and the owners, so arbitrarily many ranks may assemble concurrently
+// (e.g., scattering finite-element contributions); the only collective
+// synchronization is Detach, after which the assembled matrix may be read.
+//
+// Since the accumulations reduce with MPI_SUM, the element type is
+// restricted to those with predefined MPI datatypes, and matrices stored
+// redundantly (e.g., [STAR,STAR]) are not supported, as a one-sided update
+// would only reach a single copy.
+template<typename T>
+class AxpyInterface
+{
+public:
+    AxpyInterface();
+    explicit AxpyInterface( AbstractDistMatrix<T>& Z );
+    // If the interface is still attached, the destructor collectively
+    // detaches it
+    ~AxpyInterface();
+
+    // Collectively (over Z's distribution communicator) expose Z's local
+    // buffer for one-sided accumulation and begin a passive access epoch
+    void Attach( AbstractDistMatrix<T>& Z );
+
+    // Accumulate alpha X onto Z(i:i+X.Height(),j:j+X.Width()). The update
+    // is one-sided and is only guaranteed to have reached the owners after
+    // the next Flush (for updates issued by this process) or Detach (for
+    // the updates of every process).
+    void Axpy( T alpha, const Matrix<T>& X, Int i, Int j );
+
+    // Complete the accumulations issued by this process at their targets
+    void Flush();
+
+    // Collectively complete every process's accumulations and release the
+    // window
+    void Detach();
+
+    bool Attached() const EL_NO_EXCEPT;
+
+private:
+    AbstractDistMatrix<T>* Z_=nullptr;
+    mpi::Window window_;
+    // Each target computes remote displacements from its own leading
+    // dimension, which is therefore gathered from every rank at attachment
+    vector<Int> ldims_;
+    // The packed origin buffers of the outstanding accumulations, which
+    // may not be reused until the next flush
+    vector<vector<T>> pending_;
+    bool attached_=false;
+};
+
+template<typename T>
+AxpyInterface<T>::AxpyInterface() { }
+
+template<typename T>
+AxpyInterface<T>::AxpyInterface( AbstractDistMatrix<T>& Z )
+{ Attach( Z ); }
+
+template<typename T>
+AxpyInterface<T>::~AxpyInterface()
+{
+    if( attached_ )
+        Detach();
+}
+
+template<typename T>
+void AxpyInterface<T>::Attach( AbstractDistMatrix<T>& Z )
+{
+    EL_DEBUG_CSE
+    if( attached_ )
+        LogicError("The interface is already attached");
+    if( Z.RedundantSize() != 1 )
+        LogicError
+        ("One-sided accumulation into redundantly stored matrices is not "
+         "supported");
+    Z_ = &Z;
+    const size_t numBytes = size_t(Z.LDim())*Z.LocalWidth()*sizeof(T);
+    mpi::WinCreate
+    ( Z.Buffer(), numBytes, sizeof(T), Z.DistComm(), window_ );
+    const int commSize = mpi::Size( Z.DistComm() );
+    ldims_.resize( commSize );
+    const Int ldim = Z.LDim();
+    mpi::AllGather( &ldim, 1, ldims_.data(), 1, Z.DistComm() );
+    mpi::WinLockAll( window_ );
+    attached_ = true;
+}
+
+template<typename T>
+void AxpyInterface<T>::Axpy( T alpha, const Matrix<T>& X, Int i, Int j )
+{
+    EL_DEBUG_CSE
+    if( !attached_ )
+        LogicError("Must attach before updating");
+    auto& Z = *Z_;
+    const Int m = X.Height();
+    const Int n = X.Width();
+    EL_DEBUG_ONLY(
+      if( i < 0 || j < 0 )
+          LogicError("Submatrix offsets must be non-negative");
+      if( i+m > Z.Height() || j+n > Z.Width() )
+          LogicError
+          ("Submatrix out of bounds: [",i,",",i+m,") x [",j,",",j+n,") of ",
+           Z.Height()," x ",Z.Width()," matrix");
+    )
+    const Int colStride = Z.ColStride();
+    const T* XBuf = X.LockedBuffer();
+    const Int XLDim = X.LDim();
+    // Within a column, the global rows owned by a process row occupy
+    // consecutive local rows of the target, so a single accumulation per
+    // (process row, column) pair suffices; the strided loads from X are
+    // packed (and scaled) into scratch buffers that must survive until the
+    // next flush
+    for( Int jX=0; jX<n; ++jX )
+    {
+        const Int jZ = j + jX;
+        const int colOwner = Z.ColOwner( jZ );
+        const Int jLocTarget = Z.LocalColOffset( jZ, colOwner );
+        const Int numRuns = Min( colStride, m );
+        for( Int iX0=0; iX0<numRuns; ++iX0 )
+        {
+            const int rowOwner = Z.RowOwner( i+iX0 );
+            const int target = rowOwner + colOwner*colStride;
+            const Int runLength = (m-iX0+colStride-1) / colStride;
+            const Int iLocTarget = Z.LocalRowOffset( i+iX0, rowOwner );
+            vector<T> packed( runLength );
+            for( Int t=0; t<runLength; ++t )
+                packed[t] = alpha*XBuf[(iX0+t*colStride)+jX*XLDim];
+            const mpi::Aint disp =
+              iLocTarget + mpi::Aint(jLocTarget)*ldims_[target];
+            mpi::Accumulate
+            ( packed.data(), int(runLength), target, disp, window_ );
+            pending_.push_back( std::move(packed) );
+        }
+    }
+}
+
+template<typename T>
+void AxpyInterface<T>::Flush()
+{
+    EL_DEBUG_CSE
+    if( !attached_ )
+        LogicError("Must attach before flushing");
+    mpi::WinFlushAll( window_ );
+    SwapClear( pending_ );
+}
+
+template<typename T>
+void AxpyInterface<T>::Detach()
+{
+    EL_DEBUG_CSE
+    if( !attached_ )
+        return;
+    mpi::WinFlushAll( window_ );
+    SwapClear( pending_ );
+    mpi::WinUnlockAll( window_ );
+    // Ensure that every process's accumulations have completed before any
+    // process is allowed to read the assembled matrix
+    mpi::Barrier( Z_->DistComm() );
+    mpi::Free( window_ );
+    SwapClear( ldims_ );
+    Z_ = nullptr;
+    attached_ = false;
+}
+
+template<typename T>
+bool AxpyInterface<T>::Attached() const EL_NO_EXCEPT
+{ return attached_; }
+
+} // namespace El
+
+#endif // ifndef EL_CORE_AXPYINTERFACE_HPP
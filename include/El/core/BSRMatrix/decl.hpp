@@ -0,0 +1,110 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_BSRMATRIX_DECL_HPP
+#define EL_CORE_BSRMATRIX_DECL_HPP
+
+namespace El {
+
+// A Block Compressed Sparse Row (BSR) matrix: the nonzeros are stored as
+// dense blockHeight x blockWidth blocks (each column-major), with a single
+// index pair per block rather than per scalar. Discretizations with natural
+// small-block structure (e.g., 3x3 or 5x5 FEM blocks) therefore store
+// roughly 1/(blockHeight*blockWidth) of the index data of CSR and admit
+// register-blocked multiplication kernels. The block dimensions must evenly
+// divide the matrix dimensions.
+template<typename Ring>
+class BSRMatrix
+{
+public:
+    // Constructors and destructors
+    // ============================
+    BSRMatrix();
+    BSRMatrix( Int height, Int width, Int blockHeight, Int blockWidth );
+    BSRMatrix( const BSRMatrix<Ring>& A );
+    // Convert from scalar CSR storage by grouping each entry into its
+    // enclosing block (zeros within touched blocks are stored explicitly)
+    BSRMatrix
+    ( const SparseMatrix<Ring>& A, Int blockHeight, Int blockWidth );
+    ~BSRMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+    void Empty( bool clearMemory=true );
+    void Resize( Int height, Int width, Int blockHeight, Int blockWidth );
+
+    // Assembly
+    // --------
+    // The reservation is in terms of scalar (queued) updates
+    void Reserve( Int numUpdates );
+    void QueueUpdate( const Entry<Ring>& entry ) EL_NO_RELEASE_EXCEPT;
+    void QueueUpdate
+    ( Int row, Int col, const Ring& value ) EL_NO_RELEASE_EXCEPT;
+    // Queue an entire dense element block at once (the natural FEM
+    // assembly granularity)
+    void QueueBlockUpdate
+    ( Int blockRow, Int blockCol, const Matrix<Ring>& block )
+    EL_NO_RELEASE_EXCEPT;
+    void ProcessQueues();
+
+    // Operator overloading
+    // ====================
+    const BSRMatrix<Ring>& operator=( const BSRMatrix<Ring>& A );
+    const BSRMatrix<Ring>& operator*=( const Ring& alpha );
+
+    // For manually modifying data
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    Int* BlockColBuffer() EL_NO_EXCEPT;
+    Ring* ValueBuffer() EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedBlockColBuffer() const EL_NO_EXCEPT;
+    const Ring* LockedValueBuffer() const EL_NO_EXCEPT;
+
+    // Queries
+    // =======
+
+    // High-level information
+    // ----------------------
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int BlockHeight() const EL_NO_EXCEPT;
+    Int BlockWidth() const EL_NO_EXCEPT;
+    Int NumBlockRows() const EL_NO_EXCEPT;
+    Int NumBlockCols() const EL_NO_EXCEPT;
+    Int NumBlocks() const EL_NO_EXCEPT;
+    Int NumEntries() const EL_NO_EXCEPT;
+
+    // Entrywise information
+    // ---------------------
+    Ring Get( Int row, Int col ) const EL_NO_RELEASE_EXCEPT;
+    Int BlockRowOffset( Int blockRow ) const EL_NO_RELEASE_EXCEPT;
+    Int BlockCol( Int index ) const EL_NO_RELEASE_EXCEPT;
+
+    void AssertConsistent() const;
+
+private:
+    Int height_=0, width_=0;
+    Int blockHeight_=1, blockWidth_=1;
+    // The usual compressed-row structure, but over blocks: row pointers of
+    // length NumBlockRows()+1, one column index per block, and the values of
+    // block t stored column-major in
+    // vals_[t*blockHeight_*blockWidth_,(t+1)*blockHeight_*blockWidth_)
+    vector<Int> blockRowOffsets_;
+    vector<Int> blockCols_;
+    vector<Ring> vals_;
+    vector<Entry<Ring>> queue_;
+};
+
+// Convert back to scalar CSR storage (explicitly stored zeros within the
+// blocks are dropped)
+template<typename Ring>
+void Copy( const BSRMatrix<Ring>& A, SparseMatrix<Ring>& B );
+
+} // namespace El
+
+#endif // ifndef EL_CORE_BSRMATRIX_DECL_HPP
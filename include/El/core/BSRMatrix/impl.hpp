@@ -0,0 +1,384 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_BSRMATRIX_IMPL_HPP
+#define EL_CORE_BSRMATRIX_IMPL_HPP
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename Ring>
+BSRMatrix<Ring>::BSRMatrix() { }
+
+template<typename Ring>
+BSRMatrix<Ring>::BSRMatrix
+( Int height, Int width, Int blockHeight, Int blockWidth )
+{
+    EL_DEBUG_CSE
+    Resize( height, width, blockHeight, blockWidth );
+}
+
+template<typename Ring>
+BSRMatrix<Ring>::BSRMatrix( const BSRMatrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    if( &A != this )
+        *this = A;
+    else
+        LogicError("Tried to construct BSR matrix with itself");
+}
+
+template<typename Ring>
+BSRMatrix<Ring>::BSRMatrix
+( const SparseMatrix<Ring>& A, Int blockHeight, Int blockWidth )
+{
+    EL_DEBUG_CSE
+    Resize( A.Height(), A.Width(), blockHeight, blockWidth );
+    const Int numEntries = A.NumEntries();
+    Reserve( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+        QueueUpdate( A.Row(e), A.Col(e), A.Value(e) );
+    ProcessQueues();
+}
+
+template<typename Ring>
+BSRMatrix<Ring>::~BSRMatrix() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename Ring>
+void BSRMatrix<Ring>::Empty( bool clearMemory )
+{
+    EL_DEBUG_CSE
+    height_ = 0;
+    width_ = 0;
+    blockHeight_ = 1;
+    blockWidth_ = 1;
+    if( clearMemory )
+    {
+        SwapClear( blockRowOffsets_ );
+        SwapClear( blockCols_ );
+        SwapClear( vals_ );
+        SwapClear( queue_ );
+    }
+    else
+    {
+        blockRowOffsets_.resize( 0 );
+        blockCols_.resize( 0 );
+        vals_.resize( 0 );
+        queue_.resize( 0 );
+    }
+    blockRowOffsets_.resize( 1, 0 );
+}
+
+template<typename Ring>
+void BSRMatrix<Ring>::Resize
+( Int height, Int width, Int blockHeight, Int blockWidth )
+{
+    EL_DEBUG_CSE
+    if( blockHeight <= 0 || blockWidth <= 0 )
+        LogicError("The block dimensions must be positive");
+    if( height % blockHeight != 0 || width % blockWidth != 0 )
+        LogicError
+        ("The block dimensions must evenly divide the matrix dimensions");
+    height_ = height;
+    width_ = width;
+    blockHeight_ = blockHeight;
+    blockWidth_ = blockWidth;
+    blockCols_.resize( 0 );
+    vals_.resize( 0 );
+    queue_.resize( 0 );
+    blockRowOffsets_.resize( 0 );
+    blockRowOffsets_.resize( height/blockHeight+1, 0 );
+}
+
+// Assembly
+// --------
+
+template<typename Ring>
+void BSRMatrix<Ring>::Reserve( Int numUpdates )
+{
+    EL_DEBUG_CSE
+    queue_.reserve( queue_.size()+numUpdates );
+}
+
+template<typename Ring>
+void BSRMatrix<Ring>::QueueUpdate( const Entry<Ring>& entry )
+EL_NO_RELEASE_EXCEPT
+{ QueueUpdate( entry.i, entry.j, entry.value ); }
+
+template<typename Ring>
+void BSRMatrix<Ring>::QueueUpdate( Int row, Int col, const Ring& value )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( row < 0 || row >= height_ || col < 0 || col >= width_ )
+          LogicError
+          ("Entry (",row,",",col,") is out of bounds of the ",
+           height_," x ",width_," matrix");
+    )
+    queue_.push_back( Entry<Ring>{row,col,value} );
+}
+
+template<typename Ring>
+void BSRMatrix<Ring>::QueueBlockUpdate
+( Int blockRow, Int blockCol, const Matrix<Ring>& block )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( block.Height() != blockHeight_ || block.Width() != blockWidth_ )
+          LogicError("The update did not match the block dimensions");
+    )
+    const Int rowOff = blockRow*blockHeight_;
+    const Int colOff = blockCol*blockWidth_;
+    for( Int jj=0; jj<blockWidth_; ++jj )
+        for( Int ii=0; ii<blockHeight_; ++ii )
+            QueueUpdate( rowOff+ii, colOff+jj, block(ii,jj) );
+}
+
+template<typename Ring>
+void BSRMatrix<Ring>::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    if( queue_.empty() )
+        return;
+    const Int blockHeight = blockHeight_;
+    const Int blockWidth = blockWidth_;
+    const Int blockSize = blockHeight*blockWidth;
+    const Int numBlockRows = NumBlockRows();
+
+    // Collect the sorted union of the existing blocks and the blocks
+    // enclosing the queued updates
+    vector<pair<Int,Int>> blocks;
+    blocks.reserve( NumBlocks()+queue_.size() );
+    for( Int I=0; I<numBlockRows; ++I )
+        for( Int t=blockRowOffsets_[I]; t<blockRowOffsets_[I+1]; ++t )
+            blocks.emplace_back( I, blockCols_[t] );
+    for( const auto& entry : queue_ )
+        blocks.emplace_back( entry.i/blockHeight, entry.j/blockWidth );
+    std::sort( blocks.begin(), blocks.end() );
+    blocks.erase
+    ( std::unique( blocks.begin(), blocks.end() ), blocks.end() );
+    const Int newNumBlocks = blocks.size();
+
+    // Form the new compressed structure
+    vector<Int> newOffsets( numBlockRows+1 );
+    vector<Int> newCols( newNumBlocks );
+    vector<Ring> newVals( newNumBlocks*blockSize, Ring(0) );
+    {
+        Int t = 0;
+        for( Int I=0; I<=numBlockRows; ++I )
+        {
+            while( t < newNumBlocks && blocks[t].first < I )
+                ++t;
+            newOffsets[I] = t;
+        }
+    }
+    for( Int t=0; t<newNumBlocks; ++t )
+        newCols[t] = blocks[t].second;
+
+    // Scatter the existing blocks into the new structure (both column lists
+    // are sorted and the old blocks are a subset of the new)
+    for( Int I=0; I<numBlockRows; ++I )
+    {
+        Int tNew = newOffsets[I];
+        for( Int t=blockRowOffsets_[I]; t<blockRowOffsets_[I+1]; ++t )
+        {
+            while( newCols[tNew] != blockCols_[t] )
+                ++tNew;
+            std::copy
+            ( vals_.begin()+t*blockSize, vals_.begin()+(t+1)*blockSize,
+              newVals.begin()+tNew*blockSize );
+        }
+    }
+
+    // Accumulate the queued updates
+    for( const auto& entry : queue_ )
+    {
+        const Int I = entry.i/blockHeight;
+        const Int J = entry.j/blockWidth;
+        const Int* colBeg = newCols.data()+newOffsets[I];
+        const Int* colEnd = newCols.data()+newOffsets[I+1];
+        const Int t = newOffsets[I] +
+          Int(std::lower_bound(colBeg,colEnd,J)-colBeg);
+        newVals[t*blockSize+(entry.i-I*blockHeight)+
+                (entry.j-J*blockWidth)*blockHeight] += entry.value;
+    }
+
+    blockRowOffsets_ = std::move( newOffsets );
+    blockCols_ = std::move( newCols );
+    vals_ = std::move( newVals );
+    SwapClear( queue_ );
+}
+
+// Operator overloading
+// ====================
+
+template<typename Ring>
+const BSRMatrix<Ring>&
+BSRMatrix<Ring>::operator=( const BSRMatrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    height_ = A.height_;
+    width_ = A.width_;
+    blockHeight_ = A.blockHeight_;
+    blockWidth_ = A.blockWidth_;
+    blockRowOffsets_ = A.blockRowOffsets_;
+    blockCols_ = A.blockCols_;
+    vals_ = A.vals_;
+    queue_ = A.queue_;
+    return *this;
+}
+
+template<typename Ring>
+const BSRMatrix<Ring>& BSRMatrix<Ring>::operator*=( const Ring& alpha )
+{
+    EL_DEBUG_CSE
+    for( auto& value : vals_ )
+        value *= alpha;
+    for( auto& entry : queue_ )
+        entry.value *= alpha;
+    return *this;
+}
+
+// For manually modifying data
+// ===========================
+
+template<typename Ring>
+Int* BSRMatrix<Ring>::OffsetBuffer() EL_NO_EXCEPT
+{ return blockRowOffsets_.data(); }
+template<typename Ring>
+Int* BSRMatrix<Ring>::BlockColBuffer() EL_NO_EXCEPT
+{ return blockCols_.data(); }
+template<typename Ring>
+Ring* BSRMatrix<Ring>::ValueBuffer() EL_NO_EXCEPT
+{ return vals_.data(); }
+template<typename Ring>
+const Int* BSRMatrix<Ring>::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return blockRowOffsets_.data(); }
+template<typename Ring>
+const Int* BSRMatrix<Ring>::LockedBlockColBuffer() const EL_NO_EXCEPT
+{ return blockCols_.data(); }
+template<typename Ring>
+const Ring* BSRMatrix<Ring>::LockedValueBuffer() const EL_NO_EXCEPT
+{ return vals_.data(); }
+
+// Queries
+// =======
+
+template<typename Ring>
+Int BSRMatrix<Ring>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename Ring>
+Int BSRMatrix<Ring>::Width() const EL_NO_EXCEPT { return width_; }
+template<typename Ring>
+Int BSRMatrix<Ring>::BlockHeight() const EL_NO_EXCEPT
+{ return blockHeight_; }
+template<typename Ring>
+Int BSRMatrix<Ring>::BlockWidth() const EL_NO_EXCEPT
+{ return blockWidth_; }
+template<typename Ring>
+Int BSRMatrix<Ring>::NumBlockRows() const EL_NO_EXCEPT
+{ return height_/blockHeight_; }
+template<typename Ring>
+Int BSRMatrix<Ring>::NumBlockCols() const EL_NO_EXCEPT
+{ return width_/blockWidth_; }
+template<typename Ring>
+Int BSRMatrix<Ring>::NumBlocks() const EL_NO_EXCEPT
+{ return blockCols_.size(); }
+template<typename Ring>
+Int BSRMatrix<Ring>::NumEntries() const EL_NO_EXCEPT
+{ return NumBlocks()*blockHeight_*blockWidth_; }
+
+template<typename Ring>
+Ring BSRMatrix<Ring>::Get( Int row, Int col ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( row == END ) row = height_ - 1;
+    if( col == END ) col = width_ - 1;
+    const Int I = row/blockHeight_;
+    const Int J = col/blockWidth_;
+    const Int* colBeg = blockCols_.data()+blockRowOffsets_[I];
+    const Int* colEnd = blockCols_.data()+blockRowOffsets_[I+1];
+    const Int* it = std::lower_bound( colBeg, colEnd, J );
+    if( it == colEnd || *it != J )
+        return Ring(0);
+    const Int t = blockRowOffsets_[I] + Int(it-colBeg);
+    return vals_[t*blockHeight_*blockWidth_+(row-I*blockHeight_)+
+                 (col-J*blockWidth_)*blockHeight_];
+}
+
+template<typename Ring>
+Int BSRMatrix<Ring>::BlockRowOffset( Int blockRow ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( blockRow < 0 || blockRow > NumBlockRows() )
+          LogicError("Block row out of bounds");
+    )
+    return blockRowOffsets_[blockRow];
+}
+
+template<typename Ring>
+Int BSRMatrix<Ring>::BlockCol( Int index ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( index < 0 || index >= NumBlocks() )
+          LogicError("Block index out of bounds");
+    )
+    return blockCols_[index];
+}
+
+template<typename Ring>
+void BSRMatrix<Ring>::AssertConsistent() const
+{
+    if( !queue_.empty() )
+        LogicError("Queued updates have not yet been processed");
+}
+
+template<typename Ring>
+void Copy( const BSRMatrix<Ring>& A, SparseMatrix<Ring>& B )
+{
+    EL_DEBUG_CSE
+    const Int blockHeight = A.BlockHeight();
+    const Int blockWidth = A.BlockWidth();
+    const Int blockSize = blockHeight*blockWidth;
+    const Int numBlockRows = A.NumBlockRows();
+    const Ring* vals = A.LockedValueBuffer();
+    B.Resize( A.Height(), A.Width() );
+    B.Reserve( A.NumEntries() );
+    for( Int I=0; I<numBlockRows; ++I )
+    {
+        for( Int t=A.BlockRowOffset(I); t<A.BlockRowOffset(I+1); ++t )
+        {
+            const Int J = A.BlockCol(t);
+            for( Int jj=0; jj<blockWidth; ++jj )
+            {
+                for( Int ii=0; ii<blockHeight; ++ii )
+                {
+                    const Ring& value = vals[t*blockSize+ii+jj*blockHeight];
+                    // Zeros explicitly stored within the blocks are dropped
+                    if( value != Ring(0) )
+                        B.QueueUpdate
+                        ( I*blockHeight+ii, J*blockWidth+jj, value );
+                }
+            }
+        }
+    }
+    B.ProcessQueues();
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_BSRMATRIX_IMPL_HPP
@@ -0,0 +1,124 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_BATCHEDMATRIX_HPP
+#define EL_CORE_BATCHEDMATRIX_HPP
+
+namespace El {
+
+// A batch of equally-sized matrices held in a single contiguous slab, with
+// member b beginning MatrixStride() entries after member b-1. The layout is
+// directly consumable by the strided batched BLAS wrappers (e.g.,
+// blas::GemmStridedBatch), PointerList forms the array-of-pointers
+// representation expected by the pointer-based variants, and operator()
+// attaches a Matrix view to an individual member for everything else.
+template<typename Ring>
+class BatchedMatrix
+{
+public:
+    BatchedMatrix() { }
+
+    BatchedMatrix( Int height, Int width, Int numMatrices )
+    { Resize( height, width, numMatrices ); }
+
+    BatchedMatrix( const BatchedMatrix<Ring>& ) = delete;
+    BatchedMatrix<Ring>& operator=( const BatchedMatrix<Ring>& ) = delete;
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    Int LDim() const EL_NO_EXCEPT { return ldim_; }
+    Int NumMatrices() const EL_NO_EXCEPT { return numMatrices_; }
+    // The displacement between consecutive members within the slab
+    Int MatrixStride() const EL_NO_EXCEPT { return stride_; }
+
+    void Resize( Int height, Int width, Int numMatrices )
+    {
+        EL_DEBUG_CSE
+        EL_DEBUG_ONLY(
+          if( height < 0 || width < 0 || numMatrices < 0 )
+              LogicError("Dimensions of a BatchedMatrix cannot be negative");
+        )
+        height_ = height;
+        width_ = width;
+        numMatrices_ = numMatrices;
+        ldim_ = Max( height, 1 );
+        stride_ = ldim_*width;
+        buffer_ = memory_.Require( size_t(stride_)*size_t(numMatrices) );
+    }
+
+    void Empty()
+    {
+        height_ = 0;
+        width_ = 0;
+        numMatrices_ = 0;
+        ldim_ = 1;
+        stride_ = 0;
+        buffer_ = nullptr;
+        memory_.Empty();
+    }
+
+    Ring* Buffer( Int batchIndex=0 ) EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(AssertValidIndex(batchIndex))
+        return &buffer_[batchIndex*stride_];
+    }
+    const Ring* LockedBuffer( Int batchIndex=0 ) const EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(AssertValidIndex(batchIndex))
+        return &buffer_[batchIndex*stride_];
+    }
+
+    // Return a view of an individual member
+    Matrix<Ring> operator()( Int batchIndex )
+    {
+        EL_DEBUG_ONLY(AssertValidIndex(batchIndex))
+        Matrix<Ring> A;
+        A.Attach( height_, width_, &buffer_[batchIndex*stride_], ldim_ );
+        return A;
+    }
+    const Matrix<Ring> operator()( Int batchIndex ) const
+    {
+        EL_DEBUG_ONLY(AssertValidIndex(batchIndex))
+        Matrix<Ring> A;
+        A.LockedAttach( height_, width_, &buffer_[batchIndex*stride_], ldim_ );
+        return A;
+    }
+
+    // Form the array-of-pointers representation of the batch
+    vector<Ring*> PointerList()
+    {
+        vector<Ring*> pointers( numMatrices_ );
+        for( Int b=0; b<numMatrices_; ++b )
+            pointers[b] = &buffer_[b*stride_];
+        return pointers;
+    }
+    vector<const Ring*> LockedPointerList() const
+    {
+        vector<const Ring*> pointers( numMatrices_ );
+        for( Int b=0; b<numMatrices_; ++b )
+            pointers[b] = &buffer_[b*stride_];
+        return pointers;
+    }
+
+private:
+    Int height_=0, width_=0, numMatrices_=0;
+    Int ldim_=1, stride_=0;
+    Memory<Ring> memory_;
+    Ring* buffer_=nullptr;
+
+    void AssertValidIndex( Int batchIndex ) const
+    {
+        if( batchIndex < 0 || batchIndex >= numMatrices_ )
+            LogicError
+            ("Batch index ",batchIndex," is out of bounds of ",numMatrices_);
+    }
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_BATCHEDMATRIX_HPP
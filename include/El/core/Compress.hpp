@@ -0,0 +1,41 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_COMPRESS_HPP
+#define EL_CORE_COMPRESS_HPP
+
+namespace El {
+
+// A small self-contained byte-oriented LZ77 codec (the block format closely
+// follows LZ4: a token carrying the literal-run and match lengths, the
+// literals, and a two-byte match offset within a 64 KiB window). It is meant
+// for low-entropy payloads, such as boundary exchanges and checkpoints of
+// matrices with many repeated or zero entries, where trading a cheap
+// compression pass for wire or disk volume is profitable; incompressible
+// data is detected and should be stored raw by the caller.
+
+// An upper bound on the compressed size of 'rawSize' bytes
+size_t CompressBound( size_t rawSize );
+
+// Compress 'rawSize' bytes into 'compressed', which holds 'compressedCap'
+// bytes, and return the compressed size, or zero if the result would not
+// fit (passing a capacity below 'rawSize' thus rejects unprofitable
+// compression for free)
+size_t Compress
+( const byte* raw, size_t rawSize,
+        byte* compressed, size_t compressedCap );
+
+// Decompress exactly 'rawSize' bytes; a stream which is corrupt or does not
+// decode to 'rawSize' bytes causes a RuntimeError
+void Decompress
+( const byte* compressed, size_t compressedSize,
+        byte* raw, size_t rawSize );
+
+} // namespace El
+
+#endif // ifndef EL_CORE_COMPRESS_HPP
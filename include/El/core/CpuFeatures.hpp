@@ -0,0 +1,56 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_CPUFEATURES_HPP
+#define EL_CORE_CPUFEATURES_HPP
+
+namespace El {
+
+// The SIMD capabilities detected on the executing processor, so that a
+// single binary can select the widest available instruction set at runtime
+// rather than being pinned to the architecture it was compiled for.
+struct CpuFeatures
+{
+    bool avx2=false;
+    bool avx512f=false;
+    bool sve=false;
+};
+
+// Detect (once, on first use) and return the features of the local
+// processor.
+const CpuFeatures& LocalCpuFeatures();
+
+namespace simd {
+
+// Runtime-dispatched local kernels: each is compiled for several
+// instruction sets within the same binary and bound, on first use, to the
+// widest one the local processor supports. These back the non-template
+// StridedMemCopy overloads used by the pack/unpack loops of the DistMatrix
+// redistributions, where the runs are typically too short to amortize a
+// BLAS call.
+void StridedCopy
+(       float* dest,   Int destStride,
+  const float* source, Int sourceStride, Int numEntries );
+void StridedCopy
+(       double* dest,   Int destStride,
+  const double* source, Int sourceStride, Int numEntries );
+
+void StridedAxpy
+(       float alpha,
+  const float* source, Int sourceStride,
+        float* dest,   Int destStride, Int numEntries );
+void StridedAxpy
+(       double alpha,
+  const double* source, Int sourceStride,
+        double* dest,   Int destStride, Int numEntries );
+
+} // namespace simd
+
+} // namespace El
+
+#endif // ifndef EL_CORE_CPUFEATURES_HPP
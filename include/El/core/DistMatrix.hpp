@@ -74,6 +74,10 @@ inline int Context( const AbstractDistMatrix<scalarType>& A )
 
 } // namespace blacs
 
+// Note that an elemental [MC,MR] matrix is accepted as-is: it is the special
+// case of a 2D block-cyclic layout with unit block dimensions, and so its
+// descriptor reinterprets the local buffer in place rather than forcing a
+// redistribution into a block wrapper.
 template<typename scalarType>
 inline typename blacs::Desc
 FillDesc( const AbstractDistMatrix<scalarType>& A )
@@ -74,6 +74,14 @@ public:
 
     // Basic queries
     // =============
+    // Every const query below — as well as the formation of locked views
+    // through El/core/View — only reads immutable snapshots of the matrix,
+    // so multiple threads may issue them concurrently (e.g., to process
+    // disjoint submatrices of one DistMatrix from separate OpenMP tasks)
+    // provided no thread simultaneously resizes, realigns, or attaches the
+    // matrix. The const-qualified pull queue (ReservePulls, QueuePull, and
+    // ProcessPullQueue) is the one exception: it mutates shared state and
+    // must be externally serialized.
 
     // Global matrix information
     // -------------------------
@@ -142,6 +142,17 @@ public:
     ( AbstractDistMatrix<T>& A,
       Int offset=0 ) const;
 
+    // Batched application: permute the rows of every matrix in the batch
+    // with a single metadata computation and one aggregated exchange per
+    // alignment class (a swap sequence is first converted into an explicit
+    // permutation, as the swap protocol would otherwise run once per
+    // matrix). The matrices must be distributed over this permutation's
+    // grid.
+    template<typename T>
+    void PermuteRows( vector<AbstractDistMatrix<T>*>& batch ) const;
+    template<typename T>
+    void InversePermuteRows( vector<AbstractDistMatrix<T>*>& batch ) const;
+
     template<typename T>
     void PermuteSymmetrically
     ( UpperOrLower uplo,
@@ -191,6 +202,46 @@ private:
     mutable bool staleMeta_=false;
 };
 
+// A compiled gather plan for repeatedly applying a frozen permutation to
+// the rows of matrices with a fixed column distribution. Building the plan
+// captures the exchange metadata once, so that each application skips the
+// staleness checks, inversion, and metadata lookups of DistPermutation --
+// worthwhile when the same pivot sequence is applied millions of times
+// during a solve phase. The plan is a snapshot: it is not invalidated by
+// later changes to the permutation it was compiled from.
+class DistPermutationPlan
+{
+public:
+    DistPermutationPlan();
+    DistPermutationPlan
+    ( const DistPermutation& P, Int colAlign, mpi::Comm colComm );
+
+    // (Re)compile the plan for matrices whose column distribution matches
+    // the given alignment and communicator
+    void Build( const DistPermutation& P, Int colAlign, mpi::Comm colComm );
+
+    template<typename T>
+    void PermuteRows( AbstractDistMatrix<T>& A ) const;
+    template<typename T>
+    void InversePermuteRows( AbstractDistMatrix<T>& A ) const;
+
+    // Batched application via one aggregated exchange; every matrix must
+    // match the plan's alignment and communicator
+    template<typename T>
+    void PermuteRows( vector<AbstractDistMatrix<T>*>& batch ) const;
+    template<typename T>
+    void InversePermuteRows( vector<AbstractDistMatrix<T>*>& batch ) const;
+
+    bool Ready() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+
+private:
+    bool ready_=false;
+    Int size_=0;
+    PermutationMeta meta_;
+};
+
 } // namespace El
 
 #endif // ifndef EL_PERM_DISTPERMUTATION_HPP
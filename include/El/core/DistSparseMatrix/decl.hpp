@@ -75,6 +75,9 @@ public:
     EL_NO_RELEASE_EXCEPT;
     void QueueUpdate( Int row, Int col, const Ring& value, bool passive=false )
     EL_NO_RELEASE_EXCEPT;
+    // Queue an entire batch of updates after a single reservation
+    void QueueUpdates( const vector<Entry<Ring>>& entries, bool passive=false )
+    EL_NO_RELEASE_EXCEPT;
     void QueueZero( Int row, Int col, bool passive=false )
     EL_NO_RELEASE_EXCEPT;
 
@@ -88,6 +91,15 @@ public:
     void ProcessQueues();
     void ProcessLocalQueues();
 
+    // Bulk in-place value updates
+    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^
+    // Collectively add to existing nonzeros by global coordinate: the
+    // updates are routed to the owners of their rows and applied in a
+    // single sorted sweep over the local structure, which is left untouched
+    // (so any cached multiply metadata remains valid). Every entry must
+    // already be a member of the sparsity pattern.
+    void UpdateValues( const vector<Entry<Ring>>& entries );
+
     // Operator overloading
     // ====================
 
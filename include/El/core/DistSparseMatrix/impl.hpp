@@ -189,6 +189,34 @@ void DistSparseMatrix<Ring>::QueueUpdate
 EL_NO_RELEASE_EXCEPT
 { QueueUpdate( entry.i, entry.j, entry.value, passive ); }
 
+template<typename Ring>
+void DistSparseMatrix<Ring>::QueueUpdates
+( const vector<Entry<Ring>>& entries, bool passive )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int numEntries = entries.size();
+    if( !FrozenSparsity() )
+    {
+        // Count the local updates so that both the local and remote queues
+        // can be grown with a single reservation apiece
+        const Int height = Height();
+        const Int firstLocalRow = FirstLocalRow();
+        const Int localHeight = LocalHeight();
+        Int numLocal = 0;
+        for( Int s=0; s<numEntries; ++s )
+        {
+            const Int row = ( entries[s].i == END ? height-1 : entries[s].i );
+            if( row >= firstLocalRow && row < firstLocalRow+localHeight )
+                ++numLocal;
+        }
+        const Int numRemote = ( passive ? Int(0) : numEntries-numLocal );
+        Reserve( numLocal, numRemote );
+    }
+    for( Int s=0; s<numEntries; ++s )
+        QueueUpdate( entries[s], passive );
+}
+
 template<typename Ring>
 void DistSparseMatrix<Ring>::QueueLocalUpdate
 ( Int localRow, Int col, const Ring& value ) EL_NO_RELEASE_EXCEPT
@@ -326,6 +354,67 @@ void DistSparseMatrix<Ring>::ProcessQueues()
     ProcessLocalQueues();
 }
 
+template<typename Ring>
+void DistSparseMatrix<Ring>::UpdateValues( const vector<Entry<Ring>>& entries )
+{
+    EL_DEBUG_CSE
+    if( !distGraph_.locallyConsistent_ )
+        LogicError("Cannot update the values of an inconsistent matrix");
+
+    // Route each update to the owner of its row
+    // =========================================
+    mpi::Comm comm = distGraph_.grid_->Comm();
+    const int commSize = distGraph_.grid_->Size();
+    const Int height = Height();
+    const Int width = Width();
+    const Int numEntries = entries.size();
+    vector<int> sendCounts(commSize,0);
+    for( Int s=0; s<numEntries; ++s )
+    {
+        const Int row = ( entries[s].i == END ? height-1 : entries[s].i );
+        ++sendCounts[RowOwner(row)];
+    }
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Entry<Ring>> sendBuf(totalSend);
+    for( Int s=0; s<numEntries; ++s )
+    {
+        const Int row = ( entries[s].i == END ? height-1 : entries[s].i );
+        const Int col = ( entries[s].j == END ? width-1 : entries[s].j );
+        sendBuf[offs[RowOwner(row)]++] =
+          Entry<Ring>{row,col,entries[s].value};
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+
+    // Apply the received updates in a single sorted sweep over the local
+    // structure, which is left untouched (so the cached multiply metadata
+    // remains valid)
+    // ==================================================================
+    std::sort( recvBuf.begin(), recvBuf.end(), CompareEntries );
+    const Int totalRecv = recvBuf.size();
+    const Int firstLocalRow = FirstLocalRow();
+    Int s = 0;
+    while( s < totalRecv )
+    {
+        const Int localRow = recvBuf[s].i - firstLocalRow;
+        const Int rowOff = RowOffset( localRow );
+        const Int rowEnd = rowOff + NumConnections( localRow );
+        Int t = rowOff;
+        for( ; s<totalRecv && recvBuf[s].i-firstLocalRow==localRow; ++s )
+        {
+            const Int col = recvBuf[s].j;
+            while( t < rowEnd && distGraph_.targets_[t] < col )
+                ++t;
+            if( t == rowEnd || distGraph_.targets_[t] != col )
+                LogicError
+                ("Entry (",recvBuf[s].i,",",col,
+                 ") is not in the sparsity pattern");
+            vals_[t] += recvBuf[s].value;
+        }
+    }
+}
+
 template<typename Ring>
 void DistSparseMatrix<Ring>::ProcessLocalQueues()
 {
@@ -363,7 +452,22 @@ void DistSparseMatrix<Ring>::ProcessLocalQueues()
             entries[s] = Entry<Ring>{distGraph_.sources_[s],
                                   distGraph_.targets_[s],vals_[s]};
     }
-    std::sort( entries.begin(), entries.end(), CompareEntries );
+    // The entries kept from the last consistent state form a sorted prefix,
+    // so when only a small tail of updates was queued we sort the tail alone
+    // and merge it in rather than resorting the untouched majority
+    auto middle =
+      std::is_sorted_until( entries.begin(), entries.end(), CompareEntries );
+    if( middle != entries.end() )
+    {
+        if( Int(middle-entries.begin()) >= Int(entries.size())/2 )
+        {
+            std::sort( middle, entries.end(), CompareEntries );
+            std::inplace_merge
+            ( entries.begin(), middle, entries.end(), CompareEntries );
+        }
+        else
+            ParallelSort( entries, CompareEntries );
+    }
     const Int numSorted = entries.size();
 
     // Combine duplicates
@@ -152,6 +152,38 @@ template<typename Real> struct PromoteHelper<Complex<Real>>
 
 template<typename Field> using Promote = typename PromoteHelper<Field>::type;
 
+// Decrease the precision (if possible)
+// ------------------------------------
+template<typename Field> struct DemoteHelper { typedef Field type; };
+template<> struct DemoteHelper<double> { typedef float type; };
+
+#ifdef EL_HAVE_QD
+// Handle the demotion of 'DoubleDouble' and 'QuadDouble'
+template<> struct DemoteHelper<DoubleDouble> { typedef double type; };
+template<> struct DemoteHelper<QuadDouble> { typedef DoubleDouble type; };
+#endif
+
+#ifdef EL_HAVE_QUAD
+// Handle the demotion of 'Quad'
+template<> struct DemoteHelper<Quad> { typedef double type; };
+#endif
+
+#ifdef EL_HAVE_MPC
+// Handle the demotion of 'BigFloat'
+ #ifdef EL_HAVE_QD
+template<> struct DemoteHelper<BigFloat> { typedef QuadDouble type; };
+ #elif defined(EL_HAVE_QUAD)
+template<> struct DemoteHelper<BigFloat> { typedef Quad type; };
+ #else
+template<> struct DemoteHelper<BigFloat> { typedef double type; };
+ #endif
+#endif
+
+template<typename Real> struct DemoteHelper<Complex<Real>>
+{ typedef Complex<typename DemoteHelper<Real>::type> type; };
+
+template<typename Field> using Demote = typename DemoteHelper<Field>::type;
+
 template<typename S,typename T>
 struct CanCast
 {
@@ -277,6 +309,56 @@ void UpdateImagPart( Real& alpha, const Real& beta );
 template<typename Real>
 void UpdateImagPart( Complex<Real>& alpha, const Real& beta ) EL_NO_EXCEPT;
 
+// Fused multiply-accumulate of elements
+// -------------------------------------
+// gamma += alpha*beta. For the built-in types this is mere shorthand, but
+// the BigInt and BigFloat overloads update gamma in place (via mpz_addmul
+// and mpfr_fma), so accumulation loops written in terms of AddMul avoid
+// allocating a multiprecision temporary per term (and, for BigFloat,
+// commit only a single rounding per update)
+template<typename T>
+void AddMul( const T& alpha, const T& beta, T& gamma );
+#ifdef EL_HAVE_MPC
+void AddMul( const BigInt& alpha, const BigInt& beta, BigInt& gamma );
+void AddMul( const BigFloat& alpha, const BigFloat& beta, BigFloat& gamma );
+void AddMul
+( const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>& beta,
+        Complex<BigFloat>& gamma );
+#endif
+
+// Lease a scratch element
+// -----------------------
+// A temporary for use within kernel inner loops: for the built-in types
+// the lease is simply a member variable, but for BigFloat it is drawn from
+// the calling thread's pool of preallocated mpfr variables (see
+// mpfr::AcquireScratch), so that repeatedly invoked kernels do not pay for
+// an allocation per call
+template<typename T>
+class ScratchElement
+{
+public:
+    T& Ref() EL_NO_EXCEPT;
+private:
+    T value_;
+};
+#ifdef EL_HAVE_MPC
+template<>
+class ScratchElement<BigFloat>
+{
+public:
+    ScratchElement();
+    ~ScratchElement();
+    BigFloat& Ref() EL_NO_EXCEPT;
+private:
+    BigFloat* lease_;
+
+    // A lease is scoped to a single owner
+    ScratchElement( const ScratchElement<BigFloat>& );
+    ScratchElement<BigFloat>& operator=( const ScratchElement<BigFloat>& );
+};
+#endif
+
 // Conjugate an element
 // --------------------
 template<typename Real,
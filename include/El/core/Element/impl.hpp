@@ -143,6 +143,18 @@ void UpdateImagPart( Complex<Real>& alpha, const Real& beta )
 EL_NO_EXCEPT
 { alpha.imag( alpha.imag()+beta ); }
 
+// Fused multiply-accumulate of elements
+// -------------------------------------
+template<typename T>
+void AddMul( const T& alpha, const T& beta, T& gamma )
+{ gamma += alpha*beta; }
+
+// Lease a scratch element
+// -----------------------
+template<typename T>
+T& ScratchElement<T>::Ref() EL_NO_EXCEPT
+{ return value_; }
+
 // Conjugate an element
 // --------------------
 template<typename Real,
@@ -10,6 +10,8 @@
 #ifndef EL_GRID_HPP
 #define EL_GRID_HPP
 
+#include <mutex>
+
 namespace El {
 
 class Grid
@@ -18,6 +20,19 @@ public:
     explicit Grid
     ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR );
     explicit Grid( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+    // Topology-aware construction: the processes are assigned to the grid
+    // in an order derived from which of them share a node (discovered via
+    // a shared-memory communicator split), so that, e.g., a NODE_MAJOR
+    // mapping keeps the column broadcasts of matrix multiplication and the
+    // panel factorizations mostly within shared memory
+    explicit Grid
+    ( mpi::Comm comm, int height, GridOrder order, GridMapping mapping );
+    // An explicit version of the above: owningRanks lists, for each
+    // position of the (column-major) owning order, the rank within comm
+    // which should occupy it
+    explicit Grid
+    ( mpi::Comm comm, int height, GridOrder order,
+      const vector<int>& owningRanks );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -28,6 +43,7 @@ public:
     int Size() const EL_NO_EXCEPT;         // VCSize() and VRSize()
     int Rank() const EL_NO_RELEASE_EXCEPT; // same as OwningRank()
     GridOrder Order() const EL_NO_EXCEPT;  // either COLUMN_MAJOR or ROW_MAJOR
+    GridMapping Mapping() const EL_NO_EXCEPT;
     mpi::Comm ColComm() const EL_NO_EXCEPT; // MCComm()
     mpi::Comm RowComm() const EL_NO_EXCEPT; // MRComm()
     // VCComm (VRComm) if COLUMN_MAJOR (ROW_MAJOR)
@@ -59,6 +75,25 @@ public:
     explicit Grid
     ( mpi::Comm viewers, mpi::Group owners, int height,
       GridOrder order=COLUMN_MAJOR );
+    // Construct a (possibly reshaped) grid over the same set of processes
+    // as an existing grid without splitting any communicators up front
+    explicit Grid
+    ( const Grid& grid, int height, GridOrder order=COLUMN_MAJOR );
+    // Split the owning processes into numSubgrids disjoint teams
+    // (contiguous blocks of the column-major owning order, with the
+    // remainder spread over the leading teams) and construct the
+    // subgridIndex'th team's grid. The call is collective over the viewing
+    // communicator and any process may construct any child: the children
+    // all inherit this grid's viewing communicator, so DistMatrix data may
+    // be redistributed between the parent and a child (or between two
+    // children) directly through copy::TranslateBetweenGrids rather than
+    // being staged through a single root.
+    unique_ptr<Grid> Split
+    ( int numSubgrids, int subgridIndex,
+      GridOrder order=COLUMN_MAJOR ) const;
+    // The team that this process's owning rank is dealt to by Split (or -1
+    // if this process merely views the grid)
+    int SplitIndex( int numSubgrids ) const EL_NO_RELEASE_EXCEPT;
     // greatest common denominator of grid height and width
     int GCD() const EL_NO_EXCEPT;
     // lowest common multiple of grid height and width
@@ -101,11 +136,21 @@ public:
     static const Grid& Default() EL_NO_RELEASE_EXCEPT;
     static const Grid& Trivial() EL_NO_RELEASE_EXCEPT;
 
+    // Confine the calling thread to its own default grid (e.g., one grid
+    // per OpenMP task group when running many independent small problems
+    // inside a single process). The caller retains ownership, the override
+    // must outlive its use, and clearing it restores the process-wide
+    // default returned by Default().
+    static void SetThreadDefault( const Grid& grid ) EL_NO_EXCEPT;
+    static void ClearThreadDefault() EL_NO_EXCEPT;
+    static bool HaveThreadDefault() EL_NO_EXCEPT;
+
 private:
     bool haveViewers_;
     int height_, size_, gcd_;
     bool inGrid_;
     GridOrder order_;
+    GridMapping mapping_;
 
     static Grid* defaultGrid;
     static Grid* trivialGrid;
@@ -117,11 +162,20 @@ private:
                owningGroup_;
 
     mpi::Comm viewingComm_,
-              owningComm_,
-              cartComm_,
-              mcComm_, mrComm_,
-              mdComm_, mdPerpComm_,
-              vcComm_, vrComm_;
+              owningComm_;
+
+    // The derived communicators are expensive to split and are therefore
+    // not formed until first use (which must be collective over the owning
+    // team, as is the case for the collectives they feed). The derivation
+    // is guarded by a once-flag so that metadata queries may be issued
+    // concurrently from multiple threads; after the first use, all of the
+    // communicator accessors read an immutable snapshot.
+    mutable std::once_flag commsOnceFlag_;
+    mutable bool commsDerived_;
+    mutable mpi::Comm cartComm_,
+                      mcComm_, mrComm_,
+                      mdComm_, mdPerpComm_,
+                      vcComm_, vrComm_;
 
     int viewingRank_,
         owningRank_,
@@ -135,6 +189,8 @@ private:
 #endif
 
     void SetUpGrid();
+    void DeriveCommunicators() const;
+    void RequireCommunicators() const EL_NO_EXCEPT;
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
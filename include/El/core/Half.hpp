@@ -0,0 +1,244 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_HALF_HPP
+#define EL_CORE_HALF_HPP
+
+#include <cstdint>
+#include <cstring>
+
+namespace El {
+
+// Storage-only 16-bit floating-point types: 'Half' is an IEEE-754 binary16
+// and 'BFloat' is a truncated single-precision ("bfloat16"). All arithmetic
+// is performed by widening to 32-bit floats and rounding the result back
+// down (to nearest, ties to even), so these types exist to halve the memory
+// and communication volume of conversion-based kernels rather than to
+// compute natively in reduced precision.
+
+struct Half
+{
+    uint16_t bits=0;
+
+    Half() EL_NO_EXCEPT { }
+    explicit Half( float value ) EL_NO_EXCEPT : bits(Encode(value)) { }
+    explicit Half( double value ) EL_NO_EXCEPT : bits(Encode(float(value))) { }
+    explicit Half( int value ) EL_NO_EXCEPT : bits(Encode(float(value))) { }
+    explicit Half( long long int value ) EL_NO_EXCEPT
+    : bits(Encode(float(value))) { }
+
+    operator float() const EL_NO_EXCEPT { return Decode(bits); }
+
+    Half& operator+=( const Half& alpha ) EL_NO_EXCEPT
+    { bits = Encode( Decode(bits) + Decode(alpha.bits) ); return *this; }
+    Half& operator-=( const Half& alpha ) EL_NO_EXCEPT
+    { bits = Encode( Decode(bits) - Decode(alpha.bits) ); return *this; }
+    Half& operator*=( const Half& alpha ) EL_NO_EXCEPT
+    { bits = Encode( Decode(bits) * Decode(alpha.bits) ); return *this; }
+    Half& operator/=( const Half& alpha ) EL_NO_EXCEPT
+    { bits = Encode( Decode(bits) / Decode(alpha.bits) ); return *this; }
+
+    static uint16_t Encode( float value ) EL_NO_EXCEPT
+    {
+        uint32_t u;
+        std::memcpy( &u, &value, sizeof(u) );
+        const uint16_t sign = uint16_t((u>>16) & 0x8000u);
+        uint32_t mag = u & 0x7fffffffu;
+        if( mag >= 0x7f800000u )
+        {
+            // Infinities and NaNs (preserving a nonzero NaN payload)
+            const uint16_t mant = uint16_t((mag>>13) & 0x3ffu);
+            return sign | uint16_t(0x7c00u) |
+              ( mag > 0x7f800000u ? uint16_t(0x200u|mant) : uint16_t(0u) );
+        }
+        if( mag >= 0x47800000u )
+        {
+            // Overflow to infinity
+            return sign | uint16_t(0x7c00u);
+        }
+        if( mag >= 0x38800000u )
+        {
+            // Normalized: rebias the exponent and round to nearest even
+            // (a mantissa carry across the exponent boundary is harmless)
+            mag -= 0x38000000u;
+            const uint32_t lsb = (mag>>13) & 1u;
+            mag += 0xfffu + lsb;
+            return sign | uint16_t(mag>>13);
+        }
+        if( mag >= 0x33000000u )
+        {
+            // Subnormal: shift the mantissa (with its implicit bit) into
+            // place, rounding to nearest even
+            const uint32_t shift = 126u - (mag>>23);
+            const uint32_t mant = (mag & 0x7fffffu) | 0x800000u;
+            const uint32_t rounded =
+              ( mant + (1u<<(shift-1)) - 1u + ((mant>>shift)&1u) ) >> shift;
+            return sign | uint16_t(rounded);
+        }
+        // Underflow to (signed) zero
+        return sign;
+    }
+
+    static float Decode( uint16_t h ) EL_NO_EXCEPT
+    {
+        const uint32_t sign = uint32_t(h & 0x8000u) << 16;
+        const uint32_t exp = (h >> 10) & 0x1fu;
+        uint32_t mant = h & 0x3ffu;
+        uint32_t u;
+        if( exp == 0x1fu )
+            u = sign | 0x7f800000u | (mant<<13);
+        else if( exp != 0u )
+            u = sign | ((exp+112u)<<23) | (mant<<13);
+        else if( mant != 0u )
+        {
+            // Normalize the subnormal
+            uint32_t e = 113u;
+            while( !(mant & 0x400u) ) { mant <<= 1; --e; }
+            u = sign | (e<<23) | ((mant & 0x3ffu)<<13);
+        }
+        else
+            u = sign;
+        float value;
+        std::memcpy( &value, &u, sizeof(value) );
+        return value;
+    }
+};
+
+struct BFloat
+{
+    uint16_t bits=0;
+
+    BFloat() EL_NO_EXCEPT { }
+    explicit BFloat( float value ) EL_NO_EXCEPT : bits(Encode(value)) { }
+    explicit BFloat( double value ) EL_NO_EXCEPT
+    : bits(Encode(float(value))) { }
+    explicit BFloat( int value ) EL_NO_EXCEPT : bits(Encode(float(value))) { }
+    explicit BFloat( long long int value ) EL_NO_EXCEPT
+    : bits(Encode(float(value))) { }
+
+    operator float() const EL_NO_EXCEPT { return Decode(bits); }
+
+    BFloat& operator+=( const BFloat& alpha ) EL_NO_EXCEPT
+    { bits = Encode( Decode(bits) + Decode(alpha.bits) ); return *this; }
+    BFloat& operator-=( const BFloat& alpha ) EL_NO_EXCEPT
+    { bits = Encode( Decode(bits) - Decode(alpha.bits) ); return *this; }
+    BFloat& operator*=( const BFloat& alpha ) EL_NO_EXCEPT
+    { bits = Encode( Decode(bits) * Decode(alpha.bits) ); return *this; }
+    BFloat& operator/=( const BFloat& alpha ) EL_NO_EXCEPT
+    { bits = Encode( Decode(bits) / Decode(alpha.bits) ); return *this; }
+
+    static uint16_t Encode( float value ) EL_NO_EXCEPT
+    {
+        uint32_t u;
+        std::memcpy( &u, &value, sizeof(u) );
+        if( (u & 0x7fffffffu) > 0x7f800000u )
+        {
+            // Quiet any NaN whose payload would otherwise truncate to zero
+            return uint16_t((u>>16) | 0x40u);
+        }
+        // Round to nearest even via the usual truncation bias
+        const uint32_t lsb = (u>>16) & 1u;
+        u += 0x7fffu + lsb;
+        return uint16_t(u>>16);
+    }
+
+    static float Decode( uint16_t h ) EL_NO_EXCEPT
+    {
+        const uint32_t u = uint32_t(h) << 16;
+        float value;
+        std::memcpy( &value, &u, sizeof(value) );
+        return value;
+    }
+};
+
+inline Half operator+( const Half& a, const Half& b ) EL_NO_EXCEPT
+{ return Half(float(a)+float(b)); }
+inline Half operator-( const Half& a, const Half& b ) EL_NO_EXCEPT
+{ return Half(float(a)-float(b)); }
+inline Half operator*( const Half& a, const Half& b ) EL_NO_EXCEPT
+{ return Half(float(a)*float(b)); }
+inline Half operator/( const Half& a, const Half& b ) EL_NO_EXCEPT
+{ return Half(float(a)/float(b)); }
+inline Half operator-( const Half& a ) EL_NO_EXCEPT
+{ Half negated; negated.bits = uint16_t(a.bits ^ 0x8000u); return negated; }
+inline bool operator==( const Half& a, const Half& b ) EL_NO_EXCEPT
+{ return float(a) == float(b); }
+inline bool operator!=( const Half& a, const Half& b ) EL_NO_EXCEPT
+{ return float(a) != float(b); }
+inline bool operator<( const Half& a, const Half& b ) EL_NO_EXCEPT
+{ return float(a) < float(b); }
+inline bool operator>( const Half& a, const Half& b ) EL_NO_EXCEPT
+{ return float(a) > float(b); }
+inline bool operator<=( const Half& a, const Half& b ) EL_NO_EXCEPT
+{ return float(a) <= float(b); }
+inline bool operator>=( const Half& a, const Half& b ) EL_NO_EXCEPT
+{ return float(a) >= float(b); }
+
+inline BFloat operator+( const BFloat& a, const BFloat& b ) EL_NO_EXCEPT
+{ return BFloat(float(a)+float(b)); }
+inline BFloat operator-( const BFloat& a, const BFloat& b ) EL_NO_EXCEPT
+{ return BFloat(float(a)-float(b)); }
+inline BFloat operator*( const BFloat& a, const BFloat& b ) EL_NO_EXCEPT
+{ return BFloat(float(a)*float(b)); }
+inline BFloat operator/( const BFloat& a, const BFloat& b ) EL_NO_EXCEPT
+{ return BFloat(float(a)/float(b)); }
+inline BFloat operator-( const BFloat& a ) EL_NO_EXCEPT
+{ BFloat negated; negated.bits = uint16_t(a.bits ^ 0x8000u); return negated; }
+inline bool operator==( const BFloat& a, const BFloat& b ) EL_NO_EXCEPT
+{ return float(a) == float(b); }
+inline bool operator!=( const BFloat& a, const BFloat& b ) EL_NO_EXCEPT
+{ return float(a) != float(b); }
+inline bool operator<( const BFloat& a, const BFloat& b ) EL_NO_EXCEPT
+{ return float(a) < float(b); }
+inline bool operator>( const BFloat& a, const BFloat& b ) EL_NO_EXCEPT
+{ return float(a) > float(b); }
+inline bool operator<=( const BFloat& a, const BFloat& b ) EL_NO_EXCEPT
+{ return float(a) <= float(b); }
+inline bool operator>=( const BFloat& a, const BFloat& b ) EL_NO_EXCEPT
+{ return float(a) >= float(b); }
+
+// The handful of scalar routines required by the core storage templates,
+// which cannot rely on the generic implementations since the half types
+// only convert explicitly
+inline Half RealPart( const Half& alpha ) EL_NO_EXCEPT { return alpha; }
+inline Half ImagPart( const Half& ) EL_NO_EXCEPT { return Half(0.f); }
+inline void SetRealPart( Half& alpha, const Half& beta ) EL_NO_EXCEPT
+{ alpha = beta; }
+inline void UpdateRealPart( Half& alpha, const Half& beta ) EL_NO_EXCEPT
+{ alpha += beta; }
+inline Half Conj( const Half& alpha ) EL_NO_EXCEPT { return alpha; }
+inline Half Abs( const Half& alpha ) EL_NO_EXCEPT
+{ Half absVal; absVal.bits = uint16_t(alpha.bits & 0x7fffu); return absVal; }
+
+inline BFloat RealPart( const BFloat& alpha ) EL_NO_EXCEPT { return alpha; }
+inline BFloat ImagPart( const BFloat& ) EL_NO_EXCEPT { return BFloat(0.f); }
+inline void SetRealPart( BFloat& alpha, const BFloat& beta ) EL_NO_EXCEPT
+{ alpha = beta; }
+inline void UpdateRealPart( BFloat& alpha, const BFloat& beta ) EL_NO_EXCEPT
+{ alpha += beta; }
+inline BFloat Conj( const BFloat& alpha ) EL_NO_EXCEPT { return alpha; }
+inline BFloat Abs( const BFloat& alpha ) EL_NO_EXCEPT
+{ BFloat absVal; absVal.bits = uint16_t(alpha.bits & 0x7fffu); return absVal; }
+
+inline std::ostream& operator<<( std::ostream& os, const Half& alpha )
+{ os << float(alpha); return os; }
+inline std::ostream& operator<<( std::ostream& os, const BFloat& alpha )
+{ os << float(alpha); return os; }
+
+template<> struct IsScalar<Half>
+{ static const bool value=true; };
+template<> struct IsScalar<BFloat>
+{ static const bool value=true; };
+template<> struct IsField<Half>
+{ static const bool value=true; };
+template<> struct IsField<BFloat>
+{ static const bool value=true; };
+
+} // namespace El
+
+#endif // ifndef EL_CORE_HALF_HPP
@@ -782,6 +782,11 @@ int Matrix<Ring>::RowAlign() const EL_NO_EXCEPT { return 0; }
 # define EL_EXTERN extern
 #endif
 
+// The 16-bit storage types are deliberately not in this list: an explicit
+// Matrix<Half>/Matrix<BFloat> instantiation would drag in the level1
+// support of every member (Copy, Zero, GetSubmatrix, ...), which is not
+// instantiated for them; their uses instead instantiate implicitly from
+// the definitions above.
 #define PROTO(Ring) EL_EXTERN template class Matrix<Ring>;
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -11,12 +11,147 @@
 
 namespace El {
 
+// Pool/arena backend
+// ==================
+// When enabled, buffers released by Memory<G> (for types which are both
+// trivially constructible and trivially destructible) are recycled through
+// thread-local size-class pools rather than immediately returned to the
+// global allocator, which avoids allocator contention from short-lived
+// temporaries in hybrid MPI+OpenMP runs.
+void EnableMemoryPools();
+void DisableMemoryPools();
+bool MemoryPoolsEnabled();
+// Return all buffers cached by the calling thread to the global allocator
+void FlushMemoryPool();
+// The number of bytes currently cached by the calling thread
+size_t MemoryPoolCachedBytes();
+// The maximum number of bytes each thread may cache (0 disables the cap)
+void SetMemoryPoolLimit( size_t limitBytes );
+size_t MemoryPoolLimit();
+
+// Allocation tracking
+// ===================
+// Every buffer routed through the pool backend is also counted, so that
+// the number of bytes currently in use and the high-water mark since the
+// last reset are available at runtime; while profiling is enabled, each
+// profiler region additionally records the peak it observed (see
+// Timer.hpp), which attributes memory transients to the responsible
+// algorithm.
+size_t MemoryInUse() EL_NO_EXCEPT;
+size_t MemoryHighWater() EL_NO_EXCEPT;
+void ResetMemoryHighWater();
+
+// Pre-flight memory checks
+// ========================
+// The physical memory of the node which remains available, or zero when
+// the operating system cannot report it
+size_t AvailablePhysicalMemory();
+// Throw a RuntimeError if the given estimate exceeds the available
+// physical memory, so that a doomed run is rejected at submission rather
+// than partway through (see, e.g., SparseLDLFactorization::MemoryEstimate)
+void VerifyMemoryBudget( double requiredBytes );
+
+// NUMA and huge-page policy
+// =========================
+// On multi-socket nodes the operating system places each page of a fresh
+// buffer on the NUMA domain of the thread which first writes it. When
+// first-touch initialization is enabled (and Elemental was compiled with
+// OpenMP), buffers of trivial type are zeroed page-by-page by a
+// statically-scheduled parallel loop rather than by whichever thread
+// happened to allocate them, so that page placement matches the schedule
+// of the parallel kernels which later process the buffer.
+void EnableFirstTouchInit();
+void DisableFirstTouchInit();
+bool FirstTouchInitEnabled();
+// Zero 'numBytes' of 'buffer' using said parallel schedule
+void FirstTouchPages( void* buffer, size_t numBytes );
+
+// The minimum buffer size (in bytes) at which transparent huge pages are
+// requested for fresh allocations (via madvise on Linux and silently
+// ignored elsewhere); zero, the default, disables the request
+void SetHugePageThreshold( size_t thresholdBytes );
+size_t HugePageThreshold();
+void AdviseHugePages( void* buffer, size_t numBytes );
+
+// While an instance is in scope, pooling is forced on for the calling thread
+// (regardless of the global switch), and the thread's cached buffers are
+// flushed when the outermost arena exits; this provides cheap scoped reuse
+// of the temporaries created inside an algorithm.
+class MemoryArena
+{
+public:
+    MemoryArena();
+    ~MemoryArena();
+
+    MemoryArena( const MemoryArena& ) = delete;
+    MemoryArena& operator=( const MemoryArena& ) = delete;
+};
+
+namespace memory_pool {
+
+// Whether Acquire/Return should be preferred over new[]/delete[] for the
+// calling thread at this moment
+bool Active();
+// Allocate at least numBytes (possibly from the thread's pool)
+void* Acquire( size_t numBytes );
+// Attempt to cache the buffer; returns false if the caller should free it
+bool Return( void* buffer, size_t numBytes );
+
+struct Workspace;
+
+} // namespace memory_pool
+
+// Guaranteed allocation-free execution
+// ====================================
+// While an instance is in scope, every buffer of trivial type requested by
+// the calling thread is carved from a single preallocated slab with a stack
+// discipline (out-of-order releases are tolerated by deferring the pop), so
+// that recursive view-based algorithms such as Cholesky, Trsm, and
+// TwoSidedTrmm run without any calls into the global allocator. A strict
+// workspace throws a RuntimeError rather than overflowing, which certifies
+// the guarantee; a non-strict workspace falls back to the global allocator
+// but still records the demand, so the two modes combine into a
+// measure-then-deploy workflow:
+//
+//   const size_t required = WorkspaceRequired( [&]{ Cholesky(LOWER,A); } );
+//   ...
+//   StaticWorkspace workspace( required, true );
+//   Cholesky( LOWER, A ); // guaranteed allocation-free
+//
+// The workspace only governs the calling thread, and every buffer drawn
+// from it must be released before the workspace leaves scope (the usual
+// case, since the drivers release their temporaries on exit).
+class StaticWorkspace
+{
+public:
+    explicit StaticWorkspace( size_t numBytes, bool strict=false );
+    ~StaticWorkspace();
+
+    StaticWorkspace( const StaticWorkspace& ) = delete;
+    StaticWorkspace& operator=( const StaticWorkspace& ) = delete;
+
+    // The high-water mark (in bytes) of the stacked demand observed so far,
+    // which is precisely the capacity a strict workspace would need for the
+    // same sequence of requests
+    size_t PeakBytes() const EL_NO_EXCEPT;
+    size_t Capacity() const EL_NO_EXCEPT;
+
+private:
+    memory_pool::Workspace* workspace_;
+};
+
+// Dry-run the computation inside an empty non-strict workspace and report
+// the capacity which would have satisfied it allocation-free
+size_t WorkspaceRequired( const function<void()>& computation );
+
 template<typename G>
 class Memory
 {
     size_t size_;
     G* rawBuffer_;
     G* buffer_;
+    mpi::Window window_;
+    bool shared_;
 public:
     Memory();
     Memory( size_t size );
@@ -34,6 +169,16 @@ public:
     G* Require( size_t size );
     void Release();
     void Empty();
+
+    // Collectively allocate the buffer inside an MPI-3 window shared by
+    // every process of 'nodeComm' (e.g., the result of mpi::SplitShared),
+    // so that any of them may read another's segment with direct loads via
+    // mpi::WinSharedQuery rather than packing through send buffers. The
+    // call always reallocates, and both it and the eventual Empty (or
+    // destruction) are collective over 'nodeComm'.
+    G* RequireShared( size_t size, mpi::Comm nodeComm );
+    bool Shared() const EL_NO_EXCEPT;
+    mpi::Window SharedWindow() const EL_NO_EXCEPT;
 };
 
 } // namespace El
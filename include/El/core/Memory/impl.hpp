@@ -11,14 +11,44 @@ namespace El {
 
 namespace {
 
+// Only types whose construction and destruction are trivial may be routed
+// through the raw byte pools
 template<typename G>
+struct PoolableMemory
+{
+    static const bool value =
+      std::is_trivially_destructible<G>::value &&
+      std::is_trivially_default_constructible<G>::value;
+};
+
+template<typename G,
+         typename=EnableIf<PoolableMemory<G>>>
+static G* New( size_t size )
+{
+    return static_cast<G*>( memory_pool::Acquire(size*sizeof(G)) );
+}
+
+template<typename G,
+         typename=DisableIf<PoolableMemory<G>>,
+         typename=void>
 static G* New( size_t size )
 {
     return new G[size];
 }
 
-template<typename G>
-static void Delete( G*& ptr )
+template<typename G,
+         typename=EnableIf<PoolableMemory<G>>>
+static void Delete( G*& ptr, size_t size )
+{
+    if( ptr != nullptr && !memory_pool::Return(ptr,size*sizeof(G)) )
+        ::operator delete( static_cast<void*>(ptr) );
+    ptr = nullptr;
+}
+
+template<typename G,
+         typename=DisableIf<PoolableMemory<G>>,
+         typename=void>
+static void Delete( G*& ptr, size_t size )
 {
     delete[] ptr;
     ptr = nullptr;
@@ -28,17 +58,18 @@ static void Delete( G*& ptr )
 
 template<typename G>
 Memory<G>::Memory()
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), window_(), shared_(false)
 { }
 
 template<typename G>
 Memory<G>::Memory( size_t size )
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr), window_(), shared_(false)
 { Require( size ); }
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr), window_(),
+  shared_(false)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -51,12 +82,24 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
     std::swap(size_,mem.size_);
     std::swap(rawBuffer_,mem.rawBuffer_);
     std::swap(buffer_,mem.buffer_);
+    std::swap(window_,mem.window_);
+    std::swap(shared_,mem.shared_);
 }
 
 template<typename G>
-Memory<G>::~Memory() 
-{ 
-    Delete( rawBuffer_ );
+Memory<G>::~Memory()
+{
+    if( shared_ )
+    {
+        // Static-lifetime instances may outlive MPI
+        if( !mpi::Finalized() )
+        {
+            mpi::WinUnlockAll( window_ );
+            mpi::Free( window_ );
+        }
+    }
+    else
+        Delete( rawBuffer_, size_ );
 }
 
 template<typename G>
@@ -68,9 +111,11 @@ size_t  Memory<G>::Size() const EL_NO_EXCEPT { return size_; }
 template<typename G>
 G* Memory<G>::Require( size_t size )
 {
-    if( size > size_ )
+    if( size > size_ || shared_ )
     {
-        Delete( rawBuffer_ );
+        if( shared_ )
+            Empty();
+        Delete( rawBuffer_, size_ );
 
 #ifndef EL_RELEASE
         try {
@@ -93,10 +138,17 @@ G* Memory<G>::Require( size_t size )
             throw e;
         }
 #endif
+        AdviseHugePages( rawBuffer_, size_*sizeof(G) );
+        // Only raw storage may be scribbled over for NUMA page placement
+        const bool firstTouch =
+          PoolableMemory<G>::value && FirstTouchInitEnabled();
+        if( firstTouch )
+            FirstTouchPages( buffer_, size_*sizeof(G) );
 #ifdef EL_ZERO_INIT
-        MemZero( buffer_, size_ );
+        if( !firstTouch )
+            MemZero( buffer_, size_ );
 #elif defined(EL_HAVE_VALGRIND)
-        if( EL_RUNNING_ON_VALGRIND )
+        if( !firstTouch && EL_RUNNING_ON_VALGRIND )
             MemZero( buffer_, size_ );
 #endif
     }
@@ -110,11 +162,53 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    if( shared_ )
+    {
+        // Collective over the communicator passed to RequireShared
+        mpi::WinUnlockAll( window_ );
+        mpi::Free( window_ );
+        rawBuffer_ = nullptr;
+        shared_ = false;
+    }
+    else
+        Delete( rawBuffer_, size_ );
     buffer_ = nullptr;
     size_ = 0;
 }
 
+template<typename G>
+G* Memory<G>::RequireShared( size_t size, mpi::Comm nodeComm )
+{
+    // The window is raw storage, so only trivial types may live in it
+    if( !PoolableMemory<G>::value )
+        LogicError
+        ("Shared windows require trivial construction and destruction");
+    Empty();
+    rawBuffer_ = static_cast<G*>(
+      mpi::WinAllocShared( size*sizeof(G), nodeComm, window_ ) );
+    buffer_ = rawBuffer_;
+    size_ = size;
+    shared_ = true;
+    // Open a passive access epoch so that the other processes of the node
+    // may perform direct loads for the lifetime of the allocation
+    mpi::WinLockAllShared( window_ );
+#ifdef EL_ZERO_INIT
+    MemZero( buffer_, size_ );
+#elif defined(EL_HAVE_VALGRIND)
+    if( EL_RUNNING_ON_VALGRIND )
+        MemZero( buffer_, size_ );
+#endif
+    return buffer_;
+}
+
+template<typename G>
+bool Memory<G>::Shared() const EL_NO_EXCEPT
+{ return shared_; }
+
+template<typename G>
+mpi::Window Memory<G>::SharedWindow() const EL_NO_EXCEPT
+{ return window_; }
+
 #ifdef EL_INSTANTIATE_CORE
 # define EL_EXTERN
 #else
@@ -13,6 +13,23 @@
 
 namespace El {
 
+// Proxy statistics
+// ================
+// Each DistMatrix proxy below either forwards the original matrix (when its
+// distribution and alignments already conform) or silently materializes a
+// redistributed copy. The following counters tally the materializations so
+// that the most proxy-hit distribution combinations can be identified and
+// replaced with native kernels.
+void ClearProxyStatistics();
+// The number of proxies which materialized a redistributed copy
+Int NumProxyRedistributions();
+// The total number of entries materialized by said proxies
+long long NumProxyEntriesRedistributed();
+namespace proxy {
+// Called by the proxies below whenever an actual copy is performed
+void RecordRedistribution( Int height, Int width );
+} // namespace proxy
+
 template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
 class MatrixReadProxy 
 {
@@ -196,6 +213,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     DistMatrixReadProxy
@@ -210,6 +228,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixReadProxy() { delete prox_; }
@@ -262,6 +281,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     DistMatrixReadProxy
@@ -299,6 +319,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixReadProxy() 
@@ -339,6 +360,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     DistMatrixReadProxy
@@ -353,6 +375,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixReadProxy() { delete prox_; }
@@ -411,6 +434,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     DistMatrixReadProxy
@@ -456,6 +480,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixReadProxy() 
@@ -502,6 +527,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
         prox_->Resize( A.Height(), A.Width() );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixWriteProxy() 
@@ -562,6 +588,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
         prox_->Resize( A.Height(), A.Width() );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixWriteProxy() 
@@ -602,6 +629,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
         prox_->Resize( A.Height(), A.Width() );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixWriteProxy() 
@@ -670,6 +698,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
         prox_->Resize( A.Height(), A.Width() );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixWriteProxy() 
@@ -714,6 +743,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixReadWriteProxy() 
@@ -774,6 +804,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.rowAlign );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixReadWriteProxy() 
@@ -814,6 +845,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixReadWriteProxy() 
@@ -882,6 +914,7 @@ public:
         if( ctrl.rowConstrain )
             prox_->AlignRows( ctrl.blockWidth, ctrl.rowAlign, ctrl.rowCut );
         Copy( A, *prox_ );
+        proxy::RecordRedistribution( A.Height(), A.Width() );
     }
 
     ~DistMatrixReadWriteProxy() 
@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_REPRODUCIBLESUM_HPP
+#define EL_CORE_REPRODUCIBLESUM_HPP
+
+namespace El {
+
+// Bitwise-reproducible parallel summation
+// =======================================
+// Floating-point addition is not associative, so the results of the usual
+// AllReduce-based sums depend upon the number of processes and upon the
+// reduction tree chosen by the MPI implementation. When the following mode
+// is enabled, Dot, the Frobenius norm, and the column two-norms instead
+// pre-round each addend into a small number of 31-bit fixed-point words
+// relative to the global maximum absolute value (which is itself exactly
+// reproducible, since max is associative). The words are combined with an
+// exact integer reduction and the result is assembled deterministically, so
+// the computed sum is bitwise identical for any number of processes and any
+// data distribution. The pre-rounded path currently services 'float' and
+// 'double'; other types silently fall back to an ordinary reduction.
+void EnableReproducibleReductions();
+void DisableReproducibleReductions();
+bool ReproducibleReductionsEnabled() EL_NO_EXCEPT;
+
+template<typename Real>
+struct IsReproducible { static const bool value = false; };
+template<>
+struct IsReproducible<float> { static const bool value = true; };
+template<>
+struct IsReproducible<double> { static const bool value = true; };
+
+// Compute 'width' simultaneous global sums, where the local contributions to
+// the j'th sum are the 'height' entries of the j'th column of 'terms' (whose
+// leading dimension is 'ldim'). Every process receives every sum. The exact
+// integer accumulation requires the global number of addends of each sum to
+// be less than 2^31.
+template<typename Real,
+         typename=EnableIf<IsReproducible<Real>>>
+void ReproducibleAllReduceSums
+( Int height,
+  Int width,
+  const Real* terms,
+  Int ldim,
+        Real* sums,
+  mpi::Comm comm );
+template<typename Real,
+         typename=DisableIf<IsReproducible<Real>>,
+         typename=void>
+void ReproducibleAllReduceSums
+( Int height,
+  Int width,
+  const Real* terms,
+  Int ldim,
+        Real* sums,
+  mpi::Comm comm )
+{
+    // There is no pre-rounded path for this type
+    vector<Real> localSums( width, Real(0) );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            localSums[j] += terms[i+j*ldim];
+    mpi::AllReduce( localSums.data(), sums, int(width), mpi::SUM, comm );
+}
+
+template<typename Real>
+Real ReproducibleAllReduceSum
+( const Real* terms, Int numTerms, mpi::Comm comm )
+{
+    Real sum;
+    ReproducibleAllReduceSums
+    ( numTerms, 1, terms, Max(numTerms,Int(1)), &sum, comm );
+    return sum;
+}
+
+template<typename Real>
+Complex<Real> ReproducibleAllReduceSum
+( const Complex<Real>* terms, Int numTerms, mpi::Comm comm )
+{
+    // Sum the real and imaginary parts as two independent columns
+    vector<Real> split( 2*numTerms );
+    for( Int k=0; k<numTerms; ++k )
+    {
+        split[k]          = RealPart( terms[k] );
+        split[numTerms+k] = ImagPart( terms[k] );
+    }
+    Real sums[2];
+    ReproducibleAllReduceSums
+    ( numTerms, 2, split.data(), Max(numTerms,Int(1)), sums, comm );
+    return Complex<Real>( sums[0], sums[1] );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_REPRODUCIBLESUM_HPP
@@ -11,6 +11,118 @@
 
 namespace El {
 
+template<typename T> class Matrix;
+template<typename... ArgPack>
+void LogicError( const ArgPack& ... args );
+
+// Zero-copy serialization views
+// =============================
+// Staging a large matrix through a freshly-allocated byte vector before
+// transport or disk I/O momentarily doubles the memory footprint and touches
+// the payload twice. For datatypes whose in-memory representation is already
+// contiguous and self-contained (i.e., everything but the arbitrary-precision
+// types, which require the packing routines below), the payload can instead
+// be described by a short sequence of iovec-style views over the existing
+// buffer, which writev-style file I/O or an indexed MPI datatype can consume
+// directly. Matrices whose leading dimension exceeds their height are covered
+// with one view per column; packed matrices are covered with a single view.
+
+struct SerializedView
+{
+    const void* buffer;
+    std::size_t size;
+};
+
+struct MutableSerializedView
+{
+    void* buffer;
+    std::size_t size;
+};
+
+// A trivially-copyable description of the payload covered by the views,
+// which callers should emplace at the front of their checkpoint
+struct SerializedMatrixHeader
+{
+    Int height;
+    Int width;
+    Int elementSize;
+};
+
+// NOTE: The views reference A's buffer and are invalidated by any
+//       reallocation of (or assignment to) A
+template<typename T>
+void SerializationViews
+( const Matrix<T>& A,
+  SerializedMatrixHeader& header,
+  std::vector<SerializedView>& views )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int ALDim = A.LDim();
+    const T* ABuf = A.LockedBuffer();
+
+    header.height = m;
+    header.width = n;
+    header.elementSize = sizeof(T);
+
+    views.clear();
+    if( ALDim == m || n <= 1 )
+    {
+        // The payload is already contiguous
+        views.push_back
+        ( SerializedView{ ABuf, std::size_t(m)*std::size_t(n)*sizeof(T) } );
+    }
+    else
+    {
+        views.reserve( n );
+        for( Int j=0; j<n; ++j )
+            views.push_back
+            ( SerializedView{ &ABuf[j*ALDim], std::size_t(m)*sizeof(T) } );
+    }
+}
+
+// Resizes A to conform to the header and returns writable views over its
+// buffer so that the payload can be read back without an intermediate copy
+template<typename T>
+void DeserializationViews
+( const SerializedMatrixHeader& header,
+  Matrix<T>& A,
+  std::vector<MutableSerializedView>& views )
+{
+    if( header.elementSize != Int(sizeof(T)) )
+        LogicError
+        ("Serialized element size (",header.elementSize,
+         ") did not match sizeof(",TypeName<T>(),")");
+    A.Resize( header.height, header.width );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int ALDim = A.LDim();
+    T* ABuf = A.Buffer();
+
+    views.clear();
+    if( ALDim == m || n <= 1 )
+    {
+        views.push_back
+        ( MutableSerializedView
+          { ABuf, std::size_t(m)*std::size_t(n)*sizeof(T) } );
+    }
+    else
+    {
+        views.reserve( n );
+        for( Int j=0; j<n; ++j )
+            views.push_back
+            ( MutableSerializedView
+              { &ABuf[j*ALDim], std::size_t(m)*sizeof(T) } );
+    }
+}
+
+inline std::size_t SerializedSize( const SerializedMatrixHeader& header )
+{
+    return sizeof(SerializedMatrixHeader) +
+           std::size_t(header.height)*std::size_t(header.width)*
+           std::size_t(header.elementSize);
+}
+
 #ifdef EL_HAVE_MPC
 
 byte* Serialize( Int n, const BigInt* x, byte* xPacked );
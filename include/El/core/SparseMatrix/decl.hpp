@@ -65,6 +65,9 @@ public:
     void QueueUpdate( const Entry<Ring>& entry ) EL_NO_RELEASE_EXCEPT;
     void QueueUpdate
     ( Int row, Int col, const Ring& value ) EL_NO_RELEASE_EXCEPT;
+    // Queue an entire batch of updates after a single reservation
+    void QueueUpdates( const vector<Entry<Ring>>& entries )
+    EL_NO_RELEASE_EXCEPT;
     void QueueZero( Int row, Int col ) EL_NO_RELEASE_EXCEPT;
     void ProcessQueues();
 
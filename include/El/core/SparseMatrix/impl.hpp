@@ -142,6 +142,18 @@ void SparseMatrix<Ring>::QueueUpdate( const Entry<Ring>& entry )
 EL_NO_RELEASE_EXCEPT
 { QueueUpdate( entry.i, entry.j, entry.value ); }
 
+template<typename Ring>
+void SparseMatrix<Ring>::QueueUpdates( const vector<Entry<Ring>>& entries )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int numEntries = entries.size();
+    if( !FrozenSparsity() )
+        Reserve( numEntries );
+    for( Int s=0; s<numEntries; ++s )
+        QueueUpdate( entries[s] );
+}
+
 template<typename Ring>
 void SparseMatrix<Ring>::QueueZero( Int row, Int col )
 EL_NO_RELEASE_EXCEPT
@@ -455,7 +467,7 @@ void SparseMatrix<Ring>::ProcessQueues()
               Entry<Ring>{graph_.sources_[s],graph_.targets_[s],vals_[s]};
     }
     CompareEntriesFunctor comparer;
-    std::sort( entries.begin(), entries.end(), comparer );
+    ParallelSort( entries, comparer );
     const Int numSorted = entries.size();
 
     // Compress out duplicates
@@ -42,6 +42,98 @@ private:
     Clock::time_point lastTime_;
 };
 
+// Hierarchical profiling
+// ======================
+// Scoped regions which accumulate their elapsed time into a process-wide
+// tree keyed by the call path (e.g., "Mehrotra/KKTSolve/SparseLDL.Factor").
+// Profiling is disabled by default and then costs only an atomic load per
+// region; the accumulation is guarded by a mutex so that regions may be
+// entered from multiple threads. ProfileReport reduces the minimum, mean,
+// and maximum of each region's total time across the ranks of a
+// communicator, which makes load imbalance directly visible.
+//
+// While profiling is enabled, each region additionally accumulates
+// operation counters: flops modeled from the dimensions of the invoked
+// algorithms (e.g., Gemm and Trsm), bytes moved by the communication
+// wrappers, and bytes allocated through Memory<T>. A region's counters
+// include those of the regions nested beneath it, matching the inclusive
+// time. RooflineReport combines the counters with the elapsed times into a
+// roofline-style summary (rate and arithmetic intensity per region); if
+// the machine's peak rates have been supplied via SetRooflinePeaks, each
+// region is also classified as compute- or bandwidth-bound.
+
+void EnableProfiling();
+void DisableProfiling();
+bool ProfilingEnabled() EL_NO_EXCEPT;
+
+// Discard all accumulated regions (e.g., after a warmup run)
+void ClearProfile();
+
+// Print the per-region min/mean/max over the ranks of the communicator to
+// the given stream on its rank zero; collective over the communicator
+void ProfileReport( ostream& os=cout, mpi::Comm comm=mpi::COMM_WORLD );
+
+// The peak flop rate (per process) and memory bandwidth (per process) used
+// to classify regions in RooflineReport; zero leaves them unspecified
+void SetRooflinePeaks( double flopsPerSec, double bytesPerSec );
+
+// Print the per-region operation counts, rates, and arithmetic intensities
+// to the given stream on the communicator's rank zero; collective
+void RooflineReport( ostream& os=cout, mpi::Comm comm=mpi::COMM_WORLD );
+// Route rank zero's roofline summary into its log file (see LogOS)
+void LogRoofline( mpi::Comm comm=mpi::COMM_WORLD );
+
+// A reduced view of the accumulated profile for programmatic consumption
+// (e.g., by the scaling regression harness): the inclusive time of each
+// region on its slowest rank, which is the quantity a scaling study cares
+// about. Collective over the communicator; the table is only populated on
+// its rank zero, sorted by call path.
+struct ProfileTiming
+{
+    string path;
+    double maxTime;
+    unsigned long numCalls;
+};
+vector<ProfileTiming> ProfileTimings( mpi::Comm comm=mpi::COMM_WORLD );
+
+namespace profile {
+void RegionBegin( const char* name );
+void RegionEnd();
+// Attribute operations to the innermost open region of this thread; cheap
+// no-ops unless profiling is enabled
+void RecordFlops( double numFlops );
+void RecordMemBytes( double numBytes );
+void RecordCommBytes( double numBytes );
+// Fold the current number of live bytes into the open regions' high-water
+// marks (called by the Memory<T> backend after each allocation)
+void RecordMemoryPeak( double liveBytes );
+} // namespace profile
+
+class ProfileRegion
+{
+public:
+    explicit ProfileRegion( const char* name )
+    {
+        if( ProfilingEnabled() )
+        {
+            profile::RegionBegin( name );
+            active_ = true;
+        }
+    }
+
+    ~ProfileRegion()
+    {
+        if( active_ )
+            profile::RegionEnd();
+    }
+
+    ProfileRegion( const ProfileRegion& ) = delete;
+    ProfileRegion& operator=( const ProfileRegion& ) = delete;
+
+private:
+    bool active_=false;
+};
+
 } // namespace El
 
 #endif // ifndef EL_TIMER_HPP
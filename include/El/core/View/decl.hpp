@@ -13,6 +13,10 @@ namespace El {
 
 // View an entire matrix
 // =====================
+// Forming a locked view only reads the source's metadata and buffer
+// pointer, so disjoint (sub)matrix views of one matrix may be formed and
+// processed concurrently by multiple threads; see the thread-safety notes
+// atop the query section of El/core/DistMatrix/Abstract.hpp.
 
 // (Sequential) matrix
 // -------------------
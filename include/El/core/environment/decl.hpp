@@ -93,6 +93,124 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// Scoped override of the algorithmic blocksize (a nonpositive blocksize
+// leaves the stack untouched)
+class BlocksizeGuard
+{
+public:
+    explicit BlocksizeGuard( Int blocksize )
+    : pushed_(blocksize>0)
+    {
+        if( pushed_ )
+            PushBlocksizeStack( blocksize );
+    }
+    ~BlocksizeGuard()
+    {
+        if( pushed_ )
+            PopBlocksizeStack();
+    }
+
+    BlocksizeGuard( const BlocksizeGuard& ) = delete;
+    BlocksizeGuard& operator=( const BlocksizeGuard& ) = delete;
+
+private:
+    bool pushed_;
+};
+
+// Per-call tuning parameters
+// --------------------------
+// The blocksize stack is thread-local, so concurrent solves on separate
+// threads are already tuned independently; the control object below
+// additionally allows the blocksize to be chosen for a single call (to,
+// e.g., Gemm, Trsm, Herk, Cholesky, or LU) without touching the calling
+// thread's stack or the autotuned values. A nonpositive blocksize defers
+// to said mechanisms.
+struct TuningCtrl
+{
+    Int blocksize;
+
+    TuningCtrl() : blocksize(0) { }
+    explicit TuningCtrl( Int blocksize_ ) : blocksize(blocksize_) { }
+};
+
+// Autotuned per-operation blocksizes
+// ----------------------------------
+// Tuned blocksizes are keyed on (operation, datatype, grid shape) and
+// override the global blocksize within the routines which consult them
+// (currently Gemm, Trsm, and Cholesky). When tuning is enabled, a routine
+// without a tuned value calibrates one at first use by timing a small
+// synthetic problem over a set of candidate blocksizes; the results may be
+// persisted to a host-keyed cache file so that later runs skip calibration.
+void EnableBlocksizeTuning();
+void DisableBlocksizeTuning();
+bool BlocksizeTuningEnabled();
+// Returns true while a calibration sweep is running so that routines called
+// from within a timed kernel do not recursively begin their own sweeps
+bool CalibratingBlocksize();
+
+string BlocksizeTuningKey
+( const string& op, const string& type, Int gridHeight, Int gridWidth );
+bool HaveTunedBlocksize( const string& key );
+// Returns the tuned value for the given key, or Blocksize() if none exists
+Int TunedBlocksize( const string& key );
+void SetTunedBlocksize( const string& key, Int blocksize );
+// Times the kernel over each candidate blocksize (synchronized over comm),
+// stores the fastest under the given key, and returns it
+Int CalibrateBlocksize
+( const string& key,
+  const function<void()>& kernel,
+  mpi::Comm comm,
+  const vector<Int>& candidates=vector<Int>{32,64,96,128,192,256} );
+
+// The cache file defaults to "ElBlocksizes.<hostname>" in the working
+// directory
+void SetBlocksizeCacheFile( const string& filename );
+string BlocksizeCacheFile();
+void SaveTunedBlocksizes();
+void LoadTunedBlocksizes();
+
+// Learned algorithm selection
+// ---------------------------
+// Several drivers expose a family of algorithm variants (e.g., the SUMMA
+// variants of Gemm) whose relative performance depends on the problem
+// shape, the process grid, and the datatype. The records below map each
+// (operation, datatype, grid shape, bucketed problem shape) key to the
+// best measured time of every variant which has been tried. When learning
+// is enabled, a routine invoked with its default algorithm consults its
+// record: while any candidate variant remains unmeasured the next
+// unexplored one is chosen (and its time recorded), and afterwards the
+// fastest recorded variant is selected. Since each process must make the
+// same decision, consumers reduce their measurements over the grid before
+// recording them. The history may be persisted across runs, so that a
+// deployment converges onto its best variants without hand-tuning; as with
+// the blocksize cache, the file is keyed on the hostname and homogeneous
+// machines are assumed.
+void EnableAlgorithmLearning();
+void DisableAlgorithmLearning();
+bool AlgorithmLearningEnabled();
+
+// Each problem dimension is bucketed up to the next power of two so that
+// nearby shapes share a record
+string AlgorithmLearningKey
+( const string& op, const string& type,
+  Int gridHeight, Int gridWidth,
+  Int m, Int n, Int k );
+
+// Returns the variant to run: the first unexplored candidate (with
+// 'explore' set, so that the caller knows to time and record the call), or
+// the fastest recorded one once every candidate has been measured
+Int SelectAlgorithm
+( const string& key, const vector<Int>& candidates, bool& explore );
+// Fold a measurement into the history (only improvements are kept)
+void RecordAlgorithmTime( const string& key, Int algorithm, double seconds );
+
+// The history file defaults to "ElAlgorithms.<hostname>" in the working
+// directory
+void SetAlgorithmCacheFile( const string& filename );
+string AlgorithmCacheFile();
+void SaveAlgorithmHistory();
+void LoadAlgorithmHistory();
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -147,6 +265,15 @@ template<typename T,
 void StridedMemCopy
 (       T* dest,   Int destStride,
   const T* source, Int sourceStride, Int numEntries );
+// Non-template overloads for the common precisions which dispatch, at
+// runtime, to kernels compiled for the widest instruction set the local
+// processor supports (see core/CpuFeatures.hpp)
+void StridedMemCopy
+(       float* dest,   Int destStride,
+  const float* source, Int sourceStride, Int numEntries );
+void StridedMemCopy
+(       double* dest,   Int destStride,
+  const double* source, Int sourceStride, Int numEntries );
 
 // A thin wrapper around std::copy
 template<typename S,typename T>
@@ -246,19 +373,38 @@ EL_DEBUG_ONLY(
     void PopCallStack();
     void DumpCallStack( ostream& os=cerr );
 
+    // The sampling rate is only consulted when EL_SAMPLED_DEBUG is defined,
+    // in which case only one in every 'rate' scopes pushes the call stack
+    void SetCallStackSampleRate( Int rate );
+    Int CallStackSampleRate();
+    bool AcquireCallStackSample();
+
     class CallStackEntry
     {
     public:
         CallStackEntry( string s )
         {
+#ifdef EL_SAMPLED_DEBUG
+            if( !AcquireCallStackSample() )
+                return;
+            sampled_ = true;
+#endif
             if( !uncaught_exception() )
                 PushCallStack(s);
         }
         ~CallStackEntry()
         {
+#ifdef EL_SAMPLED_DEBUG
+            if( !sampled_ )
+                return;
+#endif
             if( !uncaught_exception() )
                 PopCallStack();
         }
+#ifdef EL_SAMPLED_DEBUG
+    private:
+        bool sampled_ = false;
+#endif
     };
     typedef CallStackEntry CSE;
 )
@@ -267,8 +413,48 @@ void OpenLog( const char* filename );
 
 std::ostream & LogOS();
 
+// Structured logging
+// ==================
+// Each logged line carries a severity, may be filtered by a threshold or
+// sampled down, and may be written asynchronously: when async logging is
+// enabled, producers only pay for enqueueing the formatted line into a
+// bounded ring buffer which a background thread drains to the log file
+// (dropping the oldest lines if the producers outrun it), so operational
+// logging can stay on in production without perturbing timing. The counts
+// of distinct messages are retained so that LogSummary can aggregate
+// identical messages across ranks instead of emitting one interleaved
+// stream per rank.
+enum LogSeverity
+{
+    LOG_DEBUG=0,
+    LOG_INFO=1,
+    LOG_WARNING=2,
+    LOG_ERROR=3
+};
+
+void EnableAsyncLogging();
+// Drain the ring buffer and join the background thread
+void DisableAsyncLogging();
+bool AsyncLoggingEnabled() EL_NO_EXCEPT;
+
+// Discard messages below the given severity (LOG_DEBUG keeps everything)
+void SetLogThreshold( LogSeverity severity );
+LogSeverity LogThreshold() EL_NO_EXCEPT;
+// Keep only one of every 'interval' messages of the given severity
+void SetLogSamplingInterval( LogSeverity severity, unsigned interval );
+
+// Submit a single formatted line (the Log wrappers call this)
+void LogLine( LogSeverity severity, const string& line );
+
+// Collectively merge the per-rank distinct-message counts onto the root of
+// the communicator and print each message once with its total count and
+// the number of ranks which produced it
+void LogSummary( ostream& os=cout, mpi::Comm comm=mpi::COMM_WORLD );
+
 template<typename... ArgPack>
 void Log( const ArgPack& ... args );
+template<typename... ArgPack>
+void Log( LogSeverity severity, const ArgPack& ... args );
 
 void CloseLog();
 
@@ -376,6 +562,13 @@ bool IsSorted( const vector<T>& x );
 template<typename T>
 bool IsStrictlySorted( const vector<T>& x );
 
+// A shared-memory merge sort which degrades to std::sort when OpenMP is
+// unavailable or the range is too small to be worth forking threads over
+template<typename T,typename Compare>
+void ParallelSort( T* buf, Int n, Compare compare );
+template<typename T,typename Compare>
+void ParallelSort( vector<T>& x, Compare compare );
+
 void Union
 ( vector<Int>& both,
   const vector<Int>& first, const vector<Int>& second );
@@ -216,7 +216,15 @@ void Log( const ArgPack& ... args )
 {
     std::ostringstream str;
     BuildStream( str, args... );
-    LogOS() << str.str() << std::endl;
+    LogLine( LOG_INFO, str.str() );
+}
+
+template<typename... ArgPack>
+void Log( LogSeverity severity, const ArgPack& ... args )
+{
+    std::ostringstream str;
+    BuildStream( str, args... );
+    LogLine( severity, str.str() );
 }
 
 template<typename... ArgPack>
@@ -251,6 +259,48 @@ T Scan( const vector<T>& counts, vector<T>& offsets )
     return total;
 }
 
+template<typename T,typename Compare>
+void ParallelSort( T* buf, Int n, Compare compare )
+{
+#ifdef EL_HYBRID
+    // Avoid forking threads when the bookkeeping would dominate
+    const Int minParallelSize = 1 << 16;
+    const Int maxThreads = omp_get_max_threads();
+    if( maxThreads <= 1 || n < minParallelSize )
+    {
+        std::sort( buf, buf+n, compare );
+        return;
+    }
+    // Restricting to a power of two of chunks keeps the merge tree trivial
+    Int numChunks = 1;
+    while( 2*numChunks <= maxThreads )
+        numChunks *= 2;
+
+    vector<Int> offsets(numChunks+1);
+    for( Int c=0; c<=numChunks; ++c )
+        offsets[c] = (c*n) / numChunks;
+
+    #pragma omp parallel for
+    for( Int c=0; c<numChunks; ++c )
+        std::sort( buf+offsets[c], buf+offsets[c+1], compare );
+
+    for( Int width=1; width<numChunks; width*=2 )
+    {
+        #pragma omp parallel for
+        for( Int c=0; c<numChunks; c+=2*width )
+            std::inplace_merge
+            ( buf+offsets[c], buf+offsets[c+width], buf+offsets[c+2*width],
+              compare );
+    }
+#else
+    std::sort( buf, buf+n, compare );
+#endif
+}
+
+template<typename T,typename Compare>
+void ParallelSort( vector<T>& x, Compare compare )
+{ ParallelSort( x.data(), Int(x.size()), compare ); }
+
 template<typename T>
 void EnsureConsistent( T alpha, mpi::Comm comm, string name )
 {
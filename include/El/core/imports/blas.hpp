@@ -913,6 +913,129 @@ void Trsm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim );
 
+// Batched Level 3 BLAS
+// ====================
+// Uniform groups of independent small operations, e.g., the blocks of a
+// block-diagonal preconditioner. The pointer-array variants accept one
+// pointer per member, while the strided variants address the members at a
+// fixed displacement within a contiguous slab (see BatchedMatrix). The
+// Gemm batches map onto MKL's ?gemm_batch when it is available; all other
+// configurations dispatch the members from a threaded loop.
+
+template<typename T>
+void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* const* A, BlasInt ALDim,
+  const T* const* B, BlasInt BLDim,
+  const T& beta,
+        T* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+
+void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const float& alpha,
+  const float* const* A, BlasInt ALDim,
+  const float* const* B, BlasInt BLDim,
+  const float& beta,
+        float* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const double& alpha,
+  const double* const* A, BlasInt ALDim,
+  const double* const* B, BlasInt BLDim,
+  const double& beta,
+        double* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const scomplex& alpha,
+  const scomplex* const* A, BlasInt ALDim,
+  const scomplex* const* B, BlasInt BLDim,
+  const scomplex& beta,
+        scomplex* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const dcomplex& alpha,
+  const dcomplex* const* A, BlasInt ALDim,
+  const dcomplex* const* B, BlasInt BLDim,
+  const dcomplex& beta,
+        dcomplex* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+
+template<typename T>
+void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim, BlasInt AStride,
+  const T* B, BlasInt BLDim, BlasInt BStride,
+  const T& beta,
+        T* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+
+void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const float& alpha,
+  const float* A, BlasInt ALDim, BlasInt AStride,
+  const float* B, BlasInt BLDim, BlasInt BStride,
+  const float& beta,
+        float* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const double& alpha,
+  const double* A, BlasInt ALDim, BlasInt AStride,
+  const double* B, BlasInt BLDim, BlasInt BStride,
+  const double& beta,
+        double* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const scomplex& alpha,
+  const scomplex* A, BlasInt ALDim, BlasInt AStride,
+  const scomplex* B, BlasInt BLDim, BlasInt BStride,
+  const scomplex& beta,
+        scomplex* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const dcomplex& alpha,
+  const dcomplex* A, BlasInt ALDim, BlasInt AStride,
+  const dcomplex* B, BlasInt BLDim, BlasInt BStride,
+  const dcomplex& beta,
+        dcomplex* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+
+template<typename F>
+void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* const* A, BlasInt ALDim,
+        F* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+
+template<typename F>
+void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim, BlasInt AStride,
+        F* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+
 } // namespace blas
 } // namespace El
 
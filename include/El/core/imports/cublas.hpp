@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_CUBLAS_HPP
+#define EL_IMPORTS_CUBLAS_HPP
+
+namespace El {
+namespace cublas {
+
+// The runtime toggle is always available so that callers need not guard on
+// the build configuration; enabling it without cuBLAS support is an error
+void SetGpuOffload( bool offload );
+bool GpuOffload();
+
+// Kernels whose geometric-mean dimension falls below this threshold stay on
+// the host, since staging the operands over the bus would dominate
+void SetGpuOffloadThreshold( BlasInt dim );
+BlasInt GpuOffloadThreshold();
+bool WorthOffloading( BlasInt m, BlasInt n, BlasInt k );
+
+#ifdef EL_HAVE_CUBLAS
+
+// Host-staged wrappers: the operands are copied to the device, the kernel
+// runs there, and the result is copied back. Only the BLAS-compatible
+// datatypes are supported.
+
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  float alpha, const float* A, BlasInt ALDim,
+               const float* B, BlasInt BLDim,
+  float beta,        float* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  double alpha, const double* A, BlasInt ALDim,
+                const double* B, BlasInt BLDim,
+  double beta,        double* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  scomplex alpha, const scomplex* A, BlasInt ALDim,
+                  const scomplex* B, BlasInt BLDim,
+  scomplex beta,        scomplex* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  dcomplex alpha, const dcomplex* A, BlasInt ALDim,
+                  const dcomplex* B, BlasInt BLDim,
+  dcomplex beta,        dcomplex* C, BlasInt CLDim );
+
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  float alpha, const float* A, BlasInt ALDim,
+                     float* B, BlasInt BLDim );
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  double alpha, const double* A, BlasInt ALDim,
+                      double* B, BlasInt BLDim );
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  scomplex alpha, const scomplex* A, BlasInt ALDim,
+                        scomplex* B, BlasInt BLDim );
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  dcomplex alpha, const dcomplex* A, BlasInt ALDim,
+                        dcomplex* B, BlasInt BLDim );
+
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  float alpha, const float* A, BlasInt ALDim,
+  float beta,        float* C, BlasInt CLDim );
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  double alpha, const double* A, BlasInt ALDim,
+  double beta,        double* C, BlasInt CLDim );
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  float alpha, const scomplex* A, BlasInt ALDim,
+  float beta,        scomplex* C, BlasInt CLDim );
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  double alpha, const dcomplex* A, BlasInt ALDim,
+  double beta,        dcomplex* C, BlasInt CLDim );
+
+#endif // ifdef EL_HAVE_CUBLAS
+
+} // namespace cublas
+} // namespace El
+
+#endif // ifndef EL_IMPORTS_CUBLAS_HPP
@@ -649,6 +649,19 @@ bool operator!=( const BigFloat& a, const BigFloat& b );
 std::ostream& operator<<( std::ostream& os, const BigFloat& alpha );
 std::istream& operator>>( std::istream& is,       BigFloat& alpha );
 
+namespace mpfr {
+
+// Lease (and later return) a preallocated temporary from the calling
+// thread's pool of mpfr variables. Each thread's pool grows on demand and
+// recycles its variables, so that, in the steady state, requesting a
+// temporary inside an inner kernel loop costs a pointer pop rather than a
+// heap allocation; the pool is released when its thread exits. Consumers
+// should prefer the RAII interface provided by ScratchElement<BigFloat>.
+BigFloat* AcquireScratch();
+void ReleaseScratch( BigFloat* scratch );
+
+} // namespace mpfr
+
 } // namespace El
 #endif // ifdef EL_HAVE_MPC
 
@@ -12,6 +12,8 @@
 #ifndef EL_IMPORTS_MPI_HPP
 #define EL_IMPORTS_MPI_HPP
 
+#include <chrono>
+
 namespace El {
 
 using std::function;
@@ -26,6 +28,13 @@ namespace mpi {
 #define EL_HAVE_NONBLOCKING 0
 #endif
 
+// The MPI-3 standard guarantees the MPI_I* routines used by the
+// non-blocking collective wrappers below
+#if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) && \
+   !defined(EL_HAVE_NONBLOCKING_COLLECTIVES)
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
+#endif
+
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
 #define EL_NONBLOCKING_COLL(name) MPI_ ## name
@@ -66,6 +75,16 @@ inline bool operator==( const Group& a, const Group& b ) EL_NO_EXCEPT
 inline bool operator!=( const Group& a, const Group& b ) EL_NO_EXCEPT
 { return a.group != b.group; }
 
+struct Window
+{
+    MPI_Win win;
+    Window( MPI_Win mpiWin=MPI_WIN_NULL ) EL_NO_EXCEPT : win(mpiWin) { }
+};
+inline bool operator==( const Window& a, const Window& b ) EL_NO_EXCEPT
+{ return a.win == b.win; }
+inline bool operator!=( const Window& a, const Window& b ) EL_NO_EXCEPT
+{ return a.win != b.win; }
+
 struct Op
 {
     MPI_Op op;
@@ -76,6 +95,88 @@ inline bool operator==( const Op& a, const Op& b ) EL_NO_EXCEPT
 inline bool operator!=( const Op& a, const Op& b ) EL_NO_EXCEPT
 { return a.op != b.op; }
 
+// Communication statistics
+// ========================
+// Optional per-communicator counters for the number of wrapper calls, the
+// number of bytes this rank contributed, and the time spent inside the
+// wrappers, so that the communication volume of an algorithm (e.g.,
+// SUMMA_NN over a grid's VC communicator) can be measured without external
+// tools. Collection is disabled by default, in which case each
+// instrumented wrapper pays only a single branch.
+
+struct CommStats
+{
+    unsigned long long numMsgs=0;
+    unsigned long long numBytes=0;
+    double totalTime=0;
+};
+
+void EnableCommStats();
+void DisableCommStats();
+bool CommStatsEnabled() EL_NO_EXCEPT;
+void ClearCommStats();
+// Return the statistics accumulated against the given communicator on this
+// rank (purely local; combine across ranks with AllReduce if desired)
+CommStats GetCommStats( Comm comm );
+
+namespace comm_stats {
+void Record( Comm comm, size_t numBytes, double elapsed );
+// Whether any consumer (the per-communicator statistics or the profiler's
+// roofline counters) is currently recording the wrapper calls
+bool Instrumenting() EL_NO_EXCEPT;
+} // namespace comm_stats
+
+// An RAII guard which instruments a single wrapper call
+class CommStatsEntry
+{
+public:
+    CommStatsEntry( Comm comm, size_t numBytes ) EL_NO_EXCEPT
+    {
+        if( comm_stats::Instrumenting() )
+        {
+            comm_ = comm;
+            numBytes_ = numBytes;
+            active_ = true;
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~CommStatsEntry()
+    {
+        if( active_ )
+        {
+            const auto elapsed =
+              std::chrono::duration_cast<std::chrono::duration<double>>
+              ( std::chrono::steady_clock::now() - start_ );
+            comm_stats::Record( comm_, numBytes_, elapsed.count() );
+        }
+    }
+
+    CommStatsEntry( const CommStatsEntry& ) = delete;
+    CommStatsEntry& operator=( const CommStatsEntry& ) = delete;
+
+private:
+    Comm comm_;
+    size_t numBytes_=0;
+    bool active_=false;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Optional transparent compression of large point-to-point payloads: when
+// enabled for a communicator, messages whose raw size meets the threshold
+// travel as a stream of independently compressed chunks (see
+// core/Compress.hpp), with the compression of each chunk overlapped with
+// the transmission of its predecessor. Incompressible chunks are detected
+// and sent raw, so the worst case costs one flag byte per chunk. Since the
+// sender and receiver of a message must make the same framing decision,
+// the opt-in and the threshold must be set consistently on every rank of
+// the communicator.
+void EnableCommCompression( Comm comm );
+void DisableCommCompression( Comm comm );
+bool CommCompressionEnabled( Comm comm );
+void SetCommCompressionThreshold( size_t numBytes );
+size_t CommCompressionThreshold() EL_NO_EXCEPT;
+
 // Datatype definitions
 // TODO(poulson): Convert these to structs/classes
 typedef MPI_Aint Aint;
@@ -92,6 +193,9 @@ struct Request
     MPI_Request backend;
 
     vector<byte> buffer;
+    // Serialized send payloads must outlive the call for non-blocking
+    // routines operating on non-packed datatypes
+    vector<byte> sendBuffer;
     bool receivingPacked=false;
     int recvCount;
     T* unpackedRecvBuf;
@@ -222,6 +326,17 @@ void Finalize() EL_NO_EXCEPT;
 bool Initialized() EL_NO_EXCEPT;
 bool Finalized() EL_NO_EXCEPT;
 int QueryThread() EL_NO_EXCEPT;
+// Some MPI implementations only advance nonblocking operations within calls
+// into the library, which defeats the overlap of communication with
+// computation. The progress thread periodically polls the library over a
+// private duplicate of the world communicator so that outstanding
+// operations complete while the main thread computes; it requires that MPI
+// was initialized with MPI_THREAD_MULTIPLE support and is unnecessary when
+// the implementation progresses asynchronously (e.g., via hardware tag
+// matching).
+void StartProgressThread();
+void StopProgressThread();
+bool ProgressThreadRunning() EL_NO_EXCEPT;
 void Abort( Comm comm, int errCode ) EL_NO_EXCEPT;
 double Time() EL_NO_EXCEPT;
 void Create( UserFunction* func, bool commutes, Op& op ) EL_NO_RELEASE_EXCEPT;
@@ -235,7 +350,44 @@ void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split into the largest subcommunicators whose processes can share memory
+// (one per node when MPI-3's split-type query is available)
+void SplitShared( Comm comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
+
+// Shared-memory windows (MPI-3)
+// -----------------------------
+// Whether the MPI implementation supports allocating shared windows
+bool HaveSharedWindows() EL_NO_EXCEPT;
+// Collectively allocate numBytes of this process's segment of a window
+// shared by every process of 'comm' (which must be intra-node, e.g., the
+// result of SplitShared) and return the local segment's base address
+void* WinAllocShared( size_t numBytes, Comm comm, Window& window );
+// Return the base address of the given rank's segment of a shared window
+void* WinSharedQuery( Window& window, int rank );
+// Begin/end a passive access epoch permitting direct loads and stores on
+// every segment of a shared window
+void WinLockAllShared( Window& window );
+void WinUnlockAll( Window& window );
+void Free( Window& window );
+
+// One-sided accumulation (MPI-2/MPI-3)
+// ------------------------------------
+// Collectively expose numBytes of locally-owned memory to one-sided access
+// by the processes of 'comm'; displacements into the window are measured in
+// units of 'dispUnit' bytes
+void WinCreate
+( void* buffer, size_t numBytes, int dispUnit, Comm comm, Window& window );
+// Begin a passive-target access epoch on every rank of a (general) window
+void WinLockAll( Window& window );
+// Complete the accumulations issued on the window by this process
+void WinFlushAll( Window& window );
+// Accumulate a contiguous buffer onto the target's window with MPI_SUM,
+// which restricts T to the types with predefined MPI datatypes
+template<typename T>
+void Accumulate
+( const T* buffer, int count, int target, Aint targetDisp, Window& window )
+EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
 ( Comm comm, ErrorHandler errorHandler ) EL_NO_RELEASE_EXCEPT;
@@ -466,6 +618,60 @@ template<typename T>
 void ISSend( T b, int to, Comm comm, Request<T>& request )
 EL_NO_RELEASE_EXCEPT;
 
+// Persistent send
+// ---------------
+// The request is formed once (MPI_Send_init) and may then be replayed an
+// arbitrary number of times via Start/StartAll followed by Wait/WaitAll
+// before finally being released with RequestFree. Since the attached buffer
+// is transmitted in place on every replay, only packed datatypes are
+// supported (the serialization performed for, e.g., BigFloat would have to
+// be repeated before each replay, which would defeat the purpose).
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void SendInit
+( const Real* buf, int count, int to, int tag, Comm comm,
+  Request<Real>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void SendInit
+( const Complex<Real>* buf, int count, int to, int tag, Comm comm,
+  Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void SendInit
+( const T* buf, int count, int to, int tag, Comm comm,
+  Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+
+// Persistent recv
+// ---------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void RecvInit
+( Real* buf, int count, int from, int tag, Comm comm,
+  Request<Real>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void RecvInit
+( Complex<Real>* buf, int count, int from, int tag, Comm comm,
+  Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void RecvInit
+( T* buf, int count, int from, int tag, Comm comm,
+  Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+
+// Begin a replay of persistent request(s)
+template<typename T>
+void Start( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void StartAll( int numRequests, Request<T>* requests ) EL_NO_RELEASE_EXCEPT;
+
+// Release a persistent request
+template<typename T>
+void RequestFree( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+
 // Recv
 // ----
 template<typename Real,
@@ -751,6 +957,28 @@ void AllGather
         T* rbuf, const int* rcs, const int* rds, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking allgather
+// ----------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
 // Scatter
 // -------
 template<typename Real,
@@ -1022,6 +1250,62 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Reduced-precision AllReduce
+// ---------------------------
+// Opt-in, per call site, to a narrower wire format for reductions whose
+// consumers only need a few digits (e.g., convergence checks and norm
+// estimates): the operands are down-converted locally, reduced over the
+// wire in the narrow type, and up-converted on return. SINGLE_WIRE uses
+// the native float reduction; HALF_WIRE packs IEEE binary16 and reduces
+// with a custom operation (SUM, MAX, or MIN only), quartering the bytes of
+// a double reduction. FULL_WIRE falls through to the standard wrapper.
+enum WirePrecision
+{
+  FULL_WIRE,
+  SINGLE_WIRE,
+  HALF_WIRE
+};
+
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void AllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  WirePrecision precision )
+EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void AllReduce
+( Real* buf, int count, Op op, Comm comm, WirePrecision precision )
+EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+Real AllReduce( Real sb, Op op, Comm comm, WirePrecision precision )
+EL_NO_RELEASE_EXCEPT;
+
+// Non-blocking allreduce
+// ----------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op,
+  Comm comm, Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce( const T* sbuf, T* rbuf, int count, Comm comm,
+  Request<T>& request );
+
 // ReduceScatter
 // -------------
 template<typename Real,
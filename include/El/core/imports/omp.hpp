@@ -22,10 +22,37 @@
 # else
 #  define EL_SIMD
 # endif
+# ifdef EL_HAVE_OMP_TASK
+#  define EL_PARALLEL_REGION _Pragma("omp parallel")
+#  define EL_SINGLE _Pragma("omp single")
+#  define EL_TASK _Pragma("omp task")
+#  define EL_TASKWAIT _Pragma("omp taskwait")
+#  if _OPENMP >= 201307
+// OpenMP 4.0 task dependencies allow loop bodies to be scheduled as a DAG
+// of tasks rather than in program order, e.g.,
+//   EL_TASK_DEPEND(depend(in:A[0]) depend(inout:B[0]))
+#   define EL_HAVE_OMP_TASK_DEPEND
+#   define EL_PRAGMA(decl) _Pragma(#decl)
+#   define EL_TASK_DEPEND(deps) EL_PRAGMA(omp task deps)
+#  else
+#   define EL_TASK_DEPEND(deps) EL_TASK
+#  endif
+# else
+#  define EL_PARALLEL_REGION
+#  define EL_SINGLE
+#  define EL_TASK
+#  define EL_TASKWAIT
+#  define EL_TASK_DEPEND(deps)
+# endif
 #else
-# define EL_PARALLEL_FOR 
+# define EL_PARALLEL_FOR
 # define EL_PARALLEL_FOR_COLLAPSE2
 # define EL_SIMD
+# define EL_PARALLEL_REGION
+# define EL_SINGLE
+# define EL_TASK
+# define EL_TASKWAIT
+# define EL_TASK_DEPEND(deps)
 #endif
 
 #ifdef EL_AVOID_OMP_FMA
@@ -51,12 +51,23 @@ Info Eig
 ( int n, double* d, double* e, double* w, mpi::Comm comm, 
   int lowerBound, int upperBound );
 
-// Compute all of the eigenpairs with ordered eigenvalue indices in 
+// Compute all of the eigenpairs with ordered eigenvalue indices in
 // [lowerBound,upperBound)
 Info Eig
-( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm, 
+( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm,
   int lowerBound, int upperBound );
 
+// Compute the same eigenpairs by splitting the communicator into (at most)
+// numSlices contiguous teams of processes, each of which independently (and
+// therefore concurrently) runs PMRRR over a disjoint contiguous subwindow of
+// the requested indices. On exit, the eigenpairs are cyclically wrapped over
+// the original communicator in ascending order: the eigenpair with ordered
+// index lowerBound+j is stored by process j mod commSize, in entry
+// floor(j/commSize) of w and the corresponding column of Z.
+Info SlicedEig
+( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm,
+  int lowerBound, int upperBound, int numSlices );
+
 } // namespace herm_tridiag_eig
 } // namespace El
 
@@ -9,6 +9,8 @@
 #ifndef EL_RANDOM_DECL_HPP
 #define EL_RANDOM_DECL_HPP
 
+#include <cstdint>
+
 namespace El {
 
 std::mt19937& Generator();
@@ -99,6 +101,42 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based generation (Philox)
+// =================================
+// A Philox-4x32-10 counter-based generator: the four 32-bit outputs are a
+// pure function of a 128-bit counter and a 64-bit key, so a process can
+// draw the entries it owns directly from their global indices (i,j) and
+// obtain a bit-identical matrix for every grid shape and process count,
+// rather than serializing through a shared stream.
+void Philox4x32
+( const uint32_t counter[4], const uint32_t key[2], uint32_t output[4] );
+
+// The key shared by the counter-based samplers; InitializeRandom installs
+// a key which is identical on every rank (unlike the per-rank seeds of the
+// classical generators, which must differ)
+void SetPhiloxKey( uint64_t key );
+uint64_t PhiloxKey();
+// Reserve the stream for the next counter-based fill; the stream is mixed
+// into the key so that successive fills draw independent matrices, and
+// collective usage keeps the stream counter synchronized across the ranks
+uint64_t NextPhiloxStream();
+
+// Pure-function analogues of SampleBall and SampleNormal for global entry
+// (i,j) of the given stream
+template<typename F>
+F CounterSampleBall
+( uint64_t stream, Int i, Int j,
+  const F& center=F(0), const Base<F>& radius=Base<F>(1) );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+Real CounterSampleBall
+( uint64_t stream, Int i, Int j,
+  const Real& center=Real(0), const Real& radius=Real(1) );
+
+template<typename T=double>
+T CounterSampleNormal
+( uint64_t stream, Int i, Int j,
+  const T& mean=T(0), const Base<T>& stddev=Base<T>(1) );
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
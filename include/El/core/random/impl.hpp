@@ -223,6 +223,106 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(center-radius,center+radius); }
 
+inline void Philox4x32
+( const uint32_t counter[4], const uint32_t key[2], uint32_t output[4] )
+{
+    uint32_t x0=counter[0], x1=counter[1], x2=counter[2], x3=counter[3];
+    uint32_t k0=key[0], k1=key[1];
+    for( int round=0; round<10; ++round )
+    {
+        const uint64_t prod0 = uint64_t(0xD2511F53u)*x0;
+        const uint64_t prod1 = uint64_t(0xCD9E8D57u)*x2;
+        x0 = uint32_t(prod1>>32) ^ x1 ^ k0;
+        x1 = uint32_t(prod1);
+        x2 = uint32_t(prod0>>32) ^ x3 ^ k1;
+        x3 = uint32_t(prod0);
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
+    output[0] = x0;
+    output[1] = x1;
+    output[2] = x2;
+    output[3] = x3;
+}
+
+namespace counter_rng {
+
+// Map 64 uniform bits onto the 2^-53 grid over (0,1] (the exclusion of
+// zero keeps the logarithm of the Box-Muller transform finite)
+template<typename Real>
+Real UniformBits( uint32_t w0, uint32_t w1 )
+{
+    const uint64_t bits = (uint64_t(w0)<<32) | w1;
+    return Real((bits>>11)+1) / Real(9007199254740992.);
+}
+
+// The two uniform (0,1] deviates assigned to global entry (i,j)
+template<typename Real>
+void EntryUniforms( uint64_t stream, Int i, Int j, Real& u0, Real& u1 )
+{
+    uint32_t counter[4], key[2], words[4];
+    counter[0] = uint32_t(uint64_t(i));
+    counter[1] = uint32_t(uint64_t(i)>>32);
+    counter[2] = uint32_t(uint64_t(j));
+    counter[3] = uint32_t(uint64_t(j)>>32);
+    // Mix the stream into the key (SplitMix-style) so that distinct fills
+    // draw independent matrices
+    uint64_t k = PhiloxKey() + stream*0x9E3779B97F4A7C15ULL;
+    k = (k ^ (k>>30)) * 0xBF58476D1CE4E5B9ULL;
+    k = (k ^ (k>>27)) * 0x94D049BB133111EBULL;
+    k ^= (k>>31);
+    key[0] = uint32_t(k);
+    key[1] = uint32_t(k>>32);
+    Philox4x32( counter, key, words );
+    u0 = UniformBits<Real>( words[0], words[1] );
+    u1 = UniformBits<Real>( words[2], words[3] );
+}
+
+} // namespace counter_rng
+
+template<typename F>
+F CounterSampleBall
+( uint64_t stream, Int i, Int j, const F& center, const Base<F>& radius )
+{
+    typedef Base<F> Real;
+    Real u0, u1;
+    counter_rng::EntryUniforms( stream, i, j, u0, u1 );
+    const Real r = radius*u0;
+    const Real angle = 2*Pi<Real>()*u1;
+    return center + F(r*Cos(angle),r*Sin(angle));
+}
+
+template<typename Real,typename>
+Real CounterSampleBall
+( uint64_t stream, Int i, Int j, const Real& center, const Real& radius )
+{
+    Real u0, u1;
+    counter_rng::EntryUniforms( stream, i, j, u0, u1 );
+    return (2*u0-1)*radius + center;
+}
+
+template<typename T>
+T CounterSampleNormal
+( uint64_t stream, Int i, Int j, const T& mean, const Base<T>& stddev )
+{
+    typedef Base<T> Real;
+    Real stddevAdj = stddev;
+    if( IsComplex<T>::value )
+        stddevAdj /= Sqrt(Real(2));
+
+    Real u0, u1;
+    counter_rng::EntryUniforms( stream, i, j, u0, u1 );
+
+    // Box-Muller transform of the entry's two uniforms
+    const Real r = Sqrt(Real(-2)*Log(u0));
+    const Real angle = 2*Pi<Real>()*u1;
+    T sample;
+    SetRealPart( sample, RealPart(mean) + stddevAdj*r*Cos(angle) );
+    if( IsComplex<T>::value )
+        SetImagPart( sample, ImagPart(mean) + stddevAdj*r*Sin(angle) );
+    return sample;
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
@@ -238,6 +238,7 @@ typedef enum {
   EL_ASCII,
   EL_ASCII_MATLAB,
   EL_BINARY,
+  EL_BINARY_COMPRESSED,
   EL_BINARY_FLAT,
   EL_BMP,
   EL_JPG,
@@ -411,6 +411,23 @@ enum GridOrder
 }
 using namespace GridOrderNS;
 
+namespace GridMappingNS {
+enum GridMapping
+{
+    // Assign processes to the grid in their natural rank order
+    NATURAL_MAPPING,
+    // Fill the grid with the processes of one node before the next so that
+    // (for column-major grids) column teams mostly share a node
+    NODE_MAJOR_MAPPING,
+    // Deal the processes of each node out round-robin so that both row and
+    // column teams span as many nodes as possible
+    ROUND_ROBIN_MAPPING,
+    // An explicit user-provided ordering
+    USER_MAPPING
+};
+}
+using namespace GridMappingNS;
+
 namespace LeftOrRightNS {
 enum LeftOrRight
 {
@@ -497,6 +514,7 @@ enum FileFormat
     ASCII,
     ASCII_MATLAB,
     BINARY,
+    BINARY_COMPRESSED,
     BINARY_FLAT,
     BMP,
     JPG,
@@ -9,6 +9,8 @@
 #ifndef EL_IO_HPP
 #define EL_IO_HPP
 
+#include <thread>
+
 namespace El {
 
 const char* QtImageFormat( FileFormat format );
@@ -37,6 +39,36 @@ ColorMap GetColorMap();
 void SetNumDiscreteColors( Int numColors );
 Int NumDiscreteColors();
 
+// The maximum number of rows or columns which Display and Spy render
+// exactly; anything larger is first reduced to this resolution via max-abs
+// pooling so that visualizing a huge distributed matrix costs O(pixels)
+// rather than a gather of the entire matrix onto a single rank
+void SetDisplayResolution( Int resolution );
+Int DisplayResolution();
+
+// Downsampling
+// ============
+// Pool the entry magnitudes of A into an image of at most maxHeight x
+// maxWidth pixels, where each pixel holds the maximum magnitude over the
+// entries it covers. The distributed variants pool only the locally owned
+// entries and then combine the per-rank images with a single pixel-sized
+// reduction, so that every rank receives the pooled image.
+template<typename T>
+void MaxAbsDownsample
+( const Matrix<T>& A, Matrix<Base<T>>& P, Int maxHeight, Int maxWidth );
+template<typename T>
+void MaxAbsDownsample
+( const AbstractDistMatrix<T>& A, Matrix<Base<T>>& P,
+  Int maxHeight, Int maxWidth );
+template<typename T>
+void MaxAbsDownsample
+( const DistMultiVec<T>& X, Matrix<Base<T>>& P,
+  Int maxHeight, Int maxWidth );
+template<typename T>
+void MaxAbsDownsample
+( const DistSparseMatrix<T>& A, Matrix<Base<T>>& P,
+  Int maxHeight, Int maxWidth );
+
 // Display
 // =======
 void ProcessEvents( int numMsecs );
@@ -146,6 +178,79 @@ void Write
 ( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
   FileFormat format=BINARY, string title="" );
 
+// Forward declare DistSparseLDLFactorization (see El/lapack_like/factor.hpp)
+template<typename T>
+class DistSparseLDLFactorization;
+
+// Asynchronous checkpointing
+// ==========================
+// Snapshots a distributed object into a private staging copy and drains the
+// staged data to disk on a background thread, so that computation may
+// continue while the checkpoint is being written. All MPI communication
+// occurs within the brief synchronous portion of Put (and the completion
+// barrier of Wait); the background thread only touches rank-local data, and
+// so no particular threading level is required of the MPI implementation.
+// Each writer owns a single staging buffer: a Put first completes any
+// checkpoint still in flight, which bounds the memory overhead to one
+// snapshot (classical double buffering).
+template<typename T>
+class CheckpointWriter
+{
+public:
+    CheckpointWriter();
+    ~CheckpointWriter();
+
+    CheckpointWriter( const CheckpointWriter<T>& ) = delete;
+    CheckpointWriter<T>& operator=( const CheckpointWriter<T>& ) = delete;
+
+    // Snapshot the distributed matrix and begin draining it to
+    // '<basename>.bin' (in the BINARY format) in the background. The call
+    // blocks only to copy the local data and to collectively establish the
+    // output file; when the parallel path is unavailable, the checkpoint is
+    // instead written synchronously.
+    void Put( const AbstractDistMatrix<T>& A, string basename );
+
+    // Snapshot the local portion of the frontal tree of a (possibly only
+    // partially computed) sparse factorization and begin draining it to the
+    // per-rank file '<basename>.<commRank>.ckpt' in the background. The
+    // snapshot is taken at front granularity -- every dense front piece
+    // (and the values of any sparse leaves) is staged in a deterministic
+    // traversal order -- and so may be invoked between any two front
+    // updates of an in-progress factorization. Restoration amounts to the
+    // mirrored traversal after an identical symbolic initialization.
+    void Put( const DistSparseLDLFactorization<T>& fact, string basename );
+
+    // Block until the checkpoint in flight (if any) is complete on every
+    // rank of the communicator it was issued over.
+    void Wait();
+
+    // Whether a checkpoint is still being drained locally.
+    bool Pending() const;
+
+private:
+    // The staging area for a dense distributed matrix
+    Matrix<T> stage_;
+    vector<Int> stageRowInds_, stageColInds_;
+
+    // The staging area for a frontal tree: (height,width) pairs (with a
+    // width of -1 marking the value array of a sparse leaf) followed by the
+    // concatenated piece data
+    vector<Int> frontMeta_;
+    vector<T> frontData_;
+
+    mpi::Comm comm_;
+    bool pending_=false;
+    std::thread drainer_;
+};
+
+// Reload a distributed matrix from the '<basename>.bin' snapshot produced by
+// CheckpointWriter::Put (or by Write with the BINARY format), resizing the
+// matrix to the stored dimensions. A missing or truncated snapshot results
+// in a RuntimeError so that a resumed run fails loudly rather than
+// continuing from a partial state.
+template<typename T>
+void RestoreCheckpoint( AbstractDistMatrix<T>& A, string basename );
+
 } // namespace El
 
 #ifdef EL_HAVE_QT5
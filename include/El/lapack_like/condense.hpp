@@ -16,6 +16,23 @@ namespace El {
 // Bidiag
 // ======
 
+struct BidiagCtrl
+{
+    // Reduce the matrix to an upper triangular band matrix with blocked
+    // (and therefore almost entirely level-3 BLAS) Householder QR and LQ
+    // transformations before chasing the band down to bidiagonal form with
+    // Givens rotations, rather than reducing directly to bidiagonal form
+    // with memory-bound rank-1 updates. Since the bulge-chasing rotations
+    // are discarded, the returned Householder scalars only represent the
+    // reduction to band form, and so this approach is only appropriate
+    // when the accumulated transformations are not needed (e.g., when only
+    // singular values are being computed)
+    bool twoStage=false;
+    // The bandwidth of the intermediate band matrix (values of at most zero
+    // select the algorithmic blocksize)
+    Int bandwidth=0;
+};
+
 // Return the packed reduction to bidiagonal form
 // ----------------------------------------------
 template<typename Field>
@@ -23,6 +40,12 @@ void Bidiag
 ( Matrix<Field>& A,
   Matrix<Field>& householderScalarsP,
   Matrix<Field>& householderScalarsQ );
+template<typename Field>
+void Bidiag
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalarsP,
+  Matrix<Field>& householderScalarsQ,
+  const BidiagCtrl& ctrl );
 
 template<typename Field>
 void Bidiag
@@ -33,7 +56,8 @@ template<typename Field>
 void Bidiag
 ( AbstractDistMatrix<Field>& A,
   AbstractDistMatrix<Field>& householderScalarsP,
-  AbstractDistMatrix<Field>& householderScalarsQ );
+  AbstractDistMatrix<Field>& householderScalarsQ,
+  const BidiagCtrl& ctrl );
 
 namespace bidiag {
 
@@ -107,6 +131,20 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+
+    // Reduce the matrix to a Hermitian band matrix with blocked (and
+    // therefore almost entirely level-3 BLAS) Householder transformations
+    // before reducing the band to tridiagonal form with a bulge-chasing
+    // sweep, rather than reducing directly to tridiagonal form with
+    // memory-bound Hermitian rank-2 updates. Since the bulge-chasing
+    // rotations are discarded, the returned Householder scalars only
+    // represent the reduction to band form, and so this approach is only
+    // appropriate when the accumulated transformation is not needed (e.g.,
+    // when only eigenvalues are being computed)
+    bool twoStage=false;
+    // The bandwidth of the intermediate band matrix (values of at most zero
+    // select the algorithmic blocksize)
+    Int bandwidth=0;
 };
 
 template<typename Field>
@@ -114,6 +152,12 @@ void HermitianTridiag
 ( UpperOrLower uplo, Matrix<Field>& A, Matrix<Field>& householderScalars );
 template<typename Field>
 void HermitianTridiag
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  const HermitianTridiagCtrl<Field>& ctrl );
+template<typename Field>
+void HermitianTridiag
 ( UpperOrLower uplo,
   AbstractDistMatrix<Field>& A,
   AbstractDistMatrix<Field>& householderScalars,
@@ -145,6 +189,13 @@ void ApplyQ
 
 // Hessenberg
 // ==========
+
+// Toggle whether the distributed upper Hessenberg reduction defers the
+// update of the rows above each panel by one iteration so that it overlaps
+// with the latency-bound factorization of the next panel
+void SetHessenbergLookahead( bool lookahead );
+bool HessenbergLookahead();
+
 template<typename Field>
 void Hessenberg
 ( UpperOrLower uplo, Matrix<Field>& A, Matrix<Field>& householderScalars );
@@ -23,18 +23,42 @@ namespace El {
 //
 //    min_X || X ||_F s.t. op(A) X = B.
 //
+namespace LeastSquaresAlgNS {
+enum LeastSquaresAlg {
+    // Form op(A)^H op(A) with a Herk and solve with a Cholesky
+    // factorization, which is typically several times faster than a QR
+    // factorization but squares the condition number of the system
+    LEAST_SQUARES_NORMAL,
+    // The normal equations followed by one step of residual refinement in
+    // the working precision (the "corrected semi-normal equations"), which
+    // extends the applicability of the fast path to moderately
+    // ill-conditioned systems
+    LEAST_SQUARES_SEMI_NORMAL,
+    // A (Householder) QR or LQ factorization of op(A)
+    LEAST_SQUARES_QR,
+    // The normal equations when the conditioning (cheaply estimated from
+    // the diagonal of the Cholesky factor of the Gram matrix) is safe,
+    // adding refinement as the conditioning degrades and falling back to
+    // QR for ill-conditioned or underdetermined systems
+    LEAST_SQUARES_AUTO
+};
+}
+using namespace LeastSquaresAlgNS;
+
 template<typename Field>
 void LeastSquares
 ( Orientation orientation,
   const Matrix<Field>& A,
   const Matrix<Field>& B,
-        Matrix<Field>& X );
+        Matrix<Field>& X,
+  LeastSquaresAlg alg=LEAST_SQUARES_AUTO );
 template<typename Field>
 void LeastSquares
 ( Orientation orientation,
   const AbstractDistMatrix<Field>& A,
   const AbstractDistMatrix<Field>& B,
-        AbstractDistMatrix<Field>& X );
+        AbstractDistMatrix<Field>& X,
+  LeastSquaresAlg alg=LEAST_SQUARES_AUTO );
 
 template<typename Real>
 struct SQSDCtrl
@@ -172,6 +196,26 @@ void Ridge
         DistMultiVec<Field>& X,
   const LeastSquaresCtrl<Base<Field>>& ctrl=LeastSquaresCtrl<Base<Field>>() );
 
+// Solve along an entire regularization path: a single SVD of A is shared by
+// every value of gamma, so that each additional solution only costs a
+// diagonal rescaling of the precomputed U^H B and a multiplication by V.
+// The solutions are returned as the horizontal concatenation
+// [ X(gammas[0]), X(gammas[1]), ... ].
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const vector<Base<Field>>& gammas,
+        Matrix<Field>& X );
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const vector<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>& X );
+
 // Tikhonov regularization
 // =======================
 
@@ -211,6 +255,53 @@ void Tikhonov
         AbstractDistMatrix<Field>& X,
   TikhonovAlg alg=TIKHONOV_CHOLESKY );
 
+// Factored-state solver: factor a fixed (A,G) pair once and solve against
+// many (blocked) right-hand sides, in the spirit of SparseLDLFactorization
+template<typename Field>
+class TikhonovFactorization
+{
+public:
+    // Factor op(A)^H op(A) + G^H G (via either a Herk/Cholesky or a
+    // stacked QR, as in the one-shot driver)
+    void Factor
+    ( Orientation orientation,
+      const Matrix<Field>& A,
+      const Matrix<Field>& G,
+      TikhonovAlg alg=TIKHONOV_CHOLESKY );
+
+    // Overwrite X with the regularized solution for every column of B
+    void Solve( const Matrix<Field>& B, Matrix<Field>& X ) const;
+
+    bool Factored() const { return factored_; }
+
+private:
+    bool factored_=false;
+    Orientation orientation_=NORMAL;
+    Matrix<Field> A_, Z_;
+};
+
+template<typename Field>
+class DistTikhonovFactorization
+{
+public:
+    void Factor
+    ( Orientation orientation,
+      const AbstractDistMatrix<Field>& A,
+      const AbstractDistMatrix<Field>& G,
+      TikhonovAlg alg=TIKHONOV_CHOLESKY );
+
+    void Solve
+    ( const AbstractDistMatrix<Field>& B,
+            AbstractDistMatrix<Field>& X ) const;
+
+    bool Factored() const { return factored_; }
+
+private:
+    bool factored_=false;
+    Orientation orientation_=NORMAL;
+    DistMatrix<Field> A_, Z_;
+};
+
 template<typename Field>
 void Tikhonov
 ( Orientation orientation,
@@ -289,6 +380,52 @@ void Overwrite
 
 } // namespace lse
 
+// Factored-state solver: compute the Generalized RQ factorization of a
+// fixed (B,A) pair once and solve against many (blocked) right-hand side
+// pairs (C,D)
+template<typename Field>
+class LSEFactorization
+{
+public:
+    void Factor( const Matrix<Field>& A, const Matrix<Field>& B );
+
+    void Solve
+    ( const Matrix<Field>& C,
+      const Matrix<Field>& D,
+            Matrix<Field>& X ) const;
+
+    bool Factored() const { return factored_; }
+
+private:
+    bool factored_=false;
+    Int m_=0, n_=0, p_=0;
+    Matrix<Field> A_, B_, tA_, tB_;
+    Matrix<Base<Field>> dA_, dB_;
+};
+
+template<typename Field>
+class DistLSEFactorization
+{
+public:
+    void Factor
+    ( const AbstractDistMatrix<Field>& A,
+      const AbstractDistMatrix<Field>& B );
+
+    void Solve
+    ( const AbstractDistMatrix<Field>& C,
+      const AbstractDistMatrix<Field>& D,
+            AbstractDistMatrix<Field>& X ) const;
+
+    bool Factored() const { return factored_; }
+
+private:
+    bool factored_=false;
+    Int m_=0, n_=0, p_=0;
+    DistMatrix<Field> A_, B_;
+    DistMatrix<Field,MD,STAR> tA_, tB_;
+    DistMatrix<Base<Field>,MD,STAR> dA_, dB_;
+};
+
 // General (Gauss-Markov) Linear Model
 // ===================================
 // Solve
@@ -346,6 +483,51 @@ void Overwrite
 
 } // namespace glm
 
+// Factored-state solver: compute the Generalized QR factorization of a
+// fixed (A,B) pair once and solve against many (blocked) right-hand sides
+template<typename Field>
+class GLMFactorization
+{
+public:
+    void Factor( const Matrix<Field>& A, const Matrix<Field>& B );
+
+    void Solve
+    ( const Matrix<Field>& D,
+            Matrix<Field>& X,
+            Matrix<Field>& Y ) const;
+
+    bool Factored() const { return factored_; }
+
+private:
+    bool factored_=false;
+    Int m_=0, n_=0, p_=0;
+    Matrix<Field> A_, B_, tA_, tB_;
+    Matrix<Base<Field>> dA_, dB_;
+};
+
+template<typename Field>
+class DistGLMFactorization
+{
+public:
+    void Factor
+    ( const AbstractDistMatrix<Field>& A,
+      const AbstractDistMatrix<Field>& B );
+
+    void Solve
+    ( const AbstractDistMatrix<Field>& D,
+            AbstractDistMatrix<Field>& X,
+            AbstractDistMatrix<Field>& Y ) const;
+
+    bool Factored() const { return factored_; }
+
+private:
+    bool factored_=false;
+    Int m_=0, n_=0, p_=0;
+    DistMatrix<Field> A_, B_;
+    DistMatrix<Field,MD,STAR> tA_, tB_;
+    DistMatrix<Base<Field>,MD,STAR> dA_, dB_;
+};
+
 // TODO: Generalized Tikhonov regularization
 
 // TODO: Total Least Squares
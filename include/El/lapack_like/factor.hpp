@@ -16,16 +16,76 @@
 
 namespace El {
 
+// Inline factorization monitors
+// =============================
+// A registered monitor is invoked after each outer panel of the dense LU
+// and Cholesky factorizations (and after each front of the sparse LDL)
+// with cheap statistics about the pivots just produced, so that a clearly
+// divergent factorization can be aborted within its first panels -- by
+// throwing from the callback -- and rescheduled with, e.g., stronger
+// equilibration, rather than diagnosed after the fact through Condition.
+// In the distributed factorizations the callback fires redundantly (with
+// identical statistics) on every rank of the grid, so a thrown exception
+// aborts every process; the sparse traversal may invoke the callback
+// concurrently from OpenMP tasks, so it must be thread-safe. The
+// statistics are deliberately kept in double-precision: they steer
+// scheduling decisions rather than the numerics.
+struct FactorMonitorStats
+{
+    Int offset=0;    // the global offset of the reported panel (or front)
+    Int panelSize=0; // the number of pivots within the reported panel
+    double minAbsPivot=0; // the smallest pivot magnitude within the panel
+    double maxAbsPivot=0; // the largest pivot magnitude within the panel
+    // The largest entry magnitude of the factored diagonal block relative
+    // to the largest entry magnitude of the original matrix (LU only)
+    double growthFactor=1;
+};
+typedef function<void(const FactorMonitorStats&)> FactorMonitor;
+
+// The monitors are process-wide (cf. SetLUTournamentPivoting) and are
+// cleared by registering an empty function
+void SetLUMonitor( FactorMonitor monitor );
+void SetCholeskyMonitor( FactorMonitor monitor );
+void SetLDLMonitor( FactorMonitor monitor );
+const FactorMonitor& LUMonitor();
+const FactorMonitor& CholeskyMonitor();
+const FactorMonitor& LDLMonitor();
+
 // Cholesky
 // ========
+
+// Whether the distributed factorization should factor panel k+1 before
+// applying the bulk of panel k's trailing update (a one-step lookahead,
+// which hides the latency-bound panel collectives behind the dominant
+// local update at the cost of keeping two panel broadcasts alive)
+void SetCholeskyLookahead( bool lookahead );
+bool CholeskyLookahead();
+
+// Whether the sequential blocked factorization should be executed as a DAG
+// of tile tasks with inferred dependencies (requires OpenMP 4.0 task
+// dependencies; otherwise the blocked algorithm runs unchanged). Note that
+// the tasks call into the local BLAS, so the BLAS should be single-threaded
+// to avoid oversubscription.
+void SetCholeskyTaskDAG( bool taskDAG );
+bool CholeskyTaskDAG();
+
 template<typename Field>
 void Cholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void Cholesky
-( UpperOrLower uplo, AbstractDistMatrix<Field>& A, bool scalapack=false );
+( UpperOrLower uplo, AbstractDistMatrix<Field>& A, bool scalapack=false,
+  const TuningCtrl& tuning=TuningCtrl() );
 template<typename Field>
 void Cholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR>& A );
 
+// Factor a Hermitian positive-definite matrix held in Rectangular Full
+// Packed (RFP) storage (see PackRFP) without ever unpacking it, so that the
+// factor overwrites the packed rectangle in place
+template<typename Field>
+void CholeskyRFP( UpperOrLower uplo, Matrix<Field>& ARFP );
+template<typename Field>
+void CholeskyRFP( UpperOrLower uplo, AbstractDistMatrix<Field>& ARFP );
+
 template<typename Field>
 void ReverseCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
@@ -366,16 +426,27 @@ using namespace LUPivotTypeNS;
 template<typename Field>
 void LU( Matrix<Field>& A );
 template<typename Field>
-void LU( AbstractDistMatrix<Field>& A );
+void LU
+( AbstractDistMatrix<Field>& A, const TuningCtrl& tuning=TuningCtrl() );
 template<typename Field>
 void LU( DistMatrix<Field,STAR,STAR>& A );
 
 // LU with partial pivoting
 // ------------------------
+
+// Whether the distributed factorization should select each panel's pivots
+// with a single tournament reduction tree ("CALU") rather than one MaxLoc
+// AllReduce per column, trading a (harmlessly) different pivot sequence for
+// exponentially fewer latency-bound collectives per panel
+void SetLUTournamentPivoting( bool tournament );
+bool LUTournamentPivoting();
+
 template<typename Field>
 void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
-void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
+void LU
+( AbstractDistMatrix<Field>& A, DistPermutation& P,
+  const TuningCtrl& tuning=TuningCtrl() );
 
 // LU with full pivoting
 // ---------------------
@@ -566,6 +637,13 @@ struct QRCtrl
 
 // Return an implicit representation of Q and R such that A = Q R
 // --------------------------------------------------------------
+// The minimum height/width ratio at which the unpivoted distributed
+// factorization switches to a TSQR-based path (which reconstructs the same
+// compact Householder representation); the switch additionally requires a
+// power-of-two process count and a height of at least p times the width
+void SetTSQRAspectThreshold( Int threshold );
+Int TSQRAspectThreshold();
+
 template<typename Field>
 void QR
 ( Matrix<Field>& A,
@@ -947,6 +1025,38 @@ void Skeleton
         AbstractDistMatrix<Field>& Z,
   const QRCtrl<Base<Field>>& ctrl=QRCtrl<Base<Field>>() );
 
+// Pre-flight memory estimates
+// ===========================
+// Upper bounds (in bytes per process) on the memory required by the dense
+// factorizations, from their dimensions alone: the (in-place) factored
+// matrix plus the blocked panel workspace and pivot/reflector metadata.
+// Compare against AvailablePhysicalMemory, e.g. via VerifyMemoryBudget, to
+// reject a doomed run before it begins; the analogous bound for the sparse
+// case is SparseLDLFactorization::MemoryEstimate.
+template<typename Field>
+double CholeskyMemoryEstimate( Int n )
+{
+    return ( double(n)*n + double(Blocksize())*n )*sizeof(Field);
+}
+template<typename Field>
+double LUMemoryEstimate( Int m, Int n )
+{
+    return ( double(m)*n + double(Blocksize())*m )*sizeof(Field) +
+           double(Min(m,n))*sizeof(Int);
+}
+template<typename Field>
+double QRMemoryEstimate( Int m, Int n )
+{
+    return ( double(m)*n + double(Blocksize())*m +
+             double(Min(m,n)) )*sizeof(Field);
+}
+template<typename Field>
+double LDLMemoryEstimate( Int n )
+{
+    return ( double(n)*n + double(Blocksize())*n + double(n) )*sizeof(Field) +
+           double(n)*sizeof(Int);
+}
+
 } // namespace El
 
 #include <El/lapack_like/factor/qr/ProxyHouseholder.hpp>
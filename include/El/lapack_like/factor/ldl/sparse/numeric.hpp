@@ -131,6 +131,17 @@ struct DistMultiVecNodeMeta
       const DistNodeInfo& info,
       const DistMap& invMap,
       const DistMultiVec<T>& X );
+
+    void Empty()
+    {
+        SwapClear( sendInds );
+        SwapClear( recvInds );
+        SwapClear( mappedOwners );
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+    }
 };
 
 // For handling a set of vectors distributed in a [VC,* ] manner over each node
@@ -260,6 +271,12 @@ struct Front
     Matrix<Field> LDense;
     SparseMatrix<Field> LSparse;
 
+    // When true, the bottom-left block of this front has been replaced with
+    // the low-rank approximation ULow VLow (see CompressFronts), and LDense
+    // retains only the top-left triangle (or, for a sparse leaf, is empty).
+    bool isCompressed=false;
+    Matrix<Field> ULow, VLow;
+
     Matrix<Field> diag;
     Matrix<Field> subdiag;
     Permutation p;
@@ -267,6 +284,15 @@ struct Front
     Matrix<Field> workDense;
     SparseMatrix<Field> workSparse;
 
+    // When nonempty, a single allocation backing the 'LDense' storage of this
+    // front and all of its descendants (see ReserveStorage).
+    vector<Field> slab;
+
+    // When nonnegative, the offset within the factorization's spill file at
+    // which this front's dense storage resides (see SpillFronts); the storage
+    // itself is then only resident while a streaming solve is using it.
+    std::streamoff spillOffset=-1;
+
     // An observing pointer for the parent front (should it exist).
     Front<Field>* parent=nullptr;
 
@@ -299,6 +325,13 @@ struct Front
       const vector<Int>& reordering,
       const NodeInfo& rootInfo );
 
+    // Contiguously allocate the dense storage of this tree of fronts within a
+    // single slab whose per-front extents are computed from the symbolic
+    // analysis; the tree of fronts and its slab are then reused by subsequent
+    // calls to Pull, which avoids a fine-grained allocation per front for
+    // each (re)factorization.
+    void ReserveStorage( const NodeInfo& rootInfo );
+
     void Push
     (       SparseMatrix<Field>& A,
       const vector<Int>& reordering,
@@ -316,6 +349,96 @@ struct Front
     double SolveGFlops( Int numRHS=1 ) const;
 };
 
+// Replace the bottom-left block of each sufficiently large front with an
+// adaptive-rank approximation U V computed from a tolerance-controlled
+// column-pivoted QR factorization, keeping a compression only when it uses
+// less storage than the block it replaces. The subsequent triangular solves
+// then apply the off-diagonal coupling through the low-rank pair, which
+// reduces both the memory footprint and the solve flops at the price of a
+// backward error on the order of 'tol'. Blocks whose minimum dimension is
+// below 'minSize' are left uncompressed.
+template<typename Field>
+void CompressFronts
+( Front<Field>& front, const Base<Field>& tol, Int minSize=64 );
+
+// Incorporate the rank-k modification A + alpha V V^[T/H] into a factored
+// frontal tree by propagating each update vector along the affected
+// elimination-tree paths (the classical method C1 of Gill et al.), so that
+// a modification touching a handful of rows only updates the fronts on the
+// paths from those rows to the root. 'W' holds the update vectors with their
+// rows already permuted into the factorization's ordering and is overwritten
+// with the per-front residuals. Only vanilla LDL frontal types are supported,
+// and a negative 'alpha' yields a downdate.
+template<typename Field>
+void ModifyFactorization
+( const NodeInfo& info,
+        Front<Field>& front,
+        Base<Field> alpha,
+        Matrix<Field>& W );
+
+// Write the dense storage of each front in a factored tree to the given
+// binary scratch file in postorder and release it from memory, so that
+// factors larger than physical memory may still be applied; the sparse leaf
+// factors, the diagonals, and any low-rank compressions remain resident.
+// A spilled tree only supports the streaming solves below until the fronts
+// are restored via UnspillFronts.
+template<typename Field>
+void SpillFronts( Front<Field>& front, const string& spillFile );
+
+// Restore the dense storage of a spilled tree of fronts from its scratch
+// file.
+template<typename Field>
+void UnspillFronts( Front<Field>& front, const string& spillFile );
+
+// Out-of-core lower triangular solves: each front's dense storage is
+// streamed back from the spill file immediately before its use in the
+// traversal and released immediately afterwards, so that the postorder
+// bounds the resident dense factor storage at a single front (plus the
+// solve workspaces).
+template<typename Field>
+void SpilledLowerForwardSolve
+( const NodeInfo& info,
+        Front<Field>& front,
+        MatrixNode<Field>& X,
+        std::ifstream& spill );
+template<typename Field>
+void SpilledLowerBackwardSolve
+( const NodeInfo& info,
+        Front<Field>& front,
+        MatrixNode<Field>& X,
+        std::ifstream& spill,
+        bool conjugate );
+
+// Compute the diagonal of inv(A) from a factored frontal tree via a
+// top-down selected-inversion sweep, whose cost is comparable to that of a
+// second factorization rather than a solve per entry. 'front' must be the
+// root of a vanilla LDL factorization, and the result is returned in the
+// factorization's ordering.
+template<typename Field>
+void InverseDiagonal
+( const NodeInfo& info,
+  const Front<Field>& front,
+        Matrix<Field>& dInv );
+
+// Accumulate the determinant of the (quasi-)diagonal factor of a factored
+// tree of fronts into 'det'; since the reorderings and any pivoting are
+// symmetric permutations, this is the determinant of the original matrix.
+// 'scale' should be the global matrix dimension (the SafeProduct
+// convention divides each log by it). The distributed sweep accumulates
+// each process's local subtree along with each distributed front exactly
+// once on the root rank of its grid, so the per-process results must be
+// combined by summing kappa and multiplying rho over the communicator.
+template<typename Field>
+void Determinant
+( const Front<Field>& front,
+        Base<Field> scale,
+        SafeProduct<Field>& det );
+template<typename Field>
+void Determinant
+( const DistFront<Field>& front,
+        Base<Field> scale,
+        SafeProduct<Field>& det );
+
 struct FactorCommMeta
 {
     vector<int> numChildSendInds;
@@ -464,6 +587,15 @@ public:
             bool hermitian=true,
       const BisectCtrl& bisectCtrl=BisectCtrl() );
 
+    // Find a reordering in which 'schurInds' are pinned to the end as an
+    // artificial root separator so that FactorWithSchurComplement can expose
+    // their dense Schur complement.
+    void InitializeWithSchurIndices
+    ( const SparseMatrix<Field>& A,
+      const vector<Int>& schurInds,
+            bool hermitian=true,
+      const BisectCtrl& bisectCtrl=BisectCtrl() );
+
     // Re-initialize the multifrontal tree with a new sparse matrix which has
     // the same nonzero pattern. Usually this is called after having factored
     // with a different matrix (e.g., within an Interior Point Method).
@@ -472,14 +604,86 @@ public:
     // Factor the initialized multifrontal tree.
     void Factor( LDLFrontType frontType=LDL_2D );
 
+    // Route the dense kernels of fronts whose dimensions reach
+    // 'minFrontSize' through the GPU during factorization (this requires
+    // configuring with cuBLAS support). Fronts below the threshold stay on
+    // the host, and the independent subtrees of the elimination tree are
+    // still processed as concurrent tasks, so that several host threads
+    // feed the device at once while the small leaf fronts are eliminated
+    // in parallel beside it.
+    void EnableGPUOffload( bool offload=true, Int minFrontSize=512 );
+
+    // Eliminate every unknown except the root separator and export the
+    // latter's dense Schur complement, S, with its rows and columns ordered
+    // as in the 'schurInds' passed to InitializeWithSchurIndices. When
+    // 'eliminateSchurBlock' is true the root is eliminated as well, so that
+    // the factorization afterwards agrees with Factor(frontType) and may be
+    // solved against; otherwise the root is left unfactored (e.g., because
+    // the interface block of a floating subdomain is singular) and the
+    // partial factorization should be discarded via a re-initialization.
+    void FactorWithSchurComplement
+    ( Matrix<Field>& S,
+      bool eliminateSchurBlock=false,
+      LDLFrontType frontType=LDL_2D );
+
+    // Refactor with a new sparse matrix which has the same nonzero pattern:
+    // equivalent to ChangeNonzeroValues(ANew) followed by Factor(frontType),
+    // which keeps the reordering, the symbolic analysis, and the front
+    // allocations alive so that each refactorization only pays for the
+    // numeric flops.
+    void Refactor
+    ( const SparseMatrix<Field>& ANew, LDLFrontType frontType=LDL_2D );
+
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
 
+    // Replace the bottom-left blocks of the factored fronts with adaptive
+    // low-rank approximations accurate to roughly 'tol' (see
+    // ldl::CompressFronts). The compressed fronts may only be used for
+    // solves; refactorizing releases the compression via Pull.
+    void CompressFronts( const Base<Field>& tol, Int minCompressSize=64 );
+
+    // Incorporate the rank-k modification A + alpha V V^[T/H] by updating
+    // only the fronts on the elimination-tree paths from the nonzero rows of
+    // V to the root (see ldl::ModifyFactorization); alpha < 0 yields a
+    // downdate.
+    void ModifyFactorization( Base<Field> alpha, const Matrix<Field>& V );
+
+    // Spill the dense storage of the factored fronts to the given binary
+    // scratch file and release it from memory (see ldl::SpillFronts).
+    // Subsequent solves stream each front back from the file around its use,
+    // so that factors larger than physical memory may still be applied.
+    void SpillFronts( const string& spillFile );
+    // Restore the dense storage of the fronts and delete the scratch file.
+    void UnspillFronts();
+    bool FrontsSpilled() const EL_NO_EXCEPT;
+
+    // Overwrite 'dInv' with the diagonal of inv(A) in the original ordering
+    // via a selected-inversion sweep over the factored fronts (see
+    // ldl::InverseDiagonal), which costs roughly as much as a second
+    // factorization rather than a solve per diagonal entry.
+    void InverseDiagonal( Matrix<Field>& dInv ) const;
+
+    // Accumulate det(A) from the (quasi-)diagonal of the factored fronts
+    // as a SafeProduct, so that log|det(A)| = kappa*n is available without
+    // overflow and the sign/phase is carried in rho; the diagonal data is
+    // already resident from the factorization, so the cost is linear in n.
+    SafeProduct<Field> Determinant() const;
+
     // Overwrite 'B' with the solution to 'A X = B'.
     void Solve( Matrix<Field>& B ) const;
     void Solve( ldl::MatrixNode<Field>& B ) const;
 
+    // Accumulate right-hand sides for a later batched solve: all of the
+    // queued columns are solved within a single blocked traversal of the
+    // frontal tree, so that the per-front kernels operate on matrices rather
+    // than individual vectors.
+    void QueueSolve( const Matrix<Field>& B ) const;
+    // Overwrite 'X' with the solutions against the queued right-hand sides
+    // (ordered as they were queued) and clear the queue.
+    void ProcessSolveQueue( Matrix<Field>& X ) const;
+
     // Overwrite 'B' with the solution to 'A X = B' using Iterative Refinement.
     void SolveWithIterativeRefinement
     ( const SparseMatrix<Field>& A,
@@ -521,6 +725,13 @@ public:
     double FactorGFlops() const;
     double SolveGFlops( Int numRHS=1 ) const;
 
+    // Bound (in bytes) the memory required by Factor from the symbolic
+    // analysis alone: the factor storage plus the peak of the multifrontal
+    // update stack. Available immediately after initialization, so that a
+    // doomed run can be rejected before the numeric factorization begins
+    // (e.g., via VerifyMemoryBudget).
+    double MemoryEstimate() const;
+
     ldl::Front<Field>& Front();
     const ldl::Front<Field>& Front() const;
 
@@ -544,6 +755,18 @@ private:
     unique_ptr<ldl::Separator> separator_;
 
     vector<Int> map_, inverseMap_;
+
+    // The scratch file holding the spilled dense front storage (if any)
+    bool spilled_=false;
+    string spillFile_;
+
+    // Whether the dense kernels of sufficiently large fronts should be
+    // dispatched to the GPU during factorization
+    bool gpuOffload_=false;
+    Int gpuMinFrontSize_=512;
+
+    // Right-hand sides accumulated by QueueSolve
+    mutable vector<Matrix<Field>> queuedRHS_;
 };
 
 template<typename Field>
@@ -585,6 +808,14 @@ public:
     // Factor the initialized multifrontal tree.
     void Factor( LDLFrontType frontType=LDL_2D );
 
+    // Refactor with a new sparse matrix which has the same nonzero pattern:
+    // equivalent to ChangeNonzeroValues(ANew) followed by Factor(frontType),
+    // which keeps the reordering, the symbolic analysis, the front
+    // allocations, and the pull metadata alive so that each refactorization
+    // only pays for the numeric flops.
+    void Refactor
+    ( const DistSparseMatrix<Field>& ANew, LDLFrontType frontType=LDL_2D );
+
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
@@ -594,6 +825,15 @@ public:
     void Solve( ldl::DistMultiVecNode<Field>& B ) const;
     void Solve( ldl::DistMatrixNode<Field>& B ) const;
 
+    // Accumulate right-hand sides for a later batched solve: all of the
+    // queued columns are solved within a single blocked traversal of the
+    // frontal tree, so that the per-front kernels operate on matrices rather
+    // than individual vectors.
+    void QueueSolve( const DistMultiVec<Field>& B ) const;
+    // Overwrite 'X' with the solutions against the queued right-hand sides
+    // (ordered as they were queued) and clear the queue.
+    void ProcessSolveQueue( DistMultiVec<Field>& X ) const;
+
     // Overwrite 'B' with the solution to 'A X = B' using Iterative Refinement.
     void SolveWithIterativeRefinement
     ( const DistSparseMatrix<Field>& A,
@@ -635,6 +875,11 @@ public:
 
     // TODO(poulson): Apply permutation?
 
+    // Accumulate det(A) from the (quasi-)diagonal of the factored fronts
+    // as a SafeProduct, combining the per-process contributions with an
+    // all-reduce; log|det(A)| = kappa*n, with the sign/phase in rho.
+    SafeProduct<Field> Determinant() const;
+
     bool Factored() const;
 
     Int NumLocalEntries() const;
@@ -673,8 +918,15 @@ private:
     mutable bool formedPullMetadata_=false;
     mutable vector<Int> mappedSources_, mappedTargets_, columnOffsets_;
 
-    // Metadata for future use.
+    // The permute/unpermute pair around each solve translates indices
+    // through the (inverse) reordering map; the translation and exchange
+    // pattern only depend on the map and the right-hand side distribution,
+    // so they are computed once and replayed as a precomputed gather by
+    // every subsequent solve and multiply
     mutable ldl::DistMultiVecNodeMeta dmvMeta_;
+
+    // Right-hand sides accumulated by QueueSolve
+    mutable vector<DistMultiVec<Field>> queuedRHS_;
 };
 
 } // namespace El
@@ -43,6 +43,18 @@ void NestedDissection
         Separator& rootSep,
         NodeInfo& rootInfo,
   const BisectCtrl& ctrl=BisectCtrl() );
+// A constrained variant which pins 'rootInds' (in the given order) to the
+// end of the reordering as an artificial root separator; the remainder of
+// the graph is dissected as usual. This is the ordering used for exposing
+// the dense Schur complement of a tagged index set from the multifrontal
+// factorization.
+void NestedDissection
+( const Graph& graph,
+  const vector<Int>& rootInds,
+        vector<Int>& map,
+        Separator& rootSep,
+        NodeInfo& rootInfo,
+  const BisectCtrl& ctrl=BisectCtrl() );
 void NestedDissection
 ( const DistGraph& graph,
         DistMap& map,
@@ -30,6 +30,10 @@ struct SignCtrl
     Real tol=Real(0);
     Real power=Real(1);
     SignScaling scaling=SIGN_SCALE_FROB;
+    // Switch from scaled Newton to the inverse-free Newton-Schulz
+    // iteration (two Gemms per step) once the iterate is contractive,
+    // i.e., once ||I - X^2|| < 1
+    bool newtonSchulzHybrid=false;
     bool progress=false;
 };
 
@@ -42,6 +46,19 @@ struct SquareRootCtrl
     bool progress=false;
 };
 
+// Exponential
+// ===========
+// Overwrite A with exp(A) via scaling-and-squaring with diagonal Pade
+// approximants [Al-Mohy and Higham, 2009]: the Pade degree and the
+// scaling power are chosen from one-norms of the formed powers of A so
+// that the backward error is of order the working-precision epsilon while
+// avoiding overscaling. The cost is a handful of Gemms and one LU solve,
+// which is substantially cheaper than a Schur-based evaluation.
+template<typename Field>
+void Exponential( Matrix<Field>& A );
+template<typename Field>
+void Exponential( AbstractDistMatrix<Field>& A );
+
 // Hermitian function
 // ==================
 template<typename Field>
@@ -131,6 +148,28 @@ void Pseudoinverse( Matrix<Field>& A, Base<Field> tolerance=0 );
 template<typename Field>
 void Pseudoinverse( AbstractDistMatrix<Field>& A, Base<Field> tolerance=0 );
 
+// Overwrite APinv with a rank-adaptive randomized pseudoinverse of A: an
+// orthonormal basis of the range is captured one Gaussian sketch block at
+// a time (stopping once stochastic estimates of the residual norm fall
+// below the tolerance, which defaults to max(m,n) eps relative to
+// ||A||_F), and the small projected factor is pseudoinverted densely, so
+// the cost scales with the numerical rank rather than with min(m,n). The
+// captured rank is returned.
+template<typename Field>
+Int RandomizedPseudoinverse
+( const Matrix<Field>& A,
+        Matrix<Field>& APinv,
+  Base<Field> tolerance=0,
+  Int blockSize=32,
+  Int maxRank=0 );
+template<typename Field>
+Int RandomizedPseudoinverse
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& APinv,
+  Base<Field> tolerance=0,
+  Int blockSize=32,
+  Int maxRank=0 );
+
 template<typename Field>
 void HermitianPseudoinverse
 ( UpperOrLower uplo, Matrix<Field>& A, Base<Field> tolerance=0 );
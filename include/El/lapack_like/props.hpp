@@ -455,6 +455,35 @@ Base<F> SymmetricTwoNormEstimate
 ( UpperOrLower uplo, const AbstractDistMatrix<F>& A,
   Base<F> tol=1e-6, Int maxIts=1000 );
 
+// One-norm estimate
+// -----------------
+// A Hager/Higham style estimate: a lower bound on the one-norm which is
+// almost always within a small factor of the truth and only requires a few
+// applies of A and A^H rather than a full entrywise pass
+template<typename F>
+Base<F> OneNormEstimate( const Matrix<F>& A, Int maxIts=5 );
+template<typename F>
+Base<F> OneNormEstimate( const AbstractDistMatrix<F>& A, Int maxIts=5 );
+template<typename F>
+Base<F> OneNormEstimate( const SparseMatrix<F>& A, Int maxIts=5 );
+template<typename F>
+Base<F> OneNormEstimate( const DistSparseMatrix<F>& A, Int maxIts=5 );
+
+// Frobenius-norm estimate
+// -----------------------
+// An unbiased stochastic estimate based upon applying A to a handful of
+// Rademacher probe vectors
+template<typename F>
+Base<F> FrobeniusNormEstimate( const Matrix<F>& A, Int numSamples=10 );
+template<typename F>
+Base<F> FrobeniusNormEstimate
+( const AbstractDistMatrix<F>& A, Int numSamples=10 );
+template<typename F>
+Base<F> FrobeniusNormEstimate( const SparseMatrix<F>& A, Int numSamples=10 );
+template<typename F>
+Base<F> FrobeniusNormEstimate
+( const DistSparseMatrix<F>& A, Int numSamples=10 );
+
 // Trace
 // =====
 template<typename T>
@@ -462,6 +491,19 @@ T Trace( const Matrix<T>& A );
 template<typename T>
 T Trace( const AbstractDistMatrix<T>& A );
 
+// Trace estimate
+// ==============
+// Hutchinson's estimator: the average of a handful of quadratic forms
+// z^H A z with Rademacher probe vectors z
+template<typename F>
+F TraceEstimate( const Matrix<F>& A, Int numSamples=10 );
+template<typename F>
+F TraceEstimate( const AbstractDistMatrix<F>& A, Int numSamples=10 );
+template<typename F>
+F TraceEstimate( const SparseMatrix<F>& A, Int numSamples=10 );
+template<typename F>
+F TraceEstimate( const DistSparseMatrix<F>& A, Int numSamples=10 );
+
 } // namespace El
 
 #endif // ifndef EL_PROPS_HPP
@@ -13,6 +13,30 @@ namespace El {
 
 // ApplyPackedReflectors
 // =====================
+
+// The number of reflectors accumulated into each compact-WY (UT) block by
+// the blocked application routines; zero (the default) falls back to the
+// global algorithmic blocksize. Deeper accumulation converts the
+// back-transformations after condensation into larger GEMMs, which is
+// particularly profitable when the matrix being transformed is much wider
+// than the default blocksize (e.g., eigenvector back-transformation)
+void SetPackedReflectorsBlocksize( Int nb );
+Int PackedReflectorsBlocksize() EL_NO_EXCEPT;
+
+// The maximum width to which consecutive reflector panels may be merged
+// into a single compact-WY application when the matrix being transformed
+// is skinnier than the budget; applying the Q from a many-panel
+// factorization to a thin matrix then makes O(1) passes over the target
+// rather than one pass per panel. Zero disables the aggregation
+void SetPackedReflectorsAggBudget( Int budget );
+Int PackedReflectorsAggBudget() EL_NO_EXCEPT;
+
+// The effective accumulation width used by the blocked application
+// routines, which aggregates panels up to the budget above whenever the
+// target dimension is smaller than the budget
+Int PackedReflectorsBlocksize
+( Int numReflectors, Int targetDim ) EL_NO_EXCEPT;
+
 template<typename F>
 void ApplyPackedReflectors
 ( LeftOrRight side, UpperOrLower uplo,
@@ -12,6 +12,9 @@
 #include <El/lapack_like/factor.hpp>
 #include <El/lapack_like/euclidean_min.hpp>
 
+#include <atomic>
+#include <thread>
+
 namespace El {
 
 // Linear
@@ -46,6 +49,91 @@ void Overwrite( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B );
 
 } // namespace lin_solve
 
+// Speculative dual-algorithm solves
+// =================================
+// For latency-critical small solves, the tail latency of the distributed
+// algorithm is occasionally dominated by a single slow process. A
+// SpeculativeSolver runs both algorithms at once: after a single round of
+// communication replicates the operands, the distributed solve is launched
+// on a background thread over a private duplicate of the process grid (so
+// that its collectives cannot interleave with the caller's), while the
+// calling thread solves the replicated system with the local LAPACK
+// kernels. The caller's latency is therefore bounded by the replication
+// plus the local solve, independent of any straggler. MPI collectives
+// cannot be aborted mid-flight, so the distributed lane always drains --
+// in the background, overlapped with whatever the caller does next -- and
+// is joined at the following Solve (or at destruction); both lanes compute
+// the same solution, so the replicated result is the one installed, and
+// DistributedWon reports which lane finished first. The background lane
+// requires MPI_THREAD_MULTIPLE; with a lower threading level the
+// replicated solve runs alone, which preserves the latency bound. The
+// redundant flops only pay off while the problem is small enough for the
+// replicated solve to be competitive.
+template<typename Field>
+class SpeculativeSolver
+{
+public:
+    explicit SpeculativeSolver( const Grid& grid );
+    ~SpeculativeSolver();
+
+    SpeculativeSolver( const SpeculativeSolver<Field>& ) = delete;
+    SpeculativeSolver<Field>&
+    operator=( const SpeculativeSolver<Field>& ) = delete;
+
+    // Overwrite B with inv(A) B
+    void Solve
+    ( const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B );
+
+    // Block until the distributed lane of the previous solve has drained
+    void Drain();
+
+    // Whether the distributed lane finished before the replicated one on
+    // the most recent solve (useful for deciding whether speculation is
+    // still worthwhile at this problem size)
+    bool DistributedWon() const EL_NO_EXCEPT;
+
+private:
+    Grid grid_; // the private grid of the background lane
+    unique_ptr<DistMatrix<Field>> ABack_, BBack_;
+    std::thread background_;
+    std::atomic<bool> localDone_, distributedWon_;
+};
+
+// Mixed-precision
+// ===============
+// Factor in the demoted precision (e.g., single precision when Field is
+// double) and recover a working-precision solution by iteratively refining
+// with residuals computed in the working precision; see solve/Refined.hpp
+// for the refinement kernels. Each driver returns the number of refinement
+// iterations which were performed.
+
+template<typename Real>
+struct MixedPrecisionSolveCtrl
+{
+    Real relTol;
+    Int maxRefineIts=10;
+    bool progress=false;
+
+    MixedPrecisionSolveCtrl()
+    { relTol = Pow(limits::Epsilon<Real>(),Real(0.8)); }
+};
+
+template<typename Field>
+Int MixedPrecisionLinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionSolveCtrl<Base<Field>>& ctrl=
+        MixedPrecisionSolveCtrl<Base<Field>>() );
+
+template<typename Field>
+Int MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionSolveCtrl<Base<Field>>& ctrl=
+        MixedPrecisionSolveCtrl<Base<Field>>() );
+
 // Hermitian
 // =========
 template<typename Field>
@@ -227,6 +315,236 @@ void Overwrite
 
 } // namespace hpd_solve
 
+// Sparse approximate inverse
+// ==========================
+// Construct a right preconditioner M which approximately minimizes
+// || A M - I ||_F subject to M having the sparsity pattern of A, via the
+// independent pattern-constrained least-squares problem of each column
+// (in the style of Grote and Huckle's SPAI). The result stays within
+// Elemental's sparse data structures and can be applied inside a Krylov
+// iteration with Multiply. In the distributed driver, each process solves
+// the subproblems of its locally owned columns after a single exchange of
+// the off-process matrix rows which those subproblems touch.
+
+template<typename Real>
+struct SPAICtrl
+{
+    // Augment each column's pattern with its diagonal entry so that the
+    // approximate inverse cannot be structurally singular.
+    bool forceDiagonal=true;
+
+    // Drop computed entries whose magnitude is at most 'dropTol' times the
+    // largest magnitude within their column.
+    Real dropTol=Real(0);
+};
+
+template<typename Field>
+void SPAI
+( const SparseMatrix<Field>& A,
+        SparseMatrix<Field>& M,
+  const SPAICtrl<Base<Field>>& ctrl=SPAICtrl<Base<Field>>() );
+template<typename Field>
+void SPAI
+( const DistSparseMatrix<Field>& A,
+        DistSparseMatrix<Field>& M,
+  const SPAICtrl<Base<Field>>& ctrl=SPAICtrl<Base<Field>>() );
+
+// Aggregation-based two-level preconditioning
+// ===========================================
+// Construct a two-level preconditioner for a Hermitian (typically elliptic)
+// sparse matrix: a decoupled greedy aggregation of the locally owned
+// subgraph defines a piecewise-constant prolongator, whose Galerkin coarse
+// operator is assembled directly through the sparse update queues and
+// factored once with the sparse-direct machinery. Each application is a
+// V-cycle of damped-Jacobi smoothing around the coarse solve, and the
+// in-place Apply matches the preconditioner signature of the flexible
+// Krylov drivers.
+
+template<typename Real>
+struct AggregationCtrl
+{
+    // The number of pre- and post-smoothing sweeps of damped Jacobi.
+    Int numSweeps=1;
+
+    // The damping factor of the Jacobi smoother.
+    Real damping=Real(2)/Real(3);
+
+    // The graph-partitioning control for the coarse factorization.
+    BisectCtrl bisectCtrl;
+};
+
+template<typename Field>
+class TwoLevelAggregation
+{
+public:
+    // The matrix is captured by reference for the smoother and residual
+    // applications and must therefore outlive the preconditioner
+    TwoLevelAggregation
+    ( const DistSparseMatrix<Field>& A,
+      const AggregationCtrl<Base<Field>>& ctrl=
+            AggregationCtrl<Base<Field>>() );
+
+    // Overwrite each column of B with the result of one V-cycle applied to
+    // the corresponding right-hand side
+    void Apply( DistMultiVec<Field>& B ) const;
+
+    // The dimension of the coarse operator
+    Int CoarseSize() const EL_NO_EXCEPT;
+
+private:
+    const DistSparseMatrix<Field>* A_;
+    AggregationCtrl<Base<Field>> ctrl_;
+
+    Int coarseSize_=0;
+    vector<Int> localAggs_; // the coarse index of each locally owned row
+    DistMultiVec<Field> dInv_; // the inverted diagonal for the smoother
+    DistSparseMatrix<Field> ACoarse_;
+    // The coarse triangular solves update internal solve metadata
+    mutable DistSparseLDLFactorization<Field> coarseFact_;
+};
+
+// Multicolor smoothing via distributed graph coloring
+// ===================================================
+// Color the vertices of a distributed graph so that no two vertices within
+// 'distance' hops of one another share a color, via the Jones-Plassmann
+// procedure: every vertex draws a random priority, and each round the
+// vertices which outrank all of their uncolored conflict neighbors claim
+// the smallest color absent from their neighborhoods. Only the priorities
+// and current colors of the off-process conflict neighbors are exchanged
+// (the former once, the latter once per round). The color classes then act
+// as the levels of a level-scheduled Gauss-Seidel sweep: MulticolorSmoother
+// visits the classes in sequence, refreshes the off-process solution
+// entries which the next class reads, and updates the rows of the class
+// concurrently, since a (distance-1) coloring of a symmetric pattern
+// guarantees that they do not couple.
+
+struct GraphColoringCtrl
+{
+    // Forbid shared colors within this many hops (one or two); distance-2
+    // colorings decouple the update sets of incomplete factorizations,
+    // whereas Gauss-Seidel smoothing only requires distance one.
+    Int distance=1;
+
+    bool progress=false;
+};
+
+// Returns the number of colors used; on exit, colors conforms with the
+// source distribution of the graph and holds an entry in [0,numColors)
+// for every vertex
+Int GraphColoring
+( const DistGraph& graph,
+        DistMultiVec<Int>& colors,
+  const GraphColoringCtrl& ctrl=GraphColoringCtrl() );
+
+template<typename Field>
+class MulticolorSmoother
+{
+public:
+    // Color the graph of A and build the level schedule; the matrix is
+    // captured by reference and must outlive the smoother
+    explicit MulticolorSmoother
+    ( const DistSparseMatrix<Field>& A,
+      const GraphColoringCtrl& ctrl=GraphColoringCtrl() );
+
+    // Adopt an externally computed coloring (e.g., of a richer conflict
+    // graph), which must conform with the row distribution of A
+    MulticolorSmoother
+    ( const DistSparseMatrix<Field>& A,
+      const DistMultiVec<Int>& colors,
+      Int numColors );
+
+    // Overwrite each column of X with the result of one multicolor
+    // Gauss-Seidel sweep on A X = B, visiting the color classes in
+    // increasing (or, with 'reverse', decreasing) order
+    void Sweep
+    ( const DistMultiVec<Field>& B,
+            DistMultiVec<Field>& X,
+      bool reverse=false ) const;
+
+    Int NumColors() const EL_NO_EXCEPT;
+
+private:
+    const DistSparseMatrix<Field>* A_;
+    Int numColors_=0;
+    vector<Int> localColors_; // the color of each locally owned row
+    DistMultiVec<Field> dInv_; // the inverted diagonal for the updates
+
+    // The level schedule: the local rows of each color class, together
+    // with the exchange pattern for the off-process solution entries
+    // which their updates read
+    struct Stage
+    {
+        vector<Int> rows;
+        vector<Int> requestIds; // sorted distinct off-process columns
+        vector<int> requestCounts, requestDispls;
+        vector<Int> serveIds; // local rows published to other processes
+        vector<int> serveCounts, serveDispls;
+    };
+    vector<Stage> stages_;
+
+    void BuildStages();
+};
+
+// Banded
+// ======
+// The maximum of |i-j| over the stored entries (zero for a diagonal or
+// empty matrix)
+template<typename T>
+Int Bandwidth( const SparseMatrix<T>& A );
+template<typename T>
+Int Bandwidth( const DistSparseMatrix<T>& A );
+
+// Solve A X = B for a narrowly banded, symmetric-pattern sparse matrix via
+// SPIKE-style partitioning: each process factors its diagonal block with
+// the sequential sparse-direct LDL (without any communication), forms the
+// dense spikes against its couplings to the adjacent row blocks, and the
+// small block-tridiagonal reduced system over the partition interfaces is
+// solved with the general distributed machinery. The couplings of the 1d
+// row distribution must only reach the neighboring processes, so every
+// local row block must be at least twice the bandwidth; see
+// BandedSolveViable for the (collective) dispatch test.
+template<typename Field>
+void BandedSolve
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& B,
+  bool conjugate=false,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// Whether BandedSolve applies to (and is expected to pay off for) the
+// given matrix and bandwidth: the matrix must be square and distributed
+// over more than one process, and every local row block must comfortably
+// dominate the bandwidth
+template<typename T>
+bool BandedSolveViable( const DistSparseMatrix<T>& A, Int bandwidth );
+
+// Toeplitz and Hankel
+// ===================
+// Solve the square Toeplitz system generated by the length 2n-1 vector 'a'
+// (A(i,j) = a[i-j+(n-1)]; see ToeplitzOperator) via FGMRES with the
+// FFT-based implicit application and a Strang circulant preconditioner,
+// for an O(n log n) cost per iteration rather than the O(n^3) of
+// densification followed by LU. The number of iterations is returned.
+template<typename Real>
+Int ToeplitzSolve
+( const vector<Complex<Real>>& a,
+        Matrix<Complex<Real>>& B,
+        Real relTol=1e-8,
+        Int restart=50,
+        Int maxIts=1000,
+        bool progress=false );
+
+// Solve the square Hankel system generated by the length 2n-1 vector 'a'
+// (A(i,j) = a[i+j]; see HankelOperator) by reversing the rows, which maps
+// the system onto a Toeplitz solve
+template<typename Real>
+Int HankelSolve
+( const vector<Complex<Real>>& a,
+        Matrix<Complex<Real>>& B,
+        Real relTol=1e-8,
+        Int restart=50,
+        Int maxIts=1000,
+        bool progress=false );
+
 // Multi-shift Hessenberg
 // ======================
 template<typename Field>
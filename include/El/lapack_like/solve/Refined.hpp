@@ -371,6 +371,163 @@ Int RefinedSolve
 
 namespace refined_solve {
 
+// The following variants replace the 'applyA' functor with an
+// 'applyResidual' functor of the form
+//
+//   void applyResidual( const Matrix<Field>& B, const Matrix<Field>& X,
+//                       Matrix<Field>& R )
+//
+// which should overwrite R with B - A X. Fusing the multiply and the
+// subtraction allows the residual to be accumulated in extended precision
+// (e.g., via CompensatedResidual), which is the entire point of iterative
+// refinement for ill-conditioned systems: the residual of a reasonable
+// approximate solution suffers from catastrophic cancellation when it is
+// formed as 'B -= Y' in the working precision.
+
+template<typename Field,class ApplyResidualType,class ApplyAInvType>
+Int CompensatedSingle
+( const ApplyResidualType& applyResidual,
+  const ApplyAInvType& applyAInv,
+        Matrix<Field>& b,
+        Base<Field> relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    if( maxRefineIts <= 0 )
+    {
+        applyAInv( b );
+        return 0;
+    }
+
+    const Base<Field> bNorm = MaxNorm( b );
+
+    // Compute the initial guess
+    // =========================
+    auto x = b;
+    applyAInv( x );
+
+    Matrix<Field> r, rCand, dx, xCand;
+    applyResidual( b, x, r );
+    Base<Field> errorNorm = MaxNorm( r );
+    if( progress )
+        Output("original rel error: ",errorNorm/bNorm);
+
+    Int refineIt = 0;
+    while( true )
+    {
+        if( errorNorm/bNorm <= relTol )
+        {
+            if( progress )
+                Output(errorNorm/bNorm," <= ",relTol);
+            break;
+        }
+
+        // Compute the proposed update to the solution
+        // -------------------------------------------
+        dx = r;
+        applyAInv( dx );
+        xCand = x;
+        xCand += dx;
+
+        // Check the new residual
+        // ----------------------
+        applyResidual( b, xCand, rCand );
+        auto newErrorNorm = MaxNorm( rCand );
+        if( progress )
+            Output("refined rel error: ",newErrorNorm/bNorm);
+
+        if( newErrorNorm < errorNorm )
+        {
+            x = xCand;
+            r = rCand;
+        }
+        else
+            break;
+
+        errorNorm = newErrorNorm;
+        ++refineIt;
+        if( refineIt >= maxRefineIts )
+            break;
+    }
+    b = x;
+    return refineIt;
+}
+
+template<typename Field,class ApplyResidualType,class ApplyAInvType>
+Int CompensatedBatch
+( const ApplyResidualType& applyResidual,
+  const ApplyAInvType& applyAInv,
+        Matrix<Field>& B,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    if( maxRefineIts <= 0 )
+    {
+        applyAInv( B );
+        return 0;
+    }
+
+    // Compute the initial guesses
+    // ===========================
+    auto BOrig = B;
+    auto X = B;
+    applyAInv( X );
+
+    Matrix<Field> dX;
+    applyResidual( BOrig, X, B );
+
+    Int refineIt = 0;
+    while( true )
+    {
+        // Compute the updates to the solutions
+        // ------------------------------------
+        dX = B;
+        applyAInv( dX );
+        X += dX;
+
+        ++refineIt;
+        if( refineIt < maxRefineIts )
+        {
+            // Compute the new residual
+            // ------------------------
+            applyResidual( BOrig, X, B );
+        }
+        else
+            break;
+    }
+    B = X;
+    return refineIt;
+}
+
+} // namespace refined_solve
+
+template<typename Field,class ApplyResidualType,class ApplyAInvType>
+Int CompensatedRefinedSolve
+( const ApplyResidualType& applyResidual,
+  const ApplyAInvType& applyAInv,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    // NOTE: Pairs of right-hand sides are handled via batch refinement
+    if( B.Width() == 1 )
+        return refined_solve::CompensatedSingle
+               ( applyResidual, applyAInv, B, relTol, maxRefineIts, progress );
+    else
+        return refined_solve::CompensatedBatch
+               ( applyResidual, applyAInv, B, maxRefineIts, progress );
+}
+
+namespace refined_solve {
+
 template<typename Field,class ApplyAType,class ApplyAInvType>
 Int PromotedSingle
 ( const ApplyAType& applyA,
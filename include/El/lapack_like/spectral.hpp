@@ -325,6 +325,17 @@ enum DCCombinedColumnType {
 };
 const Int NUM_DC_COMBINED_COLUMN_TYPES = 4;
 
+struct MRRRCtrl
+{
+    // The number of disjoint index windows to solve concurrently on
+    // independent sub-communicators when computing eigenvectors with PMRRR.
+    // Each window is assigned to a contiguous team of processes, which avoids
+    // involving the entire communicator in the representation tree of every
+    // window. Values of at most one solve the entire requested window over
+    // the full communicator.
+    Int numSlices=1;
+};
+
 } // namespace herm_tridiag_eig
 
 struct HermitianTridiagEigInfo
@@ -353,7 +364,7 @@ struct HermitianTridiagEigCtrl
     HermitianTridiagEigAlg alg=HERM_TRIDIAG_EIG_MRRR;
     herm_tridiag_eig::QRCtrl qrCtrl;
     herm_tridiag_eig::DCCtrl<Real> dcCtrl;
-    // TODO(poulson): MRRR ctrl
+    herm_tridiag_eig::MRRRCtrl mrrrCtrl;
 };
 
 // Compute eigenvalues
@@ -407,14 +418,33 @@ struct HermitianSDCCtrl
     bool progress=false;
 };
 
+// A blocked cyclic Jacobi eigensolver: rotation pairs are scheduled with a
+// round-robin tournament and applied as Gemm-rich block rotations. Below
+// roughly ten thousand rows it avoids the memory-bound tridiagonalization
+// of the standard dense path and computes the small eigenvalues of graded
+// matrices with better relative accuracy.
+template<typename Real>
+struct HermitianJacobiCtrl
+{
+    // The dimension of the square blocks paired by each rotation
+    Int blockSize=32;
+    Int maxSweeps=15;
+    // The relative off-diagonal tolerance for declaring the matrix
+    // diagonalized (values of at most zero select n*epsilon)
+    Real tol=Real(0);
+    bool progress=false;
+};
+
 template<typename Field>
 struct HermitianEigCtrl
 {
     HermitianTridiagCtrl<Field> tridiagCtrl;
     HermitianTridiagEigCtrl<Base<Field>> tridiagEigCtrl;
     HermitianSDCCtrl<Base<Field>> sdcCtrl;
+    HermitianJacobiCtrl<Base<Field>> jacobiCtrl;
     bool useScaLAPACK=false;
     bool useSDC=false;
+    bool useJacobi=false;
     bool timeStages=false;
 };
 
@@ -746,6 +776,12 @@ struct HessenbergSchurCtrl
     Int minMultiBulgeSize = 75;
     Int minDistMultiBulgeSize = 400;
 
+    // The maximum number of bulges to chase within a single small-bulge
+    // sweep (values of at most zero select the traditional cap of one
+    // sixth of the matrix height); shift batches beyond twice this bound
+    // are split across several consecutive sweeps
+    Int maxBulgesPerSweep=0;
+
     function<Int(Int,Int)> numShifts =
       function<Int(Int,Int)>(hess_schur::aed::NumShifts);
 
@@ -763,6 +799,12 @@ struct HessenbergSchurCtrl
     // the distributed multibulge algorithm.
     function<Int(Int)> numBulgesPerBlock =
       function<Int(Int)>(hess_schur::multibulge::NumBulgesPerBlock);
+    // Increase the recommended number of simultaneous shifts so that the
+    // pipelined bulge chains of the distributed multibulge sweep can occupy
+    // every other diagonal block of the process grid; the (sequentially
+    // motivated) IPARMQ-style recommendation would otherwise leave most of
+    // a large grid idle
+    bool scaleShiftsForGrid=true;
 };
 
 template<typename Field>
@@ -900,6 +942,28 @@ template<typename Field>
 DistMatrix<Complex<Base<Field>>,VR,STAR>
 QuasiTriangEig( const AbstractDistMatrix<Field>& U );
 
+// Reorder a triangular Schur form so that the selected eigenvalues occupy
+// the leading diagonal positions (in their original relative order) and
+// return the size of the resulting leading cluster. The selected eigenvalues
+// are dragged to the top through sliding diagonal windows: each adjacent swap
+// is generated from a scalar Sylvester solve but only applied within the
+// current window, and the accumulated window transformation is broadcast to
+// the remainder of the Schur factor (and the Schur vectors) as GEMMs. A
+// non-positive window size defers to the algorithmic blocksize.
+// Quasi-triangular real Schur forms should first be converted to complex
+// triangular form via schur::RealToComplex.
+template<typename Field>
+Int ReorderSchur
+( Matrix<Field>& U,
+  const vector<bool>& select,
+  Int windowSize=0 );
+template<typename Field>
+Int ReorderSchur
+( Matrix<Field>& U,
+  Matrix<Field>& Q,
+  const vector<bool>& select,
+  Int windowSize=0 );
+
 template<typename Real>
 void RealToComplex
 ( const Matrix<Real>& UQuasi, Matrix<Complex<Real>>& U );
@@ -1214,6 +1278,29 @@ struct SVDInfo
     BidiagSVDInfo bidiagSVDInfo;
 };
 
+namespace svd {
+
+struct RandomizedCtrl
+{
+    // The number of dominant singular triplets to approximate
+    Int rank=0;
+
+    // The number of extra columns in the Gaussian sketch beyond the target
+    // rank (which sharply improves the failure probability of the
+    // range-finder)
+    Int oversample=10;
+
+    // The number of power iterations used to sharpen the range estimate,
+    // which is worthwhile whenever the singular spectrum decays slowly
+    Int numPowerIts=2;
+
+    // If positive, computed singular triplets whose values are at most this
+    // multiple of the largest computed singular value are also discarded
+    double relTol=0.;
+};
+
+} // namespace svd
+
 template<typename Real>
 struct SVDCtrl
 {
@@ -1238,6 +1325,12 @@ struct SVDCtrl
     double fullChanRatio=1.5;
 
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
+
+    // Approximate only the dominant singular triplets with a randomized
+    // range-finder (a Gaussian sketch sharpened by power iteration) rather
+    // than running a full bidiagonalization
+    bool useRandomized=false;
+    svd::RandomizedCtrl randomizedCtrl;
 };
 
 // Compute the singular values
@@ -1355,8 +1448,80 @@ SVDInfo TSQR
         AbstractDistMatrix<Base<Field>>& s,
         AbstractDistMatrix<Field>& V );
 
+// Approximate the dominant singular triplets via a randomized range-finder
+// (a Gaussian sketch sharpened by power iteration followed by a small dense
+// SVD); the target rank and quality knobs live in ctrl.randomizedCtrl
+template<typename Field>
+SVDInfo Randomized
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl );
+template<typename Field>
+SVDInfo Randomized
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl );
+
 } // namespace svd
 
+// Incremental SVD
+// ===============
+// Maintain a rank-limited thin SVD, A ~= U diag(s) V^H, of a matrix whose
+// columns arrive (and expire) in a stream. Newly arrived blocks of columns
+// are folded in with a rank-b modification [Brand, 2006]: the new block is
+// orthogonalized against the current left basis via QR, a small dense SVD
+// re-diagonalizes the (r+b)-dimensional core, and both bases are rotated.
+// Expired columns are removed through analogous rank-one downdates. Since
+// the bases drift from orthonormality under repeated rotation, they are
+// re-orthonormalized via QR (followed by a re-diagonalization of the
+// triangular core) after every reorthogPeriod modifications.
+template<typename Field>
+class IncrementalSVD
+{
+public:
+    IncrementalSVD( Int maxRank=50, Int reorthogPeriod=64 );
+
+    // Overwrite the factorization with a (truncated) batch SVD of the
+    // initial window
+    void Initialize( const Matrix<Field>& A );
+
+    // Append a block of newly arrived columns
+    void Update( const Matrix<Field>& C );
+
+    // Expire the oldest numColumns columns of the window, which correspond
+    // to the leading rows of V
+    void Downdate( Int numColumns=1 );
+
+    // Restore the orthonormality of the bases and re-diagonalize
+    void Reorthogonalize();
+
+    Int Rank() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+    // The current window width
+    Int NumColumns() const EL_NO_EXCEPT;
+    const Matrix<Field>& U() const;
+    const Matrix<Base<Field>>& SingularValues() const;
+    const Matrix<Field>& V() const;
+
+private:
+    Int maxRank_;
+    Int reorthogPeriod_;
+    Int numModsSinceReorthog_=0;
+    bool initialized_=false;
+
+    Matrix<Field> U_, V_;
+    Matrix<Base<Field>> s_;
+
+    // Drop the singular triplets beyond maxRank or below the truncation
+    // threshold
+    void Truncate();
+    void MaybeReorthogonalize();
+};
+
 // Hermitian SVD
 // =============
 
@@ -1462,6 +1627,10 @@ void Kernel
 //
 // where A is an (explicitly) Hermitian matrix.
 
+// Declared in El/matrices.hpp
+template<typename T>
+class MatrixFreeOperator;
+
 template<typename Field>
 void Lanczos
 ( const SparseMatrix<Field>& A,
@@ -1472,6 +1641,11 @@ void Lanczos
 ( const DistSparseMatrix<Field>& A,
         AbstractDistMatrix<Base<Field>>& T,
         Int basisSize=20 );
+template<typename Field>
+void Lanczos
+( const MatrixFreeOperator<Field>& A,
+        Matrix<Base<Field>>& T,
+        Int basisSize=20 );
 
 template<typename Field>
 Base<Field> LanczosDecomp
@@ -1487,6 +1661,109 @@ Base<Field> LanczosDecomp
         AbstractDistMatrix<Base<Field>>& T,
         DistMultiVec<Field>& v,
         Int basisSize=15 );
+template<typename Field>
+Base<Field> LanczosDecomp
+( const MatrixFreeOperator<Field>& A,
+        Matrix<Field>& V,
+        Matrix<Base<Field>>& T,
+        Matrix<Field>& v,
+        Int basisSize=15 );
+
+template<typename Real>
+struct LanczosCtrl
+{
+    // The number of extremal eigenpairs to converge
+    Int numWanted=5;
+    // The number of vectors in each block of the basis (blocks wider than a
+    // single vector allow each application of A to amortize into a sparse
+    // matrix times multivector multiplication)
+    Int blockSize=4;
+    // The maximum number of basis vectors held between thick restarts
+    Int basisSize=60;
+    // The maximum number of thick restarts before returning the current
+    // (possibly unconverged) Ritz approximations
+    Int maxRestarts=50;
+    // The relative residual tolerance for declaring a Ritz pair converged
+    // (values of at most zero select a precision-dependent default)
+    Real relTol=Real(0);
+    // Whether the largest (DESCENDING) or smallest (ASCENDING) eigenvalues
+    // are targeted
+    SortType sort=DESCENDING;
+    bool progress=false;
+};
+
+// Compute extremal eigenpairs of an (explicitly) Hermitian matrix with a
+// thick-restart block Lanczos iteration; the return value is the number of
+// converged Ritz pairs, which occupy the leading entries of w and columns
+// of Q.
+template<typename Field>
+Int RestartedLanczos
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& Q,
+  const LanczosCtrl<Base<Field>>& ctrl=LanczosCtrl<Base<Field>>() );
+template<typename Field>
+Int RestartedLanczos
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& Q,
+  const LanczosCtrl<Base<Field>>& ctrl=LanczosCtrl<Base<Field>>() );
+
+template<typename Real>
+struct FilteredSubspaceCtrl
+{
+    // The number of vectors in the iterated subspace, which must exceed the
+    // number of eigenvalues in the target interval for every pair in the
+    // interval to be recoverable
+    Int subspaceSize=100;
+    // The degree of the Chebyshev bandpass filter applied in each iteration
+    Int degree=20;
+    // Whether Jackson damping is applied to suppress the Gibbs oscillations
+    // of the truncated Chebyshev expansion
+    bool dampen=true;
+    // The maximum number of filtered subspace iterations before returning
+    // the current (possibly unconverged) Ritz approximations
+    Int maxIts=30;
+    // The relative residual tolerance for declaring a Ritz pair converged
+    // (values of at most zero select a precision-dependent default)
+    Real relTol=Real(0);
+    // Whether bounds on the spectrum should be estimated from a short
+    // Lanczos run (of lanczosBasisSize steps); if not, the bounds below are
+    // used instead. The filter need only be bounded by one in magnitude
+    // over the spectrum, so rough bounds suffice.
+    bool estimateSpectralBounds=true;
+    Int lanczosBasisSize=30;
+    Real spectralLowerBound=Real(0);
+    Real spectralUpperBound=Real(0);
+    bool progress=false;
+};
+
+// Compute the eigenpairs of an (explicitly) Hermitian matrix whose
+// eigenvalues lie in the interval [a,b] via Chebyshev-filtered subspace
+// iteration: each iteration applies a polynomial bandpass filter for the
+// interval (built from repeated sparse multiplications) to the subspace and
+// then performs a Rayleigh-Ritz projection via a dense HermitianEig on the
+// projected block. The return value is the number of converged eigenpairs
+// in the interval; the Ritz values found in the interval occupy w (in
+// ascending order) and their Ritz vectors the corresponding columns of Q.
+template<typename Field>
+Int FilteredSubspaceEig
+( const SparseMatrix<Field>& A,
+        Base<Field> a,
+        Base<Field> b,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& Q,
+  const FilteredSubspaceCtrl<Base<Field>>& ctrl=
+        FilteredSubspaceCtrl<Base<Field>>() );
+template<typename Field>
+Int FilteredSubspaceEig
+( const DistSparseMatrix<Field>& A,
+        Base<Field> a,
+        Base<Field> b,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& Q,
+  const FilteredSubspaceCtrl<Base<Field>>& ctrl=
+        FilteredSubspaceCtrl<Base<Field>>() );
 
 // Product Lanczos
 // ===============
@@ -1506,6 +1783,11 @@ void ProductLanczos
 ( const DistSparseMatrix<Field>& A,
         AbstractDistMatrix<Base<Field>>& T,
         Int basisSize=20 );
+template<typename Field>
+void ProductLanczos
+( const MatrixFreeOperator<Field>& A,
+        Matrix<Base<Field>>& T,
+        Int basisSize=20 );
 
 template<typename Field>
 Base<Field> ProductLanczosDecomp
@@ -1521,6 +1803,13 @@ Base<Field> ProductLanczosDecomp
         AbstractDistMatrix<Base<Field>>& T,
         DistMultiVec<Field>& v,
         Int basisSize=15 );
+template<typename Field>
+Base<Field> ProductLanczosDecomp
+( const MatrixFreeOperator<Field>& A,
+        Matrix<Field>& V,
+        Matrix<Base<Field>>& T,
+        Matrix<Field>& v,
+        Int basisSize=15 );
 
 // Extremal singular value estimates
 // =================================
@@ -1549,6 +1838,36 @@ pair<Base<Field>,Base<Field>>
 HermitianExtremalSingValEst
 ( const DistSparseMatrix<Field>& A, Int basisSize=20 );
 
+template<typename Real>
+struct ExtremalSingValEstCtrl
+{
+    // The maximum number of Golub-Kahan (bidiagonal) Lanczos steps
+    Int maxBasisSize=60;
+    // The number of steps taken before the first convergence test
+    Int minBasisSize=4;
+    // The relative-change tolerance for declaring both extremal estimates
+    // converged (values of at most zero select a precision-dependent default)
+    Real relTol=Real(0);
+    bool progress=false;
+};
+
+// Estimate both extremal singular values of an abstract operator from a
+// single Golub-Kahan (bidiagonal) Lanczos run, stopping as soon as neither
+// estimate is changing by more than the relative tolerance rather than after
+// a fixed number of steps. When v has the width of the operator it is used
+// (after a single power-iteration step on A^H A) to warm start the
+// iteration, which sharply reduces the number of steps when the operator
+// drifts slowly between calls, as in step-size selection for first-order
+// methods; v is overwritten with the dominant right Ritz vector for the
+// next call.
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+ExtremalSingValEst
+( const MatrixFreeOperator<Field>& A,
+        Matrix<Field>& v,
+  const ExtremalSingValEstCtrl<Base<Field>>& ctrl=
+        ExtremalSingValEstCtrl<Base<Field>>() );
+
 // Pseudospectra
 // =============
 enum PseudospecNorm {
@@ -1600,6 +1919,14 @@ struct PseudospecCtrl
     Real tol=Real(1e-6);
     bool deflate=true;
 
+    // The maximum number of shifts to simultaneously propagate through the
+    // shared multi-shift solves (values of at most zero propagate every
+    // shift at once). Each batch internally deflates its converged shifts,
+    // so bounding the batch width keeps the iterate storage of very large
+    // spectral portraits proportional to the batch width rather than to
+    // the total number of grid points
+    Int maxBatchWidth=0;
+
     // (Implicitly Restarted) Arnoldi/Lanczos. If basisSize > 1, then
     // there is implicit restarting
     bool arnoldi=true;
@@ -2013,6 +2340,7 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 #include <El/lapack_like/spectral/HermitianEig.hpp>
 #include <El/lapack_like/spectral/SVD.hpp>
 #include <El/lapack_like/spectral/Lanczos.hpp>
+#include <El/lapack_like/spectral/FilteredSubspace.hpp>
 #include <El/lapack_like/spectral/ProductLanczos.hpp>
 
 #endif // ifndef EL_SPECTRAL_HPP
@@ -0,0 +1,394 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_FILTERED_SUBSPACE_HPP
+#define EL_SPECTRAL_FILTERED_SUBSPACE_HPP
+
+namespace El {
+
+// Chebyshev-filtered subspace iteration for the eigenpairs of a Hermitian
+// operator which lie in a prescribed interval. Each iteration applies a
+// fixed-degree Chebyshev approximation of the indicator function of the
+// interval to the subspace, so that the wanted invariant subspace is
+// amplified relative to the rest of the spectrum at the cost of only
+// repeated applications of the operator, and then performs a Rayleigh-Ritz
+// projection via a dense Hermitian eigensolve on the (small) projected
+// block.
+
+namespace filtered_subspace {
+
+// Expand the indicator function of the subinterval [tA,tB] of [-1,1] in
+// Chebyshev polynomials of the first kind, optionally applying Jackson
+// damping to suppress the Gibbs oscillations of the truncated expansion
+// (at the expense of a gentler transition at the interval endpoints)
+template<typename Real>
+void FilterCoefficients
+( Real tA, Real tB, Int degree, bool dampen, vector<Real>& coefs )
+{
+    EL_DEBUG_CSE
+    const Real pi = Pi<Real>();
+    tA = Max( Real(-1), Min( Real(1), tA ) );
+    tB = Max( Real(-1), Min( Real(1), tB ) );
+    const Real thA = Acos( tA );
+    const Real thB = Acos( tB );
+    coefs.resize( degree+1 );
+    coefs[0] = (thA-thB)/pi;
+    for( Int j=1; j<=degree; ++j )
+        coefs[j] = 2*(Sin(Real(j)*thA)-Sin(Real(j)*thB))/(Real(j)*pi);
+    if( dampen )
+    {
+        const Real gamma = pi/Real(degree+1);
+        for( Int j=0; j<=degree; ++j )
+            coefs[j] *=
+              ( Real(degree+1-j)*Cos(Real(j)*gamma) +
+                Sin(Real(j)*gamma)/Tan(gamma) ) / Real(degree+1);
+    }
+}
+
+} // namespace filtered_subspace
+
+template<typename Field,class ApplyAType>
+Int FilteredSubspaceEig
+(       Int n,
+  const ApplyAType& applyA,
+        Base<Field> a,
+        Base<Field> b,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& Q,
+  const FilteredSubspaceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real relTol = ( ctrl.relTol > Real(0) ? ctrl.relTol : Sqrt(eps) );
+    if( b <= a )
+        LogicError("The target interval was empty");
+
+    const Int subspaceSize = Min( Max( ctrl.subspaceSize, Int(1) ), n );
+    const Int degree = Max( ctrl.degree, Int(1) );
+
+    // Determine bounds on the spectrum, either from the user or from the
+    // extremal Ritz values of a short Lanczos run, and widen them slightly:
+    // the filter need only be bounded by one in magnitude over the
+    // spectrum, not accurate near its edges
+    Real lower = ctrl.spectralLowerBound;
+    Real upper = ctrl.spectralUpperBound;
+    if( ctrl.estimateSpectralBounds )
+    {
+        Matrix<Real> TLan, mu;
+        Lanczos<Field>( n, applyA, TLan, ctrl.lanczosBasisSize );
+        HermitianEig( UPPER, TLan, mu );
+        lower = mu(0);
+        upper = mu(mu.Height()-1);
+    }
+    const Real spread = Max( upper-lower, eps*Max(Abs(lower),Real(1)) );
+    lower -= spread/20;
+    upper += spread/20;
+
+    // Expand the indicator function of the target interval after the
+    // affine change of variables which maps [lower,upper] onto [-1,1]
+    const Real center = (upper+lower)/2;
+    const Real halfWidth = (upper-lower)/2;
+    vector<Real> coefs;
+    filtered_subspace::FilterCoefficients
+    ( (a-center)/halfWidth, (b-center)/halfWidth, degree, ctrl.dampen,
+      coefs );
+
+    // Overwrite S with the filter applied to each of its columns via the
+    // three-term Chebyshev recurrence on the mapped operator
+    Matrix<Field> T0, T1, T2, F;
+    auto applyFilter = [&]( Matrix<Field>& S )
+    {
+        T0 = S;
+        applyA( T0, T1 );
+        T1 *= 1/halfWidth;
+        Axpy( -center/halfWidth, T0, T1 );
+        Zeros( F, n, S.Width() );
+        Axpy( coefs[0], T0, F );
+        Axpy( coefs[1], T1, F );
+        for( Int j=2; j<=degree; ++j )
+        {
+            applyA( T1, T2 );
+            T2 *= 2/halfWidth;
+            Axpy( -2*center/halfWidth, T1, T2 );
+            Axpy( Field(-1), T0, T2 );
+            Axpy( coefs[j], T2, F );
+            T0 = T1;
+            T1 = T2;
+        }
+        S = F;
+    };
+
+    Matrix<Field> S, W, G, Y, SNew, WNew;
+    Matrix<Real> theta;
+    Gaussian( S, n, subspaceSize );
+    qr::ExplicitUnitary( S );
+
+    Int numConverged = 0;
+    for( Int it=0; it<ctrl.maxIts; ++it )
+    {
+        // Filter and re-orthonormalize the subspace
+        applyFilter( S );
+        qr::ExplicitUnitary( S );
+
+        // Rayleigh-Ritz: project the operator onto the subspace and rotate
+        // the basis to the Ritz vectors
+        applyA( S, W );
+        Zeros( G, subspaceSize, subspaceSize );
+        Gemm( ADJOINT, NORMAL, Field(1), S, W, Field(0), G );
+        HermitianEig( UPPER, G, theta, Y );
+        Zeros( SNew, n, subspaceSize );
+        Gemm( NORMAL, NORMAL, Field(1), S, Y, Field(0), SNew );
+        Zeros( WNew, n, subspaceSize );
+        Gemm( NORMAL, NORMAL, Field(1), W, Y, Field(0), WNew );
+        S = SNew;
+
+        // The Ritz residuals are A s_i - theta_i s_i; only the pairs whose
+        // Ritz values fall within the target interval are tested
+        const Real maxAbsEig =
+          Max( Abs(theta(0)), Abs(theta(subspaceSize-1)) );
+        numConverged = 0;
+        Int numInInterval = 0;
+        for( Int i=0; i<subspaceSize; ++i )
+        {
+            if( theta(i) < a || theta(i) > b )
+                continue;
+            ++numInInterval;
+            auto r = WNew( ALL, IR(i) );
+            Axpy( -theta(i), S(ALL,IR(i)), r );
+            const Real resNorm = FrobeniusNorm( r );
+            if( resNorm <= Max(relTol*Abs(theta(i)),eps*maxAbsEig) )
+                ++numConverged;
+        }
+        if( ctrl.progress )
+            Output
+            ("FilteredSubspaceEig: iteration ",it,", ",numConverged," of ",
+             numInInterval," pairs in the interval converged");
+
+        if( (numInInterval > 0 && numConverged == numInInterval) ||
+            it == ctrl.maxIts-1 )
+        {
+            w.Resize( numInInterval, 1 );
+            Zeros( Q, n, numInInterval );
+            Int pos = 0;
+            for( Int i=0; i<subspaceSize; ++i )
+            {
+                if( theta(i) < a || theta(i) > b )
+                    continue;
+                w(pos) = theta(i);
+                auto q = Q( ALL, IR(pos) );
+                q = S( ALL, IR(i) );
+                ++pos;
+            }
+            break;
+        }
+    }
+    return numConverged;
+}
+
+template<typename Field,class ApplyAType>
+Int FilteredSubspaceEig
+(       Int n,
+  const ApplyAType& applyA,
+        Base<Field> a,
+        Base<Field> b,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        DistMultiVec<Field>& Q,
+  const FilteredSubspaceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& w = wProx.Get();
+    const Grid& grid = w.Grid();
+    mpi::Comm comm = grid.Comm();
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real relTol = ( ctrl.relTol > Real(0) ? ctrl.relTol : Sqrt(eps) );
+    if( b <= a )
+        LogicError("The target interval was empty");
+
+    const Int subspaceSize = Min( Max( ctrl.subspaceSize, Int(1) ), n );
+    const Int degree = Max( ctrl.degree, Int(1) );
+
+    // Determine bounds on the spectrum (broadcasting the result to protect
+    // against forward instability of the small eigensolve) and widen them
+    // slightly: the filter need only be bounded by one in magnitude over
+    // the spectrum, not accurate near its edges
+    Real bounds[2] =
+      { ctrl.spectralLowerBound, ctrl.spectralUpperBound };
+    if( ctrl.estimateSpectralBounds )
+    {
+        DistMatrix<Real,STAR,STAR> TLan(grid);
+        Lanczos<Field>( n, applyA, TLan, ctrl.lanczosBasisSize );
+        if( grid.Rank() == 0 )
+        {
+            Matrix<Real> TSub( TLan.Matrix() ), mu;
+            HermitianEig( UPPER, TSub, mu );
+            bounds[0] = mu(0);
+            bounds[1] = mu(mu.Height()-1);
+        }
+        mpi::Broadcast( bounds, 2, 0, comm );
+    }
+    Real lower = bounds[0];
+    Real upper = bounds[1];
+    const Real spread = Max( upper-lower, eps*Max(Abs(lower),Real(1)) );
+    lower -= spread/20;
+    upper += spread/20;
+
+    // Expand the indicator function of the target interval after the
+    // affine change of variables which maps [lower,upper] onto [-1,1]
+    const Real center = (upper+lower)/2;
+    const Real halfWidth = (upper-lower)/2;
+    vector<Real> coefs;
+    filtered_subspace::FilterCoefficients
+    ( (a-center)/halfWidth, (b-center)/halfWidth, degree, ctrl.dampen,
+      coefs );
+
+    // Orthonormalize a multivector via (twice-iterated) Cholesky QR; a
+    // small diagonal shift guards the factorization against the severe
+    // ill-conditioning of a freshly filtered block, whose unwanted
+    // directions have been damped by several orders of magnitude
+    auto cholQR = [&]( DistMultiVec<Field>& X )
+    {
+        const Int width = X.Width();
+        Matrix<Field> G;
+        for( Int pass=0; pass<2; ++pass )
+        {
+            Zeros( G, width, width );
+            Gemm
+            ( ADJOINT, NORMAL, Field(1), X.Matrix(), X.Matrix(), Field(0),
+              G );
+            mpi::AllReduce( G.Buffer(), int(width*width), mpi::SUM, comm );
+            Real maxDiag = 0;
+            for( Int i=0; i<width; ++i )
+                maxDiag = Max( maxDiag, RealPart(G(i,i)) );
+            ShiftDiagonal( G, Field(eps*Max(maxDiag,Real(1))) );
+            Cholesky( UPPER, G );
+            MakeTrapezoidal( UPPER, G );
+            Trsm
+            ( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), G, X.Matrix() );
+        }
+    };
+
+    // Overwrite S with the filter applied to each of its columns via the
+    // three-term Chebyshev recurrence on the mapped operator
+    DistMultiVec<Field> T0(grid), T1(grid), T2(grid), F(grid);
+    auto applyFilter = [&]( DistMultiVec<Field>& S )
+    {
+        T0 = S;
+        applyA( T0, T1 );
+        T1 *= 1/halfWidth;
+        Axpy( -center/halfWidth, T0, T1 );
+        Zeros( F, n, S.Width() );
+        Axpy( coefs[0], T0, F );
+        Axpy( coefs[1], T1, F );
+        for( Int j=2; j<=degree; ++j )
+        {
+            applyA( T1, T2 );
+            T2 *= 2/halfWidth;
+            Axpy( -2*center/halfWidth, T1, T2 );
+            Axpy( Field(-1), T0, T2 );
+            Axpy( coefs[j], T2, F );
+            T0 = T1;
+            T1 = T2;
+        }
+        S = F;
+    };
+
+    DistMultiVec<Field> S(grid), W(grid);
+    Matrix<Field> G, Y, SNewLoc, WNewLoc;
+    Matrix<Real> theta;
+    Gaussian( S, n, subspaceSize );
+    cholQR( S );
+
+    Int numConverged = 0;
+    for( Int it=0; it<ctrl.maxIts; ++it )
+    {
+        // Filter and re-orthonormalize the subspace
+        applyFilter( S );
+        cholQR( S );
+        auto& SLoc = S.Matrix();
+
+        // Rayleigh-Ritz: project the operator onto the subspace, solve the
+        // (replicated) projected eigenproblem on the root, and rotate the
+        // basis to the Ritz vectors
+        applyA( S, W );
+        Zeros( G, subspaceSize, subspaceSize );
+        Gemm( ADJOINT, NORMAL, Field(1), SLoc, W.Matrix(), Field(0), G );
+        mpi::AllReduce
+        ( G.Buffer(), int(subspaceSize*subspaceSize), mpi::SUM, comm );
+        Zeros( theta, subspaceSize, 1 );
+        Zeros( Y, subspaceSize, subspaceSize );
+        if( grid.Rank() == 0 )
+            HermitianEig( UPPER, G, theta, Y );
+        mpi::Broadcast( theta.Buffer(), int(subspaceSize), 0, comm );
+        mpi::Broadcast
+        ( Y.Buffer(), int(subspaceSize*subspaceSize), 0, comm );
+        Zeros( SNewLoc, SLoc.Height(), subspaceSize );
+        Gemm( NORMAL, NORMAL, Field(1), SLoc, Y, Field(0), SNewLoc );
+        Zeros( WNewLoc, SLoc.Height(), subspaceSize );
+        Gemm( NORMAL, NORMAL, Field(1), W.Matrix(), Y, Field(0), WNewLoc );
+        SLoc = SNewLoc;
+
+        // The Ritz residuals are A s_i - theta_i s_i; only the pairs whose
+        // Ritz values fall within the target interval are tested
+        vector<Real> resSq( subspaceSize, Real(0) );
+        for( Int i=0; i<subspaceSize; ++i )
+        {
+            auto rLoc = WNewLoc( ALL, IR(i) );
+            Axpy( -theta(i), SLoc(ALL,IR(i)), rLoc );
+            const Real localNorm = FrobeniusNorm( rLoc );
+            resSq[i] = localNorm*localNorm;
+        }
+        mpi::AllReduce( resSq.data(), int(subspaceSize), mpi::SUM, comm );
+
+        const Real maxAbsEig =
+          Max( Abs(theta(0)), Abs(theta(subspaceSize-1)) );
+        numConverged = 0;
+        Int numInInterval = 0;
+        for( Int i=0; i<subspaceSize; ++i )
+        {
+            if( theta(i) < a || theta(i) > b )
+                continue;
+            ++numInInterval;
+            if( Sqrt(resSq[i]) <= Max(relTol*Abs(theta(i)),eps*maxAbsEig) )
+                ++numConverged;
+        }
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output
+            ("FilteredSubspaceEig: iteration ",it,", ",numConverged," of ",
+             numInInterval," pairs in the interval converged");
+
+        if( (numInInterval > 0 && numConverged == numInInterval) ||
+            it == ctrl.maxIts-1 )
+        {
+            w.Resize( numInInterval, 1 );
+            auto& wLoc = w.Matrix();
+            Zeros( Q, n, numInInterval );
+            auto& QLoc = Q.Matrix();
+            Int pos = 0;
+            for( Int i=0; i<subspaceSize; ++i )
+            {
+                if( theta(i) < a || theta(i) > b )
+                    continue;
+                wLoc(pos) = theta(i);
+                auto qLoc = QLoc( ALL, IR(pos) );
+                qLoc = SLoc( ALL, IR(i) );
+                ++pos;
+            }
+            break;
+        }
+    }
+    return numConverged;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_FILTERED_SUBSPACE_HPP
@@ -344,6 +344,373 @@ Base<Field> LanczosDecomp
     return beta;
 }
 
+// CITATION
+//
+// Please see
+//
+//   K. Wu and H. Simon,
+//   "Thick-restart Lanczos method for large symmetric eigenvalue problems",
+//   SIAM J. Matrix Anal. & Appl., 22(2), pp. 602--616, 2000
+//
+// for the restarting scheme generalized blockwise below. Each new block is
+// orthogonalized against the entire (restart-bounded) basis, with a second
+// Gram-Schmidt pass whenever the first significantly reduced the block's
+// norm, so that the projected matrix can be treated as Hermitian and the
+// retained Ritz vectors remain numerically orthogonal across restarts.
+
+template<typename Field,class ApplyAType>
+Int RestartedLanczos
+(       Int n,
+  const ApplyAType& applyA,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& Q,
+  const LanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real relTol = ( ctrl.relTol > Real(0) ? ctrl.relTol : Sqrt(eps) );
+
+    const Int numWanted = Min( ctrl.numWanted, n );
+    const Int blockSize = Min( Max( ctrl.blockSize, Int(1) ), n );
+    const Int basisSize =
+      Min( Max( ctrl.basisSize, numWanted+3*blockSize ), n );
+    const bool wantLargest = ( ctrl.sort != ASCENDING );
+
+    Matrix<Field> V, T, W, H, H2, R, Y;
+    Matrix<Real> theta;
+    Zeros( V, n, basisSize );
+    Zeros( T, basisSize, basisSize );
+
+    // Start from a random orthonormal block
+    Gaussian( W, n, blockSize );
+    qr::ExplicitUnitary( W );
+    Zeros( R, blockSize, blockSize );
+
+    Int j = 0;
+    Int numConverged = 0;
+    for( Int restart=0; restart<=ctrl.maxRestarts; ++restart )
+    {
+        // Expand the basis until it is full
+        while( j+blockSize <= basisSize )
+        {
+            const Int b = blockSize;
+            auto V1 = V( ALL, IR(j,j+b) );
+            V1 = W;
+
+            // W := A V1, orthogonalized against the current basis
+            applyA( V1, W );
+            auto V0 = V( ALL, IR(0,j+b) );
+            const Real initNorm = FrobeniusNorm( W );
+            Zeros( H, j+b, b );
+            Gemm( ADJOINT, NORMAL, Field(1), V0, W, Field(0), H );
+            Gemm( NORMAL, NORMAL, Field(-1), V0, H, Field(1), W );
+            if( FrobeniusNorm(W) < initNorm/Sqrt(Real(2)) )
+            {
+                Zeros( H2, j+b, b );
+                Gemm( ADJOINT, NORMAL, Field(1), V0, W, Field(0), H2 );
+                Gemm( NORMAL, NORMAL, Field(-1), V0, H2, Field(1), W );
+                H += H2;
+            }
+            auto T01 = T( IR(0,j+b), IR(j,j+b) );
+            T01 = H;
+
+            // Orthonormalize the residual block, replacing it with a random
+            // (orthogonalized) block if the Krylov space was numerically
+            // invariant
+            qr::Explicit( W, R );
+            const Real beta = FrobeniusNorm( R );
+            if( beta <= eps*Max(initNorm,Real(1)) )
+            {
+                Gaussian( W, n, b );
+                Zeros( H2, j+b, b );
+                Gemm( ADJOINT, NORMAL, Field(1), V0, W, Field(0), H2 );
+                Gemm( NORMAL, NORMAL, Field(-1), V0, H2, Field(1), W );
+                qr::ExplicitUnitary( W );
+                Zeros( R, b, b );
+            }
+            j += b;
+        }
+
+        // Solve the projected eigenproblem (only the upper triangle of T
+        // was filled)
+        Matrix<Field> TSub;
+        TSub = T( IR(0,j), IR(0,j) );
+        HermitianEig( UPPER, TSub, theta, Y );
+
+        // The Ritz residual norms are || R Y(j-b:j,i) ||_2
+        Matrix<Field> S;
+        auto YBot = Y( IR(j-blockSize,j), ALL );
+        Zeros( S, blockSize, j );
+        Gemm( NORMAL, NORMAL, Field(1), R, YBot, Field(0), S );
+
+        const Real maxAbsEig = Max( Abs(theta(0)), Abs(theta(j-1)) );
+        numConverged = 0;
+        for( Int i=0; i<numWanted; ++i )
+        {
+            const Int sel = ( wantLargest ? j-1-i : i );
+            const Real resNorm = FrobeniusNorm( S( ALL, IR(sel) ) );
+            if( resNorm <= Max(relTol*Abs(theta(sel)),eps*maxAbsEig) )
+                ++numConverged;
+            else
+                break;
+        }
+        if( ctrl.progress )
+            Output
+            ("RestartedLanczos: restart ",restart,", ",numConverged," of ",
+             numWanted," pairs converged");
+
+        if( numConverged >= numWanted || restart == ctrl.maxRestarts )
+        {
+            w.Resize( numWanted, 1 );
+            Matrix<Field> YSel;
+            Zeros( YSel, j, numWanted );
+            for( Int i=0; i<numWanted; ++i )
+            {
+                const Int sel = ( wantLargest ? j-1-i : i );
+                w(i) = theta(sel);
+                auto ySel = YSel( ALL, IR(i) );
+                ySel = Y( ALL, IR(sel) );
+            }
+            auto V0 = V( ALL, IR(0,j) );
+            Zeros( Q, n, numWanted );
+            Gemm( NORMAL, NORMAL, Field(1), V0, YSel, Field(0), Q );
+            return numConverged;
+        }
+
+        // Thick restart: retain the most relevant Ritz vectors and reseed
+        // the recurrence with the (already orthonormal) residual block
+        const Int ell = Min( 2*numWanted, j-blockSize );
+        Matrix<Field> YKeep;
+        Zeros( YKeep, j, ell );
+        for( Int i=0; i<ell; ++i )
+        {
+            const Int sel = ( wantLargest ? j-1-i : i );
+            auto yKeep = YKeep( ALL, IR(i) );
+            yKeep = Y( ALL, IR(sel) );
+        }
+        auto V0 = V( ALL, IR(0,j) );
+        Matrix<Field> VNew;
+        Zeros( VNew, n, ell );
+        Gemm( NORMAL, NORMAL, Field(1), V0, YKeep, Field(0), VNew );
+        auto VKeep = V( ALL, IR(0,ell) );
+        VKeep = VNew;
+        Zero( T );
+        for( Int i=0; i<ell; ++i )
+        {
+            const Int sel = ( wantLargest ? j-1-i : i );
+            T(i,i) = theta(sel);
+        }
+        j = ell;
+    }
+    return numConverged;
+}
+
+template<typename Field,class ApplyAType>
+Int RestartedLanczos
+(       Int n,
+  const ApplyAType& applyA,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        DistMultiVec<Field>& Q,
+  const LanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& w = wProx.Get();
+    const Grid& grid = w.Grid();
+    mpi::Comm comm = grid.Comm();
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real relTol = ( ctrl.relTol > Real(0) ? ctrl.relTol : Sqrt(eps) );
+
+    const Int numWanted = Min( ctrl.numWanted, n );
+    const Int blockSize = Min( Max( ctrl.blockSize, Int(1) ), n );
+    const Int basisSize =
+      Min( Max( ctrl.basisSize, numWanted+3*blockSize ), n );
+    const bool wantLargest = ( ctrl.sort != ASCENDING );
+
+    DistMultiVec<Field> V(grid), W(grid), V1(grid);
+    Matrix<Field> T, H, H2, R, R2, Y;
+    Matrix<Real> theta;
+    Zeros( V, n, basisSize );
+    Zeros( T, basisSize, basisSize );
+    auto& VLoc = V.Matrix();
+
+    // Orthonormalize a multivector via (twice-iterated) Cholesky QR,
+    // overwriting RFact with the triangular factor. Since every block has
+    // already been orthogonalized against the basis, the Gram matrix is
+    // well-conditioned whenever the iteration has not broken down.
+    auto cholQR = [&]( DistMultiVec<Field>& X, Matrix<Field>& RFact )
+    {
+        const Int width = X.Width();
+        Matrix<Field> G;
+        for( Int pass=0; pass<2; ++pass )
+        {
+            Zeros( G, width, width );
+            Gemm
+            ( ADJOINT, NORMAL, Field(1), X.Matrix(), X.Matrix(), Field(0),
+              G );
+            mpi::AllReduce( G.Buffer(), int(width*width), mpi::SUM, comm );
+            Cholesky( UPPER, G );
+            MakeTrapezoidal( UPPER, G );
+            Trsm
+            ( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), G, X.Matrix() );
+            if( pass == 0 )
+                RFact = G;
+            else
+                Trmm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), G, RFact );
+        }
+    };
+
+    // Start from a random orthonormal block
+    Gaussian( W, n, blockSize );
+    cholQR( W, R );
+    Zeros( R, blockSize, blockSize );
+
+    Int j = 0;
+    Int numConverged = 0;
+    for( Int restart=0; restart<=ctrl.maxRestarts; ++restart )
+    {
+        // Expand the basis until it is full
+        while( j+blockSize <= basisSize )
+        {
+            const Int b = blockSize;
+            auto V1Loc = VLoc( ALL, IR(j,j+b) );
+            V1Loc = W.Matrix();
+
+            // W := A V1, orthogonalized against the current basis
+            V1 = V( ALL, IR(j,j+b) );
+            applyA( V1, W );
+            auto V0Loc = VLoc( ALL, IR(0,j+b) );
+            const Real initNorm = FrobeniusNorm( W );
+            Zeros( H, j+b, b );
+            Gemm
+            ( ADJOINT, NORMAL, Field(1), V0Loc, W.Matrix(), Field(0), H );
+            mpi::AllReduce( H.Buffer(), int((j+b)*b), mpi::SUM, comm );
+            Gemm( NORMAL, NORMAL, Field(-1), V0Loc, H, Field(1), W.Matrix() );
+            if( FrobeniusNorm(W) < initNorm/Sqrt(Real(2)) )
+            {
+                Zeros( H2, j+b, b );
+                Gemm
+                ( ADJOINT, NORMAL, Field(1), V0Loc, W.Matrix(), Field(0),
+                  H2 );
+                mpi::AllReduce( H2.Buffer(), int((j+b)*b), mpi::SUM, comm );
+                Gemm
+                ( NORMAL, NORMAL, Field(-1), V0Loc, H2, Field(1),
+                  W.Matrix() );
+                H += H2;
+            }
+            auto T01 = T( IR(0,j+b), IR(j,j+b) );
+            T01 = H;
+
+            // Orthonormalize the residual block, replacing it with a random
+            // (orthogonalized) block if the Krylov space was numerically
+            // invariant
+            const Real beta = FrobeniusNorm( W );
+            if( beta <= eps*Max(initNorm,Real(1)) )
+            {
+                Gaussian( W, n, b );
+                Zeros( H2, j+b, b );
+                Gemm
+                ( ADJOINT, NORMAL, Field(1), V0Loc, W.Matrix(), Field(0),
+                  H2 );
+                mpi::AllReduce( H2.Buffer(), int((j+b)*b), mpi::SUM, comm );
+                Gemm
+                ( NORMAL, NORMAL, Field(-1), V0Loc, H2, Field(1),
+                  W.Matrix() );
+                cholQR( W, R );
+                Zeros( R, b, b );
+            }
+            else
+                cholQR( W, R );
+            j += b;
+        }
+
+        // Solve the (replicated) projected eigenproblem on the root and
+        // broadcast the result to protect against forward instability
+        Zeros( theta, j, 1 );
+        Zeros( Y, j, j );
+        if( grid.Rank() == 0 )
+        {
+            Matrix<Field> TSub;
+            TSub = T( IR(0,j), IR(0,j) );
+            HermitianEig( UPPER, TSub, theta, Y );
+        }
+        mpi::Broadcast( theta.Buffer(), int(j), 0, comm );
+        mpi::Broadcast( Y.Buffer(), int(j*j), 0, comm );
+
+        // The Ritz residual norms are || R Y(j-b:j,i) ||_2
+        Matrix<Field> S;
+        auto YBot = Y( IR(j-blockSize,j), ALL );
+        Zeros( S, blockSize, j );
+        Gemm( NORMAL, NORMAL, Field(1), R, YBot, Field(0), S );
+
+        const Real maxAbsEig = Max( Abs(theta(0)), Abs(theta(j-1)) );
+        numConverged = 0;
+        for( Int i=0; i<numWanted; ++i )
+        {
+            const Int sel = ( wantLargest ? j-1-i : i );
+            const Real resNorm = FrobeniusNorm( S( ALL, IR(sel) ) );
+            if( resNorm <= Max(relTol*Abs(theta(sel)),eps*maxAbsEig) )
+                ++numConverged;
+            else
+                break;
+        }
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output
+            ("RestartedLanczos: restart ",restart,", ",numConverged," of ",
+             numWanted," pairs converged");
+
+        if( numConverged >= numWanted || restart == ctrl.maxRestarts )
+        {
+            w.Resize( numWanted, 1 );
+            auto& wLoc = w.Matrix();
+            Matrix<Field> YSel;
+            Zeros( YSel, j, numWanted );
+            for( Int i=0; i<numWanted; ++i )
+            {
+                const Int sel = ( wantLargest ? j-1-i : i );
+                wLoc(i) = theta(sel);
+                auto ySel = YSel( ALL, IR(i) );
+                ySel = Y( ALL, IR(sel) );
+            }
+            auto V0Loc = VLoc( ALL, IR(0,j) );
+            Zeros( Q, n, numWanted );
+            Gemm
+            ( NORMAL, NORMAL, Field(1), V0Loc, YSel, Field(0), Q.Matrix() );
+            return numConverged;
+        }
+
+        // Thick restart: retain the most relevant Ritz vectors and reseed
+        // the recurrence with the (already orthonormal) residual block
+        const Int ell = Min( 2*numWanted, j-blockSize );
+        Matrix<Field> YKeep;
+        Zeros( YKeep, j, ell );
+        for( Int i=0; i<ell; ++i )
+        {
+            const Int sel = ( wantLargest ? j-1-i : i );
+            auto yKeep = YKeep( ALL, IR(i) );
+            yKeep = Y( ALL, IR(sel) );
+        }
+        auto V0Loc = VLoc( ALL, IR(0,j) );
+        Matrix<Field> VNewLoc;
+        Zeros( VNewLoc, VLoc.Height(), ell );
+        Gemm( NORMAL, NORMAL, Field(1), V0Loc, YKeep, Field(0), VNewLoc );
+        auto VKeepLoc = VLoc( ALL, IR(0,ell) );
+        VKeepLoc = VNewLoc;
+        Zero( T );
+        for( Int i=0; i<ell; ++i )
+        {
+            const Int sel = ( wantLargest ? j-1-i : i );
+            T(i,i) = theta(sel);
+        }
+        j = ell;
+    }
+    return numConverged;
+}
+
 } // namespace El
 
 #endif // ifndef EL_SPECTRAL_LANCZOS
@@ -15,16 +15,30 @@ namespace El {
 // ================
 struct BisectCtrl
 {
+    // When 'sequential' is false, each distributed bisection is computed with
+    // the fully distributed ParMETIS backend rather than gathering the graph
+    // onto the root of the current team; it defaults to the distributed
+    // backend whenever ParMETIS was compiled in (and is silently ignored
+    // when it was not)
     bool sequential;
     Int numDistSeps;
     Int numSeqSeps;
     Int cutoff;
     bool storeFactRecvInds;
+    // After sequential nested dissection, a pair of leaves is amalgamated into
+    // its parent separator (yielding a single larger dense front) whenever the
+    // merged front requires at most this multiple of the separate fronts'
+    // entries; values of at most one disable the relaxation
+    double amalgFillRatio;
 
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
-    { }
+      storeFactRecvInds(false), amalgFillRatio(1.2)
+    {
+#ifdef EL_HAVE_PARMETIS
+        sequential = false;
+#endif
+    }
 };
 
 Int Bisect
@@ -31,6 +31,16 @@
 # define C_PROTO_COMPLEX_DOUBLE C_PROTO_COMPLEX(z,d,Complex<double>)
 #endif
 
+/* Fold the configuration-level instantiation profiles into the per-file
+   suppression macros, as in El/macros/Instantiate.h */
+#if defined(EL_DISABLE_FLOAT) && !defined(EL_NO_FLOAT_PROTO)
+# define EL_NO_FLOAT_PROTO
+#endif
+#if (defined(EL_DISABLE_FLOAT) || defined(EL_DISABLE_COMPLEX_FLOAT)) && \
+    !defined(EL_NO_COMPLEX_FLOAT_PROTO)
+# define EL_NO_COMPLEX_FLOAT_PROTO
+#endif
+
 #ifndef EL_NO_INT_PROTO
 C_PROTO_INT(i,Int)
 #endif
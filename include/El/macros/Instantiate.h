@@ -50,6 +50,18 @@
 #endif
 #endif
 
+#ifdef EL_ENABLE_HALF
+#ifndef PROTO_HALF
+# define PROTO_HALF PROTO_REAL(Half)
+#endif
+#endif
+
+#ifdef EL_ENABLE_BFLOAT
+#ifndef PROTO_BFLOAT
+# define PROTO_BFLOAT PROTO_REAL(BFloat)
+#endif
+#endif
+
 #ifndef PROTO_COMPLEX
 # define PROTO_COMPLEX(T) PROTO(T)
 #endif
@@ -84,6 +96,17 @@
 #endif
 #endif
 
+/* The configuration-level instantiation profiles are folded into the
+   per-file suppression macros so that every PROTO block (and its matching
+   EL_EXTERN declarations) observes them consistently */
+#if defined(EL_DISABLE_FLOAT) && !defined(EL_NO_FLOAT_PROTO)
+# define EL_NO_FLOAT_PROTO
+#endif
+#if (defined(EL_DISABLE_FLOAT) || defined(EL_DISABLE_COMPLEX_FLOAT)) && \
+    !defined(EL_NO_COMPLEX_FLOAT_PROTO)
+# define EL_NO_COMPLEX_FLOAT_PROTO
+#endif
+
 #ifndef EL_NO_INT_PROTO
 PROTO_INT(Int)
 #if defined(EL_ENABLE_BIGINT) && defined(EL_HAVE_MPC)
@@ -110,6 +133,12 @@ PROTO_QUAD
 #if defined(EL_ENABLE_BIGFLOAT) && defined(EL_HAVE_MPC)
 PROTO_BIGFLOAT
 #endif
+#ifdef EL_ENABLE_HALF
+PROTO_HALF
+#endif
+#ifdef EL_ENABLE_BFLOAT
+PROTO_BFLOAT
+#endif
 #endif
 
 #if !defined(EL_NO_COMPLEX_PROTO)
@@ -144,6 +173,8 @@ PROTO_COMPLEX_BIGFLOAT
 #undef PROTO_QUADDOUBLE
 #undef PROTO_QUAD
 #undef PROTO_BIGFLOAT
+#undef PROTO_HALF
+#undef PROTO_BFLOAT
 
 #undef PROTO_COMPLEX
 #undef PROTO_COMPLEX_FLOAT
@@ -158,6 +189,8 @@ PROTO_COMPLEX_BIGFLOAT
 #undef EL_ENABLE_QUAD
 #undef EL_ENABLE_BIGINT
 #undef EL_ENABLE_BIGFLOAT
+#undef EL_ENABLE_HALF
+#undef EL_ENABLE_BFLOAT
 
 #undef EL_NO_INT_PROTO
 #undef EL_NO_REAL_PROTO
@@ -609,6 +609,77 @@ void Whale( AbstractDistMatrix<Complex<Real>>& A, Int n );
 template<typename Real>
 void NTRUAttack( Matrix<Real>& A, const Matrix<Real>& h, Real alpha, Real q );
 
+// Matrix-free operators
+// #####################
+// Several of the structured matrices above are only ever applied to
+// vectors, in which case their dense representation wastes O(n^2) storage
+// and application cost. A MatrixFreeOperator wraps Apply and AdjointApply
+// routines so that such operators can be fed to the functor-based Krylov
+// drivers (Lanczos, ProductLanczos, and the *LanczosDecomp routines); the
+// factories below apply the Fourier, circulant, and Toeplitz matrices in
+// O(n log n) operations via the FFT.
+
+template<typename T>
+class MatrixFreeOperator
+{
+public:
+    typedef function<void(const Matrix<T>&,Matrix<T>&)> ApplyFunction;
+
+    MatrixFreeOperator();
+    MatrixFreeOperator
+    ( Int height, Int width,
+      ApplyFunction apply,
+      ApplyFunction adjointApply );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+
+    // Y := A X
+    void Apply( const Matrix<T>& X, Matrix<T>& Y ) const;
+    // Y := A^H X
+    void AdjointApply( const Matrix<T>& X, Matrix<T>& Y ) const;
+
+    // Match the functor signature of the Krylov drivers
+    void operator()( const Matrix<T>& X, Matrix<T>& Y ) const;
+
+private:
+    Int height_, width_;
+    ApplyFunction apply_, adjointApply_;
+};
+
+// The unitary DFT of order n (see Fourier above)
+template<typename Real>
+MatrixFreeOperator<Complex<Real>> FourierOperator( Int n );
+
+// The circulant matrix whose first column is 'a' (see Circulant above)
+template<typename Real>
+MatrixFreeOperator<Complex<Real>>
+CirculantOperator( const vector<Complex<Real>>& a );
+
+// The m x n Toeplitz matrix with A(i,j) = a[i-j+(n-1)] (see Toeplitz
+// above), applied through a power-of-two circulant embedding
+template<typename Real>
+MatrixFreeOperator<Complex<Real>>
+ToeplitzOperator( Int m, Int n, const vector<Complex<Real>>& a );
+
+// The m x n Hankel matrix with A(i,j) = a[i+j] (see Hankel above)
+template<typename Real>
+MatrixFreeOperator<Complex<Real>>
+HankelOperator( Int m, Int n, const vector<Complex<Real>>& a );
+
+// Wrap a densely stored banded matrix (e.g., the band form left behind by
+// a two-stage condensed reduction) so that the Krylov drivers apply it
+// through BandedGemm, skipping the known zeros outside the band
+template<typename T>
+MatrixFreeOperator<T>
+BandedOperator( Int lowerBandwidth, Int upperBandwidth, Matrix<T> A );
+
+// The Hessenberg special case (a single subdiagonal for UPPER, a single
+// superdiagonal for LOWER)
+template<typename T>
+MatrixFreeOperator<T>
+HessenbergOperator( UpperOrLower uplo, Matrix<T> H );
+
 // Random
 // ######
 
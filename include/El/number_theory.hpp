@@ -258,6 +258,63 @@ BigInt PollardRho
 
 } // namespace dlog
 
+// Montgomery-form modular arithmetic
+// ==================================
+// For hot loops over a fixed odd modulus n: the operands are converted
+// into the Montgomery representation once, repeatedly multiplied there
+// (each reduction costing two low multiplications and a shift rather than
+// a division), and converted back once at the end. A domain instance owns
+// its scratch space and is therefore not safe for concurrent use.
+class MontgomeryDomain
+{
+public:
+    explicit MontgomeryDomain( const BigInt& n );
+
+    const BigInt& Modulus() const;
+    // The Montgomery representation of one, R (mod n)
+    const BigInt& One() const;
+
+    // aMont := a R (mod n)
+    void Enter( const BigInt& a, BigInt& aMont );
+    BigInt Enter( const BigInt& a );
+    // a := aMont R^-1 (mod n)
+    void Exit( const BigInt& aMont, BigInt& a );
+    BigInt Exit( const BigInt& aMont );
+    // Convert a batch of residues in place
+    void Enter( vector<BigInt>& a );
+    void Exit( vector<BigInt>& a );
+
+    // cMont := aMont bMont R^-1 (mod n)
+    void Multiply( const BigInt& aMont, const BigInt& bMont, BigInt& cMont );
+    void Square( const BigInt& aMont, BigInt& cMont );
+
+    // result := aMont^exp, with base and result in Montgomery form, using
+    // fixed windows of a width chosen from the exponent length
+    void Power( const BigInt& aMont, const BigInt& exp, BigInt& result );
+
+    static unsigned WindowWidth( unsigned long expBits );
+
+private:
+    BigInt n_, nPrime_, rSquared_, oneMont_;
+    unsigned long numBits_; // R = 2^numBits_
+    BigInt t_, m_; // scratch space
+
+    void Reduce( BigInt& t, BigInt& result );
+};
+
+// result := prod_i bases[i]^exps[i] (mod n), sharing one squaring chain
+// across all of the bases and converting into and out of Montgomery space
+// exactly once
+void MultiPowMod
+( const vector<BigInt>& bases,
+  const vector<BigInt>& exps,
+  const BigInt& n,
+        BigInt& result );
+BigInt MultiPowMod
+( const vector<BigInt>& bases,
+  const vector<BigInt>& exps,
+  const BigInt& n );
+
 #endif // ifdef EL_HAVE_MPC
 
 } // namespace El
@@ -265,6 +322,7 @@ BigInt PollardRho
 #include <El/number_theory/DynamicSieve.hpp>
 #include <El/number_theory/TrialDivision.hpp>
 
+#include <El/number_theory/Montgomery.hpp>
 #include <El/number_theory/PowerDecomp.hpp>
 #include <El/number_theory/SqrtModPrime.hpp>
 #include <El/number_theory/LegendreSymbol.hpp>
@@ -0,0 +1,283 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NUMBER_THEORY_MONTGOMERY_HPP
+#define EL_NUMBER_THEORY_MONTGOMERY_HPP
+
+namespace El {
+
+#ifdef EL_HAVE_MPC
+
+// See Section 14.3.2 of the "Handbook of Applied Cryptography" for a
+// discussion of Montgomery reduction and Section 14.6.1 for windowed
+// exponentiation.
+//
+// Each REDC replaces the division of a generic modular multiplication with
+// two low multiplications and a shift, so loops which repeatedly multiply
+// modulo a fixed odd n should convert their operands into the Montgomery
+// representation once, work there, and convert back once at the end.
+
+inline MontgomeryDomain::MontgomeryDomain( const BigInt& n )
+: n_(n)
+{
+    EL_DEBUG_ONLY(
+      if( n <= BigIntOne() )
+          LogicError("Montgomery reduction requires a modulus greater than 1");
+      if( Mod(n,BigIntTwo()) == BigIntZero() )
+          LogicError("Montgomery reduction requires an odd modulus");
+    )
+
+    // R = 2^numBits_, with the exponent rounded up to a whole number of
+    // limbs so that the masks and shifts below are limb-aligned
+    const unsigned long nBits = mpz_sizeinbase( n_.LockedPointer(), 2 );
+    numBits_ = ((nBits+GMP_NUMB_BITS-1)/GMP_NUMB_BITS)*GMP_NUMB_BITS;
+
+    BigInt R;
+    mpz_set_ui( R.Pointer(), 1UL );
+    mpz_mul_2exp( R.Pointer(), R.Pointer(), numBits_ );
+
+    // nPrime_ = -n^-1 (mod R)
+    BigInt nInv;
+    mpz_invert( nInv.Pointer(), n_.LockedPointer(), R.LockedPointer() );
+    nPrime_ = R;
+    nPrime_ -= nInv;
+
+    // rSquared_ = R^2 (mod n), which Enter multiplies by before reducing
+    rSquared_ = Mod( R, n_ );
+    rSquared_ *= rSquared_;
+    rSquared_ = Mod( rSquared_, n_ );
+
+    // The representation of one is R (mod n)
+    oneMont_ = Mod( R, n_ );
+}
+
+inline const BigInt& MontgomeryDomain::Modulus() const
+{ return n_; }
+
+inline const BigInt& MontgomeryDomain::One() const
+{ return oneMont_; }
+
+// result := t R^-1 (mod n), overwriting the scratch variable t
+inline void MontgomeryDomain::Reduce( BigInt& t, BigInt& result )
+{
+    // m := (t mod R) nPrime (mod R)
+    mpz_fdiv_r_2exp( m_.Pointer(), t.LockedPointer(), numBits_ );
+    mpz_mul( m_.Pointer(), m_.LockedPointer(), nPrime_.LockedPointer() );
+    mpz_fdiv_r_2exp( m_.Pointer(), m_.LockedPointer(), numBits_ );
+
+    // result := (t + m n) / R
+    mpz_addmul( t.Pointer(), m_.LockedPointer(), n_.LockedPointer() );
+    mpz_fdiv_q_2exp( result.Pointer(), t.LockedPointer(), numBits_ );
+    if( result >= n_ )
+        result -= n_;
+}
+
+inline void MontgomeryDomain::Enter( const BigInt& a, BigInt& aMont )
+{
+    // aMont := REDC( (a mod n) R^2 ) = a R (mod n)
+    t_ = Mod( a, n_ );
+    t_ *= rSquared_;
+    Reduce( t_, aMont );
+}
+
+inline BigInt MontgomeryDomain::Enter( const BigInt& a )
+{
+    BigInt aMont;
+    Enter( a, aMont );
+    return aMont;
+}
+
+inline void MontgomeryDomain::Exit( const BigInt& aMont, BigInt& a )
+{
+    // a := REDC( aMont ) = aMont R^-1 (mod n)
+    t_ = aMont;
+    Reduce( t_, a );
+}
+
+inline BigInt MontgomeryDomain::Exit( const BigInt& aMont )
+{
+    BigInt a;
+    Exit( aMont, a );
+    return a;
+}
+
+inline void MontgomeryDomain::Enter( vector<BigInt>& a )
+{
+    for( auto& alpha : a )
+        Enter( alpha, alpha );
+}
+
+inline void MontgomeryDomain::Exit( vector<BigInt>& a )
+{
+    for( auto& alpha : a )
+        Exit( alpha, alpha );
+}
+
+inline void MontgomeryDomain::Multiply
+( const BigInt& aMont, const BigInt& bMont, BigInt& cMont )
+{
+    mpz_mul
+    ( t_.Pointer(), aMont.LockedPointer(), bMont.LockedPointer() );
+    Reduce( t_, cMont );
+}
+
+inline void MontgomeryDomain::Square( const BigInt& aMont, BigInt& cMont )
+{
+    mpz_mul( t_.Pointer(), aMont.LockedPointer(), aMont.LockedPointer() );
+    Reduce( t_, cMont );
+}
+
+// Choose the window width from the exponent length so that the table
+// build is amortized (the usual fixed-window size thresholds)
+inline unsigned MontgomeryDomain::WindowWidth( unsigned long expBits )
+{
+    if( expBits < 8 )
+        return 1;
+    else if( expBits < 24 )
+        return 2;
+    else if( expBits < 80 )
+        return 3;
+    else if( expBits < 240 )
+        return 4;
+    else if( expBits < 672 )
+        return 5;
+    else
+        return 6;
+}
+
+inline void MontgomeryDomain::Power
+( const BigInt& aMont, const BigInt& exp, BigInt& result )
+{
+    EL_DEBUG_ONLY(
+      if( exp < BigIntZero() )
+          LogicError("Negative exponents require an explicit inversion");
+    )
+    if( exp == BigIntZero() )
+    {
+        result = oneMont_;
+        return;
+    }
+    const unsigned long expBits =
+      mpz_sizeinbase( exp.LockedPointer(), 2 );
+    const unsigned w = WindowWidth( expBits );
+
+    // table[d] = aMont^d for d = 0, ..., 2^w - 1
+    vector<BigInt> table( 1u<<w );
+    table[0] = oneMont_;
+    table[1] = aMont;
+    for( unsigned d=2; d<(1u<<w); ++d )
+        Multiply( table[d-1], aMont, table[d] );
+
+    // Consume the exponent from its most significant bit downward in
+    // radix-2^w digits (the first digit may be short)
+    BigInt acc( oneMont_ );
+    long bit = long(expBits) - 1;
+    while( bit >= 0 )
+    {
+        unsigned digit = 0;
+        const unsigned width = unsigned(Min( long(w), bit+1 ));
+        for( unsigned i=0; i<width; ++i )
+        {
+            Square( acc, acc );
+            digit = (digit<<1) |
+              unsigned(mpz_tstbit( exp.LockedPointer(), bit-long(i) ));
+        }
+        if( digit != 0 )
+            Multiply( acc, table[digit], acc );
+        bit -= long(width);
+    }
+    result = acc;
+}
+
+// result := prod_i bases[i]^exps[i] (mod n), with the conversions into and
+// out of Montgomery space performed once and the squaring chain shared
+// across all of the bases (Shamir's trick with fixed windows)
+inline void MultiPowMod
+( const vector<BigInt>& bases,
+  const vector<BigInt>& exps,
+  const BigInt& n,
+        BigInt& result )
+{
+    const Int numBases = bases.size();
+    if( numBases != Int(exps.size()) )
+        LogicError("Each base requires an exponent");
+    MontgomeryDomain domain( n );
+    if( numBases == 0 )
+    {
+        domain.Exit( domain.One(), result );
+        return;
+    }
+
+    unsigned long maxExpBits = 0;
+    for( const auto& exp : exps )
+    {
+        EL_DEBUG_ONLY(
+          if( exp < BigIntZero() )
+              LogicError("Negative exponents require an explicit inversion");
+        )
+        if( exp != BigIntZero() )
+            maxExpBits =
+              Max( maxExpBits,
+                   (unsigned long)mpz_sizeinbase( exp.LockedPointer(), 2 ) );
+    }
+    if( maxExpBits == 0 )
+    {
+        domain.Exit( domain.One(), result );
+        return;
+    }
+    const unsigned w = domain.WindowWidth( maxExpBits );
+
+    // One fixed-window table per base
+    vector<vector<BigInt>> tables( numBases );
+    for( Int j=0; j<numBases; ++j )
+    {
+        auto& table = tables[j];
+        table.resize( 1u<<w );
+        table[0] = domain.One();
+        domain.Enter( bases[j], table[1] );
+        for( unsigned d=2; d<(1u<<w); ++d )
+            domain.Multiply( table[d-1], table[1], table[d] );
+    }
+
+    BigInt acc( domain.One() );
+    long bit = long(maxExpBits) - 1;
+    while( bit >= 0 )
+    {
+        const unsigned width = unsigned(Min( long(w), bit+1 ));
+        for( unsigned i=0; i<width; ++i )
+            domain.Square( acc, acc );
+        for( Int j=0; j<numBases; ++j )
+        {
+            unsigned digit = 0;
+            for( unsigned i=0; i<width; ++i )
+                digit = (digit<<1) |
+                  unsigned
+                  (mpz_tstbit( exps[j].LockedPointer(), bit-long(i) ));
+            if( digit != 0 )
+                domain.Multiply( acc, tables[j][digit], acc );
+        }
+        bit -= long(width);
+    }
+    domain.Exit( acc, result );
+}
+
+inline BigInt MultiPowMod
+( const vector<BigInt>& bases,
+  const vector<BigInt>& exps,
+  const BigInt& n )
+{
+    BigInt result;
+    MultiPowMod( bases, exps, n, result );
+    return result;
+}
+
+#endif // ifdef EL_HAVE_MPC
+
+} // namespace El
+
+#endif // ifndef EL_NUMBER_THEORY_MONTGOMERY_HPP
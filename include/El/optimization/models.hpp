@@ -35,6 +35,11 @@ struct ADMMCtrl {
   bool usePinv=false;
   Real pinvTol=0;
   bool progress=true;
+  // Hide the latency of the distributed convergence test by combining its
+  // norms with a single non-blocking allreduce which is completed after the
+  // next projection; the test then lags the iterates by one iteration.
+  // Ignored without MPI support for non-blocking collectives.
+  bool pipelineConvergence=false;
 };
 
 } // namespace bp
@@ -387,6 +392,9 @@ struct ADMMCtrl {
   Real relTol=Real(1e-4);
   bool inv=true;
   bool progress=true;
+  // As in bp::ADMMCtrl: test convergence one iteration late via a
+  // non-blocking reduction overlapped with the next subproblem solve.
+  bool pipelineConvergence=false;
 };
 
 } // namespace bpdn
@@ -428,6 +436,27 @@ void BPDN
         DistMultiVec<Real>& x,
   const BPDNCtrl<Real>& ctrl=BPDNCtrl<Real>() );
 
+// Solve along an entire regularization path via ADMM, whose x-update matrix
+// does not depend upon lambda: its factorization is computed once and shared
+// by every solve, and each solve is warm-started from the solution for the
+// previous value of lambda (so the path is best traversed from the largest
+// value of lambda to the smallest). The solutions are returned as the
+// columns of X, ordered as in 'lambdas'.
+template<typename Real>
+void BPDNPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const vector<Real>& lambdas,
+        Matrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl=bpdn::ADMMCtrl<Real>() );
+template<typename Real>
+void BPDNPath
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+  const vector<Real>& lambdas,
+        AbstractDistMatrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl=bpdn::ADMMCtrl<Real>() );
+
 // Elastic net (EN):
 //   min || b - A x ||_2^2 + lambda_1 || x ||_1 + lambda_2 || x ||_2^2
 // ===================================================================
@@ -176,6 +176,17 @@ template<typename Field>
 void SoftThreshold
 ( AbstractDistMatrix<Field>& A, const Base<Field>& rho, bool relative=false );
 
+// Apply the soft-threshold and return || A ||_F of the result, with the
+// norm accumulation fused into the same pass over the data. This is
+// primarily of use to ADMM loops, whose proximal updates are memory-bound
+// and immediately followed by norm computations for the convergence tests.
+template<typename Field>
+Base<Field> SoftThresholdNorm
+( Matrix<Field>& A, const Base<Field>& rho, bool relative=false );
+template<typename Field>
+Base<Field> SoftThresholdNorm
+( AbstractDistMatrix<Field>& A, const Base<Field>& rho, bool relative=false );
+
 } // namespace El
 
 #endif // ifndef EL_OPTIMIZATION_PROX_HPP
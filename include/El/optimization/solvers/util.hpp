@@ -43,8 +43,13 @@ struct MehrotraCtrl
     // 'affine' cone constraints, i.e., (h - G x) in K, the primal variables are
     // 'x' and 's', while the dual variables are again 'y' and 'z'.
     //
-    // NOTE: User initialization has not yet been tested, so there might be a
-    //       trivial bug.
+    // Supplying the full primal and dual iterate from a previous solve (and
+    // setting both flags) warm-starts the Interior Point Method: the
+    // initialization solves are skipped and the provided pair is pushed
+    // slightly into the interior of the cone, which typically cuts the
+    // iteration count substantially when re-solving after a small
+    // perturbation of the problem data. If only one of the two is supplied,
+    // it must already be strictly interior.
     bool primalInit=false, dualInit=false;
 
     // Throw an exception if this tolerance could not be achieved.
@@ -73,9 +78,16 @@ struct MehrotraCtrl
     KKTSystem system=FULL_KKT;
 
     // Use Mehrotra's second-order corrector?
-    // TODO(poulson): Add support for Gondzio's correctors
     bool mehrotra=true;
 
+    // The maximum number of Gondzio-style centrality corrections to attempt
+    // after each predictor-corrector step. Each correction reuses the
+    // existing KKT factorization, and so only costs a single additional
+    // solve; the corrections are abandoned as soon as one fails to
+    // sufficiently lengthen the attainable step. Currently honored by the
+    // affine LP solvers.
+    Int maxGondzioCorrections=0;
+
     // For determining the ratio of the amount to balance the affine and 
     // correction updates. The other common option is 'MehrotraCentrality'.
     function<Real(Real,Real,Real,Real)>
@@ -101,6 +113,55 @@ struct MehrotraCtrl
     // both the cost and number of iterations.
     bool resolveReg=true;
 
+    // If positive, the numeric KKT factorization (and its equilibration) is
+    // carried over from the previous iteration whenever the relative change
+    // in the dynamic cone diagonal of the KKT system is at most this
+    // tolerance, with the stale factorization serving as the preconditioner
+    // for the iterative refinement. A fresh factorization is automatically
+    // fallen back upon if the refinement fails to converge.
+    Real factRefreshTol=Real(0);
+
+    // The number of KKT factorizations retained in a least-recently-used
+    // cache which is searched (with the relative tolerance 'factRefreshTol')
+    // before each fresh factorization, so that re-entering a previously
+    // visited region of the central path -- e.g., across the closely related
+    // subproblems of a branch-and-bound wrapper -- reuses a retained
+    // factorization rather than computing a new one. Values of at most one
+    // retain the existing behavior of only recycling the most recent
+    // factorization, and the cache is disabled whenever 'mixedPrecision' is
+    // in effect. Each retained factorization stores a full copy of the
+    // numeric frontal tree, so this should be kept modest. Currently honored
+    // by the sparse-direct affine LP solvers.
+    Int factCacheSize=1;
+
+    // Perform the numeric KKT factorizations in the next-lowest available
+    // precision and recover the working-precision accuracy through the
+    // iterative-refinement loop of the regularized solves. The first time a
+    // demoted factorization either fails or leaves the refinement stalled,
+    // the solver permanently falls back to full-precision factorizations.
+    // This is mainly of interest for well-equilibrated double-precision
+    // problems, whose factorizations are roughly twice as fast in single
+    // precision. Currently honored by the sparse-direct affine LP solvers;
+    // the option has no effect when no lower precision is available.
+    bool mixedPrecision=false;
+
+    // If nonempty, snapshot the current iterate, (x;y;z;s), to
+    // '<checkpointBasename>.bin' every 'checkpointFreq' iterations via an
+    // asynchronous CheckpointWriter, so that a long run which is killed
+    // partway through can be resumed from its last snapshot rather than
+    // from zero. The snapshot is taken in the equilibrated coordinates, and
+    // so a resumed run must be handed the same problem data and
+    // equilibration settings. Currently honored by the distributed affine
+    // LP solvers.
+    string checkpointBasename="";
+    Int checkpointFreq=10;
+
+    // Reload the iterate from the snapshot named by 'checkpointBasename'
+    // before the first iteration and enter the warm-start path, as though
+    // the restored pair had been supplied with 'primalInit' and 'dualInit'
+    // set. A missing or truncated snapshot results in a RuntimeError.
+    bool resume=false;
+
     // Wrap the Interior Point Method with an equilibration.
     // This should almost always be set to true.
     bool outerEquil=true;
@@ -174,6 +235,16 @@ struct ADMMCtrl
     Real relTol=Real(1e-4);
     bool inv=true;
     bool print=true;
+    // Overlap the convergence-test reductions of the distributed solvers
+    // with the following iteration's subproblem: the local contributions to
+    // the residual norms are combined with a single non-blocking allreduce
+    // which is only completed after the next solve, so that the test is
+    // applied to residuals which are one iteration stale. Convergence is
+    // thus detected (at most) one iteration late in exchange for hiding the
+    // latency of several blocking reductions per iteration, which is mainly
+    // of interest on large or heterogeneous machines. The option is ignored
+    // if the MPI implementation does not provide non-blocking collectives.
+    bool pipelineConvergence=false;
 };
 
 } // namespace El
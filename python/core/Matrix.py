@@ -429,6 +429,35 @@ class Matrix(object):
     if   self.tag == cTag: lib.ElMatrixConjugate_c(self.obj,i,j)
     elif self.tag == zTag: lib.ElMatrixConjugate_z(self.obj,i,j)
 
+  # Wrap an existing NumPy array without copying
+  # --------------------------------------------
+  # The array must be column-major (Fortran-ordered), as that is the only
+  # layout expressible through ElMatrixAttach. A reference to the array is
+  # stored on the Matrix so that the underlying buffer outlives the wrapper.
+  def AttachNumPy(self,A,locked=False):
+    if A.ndim == 1:
+      if A.shape[0] > 1 and A.strides[0] != A.itemsize:
+        raise Exception('Expected a contiguous one-dimensional array')
+      A = A.reshape(A.shape[0],1)
+    if A.ndim != 2:
+      raise Exception('Expected a one- or two-dimensional NumPy array')
+    tag = NumpyTypeToTag(A.dtype)
+    if tag != self.tag:
+      self.SetType(tag)
+    m, n = A.shape
+    entrySize = TagToSize(tag)
+    if m > 1 and A.strides[0] != entrySize:
+      raise Exception('Expected a column-major (Fortran-ordered) array')
+    if n > 1:
+      if A.strides[1] % entrySize != 0 or A.strides[1] < m*entrySize:
+        raise Exception('Expected a column-major (Fortran-ordered) array')
+      ldim = A.strides[1] // entrySize
+    else:
+      ldim = max(m,1)
+    buf = A.ctypes.data_as(POINTER(TagToType(tag)))
+    self.Attach(m,n,buf,ldim,locked)
+    self._numpyOwner = A
+
   def ToNumPy(self):
     m = self.Height()
     n = self.Width()
@@ -484,3 +513,10 @@ class Matrix(object):
       elif self.tag == zTag: lib.ElView_z(*args)
       else: DataExcept()
     return ASub
+
+# Construct a Matrix over the buffer of an existing NumPy array
+# -------------------------------------------------------------
+def FromNumPy(A,locked=False):
+  AMat = Matrix(NumpyTypeToTag(A.dtype))
+  AMat.AttachNumPy(A,locked)
+  return AMat
@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like.hpp>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <unistd.h>
+
+namespace {
+using namespace El;
+
+std::atomic<bool> algorithmLearningEnabled( false );
+std::mutex algorithmHistoryMutex;
+// key -> (variant -> best measured seconds)
+std::map<std::string,std::map<Int,double>> algorithmHistory;
+std::string algorithmCacheFile;
+
+std::string DefaultAlgorithmCacheFile()
+{
+    char host[256];
+    if( gethostname( host, sizeof(host) ) != 0 )
+        host[0] = '\0';
+    host[sizeof(host)-1] = '\0';
+    return std::string("ElAlgorithms.") + host;
+}
+
+Int BucketDim( Int n )
+{
+    Int bucket = 1;
+    while( bucket < n )
+        bucket <<= 1;
+    return bucket;
+}
+
+}
+
+namespace El {
+
+void EnableAlgorithmLearning()
+{ ::algorithmLearningEnabled.store( true, std::memory_order_relaxed ); }
+
+void DisableAlgorithmLearning()
+{ ::algorithmLearningEnabled.store( false, std::memory_order_relaxed ); }
+
+bool AlgorithmLearningEnabled()
+{ return ::algorithmLearningEnabled.load( std::memory_order_relaxed ); }
+
+string AlgorithmLearningKey
+( const string& op, const string& type,
+  Int gridHeight, Int gridWidth,
+  Int m, Int n, Int k )
+{
+    ostringstream os;
+    os << op << "/" << type << "/" << gridHeight << "x" << gridWidth
+       << "/" << ::BucketDim(m) << "x" << ::BucketDim(n)
+       << "x" << ::BucketDim(k);
+    return os.str();
+}
+
+Int SelectAlgorithm
+( const string& key, const vector<Int>& candidates, bool& explore )
+{
+    if( candidates.empty() )
+        LogicError("No candidate algorithms were provided");
+    std::lock_guard<std::mutex> lock( ::algorithmHistoryMutex );
+    const auto& record = ::algorithmHistory[key];
+    Int best = candidates.front();
+    double bestTime = limits::Max<double>();
+    for( const Int candidate : candidates )
+    {
+        auto it = record.find( candidate );
+        if( it == record.end() )
+        {
+            // A novel shape, or a variant not yet tried on this one
+            explore = true;
+            return candidate;
+        }
+        if( it->second < bestTime )
+        {
+            bestTime = it->second;
+            best = candidate;
+        }
+    }
+    explore = false;
+    return best;
+}
+
+void RecordAlgorithmTime( const string& key, Int algorithm, double seconds )
+{
+    std::lock_guard<std::mutex> lock( ::algorithmHistoryMutex );
+    auto& record = ::algorithmHistory[key];
+    auto it = record.find( algorithm );
+    if( it == record.end() || seconds < it->second )
+        record[algorithm] = seconds;
+}
+
+void SetAlgorithmCacheFile( const string& filename )
+{ ::algorithmCacheFile = filename; }
+
+string AlgorithmCacheFile()
+{
+    if( ::algorithmCacheFile.empty() )
+        ::algorithmCacheFile = ::DefaultAlgorithmCacheFile();
+    return ::algorithmCacheFile;
+}
+
+void SaveAlgorithmHistory()
+{
+    ofstream file( AlgorithmCacheFile().c_str() );
+    if( !file.is_open() )
+        RuntimeError
+        ("Could not open algorithm cache file ",AlgorithmCacheFile());
+    std::lock_guard<std::mutex> lock( ::algorithmHistoryMutex );
+    for( const auto& entry : ::algorithmHistory )
+        for( const auto& variant : entry.second )
+            file << entry.first << " " << variant.first << " "
+                 << variant.second << "\n";
+}
+
+void LoadAlgorithmHistory()
+{
+    ifstream file( AlgorithmCacheFile().c_str() );
+    if( !file.is_open() )
+        return;
+    string key;
+    Int algorithm;
+    double seconds;
+    std::lock_guard<std::mutex> lock( ::algorithmHistoryMutex );
+    while( file >> key >> algorithm >> seconds )
+    {
+        auto& record = ::algorithmHistory[key];
+        auto it = record.find( algorithm );
+        if( it == record.end() || seconds < it->second )
+            record[algorithm] = seconds;
+    }
+}
+
+} // namespace El
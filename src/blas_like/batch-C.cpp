@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <El.h>
+using namespace El;
+
+namespace {
+
+// Trsm does not exist for integral data, so constrain the forwarding
+// template on the element type (a base-class guard overload would lose the
+// overload resolution against the reflected concrete matrix types) and
+// route the integer instantiations to a runtime error
+template<typename T,typename MatrixType,
+         typename=DisableIf<IsSame<T,Int>>>
+void BatchTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  T alpha, const MatrixType& A, MatrixType& B )
+{ Trsm( side, uplo, orientation, diag, alpha, A, B ); }
+
+template<typename MatrixType>
+void BatchTrsm
+( LeftOrRight, UpperOrLower, Orientation, UnitOrNonUnit,
+  Int, const MatrixType&, MatrixType& )
+{ LogicError("Trsm is not supported for integral data"); }
+
+template<typename Entry>
+ElError BatchHelper( const Entry* entries, ElInt numEntries )
+{
+    try
+    {
+        for( ElInt k=0; k<numEntries; ++k )
+        {
+            const Entry& entry = entries[k];
+            switch( entry.op )
+            {
+            case EL_BATCH_ZERO:
+                Zero( *CReflect(entry.C) );
+                break;
+            case EL_BATCH_SCALE:
+                Scale( CReflect(entry.alpha), *CReflect(entry.C) );
+                break;
+            case EL_BATCH_COPY:
+                Copy( *CReflect(entry.A), *CReflect(entry.C) );
+                break;
+            case EL_BATCH_AXPY:
+                Axpy( CReflect(entry.alpha), *CReflect(entry.A),
+                      *CReflect(entry.C) );
+                break;
+            case EL_BATCH_GEMM:
+                Gemm( CReflect(entry.orientationOfA),
+                      CReflect(entry.orientationOfB),
+                      CReflect(entry.alpha), *CReflect(entry.A),
+                      *CReflect(entry.B),
+                      CReflect(entry.beta), *CReflect(entry.C) );
+                break;
+            case EL_BATCH_TRSM:
+                BatchTrsm( CReflect(entry.side), CReflect(entry.uplo),
+                           CReflect(entry.orientationOfA),
+                           CReflect(entry.diag),
+                           CReflect(entry.alpha), *CReflect(entry.A),
+                           *CReflect(entry.C) );
+                break;
+            default:
+                LogicError("Unsupported batch operation");
+            }
+        }
+    }
+    EL_CATCH
+    return EL_SUCCESS;
+}
+
+} // anonymous namespace
+
+extern "C" {
+
+#define C_PROTO(SIG,SIGBASE,T) \
+  ElError ElBatch_ ## SIG \
+  ( const ElBatchEntry_ ## SIG * entries, ElInt numEntries ) \
+  { return BatchHelper( entries, numEntries ); } \
+  ElError ElBatchDist_ ## SIG \
+  ( const ElBatchEntryDist_ ## SIG * entries, ElInt numEntries ) \
+  { return BatchHelper( entries, numEntries ); }
+
+#include <El/macros/CInstantiate.h>
+
+} // extern "C"
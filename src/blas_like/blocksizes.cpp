@@ -8,49 +8,73 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
+#include <El/calibration.h>
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <stack>
+#include <unistd.h>
 
 namespace {
 using namespace El;
 
-std::stack<Int> blocksizeStack;
+// Each thread owns its own blocksize stack (lazily seeded with the same
+// default as Initialize) so that concurrently running solves may be tuned
+// independently without mutating process-global state. The seed comes from
+// the generated El/calibration.h, which EL_CALIBRATE microbenchmarks on the
+// target machine at configure time.
+const Int defaultBlocksize = EL_DEFAULT_BLOCKSIZE;
+thread_local std::stack<Int> blocksizeStack;
+
+std::stack<Int>& BlocksizeStack()
+{
+    if( blocksizeStack.empty() )
+        blocksizeStack.push( defaultBlocksize );
+    return blocksizeStack;
+}
+
+std::atomic<bool> blocksizeTuningEnabled( false );
+thread_local bool calibratingBlocksize = false;
+std::mutex tunedBlocksizeMutex;
+std::map<std::string,Int> tunedBlocksizes;
+std::string blocksizeCacheFile;
+
+std::string DefaultBlocksizeCacheFile()
+{
+    char host[256];
+    if( gethostname( host, sizeof(host) ) != 0 )
+        host[0] = '\0';
+    host[sizeof(host)-1] = '\0';
+    return std::string("ElBlocksizes.") + host;
+}
 
 template<typename T>
-struct LocalSymvBlocksizeHelper { static Int value; };
+struct LocalSymvBlocksizeHelper { static thread_local Int value; };
 template<typename T>
-Int LocalSymvBlocksizeHelper<T>::value = 64;
+thread_local Int LocalSymvBlocksizeHelper<T>::value =
+  EL_LOCAL_SYMV_BLOCKSIZE;
 
 template<typename T>
-struct LocalTrrkBlocksizeHelper { static Int value; };
+struct LocalTrrkBlocksizeHelper { static thread_local Int value; };
 template<typename T>
-Int LocalTrrkBlocksizeHelper<T>::value = 64;
+thread_local Int LocalTrrkBlocksizeHelper<T>::value =
+  EL_LOCAL_TRRK_BLOCKSIZE;
 
 template<typename T>
-struct LocalTrr2kBlocksizeHelper { static Int value; };
+struct LocalTrr2kBlocksizeHelper { static thread_local Int value; };
 template<typename T>
-Int LocalTrr2kBlocksizeHelper<T>::value = 64;
+thread_local Int LocalTrr2kBlocksizeHelper<T>::value =
+  EL_LOCAL_TRR2K_BLOCKSIZE;
 
 }
 
 namespace El {
 
 Int Blocksize()
-{
-    EL_DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
-          LogicError("Attempted to extract blocksize from empty stack");
-    )
-    return ::blocksizeStack.top();
-}
+{ return ::BlocksizeStack().top(); }
 
 void SetBlocksize( Int blocksize )
-{
-    EL_DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
-          LogicError("Attempted to set blocksize at top of empty stack");
-    )
-    ::blocksizeStack.top() = blocksize;
-}
+{ ::BlocksizeStack().top() = blocksize; }
 
 void PushBlocksizeStack( Int blocksize )
 { ::blocksizeStack.push( blocksize ); }
@@ -70,6 +94,116 @@ void EmptyBlocksizeStack()
         ::blocksizeStack.pop();
 }
 
+void EnableBlocksizeTuning()
+{ ::blocksizeTuningEnabled.store( true, std::memory_order_relaxed ); }
+
+void DisableBlocksizeTuning()
+{ ::blocksizeTuningEnabled.store( false, std::memory_order_relaxed ); }
+
+bool BlocksizeTuningEnabled()
+{ return ::blocksizeTuningEnabled.load( std::memory_order_relaxed ); }
+
+bool CalibratingBlocksize()
+{ return ::calibratingBlocksize; }
+
+string BlocksizeTuningKey
+( const string& op, const string& type, Int gridHeight, Int gridWidth )
+{
+    ostringstream os;
+    os << op << "/" << type << "/" << gridHeight << "x" << gridWidth;
+    return os.str();
+}
+
+bool HaveTunedBlocksize( const string& key )
+{
+    std::lock_guard<std::mutex> lock( ::tunedBlocksizeMutex );
+    return ::tunedBlocksizes.count( key ) != 0;
+}
+
+Int TunedBlocksize( const string& key )
+{
+    {
+        std::lock_guard<std::mutex> lock( ::tunedBlocksizeMutex );
+        auto it = ::tunedBlocksizes.find( key );
+        if( it != ::tunedBlocksizes.end() )
+            return it->second;
+    }
+    return Blocksize();
+}
+
+void SetTunedBlocksize( const string& key, Int blocksize )
+{
+    std::lock_guard<std::mutex> lock( ::tunedBlocksizeMutex );
+    ::tunedBlocksizes[key] = blocksize;
+}
+
+Int CalibrateBlocksize
+( const string& key,
+  const function<void()>& kernel,
+  mpi::Comm comm,
+  const vector<Int>& candidates )
+{
+    if( candidates.empty() )
+        LogicError("No candidate blocksizes were provided");
+
+    ::calibratingBlocksize = true;
+    Int bestBlocksize = candidates.front();
+    double bestTime = limits::Max<double>();
+    Timer timer;
+    for( const Int candidate : candidates )
+    {
+        BlocksizeGuard guard( candidate );
+        mpi::Barrier( comm );
+        timer.Reset();
+        timer.Start();
+        kernel();
+        mpi::Barrier( comm );
+        const double candidateTime = timer.Stop();
+        if( candidateTime < bestTime )
+        {
+            bestTime = candidateTime;
+            bestBlocksize = candidate;
+        }
+    }
+    ::calibratingBlocksize = false;
+
+    SetTunedBlocksize( key, bestBlocksize );
+    return bestBlocksize;
+}
+
+void SetBlocksizeCacheFile( const string& filename )
+{ ::blocksizeCacheFile = filename; }
+
+string BlocksizeCacheFile()
+{
+    if( ::blocksizeCacheFile.empty() )
+        ::blocksizeCacheFile = ::DefaultBlocksizeCacheFile();
+    return ::blocksizeCacheFile;
+}
+
+void SaveTunedBlocksizes()
+{
+    ofstream file( BlocksizeCacheFile().c_str() );
+    if( !file.is_open() )
+        RuntimeError
+        ("Could not open blocksize cache file ",BlocksizeCacheFile());
+    std::lock_guard<std::mutex> lock( ::tunedBlocksizeMutex );
+    for( const auto& entry : ::tunedBlocksizes )
+        file << entry.first << " " << entry.second << "\n";
+}
+
+void LoadTunedBlocksizes()
+{
+    ifstream file( BlocksizeCacheFile().c_str() );
+    if( !file.is_open() )
+        return;
+    string key;
+    Int blocksize;
+    std::lock_guard<std::mutex> lock( ::tunedBlocksizeMutex );
+    while( file >> key >> blocksize )
+        ::tunedBlocksizes[key] = blocksize;
+}
+
 template<typename T>
 void SetLocalSymvBlocksize( Int blocksize )
 { LocalSymvBlocksizeHelper<T>::value = blocksize; }
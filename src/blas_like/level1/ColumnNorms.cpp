@@ -21,6 +21,42 @@ void ColumnTwoNormsHelper
     const Int mLocal = ALoc.Height();
     const Int nLocal = ALoc.Width();
 
+    if( ReproducibleReductionsEnabled() )
+    {
+        // Pre-rounding requires element-level addends, so the relative
+        // squares of each column are materialized rather than accumulated
+        Matrix<Real> localMaxes( nLocal, 1 ), scales( nLocal, 1 );
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        {
+            Real localMax = 0;
+            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+                localMax = Max( localMax, Abs(ALoc(iLoc,jLoc)) );
+            localMaxes(jLoc) = localMax;
+        }
+        mpi::AllReduce
+        ( localMaxes.Buffer(), scales.Buffer(), nLocal, mpi::MAX, comm );
+
+        Matrix<Real> terms( mLocal, nLocal );
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        {
+            const Real scale = scales(jLoc);
+            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            {
+                const Real relAbs =
+                  ( scale == Real(0) ? Real(0)
+                                     : Abs(ALoc(iLoc,jLoc))/scale );
+                terms(iLoc,jLoc) = relAbs*relAbs;
+            }
+        }
+        vector<Real> sums( nLocal );
+        ReproducibleAllReduceSums
+        ( mLocal, nLocal, terms.LockedBuffer(), terms.LDim(),
+          sums.data(), comm );
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+            normsLoc(jLoc) = scales(jLoc)*Sqrt(sums[jLoc]);
+        return;
+    }
+
     // TODO(poulson): Ensure that NaN's propagate
     Matrix<Real> localScales( nLocal, 1 ),
                  localScaledSquares( nLocal, 1 );
@@ -294,6 +330,223 @@ void ColumnMaxNorms
     }
 }
 
+// Fused kernels for repeated orthogonalization
+// ============================================
+
+template<typename Field>
+void ColumnTwoNormsAndNormalize
+( Matrix<Field>& X, Matrix<Base<Field>>& norms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = X.Height();
+    const Int n = X.Width();
+    norms.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        const Real norm = ( m==0 ? Real(0) : blas::Nrm2( m, &X(0,j), 1 ) );
+        norms(j) = norm;
+        // Rescale the column while it is still in cache
+        if( norm != Real(0) )
+            blas::Scal( m, Field(1)/norm, &X(0,j), 1 );
+    }
+}
+
+template<typename Field,Dist U,Dist V,DistWrap W>
+void ColumnTwoNormsAndNormalize
+( DistMatrix<Field,U,V,W>& X, DistMatrix<Base<Field>,V,STAR,W>& norms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    norms.AlignWith( X );
+    norms.Resize( X.Width(), 1 );
+    if( X.Height() == 0 )
+    {
+        Zero( norms );
+        return;
+    }
+    ColumnTwoNormsHelper( X.LockedMatrix(), norms.Matrix(), X.ColComm() );
+    // Rescale the local data by the (globally consistent) column norms
+    auto& XLoc = X.Matrix();
+    auto& normsLoc = norms.Matrix();
+    const Int mLocal = XLoc.Height();
+    const Int nLocal = XLoc.Width();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Real norm = normsLoc(jLoc);
+        if( norm != Real(0) )
+        {
+            const Field scale = Field(1)/norm;
+            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+                XLoc(iLoc,jLoc) *= scale;
+        }
+    }
+}
+
+template<typename Field>
+void AxpyColumnTwoNorms
+( Field alpha,
+  const Matrix<Field>& X,
+        Matrix<Field>& Y,
+        Matrix<Base<Field>>& norms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    EL_DEBUG_ONLY(
+      if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+          LogicError("X and Y must have the same dimensions");
+    )
+    const Int m = Y.Height();
+    const Int n = Y.Width();
+    norms.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        Real scale = 0;
+        Real scaledSquare = 1;
+        for( Int i=0; i<m; ++i )
+        {
+            Y(i,j) += alpha*X(i,j);
+            UpdateScaledSquare( Y(i,j), scale, scaledSquare );
+        }
+        norms(j) = scale*Sqrt(scaledSquare);
+    }
+}
+
+template<typename Field,Dist U,Dist V,DistWrap W>
+void AxpyColumnTwoNorms
+( Field alpha,
+  const DistMatrix<Field,U,V,W>& X,
+        DistMatrix<Field,U,V,W>& Y,
+        DistMatrix<Base<Field>,V,STAR,W>& norms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    EL_DEBUG_ONLY(
+      AssertSameGrids( X, Y );
+      if( X.ColAlign() != Y.ColAlign() || X.RowAlign() != Y.RowAlign() )
+          LogicError("X and Y must be aligned");
+    )
+    norms.AlignWith( Y );
+    norms.Resize( Y.Width(), 1 );
+    const auto& XLoc = X.LockedMatrix();
+    auto& YLoc = Y.Matrix();
+    const Int mLocal = YLoc.Height();
+    const Int nLocal = YLoc.Width();
+    Matrix<Real> localScales( nLocal, 1 ), localScaledSquares( nLocal, 1 );
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        Real localScale = 0;
+        Real localScaledSquare = 1;
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        {
+            YLoc(iLoc,jLoc) += alpha*XLoc(iLoc,jLoc);
+            UpdateScaledSquare
+            ( YLoc(iLoc,jLoc), localScale, localScaledSquare );
+        }
+        localScales(jLoc) = localScale;
+        localScaledSquares(jLoc) = localScaledSquare;
+    }
+    NormsFromScaledSquares
+    ( localScales, localScaledSquares, norms.Matrix(), Y.ColComm() );
+}
+
+template<typename Field>
+void ColumnTwoNormBatch<Field>::Queue
+( const DistMatrix<Field>& X, DistMatrix<Base<Field>,MR,STAR>& norms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    EL_DEBUG_ONLY(
+      if( !entries_.empty() && !mpi::Congruent( comm_, X.ColComm() ) )
+          LogicError("Queued matrices must share a column communicator");
+    )
+    comm_ = X.ColComm();
+    norms.AlignWith( X );
+    norms.Resize( X.Width(), 1 );
+
+    const auto& XLoc = X.LockedMatrix();
+    const Int mLocal = XLoc.Height();
+    const Int nLocal = XLoc.Width();
+    Entry entry;
+    entry.norms = &norms;
+    entry.localScales.Resize( nLocal, 1 );
+    entry.localScaledSquares.Resize( nLocal, 1 );
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        Real localScale = 0;
+        Real localScaledSquare = 1;
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            UpdateScaledSquare
+            ( XLoc(iLoc,jLoc), localScale, localScaledSquare );
+        entry.localScales(jLoc) = localScale;
+        entry.localScaledSquares(jLoc) = localScaledSquare;
+    }
+    entries_.push_back( std::move(entry) );
+}
+
+template<typename Field>
+void ColumnTwoNormBatch<Field>::Process()
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( entries_.empty() )
+        return;
+
+    Int totalSize = 0;
+    for( const auto& entry : entries_ )
+        totalSize += entry.localScales.Height();
+
+    // Find the maximum scales with a single reduction
+    vector<Real> localScales( totalSize ), scales( totalSize );
+    Int off = 0;
+    for( const auto& entry : entries_ )
+    {
+        const Int nLocal = entry.localScales.Height();
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+            localScales[off+jLoc] = entry.localScales(jLoc);
+        off += nLocal;
+    }
+    mpi::AllReduce
+    ( localScales.data(), scales.data(), totalSize, mpi::MAX, comm_ );
+
+    // Equilibrate the local scaled sums and combine them with a single
+    // reduction
+    vector<Real> localScaledSquares( totalSize ), scaledSquares( totalSize );
+    off = 0;
+    for( const auto& entry : entries_ )
+    {
+        const Int nLocal = entry.localScales.Height();
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        {
+            const Real scale = scales[off+jLoc];
+            if( scale != Real(0) )
+            {
+                const Real relScale = entry.localScales(jLoc)/scale;
+                localScaledSquares[off+jLoc] =
+                  entry.localScaledSquares(jLoc)*relScale*relScale;
+            }
+            else
+                localScaledSquares[off+jLoc] = 0;
+        }
+        off += nLocal;
+    }
+    mpi::AllReduce
+    ( localScaledSquares.data(), scaledSquares.data(), totalSize,
+      mpi::SUM, comm_ );
+
+    off = 0;
+    for( auto& entry : entries_ )
+    {
+        auto& normsLoc = entry.norms->Matrix();
+        const Int nLocal = entry.localScales.Height();
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+            normsLoc(jLoc) =
+              scales[off+jLoc]*Sqrt(scaledSquares[off+jLoc]);
+        off += nLocal;
+    }
+    entries_.clear();
+}
+
 // Versions which operate on explicitly-separated complex matrices
 // ===============================================================
 template<typename Real,typename>
@@ -368,11 +621,27 @@ void ColumnTwoNorms
   template void ColumnMaxNorms \
   ( const DistMatrix<Field,U,V,ELEMENT>& X, \
           DistMatrix<Base<Field>,V,STAR,ELEMENT>& norms ); \
+  template void ColumnTwoNormsAndNormalize \
+  ( DistMatrix<Field,U,V,ELEMENT>& X, \
+    DistMatrix<Base<Field>,V,STAR,ELEMENT>& norms ); \
+  template void AxpyColumnTwoNorms \
+  ( Field alpha, \
+    const DistMatrix<Field,U,V,ELEMENT>& X, \
+          DistMatrix<Field,U,V,ELEMENT>& Y, \
+          DistMatrix<Base<Field>,V,STAR,ELEMENT>& norms ); \
   template void ColumnTwoNorms \
   ( const DistMatrix<Field,U,V,BLOCK>& X, \
           DistMatrix<Base<Field>,V,STAR,BLOCK>& norms ); \
   template void ColumnMaxNorms \
   ( const DistMatrix<Field,U,V,BLOCK>& X, \
+          DistMatrix<Base<Field>,V,STAR,BLOCK>& norms ); \
+  template void ColumnTwoNormsAndNormalize \
+  ( DistMatrix<Field,U,V,BLOCK>& X, \
+    DistMatrix<Base<Field>,V,STAR,BLOCK>& norms ); \
+  template void AxpyColumnTwoNorms \
+  ( Field alpha, \
+    const DistMatrix<Field,U,V,BLOCK>& X, \
+          DistMatrix<Field,U,V,BLOCK>& Y, \
           DistMatrix<Base<Field>,V,STAR,BLOCK>& norms );
 
 #define PROTO(Field) \
@@ -382,6 +651,15 @@ void ColumnTwoNorms
   template void ColumnMaxNorms \
   ( const Matrix<Field>& X, \
           Matrix<Base<Field>>& norms ); \
+  template void ColumnTwoNormsAndNormalize \
+  ( Matrix<Field>& X, \
+    Matrix<Base<Field>>& norms ); \
+  template void AxpyColumnTwoNorms \
+  ( Field alpha, \
+    const Matrix<Field>& X, \
+          Matrix<Field>& Y, \
+          Matrix<Base<Field>>& norms ); \
+  template class ColumnTwoNormBatch<Field>; \
   template void ColumnTwoNorms \
   ( const SparseMatrix<Field>& A, \
           Matrix<Base<Field>>& norms ); \
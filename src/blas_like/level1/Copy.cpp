@@ -8,6 +8,9 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
+#include <El/blas_like/level1/Copy/PlanCache.hpp>
+
+#include <map>
 
 namespace El {
 
@@ -127,4 +130,33 @@ void CopyFromNonRoot( const DistGraph& distGraph, int root )
       (Int*)0, edgeSizes.data(), edgeOffsets.data(), root, grid.Comm() );
 }
 
+namespace copy {
+
+namespace {
+
+bool redistPlanCacheEnabled = false;
+// Per-thread storage avoids locking when multiple threads redistribute
+// over disjoint grids
+thread_local std::map<RedistPlanKey,RedistPlan> redistPlans;
+const size_t redistPlanCacheMaxSize = 256;
+
+} // anonymous namespace
+
+void EnableRedistPlanCache() { redistPlanCacheEnabled = true; }
+void DisableRedistPlanCache() { redistPlanCacheEnabled = false; }
+bool RedistPlanCacheEnabled() { return redistPlanCacheEnabled; }
+void FlushRedistPlanCache() { redistPlans.clear(); }
+
+RedistPlan* FetchRedistPlan( const RedistPlanKey& key )
+{
+    if( !redistPlanCacheEnabled )
+        return nullptr;
+    if( redistPlans.size() >= redistPlanCacheMaxSize &&
+        redistPlans.count(key) == 0 )
+        redistPlans.clear();
+    return &redistPlans[key];
+}
+
+} // namespace copy
+
 } // namespace El
@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+template<typename Ring>
+EntrywiseReductions<Base<Ring>> EntrywiseReduce( const Matrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Ring> Real;
+    EntrywiseReductions<Real> summary;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m == 0 || n == 0 )
+        return summary;
+
+    const Ring* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+
+    Real maxAbs = 0;
+    Real minAbs = limits::Max<Real>();
+    Real scale = 0;
+    Real scaledSquare = 1;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const Real absVal = Abs(ABuf[i+j*ALDim]);
+            maxAbs = Max( maxAbs, absVal );
+            minAbs = Min( minAbs, absVal );
+            UpdateScaledSquare( absVal, scale, scaledSquare );
+        }
+    }
+    summary.maxAbs = maxAbs;
+    summary.minAbs = minAbs;
+    summary.frobeniusNorm = scale*Sqrt(scaledSquare);
+    return summary;
+}
+
+template<typename Ring>
+EntrywiseReductions<Base<Ring>> EntrywiseReduce( const AbstractDistMatrix<Ring>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !A.Grid().InGrid() )
+          LogicError("Viewing processes are not allowed");
+    )
+    typedef Base<Ring> Real;
+    EntrywiseReductions<Real> summary;
+    if( A.Participating() )
+    {
+        const Int mLocal = A.LocalHeight();
+        const Int nLocal = A.LocalWidth();
+        const Ring* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
+
+        // Negating the local minimum allows all three reductions to share
+        // a single MAX AllReduce
+        Real packed[3] = { Real(0), -limits::Max<Real>(), Real(0) };
+        Real localScale = 0;
+        Real localScaledSquare = 1;
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        {
+            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            {
+                const Real absVal = Abs(ABuf[iLoc+jLoc*ALDim]);
+                packed[0] = Max( packed[0], absVal );
+                packed[1] = Max( packed[1], -absVal );
+                UpdateScaledSquare( absVal, localScale, localScaledSquare );
+            }
+        }
+        packed[2] = localScale;
+        mpi::AllReduce( packed, 3, mpi::MAX, A.DistComm() );
+
+        // The global scale is identical on every process, so all of them
+        // take the same branch and the summation remains collective
+        const Real scale = packed[2];
+        Real scaledSquare = 0;
+        if( scale != Real(0) )
+        {
+            // Equilibrate our local scaled sum to the maximum scale
+            const Real relScale = localScale/scale;
+            localScaledSquare *= relScale*relScale;
+            scaledSquare = mpi::AllReduce( localScaledSquare, A.DistComm() );
+        }
+
+        summary.maxAbs = packed[0];
+        if( A.Height() != 0 && A.Width() != 0 )
+            summary.minAbs = -packed[1];
+        summary.frobeniusNorm = scale*Sqrt(scaledSquare);
+    }
+    Real packed[3] =
+      { summary.maxAbs, summary.minAbs, summary.frobeniusNorm };
+    mpi::Broadcast( packed, 3, A.Root(), A.CrossComm() );
+    summary.maxAbs = packed[0];
+    summary.minAbs = packed[1];
+    summary.frobeniusNorm = packed[2];
+    return summary;
+}
+
+#define PROTO(Ring) \
+  template EntrywiseReductions<Base<Ring>> EntrywiseReduce \
+  ( const Matrix<Ring>& A ); \
+  template EntrywiseReductions<Base<Ring>> EntrywiseReduce \
+  ( const AbstractDistMatrix<Ring>& A );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -200,4 +200,152 @@ void GetSubgraph
     LogicError("This routine is not yet written");
 }
 
+void GetSubgraphs
+( const Graph& graph,
+  const vector<Range<Int>>& I,
+  const vector<Range<Int>>& J,
+        vector<Graph>& subgraphs )
+{
+    EL_DEBUG_CSE
+    const Int numSub = I.size();
+    if( Int(J.size()) != numSub )
+        LogicError("I and J must contain the same number of index ranges");
+    subgraphs.clear();
+    subgraphs.resize( numSub );
+    // Each extraction only reads the shared edge list, so the filtering is
+    // trivially parallel over the subgraphs
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numSub; ++k )
+        GetSubgraph( graph, I[k], J[k], subgraphs[k] );
+}
+
+void GetSubgraphs
+( const DistGraph& graph,
+  const vector<Range<Int>>& I,
+  const vector<Range<Int>>& J,
+        vector<DistGraph>& subgraphs )
+{
+    EL_DEBUG_CSE
+    const Int numSub = I.size();
+    if( Int(J.size()) != numSub )
+        LogicError("I and J must contain the same number of index ranges");
+    const Int* sourceBuf = graph.LockedSourceBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    const Int numEdges = graph.NumLocalEdges();
+
+    const Grid& grid = graph.Grid();
+    const int commSize = grid.Size();
+
+    // Resolve the index ranges and set up the subgraphs
+    // =================================================
+    vector<Range<Int>> IRes(I), JRes(J);
+    subgraphs.clear();
+    subgraphs.resize( numSub );
+    for( Int k=0; k<numSub; ++k )
+    {
+        if( IRes[k].end == END ) IRes[k].end = graph.NumSources();
+        if( JRes[k].end == END ) JRes[k].end = graph.NumTargets();
+        subgraphs[k].SetGrid( grid );
+        subgraphs[k].Resize
+        ( IRes[k].end-IRes[k].beg, JRes[k].end-JRes[k].beg );
+    }
+
+    // Count the edges each subgraph contributes to each process
+    // =========================================================
+    // (The filtering only reads the shared local edge list and writes into
+    //  per-subgraph counters, so it is performed in parallel over the
+    //  subgraphs)
+    vector<vector<int>> subCounts( numSub );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numSub; ++k )
+    {
+        subCounts[k].resize( commSize, 0 );
+        const Range<Int>& IK = IRes[k];
+        const Range<Int>& JK = JRes[k];
+        for( Int e=0; e<numEdges; ++e )
+        {
+            const Int i = sourceBuf[e];
+            const Int j = targetBuf[e];
+            if( i >= IK.end )
+                break;
+            else if( i >= IK.beg && j >= JK.beg && j < JK.end )
+                ++subCounts[k][ subgraphs[k].SourceOwner(i-IK.beg) ];
+        }
+    }
+
+    // Aggregate the counts over the subgraphs and compute packing offsets
+    // ===================================================================
+    vector<int> sendCounts( commSize, 0 );
+    for( Int k=0; k<numSub; ++k )
+        for( int q=0; q<commSize; ++q )
+            sendCounts[q] += subCounts[k][q];
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    // Within each process's interval the packed edges are grouped by
+    // subgraph
+    vector<vector<int>> subOffs( numSub );
+    {
+        auto offs = sendOffs;
+        for( Int k=0; k<numSub; ++k )
+        {
+            subOffs[k] = offs;
+            for( int q=0; q<commSize; ++q )
+                offs[q] += subCounts[k][q];
+        }
+    }
+
+    // Pack the data
+    // =============
+    vector<Int> sendSubs(totalSend),
+                sendSources(totalSend),
+                sendTargets(totalSend);
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numSub; ++k )
+    {
+        auto offs = subOffs[k];
+        const Range<Int>& IK = IRes[k];
+        const Range<Int>& JK = JRes[k];
+        for( Int e=0; e<numEdges; ++e )
+        {
+            const Int i = sourceBuf[e];
+            const Int j = targetBuf[e];
+            if( i >= IK.end )
+                break;
+            else if( i >= IK.beg && j >= JK.beg && j < JK.end )
+            {
+                const Int iSub = i - IK.beg;
+                const Int jSub = j - JK.beg;
+                const int owner = subgraphs[k].SourceOwner( iSub );
+                sendSubs[offs[owner]] = k;
+                sendSources[offs[owner]] = iSub;
+                sendTargets[offs[owner]] = jSub;
+                ++offs[owner];
+            }
+        }
+    }
+
+    // Exchange the data with a single aggregated AllToAll per buffer
+    // ==============================================================
+    auto recvSubs =
+      mpi::AllToAll( sendSubs, sendCounts, sendOffs, grid.Comm() );
+    auto recvSources =
+      mpi::AllToAll( sendSources, sendCounts, sendOffs, grid.Comm() );
+    auto recvTargets =
+      mpi::AllToAll( sendTargets, sendCounts, sendOffs, grid.Comm() );
+
+    // Unpack the data
+    // ===============
+    const Int totalRecv = recvSources.size();
+    vector<Int> numRecvSub( numSub, 0 );
+    for( Int t=0; t<totalRecv; ++t )
+        ++numRecvSub[ recvSubs[t] ];
+    for( Int k=0; k<numSub; ++k )
+        subgraphs[k].Reserve( numRecvSub[k] );
+    for( Int t=0; t<totalRecv; ++t )
+        subgraphs[recvSubs[t]].QueueConnection
+        ( recvSources[t], recvTargets[t] );
+    for( Int k=0; k<numSub; ++k )
+        subgraphs[k].ProcessQueues();
+}
+
 } // namespace El
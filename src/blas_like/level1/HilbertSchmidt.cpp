@@ -32,9 +32,16 @@ Ring HilbertSchmidt( const Matrix<Ring>& A, const Matrix<Ring>& B )
     }
     else
     {
+        ScratchElement<Ring> scratch;
+        Ring& gamma = scratch.Ref();
         for( Int j=0; j<width; ++j )
+        {
             for( Int i=0; i<height; ++i )
-                innerProd += Conj(ABuf[i+j*ALDim])*BBuf[i+j*BLDim];
+            {
+                Conj( ABuf[i+j*ALDim], gamma );
+                AddMul( gamma, BBuf[i+j*BLDim], innerProd );
+            }
+        }
     }
     return innerProd;
 }
@@ -67,19 +74,37 @@ Ring HilbertSchmidt
         const Ring* BBuf = B.LockedBuffer();
         const Int ALDim = A.LDim();
         const Int BLDim = B.LDim();
-        if( localHeight == ALDim && localHeight == BLDim )
+        if( ReproducibleReductionsEnabled() )
+        {
+            // Materialize the local products so that each can be pre-rounded
+            vector<Ring> products( localHeight*localWidth );
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    products[iLoc+jLoc*localHeight] =
+                      Conj(ABuf[iLoc+jLoc*ALDim])*BBuf[iLoc+jLoc*BLDim];
+            innerProd = ReproducibleAllReduceSum
+              ( products.data(), localHeight*localWidth, A.DistComm() );
+        }
+        else if( localHeight == ALDim && localHeight == BLDim )
         {
             localInnerProd +=
               blas::Dot( localHeight*localWidth, ABuf, 1, BBuf, 1 );
+            innerProd = mpi::AllReduce( localInnerProd, A.DistComm() );
         }
         else
         {
+            ScratchElement<Ring> scratch;
+            Ring& gamma = scratch.Ref();
             for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
                 for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    localInnerProd += Conj(ABuf[iLoc+jLoc*ALDim])*
-                                           BBuf[iLoc+jLoc*BLDim];
+                {
+                    Conj( ABuf[iLoc+jLoc*ALDim], gamma );
+                    AddMul( gamma, BBuf[iLoc+jLoc*BLDim], localInnerProd );
+                }
+            }
+            innerProd = mpi::AllReduce( localInnerProd, A.DistComm() );
         }
-        innerProd = mpi::AllReduce( localInnerProd, A.DistComm() );
     }
     mpi::Broadcast( innerProd, A.Root(), A.CrossComm() );
     return innerProd;
@@ -105,9 +130,16 @@ Ring HilbertSchmidt( const DistMultiVec<Ring>& A, const DistMultiVec<Ring>& B )
     const Ring* BBuf = B.LockedMatrix().LockedBuffer();
     const Int ALDim = A.LockedMatrix().LDim();
     const Int BLDim = B.LockedMatrix().LDim();
+    ScratchElement<Ring> scratch;
+    Ring& gamma = scratch.Ref();
     for( Int j=0; j<width; ++j )
+    {
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            localInnerProd += Conj(ABuf[iLoc+j*ALDim])*BBuf[iLoc+j*BLDim];
+        {
+            Conj( ABuf[iLoc+j*ALDim], gamma );
+            AddMul( gamma, BBuf[iLoc+j*BLDim], localInnerProd );
+        }
+    }
     return mpi::AllReduce( localInnerProd, A.Grid().Comm() );
 }
 
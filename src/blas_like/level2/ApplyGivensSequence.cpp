@@ -278,6 +278,81 @@ void ApplyBottomRight
     }
 }
 
+namespace {
+
+// Applying each rotation across the full matrix streams all of A through
+// cache once per rotation, so a variable sweep of length k touches k*m*n
+// entries. Restricting the sweep to a panel of columns (rows) small enough
+// to stay resident turns this into a single pass over A. Since the
+// rotations act identically and independently on disjoint panels, the
+// blocked traversal produces bitwise identical results.
+const El::Int givensLeftPanelWidth = 128;
+const El::Int givensRightPanelHeight = 256;
+
+} // anonymous namespace
+
+template<typename F,typename S>
+void ApplyVariableLeftSweep
+( ForwardOrBackward direction,
+  const Matrix<Base<F>>& cList,
+  const Matrix<S>& sList,
+        Matrix<F>& A,
+        F& tmp,
+  const Base<F>& one,
+  const S& zero )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    for( Int j0=0; j0<n; j0+=givensLeftPanelWidth )
+    {
+        const Int j1 = Min( j0+givensLeftPanelWidth, n );
+        auto APan = A( ALL, IR(j0,j1) );
+        if( direction == FORWARD )
+        {
+            for( Int i=0; i<m-1; ++i )
+                ApplyVariableLeft
+                ( i, cList(i), sList(i), APan, tmp, one, zero );
+        }
+        else
+        {
+            for( Int i=m-2; i>=0; --i )
+                ApplyVariableLeft
+                ( i, cList(i), sList(i), APan, tmp, one, zero );
+        }
+    }
+}
+
+template<typename F,typename S>
+void ApplyVariableRightSweep
+( ForwardOrBackward direction,
+  const Matrix<Base<F>>& cList,
+  const Matrix<S>& sList,
+        Matrix<F>& A,
+        F& tmp,
+  const Base<F>& one,
+  const S& zero )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    for( Int i0=0; i0<m; i0+=givensRightPanelHeight )
+    {
+        const Int i1 = Min( i0+givensRightPanelHeight, m );
+        auto APan = A( IR(i0,i1), ALL );
+        if( direction == FORWARD )
+        {
+            for( Int j=0; j<n-1; ++j )
+                ApplyVariableRight
+                ( j, cList(j), sList(j), APan, tmp, one, zero );
+        }
+        else
+        {
+            for( Int j=n-2; j>=0; --j )
+                ApplyVariableRight
+                ( j, cList(j), sList(j), APan, tmp, one, zero );
+        }
+    }
+}
+
 template<typename F,typename>
 void ApplyGivensSequence
 ( LeftOrRight side, GivensSequenceType seqType, ForwardOrBackward direction,
@@ -300,22 +375,7 @@ void ApplyGivensSequence
     {
         if( seqType == VARIABLE_GIVENS_SEQUENCE )
         {
-            if( direction == FORWARD )
-            {
-                for( Int i=0; i<m-1; ++i )
-                {
-                    ApplyVariableLeft
-                    ( i, cList(i), sList(i), A, tmp, one, zeroF );
-                }
-            }
-            else
-            {
-                for( Int i=m-2; i>=0; --i )
-                {
-                    ApplyVariableLeft
-                    ( i, cList(i), sList(i), A, tmp, one, zeroF );
-                }
-            }
+            ApplyVariableLeftSweep( direction, cList, sList, A, tmp, one, zeroF );
         }
         else if( seqType == TOP_GIVENS_SEQUENCE )
         {
@@ -360,22 +420,8 @@ void ApplyGivensSequence
     {
         if( seqType == VARIABLE_GIVENS_SEQUENCE )
         {
-            if( direction == FORWARD )
-            {
-                for( Int j=0; j<n-1; ++j )
-                {
-                    ApplyVariableRight
-                    ( j, cList(j), sList(j), A, tmp, one, zeroF );
-                }
-            }
-            else
-            {
-                for( Int j=n-2; j>=0; --j )
-                {
-                    ApplyVariableRight
-                    ( j, cList(j), sList(j), A, tmp, one, zeroF );
-                }
-            }
+            ApplyVariableRightSweep
+            ( direction, cList, sList, A, tmp, one, zeroF );
         }
         else if( seqType == TOP_GIVENS_SEQUENCE )
         {
@@ -439,22 +485,7 @@ void ApplyGivensSequence
     {
         if( seqType == VARIABLE_GIVENS_SEQUENCE )
         {
-            if( direction == FORWARD )
-            {
-                for( Int i=0; i<m-1; ++i )
-                {
-                    ApplyVariableLeft
-                    ( i, cList(i), sList(i), A, tmp, one, zero );
-                }
-            }
-            else
-            {
-                for( Int i=m-2; i>=0; --i )
-                {
-                    ApplyVariableLeft
-                    ( i, cList(i), sList(i), A, tmp, one, zero );
-                }
-            }
+            ApplyVariableLeftSweep( direction, cList, sList, A, tmp, one, zero );
         }
         else if( seqType == TOP_GIVENS_SEQUENCE )
         {
@@ -499,22 +530,7 @@ void ApplyGivensSequence
     {
         if( seqType == VARIABLE_GIVENS_SEQUENCE )
         {
-            if( direction == FORWARD )
-            {
-                for( Int j=0; j<n-1; ++j )
-                {
-                    ApplyVariableRight
-                    ( j, cList(j), sList(j), A, tmp, one, zero );
-                }
-            }
-            else
-            {
-                for( Int j=n-2; j>=0; --j )
-                {
-                    ApplyVariableRight
-                    ( j, cList(j), sList(j), A, tmp, one, zero );
-                }
-            }
+            ApplyVariableRightSweep( direction, cList, sList, A, tmp, one, zero );
         }
         else if( seqType == TOP_GIVENS_SEQUENCE )
         {
@@ -557,12 +573,164 @@ void ApplyGivensSequence
     }
 }
 
+template<typename F>
+GivensBatch<F>::GivensBatch( LeftOrRight side, ForwardOrBackward direction )
+: side_(side), direction_(direction)
+{ }
+
+template<typename F>
+void GivensBatch<F>::Queue
+( const Matrix<Base<F>>& cList, const Matrix<F>& sList )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( cList.Height() != sList.Height() )
+          LogicError("cList and sList must have the same length");
+    )
+    Entry entry;
+    entry.cList = cList;
+    entry.sList = sList;
+    entry.sIsReal = false;
+    entries_.push_back( std::move(entry) );
+}
+
+template<typename F>
+void GivensBatch<F>::QueueReal
+( const Matrix<Base<F>>& cList, const Matrix<Base<F>>& sList )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( cList.Height() != sList.Height() )
+          LogicError("cList and sList must have the same length");
+    )
+    Entry entry;
+    entry.cList = cList;
+    entry.sRealList = sList;
+    entry.sIsReal = true;
+    entries_.push_back( std::move(entry) );
+}
+
+template<typename F>
+Int GivensBatch<F>::NumQueued() const
+{ return entries_.size(); }
+
+template<typename F>
+void GivensBatch<F>::Clear()
+{ entries_.clear(); }
+
+template<typename F>
+void GivensBatch<F>::Apply( Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = ( side_==LEFT ? m-1 : n-1 );
+    EL_DEBUG_ONLY(
+      for( const auto& entry : entries_ )
+          if( entry.cList.Height() < k )
+              LogicError("Queued sweep is too short for A");
+    )
+    if( m == 0 || n == 0 || entries_.empty() )
+    {
+        Clear();
+        return;
+    }
+
+    const Real one(1), zero(0);
+    const F zeroF(0);
+    F tmp;
+    if( side_ == LEFT )
+    {
+        // Traverse the column panels outermost so that each panel is
+        // loaded into cache once for every queued sweep rather than once
+        // per sweep
+        for( Int j0=0; j0<n; j0+=givensLeftPanelWidth )
+        {
+            const Int j1 = Min( j0+givensLeftPanelWidth, n );
+            auto APan = A( ALL, IR(j0,j1) );
+            for( const auto& entry : entries_ )
+            {
+                if( direction_ == FORWARD )
+                {
+                    for( Int i=0; i<m-1; ++i )
+                    {
+                        if( entry.sIsReal )
+                            ApplyVariableLeft
+                            ( i, entry.cList(i), entry.sRealList(i),
+                              APan, tmp, one, zero );
+                        else
+                            ApplyVariableLeft
+                            ( i, entry.cList(i), entry.sList(i),
+                              APan, tmp, one, zeroF );
+                    }
+                }
+                else
+                {
+                    for( Int i=m-2; i>=0; --i )
+                    {
+                        if( entry.sIsReal )
+                            ApplyVariableLeft
+                            ( i, entry.cList(i), entry.sRealList(i),
+                              APan, tmp, one, zero );
+                        else
+                            ApplyVariableLeft
+                            ( i, entry.cList(i), entry.sList(i),
+                              APan, tmp, one, zeroF );
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        for( Int i0=0; i0<m; i0+=givensRightPanelHeight )
+        {
+            const Int i1 = Min( i0+givensRightPanelHeight, m );
+            auto APan = A( IR(i0,i1), ALL );
+            for( const auto& entry : entries_ )
+            {
+                if( direction_ == FORWARD )
+                {
+                    for( Int j=0; j<n-1; ++j )
+                    {
+                        if( entry.sIsReal )
+                            ApplyVariableRight
+                            ( j, entry.cList(j), entry.sRealList(j),
+                              APan, tmp, one, zero );
+                        else
+                            ApplyVariableRight
+                            ( j, entry.cList(j), entry.sList(j),
+                              APan, tmp, one, zeroF );
+                    }
+                }
+                else
+                {
+                    for( Int j=n-2; j>=0; --j )
+                    {
+                        if( entry.sIsReal )
+                            ApplyVariableRight
+                            ( j, entry.cList(j), entry.sRealList(j),
+                              APan, tmp, one, zero );
+                        else
+                            ApplyVariableRight
+                            ( j, entry.cList(j), entry.sList(j),
+                              APan, tmp, one, zeroF );
+                    }
+                }
+            }
+        }
+    }
+    Clear();
+}
+
 #define PROTO_REAL(F) \
   template void ApplyGivensSequence \
   ( LeftOrRight side, GivensSequenceType seqType, ForwardOrBackward direction, \
     const Matrix<Base<F>>& cList, \
     const Matrix<Base<F>>& sList, \
-    Matrix<F>& A );
+    Matrix<F>& A ); \
+  template class GivensBatch<F>;
 
 #define PROTO(F) \
   PROTO_REAL(F) \
@@ -0,0 +1,256 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level2.hpp>
+
+namespace El {
+
+namespace banded_gemv {
+
+// z += alpha A x restricted to the band, with the band segments of the
+// local matrix located through the global-to-local index maps of the
+// distribution
+template<typename T>
+void LocalNormal
+( Int kl, Int ku, T alpha,
+  const DistMatrix<T>& A,
+  const Matrix<T>& xLoc,
+        Matrix<T>& zLoc )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int nLocal = A.LocalWidth();
+    auto& ALoc = A.LockedMatrix();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Int j = A.GlobalCol( jLoc );
+        const Int i0 = Max( j-ku, Int(0) );
+        const Int i1 = Min( j+kl+1, m );
+        const Int iLocBeg = A.LocalRowOffset( i0 );
+        const Int iLocEnd = A.LocalRowOffset( i1 );
+        const T chi = alpha*xLoc(jLoc);
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            zLoc(iLoc) += ALoc(iLoc,jLoc)*chi;
+    }
+}
+
+template<typename T>
+void LocalTranspose
+( Orientation orientation, Int kl, Int ku, T alpha,
+  const DistMatrix<T>& A,
+  const Matrix<T>& xLoc,
+        Matrix<T>& zLoc )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int nLocal = A.LocalWidth();
+    const bool conjugate = ( orientation == ADJOINT );
+    auto& ALoc = A.LockedMatrix();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Int j = A.GlobalCol( jLoc );
+        const Int i0 = Max( j-ku, Int(0) );
+        const Int i1 = Min( j+kl+1, m );
+        const Int iLocBeg = A.LocalRowOffset( i0 );
+        const Int iLocEnd = A.LocalRowOffset( i1 );
+        T eta = 0;
+        if( conjugate )
+            for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+                eta += Conj(ALoc(iLoc,jLoc))*xLoc(iLoc);
+        else
+            for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+                eta += ALoc(iLoc,jLoc)*xLoc(iLoc);
+        zLoc(jLoc) += alpha*eta;
+    }
+}
+
+} // namespace banded_gemv
+
+template<typename T>
+void BandedGemv
+( Orientation orientation, Int lowerBandwidth, Int upperBandwidth,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& x,
+  T beta,        Matrix<T>& y )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int kl = Max( lowerBandwidth, Int(0) );
+    const Int ku = Max( upperBandwidth, Int(0) );
+    EL_DEBUG_ONLY(
+      if( x.Width() != 1 || y.Width() != 1 )
+          LogicError("x and y are assumed to be column vectors");
+      const Int xLength = ( orientation==NORMAL ? n : m );
+      const Int yLength = ( orientation==NORMAL ? m : n );
+      if( x.Height() != xLength || y.Height() != yLength )
+          LogicError
+          ("Nonconformal: \n",DimsString(A,"A"),"\n",
+           DimsString(x,"x"),"\n",DimsString(y,"y"));
+    )
+    y *= beta;
+    if( orientation == NORMAL )
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            const Int i0 = Max( j-ku, Int(0) );
+            const Int i1 = Min( j+kl+1, m );
+            const T chi = alpha*x(j);
+            for( Int i=i0; i<i1; ++i )
+                y(i) += A(i,j)*chi;
+        }
+    }
+    else
+    {
+        const bool conjugate = ( orientation == ADJOINT );
+        for( Int j=0; j<n; ++j )
+        {
+            const Int i0 = Max( j-ku, Int(0) );
+            const Int i1 = Min( j+kl+1, m );
+            T eta = 0;
+            if( conjugate )
+                for( Int i=i0; i<i1; ++i )
+                    eta += Conj(A(i,j))*x(i);
+            else
+                for( Int i=i0; i<i1; ++i )
+                    eta += A(i,j)*x(i);
+            y(j) += alpha*eta;
+        }
+    }
+}
+
+template<typename T>
+void BandedGemv
+( Orientation orientation, Int lowerBandwidth, Int upperBandwidth,
+  T alpha, const AbstractDistMatrix<T>& APre,
+           const AbstractDistMatrix<T>& x,
+  T beta,        AbstractDistMatrix<T>& yPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, x, yPre );
+      if( x.Width() != 1 || yPre.Width() != 1 )
+          LogicError("x and y are assumed to be column vectors");
+      const Int xLength = ( orientation==NORMAL ? APre.Width()
+                                                : APre.Height() );
+      const Int yLength = ( orientation==NORMAL ? APre.Height()
+                                                : APre.Width() );
+      if( x.Height() != xLength || yPre.Height() != yLength )
+          LogicError
+          ("Nonconformal: \n",DimsString(APre,"A"),"\n",
+           DimsString(x,"x"),"\n",DimsString(yPre,"y"));
+    )
+    const Grid& g = APre.Grid();
+    const Int kl = Max( lowerBandwidth, Int(0) );
+    const Int ku = Max( upperBandwidth, Int(0) );
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> yProx( yPre );
+    auto& A = AProx.GetLocked();
+    auto& y = yProx.Get();
+
+    y *= beta;
+    if( orientation == NORMAL )
+    {
+        DistMatrix<T,MR,STAR> x_MR_STAR(g);
+        x_MR_STAR.AlignWith( A );
+        x_MR_STAR = x;
+
+        DistMatrix<T,MC,STAR> z_MC_STAR(g);
+        z_MC_STAR.AlignWith( A );
+        z_MC_STAR.Resize( A.Height(), 1 );
+        Zero( z_MC_STAR );
+        banded_gemv::LocalNormal
+        ( kl, ku, alpha, A, x_MR_STAR.LockedMatrix(), z_MC_STAR.Matrix() );
+        AxpyContract( T(1), z_MC_STAR, y );
+    }
+    else
+    {
+        DistMatrix<T,MC,STAR> x_MC_STAR(g);
+        x_MC_STAR.AlignWith( A );
+        x_MC_STAR = x;
+
+        DistMatrix<T,MR,STAR> z_MR_STAR(g);
+        z_MR_STAR.AlignWith( A );
+        z_MR_STAR.Resize( A.Width(), 1 );
+        Zero( z_MR_STAR );
+        banded_gemv::LocalTranspose
+        ( orientation, kl, ku, alpha, A,
+          x_MC_STAR.LockedMatrix(), z_MR_STAR.Matrix() );
+
+        DistMatrix<T,MR,MC> z_MR_MC(g);
+        z_MR_MC.AlignWith( y );
+        Contract( z_MR_STAR, z_MR_MC );
+        Axpy( T(1), z_MR_MC, y );
+    }
+}
+
+template<typename T>
+void HessenbergGemv
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const Matrix<T>& H,
+           const Matrix<T>& x,
+  T beta,        Matrix<T>& y )
+{
+    EL_DEBUG_CSE
+    if( uplo == UPPER )
+        BandedGemv
+        ( orientation, 1, Max(H.Width()-1,Int(0)), alpha, H, x, beta, y );
+    else
+        BandedGemv
+        ( orientation, Max(H.Height()-1,Int(0)), 1, alpha, H, x, beta, y );
+}
+
+template<typename T>
+void HessenbergGemv
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const AbstractDistMatrix<T>& H,
+           const AbstractDistMatrix<T>& x,
+  T beta,        AbstractDistMatrix<T>& y )
+{
+    EL_DEBUG_CSE
+    if( uplo == UPPER )
+        BandedGemv
+        ( orientation, 1, Max(H.Width()-1,Int(0)), alpha, H, x, beta, y );
+    else
+        BandedGemv
+        ( orientation, Max(H.Height()-1,Int(0)), 1, alpha, H, x, beta, y );
+}
+
+#define PROTO(T) \
+  template void BandedGemv \
+  ( Orientation orientation, Int lowerBandwidth, Int upperBandwidth, \
+    T alpha, const Matrix<T>& A, \
+             const Matrix<T>& x, \
+    T beta,        Matrix<T>& y ); \
+  template void BandedGemv \
+  ( Orientation orientation, Int lowerBandwidth, Int upperBandwidth, \
+    T alpha, const AbstractDistMatrix<T>& A, \
+             const AbstractDistMatrix<T>& x, \
+    T beta,        AbstractDistMatrix<T>& y ); \
+  template void HessenbergGemv \
+  ( UpperOrLower uplo, Orientation orientation, \
+    T alpha, const Matrix<T>& H, \
+             const Matrix<T>& x, \
+    T beta,        Matrix<T>& y ); \
+  template void HessenbergGemv \
+  ( UpperOrLower uplo, Orientation orientation, \
+    T alpha, const AbstractDistMatrix<T>& H, \
+             const AbstractDistMatrix<T>& x, \
+    T beta,        AbstractDistMatrix<T>& y );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
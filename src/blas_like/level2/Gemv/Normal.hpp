@@ -10,6 +10,72 @@
 namespace El {
 namespace gemv {
 
+// A is partitioned by columns over the entire process set, e.g., [STAR,VR]:
+// each process multiplies against its piece of x and the (short) output
+// vector is summed with a single AllReduce, so the long input vector is
+// never replicated
+template<typename T,Dist rowDist>
+void NormalRowPartitioned
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& x,
+  T beta,
+        AbstractDistMatrix<T>& y )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<T,T,STAR,rowDist> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    DistMatrix<T,rowDist,STAR> x_Part_STAR(g);
+    x_Part_STAR.AlignWith( A );
+    x_Part_STAR = x;
+
+    DistMatrix<T,STAR,STAR> z_STAR_STAR(g);
+    z_STAR_STAR.Resize( A.Height(), 1 );
+    Zero( z_STAR_STAR );
+    Gemv
+    ( NORMAL, alpha, A.LockedMatrix(), x_Part_STAR.LockedMatrix(),
+      T(0), z_STAR_STAR.Matrix() );
+    AllReduce( z_STAR_STAR.Matrix(), A.RowComm(), mpi::SUM );
+
+    Scale( beta, y );
+    Axpy( T(1), z_STAR_STAR, y );
+}
+
+// A is partitioned by rows over the entire process set, e.g., [VC,STAR]:
+// the (short) input vector is replicated once and each process then forms
+// its rows of y without any reduction
+template<typename T,Dist colDist>
+void NormalColPartitioned
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& x,
+  T beta,
+        AbstractDistMatrix<T>& y )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<T,T,colDist,STAR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    DistMatrix<T,STAR,STAR> x_STAR_STAR(g);
+    x_STAR_STAR = x;
+
+    DistMatrix<T,colDist,STAR> z(g);
+    z.AlignWith( A );
+    z.Resize( A.Height(), 1 );
+    Zero( z );
+    Gemv
+    ( NORMAL, alpha, A.LockedMatrix(), x_STAR_STAR.LockedMatrix(),
+      T(0), z.Matrix() );
+
+    Scale( beta, y );
+    Axpy( T(1), z, y );
+}
+
 template<typename T>
 void Normal
 ( T alpha,
@@ -33,6 +99,36 @@ void Normal
     )
     const Grid& g = APre.Grid();
 
+    // 1D-distributed operators admit variants with far less vector motion
+    // than the general [MC,MR] algorithm, which matters for the extreme
+    // aspect ratios typical of matvec-heavy Krylov loops; dispatch on the
+    // distribution before forcing a proxy redistribution of A
+    if( APre.Wrap() == ELEMENT && x.Width() == 1 && yPre.Width() == 1 )
+    {
+        const Dist colDist = APre.ColDist();
+        const Dist rowDist = APre.RowDist();
+        if( colDist == STAR && rowDist == VR )
+        {
+            NormalRowPartitioned<T,VR>( alpha, APre, x, beta, yPre );
+            return;
+        }
+        if( colDist == STAR && rowDist == VC )
+        {
+            NormalRowPartitioned<T,VC>( alpha, APre, x, beta, yPre );
+            return;
+        }
+        if( colDist == VC && rowDist == STAR )
+        {
+            NormalColPartitioned<T,VC>( alpha, APre, x, beta, yPre );
+            return;
+        }
+        if( colDist == VR && rowDist == STAR )
+        {
+            NormalColPartitioned<T,VR>( alpha, APre, x, beta, yPre );
+            return;
+        }
+    }
+
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadWriteProxy<T,T,MC,MR> yProx( yPre );
     auto& A = AProx.GetLocked();
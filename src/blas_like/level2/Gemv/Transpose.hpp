@@ -10,6 +10,74 @@
 namespace El {
 namespace gemv {
 
+// A is partitioned by rows over the entire process set, e.g., [VC,STAR]:
+// each process applies its rows of A to its piece of x and the (short)
+// output vector is summed with a single AllReduce, so the long input
+// vector is never replicated
+template<typename T,Dist colDist>
+void TransposeRowPartitioned
+( Orientation orientation,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& x,
+  T beta,
+        AbstractDistMatrix<T>& y )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<T,T,colDist,STAR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    DistMatrix<T,colDist,STAR> x_Part_STAR(g);
+    x_Part_STAR.AlignWith( A );
+    x_Part_STAR = x;
+
+    DistMatrix<T,STAR,STAR> z_STAR_STAR(g);
+    z_STAR_STAR.Resize( A.Width(), 1 );
+    Zero( z_STAR_STAR );
+    Gemv
+    ( orientation, alpha, A.LockedMatrix(), x_Part_STAR.LockedMatrix(),
+      T(0), z_STAR_STAR.Matrix() );
+    AllReduce( z_STAR_STAR.Matrix(), A.ColComm(), mpi::SUM );
+
+    Scale( beta, y );
+    Axpy( T(1), z_STAR_STAR, y );
+}
+
+// A is partitioned by columns over the entire process set, e.g., [STAR,VR]:
+// the (short) input vector is replicated once and each process then forms
+// its rows of y without any reduction
+template<typename T,Dist rowDist>
+void TransposeColPartitioned
+( Orientation orientation,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& x,
+  T beta,
+        AbstractDistMatrix<T>& y )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<T,T,STAR,rowDist> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    DistMatrix<T,STAR,STAR> x_STAR_STAR(g);
+    x_STAR_STAR = x;
+
+    DistMatrix<T,rowDist,STAR> z(g);
+    z.AlignWith( A );
+    z.Resize( A.Width(), 1 );
+    Zero( z );
+    Gemv
+    ( orientation, alpha, A.LockedMatrix(), x_STAR_STAR.LockedMatrix(),
+      T(0), z.Matrix() );
+
+    Scale( beta, y );
+    Axpy( T(1), z, y );
+}
+
 template<typename T>
 void Transpose
 ( Orientation orientation,
@@ -34,6 +102,38 @@ void Transpose
     )
     const Grid& g = APre.Grid();
 
+    // As in gemv::Normal, dispatch 1D-distributed operators to variants
+    // which move far less vector data than the general [MC,MR] algorithm
+    if( APre.Wrap() == ELEMENT && x.Width() == 1 && yPre.Width() == 1 )
+    {
+        const Dist colDist = APre.ColDist();
+        const Dist rowDist = APre.RowDist();
+        if( colDist == VC && rowDist == STAR )
+        {
+            TransposeRowPartitioned<T,VC>
+            ( orientation, alpha, APre, x, beta, yPre );
+            return;
+        }
+        if( colDist == VR && rowDist == STAR )
+        {
+            TransposeRowPartitioned<T,VR>
+            ( orientation, alpha, APre, x, beta, yPre );
+            return;
+        }
+        if( colDist == STAR && rowDist == VR )
+        {
+            TransposeColPartitioned<T,VR>
+            ( orientation, alpha, APre, x, beta, yPre );
+            return;
+        }
+        if( colDist == STAR && rowDist == VC )
+        {
+            TransposeColPartitioned<T,VC>
+            ( orientation, alpha, APre, x, beta, yPre );
+            return;
+        }
+    }
+
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
     DistMatrixReadWriteProxy<T,T,MC,MR> yProx( yPre );
     auto& A = AProx.GetLocked();
@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+template<typename T>
+void BandedGemm
+( Orientation orientA, Int lowerBandwidth, Int upperBandwidth,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int kl = Max( lowerBandwidth, Int(0) );
+    const Int ku = Max( upperBandwidth, Int(0) );
+    EL_DEBUG_ONLY(
+      const Int innerDim = ( orientA==NORMAL ? n : m );
+      const Int outerDim = ( orientA==NORMAL ? m : n );
+      if( B.Height() != innerDim || C.Height() != outerDim ||
+          C.Width() != B.Width() )
+          LogicError
+          ("Nonconformal: \n",DimsString(A,"A"),"\n",
+           DimsString(B,"B"),"\n",DimsString(C,"C"));
+    )
+    C *= beta;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int i0 = Max( k-ku, Int(0) );
+        const Int i1 = Min( k+nb-1+kl+1, m );
+        if( i0 >= i1 )
+            continue;
+
+        auto A1 = A( IR(i0,i1), IR(k,k+nb) );
+        if( orientA == NORMAL )
+        {
+            auto B1 = B( IR(k,k+nb), ALL );
+            auto C1 = C( IR(i0,i1), ALL );
+            Gemm( NORMAL, NORMAL, alpha, A1, B1, T(1), C1 );
+        }
+        else
+        {
+            auto B1 = B( IR(i0,i1), ALL );
+            auto C1 = C( IR(k,k+nb), ALL );
+            Gemm( orientA, NORMAL, alpha, A1, B1, T(1), C1 );
+        }
+    }
+}
+
+template<typename T>
+void BandedGemm
+( Orientation orientA, Int lowerBandwidth, Int upperBandwidth,
+  T alpha, const AbstractDistMatrix<T>& APre,
+           const AbstractDistMatrix<T>& BPre,
+  T beta,        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, BPre, CPre );
+      const Int innerDim = ( orientA==NORMAL ? APre.Width() : APre.Height() );
+      const Int outerDim = ( orientA==NORMAL ? APre.Height() : APre.Width() );
+      if( BPre.Height() != innerDim || CPre.Height() != outerDim ||
+          CPre.Width() != BPre.Width() )
+          LogicError
+          ("Nonconformal: \n",DimsString(APre,"A"),"\n",
+           DimsString(BPre,"B"),"\n",DimsString(CPre,"C"));
+    )
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int kl = Max( lowerBandwidth, Int(0) );
+    const Int ku = Max( upperBandwidth, Int(0) );
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    C *= beta;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int i0 = Max( k-ku, Int(0) );
+        const Int i1 = Min( k+nb-1+kl+1, m );
+        if( i0 >= i1 )
+            continue;
+
+        auto A1 = A( IR(i0,i1), IR(k,k+nb) );
+        if( orientA == NORMAL )
+        {
+            auto B1 = B( IR(k,k+nb), ALL );
+            auto C1 = C( IR(i0,i1), ALL );
+            Gemm( NORMAL, NORMAL, alpha, A1, B1, T(1), C1 );
+        }
+        else
+        {
+            auto B1 = B( IR(i0,i1), ALL );
+            auto C1 = C( IR(k,k+nb), ALL );
+            Gemm( orientA, NORMAL, alpha, A1, B1, T(1), C1 );
+        }
+    }
+}
+
+#define PROTO(T) \
+  template void BandedGemm \
+  ( Orientation orientA, Int lowerBandwidth, Int upperBandwidth, \
+    T alpha, const Matrix<T>& A, \
+             const Matrix<T>& B, \
+    T beta,        Matrix<T>& C ); \
+  template void BandedGemm \
+  ( Orientation orientA, Int lowerBandwidth, Int upperBandwidth, \
+    T alpha, const AbstractDistMatrix<T>& A, \
+             const AbstractDistMatrix<T>& B, \
+    T beta,        AbstractDistMatrix<T>& C );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
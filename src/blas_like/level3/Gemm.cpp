@@ -9,13 +9,73 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+// The conversion-based 16-bit products instantiate the mixed-type Copy
+// (and its EntrywiseMap kernel) directly, since no level1 translation unit
+// provides those combinations
+#include <El/blas_like/level1/EntrywiseKernel.hpp>
+#include <El/blas_like/level1/EntrywiseMap.hpp>
+#include <El/blas_like/level1/Copy.hpp>
+
 #include "./Gemm/NN.hpp"
+#include "./Gemm/25D.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/Strassen.hpp"
 
 namespace El {
 
+namespace {
+
+Int gemmReplication = 2;
+Int strassenCutoff = 2048;
+
+} // anonymous namespace
+
+void SetGemmReplication( Int numLayers ) { gemmReplication = numLayers; }
+Int GemmReplication() { return gemmReplication; }
+
+void SetStrassenCutoff( Int cutoff ) { strassenCutoff = cutoff; }
+Int StrassenCutoff() { return strassenCutoff; }
+
+namespace gemm {
+
+template<typename T>
+void FillRandom( DistMatrix<T>& A, Int height, Int width )
+{
+    A.Resize( height, width );
+    auto& ALoc = A.Matrix();
+    for( Int jLoc=0; jLoc<ALoc.Width(); ++jLoc )
+        for( Int iLoc=0; iLoc<ALoc.Height(); ++iLoc )
+            ALoc(iLoc,jLoc) = SampleUniform( T(0), T(2) );
+}
+
+// Returns the calibrated blocksize for this datatype and grid shape,
+// measuring one at first use when blocksize tuning is enabled
+template<typename T>
+Int TunedBlocksize( const Grid& grid )
+{
+    const string key = BlocksizeTuningKey
+      ( "Gemm", TypeName<T>(), grid.Height(), grid.Width() );
+    if( HaveTunedBlocksize( key ) )
+        return El::TunedBlocksize( key );
+    if( !BlocksizeTuningEnabled() || CalibratingBlocksize() )
+        return Blocksize();
+
+    const Int n =
+      Min( Int(256*Sqrt(double(grid.Size()))), Int(2048) );
+    DistMatrix<T> A(grid), B(grid), C(grid);
+    FillRandom( A, n, n );
+    FillRandom( B, n, n );
+    FillRandom( C, n, n );
+    return CalibrateBlocksize
+      ( key,
+        [&]() { Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C ); },
+        grid.Comm() );
+}
+
+} // namespace gemm
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -24,6 +84,7 @@ void Gemm
   T beta,        Matrix<T>& C )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Gemm");
     if( orientA == NORMAL && orientB == NORMAL )
     {
         if( A.Height() != C.Height() ||
@@ -92,15 +153,68 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A,
            const AbstractDistMatrix<T>& B,
   T beta,        AbstractDistMatrix<T>& C, 
-  GemmAlgorithm alg )
+  GemmAlgorithm alg, const TuningCtrl& tuning )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Gemm");
+    if( ProfilingEnabled() )
+    {
+        // Model the useful work from the dimensions: 2mnk real flops per
+        // multiply-accumulate, with a factor of four for complex data
+        const double m = ( orientA==NORMAL ? A.Height() : A.Width() );
+        const double k = ( orientA==NORMAL ? A.Width() : A.Height() );
+        const double n = ( orientB==NORMAL ? B.Width() : B.Height() );
+        profile::RecordFlops
+        ( ( IsComplex<T>::value ? 8. : 2. )*m*n*k );
+    }
+    // An explicitly requested blocksize takes precedence over any
+    // autotuned value
+    BlocksizeGuard nbGuard
+    ( tuning.blocksize > 0 ? tuning.blocksize
+                           : gemm::TunedBlocksize<T>( C.Grid() ) );
+    // When learning is enabled, a default-algorithm call is resolved from
+    // the performance history of its (bucketed) problem shape: unexplored
+    // SUMMA variants are tried first, and each measured time refines the
+    // record. The measurement is reduced over the grid so that every
+    // process records the same history and later makes the same choice.
+    string learnKey;
+    bool timeThisCall = false;
+    if( alg == GEMM_DEFAULT && AlgorithmLearningEnabled() &&
+        !CalibratingBlocksize() )
+    {
+        const Int m = ( orientA==NORMAL ? A.Height() : A.Width() );
+        const Int n = ( orientB==NORMAL ? B.Width() : B.Height() );
+        const Int k = ( orientA==NORMAL ? A.Width() : A.Height() );
+        const char transA = OrientationToChar( orientA );
+        const char transB = OrientationToChar( orientB );
+        learnKey = AlgorithmLearningKey
+          ( string("Gemm")+transA+transB, TypeName<T>(),
+            C.Grid().Height(), C.Grid().Width(), m, n, k );
+        bool explore;
+        alg = static_cast<GemmAlgorithm>(
+          SelectAlgorithm
+          ( learnKey,
+            vector<Int>
+            {GEMM_SUMMA_A,GEMM_SUMMA_B,GEMM_SUMMA_C,GEMM_SUMMA_DOT},
+            explore ) );
+        timeThisCall = true;
+    }
+    Timer timer;
+    if( timeThisCall )
+    {
+        mpi::Barrier( C.Grid().Comm() );
+        timer.Start();
+    }
     C *= beta;
     if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
             gemm::Cannon_NN( alpha, A, B, C );
-        else 
+        else if( alg == GEMM_SUMMA_25D )
+            gemm::SUMMA_NN25D( alpha, A, B, C, GemmReplication() );
+        else if( alg == GEMM_STRASSEN )
+            gemm::Strassen_NN( alpha, A, B, C );
+        else
             gemm::SUMMA_NN( alpha, A, B, C, alg );
     }
     else if( orientA == NORMAL )
@@ -115,6 +229,12 @@ void Gemm
     {
         gemm::SUMMA_TT( orientA, orientB, alpha, A, B, C, alg );
     }
+    if( timeThisCall )
+    {
+        const double elapsed =
+          mpi::AllReduce( timer.Stop(), mpi::MAX, C.Grid().Comm() );
+        RecordAlgorithmTime( learnKey, alg, elapsed );
+    }
 }
 
 template<typename T>
@@ -258,6 +378,60 @@ void LocalGemm
     LocalGemm( orientA, orientB, alpha, A, B, T(0), C );
 }
 
+// The 16-bit kernels widen to single precision and so cannot be offered
+// when the single-precision instantiations have been omitted
+#ifndef EL_DISABLE_FLOAT
+
+namespace {
+
+// The 16-bit storage types compute by widening to single precision, so that
+// the accumulation (and any hardware acceleration of the float kernel)
+// occurs at full precision before rounding the result back down
+template<typename T>
+void CastGemm
+( Orientation orientA, Orientation orientB,
+  float alpha, const Matrix<T>& A,
+               const Matrix<T>& B,
+  float beta,        Matrix<T>& C )
+{
+    Matrix<float> AWide, BWide, CWide;
+    Copy( A, AWide );
+    Copy( B, BWide );
+    if( beta != 0.f )
+        Copy( C, CWide );
+    else
+    {
+        CWide.Resize( C.Height(), C.Width() );
+        Zero( CWide );
+    }
+    Gemm( orientA, orientB, alpha, AWide, BWide, beta, CWide );
+    Copy( CWide, C );
+}
+
+} // anonymous namespace
+
+void Gemm
+( Orientation orientA, Orientation orientB,
+  float alpha, const Matrix<Half>& A,
+               const Matrix<Half>& B,
+  float beta,        Matrix<Half>& C )
+{
+    EL_DEBUG_CSE
+    CastGemm( orientA, orientB, alpha, A, B, beta, C );
+}
+
+void Gemm
+( Orientation orientA, Orientation orientB,
+  float alpha, const Matrix<BFloat>& A,
+               const Matrix<BFloat>& B,
+  float beta,        Matrix<BFloat>& C )
+{
+    EL_DEBUG_CSE
+    CastGemm( orientA, orientB, alpha, A, B, beta, C );
+}
+
+#endif // ifndef EL_DISABLE_FLOAT
+
 #define PROTO(T) \
   template void Gemm \
   ( Orientation orientA, Orientation orientB, \
@@ -273,7 +447,8 @@ void LocalGemm
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
-    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg, \
+    const TuningCtrl& tuning ); \
   template void Gemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
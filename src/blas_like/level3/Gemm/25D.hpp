@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// 2.5D "stationary-C" algorithm: the owning group is split into numLayers
+// contiguous layers, each of which forms its own sqrt(p/c) x sqrt(p/c)
+// process grid and computes the contribution of a contiguous slice of the
+// inner dimension. The partial products are then summed across the layers,
+// so that each layer ends up with a (redundant) copy of alpha A B, which
+// shrinks the per-process communication volume of the 2D algorithm by
+// roughly a factor of sqrt(c) at the expense of storing C (and slices of
+// A and B) c times.
+template<typename T>
+void SUMMA_NN25D
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre,
+  Int numLayers )
+{
+    EL_DEBUG_CSE
+    const Grid& g = CPre.Grid();
+    const int p = g.Size();
+    const Int c = numLayers;
+    const int layerSize = ( c > 0 ? p / int(c) : 0 );
+    const int sqrtLayer = int(sqrt(double(layerSize)));
+    if( c <= 1 || p % int(c) != 0 || sqrtLayer*sqrtLayer != layerSize )
+    {
+        // The requested layering is degenerate for this grid, so fall
+        // through to the standard 2D algorithm
+        SUMMA_NN( alpha, APre, BPre, CPre );
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int sumDim = A.Width();
+
+    // Construct the layer grids, each of which owns a contiguous block of
+    // layerSize ranks of the original owning group (and is viewed by the
+    // entire original viewing communicator)
+    vector<unique_ptr<Grid>> layerGrids(c);
+    vector<int> layerRanks(layerSize);
+    for( Int l=0; l<c; ++l )
+    {
+        for( int q=0; q<layerSize; ++q )
+            layerRanks[q] = l*layerSize + q;
+        mpi::Group layerGroup;
+        mpi::Incl
+        ( g.OwningGroup(), layerSize, layerRanks.data(), layerGroup );
+        layerGrids[l].reset
+        ( new Grid( g.ViewingComm(), layerGroup, sqrtLayer, g.Order() ) );
+        mpi::Free( layerGroup );
+    }
+    const bool inGrid = g.InGrid();
+    const int owningRank = ( inGrid ? g.OwningRank() : 0 );
+    const Int myLayer = owningRank / layerSize;
+    const Grid& myGrid = *layerGrids[myLayer];
+
+    // Scatter the inner-dimension slices of A and B over the layers.
+    // Every process participates in every translation (they are collective
+    // over the viewing communicator), but only the members of layer l
+    // receive data from the l'th slice.
+    DistMatrix<T,MC,MR> ALayer(myGrid), BLayer(myGrid);
+    for( Int l=0; l<c; ++l )
+    {
+        const Int kOff  = (l*sumDim) / c;
+        const Int kNext = ((l+1)*sumDim) / c;
+        auto Al = A( ALL, IR(kOff,kNext) );
+        auto Bl = B( IR(kOff,kNext), ALL );
+        if( inGrid && l == myLayer )
+        {
+            ALayer = Al;
+            BLayer = Bl;
+        }
+        else
+        {
+            DistMatrix<T,MC,MR> AScratch(*layerGrids[l]),
+                                BScratch(*layerGrids[l]);
+            AScratch = Al;
+            BScratch = Bl;
+        }
+    }
+
+    // Each layer independently forms its slice's contribution with a 2D
+    // algorithm over its (c times smaller) grid
+    DistMatrix<T,MC,MR> CLayer(myGrid);
+    CLayer.Resize( m, n );
+    Zero( CLayer );
+    if( inGrid )
+        SUMMA_NN( alpha, ALayer, BLayer, CLayer );
+
+    // Sum the contributions over the layers. Processes occupying the same
+    // position within their respective layers own conformal local
+    // portions of CLayer, so a direct AllReduce over each replica team
+    // suffices (and leaves every layer with a copy of the product)
+    if( inGrid )
+    {
+        const int layerRank = owningRank - myLayer*layerSize;
+        mpi::Comm replicaComm;
+        mpi::Split( g.OwningComm(), layerRank, myLayer, replicaComm );
+        mpi::AllReduce
+        ( CLayer.Buffer(), CLayer.LocalHeight()*CLayer.LocalWidth(),
+          replicaComm );
+        mpi::Free( replicaComm );
+    }
+
+    // Redistribute the (replicated) product back onto the original grid
+    // from the first layer and accumulate it into C
+    DistMatrix<T,MC,MR> CSum(g);
+    if( inGrid && myLayer == 0 )
+    {
+        CSum = CLayer;
+    }
+    else
+    {
+        DistMatrix<T,MC,MR> CRoot(*layerGrids[0]);
+        CRoot.Resize( m, n );
+        CSum = CRoot;
+    }
+    Axpy( T(1), CSum, C );
+}
+
+} // namespace gemm
+} // namespace El
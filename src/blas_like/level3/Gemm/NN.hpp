@@ -6,6 +6,7 @@
    which can be found in the LICENSE file in the root directory, or at 
    http://opensource.org/licenses/BSD-2-Clause
 */
+#include <El/blas_like/level1/Copy/util.hpp>
 
 namespace El {
 namespace gemm {
@@ -217,6 +218,129 @@ void SUMMA_NNC
     }
 }
 
+// Pipelined (double-buffered) variant of the stationary-C algorithm which
+// initiates the allgathers of panel k+1 while the local Gemm for panel k
+// is in progress, so that the panel redistributions are hidden behind the
+// local multiplications whenever the MPI implementation makes asynchronous
+// progress
+template<typename T>
+void SUMMA_NNCPipe
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // Force A and B into [MC,MR] distributions aligned with C so that the
+    // panel gathers below run over plain row/column communicators
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    const Int rowStride = A.RowStride();
+    const Int colStride = B.ColStride();
+    if( rowStride == 1 && colStride == 1 )
+    {
+        SUMMA_NNC( alpha, A, B, C );
+        return;
+    }
+    if( !C.Participating() )
+        return;
+
+    const Int localHeightA = A.LocalHeight();
+    const Int localWidthB = B.LocalWidth();
+    const Int portionA =
+      mpi::Pad( localHeightA*MaxLength(bsize,rowStride) );
+    const Int portionB =
+      mpi::Pad( MaxLength(bsize,colStride)*localWidthB );
+
+    // Double-buffered panel storage: while one stage is being multiplied,
+    // the next stage's panels are in flight
+    vector<T> sendA[2], recvA[2], sendB[2], recvB[2];
+    mpi::Request<T> reqA[2], reqB[2];
+    DistMatrix<T,MC,STAR> A1_MC_STAR[2] = { DistMatrix<T,MC,STAR>(g),
+                                            DistMatrix<T,MC,STAR>(g) };
+    DistMatrix<T,STAR,MR> B1_STAR_MR[2] = { DistMatrix<T,STAR,MR>(g),
+                                            DistMatrix<T,STAR,MR>(g) };
+    for( Int s=0; s<2; ++s )
+    {
+        FastResize( sendA[s], portionA );
+        FastResize( recvA[s], rowStride*portionA );
+        FastResize( sendB[s], portionB );
+        FastResize( recvB[s], colStride*portionB );
+        A1_MC_STAR[s].AlignWith( C );
+        B1_STAR_MR[s].AlignWith( C );
+    }
+
+    auto StartPanel = [&]( Int k, Int stage )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        auto A1 = A( ALL,        IR(k,k+nb) );
+        auto B1 = B( IR(k,k+nb), ALL        );
+
+        copy::util::InterleaveMatrix
+        ( localHeightA, A1.LocalWidth(),
+          A1.LockedBuffer(), 1, A1.LDim(),
+          sendA[stage].data(), 1, Max(localHeightA,1) );
+        mpi::IAllGather
+        ( sendA[stage].data(), portionA,
+          recvA[stage].data(), portionA, A.RowComm(), reqA[stage] );
+
+        copy::util::InterleaveMatrix
+        ( B1.LocalHeight(), localWidthB,
+          B1.LockedBuffer(), 1, B1.LDim(),
+          sendB[stage].data(), 1, Max(B1.LocalHeight(),1) );
+        mpi::IAllGather
+        ( sendB[stage].data(), portionB,
+          recvB[stage].data(), portionB, B.ColComm(), reqB[stage] );
+    };
+
+    StartPanel( 0, 0 );
+    for( Int k=0; k<sumDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        const Int stage = (k/bsize) % 2;
+        auto A1 = A( ALL,        IR(k,k+nb) );
+        auto B1 = B( IR(k,k+nb), ALL        );
+
+        // Prefetch the next panel pair before blocking on this one
+        if( k+bsize < sumDim )
+            StartPanel( k+bsize, 1-stage );
+
+        // A1[MC,*] <- gathered panel
+        mpi::Wait( reqA[stage] );
+        A1_MC_STAR[stage].Resize( A.Height(), nb );
+        copy::util::RowStridedUnpack
+        ( localHeightA, nb, A1.RowAlign(), rowStride,
+          recvA[stage].data(), portionA,
+          A1_MC_STAR[stage].Buffer(), A1_MC_STAR[stage].LDim() );
+
+        // B1[*,MR] <- gathered panel
+        mpi::Wait( reqB[stage] );
+        B1_STAR_MR[stage].Resize( nb, B.Width() );
+        copy::util::ColStridedUnpack
+        ( nb, localWidthB, B1.ColAlign(), colStride,
+          recvB[stage].data(), portionB,
+          B1_STAR_MR[stage].Buffer(), B1_STAR_MR[stage].LDim() );
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        LocalGemm
+        ( NORMAL, NORMAL,
+          alpha, A1_MC_STAR[stage], B1_STAR_MR[stage], T(1), C );
+    }
+}
+
 // Normal Normal Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -314,6 +438,7 @@ void SUMMA_NN
     case GEMM_SUMMA_A:   SUMMA_NNA( alpha, A, B, C ); break;
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
+    case GEMM_SUMMA_PIPE: SUMMA_NNCPipe( alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, blockSizeDot ); break;
     default: LogicError("Unsupported Gemm option");
     }
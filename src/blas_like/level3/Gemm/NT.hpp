@@ -248,6 +248,8 @@ void SUMMA_NT
     case GEMM_SUMMA_A: SUMMA_NTA( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
+    // TODO: Dedicated pipelined variant; stationary-C is the closest match
+    case GEMM_SUMMA_PIPE: SUMMA_NTC( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NTDot( orientB, alpha, A, B, C ); break;
     default: LogicError("Unsupported Gemm option");
     }
@@ -0,0 +1,169 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Strassen's recursion on distributed quadrant views, falling back to
+// classical SUMMA once the smallest subproblem dimension reaches the
+// cutoff. Odd dimensions are handled by recursing on the leading
+// even-order blocks and fixing up the borders with thin SUMMA updates
+// (dynamic peeling). The standard caveat applies: the recursion weakens
+// the classical componentwise error bound, which is why this path is only
+// reachable through the GEMM_STRASSEN flag.
+template<typename T>
+void StrassenProduct
+( const DistMatrix<T>& A,
+  const DistMatrix<T>& B,
+        DistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int k = A.Width();
+    const Int n = B.Width();
+    const Grid& g = A.Grid();
+    C.Resize( m, n );
+
+    if( Min(m,Min(k,n)) <= StrassenCutoff() )
+    {
+        Zero( C );
+        SUMMA_NN( T(1), A, B, C );
+        return;
+    }
+
+    const Int mH = m/2;
+    const Int kH = k/2;
+    const Int nH = n/2;
+
+    auto A11 = A( IR(0,mH),    IR(0,kH)    );
+    auto A12 = A( IR(0,mH),    IR(kH,2*kH) );
+    auto A21 = A( IR(mH,2*mH), IR(0,kH)    );
+    auto A22 = A( IR(mH,2*mH), IR(kH,2*kH) );
+
+    auto B11 = B( IR(0,kH),    IR(0,nH)    );
+    auto B12 = B( IR(0,kH),    IR(nH,2*nH) );
+    auto B21 = B( IR(kH,2*kH), IR(0,nH)    );
+    auto B22 = B( IR(kH,2*kH), IR(nH,2*nH) );
+
+    auto C11 = C( IR(0,mH),    IR(0,nH)    );
+    auto C12 = C( IR(0,mH),    IR(nH,2*nH) );
+    auto C21 = C( IR(mH,2*mH), IR(0,nH)    );
+    auto C22 = C( IR(mH,2*mH), IR(nH,2*nH) );
+
+    DistMatrix<T> S(g), R(g), M(g);
+
+    // M1 = (A11+A22)(B11+B22); C11 := M1, C22 := M1
+    S = A11; Axpy( T(1), A22, S );
+    R = B11; Axpy( T(1), B22, R );
+    StrassenProduct( S, R, M );
+    C11 = M;
+    C22 = M;
+
+    // M2 = (A21+A22) B11; C21 := M2, C22 -= M2
+    S = A21; Axpy( T(1), A22, S );
+    StrassenProduct( S, B11, M );
+    C21 = M;
+    Axpy( T(-1), M, C22 );
+
+    // M3 = A11 (B12-B22); C12 := M3, C22 += M3
+    R = B12; Axpy( T(-1), B22, R );
+    StrassenProduct( A11, R, M );
+    C12 = M;
+    Axpy( T(1), M, C22 );
+
+    // M4 = A22 (B21-B11); C11 += M4, C21 += M4
+    R = B21; Axpy( T(-1), B11, R );
+    StrassenProduct( A22, R, M );
+    Axpy( T(1), M, C11 );
+    Axpy( T(1), M, C21 );
+
+    // M5 = (A11+A12) B22; C11 -= M5, C12 += M5
+    S = A11; Axpy( T(1), A12, S );
+    StrassenProduct( S, B22, M );
+    Axpy( T(-1), M, C11 );
+    Axpy( T(1), M, C12 );
+
+    // M6 = (A21-A11)(B11+B12); C22 += M6
+    S = A21; Axpy( T(-1), A11, S );
+    R = B11; Axpy( T(1), B12, R );
+    StrassenProduct( S, R, M );
+    Axpy( T(1), M, C22 );
+
+    // M7 = (A12-A22)(B21+B22); C11 += M7
+    S = A12; Axpy( T(-1), A22, S );
+    R = B21; Axpy( T(1), B22, R );
+    StrassenProduct( S, R, M );
+    Axpy( T(1), M, C11 );
+
+    // Dynamic peeling for the odd borders
+    if( k % 2 == 1 )
+    {
+        auto aR  = A( IR(0,2*mH),  IR(2*kH,k) );
+        auto bB  = B( IR(2*kH,k),  IR(0,2*nH) );
+        auto CTL = C( IR(0,2*mH),  IR(0,2*nH) );
+        SUMMA_NN( T(1), aR, bB, CTL );
+    }
+    if( m % 2 == 1 )
+    {
+        auto AB = A( IR(2*mH,m), ALL );
+        auto CB = C( IR(2*mH,m), ALL );
+        Zero( CB );
+        SUMMA_NN( T(1), AB, B, CB );
+    }
+    if( n % 2 == 1 )
+    {
+        auto AT = A( IR(0,2*mH), ALL );
+        auto BR = B( ALL,        IR(2*nH,n) );
+        auto CR = C( IR(0,2*mH), IR(2*nH,n) );
+        Zero( CR );
+        SUMMA_NN( T(1), AT, BR, CR );
+    }
+}
+
+template<typename T>
+void Strassen_NN
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, BPre, CPre );
+      if( APre.Height() != CPre.Height() ||
+          BPre.Width() != CPre.Width() ||
+          APre.Width() != BPre.Height() )
+          LogicError
+          ("Nonconformal matrices:\n",
+           DimsString(APre,"A"),"\n",
+           DimsString(BPre,"B"),"\n",
+           DimsString(CPre,"C"));
+    )
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int sumDim = APre.Width();
+    if( Min(m,Min(n,sumDim)) <= StrassenCutoff() )
+    {
+        SUMMA_NN( alpha, APre, BPre, CPre );
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    DistMatrix<T> D( A.Grid() );
+    StrassenProduct( A, B, D );
+    Axpy( alpha, D, C );
+}
+
+} // namespace gemm
+} // namespace El
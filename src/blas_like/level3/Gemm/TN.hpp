@@ -243,6 +243,8 @@ void SUMMA_TN
     case GEMM_SUMMA_A: SUMMA_TNA( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_TNB( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_TNC( orientA, alpha, A, B, C ); break;
+    // TODO: Dedicated pipelined variant; stationary-C is the closest match
+    case GEMM_SUMMA_PIPE: SUMMA_TNC( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_TNDot( orientA, alpha, A, B, C ); break;
     default: LogicError("Unsupported Gemm option");
     }
@@ -266,6 +266,10 @@ void SUMMA_TT
     case GEMM_SUMMA_C:
         SUMMA_TTC( orientA, orientB, alpha, A, B, C );
         break;
+    // TODO: Dedicated pipelined variant; stationary-C is the closest match
+    case GEMM_SUMMA_PIPE:
+        SUMMA_TTC( orientA, orientB, alpha, A, B, C );
+        break;
     case GEMM_SUMMA_DOT:
         SUMMA_TTDot( orientA, orientB, alpha, A, B, C );
         break;
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
 #include <El/blas_like/level3.hpp>
 
 namespace El {
@@ -36,9 +37,11 @@ template<typename T>
 void Herk
 ( UpperOrLower uplo, Orientation orientation,
   Base<T> alpha, const AbstractDistMatrix<T>& A, 
-  Base<T> beta,        AbstractDistMatrix<T>& C )
+  Base<T> beta,        AbstractDistMatrix<T>& C,
+  const TuningCtrl& tuning )
 {
     EL_DEBUG_CSE
+    BlocksizeGuard nbGuard( tuning.blocksize );
     Syrk( uplo, orientation, T(alpha), A, T(beta), C, true );
 }
 
@@ -94,7 +97,100 @@ void Herk
     Syrk( uplo, orientation, T(alpha), A, C, true );
 }
 
+template<typename T>
+HerkAccumulator<T>::HerkAccumulator()
+{ }
+
+template<typename T>
+HerkAccumulator<T>::HerkAccumulator
+( UpperOrLower uplo, Orientation orientation, Int n, const Grid& grid,
+  bool conjugate )
+{ Initialize( uplo, orientation, n, grid, conjugate ); }
+
+template<typename T>
+void HerkAccumulator<T>::Initialize
+( UpperOrLower uplo, Orientation orientation, Int n, const Grid& grid,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    uplo_ = uplo;
+    orientation_ = orientation;
+    conjugate_ = conjugate;
+    C_.SetGrid( grid );
+    C_.Resize( n, n );
+    Zero( C_ );
+    initialized_ = true;
+}
+
+template<typename T>
+void HerkAccumulator<T>::Accumulate
+( Base<T> alpha, const AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The accumulator was not initialized");
+    EL_DEBUG_ONLY(
+      const Int n = ( orientation_==NORMAL ? A.Height() : A.Width() );
+      if( n != C_.Height() )
+          LogicError("A did not conform with the accumulator");
+      if( !mpi::Congruent( A.Grid().Comm(), C_.Grid().Comm() ) )
+          LogicError("A was not distributed over the accumulator's grid");
+    )
+    // Since C is already in the [MC,MR] distribution which Syrk's variants
+    // work in, the read-write proxy inside is a no-op and beta=1 skips the
+    // trapezoidal scaling, so each batch only redistributes A
+    Syrk( uplo_, orientation_, T(alpha), A, T(1), C_, conjugate_ );
+}
+
+template<typename T>
+void HerkAccumulator<T>::Materialize
+( Base<T> alpha, Base<T> beta, AbstractDistMatrix<T>& C ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The accumulator was not initialized");
+    const Int n = C_.Height();
+    if( beta == Base<T>(0) )
+    {
+        Copy( C_, C );
+        ScaleTrapezoid( alpha, uplo_, C );
+    }
+    else
+    {
+        if( C.Height() != n || C.Width() != n )
+            LogicError("C was of the incorrect size");
+        DistMatrixReadWriteProxy<T,T,MC,MR> CProx( C );
+        auto& CView = CProx.Get();
+        ScaleTrapezoid( beta, uplo_, CView );
+        AxpyTrapezoid( uplo_, T(alpha), C_, CView );
+    }
+}
+
+template<typename T>
+void HerkAccumulator<T>::Materialize( AbstractDistMatrix<T>& C ) const
+{
+    EL_DEBUG_CSE
+    Materialize( Base<T>(1), Base<T>(0), C );
+}
+
+template<typename T>
+Int HerkAccumulator<T>::Height() const EL_NO_EXCEPT
+{ return C_.Height(); }
+
+template<typename T>
+bool HerkAccumulator<T>::Initialized() const EL_NO_EXCEPT
+{ return initialized_; }
+
+template<typename T>
+void HerkAccumulator<T>::Clear()
+{
+    EL_DEBUG_CSE
+    C_.Empty();
+    initialized_ = false;
+}
+
 #define PROTO(T) \
+  template class HerkAccumulator<T>; \
   template void Herk \
   ( UpperOrLower uplo, Orientation orientation, \
     Base<T> alpha, const Matrix<T>& A, \
@@ -108,7 +204,8 @@ void Herk
   template void Herk \
   ( UpperOrLower uplo, Orientation orientation, \
     Base<T> alpha, const AbstractDistMatrix<T>& A, \
-    Base<T> beta,        AbstractDistMatrix<T>& C ); \
+    Base<T> beta,        AbstractDistMatrix<T>& C, \
+    const TuningCtrl& tuning ); \
   template void Herk \
   ( UpperOrLower uplo, Orientation orientation, \
     Base<T> alpha, const SparseMatrix<T>& A, \
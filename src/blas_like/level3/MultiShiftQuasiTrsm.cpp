@@ -83,6 +83,53 @@ void MultiShiftQuasiTrsm
     }
 }
 
+template<typename Field>
+void MultiShiftQuasiTrsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  Field alpha,
+  const Matrix<Field>& A,
+  const vector<const Matrix<Field>*>& shiftGroups,
+  const vector<Matrix<Field>*>& BGroups )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( shiftGroups.size() != BGroups.size() )
+          LogicError("Each shift group must have a right-hand side group");
+      for( size_t g=0; g<BGroups.size(); ++g )
+      {
+          if( shiftGroups[g] == nullptr || BGroups[g] == nullptr )
+              LogicError("Group ",g," had a null member");
+          if( A.Height() != BGroups[g]->Height() )
+              LogicError("Group ",g," was nonconformal");
+          if( shiftGroups[g]->Height() != BGroups[g]->Width() )
+              LogicError("Group ",g," had a mismatched number of shifts");
+      }
+    )
+    for( auto* B : BGroups )
+        *B *= alpha;
+
+    if( side == LEFT && uplo == LOWER )
+    {
+        if( orientation == NORMAL )
+            msquasitrsm::LLNGrouped( A, shiftGroups, BGroups );
+        else
+            msquasitrsm::LLTGrouped( orientation, A, shiftGroups, BGroups );
+    }
+    else if( side == LEFT && uplo == UPPER )
+    {
+        if( orientation == NORMAL )
+            msquasitrsm::LUNGrouped( A, shiftGroups, BGroups );
+        else
+            msquasitrsm::LUTGrouped( orientation, A, shiftGroups, BGroups );
+    }
+    else
+        LogicError("This case not yet handled");
+}
+
 template<typename Real>
 void MultiShiftQuasiTrsm
 ( LeftOrRight side,
@@ -409,6 +456,14 @@ void LocalMultiShiftQuasiTrsm
     const Matrix<Field>& shifts, \
           Matrix<Field>& B ); \
   template void MultiShiftQuasiTrsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    Field alpha, \
+    const Matrix<Field>& A, \
+    const vector<const Matrix<Field>*>& shiftGroups, \
+    const vector<Matrix<Field>*>& BGroups ); \
+  template void MultiShiftQuasiTrsm \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
     Orientation orientation, \
@@ -114,6 +114,42 @@ void LLN( const Matrix<F>& L, const Matrix<F>& shifts, Matrix<F>& X )
     }
 }
 
+// Advance every shift group through each panel of L while it is resident,
+// so that L is only streamed from memory once for the entire collection
+template<typename F>
+void LLNGrouped
+( const Matrix<F>& L,
+  const vector<const Matrix<F>*>& shiftGroups,
+  const vector<Matrix<F>*>& XGroups )
+{
+    EL_DEBUG_CSE
+    const Int m = L.Height();
+    const Int bsize = Blocksize();
+    const Int numGroups = shiftGroups.size();
+
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nbProp = Min(bsize,m-k);
+        const bool in2x2 = ( k+nbProp<m && L.Get(k+nbProp-1,k+nbProp) != F(0) );
+        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, m    );
+
+        auto L11 = L( ind1, ind1 );
+        auto L21 = L( ind2, ind1 );
+
+        for( Int g=0; g<numGroups; ++g )
+        {
+            auto& X = *XGroups[g];
+            auto X1 = X( ind1, ALL );
+            auto X2 = X( ind2, ALL );
+            LLNUnb( L11, *shiftGroups[g], X1 );
+            Gemm( NORMAL, NORMAL, F(-1), L21, X1, F(1), X2 );
+        }
+    }
+}
+
 // For large numbers of RHS's, e.g., width(X) >> p
 template<typename F>
 void LLNLarge
@@ -137,6 +137,64 @@ void LLT
         Conjugate( X );
 }
 
+// Advance every shift group through each panel of L while it is resident,
+// so that L is only streamed from memory once for the entire collection
+template<typename F>
+void LLTGrouped
+( Orientation orientation,
+  const Matrix<F>& L,
+  const vector<const Matrix<F>*>& shiftGroups,
+  const vector<Matrix<F>*>& XGroups )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( orientation == NORMAL )
+          LogicError("Expected (Conjugate)Transpose option");
+    )
+    const Int m = L.Height();
+    const Int bsize = Blocksize();
+    const Int numGroups = shiftGroups.size();
+
+    const bool conjugate = ( orientation==ADJOINT );
+    if( conjugate )
+        for( Int g=0; g<numGroups; ++g )
+            Conjugate( *XGroups[g] );
+
+    const Int kLast = LastOffset( m, bsize );
+    Int k=kLast, kOld=m;
+    while( true )
+    {
+        const bool in2x2 = ( k>0 && L.Get(k-1,k) != F(0) );
+        if( in2x2 )
+            --k;
+        const Int nb = kOld-k;
+
+        const Range<Int> ind0( 0, k    ),
+                         ind1( k, k+nb );
+
+        auto L10 = L( ind1, ind0 );
+        auto L11 = L( ind1, ind1 );
+
+        for( Int g=0; g<numGroups; ++g )
+        {
+            auto& X = *XGroups[g];
+            auto X0 = X( ind0, ALL );
+            auto X1 = X( ind1, ALL );
+            LLTUnb( false, L11, *shiftGroups[g], X1 );
+            Gemm( TRANSPOSE, NORMAL, F(-1), L10, X1, F(1), X0 );
+        }
+
+        if( k == 0 )
+            break;
+        kOld = k;
+        k -= Min(bsize,k);
+    }
+
+    if( conjugate )
+        for( Int g=0; g<numGroups; ++g )
+            Conjugate( *XGroups[g] );
+}
+
 // width(X) >> p
 template<typename F>
 void LLTLarge
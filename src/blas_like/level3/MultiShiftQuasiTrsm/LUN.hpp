@@ -232,6 +232,50 @@ void LUN( const Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X )
     }
 }
 
+// Advance every shift group through each panel of U while it is resident,
+// so that U is only streamed from memory once for the entire collection
+template<typename F>
+void LUNGrouped
+( const Matrix<F>& U,
+  const vector<const Matrix<F>*>& shiftGroups,
+  const vector<Matrix<F>*>& XGroups )
+{
+    EL_DEBUG_CSE
+    const Int m = U.Height();
+    const Int bsize = Blocksize();
+    const Int numGroups = shiftGroups.size();
+
+    const Int kLast = LastOffset( m, bsize );
+    Int k=kLast, kOld=m;
+    while( true )
+    {
+        const bool in2x2 = ( k>0 && U.Get(k,k-1) != F(0) );
+        if( in2x2 )
+            --k;
+        const Int nb = kOld-k;
+
+        const Range<Int> ind0( 0, k    ),
+                         ind1( k, k+nb );
+
+        auto U01 = U( ind0, ind1 );
+        auto U11 = U( ind1, ind1 );
+
+        for( Int g=0; g<numGroups; ++g )
+        {
+            auto& X = *XGroups[g];
+            auto X0 = X( ind0, ALL );
+            auto X1 = X( ind1, ALL );
+            LUNUnb( U11, *shiftGroups[g], X1 );
+            Gemm( NORMAL, NORMAL, F(-1), U01, X1, F(1), X0 );
+        }
+
+        if( k == 0 )
+            break;
+        kOld = k;
+        k -= Min(bsize,k);
+    }
+}
+
 template<typename Real>
 void LUN
 ( const Matrix<Real>& U, const Matrix<Complex<Real>>& shifts, 
@@ -241,6 +241,56 @@ void LUT
         Conjugate( X );
 }
 
+// Advance every shift group through each panel of U while it is resident,
+// so that U is only streamed from memory once for the entire collection
+template<typename F>
+void LUTGrouped
+( Orientation orientation,
+  const Matrix<F>& U,
+  const vector<const Matrix<F>*>& shiftGroups,
+  const vector<Matrix<F>*>& XGroups )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( orientation == NORMAL )
+          LogicError("QuasiTrsmLUT expects a (Conjugate)Transpose option");
+    )
+    const Int m = U.Height();
+    const Int bsize = Blocksize();
+    const Int numGroups = shiftGroups.size();
+
+    const bool conjugate = ( orientation==ADJOINT );
+    if( conjugate )
+        for( Int g=0; g<numGroups; ++g )
+            Conjugate( *XGroups[g] );
+
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nbProp = Min(bsize,m-k);
+        const bool in2x2 = ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != F(0) );
+        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, m    );
+
+        auto U11 = U( ind1, ind1 );
+        auto U12 = U( ind1, ind2 );
+
+        for( Int g=0; g<numGroups; ++g )
+        {
+            auto& X = *XGroups[g];
+            auto X1 = X( ind1, ALL );
+            auto X2 = X( ind2, ALL );
+            LUTUnb( false, U11, *shiftGroups[g], X1 );
+            Gemm( TRANSPOSE, NORMAL, F(-1), U12, X1, F(1), X2 );
+        }
+    }
+
+    if( conjugate )
+        for( Int g=0; g<numGroups; ++g )
+            Conjugate( *XGroups[g] );
+}
+
 template<typename Real>
 void LUT
 ( Orientation orientation, 
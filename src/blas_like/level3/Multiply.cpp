@@ -14,6 +14,14 @@
 namespace El {
 
 namespace {
+
+// The number of right-hand sides formed per pass over the sparse matrix in
+// the multi-vector kernels below: a strip of this width fits in registers
+// and yields a short, fixed-length inner loop for the vectorizer, while the
+// matrix itself is only streamed ceil(numRHS/spmmWidthBlock) times rather
+// than once per right-hand side
+const Int spmmWidthBlock = 8;
+
 /**
  * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
  */
@@ -134,12 +142,22 @@ void MultiplyCSR
     {
         for( Int i=0; i<m; ++i )
         {
-            T sum = 0;
             const Int eStart = rowOffsets[i];
             const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
+            // Four independent accumulators break the additive dependence
+            // chain so that the gather loop can be pipelined and vectorized
+            T sum0=0, sum1=0, sum2=0, sum3=0;
+            Int e=eStart;
+            for( ; e+4<=eStop; e+=4 )
+            {
+                sum0 += values[e  ]*x[colIndices[e  ]];
+                sum1 += values[e+1]*x[colIndices[e+1]];
+                sum2 += values[e+2]*x[colIndices[e+2]];
+                sum3 += values[e+3]*x[colIndices[e+3]];
+            }
+            for( ; e<eStop; ++e )
+                sum0 += values[e]*x[colIndices[e]];
+            y[i] = alpha*((sum0+sum1)+(sum2+sum3)) + beta*y[i];
         }
     }
     else
@@ -194,16 +212,28 @@ void MultiplyCSR
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        // Form each strip of right-hand sides in a single pass over the
+        // matrix rather than rescanning it once per right-hand side
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=spmmWidthBlock )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int bw = Min( spmmWidthBlock, numRHS-kBeg );
+            for( Int i=0; i<m; ++i )
             {
-                T sum = 0;
+                T sums[spmmWidthBlock];
+                for( Int k=0; k<bw; ++k )
+                    sums[k] = 0;
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
+                {
+                    const T value = values[e];
+                    const T* xRow = &X[colIndices[e]+kBeg*ldX];
+                    for( Int k=0; k<bw; ++k )
+                        sums[k] += value*xRow[k*ldX];
+                }
+                for( Int k=0; k<bw; ++k )
+                    Y[i+(kBeg+k)*ldY] =
+                      alpha*sums[k] + beta*Y[i+(kBeg+k)*ldY];
             }
         }
     }
@@ -266,16 +296,27 @@ void MultiplyCSR
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        // Form each strip of right-hand sides in a single pass over the
+        // matrix rather than rescanning it once per right-hand side
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=spmmWidthBlock )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int bw = Min( spmmWidthBlock, numRHS-kBeg );
+            for( Int i=0; i<m; ++i )
             {
-                T sum = 0;
+                T sums[spmmWidthBlock];
+                for( Int k=0; k<bw; ++k )
+                    sums[k] = 0;
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
+                {
+                    const T* xRow = &X[colIndices[e]+kBeg*ldX];
+                    for( Int k=0; k<bw; ++k )
+                        sums[k] += xRow[k*ldX];
+                }
+                for( Int k=0; k<bw; ++k )
+                    Y[i+(kBeg+k)*ldY] =
+                      alpha*sums[k] + beta*Y[i+(kBeg+k)*ldY];
             }
         }
     }
@@ -322,16 +363,29 @@ void MultiplyCSRInterX
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        // X is interleaved by right-hand side, so each strip of the width is
+        // accumulated with contiguous, vectorizable inner loops in a single
+        // pass over the matrix
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=spmmWidthBlock )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int bw = Min( spmmWidthBlock, numRHS-kBeg );
+            for( Int i=0; i<m; ++i )
             {
-                T sum = 0;
+                T sums[spmmWidthBlock];
+                for( Int k=0; k<bw; ++k )
+                    sums[k] = 0;
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
+                {
+                    const T value = values[e];
+                    const T* xRow = &X[colIndices[e]*numRHS+kBeg];
+                    for( Int k=0; k<bw; ++k )
+                        sums[k] += value*xRow[k];
+                }
+                for( Int k=0; k<bw; ++k )
+                    Y[i+(kBeg+k)*ldY] =
+                      alpha*sums[k] + beta*Y[i+(kBeg+k)*ldY];
             }
         }
     }
@@ -395,16 +449,29 @@ void MultiplyCSRInterY
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        // Form each strip of right-hand sides in a single pass over the
+        // matrix, storing each row's accumulators contiguously into the
+        // interleaved Y
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=spmmWidthBlock )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int bw = Min( spmmWidthBlock, numRHS-kBeg );
+            for( Int i=0; i<m; ++i )
             {
-                T sum = 0;
+                T sums[spmmWidthBlock];
+                for( Int k=0; k<bw; ++k )
+                    sums[k] = 0;
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
+                {
+                    const T value = values[e];
+                    const T* xRow = &X[colIndices[e]+kBeg*ldX];
+                    for( Int k=0; k<bw; ++k )
+                        sums[k] += value*xRow[k*ldX];
+                }
+                T* yRow = &Y[i*numRHS+kBeg];
+                for( Int k=0; k<bw; ++k )
+                    yRow[k] = alpha*sums[k] + beta*yRow[k];
             }
         }
     }
@@ -468,16 +535,29 @@ void MultiplyCSRInter
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        // Both X and Y are interleaved by right-hand side, so each strip of
+        // the width is both gathered and stored contiguously in a single
+        // pass over the matrix
+        for( Int kBeg=0; kBeg<numRHS; kBeg+=spmmWidthBlock )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int bw = Min( spmmWidthBlock, numRHS-kBeg );
+            for( Int i=0; i<m; ++i )
             {
-                T sum = 0;
+                T sums[spmmWidthBlock];
+                for( Int k=0; k<bw; ++k )
+                    sums[k] = 0;
                 const Int eStart = rowOffsets[i];
                 const Int eStop = rowOffsets[i+1];
                 for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
+                {
+                    const T value = values[e];
+                    const T* xRow = &X[colIndices[e]*numRHS+kBeg];
+                    for( Int k=0; k<bw; ++k )
+                        sums[k] += value*xRow[k];
+                }
+                T* yRow = &Y[i*numRHS+kBeg];
+                for( Int k=0; k<bw; ++k )
+                    yRow[k] = alpha*sums[k] + beta*yRow[k];
             }
         }
     }
@@ -518,6 +598,109 @@ void MultiplyCSRInter
     }
 }
 
+// Fetch the requested rows of a [VC,* ] matrix into an interleaved buffer:
+// request r (which must be grouped by owning rank) becomes entries
+// [r*b,(r+1)*b) of 'reqVals'
+template<typename T>
+void FetchRows
+( const DistMatrix<T,VC,STAR>& X,
+  const vector<Int>& reqInds,
+  const vector<int>& reqSizes,
+  const vector<int>& reqOffs,
+        vector<T>& reqVals )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = X.ColComm();
+    const int commSize = mpi::Size( comm );
+    const Int b = X.Width();
+
+    // Ask each owner for the rows we need
+    vector<int> fulfillSizes( commSize );
+    mpi::AllToAll( reqSizes.data(), 1, fulfillSizes.data(), 1, comm );
+    vector<int> fulfillOffs;
+    const int totalFulfills = Scan( fulfillSizes, fulfillOffs );
+    vector<Int> fulfillInds( totalFulfills );
+    mpi::AllToAll
+    ( reqInds.data(), reqSizes.data(), reqOffs.data(),
+      fulfillInds.data(), fulfillSizes.data(), fulfillOffs.data(), comm );
+
+    // Pack the requested rows
+    vector<T> fulfillVals;
+    FastResize( fulfillVals, totalFulfills*b );
+    const T* XBuf = X.LockedBuffer();
+    const Int ldX = X.LDim();
+    for( int s=0; s<totalFulfills; ++s )
+    {
+        const Int iLoc = X.LocalRow( fulfillInds[s] );
+        for( Int t=0; t<b; ++t )
+            fulfillVals[s*b+t] = XBuf[iLoc+t*ldX];
+    }
+
+    // Return them over the widened exchange
+    vector<int> reqValSizes=reqSizes, reqValOffs=reqOffs,
+                fulfillValSizes=fulfillSizes, fulfillValOffs=fulfillOffs;
+    for( int q=0; q<commSize; ++q )
+    {
+        reqValSizes[q] *= b;
+        reqValOffs[q] *= b;
+        fulfillValSizes[q] *= b;
+        fulfillValOffs[q] *= b;
+    }
+    FastResize( reqVals, Int(reqInds.size())*b );
+    mpi::AllToAll
+    ( fulfillVals.data(), fulfillValSizes.data(), fulfillValOffs.data(),
+      reqVals.data(), reqValSizes.data(), reqValOffs.data(), comm );
+}
+
+// Accumulate interleaved row updates (grouped by owning rank) onto a
+// [VC,* ] matrix
+template<typename T>
+void ScatterAddRows
+( const vector<Int>& outInds,
+  const vector<int>& outSizes,
+  const vector<int>& outOffs,
+  const vector<T>& outVals,
+        DistMatrix<T,VC,STAR>& Y )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = Y.ColComm();
+    const int commSize = mpi::Size( comm );
+    const Int b = Y.Width();
+
+    vector<int> inSizes( commSize );
+    mpi::AllToAll( outSizes.data(), 1, inSizes.data(), 1, comm );
+    vector<int> inOffs;
+    const int totalIn = Scan( inSizes, inOffs );
+    vector<Int> inInds( totalIn );
+    mpi::AllToAll
+    ( outInds.data(), outSizes.data(), outOffs.data(),
+      inInds.data(), inSizes.data(), inOffs.data(), comm );
+
+    vector<int> outValSizes=outSizes, outValOffs=outOffs,
+                inValSizes=inSizes, inValOffs=inOffs;
+    for( int q=0; q<commSize; ++q )
+    {
+        outValSizes[q] *= b;
+        outValOffs[q] *= b;
+        inValSizes[q] *= b;
+        inValOffs[q] *= b;
+    }
+    vector<T> inVals;
+    FastResize( inVals, totalIn*b );
+    mpi::AllToAll
+    ( outVals.data(), outValSizes.data(), outValOffs.data(),
+      inVals.data(), inValSizes.data(), inValOffs.data(), comm );
+
+    T* YBuf = Y.Buffer();
+    const Int ldY = Y.LDim();
+    for( int s=0; s<totalIn; ++s )
+    {
+        const Int iLoc = Y.LocalRow( inInds[s] );
+        for( Int t=0; t<b; ++t )
+            YBuf[iLoc+t*ldY] += inVals[s*b+t];
+    }
+}
+
 } // anonymous namespace
 
 template<typename T>
@@ -559,6 +742,102 @@ void Multiply
       beta,  Y.Buffer(), Y.LDim());
 }
 
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const BSRMatrix<T>& A, const Matrix<T>& X,
+  T beta,                               Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( X.Width() != Y.Width() )
+          LogicError("X and Y must have the same width");
+      A.AssertConsistent();
+    )
+    const Int blockHeight = A.BlockHeight();
+    const Int blockWidth = A.BlockWidth();
+    const Int blockSize = blockHeight*blockWidth;
+    const Int numBlockRows = A.NumBlockRows();
+    const Int numRHS = X.Width();
+    const Int* offsets = A.LockedOffsetBuffer();
+    const Int* blockCols = A.LockedBlockColBuffer();
+    const T* vals = A.LockedValueBuffer();
+    const T* XBuf = X.LockedBuffer();
+    const Int ldX = X.LDim();
+    T* YBuf = Y.Buffer();
+    const Int ldY = Y.LDim();
+
+    if( orientation == NORMAL )
+    {
+        vector<T> sums( blockHeight );
+        for( Int k=0; k<numRHS; ++k )
+        {
+            const T* x = &XBuf[k*ldX];
+            T* y = &YBuf[k*ldY];
+            for( Int I=0; I<numBlockRows; ++I )
+            {
+                for( Int ii=0; ii<blockHeight; ++ii )
+                    sums[ii] = 0;
+                const Int tStart = offsets[I];
+                const Int tStop = offsets[I+1];
+                for( Int t=tStart; t<tStop; ++t )
+                {
+                    const T* B = &vals[t*blockSize];
+                    const T* xBlock = &x[blockCols[t]*blockWidth];
+                    // The column-major block turns the update into
+                    // blockWidth contiguous AXPYs of length blockHeight,
+                    // which remain in registers for small blocks
+                    for( Int jj=0; jj<blockWidth; ++jj )
+                    {
+                        const T chi = xBlock[jj];
+                        for( Int ii=0; ii<blockHeight; ++ii )
+                            sums[ii] += B[ii+jj*blockHeight]*chi;
+                    }
+                }
+                T* yBlock = &y[I*blockHeight];
+                for( Int ii=0; ii<blockHeight; ++ii )
+                    yBlock[ii] = alpha*sums[ii] + beta*yBlock[ii];
+            }
+        }
+    }
+    else
+    {
+        const bool conj = ( orientation == ADJOINT );
+        const Int n = A.Width();
+        for( Int k=0; k<numRHS; ++k )
+            for( Int j=0; j<n; ++j )
+                YBuf[j+k*ldY] *= beta;
+        for( Int k=0; k<numRHS; ++k )
+        {
+            const T* x = &XBuf[k*ldX];
+            T* y = &YBuf[k*ldY];
+            for( Int I=0; I<numBlockRows; ++I )
+            {
+                const T* xBlock = &x[I*blockHeight];
+                const Int tStart = offsets[I];
+                const Int tStop = offsets[I+1];
+                for( Int t=tStart; t<tStop; ++t )
+                {
+                    const T* B = &vals[t*blockSize];
+                    T* yBlock = &y[blockCols[t]*blockWidth];
+                    // Each column of the block contributes a short dot
+                    // product against the source block of x
+                    for( Int jj=0; jj<blockWidth; ++jj )
+                    {
+                        T sum = 0;
+                        if( conj )
+                            for( Int ii=0; ii<blockHeight; ++ii )
+                                sum += Conj(B[ii+jj*blockHeight])*xBlock[ii];
+                        else
+                            for( Int ii=0; ii<blockHeight; ++ii )
+                                sum += B[ii+jj*blockHeight]*xBlock[ii];
+                        yBlock[jj] += alpha*sum;
+                    }
+                }
+            }
+        }
+    }
+}
 
 template<typename T>
 void Multiply
@@ -694,6 +973,774 @@ void Multiply
         Output("Multiply total time: ",totalTimer.Stop());
 }
 
+template<typename T>
+void MultiplyTranspose
+(       T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistMultiVec<T>& X,
+        T beta,
+        DistMultiVec<T>& Y,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    Multiply( orientation, alpha, A, X, beta, Y );
+}
+
+// A native sparse-dense product with the dense operand cyclically
+// distributed as [VC,* ]: the rows of X referenced by the local sparse
+// entries are gathered with a single aggregated exchange (one message per
+// neighboring process, independent of the width), the local product is
+// formed over the distinct columns via the multiplication metadata, and the
+// block of product rows is scattered back onto the cyclic distribution --
+// no reformatting of either operand is ever performed
+template<typename T>
+void Multiply
+( Orientation orientation,
+        T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistMatrix<T,VC,STAR>& X,
+        T beta,
+        DistMatrix<T,VC,STAR>& Y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( X.Width() != Y.Width() )
+          LogicError("X and Y must have the same width");
+      if( !mpi::Congruent( X.ColComm(), Y.ColComm() ) )
+          LogicError("Communicators did not match");
+    )
+    const Int b = X.Width();
+    const int commSize = mpi::Size( X.ColComm() );
+
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    const Int mLoc = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* targetBuf = A.LockedTargetBuffer();
+
+    // The distinct global columns referenced by the local entries, in the
+    // slot order assigned by the multiplication metadata
+    vector<Int> colInds( meta.numRecvInds );
+    for( Int e=0; e<numLocalEntries; ++e )
+        colInds[meta.colOffs[e]] = targetBuf[e];
+
+    // Y := beta Y
+    Y *= beta;
+
+    if( orientation == NORMAL )
+    {
+        if( A.Height() != Y.Height() )
+            LogicError("A and Y must have the same height");
+        if( A.Width() != X.Height() )
+            LogicError("The width of A must match the height of X");
+
+        // Group the needed rows of X by their round-robin owner
+        vector<int> reqSizes( commSize, 0 );
+        for( Int s=0; s<meta.numRecvInds; ++s )
+            ++reqSizes[ X.RowOwner(colInds[s]) ];
+        vector<int> reqOffs;
+        Scan( reqSizes, reqOffs );
+        vector<Int> reqInds( meta.numRecvInds );
+        vector<Int> slotPositions( meta.numRecvInds );
+        {
+            auto offs = reqOffs;
+            for( Int s=0; s<meta.numRecvInds; ++s )
+            {
+                const int q = X.RowOwner(colInds[s]);
+                slotPositions[s] = offs[q];
+                reqInds[offs[q]++] = colInds[s];
+            }
+        }
+        vector<T> reqVals;
+        FetchRows( X, reqInds, reqSizes, reqOffs, reqVals );
+
+        // Arrange the fetched rows into slot order
+        vector<T> XLoc;
+        FastResize( XLoc, meta.numRecvInds*b );
+        for( Int s=0; s<meta.numRecvInds; ++s )
+            for( Int t=0; t<b; ++t )
+                XLoc[s*b+t] = reqVals[slotPositions[s]*b+t];
+
+        // Form our block of rows of the product
+        vector<T> ZLoc( mLoc*b, 0 );
+        MultiplyCSRInter
+        ( NORMAL, mLoc, meta.numRecvInds, b,
+          alpha, A.LockedOffsetBuffer(),
+                 meta.colOffs.data(),
+                 A.LockedValueBuffer(),
+                 XLoc.data(),
+          T(1),  ZLoc.data() );
+
+        // Scatter our block of product rows onto the cyclic Y
+        vector<int> outSizes( commSize, 0 );
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            ++outSizes[ Y.RowOwner(firstLocalRow+iLoc) ];
+        vector<int> outOffs;
+        Scan( outSizes, outOffs );
+        vector<Int> outInds( mLoc );
+        vector<T> outVals;
+        FastResize( outVals, mLoc*b );
+        {
+            auto offs = outOffs;
+            for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            {
+                const int q = Y.RowOwner(firstLocalRow+iLoc);
+                outInds[offs[q]] = firstLocalRow+iLoc;
+                for( Int t=0; t<b; ++t )
+                    outVals[offs[q]*b+t] = ZLoc[iLoc*b+t];
+                ++offs[q];
+            }
+        }
+        ScatterAddRows( outInds, outSizes, outOffs, outVals, Y );
+    }
+    else
+    {
+        if( A.Width() != Y.Height() )
+            LogicError("The width of A must match the height of Y");
+        if( A.Height() != X.Height() )
+            LogicError("The height of A must match the height of X");
+
+        // Gather the rows of X matching our block of rows of A
+        vector<int> reqSizes( commSize, 0 );
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            ++reqSizes[ X.RowOwner(firstLocalRow+iLoc) ];
+        vector<int> reqOffs;
+        Scan( reqSizes, reqOffs );
+        vector<Int> reqInds( mLoc );
+        vector<Int> rowPositions( mLoc );
+        {
+            auto offs = reqOffs;
+            for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            {
+                const int q = X.RowOwner(firstLocalRow+iLoc);
+                rowPositions[iLoc] = offs[q];
+                reqInds[offs[q]++] = firstLocalRow+iLoc;
+            }
+        }
+        vector<T> reqVals;
+        FetchRows( X, reqInds, reqSizes, reqOffs, reqVals );
+        vector<T> XLoc;
+        FastResize( XLoc, mLoc*b );
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            for( Int t=0; t<b; ++t )
+                XLoc[iLoc*b+t] = reqVals[rowPositions[iLoc]*b+t];
+
+        // Form the updates to the distinct columns referenced locally
+        vector<T> ZLoc( meta.numRecvInds*b, 0 );
+        MultiplyCSRInter
+        ( orientation, mLoc, meta.numRecvInds, b,
+          alpha, A.LockedOffsetBuffer(),
+                 meta.colOffs.data(),
+                 A.LockedValueBuffer(),
+                 XLoc.data(),
+          T(1),  ZLoc.data() );
+
+        // Scatter the updates onto the cyclic Y
+        vector<int> outSizes( commSize, 0 );
+        for( Int s=0; s<meta.numRecvInds; ++s )
+            ++outSizes[ Y.RowOwner(colInds[s]) ];
+        vector<int> outOffs;
+        Scan( outSizes, outOffs );
+        vector<Int> outInds( meta.numRecvInds );
+        vector<T> outVals;
+        FastResize( outVals, meta.numRecvInds*b );
+        {
+            auto offs = outOffs;
+            for( Int s=0; s<meta.numRecvInds; ++s )
+            {
+                const int q = Y.RowOwner(colInds[s]);
+                outInds[offs[q]] = colInds[s];
+                for( Int t=0; t<b; ++t )
+                    outVals[offs[q]*b+t] = ZLoc[s*b+t];
+                ++offs[q];
+            }
+        }
+        ScatterAddRows( outInds, outSizes, outOffs, outVals, Y );
+    }
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+        T alpha,
+  const DistSparseMatrix<T>& A,
+  const AbstractDistMatrix<T>& XPre,
+        T beta,
+        AbstractDistMatrix<T>& YPre )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<T,T,VC,STAR> XProx( XPre );
+    DistMatrixReadWriteProxy<T,T,VC,STAR> YProx( YPre );
+    Multiply( orientation, alpha, A, XProx.GetLocked(), beta, YProx.Get() );
+}
+
+template<typename T>
+DistSparseMultPlan<T>::DistSparseMultPlan()
+{ }
+
+template<typename T>
+DistSparseMultPlan<T>::DistSparseMultPlan
+( const DistSparseMatrix<T>& A, Int width )
+{ Build( A, width ); }
+
+template<typename T>
+DistSparseMultPlan<T>::~DistSparseMultPlan()
+{
+    // Static-lifetime plans may outlive MPI
+    if( !mpi::Finalized() )
+        Clear();
+}
+
+template<typename T>
+void DistSparseMultPlan<T>::Build
+( const DistSparseMatrix<T>& A, Int width )
+{
+    EL_DEBUG_CSE
+    Clear();
+    A_ = &A;
+    width_ = width;
+
+    const Grid& grid = A.Grid();
+    const int commSize = grid.Size();
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+
+    // Convert the sizes and offsets to be compatible with the width
+    sendSizes_ = meta.sendSizes;
+    sendOffs_ = meta.sendOffs;
+    recvSizes_ = meta.recvSizes;
+    recvOffs_ = meta.recvOffs;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes_[q] *= width;
+        sendOffs_[q] *= width;
+        recvSizes_[q] *= width;
+        recvOffs_[q] *= width;
+    }
+
+    // The transposed product exchanges in the reverse direction over the
+    // same two buffers, so one allocation serves both orientations
+    const Int numSendInds = meta.sendInds.size();
+    sendVals_.resize( numSendInds*width );
+    recvVals_.resize( meta.numRecvInds*width );
+
+    // Serialized datatypes would have to be repacked before every replay,
+    // so only packed datatypes are routed through persistent requests
+    persistent_ = IsPacked<T>::value;
+    if( persistent_ )
+    {
+        int numRequests = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            if( recvSizes_[q] != 0 )
+                ++numRequests;
+            if( sendSizes_[q] != 0 )
+                ++numRequests;
+        }
+        // The forward (NORMAL) exchange: sendVals_ -> recvVals_
+        forwardRequests_.resize( numRequests );
+        int rCount = 0;
+        for( int q=0; q<commSize; ++q )
+            if( recvSizes_[q] != 0 )
+                mpi::RecvInit
+                ( &recvVals_[recvOffs_[q]], recvSizes_[q], q, 0,
+                  grid.Comm(), forwardRequests_[rCount++] );
+        for( int q=0; q<commSize; ++q )
+            if( sendSizes_[q] != 0 )
+                mpi::SendInit
+                ( &sendVals_[sendOffs_[q]], sendSizes_[q], q, 0,
+                  grid.Comm(), forwardRequests_[rCount++] );
+        // The reverse (transposed) exchange: recvVals_ -> sendVals_
+        reverseRequests_.resize( numRequests );
+        rCount = 0;
+        for( int q=0; q<commSize; ++q )
+            if( sendSizes_[q] != 0 )
+                mpi::RecvInit
+                ( &sendVals_[sendOffs_[q]], sendSizes_[q], q, 0,
+                  grid.Comm(), reverseRequests_[rCount++] );
+        for( int q=0; q<commSize; ++q )
+            if( recvSizes_[q] != 0 )
+                mpi::SendInit
+                ( &recvVals_[recvOffs_[q]], recvSizes_[q], q, 0,
+                  grid.Comm(), reverseRequests_[rCount++] );
+    }
+}
+
+template<typename T>
+void DistSparseMultPlan<T>::Multiply
+( Orientation orientation,
+  T alpha, const DistMultiVec<T>& X, T beta, DistMultiVec<T>& Y )
+{
+    EL_DEBUG_CSE
+    if( A_ == nullptr )
+        LogicError("The multiplication schedule has not been built");
+    const auto& A = *A_;
+    EL_DEBUG_ONLY(
+      if( X.Width() != width_ || Y.Width() != width_ )
+          LogicError
+          ("X and Y must have the width the schedule was built for");
+      if( !A.LockedDistGraph().multMeta.ready )
+          LogicError("The matrix was modified after the schedule was built");
+      if( !mpi::Congruent( A.Grid().Comm(), X.Grid().Comm() ) ||
+          !mpi::Congruent( X.Grid().Comm(), Y.Grid().Comm() ) )
+          LogicError("Communicators did not match");
+    )
+
+    const Grid& grid = A.Grid();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    const Int b = width_;
+
+    // Y := beta Y
+    Y *= beta;
+
+    if( orientation == NORMAL )
+    {
+        if( A.Height() != Y.Height() )
+            LogicError("A and Y must have the same height");
+        if( A.Width() != X.Height() )
+            LogicError("The width of A must match the height of X");
+
+        // Pack the send values
+        const Int numSendInds = meta.sendInds.size();
+        const Int firstLocalRow = X.FirstLocalRow();
+        const T* XBuffer = X.LockedMatrix().LockedBuffer();
+        const Int ldX = X.LockedMatrix().LDim();
+        for( Int s=0; s<numSendInds; ++s )
+        {
+            const Int i = meta.sendInds[s];
+            const Int iLoc = i - firstLocalRow;
+            for( Int t=0; t<b; ++t )
+                sendVals_[s*b+t] = XBuffer[iLoc+t*ldX];
+        }
+
+        // Now send them
+        if( persistent_ )
+        {
+            const int numRequests = forwardRequests_.size();
+            mpi::StartAll( numRequests, forwardRequests_.data() );
+            mpi::WaitAll( numRequests, forwardRequests_.data() );
+        }
+        else
+            mpi::AllToAll
+            ( sendVals_.data(), sendSizes_.data(), sendOffs_.data(),
+              recvVals_.data(), recvSizes_.data(), recvOffs_.data(),
+              grid.Comm() );
+
+        // Perform the local multiply-accumulate, y := alpha A x + y
+        MultiplyCSRInterX
+        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
+          alpha, A.LockedOffsetBuffer(),
+                 meta.colOffs.data(),
+                 A.LockedValueBuffer(),
+                 recvVals_.data(),
+          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
+    }
+    else
+    {
+        if( A.Width() != Y.Height() )
+            LogicError("The width of A must match the height of Y");
+        if( A.Height() != X.Height() )
+            LogicError("The height of A must match the height of X");
+
+        // Form and pack the updates to Y (the transposed product packs into
+        // the buffer which the NORMAL product receives into)
+        std::fill( recvVals_.begin(), recvVals_.end(), T(0) );
+        MultiplyCSRInterY
+        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
+          alpha, A.LockedOffsetBuffer(),
+                 meta.colOffs.data(),
+                 A.LockedValueBuffer(),
+                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
+          T(1),  recvVals_.data() );
+
+        // Inject the updates to Y into the network
+        if( persistent_ )
+        {
+            const int numRequests = reverseRequests_.size();
+            mpi::StartAll( numRequests, reverseRequests_.data() );
+            mpi::WaitAll( numRequests, reverseRequests_.data() );
+        }
+        else
+            mpi::AllToAll
+            ( recvVals_.data(), recvSizes_.data(), recvOffs_.data(),
+              sendVals_.data(), sendSizes_.data(), sendOffs_.data(),
+              grid.Comm() );
+
+        // Accumulate the received indices onto Y
+        const Int numRecvInds = meta.sendInds.size();
+        const Int firstLocalRow = Y.FirstLocalRow();
+        T* YBuffer = Y.Matrix().Buffer();
+        const Int ldY = Y.Matrix().LDim();
+        for( Int s=0; s<numRecvInds; ++s )
+        {
+            const Int i = meta.sendInds[s];
+            const Int iLoc = i - firstLocalRow;
+            for( Int t=0; t<b; ++t )
+                YBuffer[iLoc+t*ldY] += sendVals_[s*b+t];
+        }
+    }
+}
+
+template<typename T>
+Int DistSparseMultPlan<T>::Width() const EL_NO_EXCEPT
+{ return width_; }
+
+template<typename T>
+bool DistSparseMultPlan<T>::Ready() const EL_NO_EXCEPT
+{ return A_ != nullptr; }
+
+template<typename T>
+void DistSparseMultPlan<T>::Clear()
+{
+    EL_DEBUG_CSE
+    if( persistent_ )
+    {
+        for( auto& request : forwardRequests_ )
+            mpi::RequestFree( request );
+        for( auto& request : reverseRequests_ )
+            mpi::RequestFree( request );
+    }
+    SwapClear( forwardRequests_ );
+    SwapClear( reverseRequests_ );
+    SwapClear( sendSizes_ );
+    SwapClear( sendOffs_ );
+    SwapClear( recvSizes_ );
+    SwapClear( recvOffs_ );
+    SwapClear( sendVals_ );
+    SwapClear( recvVals_ );
+    A_ = nullptr;
+    width_ = 0;
+    persistent_ = false;
+}
+
+template<typename T>
+DistSparsePowersPlan<T>::DistSparsePowersPlan()
+{ }
+
+template<typename T>
+DistSparsePowersPlan<T>::DistSparsePowersPlan
+( const DistSparseMatrix<T>& A, Int numPowers )
+{ Build( A, numPowers ); }
+
+template<typename T>
+DistSparsePowersPlan<T>::~DistSparsePowersPlan()
+{ }
+
+template<typename T>
+void DistSparsePowersPlan<T>::Build
+( const DistSparseMatrix<T>& A, Int numPowers )
+{
+    EL_DEBUG_CSE
+    if( numPowers < 1 )
+        LogicError("The number of powers must be positive");
+    if( A.Height() != A.Width() )
+        LogicError("The matrix-powers kernel requires a square matrix");
+    Clear();
+    A_ = &A;
+    numPowers_ = numPowers;
+
+    const Grid& grid = A.Grid();
+    const int commSize = grid.Size();
+    const Int mLoc = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const T* valueBuf = A.LockedValueBuffer();
+
+    // The first level of the overlap: the targets of the local rows which
+    // fall outside of our row block
+    vector<Int> frontier;
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int j = targetBuf[e];
+        if( j < firstLocalRow || j >= firstLocalRow+mLoc )
+            frontier.push_back( j );
+    }
+    std::sort( frontier.begin(), frontier.end() );
+    frontier.erase
+    ( std::unique(frontier.begin(),frontier.end()), frontier.end() );
+    ghostInds_ = frontier;
+
+    levelOffs_.resize( numPowers_ );
+    levelOffs_[0] = 0;
+    ghostRowOffs_.push_back( 0 );
+    // The global index of each replicated row, in level order; the columns
+    // are remapped to workspace slots once the full overlap is known
+    vector<Int> rawRowInds;
+
+    for( Int level=1; level<numPowers_; ++level )
+    {
+        // Request the current frontier's rows from their owners. The
+        // frontier is sorted and the row blocks ascend with the rank, so it
+        // is already grouped by owner.
+        vector<int> reqCounts(commSize,0);
+        for( const Int j : frontier )
+            ++reqCounts[ A.RowOwner(j) ];
+        vector<int> reqOffs;
+        const int totalReqs = Scan( reqCounts, reqOffs );
+        vector<int> numReqs(commSize);
+        mpi::AllToAll( reqCounts.data(), 1, numReqs.data(), 1, grid.Comm() );
+        vector<int> numReqsOffs;
+        const int totalNumReqs = Scan( numReqs, numReqsOffs );
+        vector<Int> reqInds(totalNumReqs);
+        mpi::AllToAll
+        ( frontier.data(), reqCounts.data(), reqOffs.data(),
+          reqInds.data(), numReqs.data(), numReqsOffs.data(), grid.Comm() );
+
+        // Reply with each requested row's length and then its entries
+        vector<Int> replySizes(totalNumReqs);
+        vector<int> entrySendCounts(commSize,0);
+        for( int q=0; q<commSize; ++q )
+        {
+            for( int t=numReqsOffs[q]; t<numReqsOffs[q]+numReqs[q]; ++t )
+            {
+                const Int iLoc = reqInds[t]-firstLocalRow;
+                const Int rowSize = offsetBuf[iLoc+1]-offsetBuf[iLoc];
+                replySizes[t] = rowSize;
+                entrySendCounts[q] += rowSize;
+            }
+        }
+        vector<Int> rowSizes(totalReqs);
+        mpi::AllToAll
+        ( replySizes.data(), numReqs.data(), numReqsOffs.data(),
+          rowSizes.data(), reqCounts.data(), reqOffs.data(), grid.Comm() );
+
+        vector<int> entrySendOffs;
+        const int totalEntrySend = Scan( entrySendCounts, entrySendOffs );
+        vector<Int> entrySendInds(totalEntrySend);
+        vector<T> entrySendVals(totalEntrySend);
+        {
+            auto offs = entrySendOffs;
+            for( int q=0; q<commSize; ++q )
+            {
+                for( int t=numReqsOffs[q]; t<numReqsOffs[q]+numReqs[q]; ++t )
+                {
+                    const Int iLoc = reqInds[t]-firstLocalRow;
+                    for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+                    {
+                        entrySendInds[offs[q]] = targetBuf[e];
+                        entrySendVals[offs[q]] = valueBuf[e];
+                        ++offs[q];
+                    }
+                }
+            }
+        }
+        vector<int> entryRecvCounts(commSize,0);
+        for( int q=0; q<commSize; ++q )
+            for( int s=reqOffs[q]; s<reqOffs[q]+reqCounts[q]; ++s )
+                entryRecvCounts[q] += rowSizes[s];
+        vector<int> entryRecvOffs;
+        const int totalEntryRecv = Scan( entryRecvCounts, entryRecvOffs );
+        vector<Int> entryRecvInds(totalEntryRecv);
+        vector<T> entryRecvVals(totalEntryRecv);
+        mpi::AllToAll
+        ( entrySendInds.data(), entrySendCounts.data(), entrySendOffs.data(),
+          entryRecvInds.data(), entryRecvCounts.data(), entryRecvOffs.data(),
+          grid.Comm() );
+        mpi::AllToAll
+        ( entrySendVals.data(), entrySendCounts.data(), entrySendOffs.data(),
+          entryRecvVals.data(), entryRecvCounts.data(), entryRecvOffs.data(),
+          grid.Comm() );
+
+        // Append the fetched rows (which arrive in frontier order) to the
+        // replicated set
+        Int entryOff = 0;
+        for( size_t s=0; s<frontier.size(); ++s )
+        {
+            rawRowInds.push_back( frontier[s] );
+            for( Int e=0; e<rowSizes[s]; ++e )
+            {
+                ghostRowCols_.push_back( entryRecvInds[entryOff+e] );
+                ghostRowVals_.push_back( entryRecvVals[entryOff+e] );
+            }
+            ghostRowOffs_.push_back( Int(ghostRowCols_.size()) );
+            entryOff += rowSizes[s];
+        }
+        levelOffs_[level] = Int(rawRowInds.size());
+
+        // The next frontier consists of the newly discovered targets
+        vector<Int> fetched( entryRecvInds );
+        std::sort( fetched.begin(), fetched.end() );
+        fetched.erase
+        ( std::unique(fetched.begin(),fetched.end()), fetched.end() );
+        vector<Int> next;
+        for( const Int j : fetched )
+            if( (j < firstLocalRow || j >= firstLocalRow+mLoc) &&
+                !std::binary_search(ghostInds_.begin(),ghostInds_.end(),j) )
+                next.push_back( j );
+        vector<Int> merged( ghostInds_.size()+next.size() );
+        std::merge
+        ( ghostInds_.begin(), ghostInds_.end(),
+          next.begin(), next.end(), merged.begin() );
+        ghostInds_ = std::move( merged );
+        frontier = std::move( next );
+    }
+
+    // Remap every stored column to its workspace slot
+    auto slotOf = [&]( Int j )
+    {
+        if( j >= firstLocalRow && j < firstLocalRow+mLoc )
+            return j - firstLocalRow;
+        const auto it =
+          std::lower_bound( ghostInds_.begin(), ghostInds_.end(), j );
+        return mLoc + Int(it-ghostInds_.begin());
+    };
+    localCols_.resize( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+        localCols_[e] = slotOf( targetBuf[e] );
+    for( auto& j : ghostRowCols_ )
+        j = slotOf( j );
+    ghostRowSlots_.resize( rawRowInds.size() );
+    for( size_t r=0; r<rawRowInds.size(); ++r )
+        ghostRowSlots_[r] = slotOf( rawRowInds[r] );
+
+    // Schedule the value exchange over the overlap: since the sorted
+    // overlap is grouped by owner, the receive buffer of the exchange is
+    // already in slot order
+    recvSizes_.resize( commSize, 0 );
+    for( const Int j : ghostInds_ )
+        ++recvSizes_[ A.RowOwner(j) ];
+    Scan( recvSizes_, recvOffs_ );
+    sendSizes_.resize( commSize );
+    mpi::AllToAll( recvSizes_.data(), 1, sendSizes_.data(), 1, grid.Comm() );
+    const int totalSends = Scan( sendSizes_, sendOffs_ );
+    sendInds_.resize( totalSends );
+    mpi::AllToAll
+    ( ghostInds_.data(), recvSizes_.data(), recvOffs_.data(),
+      sendInds_.data(), sendSizes_.data(), sendOffs_.data(), grid.Comm() );
+    for( auto& i : sendInds_ )
+        i -= firstLocalRow;
+}
+
+template<typename T>
+void DistSparsePowersPlan<T>::Powers
+( const DistMultiVec<T>& X, vector<DistMultiVec<T>>& powers ) const
+{
+    EL_DEBUG_CSE
+    if( A_ == nullptr )
+        LogicError("The powers plan has not been built");
+    const auto& A = *A_;
+    EL_DEBUG_ONLY(
+      if( !mpi::Congruent( A.Grid().Comm(), X.Grid().Comm() ) )
+          LogicError("Communicators did not match");
+      if( X.Height() != A.Width() )
+          LogicError("The width of A must match the height of X");
+    )
+    const Grid& grid = A.Grid();
+    const int commSize = grid.Size();
+    const Int mLoc = A.LocalHeight();
+    const Int b = X.Width();
+    const Int numGhosts = ghostInds_.size();
+
+    // One widened exchange provides the overlap values of X
+    const Int numSendInds = sendInds_.size();
+    vector<T> sendVals;
+    FastResize( sendVals, numSendInds*b );
+    const T* XBuf = X.LockedMatrix().LockedBuffer();
+    const Int ldX = X.LockedMatrix().LDim();
+    for( Int s=0; s<numSendInds; ++s )
+        for( Int t=0; t<b; ++t )
+            sendVals[s*b+t] = XBuf[sendInds_[s]+t*ldX];
+    vector<int> sendSizes=sendSizes_, sendOffs=sendOffs_,
+                recvSizes=recvSizes_, recvOffs=recvOffs_;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] *= b;
+        sendOffs[q] *= b;
+        recvSizes[q] *= b;
+        recvOffs[q] *= b;
+    }
+    vector<T> ghostVals( numGhosts*b );
+    mpi::AllToAll
+    ( sendVals.data(), sendSizes.data(), sendOffs.data(),
+      ghostVals.data(), recvSizes.data(), recvOffs.data(), grid.Comm() );
+
+    // Interleaved workspaces over the local rows and the overlap
+    vector<T> cur( (mLoc+numGhosts)*b ), next( (mLoc+numGhosts)*b );
+    for( Int i=0; i<mLoc; ++i )
+        for( Int t=0; t<b; ++t )
+            cur[i*b+t] = XBuf[i+t*ldX];
+    std::copy( ghostVals.begin(), ghostVals.end(), cur.begin()+mLoc*b );
+
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const T* valueBuf = A.LockedValueBuffer();
+    powers.resize( numPowers_ );
+    for( Int l=1; l<=numPowers_; ++l )
+    {
+        auto& P = powers[l-1];
+        P.SetGrid( grid );
+        P.Resize( A.Height(), b );
+        T* PBuf = P.Matrix().Buffer();
+        const Int ldP = P.Matrix().LDim();
+        EL_PARALLEL_FOR
+        for( Int i=0; i<mLoc; ++i )
+        {
+            T* nextRow = &next[i*b];
+            for( Int t=0; t<b; ++t )
+                nextRow[t] = 0;
+            for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+            {
+                const T val = valueBuf[e];
+                const T* curRow = &cur[localCols_[e]*b];
+                for( Int t=0; t<b; ++t )
+                    nextRow[t] += val*curRow[t];
+            }
+            for( Int t=0; t<b; ++t )
+                PBuf[i+t*ldP] = nextRow[t];
+        }
+        // The replicated boundary rows still needed by the higher powers:
+        // level lambda is valid through power numPowers-lambda
+        const Int numActive =
+          ( l < numPowers_ ? levelOffs_[numPowers_-l] : 0 );
+        EL_PARALLEL_FOR
+        for( Int r=0; r<numActive; ++r )
+        {
+            T* nextRow = &next[ghostRowSlots_[r]*b];
+            for( Int t=0; t<b; ++t )
+                nextRow[t] = 0;
+            for( Int e=ghostRowOffs_[r]; e<ghostRowOffs_[r+1]; ++e )
+            {
+                const T val = ghostRowVals_[e];
+                const T* curRow = &cur[ghostRowCols_[e]*b];
+                for( Int t=0; t<b; ++t )
+                    nextRow[t] += val*curRow[t];
+            }
+        }
+        cur.swap( next );
+    }
+}
+
+template<typename T>
+Int DistSparsePowersPlan<T>::NumPowers() const EL_NO_EXCEPT
+{ return numPowers_; }
+
+template<typename T>
+bool DistSparsePowersPlan<T>::Ready() const EL_NO_EXCEPT
+{ return A_ != nullptr; }
+
+template<typename T>
+void DistSparsePowersPlan<T>::Clear()
+{
+    EL_DEBUG_CSE
+    SwapClear( ghostInds_ );
+    SwapClear( sendInds_ );
+    SwapClear( sendSizes_ );
+    SwapClear( sendOffs_ );
+    SwapClear( recvSizes_ );
+    SwapClear( recvOffs_ );
+    SwapClear( ghostRowSlots_ );
+    SwapClear( levelOffs_ );
+    SwapClear( ghostRowOffs_ );
+    SwapClear( ghostRowCols_ );
+    SwapClear( ghostRowVals_ );
+    SwapClear( localCols_ );
+    A_ = nullptr;
+    numPowers_ = 0;
+}
+
 #define PROTO(T) \
     template void Multiply \
     ( Orientation orientation, \
@@ -712,10 +1759,40 @@ void Multiply
     template void Multiply \
     ( Orientation orientation, \
             T alpha, \
+      const BSRMatrix<T>& A, \
+      const Matrix<T>& X, \
+            T beta, \
+            Matrix<T>& Y ); \
+    template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const DistSparseMatrix<T>& A, \
+      const DistMultiVec<T>& X, \
+            T beta, \
+            DistMultiVec<T>& Y ); \
+    template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const DistSparseMatrix<T>& A, \
+      const DistMatrix<T,VC,STAR>& X, \
+            T beta, \
+            DistMatrix<T,VC,STAR>& Y ); \
+    template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const DistSparseMatrix<T>& A, \
+      const AbstractDistMatrix<T>& X, \
+            T beta, \
+            AbstractDistMatrix<T>& Y ); \
+    template void MultiplyTranspose \
+    (       T alpha, \
       const DistSparseMatrix<T>& A, \
       const DistMultiVec<T>& X, \
             T beta, \
-            DistMultiVec<T>& Y );
+            DistMultiVec<T>& Y, \
+      bool conjugate ); \
+    template class DistSparseMultPlan<T>; \
+    template class DistSparsePowersPlan<T>;
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -0,0 +1,362 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/matrices.hpp>
+
+// Rectangular Full Packed storage keeps the lower triangle of an n x n
+// symmetric/Hermitian matrix in an (n or n+1) x (n-n/2) rectangle: with
+// n1 = n - n/2 and n2 = n/2, the lower triangles of A11 and all of A21 pack
+// in place in the bottom n rows, while the upper triangle of A22 occupies
+// the otherwise unused top-right corner (an extra leading row is needed when
+// n is even). Every kernel below therefore reduces to full-storage
+// operations on three ordinary views of the rectangle.
+
+namespace El {
+
+template<typename T>
+void PackRFP
+( UpperOrLower uplo, const Matrix<T>& A, Matrix<T>& ARFP, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("RFP storage is currently only supported for uplo=LOWER");
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    const Int s = ( n1==n2 ? 1 : 0 );
+
+    Zeros( ARFP, RFPHeight(n), RFPWidth(n) );
+
+    // The first n1 columns of the lower triangle pack in place
+    auto AL = A( ALL, IR(0,n1) );
+    auto ARFPL = ARFP( IR(s,END), ALL );
+    Copy( AL, ARFPL );
+    MakeTrapezoidal( LOWER, ARFPL );
+
+    // The trailing triangle is stored transposed in the top-right corner
+    Matrix<T> A22Trans;
+    Transpose( A(IR(n1,n),IR(n1,n)), A22Trans, conjugate );
+    MakeTrapezoidal( UPPER, A22Trans );
+    auto ARFPTR = ARFP( IR(0,n2), IR(n1-n2,n1) );
+    AxpyTrapezoid( UPPER, T(1), A22Trans, ARFPTR );
+}
+
+template<typename T>
+void PackRFP
+( UpperOrLower uplo, const AbstractDistMatrix<T>& APre,
+  AbstractDistMatrix<T>& ARFPPre, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("RFP storage is currently only supported for uplo=LOWER");
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+    const Int n = APre.Height();
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    const Int s = ( n1==n2 ? 1 : 0 );
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<T,T,MC,MR> ARFPProx( ARFPPre );
+    auto& A = AProx.GetLocked();
+    auto& ARFP = ARFPProx.Get();
+
+    Zeros( ARFP, RFPHeight(n), RFPWidth(n) );
+
+    auto AL = A( ALL, IR(0,n1) );
+    auto ARFPL = ARFP( IR(s,END), ALL );
+    Copy( AL, ARFPL );
+    MakeTrapezoidal( LOWER, ARFPL );
+
+    DistMatrix<T> A22Trans(g);
+    Transpose( A(IR(n1,n),IR(n1,n)), A22Trans, conjugate );
+    MakeTrapezoidal( UPPER, A22Trans );
+    auto ARFPTR = ARFP( IR(0,n2), IR(n1-n2,n1) );
+    AxpyTrapezoid( UPPER, T(1), A22Trans, ARFPTR );
+}
+
+template<typename T>
+void UnpackRFP
+( UpperOrLower uplo, const Matrix<T>& ARFP, Matrix<T>& A, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("RFP storage is currently only supported for uplo=LOWER");
+    const Int n = RFPDimension( ARFP.Height(), ARFP.Width() );
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    const Int s = ( n1==n2 ? 1 : 0 );
+
+    Zeros( A, n, n );
+
+    auto ARFPL = ARFP( IR(s,END), ALL );
+    auto AL = A( ALL, IR(0,n1) );
+    Copy( ARFPL, AL );
+    MakeTrapezoidal( LOWER, AL );
+
+    Matrix<T> A22Trans;
+    Transpose( ARFP(IR(0,n2),IR(n1-n2,n1)), A22Trans, conjugate );
+    MakeTrapezoidal( LOWER, A22Trans );
+    auto ABR = A( IR(n1,n), IR(n1,n) );
+    AxpyTrapezoid( LOWER, T(1), A22Trans, ABR );
+}
+
+template<typename T>
+void UnpackRFP
+( UpperOrLower uplo, const AbstractDistMatrix<T>& ARFPPre,
+  AbstractDistMatrix<T>& APre, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("RFP storage is currently only supported for uplo=LOWER");
+    const Int n = RFPDimension( ARFPPre.Height(), ARFPPre.Width() );
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    const Int s = ( n1==n2 ? 1 : 0 );
+    const Grid& g = ARFPPre.Grid();
+
+    DistMatrixReadProxy<T,T,MC,MR> ARFPProx( ARFPPre );
+    DistMatrixWriteProxy<T,T,MC,MR> AProx( APre );
+    auto& ARFP = ARFPProx.GetLocked();
+    auto& A = AProx.Get();
+
+    Zeros( A, n, n );
+
+    auto ARFPL = ARFP( IR(s,END), ALL );
+    auto AL = A( ALL, IR(0,n1) );
+    Copy( ARFPL, AL );
+    MakeTrapezoidal( LOWER, AL );
+
+    DistMatrix<T> A22Trans(g);
+    Transpose( ARFP(IR(0,n2),IR(n1-n2,n1)), A22Trans, conjugate );
+    MakeTrapezoidal( LOWER, A22Trans );
+    auto ABR = A( IR(n1,n), IR(n1,n) );
+    AxpyTrapezoid( LOWER, T(1), A22Trans, ABR );
+}
+
+template<typename T>
+void SymmRFP
+( LeftOrRight side, UpperOrLower uplo,
+  T alpha, const Matrix<T>& ARFP, const Matrix<T>& B, T beta, Matrix<T>& C,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("RFP storage is currently only supported for uplo=LOWER");
+    const Int n = RFPDimension( ARFP.Height(), ARFP.Width() );
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    const Int s = ( n1==n2 ? 1 : 0 );
+    const Orientation orient = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    auto A11 = ARFP( IR(s,s+n1), ALL );
+    auto A21 = ARFP( IR(s+n1,END), ALL );
+    auto A22 = ARFP( IR(0,n2), IR(n1-n2,n1) );
+
+    if( side == LEFT )
+    {
+        auto B1 = B( IR(0,n1), ALL );
+        auto B2 = B( IR(n1,n), ALL );
+        auto C1 = C( IR(0,n1), ALL );
+        auto C2 = C( IR(n1,n), ALL );
+        Symm( LEFT, LOWER, alpha, A11, B1, beta, C1, conjugate );
+        Gemm( orient, NORMAL, alpha, A21, B2, T(1), C1 );
+        Gemm( NORMAL, NORMAL, alpha, A21, B1, beta, C2 );
+        Symm( LEFT, UPPER, alpha, A22, B2, T(1), C2, conjugate );
+    }
+    else
+    {
+        auto B1 = B( ALL, IR(0,n1) );
+        auto B2 = B( ALL, IR(n1,n) );
+        auto C1 = C( ALL, IR(0,n1) );
+        auto C2 = C( ALL, IR(n1,n) );
+        Symm( RIGHT, LOWER, alpha, A11, B1, beta, C1, conjugate );
+        Gemm( NORMAL, NORMAL, alpha, B2, A21, T(1), C1 );
+        Gemm( NORMAL, orient, alpha, B1, A21, beta, C2 );
+        Symm( RIGHT, UPPER, alpha, A22, B2, T(1), C2, conjugate );
+    }
+}
+
+template<typename T>
+void SymmRFP
+( LeftOrRight side, UpperOrLower uplo,
+  T alpha, const AbstractDistMatrix<T>& ARFPPre,
+           const AbstractDistMatrix<T>& BPre,
+  T beta,        AbstractDistMatrix<T>& CPre, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("RFP storage is currently only supported for uplo=LOWER");
+    const Int n = RFPDimension( ARFPPre.Height(), ARFPPre.Width() );
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    const Int s = ( n1==n2 ? 1 : 0 );
+    const Orientation orient = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    DistMatrixReadProxy<T,T,MC,MR> ARFPProx( ARFPPre ), BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& ARFP = ARFPProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    auto A11 = ARFP( IR(s,s+n1), ALL );
+    auto A21 = ARFP( IR(s+n1,END), ALL );
+    auto A22 = ARFP( IR(0,n2), IR(n1-n2,n1) );
+
+    if( side == LEFT )
+    {
+        auto B1 = B( IR(0,n1), ALL );
+        auto B2 = B( IR(n1,n), ALL );
+        auto C1 = C( IR(0,n1), ALL );
+        auto C2 = C( IR(n1,n), ALL );
+        Symm( LEFT, LOWER, alpha, A11, B1, beta, C1, conjugate );
+        Gemm( orient, NORMAL, alpha, A21, B2, T(1), C1 );
+        Gemm( NORMAL, NORMAL, alpha, A21, B1, beta, C2 );
+        Symm( LEFT, UPPER, alpha, A22, B2, T(1), C2, conjugate );
+    }
+    else
+    {
+        auto B1 = B( ALL, IR(0,n1) );
+        auto B2 = B( ALL, IR(n1,n) );
+        auto C1 = C( ALL, IR(0,n1) );
+        auto C2 = C( ALL, IR(n1,n) );
+        Symm( RIGHT, LOWER, alpha, A11, B1, beta, C1, conjugate );
+        Gemm( NORMAL, NORMAL, alpha, B2, A21, T(1), C1 );
+        Gemm( NORMAL, orient, alpha, B1, A21, beta, C2 );
+        Symm( RIGHT, UPPER, alpha, A22, B2, T(1), C2, conjugate );
+    }
+}
+
+template<typename T>
+void HerkRFP
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const Matrix<T>& A, Base<T> beta, Matrix<T>& CRFP )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("RFP storage is currently only supported for uplo=LOWER");
+    if( orientation == TRANSPOSE )
+        LogicError("HerkRFP requires a NORMAL or ADJOINT orientation");
+    const Int n = ( orientation==NORMAL ? A.Height() : A.Width() );
+    if( CRFP.Height() != RFPHeight(n) || CRFP.Width() != RFPWidth(n) )
+        LogicError("C was not conformal RFP storage");
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    const Int s = ( n1==n2 ? 1 : 0 );
+
+    auto C11 = CRFP( IR(s,s+n1), ALL );
+    auto C21 = CRFP( IR(s+n1,END), ALL );
+    auto C22 = CRFP( IR(0,n2), IR(n1-n2,n1) );
+
+    if( orientation == NORMAL )
+    {
+        auto A1 = A( IR(0,n1), ALL );
+        auto A2 = A( IR(n1,n), ALL );
+        Herk( LOWER, NORMAL, alpha, A1, beta, C11 );
+        Gemm( NORMAL, ADJOINT, T(alpha), A2, A1, T(beta), C21 );
+        Herk( UPPER, NORMAL, alpha, A2, beta, C22 );
+    }
+    else
+    {
+        auto A1 = A( ALL, IR(0,n1) );
+        auto A2 = A( ALL, IR(n1,n) );
+        Herk( LOWER, ADJOINT, alpha, A1, beta, C11 );
+        Gemm( ADJOINT, NORMAL, T(alpha), A2, A1, T(beta), C21 );
+        Herk( UPPER, ADJOINT, alpha, A2, beta, C22 );
+    }
+}
+
+template<typename T>
+void HerkRFP
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const AbstractDistMatrix<T>& APre,
+  Base<T> beta,        AbstractDistMatrix<T>& CRFPPre )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("RFP storage is currently only supported for uplo=LOWER");
+    if( orientation == TRANSPOSE )
+        LogicError("HerkRFP requires a NORMAL or ADJOINT orientation");
+    const Int n = ( orientation==NORMAL ? APre.Height() : APre.Width() );
+    if( CRFPPre.Height() != RFPHeight(n) || CRFPPre.Width() != RFPWidth(n) )
+        LogicError("C was not conformal RFP storage");
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    const Int s = ( n1==n2 ? 1 : 0 );
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CRFPPre );
+    auto& A = AProx.GetLocked();
+    auto& CRFP = CProx.Get();
+
+    auto C11 = CRFP( IR(s,s+n1), ALL );
+    auto C21 = CRFP( IR(s+n1,END), ALL );
+    auto C22 = CRFP( IR(0,n2), IR(n1-n2,n1) );
+
+    if( orientation == NORMAL )
+    {
+        auto A1 = A( IR(0,n1), ALL );
+        auto A2 = A( IR(n1,n), ALL );
+        Herk( LOWER, NORMAL, alpha, A1, beta, C11 );
+        Gemm( NORMAL, ADJOINT, T(alpha), A2, A1, T(beta), C21 );
+        Herk( UPPER, NORMAL, alpha, A2, beta, C22 );
+    }
+    else
+    {
+        auto A1 = A( ALL, IR(0,n1) );
+        auto A2 = A( ALL, IR(n1,n) );
+        Herk( LOWER, ADJOINT, alpha, A1, beta, C11 );
+        Gemm( ADJOINT, NORMAL, T(alpha), A2, A1, T(beta), C21 );
+        Herk( UPPER, ADJOINT, alpha, A2, beta, C22 );
+    }
+}
+
+#define PROTO(T) \
+  template void PackRFP \
+  ( UpperOrLower uplo, const Matrix<T>& A, Matrix<T>& ARFP, \
+    bool conjugate ); \
+  template void PackRFP \
+  ( UpperOrLower uplo, const AbstractDistMatrix<T>& A, \
+    AbstractDistMatrix<T>& ARFP, bool conjugate ); \
+  template void UnpackRFP \
+  ( UpperOrLower uplo, const Matrix<T>& ARFP, Matrix<T>& A, \
+    bool conjugate ); \
+  template void UnpackRFP \
+  ( UpperOrLower uplo, const AbstractDistMatrix<T>& ARFP, \
+    AbstractDistMatrix<T>& A, bool conjugate ); \
+  template void SymmRFP \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    T alpha, const Matrix<T>& ARFP, const Matrix<T>& B, \
+    T beta,        Matrix<T>& C, bool conjugate ); \
+  template void SymmRFP \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    T alpha, const AbstractDistMatrix<T>& ARFP, \
+             const AbstractDistMatrix<T>& B, \
+    T beta,        AbstractDistMatrix<T>& C, bool conjugate ); \
+  template void HerkRFP \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Base<T> alpha, const Matrix<T>& A, Base<T> beta, Matrix<T>& CRFP ); \
+  template void HerkRFP \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Base<T> alpha, const AbstractDistMatrix<T>& A, \
+    Base<T> beta,        AbstractDistMatrix<T>& CRFP );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
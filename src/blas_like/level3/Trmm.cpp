@@ -58,6 +58,17 @@ void Trmm
 {
     EL_DEBUG_CSE
     X *= alpha;
+    // When the dimension of X which the triangular multiply mixes is fully
+    // local (e.g., a [STAR,VR] left operand or an [MC,STAR] right operand),
+    // the update can be applied directly by replicating the (typically much
+    // smaller) triangle rather than round-tripping X through [MC,MR]
+    if( (side == LEFT  && X.ColDist() == STAR) ||
+        (side == RIGHT && X.RowDist() == STAR) )
+    {
+        DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+        LocalTrmm( side, uplo, orientation, diag, T(1), A_STAR_STAR, X );
+        return;
+    }
     if( side == LEFT && uplo == LOWER )
     {
         if( orientation == NORMAL )
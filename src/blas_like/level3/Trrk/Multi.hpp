@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TRRK_MULTI_HPP
+#define EL_TRRK_MULTI_HPP
+
+namespace El {
+namespace trrk {
+
+#ifndef EL_RELEASE
+
+template<typename T>
+void CheckInputMulti
+( const vector<TrrkUpdate<T>>& updates, const Matrix<T>& C )
+{
+    if( C.Height() != C.Width() )
+        LogicError("C must be square");
+    for( size_t u=0; u<updates.size(); ++u )
+    {
+        const auto& upd = updates[u];
+        if( upd.A == nullptr || upd.B == nullptr )
+            LogicError("Update ",u," of TrrkMulti had a null operand");
+        const Int heightA =
+          ( upd.orientA==NORMAL ? upd.A->Height() : upd.A->Width() );
+        const Int innerA =
+          ( upd.orientA==NORMAL ? upd.A->Width() : upd.A->Height() );
+        const Int widthB =
+          ( upd.orientB==NORMAL ? upd.B->Width() : upd.B->Height() );
+        const Int innerB =
+          ( upd.orientB==NORMAL ? upd.B->Height() : upd.B->Width() );
+        if( heightA != C.Height() || widthB != C.Width() || innerA != innerB )
+            LogicError
+            ("Nonconformal update ",u," of TrrkMulti:\n",
+             DimsString(*upd.A,"A"),"\n",DimsString(*upd.B,"B"),"\n",
+             DimsString(C,"C"));
+    }
+}
+
+template<typename T>
+void CheckInputMulti
+( const vector<DistTrrkUpdate<T>>& updates, const AbstractDistMatrix<T>& C )
+{
+    if( C.Height() != C.Width() )
+        LogicError("C must be square");
+    for( size_t u=0; u<updates.size(); ++u )
+    {
+        const auto& upd = updates[u];
+        if( upd.A == nullptr || upd.B == nullptr )
+            LogicError("Update ",u," of TrrkMulti had a null operand");
+        AssertSameGrids( *upd.A, *upd.B, C );
+        const Int heightA =
+          ( upd.orientA==NORMAL ? upd.A->Height() : upd.A->Width() );
+        const Int innerA =
+          ( upd.orientA==NORMAL ? upd.A->Width() : upd.A->Height() );
+        const Int widthB =
+          ( upd.orientB==NORMAL ? upd.B->Width() : upd.B->Height() );
+        const Int innerB =
+          ( upd.orientB==NORMAL ? upd.B->Height() : upd.B->Width() );
+        if( heightA != C.Height() || widthB != C.Width() || innerA != innerB )
+            LogicError
+            ("Nonconformal update ",u," of TrrkMulti:\n",
+             DimsString(*upd.A,"A"),"\n",DimsString(*upd.B,"B"),"\n",
+             DimsString(C,"C"));
+    }
+}
+
+#endif // ifndef EL_RELEASE
+
+// Local C := sum_u alpha_u op_u(A_u) op_u(B_u) + C, traversing the triangular
+// portion of C one block column at a time and applying every update to each
+// block while it is cache-resident
+template<typename T>
+void TrrkMultiKernel
+( UpperOrLower uplo,
+  const vector<TrrkUpdate<T>>& updates,
+        Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int n = C.Height();
+    const Int bsize = Blocksize();
+    const Int numUpdates = updates.size();
+
+    for( Int j=0; j<n; j+=bsize )
+    {
+        const Int nb = Min(bsize,n-j);
+        const auto ind1 = IR(j,j+nb);
+        auto C11 = C( ind1, ind1 );
+
+        // Accumulate every update's diagonal-block contribution into a dense
+        // temporary so that the trapezoidal axpy only touches C11 once
+        Matrix<T> D11;
+        for( Int u=0; u<numUpdates; ++u )
+        {
+            const auto& upd = updates[u];
+            auto A1 = ( upd.orientA==NORMAL ? (*upd.A)(ind1,ALL)
+                                            : (*upd.A)(ALL,ind1) );
+            auto B1 = ( upd.orientB==NORMAL ? (*upd.B)(ALL,ind1)
+                                            : (*upd.B)(ind1,ALL) );
+            if( u == 0 )
+                Gemm( upd.orientA, upd.orientB, upd.alpha, A1, B1, D11 );
+            else
+                Gemm( upd.orientA, upd.orientB, upd.alpha, A1, B1, T(1), D11 );
+        }
+        AxpyTrapezoid( uplo, T(1), D11, C11 );
+
+        // Apply every update to the off-diagonal portion of the block column
+        // while it is still resident
+        if( uplo == LOWER && j+nb < n )
+        {
+            const auto ind2 = IR(j+nb,n);
+            auto C21 = C( ind2, ind1 );
+            for( Int u=0; u<numUpdates; ++u )
+            {
+                const auto& upd = updates[u];
+                auto A2 = ( upd.orientA==NORMAL ? (*upd.A)(ind2,ALL)
+                                                : (*upd.A)(ALL,ind2) );
+                auto B1 = ( upd.orientB==NORMAL ? (*upd.B)(ALL,ind1)
+                                                : (*upd.B)(ind1,ALL) );
+                Gemm( upd.orientA, upd.orientB, upd.alpha, A2, B1, T(1), C21 );
+            }
+        }
+        else if( uplo == UPPER && j > 0 )
+        {
+            const auto ind0 = IR(0,j);
+            auto C01 = C( ind0, ind1 );
+            for( Int u=0; u<numUpdates; ++u )
+            {
+                const auto& upd = updates[u];
+                auto A0 = ( upd.orientA==NORMAL ? (*upd.A)(ind0,ALL)
+                                                : (*upd.A)(ALL,ind0) );
+                auto B1 = ( upd.orientB==NORMAL ? (*upd.B)(ALL,ind1)
+                                                : (*upd.B)(ind1,ALL) );
+                Gemm( upd.orientA, upd.orientB, upd.alpha, A0, B1, T(1), C01 );
+            }
+        }
+    }
+}
+
+// A staged panel in the canonical form alpha A B^T, with A in [MC,STAR] and
+// the (pre-transposed) B in [MR,STAR], so that arbitrarily oriented updates
+// can share a single traversal of C
+template<typename T>
+struct TrrkMultiPanel
+{
+    T alpha;
+    const DistMatrix<T,MC,STAR>* A;
+    const DistMatrix<T,MR,STAR>* B;
+};
+
+// Distributed C := sum_u alpha_u A_u B_u^T + C over the staged panels
+template<typename T>
+void LocalTrrkMulti
+( UpperOrLower uplo,
+  const vector<TrrkMultiPanel<T>>& panels,
+        DistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      for( const auto& panel : panels )
+          CheckInput( *panel.A, *panel.B, C );
+    )
+    const Grid& g = C.Grid();
+    const Int n = C.Height();
+    const Int bsize = g.Width()*LocalTrrkBlocksize<T>();
+    const Int numPanels = panels.size();
+
+    for( Int j=0; j<n; j+=bsize )
+    {
+        const Int nb = Min(bsize,n-j);
+        const auto ind1 = IR(j,j+nb);
+        auto C11 = C( ind1, ind1 );
+
+        DistMatrix<T> D11(g);
+        D11.AlignWith( C11 );
+        for( Int u=0; u<numPanels; ++u )
+        {
+            auto A1 = (*panels[u].A)( ind1, ALL );
+            auto B1 = (*panels[u].B)( ind1, ALL );
+            if( u == 0 )
+                LocalGemm( NORMAL, TRANSPOSE, panels[u].alpha, A1, B1, D11 );
+            else
+                LocalGemm
+                ( NORMAL, TRANSPOSE, panels[u].alpha, A1, B1, T(1), D11 );
+        }
+        LocalAxpyTrapezoid( uplo, T(1), D11, C11 );
+
+        if( uplo == LOWER && j+nb < n )
+        {
+            const auto ind2 = IR(j+nb,n);
+            auto C21 = C( ind2, ind1 );
+            for( Int u=0; u<numPanels; ++u )
+            {
+                auto A2 = (*panels[u].A)( ind2, ALL );
+                auto B1 = (*panels[u].B)( ind1, ALL );
+                LocalGemm
+                ( NORMAL, TRANSPOSE, panels[u].alpha, A2, B1, T(1), C21 );
+            }
+        }
+        else if( uplo == UPPER && j > 0 )
+        {
+            const auto ind0 = IR(0,j);
+            auto C01 = C( ind0, ind1 );
+            for( Int u=0; u<numPanels; ++u )
+            {
+                auto A0 = (*panels[u].A)( ind0, ALL );
+                auto B1 = (*panels[u].B)( ind1, ALL );
+                LocalGemm
+                ( NORMAL, TRANSPOSE, panels[u].alpha, A0, B1, T(1), C01 );
+            }
+        }
+    }
+}
+
+} // namespace trrk
+} // namespace El
+
+#endif // ifndef EL_TRRK_MULTI_HPP
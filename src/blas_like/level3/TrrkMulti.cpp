@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+#include "./Trrk/Local.hpp"
+#include "./Trrk/Multi.hpp"
+
+namespace El {
+
+template<typename T>
+void TrrkMulti
+( UpperOrLower uplo,
+  const vector<TrrkUpdate<T>>& updates,
+  T beta, Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(trrk::CheckInputMulti( updates, C ))
+    ScaleTrapezoid( beta, uplo, C );
+    if( updates.empty() )
+        return;
+    trrk::TrrkMultiKernel( uplo, updates, C );
+}
+
+template<typename T>
+void TrrkMulti
+( UpperOrLower uplo,
+  const vector<DistTrrkUpdate<T>>& updates,
+  T beta, AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(trrk::CheckInputMulti( updates, CPre ))
+    ScaleTrapezoid( beta, uplo, CPre );
+    if( updates.empty() )
+        return;
+    const Int numUpdates = updates.size();
+    const Int bsize = Blocksize();
+    const Grid& g = CPre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    vector<unique_ptr<DistMatrixReadProxy<T,T,MC,MR>>>
+      AProxies(numUpdates), BProxies(numUpdates);
+    vector<Int> innerDims(numUpdates);
+    Int maxInnerDim = 0;
+    for( Int u=0; u<numUpdates; ++u )
+    {
+        AProxies[u].reset
+        ( new DistMatrixReadProxy<T,T,MC,MR>( *updates[u].A ) );
+        BProxies[u].reset
+        ( new DistMatrixReadProxy<T,T,MC,MR>( *updates[u].B ) );
+        innerDims[u] =
+          ( updates[u].orientA==NORMAL ? updates[u].A->Width()
+                                       : updates[u].A->Height() );
+        maxInnerDim = Max( maxInnerDim, innerDims[u] );
+    }
+
+    // The staged panels in the canonical form alpha Ahat Bhat^T, which allows
+    // every update to share a single traversal of C per panel step
+    vector<DistMatrix<T,MC,STAR>> APanels;
+    vector<DistMatrix<T,MR,STAR>> BPanels;
+    APanels.reserve( numUpdates );
+    BPanels.reserve( numUpdates );
+    for( Int u=0; u<numUpdates; ++u )
+    {
+        APanels.emplace_back( g );
+        APanels.back().AlignWith( C );
+        BPanels.emplace_back( g );
+        BPanels.back().AlignWith( C );
+    }
+
+    for( Int k=0; k<maxInnerDim; k+=bsize )
+    {
+        vector<trrk::TrrkMultiPanel<T>> staged;
+        staged.reserve( numUpdates );
+        for( Int u=0; u<numUpdates; ++u )
+        {
+            if( k >= innerDims[u] )
+                continue;
+            const Int nb = Min(bsize,innerDims[u]-k);
+            const Range<Int> ind1( k, k+nb );
+
+            auto& A = AProxies[u]->GetLocked();
+            auto& B = BProxies[u]->GetLocked();
+
+            if( updates[u].orientA == NORMAL )
+                APanels[u] = A( ALL, ind1 );
+            else
+                Transpose
+                ( A(ind1,ALL), APanels[u], updates[u].orientA==ADJOINT );
+
+            if( updates[u].orientB == NORMAL )
+                Transpose( B(ind1,ALL), BPanels[u] );
+            else
+            {
+                BPanels[u] = B( ALL, ind1 );
+                if( updates[u].orientB == ADJOINT )
+                    Conjugate( BPanels[u] );
+            }
+
+            staged.push_back
+            ( trrk::TrrkMultiPanel<T>
+              { updates[u].alpha, &APanels[u], &BPanels[u] } );
+        }
+        trrk::LocalTrrkMulti( uplo, staged, C );
+    }
+}
+
+#define PROTO(T) \
+  template void TrrkMulti \
+  ( UpperOrLower uplo, \
+    const vector<TrrkUpdate<T>>& updates, \
+    T beta, Matrix<T>& C ); \
+  template void TrrkMulti \
+  ( UpperOrLower uplo, \
+    const vector<DistTrrkUpdate<T>>& updates, \
+    T beta, AbstractDistMatrix<T>& C );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
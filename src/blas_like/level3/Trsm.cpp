@@ -10,6 +10,7 @@
 #include <El/blas_like/level2.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Trsm/PanelPrefetch.hpp"
 #include "./Trsm/LLN.hpp"
 #include "./Trsm/LLT.hpp"
 #include "./Trsm/LUN.hpp"
@@ -21,6 +22,46 @@
 
 namespace El {
 
+namespace trsm {
+
+template<typename F>
+void FillRandom( DistMatrix<F>& A, Int height, Int width )
+{
+    A.Resize( height, width );
+    auto& ALoc = A.Matrix();
+    for( Int jLoc=0; jLoc<ALoc.Width(); ++jLoc )
+        for( Int iLoc=0; iLoc<ALoc.Height(); ++iLoc )
+            ALoc(iLoc,jLoc) = SampleUniform( F(0), F(1) );
+}
+
+// Returns the calibrated blocksize for this datatype and grid shape,
+// measuring one at first use when blocksize tuning is enabled
+template<typename F>
+Int TunedBlocksize( const Grid& grid )
+{
+    const string key = BlocksizeTuningKey
+      ( "Trsm", TypeName<F>(), grid.Height(), grid.Width() );
+    if( HaveTunedBlocksize( key ) )
+        return El::TunedBlocksize( key );
+    if( !BlocksizeTuningEnabled() || CalibratingBlocksize() )
+        return Blocksize();
+
+    const Int n =
+      Min( Int(256*Sqrt(double(grid.Size()))), Int(2048) );
+    DistMatrix<F> A(grid), B(grid);
+    FillRandom( A, n, n );
+    // Shift the diagonal to guarantee a safely conditioned triangle
+    ShiftDiagonal( A, F(2*n) );
+    FillRandom( B, n, n );
+    return CalibrateBlocksize
+      ( key,
+        [&]()
+        { Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), A, B, false ); },
+        grid.Comm() );
+}
+
+} // namespace trsm
+
 template<typename F>
 void Trsm
 ( LeftOrRight side,
@@ -33,6 +74,7 @@ void Trsm
   bool checkIfSingular )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Trsm");
     EL_DEBUG_ONLY(
       if( A.Height() != A.Width() )
           LogicError("Triangular matrix must be square");
@@ -73,9 +115,26 @@ void Trsm
   F alpha,
   const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<F>& B,
-  bool checkIfSingular, TrsmAlgorithm alg )
+  bool checkIfSingular, TrsmAlgorithm alg, const TuningCtrl& tuning )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Trsm");
+    if( ProfilingEnabled() )
+    {
+        // Model the useful work from the dimensions: a triangular solve
+        // costs one multiply-accumulate per entry of the triangle per
+        // right-hand side, with a factor of four for complex data
+        const double m = B.Height();
+        const double n = B.Width();
+        profile::RecordFlops
+        ( ( IsComplex<F>::value ? 4. : 1. )*
+          ( side==LEFT ? m*m*n : n*n*m ) );
+    }
+    // An explicitly requested blocksize takes precedence over any
+    // autotuned value
+    BlocksizeGuard nbGuard
+    ( tuning.blocksize > 0 ? tuning.blocksize
+                           : trsm::TunedBlocksize<F>( B.Grid() ) );
     EL_DEBUG_ONLY(
       AssertSameGrids( A, B );
       if( A.Height() != A.Width() )
@@ -416,7 +475,8 @@ void LocalTrsm
     const AbstractDistMatrix<F>& A, \
           AbstractDistMatrix<F>& B, \
     bool checkIfSingular, \
-    TrsmAlgorithm alg ); \
+    TrsmAlgorithm alg, \
+    const TuningCtrl& tuning ); \
   template void LocalTrsm \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
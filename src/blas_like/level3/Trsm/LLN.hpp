@@ -32,11 +32,11 @@ void LLNLarge
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
+    PanelPrefetcher<F,MC,MR> panels( L, 0, bsize );
     for( Int k=0; k<m; k+=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -44,13 +44,13 @@ void LLNLarge
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
 
-        auto L11 = L( ind1, ind1 );
         auto L21 = L( ind2, ind1 );
 
         auto X1 = X( ind1, ALL );
         auto X2 = X( ind2, ALL );
 
-        L11_STAR_STAR = L11; // L11[* ,* ] <- L11[MC,MR]
+        // L11[* ,* ] <- L11[MC,MR] (gathered ahead of the substitution)
+        auto& L11_STAR_STAR = panels.Get( k );
         X1_STAR_VR    = X1;  // X1[* ,VR] <- X1[MC,MR]
 
         // X1[* ,VR] := L11^-1[* ,* ] X1[* ,VR]
@@ -87,10 +87,10 @@ void LLNMedium
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
 
+    PanelPrefetcher<F,MC,MR> panels( L, 0, bsize );
     for( Int k=0; k<m; k+=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -98,13 +98,13 @@ void LLNMedium
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
 
-        auto L11 = L( ind1, ind1 );
         auto L21 = L( ind2, ind1 );
 
         auto X1 = X( ind1, ALL );
         auto X2 = X( ind2, ALL );
 
-        L11_STAR_STAR = L11; // L11[* ,* ] <- L11[MC,MR]
+        // L11[* ,* ] <- L11[MC,MR] (gathered ahead of the substitution)
+        auto& L11_STAR_STAR = panels.Get( k );
         X1Trans_MR_STAR.AlignWith( X2 );
         Transpose( X1, X1Trans_MR_STAR );
 
@@ -140,8 +140,9 @@ void LLNSmall
     const Int bsize = Blocksize();
     const Grid& g = L.Grid();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    DistMatrix<F,STAR,STAR> X1_STAR_STAR(g);
 
+    PanelPrefetcher<F,colDist,STAR> panels( L, 0, bsize );
     for( Int k=0; k<m; k+=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -149,13 +150,13 @@ void LLNSmall
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
 
-        auto L11 = L( ind1, ind1 );
         auto L21 = L( ind2, ind1 );
 
         auto X1 = X( ind1, ALL );
         auto X2 = X( ind2, ALL );
 
-        L11_STAR_STAR = L11; // L11[* ,* ] <- L11[VC,* ]
+        // L11[* ,* ] <- L11[VC,* ] (gathered ahead of the substitution)
+        auto& L11_STAR_STAR = panels.Get( k );
         X1_STAR_STAR = X1;   // X1[* ,* ] <- X1[VC,* ]
 
         // X1[* ,* ] := (L11[* ,* ])^-1 X1[* ,* ]
@@ -40,11 +40,11 @@ void LLTLarge
     auto& X = XProx.Get();
 
     DistMatrix<F,STAR,MC  > L10_STAR_MC(g);
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
     const Int kLast = LastOffset( m, bsize );
+    PanelPrefetcher<F,MC,MR> panels( L, kLast, -bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -53,12 +53,12 @@ void LLTLarge
                          ind1( k, k+nb );
 
         auto L10 = L( ind1, ind0 );
-        auto L11 = L( ind1, ind1 );
 
         auto X0 = X( ind0, ALL );
         auto X1 = X( ind1, ALL );
 
-        L11_STAR_STAR = L11; // L11[* ,* ] <- L11[MC,MR]
+        // L11[* ,* ] <- L11[MC,MR] (gathered ahead of the substitution)
+        auto& L11_STAR_STAR = panels.Get( k );
         X1_STAR_VR    = X1;  // X1[* ,VR] <- X1[MC,MR]
 
         // X1[* ,VR] := L11^-[T/H][* ,* ] X1[* ,VR]
@@ -103,10 +103,10 @@ void LLTMedium
     auto& X = XProx.Get();
 
     DistMatrix<F,STAR,MC  > L10_STAR_MC(g);
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
+    PanelPrefetcher<F,MC,MR> panels( L, kLast, -bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -115,12 +115,12 @@ void LLTMedium
                          ind1( k, k+nb );
 
         auto L10 = L( ind1, ind0 );
-        auto L11 = L( ind1, ind1 );
 
         auto X0 = X( ind0, ALL );
         auto X1 = X( ind1, ALL );
 
-        L11_STAR_STAR = L11; // L11[* ,* ] <- L11[MC,MR]
+        // L11[* ,* ] <- L11[MC,MR] (gathered ahead of the substitution)
+        auto& L11_STAR_STAR = panels.Get( k );
         // X1[* ,MR] <- X1[MC,MR]
         X1Trans_MR_STAR.AlignWith( X0 );
         Transpose( X1, X1Trans_MR_STAR, (orientation==ADJOINT) );
@@ -167,9 +167,10 @@ void LLTSmall
     const Int bsize = Blocksize();
     const Grid& g = L.Grid();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), Z1_STAR_STAR(g);
+    DistMatrix<F,STAR,STAR> Z1_STAR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
+    PanelPrefetcher<F,colDist,STAR> panels( L, kLast, -bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -177,7 +178,6 @@ void LLTSmall
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
 
-        auto L11 = L( ind1, ind1 );
         auto L21 = L( ind2, ind1 );
 
         auto X1 = X( ind1, ALL );
@@ -188,8 +188,8 @@ void LLTSmall
         axpy::util::UpdateWithLocalData( F(1), X1, Z1_STAR_STAR );
         El::AllReduce( Z1_STAR_STAR, X1.DistComm() );
 
-        // X1 := L11^-1 X1
-        L11_STAR_STAR = L11;
+        // X1 := L11^-1 X1 (with the panel gathered ahead of time)
+        auto& L11_STAR_STAR = panels.Get( k );
         LocalTrsm
         ( LEFT, LOWER, orientation, diag, F(1), L11_STAR_STAR, Z1_STAR_STAR,
           checkIfSingular );
@@ -220,9 +220,10 @@ void LLTSmall
     const Int bsize = Blocksize();
     const Grid& g = L.Grid();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    DistMatrix<F,STAR,STAR> X1_STAR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
+    PanelPrefetcher<F,STAR,rowDist> panels( L, kLast, -bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -231,12 +232,12 @@ void LLTSmall
                          ind1( k, k+nb );
 
         auto L10 = L( ind1, ind0 );
-        auto L11 = L( ind1, ind1 );
 
         auto X0 = X( ind0, ALL );
         auto X1 = X( ind1, ALL );
 
-        L11_STAR_STAR = L11; // L11[* ,* ] <- L11[* ,VR]
+        // L11[* ,* ] <- L11[* ,VR] (gathered ahead of the substitution)
+        auto& L11_STAR_STAR = panels.Get( k );
         X1_STAR_STAR = X1;   // X1[* ,* ] <- X1[VR,* ]
 
         // X1[* ,* ] := L11^-[T/H][* ,* ] X1[* ,* ]
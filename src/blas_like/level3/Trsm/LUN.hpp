@@ -32,11 +32,11 @@ void LUNLarge
     auto& X = XProx.Get();
 
     DistMatrix<F,MC,  STAR> U01_MC_STAR(g);
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
     const Int kLast = LastOffset( m, bsize );
+    PanelPrefetcher<F,MC,MR> panels( U, kLast, -bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -45,12 +45,12 @@ void LUNLarge
                          ind1( k, k+nb );
 
         auto U01 = U( ind0, ind1 );
-        auto U11 = U( ind1, ind1 );
 
         auto X0 = X( ind0, ALL );
         auto X1 = X( ind1, ALL );
 
-        U11_STAR_STAR = U11; // U11[* ,* ] <- U11[MC,MR]
+        // U11[* ,* ] <- U11[MC,MR] (gathered ahead of the substitution)
+        auto& U11_STAR_STAR = panels.Get( k );
         X1_STAR_VR    = X1;  // X1[* ,VR] <- X1[MC,MR]
         
         // X1[* ,VR] := U11^-1[* ,* ] X1[* ,VR]
@@ -87,10 +87,10 @@ void LUNMedium
     auto& X = XProx.Get();
 
     DistMatrix<F,MC,  STAR> U01_MC_STAR(g);
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
+    PanelPrefetcher<F,MC,MR> panels( U, kLast, -bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -99,12 +99,12 @@ void LUNMedium
                          ind1( k, k+nb );
 
         auto U01 = U( ind0, ind1 );
-        auto U11 = U( ind1, ind1 );
 
         auto X0 = X( ind0, ALL );
         auto X1 = X( ind1, ALL );
 
-        U11_STAR_STAR = U11; // U11[* ,* ] <- U11[MC,MR]
+        // U11[* ,* ] <- U11[MC,MR] (gathered ahead of the substitution)
+        auto& U11_STAR_STAR = panels.Get( k );
         X1Trans_MR_STAR.AlignWith( X0 );
         Transpose( X1, X1Trans_MR_STAR );
         
@@ -144,9 +144,10 @@ void LUNSmall
     const Int bsize = Blocksize();
     const Grid& g = U.Grid();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
+    DistMatrix<F,STAR,STAR> X1_STAR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
+    PanelPrefetcher<F,colDist,STAR> panels( U, kLast, -bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -155,12 +156,12 @@ void LUNSmall
                          ind1( k, k+nb );
 
         auto U01 = U( ind0, ind1 );
-        auto U11 = U( ind1, ind1 );
 
         auto X0 = X( ind0, ALL );
         auto X1 = X( ind1, ALL );
 
-        U11_STAR_STAR = U11; // U11[* ,* ] <- U11[VC,* ]
+        // U11[* ,* ] <- U11[VC,* ] (gathered ahead of the substitution)
+        auto& U11_STAR_STAR = panels.Get( k );
         X1_STAR_STAR = X1;   // X1[* ,* ] <- X1[VC,* ]
         
         // X1[* ,* ] := U11^-1[* ,* ] X1[* ,* ]
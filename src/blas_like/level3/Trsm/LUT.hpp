@@ -39,11 +39,11 @@ void LUTLarge
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
     DistMatrix<F,STAR,MC  > U12_STAR_MC(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
+    PanelPrefetcher<F,MC,MR> panels( U, 0, bsize );
     for( Int k=0; k<m; k+=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -51,13 +51,13 @@ void LUTLarge
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
 
-        auto U11 = U( ind1, ind1 );
         auto U12 = U( ind1, ind2 );
 
         auto X1 = X( ind1, ALL );
         auto X2 = X( ind2, ALL );
 
-        U11_STAR_STAR = U11; // U11[* ,* ] <- U11[MC,MR]
+        // U11[* ,* ] <- U11[MC,MR] (gathered ahead of the substitution)
+        auto& U11_STAR_STAR = panels.Get( k );
         X1_STAR_VR    = X1;  // X1[* ,VR] <- X1[MC,MR]
         
         // X1[* ,VR] := U11^-[T/H][*,*] X1[* ,VR]
@@ -101,10 +101,10 @@ void LUTMedium
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
     DistMatrix<F,STAR,MC  > U12_STAR_MC(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
 
+    PanelPrefetcher<F,MC,MR> panels( U, 0, bsize );
     for( Int k=0; k<m; k+=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -112,13 +112,13 @@ void LUTMedium
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
 
-        auto U11 = U( ind1, ind1 );
         auto U12 = U( ind1, ind2 );
 
         auto X1 = X( ind1, ALL );
         auto X2 = X( ind2, ALL );
 
-        U11_STAR_STAR = U11; // U11[* ,* ] <- U11[MC,MR]
+        // U11[* ,* ] <- U11[MC,MR] (gathered ahead of the substitution)
+        auto& U11_STAR_STAR = panels.Get( k );
         // X1[* ,VR] <- X1[MC,MR]
         X1Trans_MR_STAR.AlignWith( X2 );
         Transpose( X1, X1Trans_MR_STAR, (orientation==ADJOINT) );
@@ -165,8 +165,9 @@ void LUTSmall
     const Int bsize = Blocksize();
     const Grid& g = U.Grid();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g); 
+    DistMatrix<F,STAR,STAR> X1_STAR_STAR(g);
 
+    PanelPrefetcher<F,STAR,rowDist> panels( U, 0, bsize );
     for( Int k=0; k<m; k+=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -174,13 +175,13 @@ void LUTSmall
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
 
-        auto U11 = U( ind1, ind1 );
         auto U12 = U( ind1, ind2 );
 
         auto X1 = X( ind1, ALL );
         auto X2 = X( ind2, ALL );
 
-        U11_STAR_STAR = U11; // U11[* ,* ] <- U11[* ,VR]
+        // U11[* ,* ] <- U11[* ,VR] (gathered ahead of the substitution)
+        auto& U11_STAR_STAR = panels.Get( k );
         X1_STAR_STAR = X1;   // X1[* ,* ] <- X1[VR,* ]
         
         // X1[* ,* ] := U11^-[T/H][* ,* ] X1[* ,* ]
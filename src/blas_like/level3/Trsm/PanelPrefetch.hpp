@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El/blas_like/level1/Copy/util.hpp>
+
+namespace El {
+namespace trsm {
+
+// Pipelines the diagonal-panel gathers of a triangular solve: while the
+// current panel is being substituted, the replications of the next few
+// diagonal blocks, e.g., L11[* ,* ] <- L11[MC,MR], are already in flight as
+// nonblocking allgathers. These small collectives form the serialized
+// latency chain of the solve phase, and overlapping them with the local
+// substitution and update hides most of that latency. The packing and
+// unpacking mirror copy::AllGather, with one padded portion per process.
+//
+// The panels are assumed to be visited in the order of the solve loop
+// (offsets firstOffset, firstOffset+step, ..., with step = +/- blocksize),
+// and up to `depth` panels are kept in flight in a ring of slots. When MPI
+// lacks nonblocking collectives, each gather degrades to the synchronous
+// redistribution it replaces.
+template<typename F,Dist U,Dist V>
+class PanelPrefetcher
+{
+public:
+    PanelPrefetcher
+    ( const DistMatrix<F,U,V>& A, Int firstOffset, Int step, Int depth=2 )
+    : A_(A), step_(step), nextOffset_(firstOffset), depth_(Max(depth,Int(1)))
+    {
+        slots_.resize( depth_ );
+        for( auto& slot : slots_ )
+            slot.D.SetGrid( A.Grid() );
+    }
+
+    ~PanelPrefetcher()
+    {
+        // Drain any gathers still in flight (e.g., after an exception)
+        for( auto& slot : slots_ )
+            if( slot.inFlight )
+                mpi::Wait( slot.request );
+    }
+
+    // Return the replicated diagonal panel with offset k, first ensuring
+    // that the gathers of the following panels have been started
+    const DistMatrix<F,STAR,STAR>& Get( Int k )
+    {
+        const Int m = A_.Height();
+        while( InSchedule( nextOffset_, k, m ) )
+        {
+            Start( nextOffset_ );
+            nextOffset_ += step_;
+        }
+        auto& slot = slots_[SlotOf(k)];
+        if( slot.inFlight )
+        {
+            mpi::Wait( slot.request );
+            slot.inFlight = false;
+        }
+        if( !slot.unpacked )
+        {
+            slot.D.Resize( slot.nb, slot.nb );
+            copy::util::StridedUnpack
+            ( slot.nb, slot.nb,
+              slot.colAlign, A_.ColStride(),
+              slot.rowAlign, A_.RowStride(),
+              &slot.buf[slot.portionSize], slot.portionSize,
+              slot.D.Buffer(), slot.D.LDim() );
+            slot.unpacked = true;
+        }
+        return slot.D;
+    }
+
+private:
+    struct PanelSlot
+    {
+        DistMatrix<F,STAR,STAR> D;
+        vector<F> buf;
+        mpi::Request<F> request;
+        Int nb=0, portionSize=0;
+        int colAlign=0, rowAlign=0;
+        bool inFlight=false, unpacked=false;
+    };
+
+    // Consecutive panels in the schedule occupy distinct slots, and a slot
+    // is only reused once its previous panel has been consumed
+    Int SlotOf( Int offset ) const
+    { return Mod( offset/Abs(step_), depth_ ); }
+
+    // Whether the panel at `offset` should be started before returning the
+    // panel at `k`: it must be in bounds and within the lookahead window
+    bool InSchedule( Int offset, Int k, Int m ) const
+    {
+        if( offset < 0 || offset >= m )
+            return false;
+        if( step_ > 0 )
+            return offset <= k + (depth_-1)*step_;
+        else
+            return offset >= k + (depth_-1)*step_;
+    }
+
+    void Start( Int offset )
+    {
+        const Int m = A_.Height();
+        const Int nb = Min( Abs(step_), m-offset );
+        const Range<Int> ind( offset, offset+nb );
+        auto A11 = A_( ind, ind );
+        auto& slot = slots_[SlotOf(offset)];
+        slot.nb = nb;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+        if( A_.Participating() && A_.DistSize() != 1 )
+        {
+            const Int colStride = A_.ColStride();
+            const Int rowStride = A_.RowStride();
+            const Int distStride = colStride*rowStride;
+            slot.colAlign = A11.ColAlign();
+            slot.rowAlign = A11.RowAlign();
+            slot.portionSize =
+              mpi::Pad( MaxLength(nb,colStride)*MaxLength(nb,rowStride) );
+            FastResize( slot.buf, (distStride+1)*slot.portionSize );
+            copy::util::InterleaveMatrix
+            ( A11.LocalHeight(), A11.LocalWidth(),
+              A11.LockedBuffer(), 1, A11.LDim(),
+              slot.buf.data(),    1, A11.LocalHeight() );
+            mpi::IAllGather
+            ( slot.buf.data(), int(slot.portionSize),
+              &slot.buf[slot.portionSize], int(slot.portionSize),
+              A_.DistComm(), slot.request );
+            slot.inFlight = true;
+            slot.unpacked = false;
+            return;
+        }
+#endif
+        // Nothing to overlap; perform the redistribution immediately
+        slot.D = A11;
+        slot.inFlight = false;
+        slot.unpacked = true;
+    }
+
+    const DistMatrix<F,U,V>& A_;
+    Int step_, nextOffset_, depth_;
+    vector<PanelSlot> slots_;
+};
+
+} // namespace trsm
+} // namespace El
@@ -9,13 +9,29 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include <atomic>
+
 #include "./TwoSidedTrsm/Unblocked.hpp"
 #include "./TwoSidedTrsm/LVar4.hpp"
 #include "./TwoSidedTrsm/UVar4.hpp"
 
+namespace {
+
+// How many block steps share one pair of aggregated triangular-panel
+// stagings in the distributed algorithm
+std::atomic<El::Int> twoSidedTrsmAggDepth( 4 );
+
+}
+
 namespace El {
 
-template<typename F> 
+void SetTwoSidedTrsmAggDepth( Int depth )
+{ ::twoSidedTrsmAggDepth = Max( depth, Int(1) ); }
+
+Int TwoSidedTrsmAggDepth() EL_NO_EXCEPT
+{ return ::twoSidedTrsmAggDepth.load( std::memory_order_relaxed ); }
+
+template<typename F>
 void TwoSidedTrsm
 ( UpperOrLower uplo, UnitOrNonUnit diag,
         Matrix<F>& A,
@@ -36,7 +52,13 @@ void TwoSidedTrsm
 {
     EL_DEBUG_CSE
     if( uplo == LOWER )
-        twotrsm::LVar4( diag, A, B );
+    {
+        const Int depth = TwoSidedTrsmAggDepth();
+        if( depth > 1 )
+            twotrsm::LVar4Agg( diag, A, B, depth );
+        else
+            twotrsm::LVar4( diag, A, B );
+    }
     else
         twotrsm::UVar4( diag, A, B );
 }
@@ -0,0 +1,446 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Lazy Kronecker-product operators of the form sum_k A_k (x) B_k. The
+// application of a single term to a vec'd column is the "vec trick",
+//
+//   (A (x) B) vec(X) = vec(B X A^T),
+//
+// so each term costs two Gemms on the factors instead of a pass over the
+// materialized product. One-term direct solves use
+// inv(A (x) B) = inv(A) (x) inv(B), and two-term solves left- and
+// right-multiply by the inverses of one factor pair to reach a standard
+// Sylvester equation, which is handed to the sign-function solver.
+
+namespace El {
+
+// Sequential
+// ==========
+
+template<typename Field>
+KroneckerOperator<Field>::KroneckerOperator()
+{ }
+
+template<typename Field>
+void KroneckerOperator<Field>::AddTerm
+( const Matrix<Field>& A, const Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( AFactors_.empty() )
+    {
+        mA_ = A.Height();
+        nA_ = A.Width();
+        mB_ = B.Height();
+        nB_ = B.Width();
+    }
+    else if( A.Height() != mA_ || A.Width() != nA_ ||
+             B.Height() != mB_ || B.Width() != nB_ )
+        LogicError("Each term must have matching factor shapes");
+    AFactors_.push_back( A );
+    BFactors_.push_back( B );
+}
+
+template<typename Field>
+Int KroneckerOperator<Field>::Height() const EL_NO_EXCEPT
+{ return mA_*mB_; }
+
+template<typename Field>
+Int KroneckerOperator<Field>::Width() const EL_NO_EXCEPT
+{ return nA_*nB_; }
+
+template<typename Field>
+Int KroneckerOperator<Field>::NumTerms() const EL_NO_EXCEPT
+{ return AFactors_.size(); }
+
+template<typename Field>
+void KroneckerOperator<Field>::Apply
+( const Matrix<Field>& X, Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( X.Height() != Width() )
+        LogicError("X was the wrong height");
+    const Int numRHS = X.Width();
+    const Int numTerms = NumTerms();
+    Y.Resize( Height(), numRHS );
+    Matrix<Field> W, T, YMat;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto x = X( ALL, IR(j) );
+        Reshape( nB_, nA_, x, W );
+        Zeros( YMat, mB_, mA_ );
+        for( Int k=0; k<numTerms; ++k )
+        {
+            Gemm( NORMAL, NORMAL, Field(1), BFactors_[k], W, T );
+            Gemm( NORMAL, TRANSPOSE, Field(1), T, AFactors_[k],
+                  Field(1), YMat );
+        }
+        auto y = Y( ALL, IR(j) );
+        Reshape( Height(), 1, YMat, y );
+    }
+}
+
+template<typename Field>
+void KroneckerOperator<Field>::AdjointApply
+( const Matrix<Field>& X, Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( X.Height() != Height() )
+        LogicError("X was the wrong height");
+    const Int numRHS = X.Width();
+    const Int numTerms = NumTerms();
+    Y.Resize( Width(), numRHS );
+    Matrix<Field> W, T, S, YMat;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto x = X( ALL, IR(j) );
+        Reshape( mB_, mA_, x, W );
+        Zeros( YMat, nB_, nA_ );
+        for( Int k=0; k<numTerms; ++k )
+        {
+            // YMat += B_k^H W Conj(A_k), via conjugating around a Gemm
+            Gemm( ADJOINT, NORMAL, Field(1), BFactors_[k], W, T );
+            Conjugate( T );
+            Gemm( NORMAL, NORMAL, Field(1), T, AFactors_[k], S );
+            Conjugate( S );
+            Axpy( Field(1), S, YMat );
+        }
+        auto y = Y( ALL, IR(j) );
+        Reshape( Width(), 1, YMat, y );
+    }
+}
+
+template<typename Field>
+void KroneckerOperator<Field>::Materialize( Matrix<Field>& S ) const
+{
+    EL_DEBUG_CSE
+    const Int numTerms = NumTerms();
+    Zeros( S, Height(), Width() );
+    Matrix<Field> T;
+    for( Int k=0; k<numTerms; ++k )
+    {
+        Kronecker( AFactors_[k], BFactors_[k], T );
+        Axpy( Field(1), T, S );
+    }
+}
+
+template<typename Field>
+void KroneckerOperator<Field>::Solve
+( Matrix<Field>& B, SignCtrl<Base<Field>> ctrl ) const
+{
+    EL_DEBUG_CSE
+    const Int numTerms = NumTerms();
+    if( numTerms == 0 )
+        LogicError("The operator has no terms");
+    if( mA_ != nA_ || mB_ != nB_ )
+        LogicError("Direct solves require square factors");
+    if( B.Height() != Height() )
+        LogicError("B was the wrong height");
+    const Int numRHS = B.Width();
+    if( numTerms == 1 )
+    {
+        Matrix<Field> W, WT;
+        for( Int j=0; j<numRHS; ++j )
+        {
+            auto b = B( ALL, IR(j) );
+            Reshape( mB_, mA_, b, W );
+            LinearSolve( BFactors_[0], W );
+            Transpose( W, WT );
+            LinearSolve( AFactors_[0], WT );
+            Transpose( WT, W );
+            Reshape( Height(), 1, W, b );
+        }
+    }
+    else if( numTerms == 2 )
+    {
+        // Reduce B_1 X A_1^T + B_2 X A_2^T = C to the Sylvester equation
+        //
+        //   (inv(B_2) B_1) X + X (inv(A_1) A_2)^T = inv(B_2) C inv(A_1)^T
+        //
+        Matrix<Field> AS( BFactors_[0] ), W( AFactors_[1] ), BS;
+        LinearSolve( BFactors_[1], AS );
+        LinearSolve( AFactors_[0], W );
+        Transpose( W, BS );
+        Matrix<Field> C, CT, X;
+        for( Int j=0; j<numRHS; ++j )
+        {
+            auto b = B( ALL, IR(j) );
+            Reshape( mB_, mA_, b, C );
+            LinearSolve( BFactors_[1], C );
+            Transpose( C, CT );
+            LinearSolve( AFactors_[0], CT );
+            Transpose( CT, C );
+            Sylvester( AS, BS, C, X, ctrl );
+            Reshape( Height(), 1, X, b );
+        }
+    }
+    else
+        LogicError("Direct solves require one or two Kronecker terms");
+}
+
+template<typename Field>
+void KroneckerOperator<Field>::LeastSquares
+( const Matrix<Field>& B, Matrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( NumTerms() != 1 )
+        LogicError("Kronecker least squares requires a single term");
+    if( B.Height() != Height() )
+        LogicError("B was the wrong height");
+    const Int numRHS = B.Width();
+    X.Resize( Width(), numRHS );
+    Matrix<Field> C, W, WT, ZT, Z;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        Reshape( mB_, mA_, b, C );
+        El::LeastSquares( NORMAL, BFactors_[0], C, W );
+        Transpose( W, WT );
+        El::LeastSquares( NORMAL, AFactors_[0], WT, ZT );
+        Transpose( ZT, Z );
+        auto x = X( ALL, IR(j) );
+        Reshape( Width(), 1, Z, x );
+    }
+}
+
+// Distributed
+// ===========
+
+template<typename Field>
+DistKroneckerOperator<Field>::DistKroneckerOperator( const El::Grid& g )
+: grid_(&g)
+{ }
+
+template<typename Field>
+void DistKroneckerOperator<Field>::AddTerm
+( const ElementalMatrix<Field>& A, const ElementalMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( AFactors_.empty() )
+    {
+        mA_ = A.Height();
+        nA_ = A.Width();
+        mB_ = B.Height();
+        nB_ = B.Width();
+    }
+    else if( A.Height() != mA_ || A.Width() != nA_ ||
+             B.Height() != mB_ || B.Width() != nB_ )
+        LogicError("Each term must have matching factor shapes");
+    AFactors_.emplace_back( A );
+    BFactors_.emplace_back( B );
+}
+
+template<typename Field>
+Int DistKroneckerOperator<Field>::Height() const EL_NO_EXCEPT
+{ return mA_*mB_; }
+
+template<typename Field>
+Int DistKroneckerOperator<Field>::Width() const EL_NO_EXCEPT
+{ return nA_*nB_; }
+
+template<typename Field>
+Int DistKroneckerOperator<Field>::NumTerms() const EL_NO_EXCEPT
+{ return AFactors_.size(); }
+
+template<typename Field>
+const El::Grid& DistKroneckerOperator<Field>::Grid() const EL_NO_EXCEPT
+{ return *grid_; }
+
+template<typename Field>
+void DistKroneckerOperator<Field>::Apply
+( const ElementalMatrix<Field>& XPre, ElementalMatrix<Field>& YPre ) const
+{
+    EL_DEBUG_CSE
+    if( XPre.Height() != Width() )
+        LogicError("X was the wrong height");
+
+    DistMatrixReadProxy<Field,Field,MC,MR> XProx( XPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> YProx( YPre );
+    auto& X = XProx.GetLocked();
+    auto& Y = YProx.Get();
+
+    const Int numRHS = X.Width();
+    const Int numTerms = NumTerms();
+    const El::Grid& g = *grid_;
+    Y.Resize( Height(), numRHS );
+    DistMatrix<Field> W(g), T(g), YMat(g);
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto x = X( ALL, IR(j) );
+        Reshape( nB_, nA_, x, W );
+        Zeros( YMat, mB_, mA_ );
+        for( Int k=0; k<numTerms; ++k )
+        {
+            Gemm( NORMAL, NORMAL, Field(1), BFactors_[k], W, T );
+            Gemm( NORMAL, TRANSPOSE, Field(1), T, AFactors_[k],
+                  Field(1), YMat );
+        }
+        auto y = Y( ALL, IR(j) );
+        Reshape( Height(), 1, YMat, y );
+    }
+}
+
+template<typename Field>
+void DistKroneckerOperator<Field>::AdjointApply
+( const ElementalMatrix<Field>& XPre, ElementalMatrix<Field>& YPre ) const
+{
+    EL_DEBUG_CSE
+    if( XPre.Height() != Height() )
+        LogicError("X was the wrong height");
+
+    DistMatrixReadProxy<Field,Field,MC,MR> XProx( XPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> YProx( YPre );
+    auto& X = XProx.GetLocked();
+    auto& Y = YProx.Get();
+
+    const Int numRHS = X.Width();
+    const Int numTerms = NumTerms();
+    const El::Grid& g = *grid_;
+    Y.Resize( Width(), numRHS );
+    DistMatrix<Field> W(g), T(g), S(g), YMat(g);
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto x = X( ALL, IR(j) );
+        Reshape( mB_, mA_, x, W );
+        Zeros( YMat, nB_, nA_ );
+        for( Int k=0; k<numTerms; ++k )
+        {
+            // YMat += B_k^H W Conj(A_k), via conjugating around a Gemm
+            Gemm( ADJOINT, NORMAL, Field(1), BFactors_[k], W, T );
+            Conjugate( T );
+            Gemm( NORMAL, NORMAL, Field(1), T, AFactors_[k], S );
+            Conjugate( S );
+            Axpy( Field(1), S, YMat );
+        }
+        auto y = Y( ALL, IR(j) );
+        Reshape( Width(), 1, YMat, y );
+    }
+}
+
+template<typename Field>
+void DistKroneckerOperator<Field>::Materialize( ElementalMatrix<Field>& S ) const
+{
+    EL_DEBUG_CSE
+    const Int numTerms = NumTerms();
+    const El::Grid& g = *grid_;
+    S.SetGrid( g );
+    Zeros( S, Height(), Width() );
+    DistMatrix<Field> T(g);
+    for( Int k=0; k<numTerms; ++k )
+    {
+        // The level-1 Kronecker kernel expects sequential factors
+        DistMatrix<Field,STAR,STAR> ALoc( AFactors_[k] ), BLoc( BFactors_[k] );
+        Kronecker( ALoc.LockedMatrix(), BLoc.LockedMatrix(), T );
+        Axpy( Field(1), T, S );
+    }
+}
+
+template<typename Field>
+void DistKroneckerOperator<Field>::Solve
+( ElementalMatrix<Field>& BPre, SignCtrl<Base<Field>> ctrl ) const
+{
+    EL_DEBUG_CSE
+    const Int numTerms = NumTerms();
+    if( numTerms == 0 )
+        LogicError("The operator has no terms");
+    if( mA_ != nA_ || mB_ != nB_ )
+        LogicError("Direct solves require square factors");
+    if( BPre.Height() != Height() )
+        LogicError("B was the wrong height");
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    const Int numRHS = B.Width();
+    const El::Grid& g = *grid_;
+    if( numTerms == 1 )
+    {
+        DistMatrix<Field> W(g), WT(g);
+        for( Int j=0; j<numRHS; ++j )
+        {
+            auto b = B( ALL, IR(j) );
+            Reshape( mB_, mA_, b, W );
+            LinearSolve( BFactors_[0], W );
+            Transpose( W, WT );
+            LinearSolve( AFactors_[0], WT );
+            Transpose( WT, W );
+            Reshape( Height(), 1, W, b );
+        }
+    }
+    else if( numTerms == 2 )
+    {
+        // Reduce B_1 X A_1^T + B_2 X A_2^T = C to the Sylvester equation
+        //
+        //   (inv(B_2) B_1) X + X (inv(A_1) A_2)^T = inv(B_2) C inv(A_1)^T
+        //
+        DistMatrix<Field> AS( BFactors_[0] ), W( AFactors_[1] ), BS(g);
+        LinearSolve( BFactors_[1], AS );
+        LinearSolve( AFactors_[0], W );
+        Transpose( W, BS );
+        DistMatrix<Field> C(g), CT(g), X(g);
+        for( Int j=0; j<numRHS; ++j )
+        {
+            auto b = B( ALL, IR(j) );
+            Reshape( mB_, mA_, b, C );
+            LinearSolve( BFactors_[1], C );
+            Transpose( C, CT );
+            LinearSolve( AFactors_[0], CT );
+            Transpose( CT, C );
+            Sylvester( AS, BS, C, X, ctrl );
+            Reshape( Height(), 1, X, b );
+        }
+    }
+    else
+        LogicError("Direct solves require one or two Kronecker terms");
+}
+
+template<typename Field>
+void DistKroneckerOperator<Field>::LeastSquares
+( const ElementalMatrix<Field>& BPre, ElementalMatrix<Field>& XPre ) const
+{
+    EL_DEBUG_CSE
+    if( NumTerms() != 1 )
+        LogicError("Kronecker least squares requires a single term");
+    if( BPre.Height() != Height() )
+        LogicError("B was the wrong height");
+
+    DistMatrixReadProxy<Field,Field,MC,MR> BProx( BPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> XProx( XPre );
+    auto& B = BProx.GetLocked();
+    auto& X = XProx.Get();
+
+    const Int numRHS = B.Width();
+    const El::Grid& g = *grid_;
+    X.Resize( Width(), numRHS );
+    DistMatrix<Field> C(g), W(g), WT(g), ZT(g), Z(g);
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        Reshape( mB_, mA_, b, C );
+        El::LeastSquares( NORMAL, BFactors_[0], C, W );
+        Transpose( W, WT );
+        El::LeastSquares( NORMAL, AFactors_[0], WT, ZT );
+        Transpose( ZT, Z );
+        auto x = X( ALL, IR(j) );
+        Reshape( Width(), 1, Z, x );
+    }
+}
+
+#define PROTO(Field) \
+  template class KroneckerOperator<Field>; \
+  template class DistKroneckerOperator<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
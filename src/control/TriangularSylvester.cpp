@@ -0,0 +1,304 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Recursive blocked solvers for the triangular Sylvester equation
+//
+//   A X + X op(B) = C,
+//
+// where A and B are upper triangular, in the style of RECSY [Jonsson and
+// Kagstrom, 2002]: the larger of the two dimensions is halved, the
+// subproblem whose solution feeds the other is solved first, the coupling
+// is applied as a Gemm update, and the remaining subproblem is then solved.
+// All but the O(blockSize^2) leaf solves are therefore level-3 kernels, and
+// the distributed driver only serializes the leaves (which are solved
+// redundantly from [*,*] gathers) rather than the entire back-substitution.
+
+namespace El {
+
+namespace triang_sylv {
+
+// Overwrite C with the solution of A X + X op(B) = C via back-substitution
+template<typename F>
+void BaseCase
+( Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = B.Height();
+    const bool normalB = ( orientB == NORMAL );
+    for( Int jj=0; jj<n; ++jj )
+    {
+        // The columns of X couple through op(B), which is upper triangular
+        // when op is the identity and lower triangular otherwise, so sweep
+        // the columns forward or backward accordingly and subtract the
+        // contributions of the already-solved columns
+        const Int j = ( normalB ? jj : n-1-jj );
+        if( normalB )
+        {
+            for( Int l=0; l<j; ++l )
+            {
+                const F bVal = B(l,j);
+                if( bVal != F(0) )
+                    for( Int i=0; i<m; ++i )
+                        C(i,j) -= C(i,l)*bVal;
+            }
+        }
+        else
+        {
+            for( Int l=j+1; l<n; ++l )
+            {
+                const F bVal =
+                  ( orientB == ADJOINT ? Conj(B(j,l)) : B(j,l) );
+                if( bVal != F(0) )
+                    for( Int i=0; i<m; ++i )
+                        C(i,j) -= C(i,l)*bVal;
+            }
+        }
+
+        // Solve the shifted triangular system (A + op(B)_jj I) x_j = c_j
+        const F shift = ( orientB == ADJOINT ? Conj(B(j,j)) : B(j,j) );
+        for( Int i=m-1; i>=0; --i )
+        {
+            F sum = C(i,j);
+            for( Int k=i+1; k<m; ++k )
+                sum -= A(i,k)*C(k,j);
+            const F delta = A(i,i) + shift;
+            if( delta == F(0) )
+                RuntimeError
+                ("A and -op(B) share an eigenvalue: the triangular "
+                 "Sylvester operator is singular");
+            C(i,j) = sum/delta;
+        }
+    }
+}
+
+template<typename F>
+void Recurse
+( Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& C,
+  Int blockSize )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = B.Height();
+    if( m <= blockSize && n <= blockSize )
+    {
+        BaseCase( orientB, A, B, C );
+        return;
+    }
+
+    if( m >= n )
+    {
+        // Halve the row dimension: the bottom block row of X only involves
+        // A11, and its coupling into the top block row is the Gemm update
+        // C0 -= A01 X1
+        const Int mHalf = m/2;
+        const auto ind0 = IR(0,mHalf), ind1 = IR(mHalf,m);
+        auto A00 = A( ind0, ind0 );
+        auto A01 = A( ind0, ind1 );
+        auto A11 = A( ind1, ind1 );
+        auto C0 = C( ind0, ALL );
+        auto C1 = C( ind1, ALL );
+        Recurse( orientB, A11, B, C1, blockSize );
+        Gemm( NORMAL, NORMAL, F(-1), A01, C1, F(1), C0 );
+        Recurse( orientB, A00, B, C0, blockSize );
+    }
+    else
+    {
+        // Halve the column dimension: op(B) couples the solved block column
+        // of X into the unsolved one through the off-diagonal block B01
+        const Int nHalf = n/2;
+        const auto ind0 = IR(0,nHalf), ind1 = IR(nHalf,n);
+        auto B00 = B( ind0, ind0 );
+        auto B01 = B( ind0, ind1 );
+        auto B11 = B( ind1, ind1 );
+        auto C0 = C( ALL, ind0 );
+        auto C1 = C( ALL, ind1 );
+        if( orientB == NORMAL )
+        {
+            Recurse( orientB, A, B00, C0, blockSize );
+            Gemm( NORMAL, NORMAL, F(-1), C0, B01, F(1), C1 );
+            Recurse( orientB, A, B11, C1, blockSize );
+        }
+        else
+        {
+            Recurse( orientB, A, B11, C1, blockSize );
+            Gemm( NORMAL, orientB, F(-1), C1, B01, F(1), C0 );
+            Recurse( orientB, A, B00, C0, blockSize );
+        }
+    }
+}
+
+template<typename F>
+void Recurse
+( Orientation orientB,
+  const DistMatrix<F>& A,
+  const DistMatrix<F>& B,
+        DistMatrix<F>& C,
+  Int blockSize )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = B.Height();
+    if( m <= blockSize && n <= blockSize )
+    {
+        // Gather the leaf subproblem and solve it redundantly
+        DistMatrix<F,STAR,STAR> ASub( A ), BSub( B ), CSub( C );
+        BaseCase( orientB, ASub.Matrix(), BSub.Matrix(), CSub.Matrix() );
+        C = CSub;
+        return;
+    }
+
+    if( m >= n )
+    {
+        const Int mHalf = m/2;
+        const auto ind0 = IR(0,mHalf), ind1 = IR(mHalf,m);
+        auto A00 = A( ind0, ind0 );
+        auto A01 = A( ind0, ind1 );
+        auto A11 = A( ind1, ind1 );
+        auto C0 = C( ind0, ALL );
+        auto C1 = C( ind1, ALL );
+        Recurse( orientB, A11, B, C1, blockSize );
+        Gemm( NORMAL, NORMAL, F(-1), A01, C1, F(1), C0 );
+        Recurse( orientB, A00, B, C0, blockSize );
+    }
+    else
+    {
+        const Int nHalf = n/2;
+        const auto ind0 = IR(0,nHalf), ind1 = IR(nHalf,n);
+        auto B00 = B( ind0, ind0 );
+        auto B01 = B( ind0, ind1 );
+        auto B11 = B( ind1, ind1 );
+        auto C0 = C( ALL, ind0 );
+        auto C1 = C( ALL, ind1 );
+        if( orientB == NORMAL )
+        {
+            Recurse( orientB, A, B00, C0, blockSize );
+            Gemm( NORMAL, NORMAL, F(-1), C0, B01, F(1), C1 );
+            Recurse( orientB, A, B11, C1, blockSize );
+        }
+        else
+        {
+            Recurse( orientB, A, B11, C1, blockSize );
+            Gemm( NORMAL, orientB, F(-1), C1, B01, F(1), C0 );
+            Recurse( orientB, A, B00, C0, blockSize );
+        }
+    }
+}
+
+} // namespace triang_sylv
+
+template<typename F>
+void TriangularSylvester
+( Orientation orientB,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& C,
+  Int blockSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != B.Width() )
+          LogicError("B must be square");
+      if( C.Height() != A.Height() || C.Width() != B.Height() )
+          LogicError("C must conform with A and B");
+    )
+    if( blockSize < 1 )
+        LogicError("blockSize must be positive");
+    triang_sylv::Recurse( orientB, A, B, C, blockSize );
+}
+
+template<typename F>
+void TriangularSylvester
+( Orientation orientB,
+  const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& BPre,
+        ElementalMatrix<F>& CPre,
+  Int blockSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( BPre.Height() != BPre.Width() )
+          LogicError("B must be square");
+      if( CPre.Height() != APre.Height() || CPre.Width() != BPre.Height() )
+          LogicError("C must conform with A and B");
+    )
+    if( blockSize < 1 )
+        LogicError("blockSize must be positive");
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    triang_sylv::Recurse( orientB, A, B, C, blockSize );
+}
+
+// A X + X A^H = C is the orientB=ADJOINT Sylvester equation with B=A
+template<typename F>
+void TriangularLyapunov
+( const Matrix<F>& A,
+        Matrix<F>& C,
+  Int blockSize )
+{
+    EL_DEBUG_CSE
+    TriangularSylvester( ADJOINT, A, A, C, blockSize );
+}
+
+template<typename F>
+void TriangularLyapunov
+( const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& C,
+  Int blockSize )
+{
+    EL_DEBUG_CSE
+    TriangularSylvester( ADJOINT, A, A, C, blockSize );
+}
+
+#define PROTO(F) \
+  template void TriangularSylvester \
+  ( Orientation orientB, \
+    const Matrix<F>& A, \
+    const Matrix<F>& B, \
+          Matrix<F>& C, \
+    Int blockSize ); \
+  template void TriangularSylvester \
+  ( Orientation orientB, \
+    const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+          ElementalMatrix<F>& C, \
+    Int blockSize ); \
+  template void TriangularLyapunov \
+  ( const Matrix<F>& A, \
+          Matrix<F>& C, \
+    Int blockSize ); \
+  template void TriangularLyapunov \
+  ( const ElementalMatrix<F>& A, \
+          ElementalMatrix<F>& C, \
+    Int blockSize );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <cstring>
+
+namespace {
+
+const size_t minMatch = 4;
+// Matches are not begun within the last few bytes so that the tail is
+// always emitted as literals (mirroring the LZ4 end-of-block rule)
+const size_t tailLiterals = 12;
+const size_t maxOffset = 65535;
+const int hashBits = 13;
+
+inline El::Unsigned Load32( const El::byte* p )
+{
+    El::Unsigned u=0;
+    std::memcpy( &u, p, 4 );
+    return u;
+}
+
+inline size_t Hash32( El::Unsigned u )
+{ return size_t((u*2654435761u) >> (32-hashBits)) & ((1u<<hashBits)-1); }
+
+} // anonymous namespace
+
+namespace El {
+
+size_t CompressBound( size_t rawSize )
+{ return rawSize + rawSize/255 + 16; }
+
+size_t Compress
+( const byte* raw, size_t rawSize,
+        byte* compressed, size_t compressedCap )
+{
+    EL_DEBUG_CSE
+    size_t out = 0;
+
+    // Write a length of at least 'base' using the nibble-plus-255-byte
+    // extension scheme; returns false on overflow of the output capacity
+    auto putExtLength =
+      [&]( size_t length )
+      {
+          while( length >= 255 )
+          {
+              if( out >= compressedCap ) return false;
+              compressed[out++] = byte(255);
+              length -= 255;
+          }
+          if( out >= compressedCap ) return false;
+          compressed[out++] = byte(length);
+          return true;
+      };
+    auto putSequence =
+      [&]( size_t litLen, const byte* literals, size_t matchLen,
+           size_t offset )
+      {
+          const size_t litCode = Min( litLen, size_t(15) );
+          const size_t matchCode =
+            ( matchLen==0 ? size_t(0) : Min( matchLen-minMatch, size_t(15) ) );
+          if( out >= compressedCap ) return false;
+          compressed[out++] = byte((litCode<<4) | matchCode);
+          if( litCode == 15 && !putExtLength( litLen-15 ) ) return false;
+          if( out+litLen > compressedCap ) return false;
+          std::memcpy( &compressed[out], literals, litLen );
+          out += litLen;
+          if( matchLen == 0 ) return true;
+          if( out+2 > compressedCap ) return false;
+          compressed[out++] = byte(offset & 0xff);
+          compressed[out++] = byte(offset >> 8);
+          if( matchCode == 15 && !putExtLength( matchLen-minMatch-15 ) )
+              return false;
+          return true;
+      };
+
+    std::vector<ptrdiff_t> table( size_t(1)<<hashBits, -1 );
+    const size_t matchableEnd =
+      ( rawSize > tailLiterals ? rawSize-tailLiterals : 0 );
+
+    size_t pos=0, anchor=0;
+    while( pos+minMatch <= matchableEnd )
+    {
+        const Unsigned seq = Load32( &raw[pos] );
+        const size_t h = Hash32( seq );
+        const ptrdiff_t candidate = table[h];
+        table[h] = ptrdiff_t(pos);
+        if( candidate >= 0 &&
+            size_t(pos)-size_t(candidate) <= maxOffset &&
+            Load32( &raw[candidate] ) == seq )
+        {
+            size_t matchLen = minMatch;
+            const size_t matchLimit = rawSize - (tailLiterals-minMatch);
+            while( pos+matchLen < matchLimit &&
+                   raw[size_t(candidate)+matchLen] == raw[pos+matchLen] )
+                ++matchLen;
+            if( !putSequence
+                 ( pos-anchor, &raw[anchor], matchLen,
+                   size_t(pos)-size_t(candidate) ) )
+                return 0;
+            pos += matchLen;
+            anchor = pos;
+        }
+        else
+            ++pos;
+    }
+    // The final sequence is pure literals
+    if( !putSequence( rawSize-anchor, &raw[anchor], 0, 0 ) )
+        return 0;
+    return out;
+}
+
+void Decompress
+( const byte* compressed, size_t compressedSize,
+        byte* raw, size_t rawSize )
+{
+    EL_DEBUG_CSE
+    size_t in=0, out=0;
+
+    auto getExtLength =
+      [&]( size_t& length )
+      {
+          byte ext;
+          do
+          {
+              if( in >= compressedSize )
+                  RuntimeError("Corrupt compressed stream: truncated length");
+              ext = compressed[in++];
+              length += size_t(ext);
+          } while( ext == byte(255) );
+      };
+
+    while( in < compressedSize )
+    {
+        const byte token = compressed[in++];
+        size_t litLen = size_t(token >> 4);
+        if( litLen == 15 )
+            getExtLength( litLen );
+        if( in+litLen > compressedSize || out+litLen > rawSize )
+            RuntimeError("Corrupt compressed stream: bad literal run");
+        std::memcpy( &raw[out], &compressed[in], litLen );
+        in += litLen;
+        out += litLen;
+        if( in == compressedSize )
+            break;
+
+        if( in+2 > compressedSize )
+            RuntimeError("Corrupt compressed stream: truncated offset");
+        const size_t offset =
+          size_t(compressed[in]) | (size_t(compressed[in+1])<<8);
+        in += 2;
+        if( offset == 0 || offset > out )
+            RuntimeError("Corrupt compressed stream: invalid offset");
+        size_t matchLen = size_t(token & byte(15));
+        if( matchLen == 15 )
+            getExtLength( matchLen );
+        matchLen += minMatch;
+        if( out+matchLen > rawSize )
+            RuntimeError("Corrupt compressed stream: match overruns output");
+        // The regions may overlap, so copy bytewise in order
+        const byte* ref = &raw[out-offset];
+        for( size_t k=0; k<matchLen; ++k )
+            raw[out+k] = ref[k];
+        out += matchLen;
+    }
+    if( out != rawSize )
+        RuntimeError
+        ("Compressed stream decoded to ",out," bytes instead of ",rawSize);
+}
+
+} // namespace El
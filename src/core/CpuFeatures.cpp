@@ -0,0 +1,208 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#if defined(__aarch64__) && defined(__linux__)
+# include <sys/auxv.h>
+#endif
+
+// Function multiversioning for the hot local kernels: on x86-64 the same
+// loop body is compiled under the baseline, AVX2, and AVX-512 instruction
+// sets (via per-function target attributes, so no special build flags are
+// required), and a function pointer is bound once, on first use, to the
+// widest version the executing processor supports. On AArch64 the SVE bit
+// is detected and exposed through LocalCpuFeatures, but the kernels fall
+// back to the baseline build since SVE code generation requires
+// compile-time -march support.
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+# define EL_X86_MULTIVERSION
+#endif
+
+namespace El {
+
+const CpuFeatures& LocalCpuFeatures()
+{
+    static const CpuFeatures features = []()
+    {
+        CpuFeatures f;
+#ifdef EL_X86_MULTIVERSION
+        __builtin_cpu_init();
+        f.avx2 = bool(__builtin_cpu_supports("avx2"));
+        f.avx512f = bool(__builtin_cpu_supports("avx512f"));
+#elif defined(__aarch64__) && defined(__linux__) && defined(HWCAP_SVE)
+        f.sve = ( getauxval(AT_HWCAP) & HWCAP_SVE ) != 0;
+#endif
+        return f;
+    }();
+    return features;
+}
+
+namespace simd {
+
+namespace {
+
+// The shared loop bodies; when inlined into a target-annotated wrapper,
+// the autovectorizer is free to use that wrapper's instruction set
+template<typename T>
+inline void StridedCopyBody
+( T* dest, Int destStride, const T* source, Int sourceStride, Int n )
+{
+    if( destStride == 1 && sourceStride == 1 )
+    {
+        for( Int k=0; k<n; ++k )
+            dest[k] = source[k];
+    }
+    else
+    {
+        for( Int k=0; k<n; ++k )
+            dest[destStride*k] = source[sourceStride*k];
+    }
+}
+
+template<typename T>
+inline void StridedAxpyBody
+( T alpha, const T* source, Int sourceStride, T* dest, Int destStride, Int n )
+{
+    if( destStride == 1 && sourceStride == 1 )
+    {
+        for( Int k=0; k<n; ++k )
+            dest[k] += alpha*source[k];
+    }
+    else
+    {
+        for( Int k=0; k<n; ++k )
+            dest[destStride*k] += alpha*source[sourceStride*k];
+    }
+}
+
+#ifdef EL_X86_MULTIVERSION
+# define EL_DEFINE_SIMD_VERSIONS(T,SUFFIX) \
+  void StridedCopy_##SUFFIX##_Base \
+  ( T* dest, Int ds, const T* source, Int ss, Int n ) \
+  { StridedCopyBody( dest, ds, source, ss, n ); } \
+  __attribute__((target("avx2,fma"))) \
+  void StridedCopy_##SUFFIX##_AVX2 \
+  ( T* dest, Int ds, const T* source, Int ss, Int n ) \
+  { StridedCopyBody( dest, ds, source, ss, n ); } \
+  __attribute__((target("avx512f"))) \
+  void StridedCopy_##SUFFIX##_AVX512 \
+  ( T* dest, Int ds, const T* source, Int ss, Int n ) \
+  { StridedCopyBody( dest, ds, source, ss, n ); } \
+  void StridedAxpy_##SUFFIX##_Base \
+  ( T alpha, const T* source, Int ss, T* dest, Int ds, Int n ) \
+  { StridedAxpyBody( alpha, source, ss, dest, ds, n ); } \
+  __attribute__((target("avx2,fma"))) \
+  void StridedAxpy_##SUFFIX##_AVX2 \
+  ( T alpha, const T* source, Int ss, T* dest, Int ds, Int n ) \
+  { StridedAxpyBody( alpha, source, ss, dest, ds, n ); } \
+  __attribute__((target("avx512f"))) \
+  void StridedAxpy_##SUFFIX##_AVX512 \
+  ( T alpha, const T* source, Int ss, T* dest, Int ds, Int n ) \
+  { StridedAxpyBody( alpha, source, ss, dest, ds, n ); }
+#else
+# define EL_DEFINE_SIMD_VERSIONS(T,SUFFIX) \
+  void StridedCopy_##SUFFIX##_Base \
+  ( T* dest, Int ds, const T* source, Int ss, Int n ) \
+  { StridedCopyBody( dest, ds, source, ss, n ); } \
+  void StridedAxpy_##SUFFIX##_Base \
+  ( T alpha, const T* source, Int ss, T* dest, Int ds, Int n ) \
+  { StridedAxpyBody( alpha, source, ss, dest, ds, n ); }
+#endif
+
+EL_DEFINE_SIMD_VERSIONS(float,F)
+EL_DEFINE_SIMD_VERSIONS(double,D)
+
+#undef EL_DEFINE_SIMD_VERSIONS
+
+typedef void (*StridedCopyF)( float*, Int, const float*, Int, Int );
+typedef void (*StridedCopyD)( double*, Int, const double*, Int, Int );
+typedef void (*StridedAxpyF)( float, const float*, Int, float*, Int, Int );
+typedef void (*StridedAxpyD)( double, const double*, Int, double*, Int, Int );
+
+// Bind each kernel to the widest supported instruction set
+struct KernelTable
+{
+    StridedCopyF stridedCopyF=&StridedCopy_F_Base;
+    StridedCopyD stridedCopyD=&StridedCopy_D_Base;
+    StridedAxpyF stridedAxpyF=&StridedAxpy_F_Base;
+    StridedAxpyD stridedAxpyD=&StridedAxpy_D_Base;
+
+    KernelTable()
+    {
+#ifdef EL_X86_MULTIVERSION
+        const CpuFeatures& features = LocalCpuFeatures();
+        if( features.avx512f )
+        {
+            stridedCopyF = &StridedCopy_F_AVX512;
+            stridedCopyD = &StridedCopy_D_AVX512;
+            stridedAxpyF = &StridedAxpy_F_AVX512;
+            stridedAxpyD = &StridedAxpy_D_AVX512;
+        }
+        else if( features.avx2 )
+        {
+            stridedCopyF = &StridedCopy_F_AVX2;
+            stridedCopyD = &StridedCopy_D_AVX2;
+            stridedAxpyF = &StridedAxpy_F_AVX2;
+            stridedAxpyD = &StridedAxpy_D_AVX2;
+        }
+#endif
+    }
+};
+
+const KernelTable& Kernels()
+{
+    static const KernelTable table;
+    return table;
+}
+
+} // anonymous namespace
+
+void StridedCopy
+(       float* dest,   Int destStride,
+  const float* source, Int sourceStride, Int numEntries )
+{ Kernels().stridedCopyF( dest, destStride, source, sourceStride,
+                          numEntries ); }
+
+void StridedCopy
+(       double* dest,   Int destStride,
+  const double* source, Int sourceStride, Int numEntries )
+{ Kernels().stridedCopyD( dest, destStride, source, sourceStride,
+                          numEntries ); }
+
+void StridedAxpy
+(       float alpha,
+  const float* source, Int sourceStride,
+        float* dest,   Int destStride, Int numEntries )
+{ Kernels().stridedAxpyF( alpha, source, sourceStride, dest, destStride,
+                          numEntries ); }
+
+void StridedAxpy
+(       double alpha,
+  const double* source, Int sourceStride,
+        double* dest,   Int destStride, Int numEntries )
+{ Kernels().stridedAxpyD( alpha, source, sourceStride, dest, destStride,
+                          numEntries ); }
+
+} // namespace simd
+
+// The non-template overloads are preferred over the generic templates
+// during overload resolution, so the pack/unpack and interleave loops pick
+// up the runtime-dispatched kernels without modification
+void StridedMemCopy
+(       float* dest,   Int destStride,
+  const float* source, Int sourceStride, Int numEntries )
+{ simd::StridedCopy( dest, destStride, source, sourceStride, numEntries ); }
+
+void StridedMemCopy
+(       double* dest,   Int destStride,
+  const double* source, Int sourceStride, Int numEntries )
+{ simd::StridedCopy( dest, destStride, source, sourceStride, numEntries ); }
+
+} // namespace El
@@ -13,8 +13,9 @@
 
 namespace {
 
-// Default blocksizes for BlockMatrix
-El::Int blockHeight=32, blockWidth=32;
+// Default blocksizes for BlockMatrix (per-thread, so that concurrently
+// running grids may choose their distributions independently)
+thread_local El::Int blockHeight=32, blockWidth=32;
 
 }
 
@@ -143,6 +143,49 @@ void Conj( const Complex<BigFloat>& alpha, Complex<BigFloat>& alphaConj )
 }
 #endif
 
+// Fused multiply-accumulate
+// -------------------------
+#ifdef EL_HAVE_MPC
+void AddMul( const BigInt& alpha, const BigInt& beta, BigInt& gamma )
+{
+    mpz_addmul
+    ( gamma.Pointer(), alpha.LockedPointer(), beta.LockedPointer() );
+}
+
+void AddMul( const BigFloat& alpha, const BigFloat& beta, BigFloat& gamma )
+{
+    mpfr_fma
+    ( gamma.Pointer(),
+      alpha.LockedPointer(), beta.LockedPointer(), gamma.LockedPointer(),
+      mpfr::RoundingMode() );
+}
+
+void AddMul
+( const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>& beta,
+        Complex<BigFloat>& gamma )
+{
+    mpc_fma
+    ( gamma.Pointer(),
+      alpha.LockedPointer(), beta.LockedPointer(), gamma.LockedPointer(),
+      mpc::RoundingMode() );
+}
+#endif
+
+// Lease a scratch element
+// -----------------------
+#ifdef EL_HAVE_MPC
+ScratchElement<BigFloat>::ScratchElement()
+: lease_(mpfr::AcquireScratch())
+{ }
+
+ScratchElement<BigFloat>::~ScratchElement()
+{ mpfr::ReleaseScratch( lease_ ); }
+
+BigFloat& ScratchElement<BigFloat>::Ref() EL_NO_EXCEPT
+{ return *lease_; }
+#endif
+
 // Return the complex argument
 // ---------------------------
 #ifdef EL_HAVE_QUAD
@@ -9,6 +9,15 @@
 */
 #include <El-lite.hpp>
 
+namespace {
+
+// An optional per-thread override of the process-wide default grid, so
+// that concurrently running threads may confine themselves to disjoint
+// grids without contending for (or racing on) the global default
+thread_local const El::Grid* threadDefaultGrid = nullptr;
+
+}
+
 namespace El {
 
 Grid* Grid::defaultGrid = 0;
@@ -40,9 +49,20 @@ void Grid::FinalizeTrivial()
     trivialGrid = 0;
 }
 
+void Grid::SetThreadDefault( const Grid& grid ) EL_NO_EXCEPT
+{ ::threadDefaultGrid = &grid; }
+
+void Grid::ClearThreadDefault() EL_NO_EXCEPT
+{ ::threadDefaultGrid = nullptr; }
+
+bool Grid::HaveThreadDefault() EL_NO_EXCEPT
+{ return ::threadDefaultGrid != nullptr; }
+
 const Grid& Grid::Default() EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( ::threadDefaultGrid != nullptr )
+        return *::threadDefaultGrid;
     EL_DEBUG_ONLY(
       if( defaultGrid == 0 )
           LogicError
@@ -72,8 +92,70 @@ int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
     return gridHeight;
 }
 
+namespace {
+
+// Return, for each process of 'comm', the rank of the lowest-ranked
+// process with which it shares a node, as discovered through a
+// shared-memory communicator split
+vector<int> NodeLeaders( mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Keying the split on the parent rank keeps the node communicator in
+    // parent-rank order, so its root is the node's lowest parent rank
+    mpi::Comm nodeComm;
+    mpi::SplitShared( comm, commRank, nodeComm );
+    int leader = commRank;
+    mpi::Broadcast( leader, 0, nodeComm );
+    mpi::Free( nodeComm );
+
+    vector<int> leaders( commSize );
+    mpi::AllGather( &leader, 1, leaders.data(), 1, comm );
+    return leaders;
+}
+
+// Compute a permutation of the processes of 'comm' such that building the
+// grid over the permuted order either packs consecutive grid positions
+// onto a node (node-major) or deals each node's processes out across the
+// grid (round-robin). Every process computes the same permutation from
+// the same gathered node information.
+vector<int> TopologyAwareOrdering( mpi::Comm comm, GridMapping mapping )
+{
+    const int commSize = mpi::Size( comm );
+    vector<int> ordering( commSize );
+    for( int q=0; q<commSize; ++q )
+        ordering[q] = q;
+    if( mapping == NATURAL_MAPPING )
+        return ordering;
+
+    const vector<int> leaders = NodeLeaders( comm );
+    vector<int> nodeCounts( commSize, 0 ), indexInNode( commSize );
+    for( int q=0; q<commSize; ++q )
+        indexInNode[q] = nodeCounts[leaders[q]]++;
+
+    if( mapping == NODE_MAJOR_MAPPING )
+    {
+        std::stable_sort
+        ( ordering.begin(), ordering.end(),
+          [&]( int a, int b ) { return leaders[a] < leaders[b]; } );
+    }
+    else
+    {
+        std::stable_sort
+        ( ordering.begin(), ordering.end(),
+          [&]( int a, int b )
+          { return indexInNode[a] != indexInNode[b] ?
+                   indexInNode[a] < indexInNode[b] :
+                   leaders[a] < leaders[b]; } );
+    }
+    return ordering;
+}
+
+} // anonymous namespace
+
 Grid::Grid( mpi::Comm comm, GridOrder order )
-: haveViewers_(false), order_(order)
+: haveViewers_(false), order_(order), mapping_(NATURAL_MAPPING)
 {
     EL_DEBUG_CSE
 
@@ -91,7 +173,7 @@ Grid::Grid( mpi::Comm comm, GridOrder order )
 }
 
 Grid::Grid( mpi::Comm comm, int height, GridOrder order )
-: haveViewers_(false), order_(order)
+: haveViewers_(false), order_(order), mapping_(NATURAL_MAPPING)
 {
     EL_DEBUG_CSE
 
@@ -110,6 +192,60 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
     SetUpGrid();
 }
 
+Grid::Grid( mpi::Comm comm, int height, GridOrder order, GridMapping mapping )
+: haveViewers_(false), order_(order), mapping_(mapping)
+{
+    EL_DEBUG_CSE
+
+    mpi::Dup( comm, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    size_ = mpi::Size( viewingComm_ );
+
+    if( mapping == NATURAL_MAPPING )
+    {
+        owningGroup_ = viewingGroup_;
+    }
+    else
+    {
+        // Reordering the owning group is all that is required: every rank
+        // computation in SetUpGrid is relative to the owning group, the
+        // cartesian communicator is created from it without reordering,
+        // and the translation to viewing ranks runs through mpi::Translate
+        const vector<int> ordering =
+          TopologyAwareOrdering( viewingComm_, mapping );
+        mpi::Incl( viewingGroup_, size_, ordering.data(), owningGroup_ );
+    }
+
+    height_ = height;
+    if( height_ < 0 )
+        LogicError("Process grid dimensions must be non-negative");
+
+    SetUpGrid();
+}
+
+Grid::Grid
+( mpi::Comm comm, int height, GridOrder order,
+  const vector<int>& owningRanks )
+: haveViewers_(false), order_(order), mapping_(USER_MAPPING)
+{
+    EL_DEBUG_CSE
+
+    mpi::Dup( comm, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    size_ = mpi::Size( viewingComm_ );
+    if( int(owningRanks.size()) != size_ )
+        LogicError
+        ("Process ordering listed ",owningRanks.size()," ranks for a "
+         "communicator of ",size_," processes");
+    mpi::Incl( viewingGroup_, size_, owningRanks.data(), owningGroup_ );
+
+    height_ = height;
+    if( height_ < 0 )
+        LogicError("Process grid dimensions must be non-negative");
+
+    SetUpGrid();
+}
+
 void Grid::SetUpGrid()
 {
     EL_DEBUG_CSE
@@ -122,70 +258,39 @@ void Grid::SetUpGrid()
 
     const int width = size_ / height_;
     gcd_ = El::GCD( height_, width );
-    int lcm = size_ / gcd_;
+    const int lcm = size_ / gcd_;
 
     // Create the communicator for the owning group (mpi::COMM_NULL otherwise)
     mpi::Create( viewingComm_, owningGroup_, owningComm_ );
 
-    vcToViewing_.resize(size_);
-    diagsAndRanks_.resize(2*size_);
-    MemZero( diagsAndRanks_.data(), 2*size_ );
+    // Since the cartesian communicator is created without reordering, every
+    // process's position within the grid is a simple function of its rank
+    // within the owning group, and so all of the distribution ranks can be
+    // computed without forming a single derived communicator
     const bool colMajor = (order_==COLUMN_MAJOR);
     if( InGrid() )
     {
-        // Create a cartesian communicator
-        // TODO: Allow for reordering and non-periodicity
-        int dims[2];
         if( colMajor )
         {
-            dims[0] = width;
-            dims[1] = height_;
+            mcRank_ = owningRank_ % height_;
+            mrRank_ = owningRank_ / height_;
         }
         else
         {
-            dims[0] = height_;
-            dims[1] = width;
+            mcRank_ = owningRank_ / width;
+            mrRank_ = owningRank_ % width;
         }
-        int periods[2] = { true, true };
-        bool reorder = false;
-        mpi::CartCreate( owningComm_, 2, dims, periods, reorder, cartComm_ );
-
-        // Set up the MatrixCol and MatrixRow communicators
-        int remainingDims[2];
-        remainingDims[0] = ( colMajor ? false : true  );
-        remainingDims[1] = ( colMajor ? true  : false );
-        mpi::CartSub( cartComm_, remainingDims, mcComm_ );
-        remainingDims[0] = ( colMajor ? true  : false );
-        remainingDims[1] = ( colMajor ? false : true  );
-        mpi::CartSub( cartComm_, remainingDims, mrComm_ );
-        mcRank_ = mpi::Rank( mcComm_ );
-        mrRank_ = mpi::Rank( mrComm_ );
-
-        // Set up the VectorCol and VectorRow communicators
         vcRank_ = mcRank_ + height_*mrRank_;
         vrRank_ = mrRank_ + width*mcRank_;
-        mpi::Split( cartComm_, 0, vcRank_, vcComm_ );
-        mpi::Split( cartComm_, 0, vrRank_, vrComm_ );
-
-        // Set up the map from the VC group to the viewingGroup_ ranks.
-        vector<int> ranks(size_);
-        for( int i=0; i<size_; ++i )
-            ranks[i] = i;
-        mpi::Translate
-        ( vcComm_, size_, ranks.data(), viewingGroup_,  vcToViewing_.data() );
-
-        // Compute which diagonal we're in, and what our rank is, then
-        // perform AllGather world to store everyone's info
-        vector<int> myDiagAndRank(2);
-        myDiagAndRank[0] = mdPerpRank_ = Mod(mrRank_-mcRank_,gcd_);
+        mdPerpRank_ = Mod(mrRank_-mcRank_,gcd_);
         int diagRank = 0;
         int row = 0;
-        int col = myDiagAndRank[0];
+        int col = mdPerpRank_;
         for( int j=0; j<lcm; ++j )
         {
             if( row == mcRank_ && col == mrRank_ )
             {
-                myDiagAndRank[1] = mdRank_ = diagRank;
+                mdRank_ = diagRank;
                 break;
             }
             else
@@ -195,47 +300,62 @@ void Grid::SetUpGrid()
                 ++diagRank;
             }
         }
-        mpi::AllGather
-        ( myDiagAndRank.data(),  2,
-          diagsAndRanks_.data(), 2, vcComm_ );
-
-        mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
-        mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
-
-        EL_DEBUG_ONLY(
-          mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( vcComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( vrComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mdComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mdPerpComm_, mpi::ERRORS_RETURN );
-        )
     }
     else
     {
-        mcComm_     = mpi::COMM_NULL;
-        mrComm_     = mpi::COMM_NULL;
-        mdComm_     = mpi::COMM_NULL;
-        mdPerpComm_ = mpi::COMM_NULL;
-        vcComm_     = mpi::COMM_NULL;
-        vrComm_     = mpi::COMM_NULL;
-
         mcRank_     = mpi::UNDEFINED;
         mrRank_     = mpi::UNDEFINED;
         mdRank_     = mpi::UNDEFINED;
         mdPerpRank_ = mpi::UNDEFINED;
         vcRank_     = mpi::UNDEFINED;
         vrRank_     = mpi::UNDEFINED;
+    }
+
+    // Every process (including viewers) can compute the same metadata for
+    // the entire VC team directly, which avoids the broadcasts which were
+    // previously needed to share the results of comm-based translations
+    vcToViewing_.resize(size_);
+    diagsAndRanks_.resize(2*size_);
+    vector<int> owningRanks(size_);
+    for( int q=0; q<size_; ++q )
+    {
+        const int mcRank = q % height_;
+        const int mrRank = q / height_;
+        owningRanks[q] =
+          ( colMajor ? q : mcRank*width + mrRank );
 
-        // diags and ranks are implicitly set to undefined
+        const int diag = Mod(mrRank-mcRank,gcd_);
+        int diagRank = 0;
+        int row = 0;
+        int col = diag;
+        for( int j=0; j<lcm; ++j )
+        {
+            if( row == mcRank && col == mrRank )
+                break;
+            row = (row + 1) % height_;
+            col = (col + 1) % width;
+            ++diagRank;
+        }
+        diagsAndRanks_[2*q]   = diag;
+        diagsAndRanks_[2*q+1] = diagRank;
     }
-    // Translate the rank of the root process of the owningGroup so that we can
-    // broadcast data
-    int owningRoot = mpi::Translate( owningGroup_, 0, viewingGroup_ );
-    mpi::Broadcast( vcToViewing_.data(), size_, owningRoot, viewingComm_ );
-    mpi::Broadcast( diagsAndRanks_.data(), 2*size_, owningRoot, viewingComm_ );
+    mpi::Translate
+    ( owningGroup_, size_, owningRanks.data(),
+      viewingGroup_, vcToViewing_.data() );
+
+    // The derived communicators are not formed until they are first needed
+    commsDerived_ = false;
+    cartComm_   = mpi::COMM_NULL;
+    mcComm_     = mpi::COMM_NULL;
+    mrComm_     = mpi::COMM_NULL;
+    mdComm_     = mpi::COMM_NULL;
+    mdPerpComm_ = mpi::COMM_NULL;
+    vcComm_     = mpi::COMM_NULL;
+    vrComm_     = mpi::COMM_NULL;
 
 #ifdef EL_HAVE_SCALAPACK
+    // BLACS requires explicit communicator handles up front
+    RequireCommunicators();
     blacsVCHandle_ = blacs::Handle( vcComm_.comm );
     blacsVRHandle_ = blacs::Handle( vrComm_.comm );
     blacsMCMRContext_ =
@@ -244,6 +364,73 @@ void Grid::SetUpGrid()
 #endif
 }
 
+void Grid::DeriveCommunicators() const
+{
+    EL_DEBUG_CSE
+    commsDerived_ = true;
+    if( !InGrid() )
+        return;
+    const int width = size_ / height_;
+    const bool colMajor = (order_==COLUMN_MAJOR);
+
+    // Create a cartesian communicator
+    // TODO: Allow for reordering and non-periodicity
+    int dims[2];
+    if( colMajor )
+    {
+        dims[0] = width;
+        dims[1] = height_;
+    }
+    else
+    {
+        dims[0] = height_;
+        dims[1] = width;
+    }
+    int periods[2] = { true, true };
+    bool reorder = false;
+    mpi::CartCreate( owningComm_, 2, dims, periods, reorder, cartComm_ );
+
+    // Set up the MatrixCol and MatrixRow communicators
+    int remainingDims[2];
+    remainingDims[0] = ( colMajor ? false : true  );
+    remainingDims[1] = ( colMajor ? true  : false );
+    mpi::CartSub( cartComm_, remainingDims, mcComm_ );
+    remainingDims[0] = ( colMajor ? true  : false );
+    remainingDims[1] = ( colMajor ? false : true  );
+    mpi::CartSub( cartComm_, remainingDims, mrComm_ );
+    EL_DEBUG_ONLY(
+      if( mcRank_ != mpi::Rank( mcComm_ ) ||
+          mrRank_ != mpi::Rank( mrComm_ ) )
+          LogicError("Computed grid ranks did not match the communicators'");
+    )
+
+    // Set up the VectorCol and VectorRow communicators
+    mpi::Split( cartComm_, 0, vcRank_, vcComm_ );
+    mpi::Split( cartComm_, 0, vrRank_, vrComm_ );
+
+    // Set up the diagonal communicators
+    mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
+    mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
+
+    EL_DEBUG_ONLY(
+      mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
+      mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
+      mpi::ErrorHandlerSet( vcComm_,     mpi::ERRORS_RETURN );
+      mpi::ErrorHandlerSet( vrComm_,     mpi::ERRORS_RETURN );
+      mpi::ErrorHandlerSet( mdComm_,     mpi::ERRORS_RETURN );
+      mpi::ErrorHandlerSet( mdPerpComm_, mpi::ERRORS_RETURN );
+    )
+}
+
+void Grid::RequireCommunicators() const EL_NO_EXCEPT
+{
+    // The once-guard makes concurrent metadata queries from multiple
+    // threads safe: the first caller performs the (collective) splits, and
+    // every subsequent reader sees an immutable snapshot
+    std::call_once
+    ( commsOnceFlag_, [this]() { DeriveCommunicators(); } );
+}
+
 Grid::~Grid()
 {
     if( !mpi::Finalized() )
@@ -255,17 +442,20 @@ Grid::~Grid()
 #endif
         if( InGrid() )
         {
-            mpi::Free( mdComm_ );
-            mpi::Free( mdPerpComm_ );
-            mpi::Free( mcComm_ );
-            mpi::Free( mrComm_ );
-            mpi::Free( vcComm_ );
-            mpi::Free( vrComm_ );
-            mpi::Free( cartComm_ );
+            if( commsDerived_ )
+            {
+                mpi::Free( mdComm_ );
+                mpi::Free( mdPerpComm_ );
+                mpi::Free( mcComm_ );
+                mpi::Free( mrComm_ );
+                mpi::Free( vcComm_ );
+                mpi::Free( vrComm_ );
+                mpi::Free( cartComm_ );
+            }
             mpi::Free( owningComm_ );
         }
         mpi::Free( viewingComm_ );
-        if( HaveViewers() )
+        if( owningGroup_ != viewingGroup_ )
             mpi::Free( owningGroup_ );
         mpi::Free( viewingGroup_ );
     }
@@ -285,12 +475,18 @@ int Grid::MDPerpSize() const EL_NO_EXCEPT { return gcd_;          }
 int Grid::VCSize()     const EL_NO_EXCEPT { return size_;         }
 int Grid::VRSize()     const EL_NO_EXCEPT { return size_;         }
 
-mpi::Comm Grid::MCComm()     const EL_NO_EXCEPT { return mcComm_;     }
-mpi::Comm Grid::MRComm()     const EL_NO_EXCEPT { return mrComm_;     }
-mpi::Comm Grid::MDComm()     const EL_NO_EXCEPT { return mdComm_;     }
-mpi::Comm Grid::MDPerpComm() const EL_NO_EXCEPT { return mdPerpComm_; }
-mpi::Comm Grid::VCComm()     const EL_NO_EXCEPT { return vcComm_;     }
-mpi::Comm Grid::VRComm()     const EL_NO_EXCEPT { return vrComm_;     }
+mpi::Comm Grid::MCComm() const EL_NO_EXCEPT
+{ RequireCommunicators(); return mcComm_; }
+mpi::Comm Grid::MRComm() const EL_NO_EXCEPT
+{ RequireCommunicators(); return mrComm_; }
+mpi::Comm Grid::MDComm() const EL_NO_EXCEPT
+{ RequireCommunicators(); return mdComm_; }
+mpi::Comm Grid::MDPerpComm() const EL_NO_EXCEPT
+{ RequireCommunicators(); return mdPerpComm_; }
+mpi::Comm Grid::VCComm() const EL_NO_EXCEPT
+{ RequireCommunicators(); return vcComm_; }
+mpi::Comm Grid::VRComm() const EL_NO_EXCEPT
+{ RequireCommunicators(); return vrComm_; }
 
 // Provided for simplicity, but redundant
 // ======================================
@@ -300,6 +496,7 @@ int Grid::Size()   const EL_NO_EXCEPT { return VCSize(); }
 int Grid::Rank()   const EL_NO_RELEASE_EXCEPT { return OwningRank(); }
 
 GridOrder Grid::Order() const EL_NO_EXCEPT { return order_; }
+GridMapping Grid::Mapping() const EL_NO_EXCEPT { return mapping_; }
 
 int Grid::Row() const EL_NO_RELEASE_EXCEPT { return MCRank(); }
 int Grid::Col() const EL_NO_RELEASE_EXCEPT { return MRRank(); }
@@ -313,7 +510,7 @@ mpi::Comm Grid::Comm() const EL_NO_EXCEPT
 
 // Currently forces a columnMajor absolute rank on the grid
 Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
-: haveViewers_(true), order_(order)
+: haveViewers_(true), order_(order), mapping_(USER_MAPPING)
 {
     EL_DEBUG_CSE
 
@@ -332,6 +529,77 @@ Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
     SetUpGrid();
 }
 
+// Clone an existing grid (possibly with a different shape or ordering)
+// without redoing any of its communicator splits: only the viewing
+// communicator and owning group are duplicated, and the derived
+// communicators are lazily split on first use
+Grid::Grid( const Grid& grid, int height, GridOrder order )
+: haveViewers_(grid.haveViewers_), order_(order), mapping_(grid.mapping_)
+{
+    EL_DEBUG_CSE
+    mpi::Dup( grid.viewingComm_, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    if( grid.owningGroup_ != grid.viewingGroup_ )
+        mpi::Dup( grid.owningGroup_, owningGroup_ );
+    else
+        owningGroup_ = viewingGroup_;
+    size_ = mpi::Size( owningGroup_ );
+
+    height_ = height;
+    if( height_ < 0 )
+        LogicError("Process grid dimensions must be non-negative");
+
+    SetUpGrid();
+}
+
+unique_ptr<Grid> Grid::Split
+( int numSubgrids, int subgridIndex, GridOrder order ) const
+{
+    EL_DEBUG_CSE
+    if( numSubgrids < 1 || numSubgrids > size_ )
+        LogicError
+        ("Cannot split a grid of ",size_," processes into ",numSubgrids,
+         " subgrids");
+    if( subgridIndex < 0 || subgridIndex >= numSubgrids )
+        LogicError
+        ("Requested subgrid ",subgridIndex," of ",numSubgrids);
+    const int teamSize = size_ / numSubgrids;
+    const int numLargeTeams = size_ % numSubgrids;
+    const int teamBeg = subgridIndex*teamSize + Min(subgridIndex,numLargeTeams);
+    const int thisTeamSize = teamSize + ( subgridIndex < numLargeTeams ? 1 : 0 );
+    vector<int> teamRanks( thisTeamSize );
+    for( int q=0; q<thisTeamSize; ++q )
+        teamRanks[q] = teamBeg + q;
+    // The advanced constructor duplicates the group, so the temporary may
+    // be freed immediately
+    mpi::Group team;
+    mpi::Incl( owningGroup_, thisTeamSize, teamRanks.data(), team );
+    unique_ptr<Grid> subgrid(
+      new Grid( viewingComm_, team, DefaultHeight(thisTeamSize), order ) );
+    mpi::Free( team );
+    return subgrid;
+}
+
+int Grid::SplitIndex( int numSubgrids ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( numSubgrids < 1 || numSubgrids > size_ )
+          LogicError
+          ("Cannot split a grid of ",size_," processes into ",numSubgrids,
+           " subgrids");
+    )
+    if( !inGrid_ )
+        return -1;
+    const int teamSize = size_ / numSubgrids;
+    const int numLargeTeams = size_ % numSubgrids;
+    const int largeBound = numLargeTeams*(teamSize+1);
+    if( owningRank_ < largeBound )
+        return owningRank_ / (teamSize+1);
+    else
+        return numLargeTeams + (owningRank_-largeBound) / teamSize;
+}
+
 int Grid::GCD() const EL_NO_EXCEPT { return gcd_; }
 int Grid::LCM() const EL_NO_EXCEPT { return size_/gcd_; }
 
@@ -0,0 +1,378 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <map>
+
+#ifdef __linux__
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+namespace El {
+namespace memory_pool {
+
+// Bookkeeping for one StaticWorkspace slab: requests are carved from the
+// slab with a stack discipline, where a release of anything but the top
+// block merely marks it freed and the pop is deferred until the top block
+// is itself released
+struct Workspace
+{
+    struct Block
+    {
+        void* buffer;
+        size_t numBytes;
+        bool inSlab;
+        bool freed;
+    };
+
+    char* slab=nullptr;
+    size_t capacity=0;
+    size_t top=0; // the current stacked demand (in bytes)
+    size_t peak=0;
+    size_t numLive=0;
+    bool strict=false;
+    Workspace* parent=nullptr;
+    std::vector<Block> blocks;
+};
+
+} // namespace memory_pool
+} // namespace El
+
+namespace {
+
+using std::map;
+using std::vector;
+
+bool poolsEnabled = false;
+std::atomic<size_t> poolLimit( 256*1024*1024 );
+
+bool firstTouchEnabled = false;
+std::atomic<size_t> hugePageThreshold( 0 );
+
+std::atomic<size_t> bytesInUse( 0 );
+std::atomic<size_t> bytesHighWater( 0 );
+
+size_t PageSize()
+{
+#ifdef __linux__
+    static const size_t pageSize = sysconf(_SC_PAGESIZE);
+#else
+    static const size_t pageSize = 4096;
+#endif
+    return pageSize;
+}
+
+// Each thread caches released buffers in per-byte-count free lists so that
+// repeated temporaries of identical shape are satisfied without touching
+// the global allocator
+struct ThreadPool
+{
+    map<size_t,vector<void*>> freeLists;
+    size_t cachedBytes=0;
+    El::Int arenaDepth=0;
+
+    void Flush()
+    {
+        for( auto& entry : freeLists )
+            for( void* buffer : entry.second )
+                ::operator delete( buffer );
+        freeLists.clear();
+        cachedBytes = 0;
+    }
+
+    ~ThreadPool() { Flush(); }
+};
+
+thread_local ThreadPool threadPool;
+
+// The innermost StaticWorkspace of the calling thread (if any), together
+// with any workspaces which left scope while a buffer drawn from their slab
+// was still live
+thread_local El::memory_pool::Workspace* activeWorkspace = nullptr;
+thread_local vector<El::memory_pool::Workspace*> orphanedWorkspaces;
+
+constexpr size_t workspaceAlignment = alignof(std::max_align_t);
+
+size_t AlignedWorkspaceSize( size_t numBytes )
+{
+    if( numBytes == 0 )
+        numBytes = 1;
+    return (numBytes+workspaceAlignment-1) & ~(workspaceAlignment-1);
+}
+
+void* WorkspaceAcquire( El::memory_pool::Workspace& workspace, size_t numBytes )
+{
+    const size_t aligned = AlignedWorkspaceSize( numBytes );
+    void* buffer;
+    const bool inSlab = ( workspace.top+aligned <= workspace.capacity );
+    if( inSlab )
+        buffer = workspace.slab + workspace.top;
+    else
+    {
+        if( workspace.strict )
+            El::RuntimeError
+            ("Static workspace of ",workspace.capacity," bytes was exhausted "
+             "by a request for ",numBytes," bytes at a stacked demand of ",
+             workspace.top," bytes");
+        buffer = ::operator new( aligned );
+    }
+    workspace.blocks.push_back
+    ( El::memory_pool::Workspace::Block{buffer,aligned,inSlab,false} );
+    workspace.top += aligned;
+    if( workspace.top > workspace.peak )
+        workspace.peak = workspace.top;
+    ++workspace.numLive;
+    return buffer;
+}
+
+bool WorkspaceReturn( El::memory_pool::Workspace& workspace, void* buffer )
+{
+    // Releases are predominantly LIFO, so search from the top of the stack
+    for( auto it=workspace.blocks.rbegin(); it!=workspace.blocks.rend(); ++it )
+    {
+        if( it->buffer != buffer || it->freed )
+            continue;
+        it->freed = true;
+        if( !it->inSlab )
+            ::operator delete( buffer );
+        --workspace.numLive;
+        while( !workspace.blocks.empty() && workspace.blocks.back().freed )
+        {
+            workspace.top -= workspace.blocks.back().numBytes;
+            workspace.blocks.pop_back();
+        }
+        return true;
+    }
+    return false;
+}
+
+void ReleaseWorkspace( El::memory_pool::Workspace* workspace )
+{
+    ::operator delete( workspace->slab );
+    delete workspace;
+}
+
+bool OrphanedWorkspaceReturn( void* buffer )
+{
+    auto& orphans = ::orphanedWorkspaces;
+    for( size_t w=0; w<orphans.size(); ++w )
+    {
+        if( WorkspaceReturn( *orphans[w], buffer ) )
+        {
+            if( orphans[w]->numLive == 0 )
+            {
+                ReleaseWorkspace( orphans[w] );
+                orphans.erase( orphans.begin()+w );
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableMemoryPools() { ::poolsEnabled = true; }
+void DisableMemoryPools() { ::poolsEnabled = false; }
+bool MemoryPoolsEnabled() { return ::poolsEnabled; }
+
+void FlushMemoryPool() { ::threadPool.Flush(); }
+size_t MemoryPoolCachedBytes() { return ::threadPool.cachedBytes; }
+
+void SetMemoryPoolLimit( size_t limitBytes ) { ::poolLimit = limitBytes; }
+size_t MemoryPoolLimit() { return ::poolLimit; }
+
+size_t MemoryInUse() EL_NO_EXCEPT
+{ return ::bytesInUse.load( std::memory_order_relaxed ); }
+
+size_t MemoryHighWater() EL_NO_EXCEPT
+{ return ::bytesHighWater.load( std::memory_order_relaxed ); }
+
+void ResetMemoryHighWater()
+{ ::bytesHighWater = ::bytesInUse.load( std::memory_order_relaxed ); }
+
+size_t AvailablePhysicalMemory()
+{
+#ifdef __linux__
+    const long numPages = sysconf(_SC_AVPHYS_PAGES);
+    if( numPages < 0 )
+        return 0;
+    return size_t(numPages)*::PageSize();
+#else
+    return 0;
+#endif
+}
+
+void VerifyMemoryBudget( double requiredBytes )
+{
+    const size_t available = AvailablePhysicalMemory();
+    if( available != 0 && requiredBytes > double(available) )
+        RuntimeError
+        ("The estimated memory requirement of ",requiredBytes/1.e9,
+         " GB exceeds the ",double(available)/1.e9,
+         " GB of available physical memory");
+}
+
+void EnableFirstTouchInit() { ::firstTouchEnabled = true; }
+void DisableFirstTouchInit() { ::firstTouchEnabled = false; }
+bool FirstTouchInitEnabled() { return ::firstTouchEnabled; }
+
+void FirstTouchPages( void* buffer, size_t numBytes )
+{
+    byte* bytes = static_cast<byte*>(buffer);
+    const size_t pageSize = ::PageSize();
+    const Int numPages = (numBytes+pageSize-1) / pageSize;
+    // Fault each page in under the same static schedule that the parallel
+    // local kernels use, so that a page lands on the NUMA domain of the
+    // thread which will later process it
+    EL_PARALLEL_FOR
+    for( Int p=0; p<numPages; ++p )
+    {
+        const size_t off = size_t(p)*pageSize;
+        std::memset( &bytes[off], 0, Min(pageSize,numBytes-off) );
+    }
+}
+
+void SetHugePageThreshold( size_t thresholdBytes )
+{ ::hugePageThreshold = thresholdBytes; }
+size_t HugePageThreshold() { return ::hugePageThreshold; }
+
+void AdviseHugePages( void* buffer, size_t numBytes )
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    const size_t threshold = ::hugePageThreshold;
+    if( threshold == 0 || numBytes < threshold )
+        return;
+    // madvise demands page alignment, so shrink the advice to the aligned
+    // interior of the buffer (and silently accept a refusal by the kernel)
+    const size_t pageSize = ::PageSize();
+    const size_t addr = reinterpret_cast<size_t>(buffer);
+    const size_t alignedBeg = (addr+pageSize-1) & ~(pageSize-1);
+    const size_t alignedEnd = (addr+numBytes) & ~(pageSize-1);
+    if( alignedEnd > alignedBeg )
+        madvise
+        ( reinterpret_cast<void*>(alignedBeg), alignedEnd-alignedBeg,
+          MADV_HUGEPAGE );
+#else
+    (void)buffer;
+    (void)numBytes;
+#endif
+}
+
+MemoryArena::MemoryArena() { ++::threadPool.arenaDepth; }
+MemoryArena::~MemoryArena()
+{
+    if( --::threadPool.arenaDepth == 0 && !::poolsEnabled )
+        ::threadPool.Flush();
+}
+
+StaticWorkspace::StaticWorkspace( size_t numBytes, bool strict )
+{
+    workspace_ = new memory_pool::Workspace;
+    workspace_->slab =
+      ( numBytes > 0 ? static_cast<char*>(::operator new(numBytes))
+                     : nullptr );
+    workspace_->capacity = numBytes;
+    workspace_->strict = strict;
+    workspace_->parent = ::activeWorkspace;
+    // Preallocate the block bookkeeping so that it does not itself call
+    // into the global allocator mid-region
+    workspace_->blocks.reserve( 1024 );
+    ::activeWorkspace = workspace_;
+}
+
+StaticWorkspace::~StaticWorkspace()
+{
+    ::activeWorkspace = workspace_->parent;
+    if( workspace_->numLive == 0 )
+        ::ReleaseWorkspace( workspace_ );
+    else
+        // A buffer drawn from the slab is still live, so the slab must
+        // survive until the buffer is returned
+        ::orphanedWorkspaces.push_back( workspace_ );
+}
+
+size_t StaticWorkspace::PeakBytes() const EL_NO_EXCEPT
+{ return workspace_->peak; }
+
+size_t StaticWorkspace::Capacity() const EL_NO_EXCEPT
+{ return workspace_->capacity; }
+
+size_t WorkspaceRequired( const function<void()>& computation )
+{
+    StaticWorkspace workspace( 0 );
+    computation();
+    return workspace.PeakBytes();
+}
+
+namespace memory_pool {
+
+bool Active()
+{ return ::poolsEnabled || ::threadPool.arenaDepth > 0; }
+
+void* Acquire( size_t numBytes )
+{
+    // Carve from the workspace slab before touching the usage counters so
+    // that a strict overflow leaves the accounting intact
+    void* workspaceBuffer = nullptr;
+    if( ::activeWorkspace != nullptr )
+        workspaceBuffer = ::WorkspaceAcquire( *::activeWorkspace, numBytes );
+    const size_t live =
+      ::bytesInUse.fetch_add( numBytes, std::memory_order_relaxed )+numBytes;
+    size_t highWater = ::bytesHighWater.load( std::memory_order_relaxed );
+    while( live > highWater &&
+           !::bytesHighWater.compare_exchange_weak( highWater, live ) )
+    { }
+    profile::RecordMemBytes( double(numBytes) );
+    profile::RecordMemoryPeak( double(live) );
+    if( workspaceBuffer != nullptr )
+        return workspaceBuffer;
+    if( Active() )
+    {
+        auto it = ::threadPool.freeLists.find( numBytes );
+        if( it != ::threadPool.freeLists.end() && !it->second.empty() )
+        {
+            void* buffer = it->second.back();
+            it->second.pop_back();
+            ::threadPool.cachedBytes -= numBytes;
+            return buffer;
+        }
+    }
+    return ::operator new( numBytes );
+}
+
+bool Return( void* buffer, size_t numBytes )
+{
+    ::bytesInUse.fetch_sub( numBytes, std::memory_order_relaxed );
+    // A workspace-drawn buffer may be released underneath a workspace the
+    // slab does not belong to (or after its workspace left scope), so walk
+    // the enclosing scopes before consulting the free lists
+    for( auto* ws=::activeWorkspace; ws!=nullptr; ws=ws->parent )
+        if( ::WorkspaceReturn( *ws, buffer ) )
+            return true;
+    if( !::orphanedWorkspaces.empty() && ::OrphanedWorkspaceReturn( buffer ) )
+        return true;
+    if( !Active() )
+        return false;
+    const size_t limit = ::poolLimit;
+    if( limit != 0 && ::threadPool.cachedBytes+numBytes > limit )
+        return false;
+    ::threadPool.freeLists[numBytes].push_back( buffer );
+    ::threadPool.cachedBytes += numBytes;
+    return true;
+}
+
+} // namespace memory_pool
+
+} // namespace El
@@ -0,0 +1,42 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace {
+
+El::Int numProxyRedists = 0;
+long long numProxyEntriesRedist = 0;
+
+}
+
+namespace El {
+
+void ClearProxyStatistics()
+{
+    numProxyRedists = 0;
+    numProxyEntriesRedist = 0;
+}
+
+Int NumProxyRedistributions()
+{ return numProxyRedists; }
+
+long long NumProxyEntriesRedistributed()
+{ return numProxyEntriesRedist; }
+
+namespace proxy {
+
+void RecordRedistribution( Int height, Int width )
+{
+    ++numProxyRedists;
+    numProxyEntriesRedist += (long long)height*(long long)width;
+}
+
+} // namespace proxy
+
+} // namespace El
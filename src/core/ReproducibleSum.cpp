@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <cmath>
+
+namespace {
+
+std::atomic<bool> reproducibleReductions( false );
+
+// Each addend is pre-rounded into three words of 'wordBits' bits below the
+// global maximum, so roughly 93 bits of the significand survive. The words
+// are bounded by 2^31 in magnitude, so 64-bit accumulators remain exact for
+// fewer than 2^31 global addends.
+const int wordBits = 31;
+const int numWords = 3;
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableReproducibleReductions()
+{ reproducibleReductions = true; }
+void DisableReproducibleReductions()
+{ reproducibleReductions = false; }
+bool ReproducibleReductionsEnabled() EL_NO_EXCEPT
+{ return reproducibleReductions; }
+
+template<typename Real,typename/*=EnableIf<IsReproducible<Real>>*/>
+void ReproducibleAllReduceSums
+( Int height,
+  Int width,
+  const Real* terms,
+  Int ldim,
+        Real* sums,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+#ifndef EL_HAVE_MPI_LONG_LONG
+    // Without 64-bit integer reductions the pre-rounded words could not be
+    // combined exactly, so fall back to an ordinary reduction
+    vector<Real> localSums( width, Real(0) );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            localSums[j] += terms[i+j*ldim];
+    mpi::AllReduce( localSums.data(), sums, int(width), mpi::SUM, comm );
+#else
+    // The maximum absolute value of each sum is exactly reproducible and
+    // fixes the fixed-point grid that every addend is rounded onto
+    vector<double> localMaxes( width, 0. ), maxes( width );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            localMaxes[j] =
+              std::max( localMaxes[j], std::abs(double(terms[i+j*ldim])) );
+    mpi::AllReduce
+    ( localMaxes.data(), maxes.data(), int(width), mpi::MAX, comm );
+
+    // Pre-round each addend into 'numWords' words via an exact cascade of
+    // scalings and nearest-integer roundings; both the local accumulation
+    // and the reduction are then exact (and hence associative) integer
+    // arithmetic
+    bool anyNonFinite = false;
+    vector<long long> localWords( numWords*width, 0 ), words( numWords*width );
+    vector<int> exps( width, 0 );
+    for( Int j=0; j<width; ++j )
+    {
+        if( maxes[j] == 0. )
+            continue;
+        if( !std::isfinite(maxes[j]) )
+        {
+            anyNonFinite = true;
+            continue;
+        }
+        int e;
+        std::frexp( maxes[j], &e );
+        exps[j] = e;
+        long long w0=0, w1=0, w2=0;
+        for( Int i=0; i<height; ++i )
+        {
+            const double s0 = std::ldexp( double(terms[i+j*ldim]), wordBits-e );
+            const long long i0 = (long long)std::llround( s0 );
+            // |s0| <= 2^31 and i0 is within 1/2 of s0, so the residual is
+            // exact; the same holds for the later stages of the cascade
+            const double s1 = std::ldexp( s0-double(i0), wordBits );
+            const long long i1 = (long long)std::llround( s1 );
+            const double s2 = std::ldexp( s1-double(i1), wordBits );
+            const long long i2 = (long long)std::llround( s2 );
+            w0 += i0;
+            w1 += i1;
+            w2 += i2;
+        }
+        localWords[numWords*j  ] = w0;
+        localWords[numWords*j+1] = w1;
+        localWords[numWords*j+2] = w2;
+    }
+    mpi::AllReduce
+    ( localWords.data(), words.data(), int(numWords*width), mpi::SUM, comm );
+
+    // Non-finite addends cannot be pre-rounded; since 'maxes' is identical
+    // on every process, each process uniformly performs the (otherwise
+    // skipped) ordinary reduction for the affected sums
+    vector<Real> naiveSums;
+    if( anyNonFinite )
+    {
+        vector<Real> localSums( width, Real(0) );
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<height; ++i )
+                localSums[j] += terms[i+j*ldim];
+        naiveSums.resize( width );
+        mpi::AllReduce
+        ( localSums.data(), naiveSums.data(), int(width), mpi::SUM, comm );
+    }
+
+    // Deterministically assemble the word sums
+    for( Int j=0; j<width; ++j )
+    {
+        if( maxes[j] == 0. )
+            sums[j] = Real(0);
+        else if( !std::isfinite(maxes[j]) )
+            sums[j] = naiveSums[j];
+        else
+        {
+            const int e = exps[j];
+            sums[j] = Real(
+              std::ldexp( double(words[numWords*j  ]), e-  wordBits ) +
+              std::ldexp( double(words[numWords*j+1]), e-2*wordBits ) +
+              std::ldexp( double(words[numWords*j+2]), e-3*wordBits ) );
+        }
+    }
+#endif // ifndef EL_HAVE_MPI_LONG_LONG
+}
+
+template void ReproducibleAllReduceSums
+( Int height, Int width, const float* terms, Int ldim, float* sums,
+  mpi::Comm comm );
+template void ReproducibleAllReduceSums
+( Int height, Int width, const double* terms, Int ldim, double* sums,
+  mpi::Comm comm );
+
+} // namespace El
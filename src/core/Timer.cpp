@@ -8,6 +8,79 @@
 */
 #include <El-lite.hpp>
 
+#include <atomic>
+#include <mutex>
+
+namespace {
+using namespace El;
+
+std::atomic<bool> profilingEnabled( false );
+
+struct ProfileStats
+{
+    double totalTime=0;
+    unsigned long numCalls=0;
+    double numFlops=0;
+    double memBytes=0;
+    double commBytes=0;
+    double peakMemBytes=0;
+};
+
+// The accumulated time and call count of every region which has completed,
+// keyed by its call path
+std::mutex profileMutex;
+std::map<string,ProfileStats> profileStats;
+
+// The stack of regions currently open on this thread
+struct OpenRegion
+{
+    string path;
+    Clock::time_point start;
+    double numFlops=0;
+    double memBytes=0;
+    double commBytes=0;
+    double peakMemBytes=0;
+};
+thread_local std::vector<OpenRegion> openRegions;
+
+// The peak per-process rates used to classify regions (zero if unknown)
+std::atomic<double> rooflineFlopsPeak( 0. );
+std::atomic<double> rooflineBytesPeak( 0. );
+
+// Funnel the (tiny) per-rank tables to the root, which receives one string
+// per rank; the characters are widened to int to reuse the registered MPI
+// datatypes
+std::vector<string> GatherTables( const string& table, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    std::vector<int> sendBuf( table.begin(), table.end() );
+    int localLength = sendBuf.size();
+    std::vector<int> lengths( commSize, 0 );
+    mpi::Gather( &localLength, 1, lengths.data(), 1, 0, comm );
+    std::vector<int> offsets;
+    int totalLength = 0;
+    if( commRank == 0 )
+        totalLength = Scan( lengths, offsets );
+    std::vector<int> recvBuf( Max(totalLength,1) );
+    mpi::Gather
+    ( sendBuf.data(), localLength,
+      recvBuf.data(), lengths.data(), offsets.data(), 0, comm );
+    std::vector<string> tables;
+    if( commRank != 0 )
+        return tables;
+    tables.resize( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        tables[q].reserve( lengths[q] );
+        for( int k=0; k<lengths[q]; ++k )
+            tables[q].push_back( char(recvBuf[offsets[q]+k]) );
+    }
+    return tables;
+}
+
+}
+
 namespace El {
 
 Timer::Timer( const string& name )
@@ -62,4 +135,348 @@ double Timer::Total() const
         return totalTime_;
 }
 
+void EnableProfiling() { ::profilingEnabled = true; }
+void DisableProfiling() { ::profilingEnabled = false; }
+bool ProfilingEnabled() EL_NO_EXCEPT
+{ return ::profilingEnabled.load( std::memory_order_relaxed ); }
+
+void ClearProfile()
+{
+    std::lock_guard<std::mutex> lock( ::profileMutex );
+    ::profileStats.clear();
+}
+
+namespace profile {
+
+void RegionBegin( const char* name )
+{
+    OpenRegion region;
+    if( ::openRegions.empty() )
+        region.path = name;
+    else
+        region.path = ::openRegions.back().path + "/" + name;
+    region.start = Clock::now();
+    ::openRegions.push_back( std::move(region) );
+}
+
+void RegionEnd()
+{
+    const auto stop = Clock::now();
+    const OpenRegion& region = ::openRegions.back();
+    const double elapsed =
+      duration_cast<duration<double>>(stop-region.start).count();
+    {
+        std::lock_guard<std::mutex> lock( ::profileMutex );
+        ProfileStats& stats = ::profileStats[region.path];
+        stats.totalTime += elapsed;
+        ++stats.numCalls;
+        stats.numFlops += region.numFlops;
+        stats.memBytes += region.memBytes;
+        stats.commBytes += region.commBytes;
+        stats.peakMemBytes = Max( stats.peakMemBytes, region.peakMemBytes );
+    }
+    const double numFlops = region.numFlops;
+    const double memBytes = region.memBytes;
+    const double commBytes = region.commBytes;
+    const double peakMemBytes = region.peakMemBytes;
+    ::openRegions.pop_back();
+    // Regions are inclusive of their children, for counters as for time
+    if( !::openRegions.empty() )
+    {
+        OpenRegion& parent = ::openRegions.back();
+        parent.numFlops += numFlops;
+        parent.memBytes += memBytes;
+        parent.commBytes += commBytes;
+        parent.peakMemBytes = Max( parent.peakMemBytes, peakMemBytes );
+    }
+}
+
+void RecordFlops( double numFlops )
+{
+    if( !ProfilingEnabled() || ::openRegions.empty() )
+        return;
+    ::openRegions.back().numFlops += numFlops;
+}
+
+void RecordMemBytes( double numBytes )
+{
+    if( !ProfilingEnabled() || ::openRegions.empty() )
+        return;
+    ::openRegions.back().memBytes += numBytes;
+}
+
+void RecordCommBytes( double numBytes )
+{
+    if( !ProfilingEnabled() || ::openRegions.empty() )
+        return;
+    ::openRegions.back().commBytes += numBytes;
+}
+
+void RecordMemoryPeak( double liveBytes )
+{
+    if( !ProfilingEnabled() || ::openRegions.empty() )
+        return;
+    OpenRegion& region = ::openRegions.back();
+    region.peakMemBytes = Max( region.peakMemBytes, liveBytes );
+}
+
+} // namespace profile
+
+void ProfileReport( ostream& os, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    // Serialize the local profile into a table of lines of the form
+    // "path <tab> totalTime <tab> numCalls"
+    ostringstream tableStream;
+    tableStream.precision( 17 );
+    {
+        std::lock_guard<std::mutex> lock( ::profileMutex );
+        for( const auto& entry : ::profileStats )
+            tableStream << entry.first << '\t'
+                        << entry.second.totalTime << '\t'
+                        << entry.second.numCalls << '\n';
+    }
+    const int commSize = mpi::Size( comm );
+    const vector<string> tables = ::GatherTables( tableStream.str(), comm );
+    if( mpi::Rank(comm) != 0 )
+        return;
+
+    // Merge the per-rank totals; a rank which never entered a region
+    // contributes a zero to its minimum
+    struct Aggregate
+    {
+        double minTime=0, maxTime=0, sumTime=0;
+        unsigned long numCalls=0;
+        int numRanks=0;
+    };
+    std::map<string,Aggregate> aggregates;
+    for( const string& rankTable : tables )
+    {
+        std::istringstream lineStream( rankTable );
+        string line;
+        while( std::getline( lineStream, line ) )
+        {
+            const size_t firstTab = line.find( '\t' );
+            const size_t secondTab = line.find( '\t', firstTab+1 );
+            if( firstTab == string::npos || secondTab == string::npos )
+                continue;
+            const string path = line.substr( 0, firstTab );
+            const double totalTime =
+              strtod( line.c_str()+firstTab+1, nullptr );
+            const unsigned long numCalls =
+              strtoul( line.c_str()+secondTab+1, nullptr, 10 );
+            Aggregate& agg = aggregates[path];
+            if( agg.numRanks == 0 || totalTime < agg.minTime )
+                agg.minTime = totalTime;
+            agg.maxTime = Max( agg.maxTime, totalTime );
+            agg.sumTime += totalTime;
+            agg.numCalls = std::max( agg.numCalls, numCalls );
+            ++agg.numRanks;
+        }
+    }
+    if( aggregates.empty() )
+        return;
+
+    // The lexicographic order of the paths places every region directly
+    // after its parent, so indenting by depth recovers the tree
+    size_t nameWidth = 6;
+    for( const auto& entry : aggregates )
+        nameWidth = std::max( nameWidth, entry.first.size()+2 );
+    os << "Profile over " << commSize << " process(es), in seconds:\n";
+    char line[256];
+    snprintf
+    ( line, sizeof(line), "  %-*s %10s %12s %12s %12s\n",
+      int(nameWidth), "region", "calls", "min", "mean", "max" );
+    os << line;
+    for( const auto& entry : aggregates )
+    {
+        const string& path = entry.first;
+        const Aggregate& agg = entry.second;
+        const size_t lastSlash = path.rfind( '/' );
+        const size_t depth =
+          std::count( path.begin(), path.end(), '/' );
+        const string name =
+          string( 2*depth, ' ' ) +
+          ( lastSlash == string::npos ? path : path.substr(lastSlash+1) );
+        const double minTime = ( agg.numRanks < commSize ? 0 : agg.minTime );
+        snprintf
+        ( line, sizeof(line), "  %-*s %10lu %12.6f %12.6f %12.6f\n",
+          int(nameWidth), name.c_str(), agg.numCalls,
+          minTime, agg.sumTime/commSize, agg.maxTime );
+        os << line;
+    }
+    os.flush();
+}
+
+vector<ProfileTiming> ProfileTimings( mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    // Serialize the local profile exactly as in ProfileReport
+    ostringstream tableStream;
+    tableStream.precision( 17 );
+    {
+        std::lock_guard<std::mutex> lock( ::profileMutex );
+        for( const auto& entry : ::profileStats )
+            tableStream << entry.first << '\t'
+                        << entry.second.totalTime << '\t'
+                        << entry.second.numCalls << '\n';
+    }
+    const vector<string> tables = ::GatherTables( tableStream.str(), comm );
+    vector<ProfileTiming> timings;
+    if( mpi::Rank(comm) != 0 )
+        return timings;
+
+    std::map<string,ProfileTiming> merged;
+    for( const string& rankTable : tables )
+    {
+        std::istringstream lineStream( rankTable );
+        string line;
+        while( std::getline( lineStream, line ) )
+        {
+            const size_t firstTab = line.find( '\t' );
+            const size_t secondTab = line.find( '\t', firstTab+1 );
+            if( firstTab == string::npos || secondTab == string::npos )
+                continue;
+            const string path = line.substr( 0, firstTab );
+            const double totalTime =
+              strtod( line.c_str()+firstTab+1, nullptr );
+            const unsigned long numCalls =
+              strtoul( line.c_str()+secondTab+1, nullptr, 10 );
+            auto it = merged.find( path );
+            if( it == merged.end() )
+                merged[path] = ProfileTiming{path,totalTime,numCalls};
+            else
+            {
+                it->second.maxTime = Max( it->second.maxTime, totalTime );
+                it->second.numCalls =
+                  std::max( it->second.numCalls, numCalls );
+            }
+        }
+    }
+    timings.reserve( merged.size() );
+    for( const auto& entry : merged )
+        timings.push_back( entry.second );
+    return timings;
+}
+
+void SetRooflinePeaks( double flopsPerSec, double bytesPerSec )
+{
+    ::rooflineFlopsPeak = flopsPerSec;
+    ::rooflineBytesPeak = bytesPerSec;
+}
+
+void RooflineReport( ostream& os, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    // Serialize the local counters into a table of lines of the form
+    // "path <tab> totalTime numCalls numFlops memBytes commBytes"
+    ostringstream tableStream;
+    tableStream.precision( 17 );
+    {
+        std::lock_guard<std::mutex> lock( ::profileMutex );
+        for( const auto& entry : ::profileStats )
+            tableStream << entry.first << '\t'
+                        << entry.second.totalTime << ' '
+                        << entry.second.numCalls << ' '
+                        << entry.second.numFlops << ' '
+                        << entry.second.memBytes << ' '
+                        << entry.second.commBytes << ' '
+                        << entry.second.peakMemBytes << '\n';
+    }
+    const int commSize = mpi::Size( comm );
+    const vector<string> tables = ::GatherTables( tableStream.str(), comm );
+    if( mpi::Rank(comm) != 0 )
+        return;
+
+    // Sum the counters over the ranks but take the maximum of the times,
+    // since the slowest rank determines the achieved rate
+    struct Aggregate
+    {
+        double maxTime=0, numFlops=0, memBytes=0, commBytes=0,
+               peakMemBytes=0;
+        unsigned long numCalls=0;
+    };
+    std::map<string,Aggregate> aggregates;
+    for( const string& rankTable : tables )
+    {
+        std::istringstream lineStream( rankTable );
+        string line;
+        while( std::getline( lineStream, line ) )
+        {
+            const size_t tab = line.find( '\t' );
+            if( tab == string::npos )
+                continue;
+            const string path = line.substr( 0, tab );
+            std::istringstream fieldStream( line.substr(tab+1) );
+            double totalTime, numFlops, memBytes, commBytes, peakMemBytes;
+            unsigned long numCalls;
+            fieldStream >> totalTime >> numCalls
+                        >> numFlops >> memBytes >> commBytes >> peakMemBytes;
+            if( !fieldStream )
+                continue;
+            Aggregate& agg = aggregates[path];
+            agg.maxTime = Max( agg.maxTime, totalTime );
+            agg.numCalls = std::max( agg.numCalls, numCalls );
+            agg.numFlops += numFlops;
+            agg.memBytes += memBytes;
+            agg.commBytes += commBytes;
+            agg.peakMemBytes = Max( agg.peakMemBytes, peakMemBytes );
+        }
+    }
+    if( aggregates.empty() )
+        return;
+
+    const double peakFlops = ::rooflineFlopsPeak;
+    const double peakBytes = ::rooflineBytesPeak;
+    size_t nameWidth = 6;
+    for( const auto& entry : aggregates )
+        nameWidth = std::max( nameWidth, entry.first.size()+2 );
+    os << "Roofline summary over " << commSize << " process(es):\n";
+    char line[320];
+    snprintf
+    ( line, sizeof(line),
+      "  %-*s %8s %10s %10s %10s %9s %9s %9s %8s %10s\n",
+      int(nameWidth), "region", "calls", "time", "GFlop", "GFlop/s",
+      "mem GB", "comm GB", "peak GB", "flop/B", "bound" );
+    os << line;
+    for( const auto& entry : aggregates )
+    {
+        const string& path = entry.first;
+        const Aggregate& agg = entry.second;
+        const size_t lastSlash = path.rfind( '/' );
+        const size_t depth = std::count( path.begin(), path.end(), '/' );
+        const string name =
+          string( 2*depth, ' ' ) +
+          ( lastSlash == string::npos ? path : path.substr(lastSlash+1) );
+        const double bytes = agg.memBytes + agg.commBytes;
+        const double rate =
+          ( agg.maxTime > 0 ? agg.numFlops/agg.maxTime : 0 );
+        const double intensity = ( bytes > 0 ? agg.numFlops/bytes : 0 );
+        // Under the roofline model a region is bandwidth-bound when its
+        // arithmetic intensity lies below the machine balance
+        const char* bound = "-";
+        if( peakFlops > 0 && peakBytes > 0 && agg.numFlops > 0 )
+            bound =
+              ( intensity*peakBytes < peakFlops ? "bandwidth" : "compute" );
+        snprintf
+        ( line, sizeof(line),
+          "  %-*s %8lu %10.4f %10.3f %10.3f %9.3f %9.3f %9.3f %8.2f %10s\n",
+          int(nameWidth), name.c_str(), agg.numCalls, agg.maxTime,
+          agg.numFlops/1.e9, rate/1.e9,
+          agg.memBytes/1.e9, agg.commBytes/1.e9, agg.peakMemBytes/1.e9,
+          intensity, bound );
+        os << line;
+    }
+    os.flush();
+}
+
+void LogRoofline( mpi::Comm comm )
+{
+    // Only the root prints, so only its log file needs to be opened
+    if( mpi::Rank(comm) == 0 )
+        RooflineReport( LogOS(), comm );
+    else
+        RooflineReport( cout, comm );
+}
+
 } // namespace El
@@ -15,6 +15,8 @@ namespace {
 EL_DEBUG_ONLY(
   std::stack<std::string> callStack;
   bool tracingEnabled = false;
+  El::Int callStackSampleRate = 64;
+  thread_local El::Int callStackSampleCounter = 0;
 )
 
 }
@@ -27,6 +29,21 @@ EL_DEBUG_ONLY(
   void EnableTracing() { ::tracingEnabled = true; }
   void DisableTracing() { ::tracingEnabled = false; }
 
+  void SetCallStackSampleRate( Int rate )
+  { ::callStackSampleRate = Max( rate, Int(1) ); }
+
+  Int CallStackSampleRate() { return ::callStackSampleRate; }
+
+  bool AcquireCallStackSample()
+  {
+      if( ++::callStackSampleCounter >= ::callStackSampleRate )
+      {
+          ::callStackSampleCounter = 0;
+          return true;
+      }
+      return false;
+  }
+
   void PushCallStack( string s )
   { 
       // [1]:
@@ -38,3 +38,7 @@ using El::dcomplex;
 #include "./blas/Syr2k.hpp"
 #include "./blas/Trmm.hpp"
 #include "./blas/Trsm.hpp"
+
+// Batched Level 3
+#include "./blas/GemmBatch.hpp"
+#include "./blas/TrsmBatch.hpp"
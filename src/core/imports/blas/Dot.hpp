@@ -31,13 +31,13 @@ T Dot
 {
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
-    T gamma;
+    ScratchElement<T> scratch;
+    T& gamma = scratch.Ref();
     T alpha = 0;
     for( BlasInt i=0; i<n; ++i )
     {
         Conj( x[i*incx], gamma );
-        gamma *= y[i*incy];
-        alpha += gamma;
+        AddMul( gamma, y[i*incy], alpha );
     }
     return alpha;
 }
@@ -116,14 +116,9 @@ T Dotu
 {
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
-    T gamma;
     T alpha = 0;
     for( BlasInt i=0; i<n; ++i )
-    {
-        gamma = x[i*incx];
-        gamma *= y[i*incy];
-        alpha += gamma;
-    }
+        AddMul( x[i*incx], y[i*incy], alpha );
     return alpha;
 }
 template Int Dotu
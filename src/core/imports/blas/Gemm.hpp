@@ -383,6 +383,14 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() && cublas::WorthOffloading(m,n,k) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
     EL_BLAS(sgemm)
@@ -426,6 +434,14 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() && cublas::WorthOffloading(m,n,k) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
     EL_BLAS(dgemm)
@@ -468,6 +484,14 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() && cublas::WorthOffloading(m,n,k) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(cgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -508,6 +532,14 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() && cublas::WorthOffloading(m,n,k) )
+    {
+        cublas::Gemm
+        ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(zgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -0,0 +1,533 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#ifdef EL_HAVE_MKL
+extern "C" {
+
+void EL_BLAS(sgemm_batch)
+( const char* transAArray, const char* transBArray,
+  const BlasInt* mArray, const BlasInt* nArray, const BlasInt* kArray,
+  const float* alphaArray,
+  const float* const* AArray, const BlasInt* ALDimArray,
+  const float* const* BArray, const BlasInt* BLDimArray,
+  const float* betaArray,
+        float* const* CArray, const BlasInt* CLDimArray,
+  const BlasInt* groupCount, const BlasInt* groupSizes );
+void EL_BLAS(dgemm_batch)
+( const char* transAArray, const char* transBArray,
+  const BlasInt* mArray, const BlasInt* nArray, const BlasInt* kArray,
+  const double* alphaArray,
+  const double* const* AArray, const BlasInt* ALDimArray,
+  const double* const* BArray, const BlasInt* BLDimArray,
+  const double* betaArray,
+        double* const* CArray, const BlasInt* CLDimArray,
+  const BlasInt* groupCount, const BlasInt* groupSizes );
+void EL_BLAS(cgemm_batch)
+( const char* transAArray, const char* transBArray,
+  const BlasInt* mArray, const BlasInt* nArray, const BlasInt* kArray,
+  const scomplex* alphaArray,
+  const scomplex* const* AArray, const BlasInt* ALDimArray,
+  const scomplex* const* BArray, const BlasInt* BLDimArray,
+  const scomplex* betaArray,
+        scomplex* const* CArray, const BlasInt* CLDimArray,
+  const BlasInt* groupCount, const BlasInt* groupSizes );
+void EL_BLAS(zgemm_batch)
+( const char* transAArray, const char* transBArray,
+  const BlasInt* mArray, const BlasInt* nArray, const BlasInt* kArray,
+  const dcomplex* alphaArray,
+  const dcomplex* const* AArray, const BlasInt* ALDimArray,
+  const dcomplex* const* BArray, const BlasInt* BLDimArray,
+  const dcomplex* betaArray,
+        dcomplex* const* CArray, const BlasInt* CLDimArray,
+  const BlasInt* groupCount, const BlasInt* groupSizes );
+
+} // extern "C"
+#endif // ifdef EL_HAVE_MKL
+
+namespace El {
+namespace blas {
+
+// A single uniform group of independent products, C_b += alpha A_b B_b,
+// which avoids paying the per-call overhead of Gemm once for each of the
+// (typically tiny) members of the batch. MKL's ?gemm_batch is used when
+// available; OpenBLAS and the reference BLAS have no batched interface, so
+// the members are otherwise dispatched from a threaded loop.
+
+template<typename T>
+void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* const* A, BlasInt ALDim,
+  const T* const* B, BlasInt BLDim,
+  const T& beta,
+        T* const* C, BlasInt CLDim,
+  BlasInt batchCount )
+{
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Gemm
+        ( transA, transB, m, n, k,
+          alpha, A[b], ALDim, B[b], BLDim,
+          beta,  C[b], CLDim );
+}
+template void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Int& alpha,
+  const Int* const* A, BlasInt ALDim,
+  const Int* const* B, BlasInt BLDim,
+  const Int& beta,
+        Int* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+#ifdef EL_HAVE_QD
+template void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* const* A, BlasInt ALDim,
+  const DoubleDouble* const* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+template void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* const* A, BlasInt ALDim,
+  const QuadDouble* const* B, BlasInt BLDim,
+  const QuadDouble& beta,
+        QuadDouble* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+template void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<DoubleDouble>& alpha,
+  const Complex<DoubleDouble>* const* A, BlasInt ALDim,
+  const Complex<DoubleDouble>* const* B, BlasInt BLDim,
+  const Complex<DoubleDouble>& beta,
+        Complex<DoubleDouble>* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+template void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<QuadDouble>& alpha,
+  const Complex<QuadDouble>* const* A, BlasInt ALDim,
+  const Complex<QuadDouble>* const* B, BlasInt BLDim,
+  const Complex<QuadDouble>& beta,
+        Complex<QuadDouble>* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+#endif
+#ifdef EL_HAVE_QUAD
+template void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* const* A, BlasInt ALDim,
+  const Quad* const* B, BlasInt BLDim,
+  const Quad& beta,
+        Quad* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+template void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* const* A, BlasInt ALDim,
+  const Complex<Quad>* const* B, BlasInt BLDim,
+  const Complex<Quad>& beta,
+        Complex<Quad>* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+#endif
+#ifdef EL_HAVE_MPC
+template void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const BigInt& alpha,
+  const BigInt* const* A, BlasInt ALDim,
+  const BigInt* const* B, BlasInt BLDim,
+  const BigInt& beta,
+        BigInt* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+template void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const BigFloat& alpha,
+  const BigFloat* const* A, BlasInt ALDim,
+  const BigFloat* const* B, BlasInt BLDim,
+  const BigFloat& beta,
+        BigFloat* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+template void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>* const* A, BlasInt ALDim,
+  const Complex<BigFloat>* const* B, BlasInt BLDim,
+  const Complex<BigFloat>& beta,
+        Complex<BigFloat>* const* C, BlasInt CLDim,
+  BlasInt batchCount );
+#endif
+
+void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const float& alpha,
+  const float* const* A, BlasInt ALDim,
+  const float* const* B, BlasInt BLDim,
+  const float& beta,
+        float* const* C, BlasInt CLDim,
+  BlasInt batchCount )
+{
+#ifdef EL_HAVE_MKL
+    const BlasInt groupCount = 1;
+    EL_BLAS(sgemm_batch)
+    ( &transA, &transB, &m, &n, &k,
+      &alpha, A, &ALDim, B, &BLDim,
+      &beta,  C, &CLDim, &groupCount, &batchCount );
+#else
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Gemm
+        ( transA, transB, m, n, k,
+          alpha, A[b], ALDim, B[b], BLDim,
+          beta,  C[b], CLDim );
+#endif
+}
+
+void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const double& alpha,
+  const double* const* A, BlasInt ALDim,
+  const double* const* B, BlasInt BLDim,
+  const double& beta,
+        double* const* C, BlasInt CLDim,
+  BlasInt batchCount )
+{
+#ifdef EL_HAVE_MKL
+    const BlasInt groupCount = 1;
+    EL_BLAS(dgemm_batch)
+    ( &transA, &transB, &m, &n, &k,
+      &alpha, A, &ALDim, B, &BLDim,
+      &beta,  C, &CLDim, &groupCount, &batchCount );
+#else
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Gemm
+        ( transA, transB, m, n, k,
+          alpha, A[b], ALDim, B[b], BLDim,
+          beta,  C[b], CLDim );
+#endif
+}
+
+void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const scomplex& alpha,
+  const scomplex* const* A, BlasInt ALDim,
+  const scomplex* const* B, BlasInt BLDim,
+  const scomplex& beta,
+        scomplex* const* C, BlasInt CLDim,
+  BlasInt batchCount )
+{
+#ifdef EL_HAVE_MKL
+    const BlasInt groupCount = 1;
+    EL_BLAS(cgemm_batch)
+    ( &transA, &transB, &m, &n, &k,
+      &alpha, A, &ALDim, B, &BLDim,
+      &beta,  C, &CLDim, &groupCount, &batchCount );
+#else
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Gemm
+        ( transA, transB, m, n, k,
+          alpha, A[b], ALDim, B[b], BLDim,
+          beta,  C[b], CLDim );
+#endif
+}
+
+void GemmBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const dcomplex& alpha,
+  const dcomplex* const* A, BlasInt ALDim,
+  const dcomplex* const* B, BlasInt BLDim,
+  const dcomplex& beta,
+        dcomplex* const* C, BlasInt CLDim,
+  BlasInt batchCount )
+{
+#ifdef EL_HAVE_MKL
+    const BlasInt groupCount = 1;
+    EL_BLAS(zgemm_batch)
+    ( &transA, &transB, &m, &n, &k,
+      &alpha, A, &ALDim, B, &BLDim,
+      &beta,  C, &CLDim, &groupCount, &batchCount );
+#else
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Gemm
+        ( transA, transB, m, n, k,
+          alpha, A[b], ALDim, B[b], BLDim,
+          beta,  C[b], CLDim );
+#endif
+}
+
+// The strided variant, where the b'th members begin at A+b*AStride (and
+// similarly for B and C), as produced by contiguous slab storage. The MKL
+// path forms the pointer arrays once and forwards to ?gemm_batch rather
+// than binding ?gemm_batch_strided, which is a much more recent addition.
+
+template<typename T>
+void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim, BlasInt AStride,
+  const T* B, BlasInt BLDim, BlasInt BStride,
+  const T& beta,
+        T* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount )
+{
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Gemm
+        ( transA, transB, m, n, k,
+          alpha, &A[b*AStride], ALDim, &B[b*BStride], BLDim,
+          beta,  &C[b*CStride], CLDim );
+}
+template void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Int& alpha,
+  const Int* A, BlasInt ALDim, BlasInt AStride,
+  const Int* B, BlasInt BLDim, BlasInt BStride,
+  const Int& beta,
+        Int* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+#ifdef EL_HAVE_QD
+template void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim, BlasInt AStride,
+  const DoubleDouble* B, BlasInt BLDim, BlasInt BStride,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+template void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim, BlasInt AStride,
+  const QuadDouble* B, BlasInt BLDim, BlasInt BStride,
+  const QuadDouble& beta,
+        QuadDouble* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+template void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<DoubleDouble>& alpha,
+  const Complex<DoubleDouble>* A, BlasInt ALDim, BlasInt AStride,
+  const Complex<DoubleDouble>* B, BlasInt BLDim, BlasInt BStride,
+  const Complex<DoubleDouble>& beta,
+        Complex<DoubleDouble>* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+template void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<QuadDouble>& alpha,
+  const Complex<QuadDouble>* A, BlasInt ALDim, BlasInt AStride,
+  const Complex<QuadDouble>* B, BlasInt BLDim, BlasInt BStride,
+  const Complex<QuadDouble>& beta,
+        Complex<QuadDouble>* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+#endif
+#ifdef EL_HAVE_QUAD
+template void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim, BlasInt AStride,
+  const Quad* B, BlasInt BLDim, BlasInt BStride,
+  const Quad& beta,
+        Quad* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+template void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* A, BlasInt ALDim, BlasInt AStride,
+  const Complex<Quad>* B, BlasInt BLDim, BlasInt BStride,
+  const Complex<Quad>& beta,
+        Complex<Quad>* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+#endif
+#ifdef EL_HAVE_MPC
+template void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim, BlasInt AStride,
+  const BigInt* B, BlasInt BLDim, BlasInt BStride,
+  const BigInt& beta,
+        BigInt* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+template void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim, BlasInt AStride,
+  const BigFloat* B, BlasInt BLDim, BlasInt BStride,
+  const BigFloat& beta,
+        BigFloat* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+template void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>* A, BlasInt ALDim, BlasInt AStride,
+  const Complex<BigFloat>* B, BlasInt BLDim, BlasInt BStride,
+  const Complex<BigFloat>& beta,
+        Complex<BigFloat>* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount );
+#endif
+
+namespace {
+
+#ifdef EL_HAVE_MKL
+template<typename T>
+void StridedToPointerBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim, BlasInt AStride,
+  const T* B, BlasInt BLDim, BlasInt BStride,
+  const T& beta,
+        T* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount )
+{
+    std::vector<const T*> APtrs( batchCount ), BPtrs( batchCount );
+    std::vector<T*> CPtrs( batchCount );
+    for( BlasInt b=0; b<batchCount; ++b )
+    {
+        APtrs[b] = &A[b*AStride];
+        BPtrs[b] = &B[b*BStride];
+        CPtrs[b] = &C[b*CStride];
+    }
+    GemmBatch
+    ( transA, transB, m, n, k,
+      alpha, APtrs.data(), ALDim, BPtrs.data(), BLDim,
+      beta,  CPtrs.data(), CLDim, batchCount );
+}
+#endif
+
+} // anonymous namespace
+
+void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const float& alpha,
+  const float* A, BlasInt ALDim, BlasInt AStride,
+  const float* B, BlasInt BLDim, BlasInt BStride,
+  const float& beta,
+        float* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount )
+{
+#ifdef EL_HAVE_MKL
+    StridedToPointerBatch
+    ( transA, transB, m, n, k,
+      alpha, A, ALDim, AStride, B, BLDim, BStride,
+      beta,  C, CLDim, CStride, batchCount );
+#else
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Gemm
+        ( transA, transB, m, n, k,
+          alpha, &A[b*AStride], ALDim, &B[b*BStride], BLDim,
+          beta,  &C[b*CStride], CLDim );
+#endif
+}
+
+void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const double& alpha,
+  const double* A, BlasInt ALDim, BlasInt AStride,
+  const double* B, BlasInt BLDim, BlasInt BStride,
+  const double& beta,
+        double* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount )
+{
+#ifdef EL_HAVE_MKL
+    StridedToPointerBatch
+    ( transA, transB, m, n, k,
+      alpha, A, ALDim, AStride, B, BLDim, BStride,
+      beta,  C, CLDim, CStride, batchCount );
+#else
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Gemm
+        ( transA, transB, m, n, k,
+          alpha, &A[b*AStride], ALDim, &B[b*BStride], BLDim,
+          beta,  &C[b*CStride], CLDim );
+#endif
+}
+
+void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const scomplex& alpha,
+  const scomplex* A, BlasInt ALDim, BlasInt AStride,
+  const scomplex* B, BlasInt BLDim, BlasInt BStride,
+  const scomplex& beta,
+        scomplex* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount )
+{
+#ifdef EL_HAVE_MKL
+    StridedToPointerBatch
+    ( transA, transB, m, n, k,
+      alpha, A, ALDim, AStride, B, BLDim, BStride,
+      beta,  C, CLDim, CStride, batchCount );
+#else
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Gemm
+        ( transA, transB, m, n, k,
+          alpha, &A[b*AStride], ALDim, &B[b*BStride], BLDim,
+          beta,  &C[b*CStride], CLDim );
+#endif
+}
+
+void GemmStridedBatch
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const dcomplex& alpha,
+  const dcomplex* A, BlasInt ALDim, BlasInt AStride,
+  const dcomplex* B, BlasInt BLDim, BlasInt BStride,
+  const dcomplex& beta,
+        dcomplex* C, BlasInt CLDim, BlasInt CStride,
+  BlasInt batchCount )
+{
+#ifdef EL_HAVE_MKL
+    StridedToPointerBatch
+    ( transA, transB, m, n, k,
+      alpha, A, ALDim, AStride, B, BLDim, BStride,
+      beta,  C, CLDim, CStride, batchCount );
+#else
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Gemm
+        ( transA, transB, m, n, k,
+          alpha, &A[b*AStride], ALDim, &B[b*BStride], BLDim,
+          beta,  &C[b*CStride], CLDim );
+#endif
+}
+
+} // namespace blas
+} // namespace El
@@ -248,6 +248,13 @@ void Herk
   const float& beta,
         float* C, BlasInt CLDim )
 {
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() && cublas::WorthOffloading(n,n,k) )
+    {
+        cublas::Herk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(ssyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
@@ -261,6 +268,13 @@ void Herk
   const double& beta,
         double* C, BlasInt CLDim )
 {
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() && cublas::WorthOffloading(n,n,k) )
+    {
+        cublas::Herk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(dsyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
@@ -274,6 +288,13 @@ void Herk
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() && cublas::WorthOffloading(n,n,k) )
+    {
+        cublas::Herk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(cherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -286,6 +307,13 @@ void Herk
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() && cublas::WorthOffloading(n,n,k) )
+    {
+        cublas::Herk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+#endif
     EL_BLAS(zherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -49,6 +49,7 @@ void Trmm
     const bool conjugate = ( std::toupper(trans) == 'C' );
 
     // Scale B
+    EL_PARALLEL_FOR
     for( BlasInt j=0; j<n; ++j )
         for( BlasInt i=0; i<m; ++i )
             B[i+j*BLDim] *= alpha;
@@ -57,14 +58,18 @@ void Trmm
     //       repeatedly stream all of the triangular matrix through memory
     //       for each row/column of B
 
+    // Since no threaded BLAS is available for these datatypes, at least
+    // split the independent rows/columns of B among the threads
     if( onLeft )
     {
+        EL_PARALLEL_FOR
         for( BlasInt j=0; j<n; ++j )
             Trmv( uplo, trans, unit, m, A, ALDim, &B[j*BLDim], 1 );
     }
     else
     {
         char newTrans = ( std::toupper(trans) == 'N' ? 'T' : 'N' );
+        EL_PARALLEL_FOR
         for( BlasInt i=0; i<m; ++i )
         {
             if( conjugate )
@@ -38,7 +38,7 @@ namespace El {
 namespace blas {
 
 template<typename F>
-void Trsm
+void TrsmSerial
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const F& alpha,
@@ -293,6 +293,46 @@ void Trsm
         }
     }
 }
+
+// Since no threaded BLAS is available for these datatypes, partition the
+// right-hand sides among the threads (columns for left-sided solves and
+// rows for right-sided solves), as they may be eliminated independently
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+#ifdef EL_HYBRID
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt numRHS = ( onLeft ? n : m );
+    const BlasInt numThreads = omp_get_max_threads();
+    if( numThreads > 1 && numRHS >= numThreads )
+    {
+        const BlasInt chunk = (numRHS + numThreads - 1) / numThreads;
+        #pragma omp parallel for
+        for( BlasInt t=0; t<numThreads; ++t )
+        {
+            const BlasInt start = Min( chunk*t, numRHS );
+            const BlasInt stop = Min( chunk*(t+1), numRHS );
+            if( start == stop )
+                continue;
+            if( onLeft )
+                TrsmSerial
+                ( side, uplo, trans, unit, m, stop-start, alpha,
+                  A, ALDim, &B[start*BLDim], BLDim );
+            else
+                TrsmSerial
+                ( side, uplo, trans, unit, stop-start, n, alpha,
+                  A, ALDim, &B[start], BLDim );
+        }
+        return;
+    }
+#endif
+    TrsmSerial( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+}
 #ifdef EL_HAVE_QD
 template void Trsm
 ( char side, char uplo, char trans, char unit,
@@ -355,6 +395,14 @@ void Trsm
   const float* A, BlasInt ALDim,
         float* B, BlasInt BLDim )
 {
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() &&
+        cublas::WorthOffloading( m, n, std::toupper(side)=='L' ? m : n ) )
+    {
+        cublas::Trsm( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+#endif
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(strsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
@@ -367,6 +415,14 @@ void Trsm
   const double* A, BlasInt ALDim,
         double* B, BlasInt BLDim )
 {
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() &&
+        cublas::WorthOffloading( m, n, std::toupper(side)=='L' ? m : n ) )
+    {
+        cublas::Trsm( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+#endif
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
     EL_BLAS(dtrsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
@@ -379,6 +435,14 @@ void Trsm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() &&
+        cublas::WorthOffloading( m, n, std::toupper(side)=='L' ? m : n ) )
+    {
+        cublas::Trsm( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+#endif
     EL_BLAS(ctrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -390,6 +454,14 @@ void Trsm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+#ifdef EL_HAVE_CUBLAS
+    if( cublas::GpuOffload() &&
+        cublas::WorthOffloading( m, n, std::toupper(side)=='L' ? m : n ) )
+    {
+        cublas::Trsm( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+#endif
     EL_BLAS(ztrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -0,0 +1,231 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace blas {
+
+// A single uniform group of independent triangular solves. Neither the
+// reference BLAS nor OpenBLAS provides a batched interface, and MKL's
+// ?trsm_batch is a much more recent addition than ?gemm_batch, so the
+// members are dispatched from a threaded loop in all configurations.
+
+template<typename F>
+void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* const* A, BlasInt ALDim,
+        F* const* B, BlasInt BLDim,
+  BlasInt batchCount )
+{
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Trsm
+        ( side, uplo, trans, unit, m, n,
+          alpha, A[b], ALDim, B[b], BLDim );
+}
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const float& alpha,
+  const float* const* A, BlasInt ALDim,
+        float* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const double& alpha,
+  const double* const* A, BlasInt ALDim,
+        double* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const scomplex& alpha,
+  const scomplex* const* A, BlasInt ALDim,
+        scomplex* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const dcomplex& alpha,
+  const dcomplex* const* A, BlasInt ALDim,
+        dcomplex* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+#ifdef EL_HAVE_QD
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* const* A, BlasInt ALDim,
+        DoubleDouble* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const QuadDouble& alpha,
+  const QuadDouble* const* A, BlasInt ALDim,
+        QuadDouble* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<DoubleDouble>& alpha,
+  const Complex<DoubleDouble>* const* A, BlasInt ALDim,
+        Complex<DoubleDouble>* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<QuadDouble>& alpha,
+  const Complex<QuadDouble>* const* A, BlasInt ALDim,
+        Complex<QuadDouble>* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+#endif
+#ifdef EL_HAVE_QUAD
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Quad& alpha,
+  const Quad* const* A, BlasInt ALDim,
+        Quad* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* const* A, BlasInt ALDim,
+        Complex<Quad>* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+#endif
+#ifdef EL_HAVE_MPC
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* const* A, BlasInt ALDim,
+        BigFloat* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+template void TrsmBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>* const* A, BlasInt ALDim,
+        Complex<BigFloat>* const* B, BlasInt BLDim,
+  BlasInt batchCount );
+#endif
+
+template<typename F>
+void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim, BlasInt AStride,
+        F* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount )
+{
+    EL_PARALLEL_FOR
+    for( BlasInt b=0; b<batchCount; ++b )
+        Trsm
+        ( side, uplo, trans, unit, m, n,
+          alpha, &A[b*AStride], ALDim, &B[b*BStride], BLDim );
+}
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const float& alpha,
+  const float* A, BlasInt ALDim, BlasInt AStride,
+        float* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const double& alpha,
+  const double* A, BlasInt ALDim, BlasInt AStride,
+        double* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const scomplex& alpha,
+  const scomplex* A, BlasInt ALDim, BlasInt AStride,
+        scomplex* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const dcomplex& alpha,
+  const dcomplex* A, BlasInt ALDim, BlasInt AStride,
+        dcomplex* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+#ifdef EL_HAVE_QD
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim, BlasInt AStride,
+        DoubleDouble* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const QuadDouble& alpha,
+  const QuadDouble* A, BlasInt ALDim, BlasInt AStride,
+        QuadDouble* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<DoubleDouble>& alpha,
+  const Complex<DoubleDouble>* A, BlasInt ALDim, BlasInt AStride,
+        Complex<DoubleDouble>* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<QuadDouble>& alpha,
+  const Complex<QuadDouble>* A, BlasInt ALDim, BlasInt AStride,
+        Complex<QuadDouble>* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+#endif
+#ifdef EL_HAVE_QUAD
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Quad& alpha,
+  const Quad* A, BlasInt ALDim, BlasInt AStride,
+        Quad* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<Quad>& alpha,
+  const Complex<Quad>* A, BlasInt ALDim, BlasInt AStride,
+        Complex<Quad>* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+#endif
+#ifdef EL_HAVE_MPC
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim, BlasInt AStride,
+        BigFloat* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+template void TrsmStridedBatch
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const Complex<BigFloat>& alpha,
+  const Complex<BigFloat>* A, BlasInt ALDim, BlasInt AStride,
+        Complex<BigFloat>* B, BlasInt BLDim, BlasInt BStride,
+  BlasInt batchCount );
+#endif
+
+} // namespace blas
+} // namespace El
@@ -0,0 +1,286 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#ifdef EL_HAVE_CUBLAS
+#include <cuda_runtime.h>
+#include <cublas_v2.h>
+#endif
+
+namespace {
+
+bool gpuOffload = false;
+// Below a geometric-mean dimension of roughly this size the bus transfers
+// dominate the device kernel
+El::BlasInt gpuOffloadThreshold = 512;
+
+} // anonymous namespace
+
+namespace El {
+namespace cublas {
+
+void SetGpuOffload( bool offload )
+{
+#ifdef EL_HAVE_CUBLAS
+    gpuOffload = offload;
+#else
+    if( offload )
+        RuntimeError("Elemental was not configured with cuBLAS support");
+#endif
+}
+
+bool GpuOffload()
+{ return gpuOffload; }
+
+void SetGpuOffloadThreshold( BlasInt dim )
+{ gpuOffloadThreshold = dim; }
+
+BlasInt GpuOffloadThreshold()
+{ return gpuOffloadThreshold; }
+
+bool WorthOffloading( BlasInt m, BlasInt n, BlasInt k )
+{
+    const double thresh = double(gpuOffloadThreshold);
+    return double(m)*double(n)*double(k) >= thresh*thresh*thresh;
+}
+
+} // namespace cublas
+} // namespace El
+
+#ifdef EL_HAVE_CUBLAS
+
+namespace {
+
+using El::BlasInt;
+using El::scomplex;
+using El::dcomplex;
+
+cublasHandle_t cublasHandle;
+bool cublasInitialized = false;
+
+cublasHandle_t Handle()
+{
+    if( !cublasInitialized )
+    {
+        if( cublasCreate( &cublasHandle ) != CUBLAS_STATUS_SUCCESS )
+            El::RuntimeError("Could not initialize cuBLAS");
+        cublasInitialized = true;
+    }
+    return cublasHandle;
+}
+
+cublasOperation_t OpChar( char trans )
+{
+    switch( std::toupper(trans) )
+    {
+    case 'N': return CUBLAS_OP_N;
+    case 'T': return CUBLAS_OP_T;
+    case 'C': return CUBLAS_OP_C;
+    default: El::LogicError("Invalid operation character");
+             return CUBLAS_OP_N;
+    }
+}
+
+cublasFillMode_t FillChar( char uplo )
+{ return std::toupper(uplo)=='L' ? CUBLAS_FILL_MODE_LOWER
+                                 : CUBLAS_FILL_MODE_UPPER; }
+
+cublasSideMode_t SideChar( char side )
+{ return std::toupper(side)=='L' ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT; }
+
+cublasDiagType_t UnitChar( char unit )
+{ return std::toupper(unit)=='U' ? CUBLAS_DIAG_UNIT
+                                 : CUBLAS_DIAG_NON_UNIT; }
+
+// An RAII staging buffer for a column-major host matrix
+template<typename T>
+class DeviceMatrix
+{
+public:
+    DeviceMatrix( BlasInt height, BlasInt width )
+    : height_(height), width_(width)
+    {
+        if( cudaMalloc( &buf_, size_t(height)*width*sizeof(T) ) !=
+            cudaSuccess )
+            El::RuntimeError("cudaMalloc failed");
+    }
+    ~DeviceMatrix() { cudaFree( buf_ ); }
+
+    void Upload( const T* A, BlasInt ALDim )
+    {
+        if( cublasSetMatrix
+            ( height_, width_, sizeof(T), A, ALDim, buf_, height_ ) !=
+            CUBLAS_STATUS_SUCCESS )
+            El::RuntimeError("cublasSetMatrix failed");
+    }
+    void Download( T* A, BlasInt ALDim ) const
+    {
+        if( cublasGetMatrix
+            ( height_, width_, sizeof(T), buf_, height_, A, ALDim ) !=
+            CUBLAS_STATUS_SUCCESS )
+            El::RuntimeError("cublasGetMatrix failed");
+    }
+
+    T* Buffer() { return static_cast<T*>(buf_); }
+    const T* Buffer() const { return static_cast<const T*>(buf_); }
+    BlasInt LDim() const { return height_; }
+
+private:
+    BlasInt height_, width_;
+    void* buf_=nullptr;
+};
+
+void CheckStatus( cublasStatus_t status, const char* routine )
+{
+    if( status != CUBLAS_STATUS_SUCCESS )
+        El::RuntimeError(routine," failed");
+}
+
+} // anonymous namespace
+
+namespace El {
+namespace cublas {
+
+#define EL_CUBLAS_GEMM(T,CudaT,gemm) \
+  void Gemm \
+  ( char transA, char transB, \
+    BlasInt m, BlasInt n, BlasInt k, \
+    T alpha, const T* A, BlasInt ALDim, \
+             const T* B, BlasInt BLDim, \
+    T beta,        T* C, BlasInt CLDim ) \
+  { \
+      const bool normalA = ( std::toupper(transA) == 'N' ); \
+      const bool normalB = ( std::toupper(transB) == 'N' ); \
+      DeviceMatrix<T> ADev( normalA ? m : k, normalA ? k : m ); \
+      DeviceMatrix<T> BDev( normalB ? k : n, normalB ? n : k ); \
+      DeviceMatrix<T> CDev( m, n ); \
+      ADev.Upload( A, ALDim ); \
+      BDev.Upload( B, BLDim ); \
+      if( beta != T(0) ) \
+          CDev.Upload( C, CLDim ); \
+      CheckStatus( \
+        gemm \
+        ( Handle(), OpChar(transA), OpChar(transB), m, n, k, \
+          reinterpret_cast<const CudaT*>(&alpha), \
+          reinterpret_cast<const CudaT*>(ADev.Buffer()), ADev.LDim(), \
+          reinterpret_cast<const CudaT*>(BDev.Buffer()), BDev.LDim(), \
+          reinterpret_cast<const CudaT*>(&beta), \
+          reinterpret_cast<CudaT*>(CDev.Buffer()), CDev.LDim() ), \
+        #gemm ); \
+      CDev.Download( C, CLDim ); \
+  }
+EL_CUBLAS_GEMM(float,float,cublasSgemm)
+EL_CUBLAS_GEMM(double,double,cublasDgemm)
+EL_CUBLAS_GEMM(scomplex,cuComplex,cublasCgemm)
+EL_CUBLAS_GEMM(dcomplex,cuDoubleComplex,cublasZgemm)
+#undef EL_CUBLAS_GEMM
+
+#define EL_CUBLAS_TRSM(T,CudaT,trsm) \
+  void Trsm \
+  ( char side, char uplo, char trans, char unit, \
+    BlasInt m, BlasInt n, \
+    T alpha, const T* A, BlasInt ALDim, \
+                   T* B, BlasInt BLDim ) \
+  { \
+      const BlasInt triDim = ( std::toupper(side) == 'L' ? m : n ); \
+      DeviceMatrix<T> ADev( triDim, triDim ); \
+      DeviceMatrix<T> BDev( m, n ); \
+      ADev.Upload( A, ALDim ); \
+      BDev.Upload( B, BLDim ); \
+      CheckStatus( \
+        trsm \
+        ( Handle(), SideChar(side), FillChar(uplo), OpChar(trans), \
+          UnitChar(unit), m, n, \
+          reinterpret_cast<const CudaT*>(&alpha), \
+          reinterpret_cast<const CudaT*>(ADev.Buffer()), ADev.LDim(), \
+          reinterpret_cast<CudaT*>(BDev.Buffer()), BDev.LDim() ), \
+        #trsm ); \
+      BDev.Download( B, BLDim ); \
+  }
+EL_CUBLAS_TRSM(float,float,cublasStrsm)
+EL_CUBLAS_TRSM(double,double,cublasDtrsm)
+EL_CUBLAS_TRSM(scomplex,cuComplex,cublasCtrsm)
+EL_CUBLAS_TRSM(dcomplex,cuDoubleComplex,cublasZtrsm)
+#undef EL_CUBLAS_TRSM
+
+#define EL_CUBLAS_HERK(T,Real,CudaT,herk) \
+  void Herk \
+  ( char uplo, char trans, \
+    BlasInt n, BlasInt k, \
+    Real alpha, const T* A, BlasInt ALDim, \
+    Real beta,        T* C, BlasInt CLDim ) \
+  { \
+      const bool normal = ( std::toupper(trans) == 'N' ); \
+      DeviceMatrix<T> ADev( normal ? n : k, normal ? k : n ); \
+      DeviceMatrix<T> CDev( n, n ); \
+      ADev.Upload( A, ALDim ); \
+      if( beta != Real(0) ) \
+          CDev.Upload( C, CLDim ); \
+      CheckStatus( \
+        herk \
+        ( Handle(), FillChar(uplo), OpChar(trans), n, k, \
+          &alpha, \
+          reinterpret_cast<const CudaT*>(ADev.Buffer()), ADev.LDim(), \
+          &beta, \
+          reinterpret_cast<CudaT*>(CDev.Buffer()), CDev.LDim() ), \
+        #herk ); \
+      CDev.Download( C, CLDim ); \
+  }
+EL_CUBLAS_HERK(scomplex,float,cuComplex,cublasCherk)
+EL_CUBLAS_HERK(dcomplex,double,cuDoubleComplex,cublasZherk)
+#undef EL_CUBLAS_HERK
+
+// The real cases lower to symmetric rank-k updates
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  float alpha, const float* A, BlasInt ALDim,
+  float beta,        float* C, BlasInt CLDim )
+{
+    const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    DeviceMatrix<float> ADev( normal ? n : k, normal ? k : n );
+    DeviceMatrix<float> CDev( n, n );
+    ADev.Upload( A, ALDim );
+    if( beta != 0.f )
+        CDev.Upload( C, CLDim );
+    CheckStatus(
+      cublasSsyrk
+      ( Handle(), FillChar(uplo), OpChar(transFixed), n, k,
+        &alpha, ADev.Buffer(), ADev.LDim(),
+        &beta, CDev.Buffer(), CDev.LDim() ),
+      "cublasSsyrk" );
+    CDev.Download( C, CLDim );
+}
+
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  double alpha, const double* A, BlasInt ALDim,
+  double beta,        double* C, BlasInt CLDim )
+{
+    const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    DeviceMatrix<double> ADev( normal ? n : k, normal ? k : n );
+    DeviceMatrix<double> CDev( n, n );
+    ADev.Upload( A, ALDim );
+    if( beta != 0. )
+        CDev.Upload( C, CLDim );
+    CheckStatus(
+      cublasDsyrk
+      ( Handle(), FillChar(uplo), OpChar(transFixed), n, k,
+        &alpha, ADev.Buffer(), ADev.LDim(),
+        &beta, CDev.Buffer(), CDev.LDim() ),
+      "cublasDsyrk" );
+    CDev.Download( C, CLDim );
+}
+
+} // namespace cublas
+} // namespace El
+
+#endif // ifdef EL_HAVE_CUBLAS
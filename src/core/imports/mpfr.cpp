@@ -16,6 +16,21 @@ int numIntLimbs;
 
 El::BigInt bigIntZero, bigIntOne, bigIntTwo;
 
+// Each thread recycles the scratch variables leased through
+// mpfr::AcquireScratch via this pool (and deletes them when it exits), so
+// that extended-precision kernels may request temporaries in their inner
+// loops without repeatedly paying for mpfr allocations
+struct BigFloatScratchPool
+{
+    std::vector<El::BigFloat*> available;
+    ~BigFloatScratchPool()
+    {
+        for( auto* scratch : available )
+            delete scratch;
+    }
+};
+thread_local BigFloatScratchPool bigFloatScratchPool;
+
 } // anonymous namespace
 
 namespace El {
@@ -78,6 +93,22 @@ int NumIntLimbs()
 mpfr_rnd_t RoundingMode()
 { return mpfr_get_default_rounding_mode(); }
 
+BigFloat* AcquireScratch()
+{
+    auto& available = ::bigFloatScratchPool.available;
+    if( available.empty() )
+        return new BigFloat;
+    BigFloat* scratch = available.back();
+    available.pop_back();
+    // The default precision may have changed since the last lease
+    if( scratch->Precision() != mpfr::Precision() )
+        scratch->SetPrecision( mpfr::Precision() );
+    return scratch;
+}
+
+void ReleaseScratch( BigFloat* scratch )
+{ ::bigFloatScratchPool.available.push_back( scratch ); }
+
 Int BinaryToDecimalPrecision( mpfr_prec_t prec )
 { return Int(Floor(prec*std::log10(2.))); }
 
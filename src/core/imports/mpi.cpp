@@ -14,6 +14,12 @@
 */
 #include <El-lite.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+
 typedef unsigned char* UCP;
 
 namespace {
@@ -54,6 +60,238 @@ MPI_Op NativeOp( const El::mpi::Op& op )
 namespace El {
 namespace mpi {
 
+namespace {
+
+std::atomic<bool> commStatsEnabled( false );
+std::mutex commStatsMutex;
+std::map<Comm,CommStats> commStatsMap;
+
+}
+
+void EnableCommStats() { commStatsEnabled = true; }
+void DisableCommStats() { commStatsEnabled = false; }
+bool CommStatsEnabled() EL_NO_EXCEPT
+{ return commStatsEnabled.load( std::memory_order_relaxed ); }
+
+void ClearCommStats()
+{
+    std::lock_guard<std::mutex> lock( commStatsMutex );
+    commStatsMap.clear();
+}
+
+CommStats GetCommStats( Comm comm )
+{
+    std::lock_guard<std::mutex> lock( commStatsMutex );
+    return commStatsMap[comm];
+}
+
+namespace comm_stats {
+
+bool Instrumenting() EL_NO_EXCEPT
+{ return CommStatsEnabled() || ProfilingEnabled(); }
+
+void Record( Comm comm, size_t numBytes, double elapsed )
+{
+    profile::RecordCommBytes( double(numBytes) );
+    if( !CommStatsEnabled() )
+        return;
+    std::lock_guard<std::mutex> lock( commStatsMutex );
+    CommStats& stats = commStatsMap[comm];
+    ++stats.numMsgs;
+    stats.numBytes += numBytes;
+    stats.totalTime += elapsed;
+}
+
+} // namespace comm_stats
+
+namespace {
+
+std::mutex commCompressionMutex;
+std::map<Comm,bool> commCompressionMap;
+std::atomic<size_t> commCompressionThreshold( size_t(1)<<22 );
+// The raw payload is split into chunks of this size so that compressing
+// one chunk overlaps with transmitting the previous one
+const size_t commCompressionChunk = size_t(1)<<22;
+
+bool CompressibleMessage( Comm comm, size_t numBytes )
+{
+    if( numBytes == 0 ||
+        numBytes < commCompressionThreshold.load( std::memory_order_relaxed ) )
+        return false;
+    return CommCompressionEnabled( comm );
+}
+
+// Each chunk travels as its own MPI message: a leading flag byte marking
+// whether the payload is compressed, followed by the payload itself. The
+// receiver recovers the message length with a probe, so no separate size
+// exchange is needed.
+size_t PackCompressedChunk
+( const byte* raw, size_t rawSize, std::vector<byte>& msg )
+{
+    msg.resize( 1+CompressBound(rawSize) );
+    const size_t compressedSize =
+      Compress( raw, rawSize, msg.data()+1, rawSize-1 );
+    if( compressedSize == 0 )
+    {
+        // Incompressible; store the chunk raw
+        msg[0] = byte(0);
+        std::memcpy( msg.data()+1, raw, rawSize );
+        return 1+rawSize;
+    }
+    msg[0] = byte(1);
+    return 1+compressedSize;
+}
+
+void UnpackCompressedChunk
+( const byte* msg, size_t msgSize, byte* raw, size_t rawSize )
+{
+    if( msgSize < 1 )
+        RuntimeError("Received an empty compressed chunk");
+    if( msg[0] == byte(0) )
+    {
+        if( msgSize-1 != rawSize )
+            RuntimeError
+            ("Expected a raw chunk of ",rawSize," bytes but received ",
+             msgSize-1);
+        std::memcpy( raw, msg+1, rawSize );
+    }
+    else
+        Decompress( msg+1, msgSize-1, raw, rawSize );
+}
+
+void CompressedSend
+( const byte* data, size_t totalSize, int to, int tag, MPI_Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    std::vector<byte> msgs[2];
+    MPI_Request request;
+    bool pending = false;
+    size_t off=0;
+    int parity=0;
+    while( off < totalSize )
+    {
+        const size_t chunkSize = Min( commCompressionChunk, totalSize-off );
+        const size_t msgSize =
+          PackCompressedChunk( data+off, chunkSize, msgs[parity] );
+        if( pending )
+            SafeMpi( MPI_Wait( &request, MPI_STATUS_IGNORE ) );
+        SafeMpi
+        ( MPI_Isend
+          ( msgs[parity].data(), int(msgSize), MPI_BYTE, to, tag, comm,
+            &request ) );
+        pending = true;
+        parity = 1-parity;
+        off += chunkSize;
+    }
+    if( pending )
+        SafeMpi( MPI_Wait( &request, MPI_STATUS_IGNORE ) );
+}
+
+void CompressedRecv
+( byte* data, size_t totalSize, int from, int tag, MPI_Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    std::vector<byte> msg;
+    size_t off=0;
+    while( off < totalSize )
+    {
+        const size_t chunkSize = Min( commCompressionChunk, totalSize-off );
+        MPI_Status status;
+        SafeMpi( MPI_Probe( from, tag, comm, &status ) );
+        // Pin any wildcards to the first matched message so that all of the
+        // chunks come from the same stream
+        from = status.MPI_SOURCE;
+        tag = status.MPI_TAG;
+        int msgSize;
+        SafeMpi( MPI_Get_count( &status, MPI_BYTE, &msgSize ) );
+        msg.resize( size_t(msgSize) );
+        SafeMpi
+        ( MPI_Recv
+          ( msg.data(), msgSize, MPI_BYTE, from, tag, comm,
+            MPI_STATUS_IGNORE ) );
+        UnpackCompressedChunk( msg.data(), size_t(msgSize), data+off,
+                               chunkSize );
+        off += chunkSize;
+    }
+}
+
+// A SendRecv cannot pipeline a blocking probe loop against a blocking send
+// loop without risking deadlock, so all of the outgoing chunks are
+// compressed and launched up front before the incoming stream is drained
+void CompressedSendRecv
+( const byte* sendData, size_t sendSize, int to,   int sendTag,
+        byte* recvData, size_t recvSize, int from, int recvTag,
+  MPI_Comm comm, bool compressSend, bool compressRecv )
+EL_NO_RELEASE_EXCEPT
+{
+    std::vector<std::vector<byte>> sendMsgs;
+    std::vector<MPI_Request> requests;
+    if( compressSend )
+    {
+        const size_t numChunks =
+          (sendSize+commCompressionChunk-1) / commCompressionChunk;
+        sendMsgs.resize( numChunks );
+        requests.resize( numChunks );
+        size_t off=0;
+        for( size_t chunk=0; chunk<numChunks; ++chunk )
+        {
+            const size_t chunkSize =
+              Min( commCompressionChunk, sendSize-off );
+            const size_t msgSize =
+              PackCompressedChunk( sendData+off, chunkSize,
+                                   sendMsgs[chunk] );
+            SafeMpi
+            ( MPI_Isend
+              ( sendMsgs[chunk].data(), int(msgSize), MPI_BYTE, to, sendTag,
+                comm, &requests[chunk] ) );
+            off += chunkSize;
+        }
+    }
+    else
+    {
+        requests.resize( 1 );
+        SafeMpi
+        ( MPI_Isend
+          ( const_cast<byte*>(sendData), int(sendSize), MPI_BYTE, to,
+            sendTag, comm, &requests[0] ) );
+    }
+
+    if( compressRecv )
+        CompressedRecv( recvData, recvSize, from, recvTag, comm );
+    else
+        SafeMpi
+        ( MPI_Recv
+          ( recvData, int(recvSize), MPI_BYTE, from, recvTag, comm,
+            MPI_STATUS_IGNORE ) );
+
+    SafeMpi
+    ( MPI_Waitall( int(requests.size()), requests.data(),
+                   MPI_STATUSES_IGNORE ) );
+}
+
+} // anonymous namespace
+
+void EnableCommCompression( Comm comm )
+{
+    std::lock_guard<std::mutex> lock( commCompressionMutex );
+    commCompressionMap[comm] = true;
+}
+void DisableCommCompression( Comm comm )
+{
+    std::lock_guard<std::mutex> lock( commCompressionMutex );
+    commCompressionMap[comm] = false;
+}
+bool CommCompressionEnabled( Comm comm )
+{
+    std::lock_guard<std::mutex> lock( commCompressionMutex );
+    auto it = commCompressionMap.find( comm );
+    return it != commCompressionMap.end() && it->second;
+}
+void SetCommCompressionThreshold( size_t numBytes )
+{ commCompressionThreshold = numBytes; }
+size_t CommCompressionThreshold() EL_NO_EXCEPT
+{ return commCompressionThreshold.load( std::memory_order_relaxed ); }
+
 bool CommSameSizeAsInteger() EL_NO_EXCEPT
 { return sizeof(MPI_Comm) == sizeof(int); }
 
@@ -106,6 +344,55 @@ int QueryThread() EL_NO_EXCEPT
     return provided;
 }
 
+namespace {
+
+std::thread progressThread;
+std::atomic<bool> progressActive( false );
+MPI_Comm progressComm = MPI_COMM_NULL;
+
+} // anonymous namespace
+
+void StartProgressThread()
+{
+    EL_DEBUG_CSE
+    if( progressActive.load() )
+        return;
+    if( QueryThread() < MPI_THREAD_MULTIPLE )
+        RuntimeError
+        ("The progress thread requires MPI_THREAD_MULTIPLE support");
+    // Poll over a private duplicate so that the probes can never match (and
+    // thereby reorder) the library's own traffic
+    SafeMpi( MPI_Comm_dup( MPI_COMM_WORLD, &progressComm ) );
+    progressActive.store( true );
+    progressThread = std::thread(
+      []()
+      {
+          while( progressActive.load() )
+          {
+              // Any call into the library drives its progress engine, which
+              // completes the operations outstanding on the other threads
+              int flag;
+              MPI_Status status;
+              MPI_Iprobe
+              ( MPI_ANY_SOURCE, MPI_ANY_TAG, progressComm, &flag, &status );
+              std::this_thread::sleep_for( std::chrono::microseconds(10) );
+          }
+      } );
+}
+
+void StopProgressThread()
+{
+    EL_DEBUG_CSE
+    if( !progressActive.load() )
+        return;
+    progressActive.store( false );
+    progressThread.join();
+    SafeMpi( MPI_Comm_free( &progressComm ) );
+}
+
+bool ProgressThreadRunning() EL_NO_EXCEPT
+{ return progressActive.load(); }
+
 void Abort( Comm comm, int errCode ) EL_NO_EXCEPT
 { MPI_Abort( comm.comm, errCode ); }
 
@@ -176,6 +463,152 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef MPI_COMM_TYPE_SHARED
+    SafeMpi(
+      MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &newComm.comm ) );
+#else
+    // Without MPI-3's split-type query the best we can do is to treat all
+    // of the processes as a single shared-memory domain
+    SafeMpi( MPI_Comm_split( comm.comm, 0, key, &newComm.comm ) );
+#endif
+}
+
+bool HaveSharedWindows() EL_NO_EXCEPT
+{
+#ifdef MPI_WIN_FLAVOR_SHARED
+    return true;
+#else
+    return false;
+#endif
+}
+
+void* WinAllocShared( size_t numBytes, Comm comm, Window& window )
+{
+    EL_DEBUG_CSE
+#ifdef MPI_WIN_FLAVOR_SHARED
+    void* baseptr;
+    SafeMpi(
+      MPI_Win_allocate_shared
+      ( MPI_Aint(numBytes), 1, MPI_INFO_NULL, comm.comm,
+        &baseptr, &window.win ) );
+    return baseptr;
+#else
+    RuntimeError("MPI-3 shared windows are not supported");
+    return nullptr;
+#endif
+}
+
+void* WinSharedQuery( Window& window, int rank )
+{
+    EL_DEBUG_CSE
+#ifdef MPI_WIN_FLAVOR_SHARED
+    MPI_Aint segmentSize;
+    int dispUnit;
+    void* baseptr;
+    SafeMpi(
+      MPI_Win_shared_query
+      ( window.win, rank, &segmentSize, &dispUnit, &baseptr ) );
+    return baseptr;
+#else
+    RuntimeError("MPI-3 shared windows are not supported");
+    return nullptr;
+#endif
+}
+
+void WinLockAllShared( Window& window )
+{
+    EL_DEBUG_CSE
+#ifdef MPI_WIN_FLAVOR_SHARED
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, window.win ) );
+#else
+    RuntimeError("MPI-3 shared windows are not supported");
+#endif
+}
+
+void WinUnlockAll( Window& window )
+{
+    EL_DEBUG_CSE
+#ifdef MPI_WIN_FLAVOR_SHARED
+    SafeMpi( MPI_Win_unlock_all( window.win ) );
+#else
+    RuntimeError("MPI-3 shared windows are not supported");
+#endif
+}
+
+void Free( Window& window )
+{
+    EL_DEBUG_CSE
+    if( window.win != MPI_WIN_NULL )
+        SafeMpi( MPI_Win_free( &window.win ) );
+}
+
+void WinCreate
+( void* buffer, size_t numBytes, int dispUnit, Comm comm, Window& window )
+{
+    EL_DEBUG_CSE
+    SafeMpi(
+      MPI_Win_create
+      ( buffer, MPI_Aint(numBytes), dispUnit, MPI_INFO_NULL, comm.comm,
+        &window.win ) );
+}
+
+void WinLockAll( Window& window )
+{
+    EL_DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, window.win ) );
+#else
+    RuntimeError("MPI-3 one-sided support is required");
+#endif
+}
+
+void WinFlushAll( Window& window )
+{
+    EL_DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi( MPI_Win_flush_all( window.win ) );
+#else
+    RuntimeError("MPI-3 one-sided support is required");
+#endif
+}
+
+template<typename T>
+void Accumulate
+( const T* buffer, int count, int target, Aint targetDisp, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi(
+      MPI_Accumulate
+      ( buffer, count, TypeMap<T>(), target, targetDisp, count,
+        TypeMap<T>(), MPI_SUM, window.win ) );
+}
+
+// MPI_SUM is only valid for predefined datatypes, so the accumulations are
+// not instantiated over the full list of types serviced by MPI_PROTO
+template void Accumulate
+( const int* buffer, int count, int target, Aint targetDisp,
+  Window& window ) EL_NO_RELEASE_EXCEPT;
+template void Accumulate
+( const long long int* buffer, int count, int target, Aint targetDisp,
+  Window& window ) EL_NO_RELEASE_EXCEPT;
+template void Accumulate
+( const float* buffer, int count, int target, Aint targetDisp,
+  Window& window ) EL_NO_RELEASE_EXCEPT;
+template void Accumulate
+( const double* buffer, int count, int target, Aint targetDisp,
+  Window& window ) EL_NO_RELEASE_EXCEPT;
+template void Accumulate
+( const Complex<float>* buffer, int count, int target, Aint targetDisp,
+  Window& window ) EL_NO_RELEASE_EXCEPT;
+template void Accumulate
+( const Complex<double>* buffer, int count, int target, Aint targetDisp,
+  Window& window ) EL_NO_RELEASE_EXCEPT;
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -552,6 +985,14 @@ void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    const size_t numBytes = sizeof(Real)*size_t(count);
+    CommStatsEntry statsEntry( comm, numBytes );
+    if( CompressibleMessage( comm, numBytes ) )
+    {
+        CompressedSend
+        ( reinterpret_cast<const byte*>(buf), numBytes, to, tag, comm.comm );
+        return;
+    }
     SafeMpi
     ( MPI_Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
@@ -564,6 +1005,14 @@ void TaggedSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    const size_t numBytes = sizeof(Complex<Real>)*size_t(count);
+    CommStatsEntry statsEntry( comm, numBytes );
+    if( CompressibleMessage( comm, numBytes ) )
+    {
+        CompressedSend
+        ( reinterpret_cast<const byte*>(buf), numBytes, to, tag, comm.comm );
+        return;
+    }
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -583,6 +1032,7 @@ template<typename T,
 void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(count) );
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
@@ -790,12 +1240,130 @@ void TaggedISSend( T b, int to, int tag, Comm comm, Request<T>& request )
 EL_NO_RELEASE_EXCEPT
 { TaggedISSend( &b, 1, to, tag, comm, request ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void SendInit
+( const Real* buf, int count, int to, int tag, Comm comm,
+  Request<Real>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Send_init
+      ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
+        tag, comm.comm, &request.backend ) );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void SendInit
+( const Complex<Real>* buf, int count, int to, int tag, Comm comm,
+  Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Send_init
+      ( const_cast<Complex<Real>*>(buf), 2*count,
+        TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( MPI_Send_init
+      ( const_cast<Complex<Real>*>(buf), count,
+        TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void SendInit
+( const T* buf, int count, int to, int tag, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    LogicError("Persistent communication requires a packed datatype");
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void RecvInit
+( Real* buf, int count, int from, int tag, Comm comm,
+  Request<Real>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Recv_init
+      ( buf, count, TypeMap<Real>(), from, tag, comm.comm,
+        &request.backend ) );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void RecvInit
+( Complex<Real>* buf, int count, int from, int tag, Comm comm,
+  Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Recv_init
+      ( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm,
+        &request.backend ) );
+#else
+    SafeMpi
+    ( MPI_Recv_init
+      ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm,
+        &request.backend ) );
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void RecvInit
+( T* buf, int count, int from, int tag, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    LogicError("Persistent communication requires a packed datatype");
+}
+
+template<typename T>
+void Start( Request<T>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Start( &request.backend ) );
+}
+
+template<typename T>
+void StartAll( int numRequests, Request<T>* requests ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    for( int k=0; k<numRequests; ++k )
+        Start( requests[k] );
+}
+
+template<typename T>
+void RequestFree( Request<T>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Request_free( &request.backend ) );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void TaggedRecv( Real* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    const size_t numBytes = sizeof(Real)*size_t(count);
+    CommStatsEntry statsEntry( comm, numBytes );
+    if( CompressibleMessage( comm, numBytes ) )
+    {
+        CompressedRecv
+        ( reinterpret_cast<byte*>(buf), numBytes, from, tag, comm.comm );
+        return;
+    }
     Status status;
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
@@ -807,6 +1375,14 @@ void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    const size_t numBytes = sizeof(Complex<Real>)*size_t(count);
+    CommStatsEntry statsEntry( comm, numBytes );
+    if( CompressibleMessage( comm, numBytes ) )
+    {
+        CompressedRecv
+        ( reinterpret_cast<byte*>(buf), numBytes, from, tag, comm.comm );
+        return;
+    }
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -824,6 +1400,7 @@ template<typename T,
 void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(count) );
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Status status;
@@ -923,6 +1500,19 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    const size_t sendBytes = sizeof(Real)*size_t(sc);
+    const size_t recvBytes = sizeof(Real)*size_t(rc);
+    CommStatsEntry statsEntry( comm, sendBytes+recvBytes );
+    const bool compressSend = CompressibleMessage( comm, sendBytes );
+    const bool compressRecv = CompressibleMessage( comm, recvBytes );
+    if( compressSend || compressRecv )
+    {
+        CompressedSendRecv
+        ( reinterpret_cast<const byte*>(sbuf), sendBytes, to,   stag,
+          reinterpret_cast<byte*>(rbuf),       recvBytes, from, rtag,
+          comm.comm, compressSend, compressRecv );
+        return;
+    }
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -939,6 +1529,19 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    const size_t sendBytes = sizeof(Complex<Real>)*size_t(sc);
+    const size_t recvBytes = sizeof(Complex<Real>)*size_t(rc);
+    CommStatsEntry statsEntry( comm, sendBytes+recvBytes );
+    const bool compressSend = CompressibleMessage( comm, sendBytes );
+    const bool compressRecv = CompressibleMessage( comm, recvBytes );
+    if( compressSend || compressRecv )
+    {
+        CompressedSendRecv
+        ( reinterpret_cast<const byte*>(sbuf), sendBytes, to,   stag,
+          reinterpret_cast<byte*>(rbuf),       recvBytes, from, rtag,
+          comm.comm, compressSend, compressRecv );
+        return;
+    }
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -964,6 +1567,7 @@ void TaggedSendRecv
         T* rbuf, int rc, int from, int rtag, Comm comm )
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*(size_t(sc)+size_t(rc)) );
     Status status;
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
@@ -1004,6 +1608,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(count) );
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -1019,6 +1624,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(count) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1041,6 +1647,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(count) );
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Serialize( count, buf, packedBuf );
@@ -1063,6 +1670,7 @@ void Broadcast( Real* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(count) );
     if( Size(comm) == 1 || count == 0 )
         return;
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
@@ -1074,6 +1682,7 @@ void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(count) );
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -1090,6 +1699,7 @@ void Broadcast( T* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(count) );
     if( Size(comm) == 1 || count == 0 )
         return;
     std::vector<byte> packedBuf;
@@ -1153,10 +1763,10 @@ void IBroadcast
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
+    Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Ibcast
-      ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
+      ( request.buffer.data(), count, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1175,6 +1785,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(sc) );
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1189,6 +1800,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(sc) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1213,6 +1825,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(sc) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalRecv = rc*commSize;
@@ -1289,6 +1902,7 @@ void IGather
 {
     EL_DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    Serialize( sc, sbuf, request.sendBuffer );
     if( mpi::Rank(comm) == root )
     {
         const int commSize = mpi::Size(comm);
@@ -1299,8 +1913,8 @@ void IGather
     }
     SafeMpi
     ( MPI_Igather
-      ( request.buffer.data(), sc, TypeMap<Real>(),
-        rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
+      ( request.sendBuffer.data(), sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1316,6 +1930,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(sc) );
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf),
@@ -1338,6 +1953,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(sc) );
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1382,6 +1998,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(sc) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     int totalRecv=0;
@@ -1416,6 +2033,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(sc) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1440,6 +2058,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(sc) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1474,6 +2093,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(sc) );
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -1496,6 +2116,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(sc) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1533,6 +2154,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(sc) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1585,6 +2207,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(sc) );
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
 
@@ -1605,6 +2228,78 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const int commSize = mpi::Size(comm);
+    Serialize( sc, sbuf, request.sendBuffer );
+    request.receivingPacked = true;
+    request.recvCount = rc*commSize;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc*commSize, rbuf, request.buffer );
+    SafeMpi
+    ( MPI_Iallgather
+      ( request.sendBuffer.data(), sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Scatter
@@ -1613,6 +2308,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(rc) );
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1627,6 +2323,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(rc) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1651,6 +2348,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(rc) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1673,6 +2371,7 @@ void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(rc) );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1696,6 +2395,7 @@ void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(rc) );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1734,6 +2434,7 @@ void Scatter( T* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(rc) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1760,6 +2461,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(sc)*size_t(Size(comm)) );
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1774,6 +2476,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(sc)*size_t(Size(comm)) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1800,6 +2503,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(sc)*size_t(Size(comm)) );
     const int commSize = mpi::Size( comm );
     const int totalSend = sc*commSize;
     const int totalRecv = rc*commSize;
@@ -1928,6 +2632,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(count) );
     if( count == 0 )
         return;
 
@@ -1946,6 +2651,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(count) );
     if( count == 0 )
         return;
 
@@ -1984,6 +2690,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(count) );
     if( count == 0 )
         return;
 
@@ -2032,6 +2739,7 @@ void Reduce( Real* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(count) );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2057,6 +2765,7 @@ void Reduce( Complex<Real>* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(count) );
     if( Size(comm) == 1 )
         return;
     if( count != 0 )
@@ -2119,6 +2828,7 @@ void Reduce( T* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(count) );
     if( count == 0 )
         return;
 
@@ -2151,6 +2861,7 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(count) );
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2168,6 +2879,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(count) );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2205,6 +2917,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(count) );
     if( count == 0 )
         return;
 
@@ -2220,6 +2933,93 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( count, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op,
+  Comm comm, Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( MPI_Iallreduce
+          ( const_cast<Complex<Real>*>(sbuf),
+            rbuf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        SafeMpi
+        ( MPI_Iallreduce
+          ( const_cast<Complex<Real>*>(sbuf),
+            rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm,
+            &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( const_cast<Complex<Real>*>(sbuf),
+        rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm,
+        &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<T>( op );
+    Serialize( count, sbuf, request.sendBuffer );
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( count, rbuf, request.buffer );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( request.sendBuffer.data(), request.buffer.data(), count,
+        TypeMap<T>(), opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( sbuf, rbuf, count, SUM, comm, request ); }
+
 template<typename T>
 void AllReduce( const T* sbuf, T* rbuf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
@@ -2241,6 +3041,7 @@ void AllReduce( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(count) );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2256,6 +3057,7 @@ void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(count) );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2291,6 +3093,7 @@ void AllReduce( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(count) );
     if( count == 0 )
         return;
 
@@ -2311,12 +3114,207 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+namespace {
+
+// IEEE binary16 conversions for the HALF_WIRE reduction mode
+unsigned short FloatToHalfBits( float value )
+{
+    unsigned bits;
+    std::memcpy( &bits, &value, 4 );
+    const unsigned short sign = (unsigned short)((bits>>16) & 0x8000u);
+    const unsigned floatExp = (bits>>23) & 0xffu;
+    unsigned mant = bits & 0x7fffffu;
+    if( floatExp == 0xffu ) // Inf or NaN
+        return sign | 0x7c00u | (mant ? 0x200u : 0u);
+    const int exp = int(floatExp) - 127 + 15;
+    if( exp >= 31 ) // overflow to Inf
+        return sign | 0x7c00u;
+    if( exp <= 0 )
+    {
+        if( exp < -10 ) // underflow to zero
+            return sign;
+        // Subnormal half
+        mant |= 0x800000u;
+        const int shift = 14 - exp;
+        unsigned short half = (unsigned short)(mant >> shift);
+        if( (mant >> (shift-1)) & 1u ) // round to nearest
+            ++half;
+        return sign | half;
+    }
+    unsigned short half =
+      sign | (unsigned short)(exp<<10) | (unsigned short)(mant>>13);
+    if( mant & 0x1000u ) // round to nearest; a carry bumps the exponent
+        ++half;
+    return half;
+}
+
+float HalfBitsToFloat( unsigned short half )
+{
+    const unsigned sign = (unsigned(half) & 0x8000u) << 16;
+    const unsigned halfExp = (half>>10) & 0x1fu;
+    unsigned mant = unsigned(half) & 0x3ffu;
+    unsigned bits;
+    if( halfExp == 0x1fu ) // Inf or NaN
+        bits = sign | 0x7f800000u | (mant<<13);
+    else if( halfExp != 0 )
+        bits = sign | ((halfExp-15+127)<<23) | (mant<<13);
+    else if( mant == 0 )
+        bits = sign;
+    else
+    {
+        // Normalize the subnormal
+        int exp = 1;
+        while( !(mant & 0x400u) )
+        {
+            mant <<= 1;
+            --exp;
+        }
+        mant &= 0x3ffu;
+        bits = sign | unsigned(exp-15+127)<<23 | (mant<<13);
+    }
+    float value;
+    std::memcpy( &value, &bits, 4 );
+    return value;
+}
+
+void HalfSumFunc( void* inVoid, void* outVoid, int* length, MPI_Datatype* )
+{
+    auto in = static_cast<const unsigned short*>(inVoid);
+    auto out = static_cast<unsigned short*>(outVoid);
+    for( int k=0; k<*length; ++k )
+        out[k] =
+          FloatToHalfBits( HalfBitsToFloat(in[k]) + HalfBitsToFloat(out[k]) );
+}
+void HalfMaxFunc( void* inVoid, void* outVoid, int* length, MPI_Datatype* )
+{
+    auto in = static_cast<const unsigned short*>(inVoid);
+    auto out = static_cast<unsigned short*>(outVoid);
+    for( int k=0; k<*length; ++k )
+        out[k] =
+          FloatToHalfBits
+          ( std::max( HalfBitsToFloat(in[k]), HalfBitsToFloat(out[k]) ) );
+}
+void HalfMinFunc( void* inVoid, void* outVoid, int* length, MPI_Datatype* )
+{
+    auto in = static_cast<const unsigned short*>(inVoid);
+    auto out = static_cast<unsigned short*>(outVoid);
+    for( int k=0; k<*length; ++k )
+        out[k] =
+          FloatToHalfBits
+          ( std::min( HalfBitsToFloat(in[k]), HalfBitsToFloat(out[k]) ) );
+}
+
+MPI_Op HalfWireOp( Op op )
+{
+    static std::once_flag onceFlag;
+    static MPI_Op halfSumOp, halfMaxOp, halfMinOp;
+    std::call_once
+    ( onceFlag,
+      []()
+      {
+          MPI_Op_create( &HalfSumFunc, 1, &halfSumOp );
+          MPI_Op_create( &HalfMaxFunc, 1, &halfMaxOp );
+          MPI_Op_create( &HalfMinFunc, 1, &halfMinOp );
+      } );
+    if( op == SUM )
+        return halfSumOp;
+    else if( op == MAX )
+        return halfMaxOp;
+    else if( op == MIN )
+        return halfMinOp;
+    LogicError("HALF_WIRE reductions only support SUM, MAX, and MIN");
+    return halfSumOp;
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void AllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  WirePrecision precision )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( precision == FULL_WIRE || count == 0 )
+    {
+        AllReduce( sbuf, rbuf, count, op, comm );
+        return;
+    }
+    if( precision == SINGLE_WIRE )
+    {
+        CommStatsEntry statsEntry( comm, sizeof(float)*size_t(count) );
+        std::vector<float> send(count), recv(count);
+        for( int k=0; k<count; ++k )
+            send[k] = float(sbuf[k]);
+        MPI_Op opC = NativeOp<float>( op );
+        SafeMpi
+        ( MPI_Allreduce
+          ( send.data(), recv.data(), count, MPI_FLOAT, opC, comm.comm ) );
+        for( int k=0; k<count; ++k )
+            rbuf[k] = Real(recv[k]);
+    }
+    else
+    {
+        CommStatsEntry statsEntry( comm, sizeof(unsigned short)*size_t(count) );
+        std::vector<unsigned short> send(count), recv(count);
+        for( int k=0; k<count; ++k )
+            send[k] = FloatToHalfBits( float(sbuf[k]) );
+        SafeMpi
+        ( MPI_Allreduce
+          ( send.data(), recv.data(), count, MPI_UNSIGNED_SHORT,
+            HalfWireOp(op), comm.comm ) );
+        for( int k=0; k<count; ++k )
+            rbuf[k] = Real(HalfBitsToFloat(recv[k]));
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void AllReduce
+( Real* buf, int count, Op op, Comm comm, WirePrecision precision )
+EL_NO_RELEASE_EXCEPT
+{
+    if( precision == FULL_WIRE )
+        AllReduce( buf, count, op, comm );
+    else
+        // Aliasing the two buffers is safe here since the narrowed paths
+        // stage through scratch vectors
+        AllReduce( buf, buf, count, op, comm, precision );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+Real AllReduce( Real sb, Op op, Comm comm, WirePrecision precision )
+EL_NO_RELEASE_EXCEPT
+{
+    Real rb;
+    AllReduce( &sb, &rb, 1, op, comm, precision );
+    return rb;
+}
+
+template void AllReduce
+( const float* sbuf, float* rbuf, int count, Op op, Comm comm,
+  WirePrecision precision );
+template void AllReduce
+( const double* sbuf, double* rbuf, int count, Op op, Comm comm,
+  WirePrecision precision );
+template void AllReduce
+( float* buf, int count, Op op, Comm comm, WirePrecision precision );
+template void AllReduce
+( double* buf, int count, Op op, Comm comm, WirePrecision precision );
+template float AllReduce
+( float sb, Op op, Comm comm, WirePrecision precision );
+template double AllReduce
+( double sb, Op op, Comm comm, WirePrecision precision );
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(rc)*size_t(Size(comm)) );
     if( rc == 0 )
         return;
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
@@ -2343,6 +3341,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(rc)*size_t(Size(comm)) );
     if( rc == 0 )
         return;
 
@@ -2377,6 +3376,7 @@ void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(rc)*size_t(Size(comm)) );
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2424,6 +3424,7 @@ void ReduceScatter( Real* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(rc)*size_t(Size(comm)) );
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2451,6 +3452,7 @@ void ReduceScatter( Complex<Real>* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(rc)*size_t(Size(comm)) );
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2486,6 +3488,7 @@ void ReduceScatter( T* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(rc)*size_t(Size(comm)) );
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2626,6 +3629,7 @@ void Scan( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(count) );
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2644,6 +3648,7 @@ void Scan
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(count) );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2680,6 +3685,7 @@ void Scan( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(count) );
     if( count == 0 )
         return;
 
@@ -2723,6 +3729,7 @@ void Scan( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Real)*size_t(count) );
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2738,6 +3745,7 @@ void Scan( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(Complex<Real>)*size_t(count) );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2773,6 +3781,7 @@ void Scan( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CommStatsEntry statsEntry( comm, sizeof(T)*size_t(count) );
     if( count == 0 )
         return;
 
@@ -2804,7 +3813,7 @@ void SparseAllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendCounts, recvCounts, comm ))
+    EL_HEAVY_DEBUG_ONLY(VerifySendsAndRecvs( sendCounts, recvCounts, comm ))
 #ifdef EL_USE_CUSTOM_ALLTOALLV
     const int commSize = Size( comm );
     int numSends=0,numRecvs=0;
@@ -2882,6 +3891,11 @@ EL_NO_RELEASE_EXCEPT
   template void TaggedISSend<T> \
   ( T b, int to, int tag, Comm comm, Request<T>& request ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void Start<T>( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
+  template void StartAll<T>( int numRequests, Request<T>* requests ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void RequestFree<T>( Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
   template void TaggedRecv<T> \
   ( T* buf, int count, int from, int tag, Comm comm ) EL_NO_RELEASE_EXCEPT; \
   template void Recv<T>( T* buf, int count, int from, Comm comm ) \
@@ -2926,6 +3940,8 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, int sc, \
           T* rbuf, int rc, \
     int root, Comm comm, Request<T>& request ); \
+  template void IAllReduce<T> \
+  ( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request ); \
   template vector<T> AllToAll<T> \
   ( const vector<T>& sendBuf, \
     const vector<int>& sendCounts, \
@@ -2986,6 +4002,12 @@ EL_NO_RELEASE_EXCEPT
   template void TaggedISend<S> \
   ( const T* buf, int count, int to, int tag, Comm comm, Request<T>& request ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void SendInit<S> \
+  ( const T* buf, int count, int to, int tag, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void RecvInit<S> \
+  ( T* buf, int count, int from, int tag, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
   template void Broadcast<S>( T* buf, int count, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void Gather<S> \
@@ -3001,6 +4023,9 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather<S> \
+  ( const T* sbuf, int sc, \
+          T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template void Scatter<S> \
   ( const T* sbuf, int sc, \
           T* rbuf, int rc, int root, Comm comm ) \
@@ -3022,7 +4047,10 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, T* rbuf, int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce<S>( T* buf, int count, Op op, Comm comm ) \
-  EL_NO_RELEASE_EXCEPT;
+  EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce<S> \
+  ( const T* sbuf, T* rbuf, int count, Op op, Comm comm, \
+    Request<T>& request );
 
 #define MPI_PROTO_REAL(T) \
   MPI_PROTO_BASE(T) \
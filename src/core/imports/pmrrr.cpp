@@ -218,5 +218,97 @@ Info Eig
     return info;
 }
 
+// Compute all of the eigenpairs with eigenvalue indices in
+// [lowerBound,upperBound] via disjoint index windows solved concurrently by
+// independent teams of processes
+Info SlicedEig
+( int n, double* d, double* e, double* w, double* Z, int ldz, mpi::Comm comm,
+  int lowerBound, int upperBound, int numSlices )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int k = (upperBound-lowerBound)+1;
+    numSlices = Min( numSlices, Min( commSize, k ) );
+    if( numSlices <= 1 )
+        return Eig( n, d, e, w, Z, ldz, comm, lowerBound, upperBound );
+
+    // Assign contiguous teams of processes to contiguous index windows,
+    // with the remainders of both spread over the leading teams
+    const int teamSize = commSize / numSlices;
+    const int teamRem = commSize % numSlices;
+    int slice;
+    if( commRank < teamRem*(teamSize+1) )
+        slice = commRank / (teamSize+1);
+    else
+        slice = teamRem + (commRank-teamRem*(teamSize+1)) / teamSize;
+    const int sliceSize = teamSize + ( slice < teamRem ? 1 : 0 );
+    const int windowSize = k/numSlices + ( slice < k%numSlices ? 1 : 0 );
+    const int windowOff = slice*(k/numSlices) + Min( slice, k%numSlices );
+
+    mpi::Comm sliceComm;
+    mpi::Split( comm, slice, commRank, sliceComm );
+
+    // Solve this team's window, which produces a contiguous, ascending block
+    // of at most ceil(windowSize/sliceSize) local eigenpairs
+    const int maxLocal = (windowSize+sliceSize-1) / sliceSize;
+    vector<double> wSlice( n );
+    vector<double> ZSlice( size_t(n)*Max(maxLocal,1) );
+    auto sliceInfo = Eig
+      ( n, d, e, wSlice.data(), ZSlice.data(), Max(n,1), sliceComm,
+        lowerBound+windowOff, (lowerBound+windowOff+windowSize)-1 );
+    mpi::Free( sliceComm );
+
+    // Route each eigenpair to its owner in the cyclic wrapping of the full
+    // window over the original communicator. Each packed eigenpair is
+    // prefixed with its (relative) ordered index and eigenvalue.
+    const int nzLoc = sliceInfo.numLocalEigenvalues;
+    const int firstLoc = windowOff + sliceInfo.firstLocalEigenvalue;
+    const int pairSize = n + 2;
+    vector<int> sendCounts( commSize, 0 );
+    for( int t=0; t<nzLoc; ++t )
+        sendCounts[(firstLoc+t) % commSize] += pairSize;
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<double> sendBuf( totalSend );
+    auto offs = sendOffs;
+    for( int t=0; t<nzLoc; ++t )
+    {
+        const int j = firstLoc + t;
+        double* pair = &sendBuf[offs[j % commSize]];
+        pair[0] = double(j);
+        pair[1] = wSlice[t];
+        MemCopy( &pair[2], &ZSlice[size_t(t)*n], n );
+        offs[j % commSize] += pairSize;
+    }
+    SwapClear( wSlice );
+    SwapClear( ZSlice );
+
+    vector<int> recvCounts( commSize );
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    vector<int> recvOffs;
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    vector<double> recvBuf( totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+    SwapClear( sendBuf );
+
+    const int numLocal = totalRecv / pairSize;
+    for( int t=0; t<numLocal; ++t )
+    {
+        const double* pair = &recvBuf[size_t(t)*pairSize];
+        const int iLoc = int(pair[0]) / commSize;
+        w[iLoc] = pair[1];
+        MemCopy( &Z[size_t(iLoc)*ldz], &pair[2], n );
+    }
+
+    Info info;
+    info.numLocalEigenvalues = numLocal;
+    info.firstLocalEigenvalue = ( numLocal > 0 ? commRank : 0 );
+    info.numGlobalEigenvalues = k;
+    return info;
+}
+
 } // namespace herm_tridiag_eig
 } // namespace El
@@ -10,7 +10,9 @@
 
 namespace {
 
-El::Int indentLevel=0;
+// Per-thread so that concurrently running grids may nest their output
+// independently
+thread_local El::Int indentLevel=0;
 El::Int spacesPerIndent=2;
 
 }
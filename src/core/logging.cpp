@@ -2,18 +2,98 @@
    Copyright (c) 2009-2016, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+
+#include <atomic>
+#include <condition_variable>
 #include <iomanip>
+#include <map>
+#include <mutex>
+#include <thread>
 
 namespace {
+using namespace El;
 
 // A (per-process) output file for logging
 std::ofstream logFile;
 
+// Severity filtering and sampling
+std::atomic<int> logThreshold{ int(LOG_DEBUG) };
+std::atomic<unsigned> samplingIntervals[4] = { {1}, {1}, {1}, {1} };
+std::atomic<unsigned long> samplingCounters[4] = { {0}, {0}, {0}, {0} };
+
+// The asynchronous backend: a bounded ring of formatted lines which a
+// background thread drains to the log file, so that the producing threads
+// only pay for an enqueue rather than for file I/O. When the producers
+// outrun the drain the oldest lines are overwritten (and counted).
+std::atomic<bool> asyncEnabled( false );
+std::mutex ringMutex;
+std::condition_variable ringCV;
+std::vector<std::string> ring( 1024 );
+size_t ringHead=0, ringCount=0;
+unsigned long droppedLines=0;
+bool workerRunning=false, workerShouldExit=false;
+std::thread worker;
+
+// The counts of the distinct messages seen so far, retained (up to a cap)
+// for the collective LogSummary
+std::mutex countsMutex;
+std::map<std::string,unsigned long> messageCounts;
+const size_t maxDistinctMessages = 4096;
+
+const char* SeverityName( LogSeverity severity )
+{
+    switch( severity )
+    {
+    case LOG_DEBUG:   return "DEBUG";
+    case LOG_INFO:    return "INFO";
+    case LOG_WARNING: return "WARNING";
+    default:          return "ERROR";
+    }
+}
+
+void WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock( ::ringMutex );
+    while( true )
+    {
+        ::ringCV.wait
+        ( lock, []{ return ::ringCount > 0 || ::workerShouldExit; } );
+        while( ::ringCount > 0 )
+        {
+            const size_t oldest =
+              (::ringHead + ::ring.size() - ::ringCount) % ::ring.size();
+            std::string line = std::move( ::ring[oldest] );
+            --::ringCount;
+            lock.unlock();
+            LogOS() << line << '\n';
+            lock.lock();
+        }
+        LogOS().flush();
+        if( ::workerShouldExit )
+            break;
+    }
+}
+
+void Enqueue( std::string line )
+{
+    {
+        std::lock_guard<std::mutex> lock( ::ringMutex );
+        // When full, the slot at the head is also the oldest line
+        ::ring[::ringHead] = std::move(line);
+        ::ringHead = (::ringHead+1) % ::ring.size();
+        if( ::ringCount < ::ring.size() )
+            ++::ringCount;
+        else
+            ++::droppedLines;
+    }
+    ::ringCV.notify_one();
+}
+
 }
 
 namespace El {
@@ -34,9 +114,161 @@ std::ostream& LogOS()
                << mpi::Rank() << ".log";
         ::logFile.open( fileOS.str().c_str() );
     }
-    return ::logFile; 
+    return ::logFile;
+}
+
+void EnableAsyncLogging()
+{
+    std::lock_guard<std::mutex> lock( ::ringMutex );
+    if( !::workerRunning )
+    {
+        ::workerShouldExit = false;
+        ::worker = std::thread( ::WorkerLoop );
+        ::workerRunning = true;
+    }
+    ::asyncEnabled = true;
+}
+
+void DisableAsyncLogging()
+{
+    ::asyncEnabled = false;
+    {
+        std::lock_guard<std::mutex> lock( ::ringMutex );
+        if( !::workerRunning )
+            return;
+        ::workerShouldExit = true;
+    }
+    ::ringCV.notify_one();
+    ::worker.join();
+    ::workerRunning = false;
+    if( ::droppedLines != 0 )
+    {
+        LogOS() << "[WARNING] dropped " << ::droppedLines
+                << " log line(s) from a full ring buffer" << std::endl;
+        ::droppedLines = 0;
+    }
 }
 
-void CloseLog() { ::logFile.close(); }
+bool AsyncLoggingEnabled() EL_NO_EXCEPT
+{ return ::asyncEnabled.load( std::memory_order_relaxed ); }
+
+void SetLogThreshold( LogSeverity severity )
+{ ::logThreshold = int(severity); }
+
+LogSeverity LogThreshold() EL_NO_EXCEPT
+{ return LogSeverity(::logThreshold.load( std::memory_order_relaxed )); }
+
+void SetLogSamplingInterval( LogSeverity severity, unsigned interval )
+{ ::samplingIntervals[int(severity)] = Max( interval, 1u ); }
+
+void LogLine( LogSeverity severity, const string& line )
+{
+    if( int(severity) < ::logThreshold.load( std::memory_order_relaxed ) )
+        return;
+    const unsigned interval =
+      ::samplingIntervals[int(severity)].load( std::memory_order_relaxed );
+    if( interval > 1 &&
+        (::samplingCounters[int(severity)]++ % interval) != 0 )
+        return;
+
+    std::ostringstream formatted;
+    formatted << "[" << ::SeverityName(severity) << "] " << line;
+
+    {
+        std::lock_guard<std::mutex> lock( ::countsMutex );
+        auto it = ::messageCounts.find( formatted.str() );
+        if( it != ::messageCounts.end() )
+            ++it->second;
+        else if( ::messageCounts.size() < ::maxDistinctMessages )
+            ::messageCounts[formatted.str()] = 1;
+    }
+
+    if( AsyncLoggingEnabled() )
+        ::Enqueue( formatted.str() );
+    else
+        LogOS() << formatted.str() << std::endl;
+}
+
+void LogSummary( ostream& os, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    // Serialize the local counts as "count <tab> message" lines
+    ostringstream tableStream;
+    {
+        std::lock_guard<std::mutex> lock( ::countsMutex );
+        for( const auto& entry : ::messageCounts )
+            tableStream << entry.second << '\t' << entry.first << '\n';
+    }
+    const string table = tableStream.str();
+
+    // Funnel the tables to the root; the characters are widened to int to
+    // reuse the registered MPI datatypes
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    vector<int> sendBuf( table.begin(), table.end() );
+    int localLength = sendBuf.size();
+    vector<int> lengths( commSize, 0 );
+    mpi::Gather( &localLength, 1, lengths.data(), 1, 0, comm );
+    vector<int> offsets;
+    int totalLength = 0;
+    if( commRank == 0 )
+        totalLength = Scan( lengths, offsets );
+    vector<int> recvBuf( Max(totalLength,1) );
+    mpi::Gather
+    ( sendBuf.data(), localLength,
+      recvBuf.data(), lengths.data(), offsets.data(), 0, comm );
+    if( commRank != 0 )
+        return;
+
+    // Merge identical messages so that each is reported once with its
+    // total count and the number of ranks which produced it
+    struct Aggregate
+    {
+        unsigned long count=0;
+        int numRanks=0;
+    };
+    std::map<string,Aggregate> aggregates;
+    for( int q=0; q<commSize; ++q )
+    {
+        string rankTable;
+        rankTable.reserve( lengths[q] );
+        for( int k=0; k<lengths[q]; ++k )
+            rankTable.push_back( char(recvBuf[offsets[q]+k]) );
+        std::istringstream lineStream( rankTable );
+        string line;
+        while( std::getline( lineStream, line ) )
+        {
+            const size_t tab = line.find( '\t' );
+            if( tab == string::npos )
+                continue;
+            const unsigned long count = strtoul( line.c_str(), nullptr, 10 );
+            const string message = line.substr( tab+1 );
+            Aggregate& agg = aggregates[message];
+            agg.count += count;
+            ++agg.numRanks;
+        }
+    }
+    if( aggregates.empty() )
+        return;
+
+    os << "Log summary over " << commSize << " process(es):\n";
+    for( const auto& entry : aggregates )
+    {
+        char prefix[64];
+        snprintf
+        ( prefix, sizeof(prefix), "  %8lux on %4d rank(s)  ",
+          entry.second.count, entry.second.numRanks );
+        os << prefix << entry.first << '\n';
+    }
+    os.flush();
+}
+
+void CloseLog()
+{
+    // Make sure that any queued lines reach the file before it closes
+    if( AsyncLoggingEnabled() )
+        DisableAsyncLogging();
+    ::logFile.close();
+}
 
 } // namespace El
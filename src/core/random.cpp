@@ -8,13 +8,47 @@
 */
 #include <El-lite.hpp>
 
+#include <atomic>
+
 namespace {
 
-// A common Mersenne twister configuration
-std::mt19937 generator;
+// The base seed chosen by InitializeRandom. Each thread derives its own
+// stream from it the first time it samples, so that concurrently running
+// grids (e.g., one per OpenMP task group) never share, or race on, a
+// single generator. The derivation is deterministic up to the order in
+// which the threads first sample.
+long randomBaseSeed = 21;
+std::atomic<unsigned> numSeededThreads( 0 );
+thread_local long threadSeed = -1;
+
+long ThreadSeed()
+{
+    if( ::threadSeed < 0 )
+    {
+        const unsigned ordinal = ::numSeededThreads++;
+        ::threadSeed = ::randomBaseSeed + 0x9E3779B9L*long(ordinal);
+    }
+    return ::threadSeed;
+}
+
+// A common Mersenne twister configuration (one instance per thread)
+thread_local std::mt19937 generator;
+thread_local bool generatorSeeded = false;
+
+// The shared key and fill-stream counter for the Philox samplers
+std::uint64_t philoxKey = 21;
+std::atomic<std::uint64_t> philoxStream( 0 );
 
 #ifdef EL_HAVE_MPC
-gmp_randstate_t gmpRandState;
+// Each thread owns (and at exit releases) its own GMP random state
+struct GmpRandStateHolder
+{
+    gmp_randstate_t state;
+    GmpRandStateHolder() { gmp_randinit_default( state ); }
+    ~GmpRandStateHolder() { gmp_randclear( state ); }
+};
+thread_local GmpRandStateHolder gmpRandState;
+thread_local bool gmpSeeded = false;
 #endif
 
 }
@@ -27,41 +61,73 @@ void InitializeRandom( bool deterministic )
     const long secs = ( deterministic ? 21 : time(NULL) );
     const long seed = (secs<<16) | (rank & 0xFFFF);
 
-    ::generator.seed( seed );
+    // Later threads lazily derive their own streams from the base seed;
+    // the calling thread reseeds on its next sample. Note that this must
+    // precede the spawning of any compute threads for the derivation to be
+    // deterministic.
+    ::randomBaseSeed = seed;
+    ::numSeededThreads = 0;
+    ::threadSeed = -1;
+    ::generatorSeeded = false;
 
     srand( seed );
 
+    // The counter-based samplers require a key which is identical on every
+    // rank, so the rank-independent portion of the seed is broadcast to
+    // guard against clock skew in the non-deterministic case
+    uint64_t key = uint64_t(secs)<<16;
+    mpi::Broadcast( key, 0, mpi::COMM_WORLD );
+    SetPhiloxKey( key );
+
 #ifdef EL_HAVE_MPC
     mpfr::SetMinIntBits( 256 );
     mpfr::SetPrecision( 256 );
-    gmp_randinit_default( ::gmpRandState );
-    gmp_randseed_ui( ::gmpRandState, seed );
+    ::gmpSeeded = false;
 #endif
 }
 
 void FinalizeRandom()
 {
-#ifdef EL_HAVE_MPC
-    gmp_randclear( ::gmpRandState );
-#endif
+    // The per-thread GMP random states are released at thread exit
 }
 
 std::mt19937& Generator()
-{ return ::generator; }
+{
+    if( !::generatorSeeded )
+    {
+        ::generator.seed( std::mt19937::result_type(::ThreadSeed()) );
+        ::generatorSeeded = true;
+    }
+    return ::generator;
+}
+
+void SetPhiloxKey( uint64_t key )
+{
+    ::philoxKey = key;
+    ::philoxStream = 0;
+}
+uint64_t PhiloxKey() { return ::philoxKey; }
+uint64_t NextPhiloxStream() { return ::philoxStream++; }
 
 #ifdef EL_HAVE_MPC
 namespace mpfr {
 
 void RandomState( gmp_randstate_t randState )
 {
+    if( !::gmpSeeded )
+    {
+        gmp_randseed_ui( ::gmpRandState.state, ::ThreadSeed() );
+        ::gmpSeeded = true;
+    }
+
     // It is surprisingly tedious to return the state...
 
-    randState->_mp_seed->_mp_alloc = ::gmpRandState->_mp_seed->_mp_alloc;
-    randState->_mp_seed->_mp_size = ::gmpRandState->_mp_seed->_mp_size;
-    randState->_mp_seed->_mp_d = ::gmpRandState->_mp_seed->_mp_d;
+    randState->_mp_seed->_mp_alloc = ::gmpRandState.state->_mp_seed->_mp_alloc;
+    randState->_mp_seed->_mp_size = ::gmpRandState.state->_mp_seed->_mp_size;
+    randState->_mp_seed->_mp_d = ::gmpRandState.state->_mp_seed->_mp_d;
 
-    randState->_mp_alg = ::gmpRandState->_mp_alg;
-    randState->_mp_algdata._mp_lc = ::gmpRandState->_mp_algdata._mp_lc;
+    randState->_mp_alg = ::gmpRandState.state->_mp_alg;
+    randState->_mp_algdata._mp_lc = ::gmpRandState.state->_mp_algdata._mp_lc;
 }
 
 } // namespace mpfr
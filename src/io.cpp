@@ -13,6 +13,7 @@ using namespace El;
 
 ColorMap colorMap=RED_BLACK_GREEN;
 Int numDiscreteColors = 15;
+Int displayResolution = 2048;
 
 }
 
@@ -30,4 +31,10 @@ void SetNumDiscreteColors( Int numChunks )
 Int NumDiscreteColors()
 { return ::numDiscreteColors; }
 
+void SetDisplayResolution( Int resolution )
+{ ::displayResolution = resolution; }
+
+Int DisplayResolution()
+{ return ::displayResolution; }
+
 } // namespace El
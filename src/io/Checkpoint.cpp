@@ -0,0 +1,229 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./MemoryMap.hpp"
+
+namespace El {
+
+template<typename T>
+CheckpointWriter<T>::CheckpointWriter()
+{ }
+
+template<typename T>
+CheckpointWriter<T>::~CheckpointWriter()
+{
+    // Complete any checkpoint still in flight; the completion barrier of
+    // Wait is deliberately skipped, as the peers may have already destroyed
+    // their writers
+    if( pending_ )
+        drainer_.join();
+}
+
+template<typename T>
+bool CheckpointWriter<T>::Pending() const
+{ return pending_; }
+
+template<typename T>
+void CheckpointWriter<T>::Wait()
+{
+    EL_DEBUG_CSE
+    if( !pending_ )
+        return;
+    drainer_.join();
+    pending_ = false;
+    mpi::Barrier( comm_ );
+}
+
+template<typename T>
+void CheckpointWriter<T>::Put
+( const AbstractDistMatrix<T>& A, string basename )
+{
+    EL_DEBUG_CSE
+    Wait();
+    comm_ = A.Grid().Comm();
+#ifdef EL_HAVE_POSIX_MMAP
+    const string filename = basename + "." + FileExtension(BINARY);
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const size_t metaBytes = 2*sizeof(Int);
+    const size_t numBytes =
+      metaBytes + size_t(height)*size_t(width)*sizeof(T);
+
+    // Collectively establish the output file (metadata-only work)
+    Int usable = 0;
+    if( mpi::Rank(comm_) == 0 )
+        usable = ( io::CreateSizedFile( filename, numBytes ) ? 1 : 0 );
+    mpi::Broadcast( usable, 0, comm_ );
+    if( usable )
+    {
+        auto map =
+          std::make_shared<io::MemoryMap>( filename, numBytes, false );
+        Int viable = ( map->Viable() ? 1 : 0 );
+        viable = mpi::AllReduce( viable, mpi::MIN, comm_ );
+        if( viable )
+        {
+            if( mpi::Rank(comm_) == 0 )
+            {
+                Int* header = reinterpret_cast<Int*>(map->Buffer());
+                header[0] = height;
+                header[1] = width;
+            }
+            // Snapshot the local data and its global indices
+            if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
+            {
+                const Int localHeight = A.LocalHeight();
+                const Int localWidth = A.LocalWidth();
+                stage_ = A.LockedMatrix();
+                stageRowInds_.resize( localHeight );
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    stageRowInds_[iLoc] = A.GlobalRow(iLoc);
+                stageColInds_.resize( localWidth );
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    stageColInds_[jLoc] = A.GlobalCol(jLoc);
+            }
+            else
+            {
+                stage_.Empty();
+                stageRowInds_.clear();
+                stageColInds_.clear();
+            }
+            // Scatter the snapshot through the shared map on a background
+            // thread; the map is synced and unmapped when the thread's copy
+            // of it is destroyed, just before the thread completes
+            drainer_ = std::thread(
+              [this,map,height]()
+              {
+                  char* payload = map->Buffer() + 2*sizeof(Int);
+                  const Int localHeight = stage_.Height();
+                  const Int localWidth = stage_.Width();
+                  for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                  {
+                      T* col =
+                        reinterpret_cast<T*>(payload) +
+                        size_t(stageColInds_[jLoc])*size_t(height);
+                      const T* buf = stage_.LockedBuffer(0,jLoc);
+                      for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                          col[stageRowInds_[iLoc]] = buf[iLoc];
+                  }
+              });
+            pending_ = true;
+            return;
+        }
+    }
+#endif
+    // Fall back to a synchronous write
+    Write( A, basename, BINARY );
+}
+
+template<typename T>
+void CheckpointWriter<T>::Put
+( const DistSparseLDLFactorization<T>& fact, string basename )
+{
+    EL_DEBUG_CSE
+    Wait();
+    comm_ = fact.NodeInfo().Grid().Comm();
+    const int commRank = mpi::Rank( comm_ );
+    const string filename =
+      basename + "." + std::to_string(commRank) + ".ckpt";
+
+    // Stage every local front piece in a deterministic traversal order:
+    // the distributed chain from the root downwards, followed by the
+    // recursive sequential subtree of the duplicated leaf. Only the values
+    // are staged, as the symbolic structure is reproducible from an
+    // identical symbolic initialization.
+    frontMeta_.clear();
+    frontData_.clear();
+    auto stageDense = [this]( const Matrix<T>& M )
+    {
+        frontMeta_.push_back( M.Height() );
+        frontMeta_.push_back( M.Width() );
+        for( Int j=0; j<M.Width(); ++j )
+            frontData_.insert
+            ( frontData_.end(),
+              M.LockedBuffer(0,j), M.LockedBuffer(0,j)+M.Height() );
+    };
+    auto stageSparse = [this]( const SparseMatrix<T>& M )
+    {
+        frontMeta_.push_back( M.NumEntries() );
+        frontMeta_.push_back( Int(-1) );
+        frontData_.insert
+        ( frontData_.end(),
+          M.LockedValueBuffer(), M.LockedValueBuffer()+M.NumEntries() );
+    };
+    function<void(const ldl::Front<T>&)> stageSeqFront =
+      [&]( const ldl::Front<T>& front )
+      {
+          if( front.sparseLeaf )
+              stageSparse( front.LSparse );
+          else
+              stageDense( front.LDense );
+          stageDense( front.diag );
+          stageDense( front.subdiag );
+          for( const auto& child : front.children )
+              stageSeqFront( *child );
+      };
+    const ldl::DistFront<T>* node = &fact.Front();
+    while( node != nullptr )
+    {
+        if( node->duplicate != nullptr )
+        {
+            // The duplicate holds the data; the node's distributed matrices
+            // are merely views of it
+            stageSeqFront( *node->duplicate );
+        }
+        else
+        {
+            stageDense( node->L1D.LockedMatrix() );
+            stageDense( node->L2D.LockedMatrix() );
+            stageDense( node->diag.LockedMatrix() );
+            stageDense( node->subdiag.LockedMatrix() );
+        }
+        node = node->child.get();
+    }
+
+    // Drain the staged pieces to the per-rank file in the background; this
+    // is purely local I/O. A failure to open the file simply leaves the
+    // checkpoint unwritten, as a background thread has no safe way to throw.
+    drainer_ = std::thread(
+      [this,filename]()
+      {
+          std::ofstream file( filename.c_str(), std::ios::binary );
+          if( !file.is_open() )
+              return;
+          const Int numMeta = frontMeta_.size();
+          const Int numData = frontData_.size();
+          file.write( (const char*)&numMeta, sizeof(Int) );
+          file.write( (const char*)&numData, sizeof(Int) );
+          file.write( (const char*)frontMeta_.data(), numMeta*sizeof(Int) );
+          file.write( (const char*)frontData_.data(), numData*sizeof(T) );
+      });
+    pending_ = true;
+}
+
+template<typename T>
+void RestoreCheckpoint( AbstractDistMatrix<T>& A, string basename )
+{
+    EL_DEBUG_CSE
+    Read( A, basename+"."+FileExtension(BINARY), BINARY );
+}
+
+#define PROTO(T) \
+  template class CheckpointWriter<T>; \
+  template void RestoreCheckpoint \
+  ( AbstractDistMatrix<T>& A, string basename );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -97,6 +97,17 @@ template<typename T>
 void Display( const AbstractDistMatrix<T>& A, string title )
 {
     EL_DEBUG_CSE
+    const Int maxRes = DisplayResolution();
+    if( A.Height() > maxRes || A.Width() > maxRes )
+    {
+        // Too large to gather wholesale; pool the magnitudes down to the
+        // display resolution and render the pooled image instead
+        Matrix<Base<T>> P;
+        MaxAbsDownsample( A, P, maxRes, maxRes );
+        if( A.Grid().Rank() == 0 )
+            Display( P, title+" (downsampled magnitudes)" );
+        return;
+    }
     if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
@@ -114,6 +125,15 @@ template<typename T>
 void Display( const DistMultiVec<T>& X, string title )
 {
     EL_DEBUG_CSE
+    const Int maxRes = DisplayResolution();
+    if( X.Height() > maxRes || X.Width() > maxRes )
+    {
+        Matrix<Base<T>> P;
+        MaxAbsDownsample( X, P, maxRes, maxRes );
+        if( X.Grid().Rank() == 0 )
+            Display( P, title+" (downsampled magnitudes)" );
+        return;
+    }
     if( X.Grid().Rank() == 0 )
     {
         Matrix<T> XLoc;
@@ -238,6 +258,17 @@ void Display( const DistSparseMatrix<T>& A, string title )
 {
     EL_DEBUG_CSE
     A.AssertLocallyConsistent();
+    const Int maxRes = DisplayResolution();
+    if( A.Height() > maxRes || A.Width() > maxRes )
+    {
+        // Pooling the local entries costs O(pixels) memory and a single
+        // small reduction, as opposed to gathering every entry onto the root
+        Matrix<Base<T>> P;
+        MaxAbsDownsample( A, P, maxRes, maxRes );
+        if( A.Grid().Rank() == 0 )
+            Display( P, title+" (downsampled magnitudes)" );
+        return;
+    }
     if( A.Grid().Rank() == 0 )
     {
         SparseMatrix<T> ASeq;
@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename T>
+void MaxAbsDownsample
+( const Matrix<T>& A, Matrix<Base<T>>& P, Int maxHeight, Int maxWidth )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int imgHeight = Min( m, maxHeight );
+    const Int imgWidth = Min( n, maxWidth );
+    Zeros( P, imgHeight, imgWidth );
+    if( imgHeight == 0 || imgWidth == 0 )
+        return;
+    for( Int j=0; j<n; ++j )
+    {
+        const Int jPix = Int(((long long)j*imgWidth)/n);
+        for( Int i=0; i<m; ++i )
+        {
+            const Int iPix = Int(((long long)i*imgHeight)/m);
+            P(iPix,jPix) = Max( P(iPix,jPix), Abs(A(i,j)) );
+        }
+    }
+}
+
+template<typename T>
+void MaxAbsDownsample
+( const AbstractDistMatrix<T>& A, Matrix<Base<T>>& P,
+  Int maxHeight, Int maxWidth )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int imgHeight = Min( m, maxHeight );
+    const Int imgWidth = Min( n, maxWidth );
+    Zeros( P, imgHeight, imgWidth );
+    if( imgHeight == 0 || imgWidth == 0 )
+        return;
+    // Pool the local entries; the redundant copies of the data may be safely
+    // skipped since the reduction below visits every rank
+    if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
+    {
+        const Matrix<T>& ALoc = A.LockedMatrix();
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int jPix = Int(((long long)A.GlobalCol(jLoc)*imgWidth)/n);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int iPix =
+                  Int(((long long)A.GlobalRow(iLoc)*imgHeight)/m);
+                P(iPix,jPix) = Max( P(iPix,jPix), Abs(ALoc(iLoc,jLoc)) );
+            }
+        }
+    }
+    mpi::AllReduce
+    ( P.Buffer(), imgHeight*imgWidth, mpi::MAX, A.Grid().Comm() );
+}
+
+template<typename T>
+void MaxAbsDownsample
+( const DistMultiVec<T>& X, Matrix<Base<T>>& P,
+  Int maxHeight, Int maxWidth )
+{
+    EL_DEBUG_CSE
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int imgHeight = Min( m, maxHeight );
+    const Int imgWidth = Min( n, maxWidth );
+    Zeros( P, imgHeight, imgWidth );
+    if( imgHeight == 0 || imgWidth == 0 )
+        return;
+    const Matrix<T>& XLoc = X.LockedMatrix();
+    const Int localHeight = X.LocalHeight();
+    for( Int j=0; j<n; ++j )
+    {
+        const Int jPix = Int(((long long)j*imgWidth)/n);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int iPix = Int(((long long)X.GlobalRow(iLoc)*imgHeight)/m);
+            P(iPix,jPix) = Max( P(iPix,jPix), Abs(XLoc(iLoc,j)) );
+        }
+    }
+    mpi::AllReduce
+    ( P.Buffer(), imgHeight*imgWidth, mpi::MAX, X.Grid().Comm() );
+}
+
+template<typename T>
+void MaxAbsDownsample
+( const DistSparseMatrix<T>& A, Matrix<Base<T>>& P,
+  Int maxHeight, Int maxWidth )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int imgHeight = Min( m, maxHeight );
+    const Int imgWidth = Min( n, maxWidth );
+    Zeros( P, imgHeight, imgWidth );
+    if( imgHeight == 0 || imgWidth == 0 )
+        return;
+    const Int numLocalEntries = A.NumLocalEntries();
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int iPix = Int(((long long)A.Row(e)*imgHeight)/m);
+        const Int jPix = Int(((long long)A.Col(e)*imgWidth)/n);
+        P(iPix,jPix) = Max( P(iPix,jPix), Abs(A.Value(e)) );
+    }
+    mpi::AllReduce
+    ( P.Buffer(), imgHeight*imgWidth, mpi::MAX, A.Grid().Comm() );
+}
+
+#define PROTO(T) \
+  template void MaxAbsDownsample \
+  ( const Matrix<T>& A, Matrix<Base<T>>& P, Int maxHeight, Int maxWidth ); \
+  template void MaxAbsDownsample \
+  ( const AbstractDistMatrix<T>& A, Matrix<Base<T>>& P, \
+    Int maxHeight, Int maxWidth ); \
+  template void MaxAbsDownsample \
+  ( const DistMultiVec<T>& X, Matrix<Base<T>>& P, \
+    Int maxHeight, Int maxWidth ); \
+  template void MaxAbsDownsample \
+  ( const DistSparseMatrix<T>& A, Matrix<Base<T>>& P, \
+    Int maxHeight, Int maxWidth );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
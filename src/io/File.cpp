@@ -31,8 +31,9 @@ string FileExtension( FileFormat format )
     {
     case ASCII:            return "txt";  break;
     case ASCII_MATLAB:     return "m";    break;
-    case BINARY:           return "bin";  break;
-    case BINARY_FLAT:      return "dat";  break;
+    case BINARY:            return "bin";  break;
+    case BINARY_COMPRESSED: return "cbin"; break;
+    case BINARY_FLAT:       return "dat";  break;
     case BMP:              return "bmp";  break;
     case JPG:              return "jpg";  break;
     case JPEG:             return "jpeg"; break;
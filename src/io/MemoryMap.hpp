@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_MEMORYMAP_HPP
+#define EL_IO_MEMORYMAP_HPP
+
+// Memory-mapped file access is used to accelerate the binary matrix formats:
+// each rank of a distributed matrix maps the (shared) file and then gathers
+// or scatters its local entries with strided loads/stores, avoiding both a
+// funnel through a single rank and a seek per entry. The facility is only
+// available on POSIX systems; all of its users are expected to fall back to
+// portable buffered I/O whenever a map cannot be established.
+#ifndef _WIN32
+# define EL_HAVE_POSIX_MMAP
+#endif
+
+#ifdef EL_HAVE_POSIX_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace El {
+namespace io {
+
+// A thin RAII wrapper around a memory map of an existing file. Failures to
+// open or map the file are not treated as errors; they simply leave the
+// object non-viable so that the caller may fall back to buffered I/O.
+class MemoryMap
+{
+public:
+    MemoryMap( const string& filename, size_t numBytes, bool readOnly )
+    : buffer_(nullptr), numBytes_(numBytes)
+    {
+        if( numBytes == 0 )
+            return;
+        const int flags = ( readOnly ? O_RDONLY : O_RDWR );
+        const int fd = ::open( filename.c_str(), flags );
+        if( fd == -1 )
+            return;
+        const int prot = ( readOnly ? PROT_READ : PROT_READ|PROT_WRITE );
+        void* buffer = ::mmap( nullptr, numBytes, prot, MAP_SHARED, fd, 0 );
+        // The mapping persists beyond the lifetime of the descriptor
+        ::close( fd );
+        if( buffer == MAP_FAILED )
+            return;
+        buffer_ = static_cast<char*>(buffer);
+        readOnly_ = readOnly;
+    }
+
+    ~MemoryMap()
+    {
+        if( buffer_ != nullptr )
+        {
+            // Ensure that any stores have reached the file before subsequent
+            // (possibly remote) readers open it
+            if( !readOnly_ )
+                ::msync( buffer_, numBytes_, MS_SYNC );
+            ::munmap( buffer_, numBytes_ );
+        }
+    }
+
+    MemoryMap( const MemoryMap& ) = delete;
+    MemoryMap& operator=( const MemoryMap& ) = delete;
+
+    bool Viable() const { return buffer_ != nullptr; }
+    char* Buffer() const { return buffer_; }
+
+private:
+    char* buffer_;
+    size_t numBytes_;
+    bool readOnly_=true;
+};
+
+// Return the last-modification time of a file, or zero if it could not be
+// determined (e.g., because the file does not exist).
+inline time_t FileModificationTime( const string& filename )
+{
+    struct stat info;
+    if( ::stat( filename.c_str(), &info ) != 0 )
+        return time_t(0);
+    return info.st_mtime;
+}
+
+// Create (or truncate) a file of the given size so that it may subsequently
+// be memory-mapped for writing by every rank. Returns whether the file could
+// be established.
+inline bool CreateSizedFile( const string& filename, size_t numBytes )
+{
+    const int fd =
+      ::open( filename.c_str(), O_RDWR|O_CREAT|O_TRUNC, 0644 );
+    if( fd == -1 )
+        return false;
+    const bool sized = ( ::ftruncate( fd, numBytes ) == 0 );
+    ::close( fd );
+    return sized;
+}
+
+} // namespace io
+} // namespace El
+
+#endif // ifdef EL_HAVE_POSIX_MMAP
+
+#endif // ifndef EL_IO_MEMORYMAP_HPP
@@ -19,14 +19,116 @@ void ConfigurePrecision( ostream& os )
     os.precision( numDecimals );
 }
 
-// Dense
-// =====
-
+namespace print {
+
+// Formatting through operator<< pays for a virtual call and a locale lookup
+// per entry, which dominates the cost of dumping anything large. The
+// hardware types are instead converted with snprintf into a reusable block
+// buffer which is drained with os.write, so that dumps are I/O-bound rather
+// than formatting-bound; snprintf consults only the (fixed) C locale, not
+// the std::locale machinery. The extended-precision types retain the
+// ostream path, as their operator<< is the only formatter they provide.
+template<typename T> struct HasFastFormat : std::false_type {};
+template<> struct HasFastFormat<int> : std::true_type {};
+template<> struct HasFastFormat<long long int> : std::true_type {};
+template<> struct HasFastFormat<float> : std::true_type {};
+template<> struct HasFastFormat<double> : std::true_type {};
+template<> struct HasFastFormat<Complex<float>> : std::true_type {};
+template<> struct HasFastFormat<Complex<double>> : std::true_type {};
+
+inline int FormatEntry( char* buf, size_t size, int prec, int value )
+{ return snprintf( buf, size, "%d", value ); }
+inline int FormatEntry( char* buf, size_t size, int prec, long long value )
+{ return snprintf( buf, size, "%lld", value ); }
+inline int FormatEntry( char* buf, size_t size, int prec, float value )
+{ return snprintf( buf, size, "%.*g", prec, double(value) ); }
+inline int FormatEntry( char* buf, size_t size, int prec, double value )
+{ return snprintf( buf, size, "%.*g", prec, value ); }
+inline int
+FormatEntry( char* buf, size_t size, int prec, const Complex<float>& value )
+{ return snprintf
+  ( buf, size, "%.*g+%.*gi",
+    prec, double(value.real()), prec, double(value.imag()) ); }
+inline int
+FormatEntry( char* buf, size_t size, int prec, const Complex<double>& value )
+{ return snprintf
+  ( buf, size, "%.*g+%.*gi", prec, value.real(), prec, value.imag() ); }
+
+// A reusable block buffer which formats entries in place at its tail and
+// drains itself to the output stream once a block's worth has accumulated
 template<typename T>
-void Print( const Matrix<T>& A, string title, ostream& os )
+class BlockBuffer
 {
-    EL_DEBUG_CSE
+public:
+    BlockBuffer( ostream& os )
+    : os_(os),
+      prec_(int(BinaryToDecimalPrecision(NumMantissaBits(Base<T>()))+1)),
+      // Sign, digits, decimal point, and exponent for each of (up to) two
+      // components, plus the complex punctuation and a separator
+      maxEntryChars_(2*(size_t(prec_)+10)+4)
+    { block_.reserve( flushSize_ + maxEntryChars_ ); }
+
+    ~BlockBuffer() { Flush(); }
+
+    template<typename S>
+    void Append( const S& value )
+    {
+        const size_t off = block_.size();
+        block_.resize( off + maxEntryChars_ );
+        const int numChars =
+          FormatEntry( &block_[off], maxEntryChars_, prec_, value );
+        block_.resize( off + size_t(numChars) );
+    }
+
+    void AppendChar( char c ) { block_.push_back( c ); }
+
+    void FlushIfFull()
+    {
+        if( block_.size() >= flushSize_ )
+            Flush();
+    }
+
+private:
+    void Flush()
+    {
+        if( block_.size() > 0 )
+        {
+            os_.write( block_.data(), block_.size() );
+            block_.clear();
+        }
+    }
+
+    ostream& os_;
+    const int prec_;
+    const size_t maxEntryChars_;
+    static const size_t flushSize_ = size_t(1)<<20;
+    vector<char> block_;
+};
+
+template<typename T,typename=EnableIf<HasFastFormat<T>>>
+void Dense( const Matrix<T>& A, string title, ostream& os )
+{
+    if( title != "" )
+        os << title << "\n";
+    const Int height = A.Height();
+    const Int width = A.Width();
+    BlockBuffer<T> buffer( os );
+    for( Int i=0; i<height; ++i )
+    {
+        for( Int j=0; j<width; ++j )
+        {
+            buffer.Append( A(i,j) );
+            buffer.AppendChar( ' ' );
+        }
+        buffer.AppendChar( '\n' );
+        buffer.FlushIfFull();
+    }
+    buffer.AppendChar( '\n' );
+}
 
+template<typename T,typename=DisableIf<HasFastFormat<T>>,typename=void>
+void Dense( const Matrix<T>& A, string title, ostream& os )
+{
     ostringstream msg;
 
     if( title != "" )
@@ -46,6 +148,62 @@ void Print( const Matrix<T>& A, string title, ostream& os )
     os << msg.str();
 }
 
+template<typename T,typename=EnableIf<HasFastFormat<T>>>
+void Triplets( const SparseMatrix<T>& A, string title, ostream& os )
+{
+    if( title != "" )
+        os << title << "\n";
+    const Int numEntries = A.NumEntries();
+    const Int* srcBuf = A.LockedSourceBuffer();
+    const Int* tgtBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    BlockBuffer<T> valBuffer( os );
+    for( Int s=0; s<numEntries; ++s )
+    {
+        valBuffer.Append( srcBuf[s] );
+        valBuffer.AppendChar( ' ' );
+        valBuffer.Append( tgtBuf[s] );
+        valBuffer.AppendChar( ' ' );
+        valBuffer.Append( valBuf[s] );
+        valBuffer.AppendChar( '\n' );
+        valBuffer.FlushIfFull();
+    }
+    valBuffer.AppendChar( '\n' );
+}
+
+template<typename T,typename=DisableIf<HasFastFormat<T>>,typename=void>
+void Triplets( const SparseMatrix<T>& A, string title, ostream& os )
+{
+    ostringstream msg;
+
+    if( title != "" )
+        msg << title << endl;
+
+    ConfigurePrecision<T>( msg );
+
+    const Int numEntries = A.NumEntries();
+    const Int* srcBuf = A.LockedSourceBuffer();
+    const Int* tgtBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    for( Int s=0; s<numEntries; ++s )
+        msg << srcBuf[s] << " " << tgtBuf[s] << " " << valBuf[s] << "\n";
+    msg << endl;
+
+    os << msg.str();
+}
+
+} // namespace print
+
+// Dense
+// =====
+
+template<typename T>
+void Print( const Matrix<T>& A, string title, ostream& os )
+{
+    EL_DEBUG_CSE
+    print::Dense( A, title, os );
+}
+
 template<typename T>
 void Print
 ( const AbstractDistMatrix<T>& A, string title, ostream& os )
@@ -119,24 +277,8 @@ template<typename T>
 void Print( const SparseMatrix<T>& A, string title, ostream& os )
 {
     EL_DEBUG_CSE
-
-    ostringstream msg;
-
     A.AssertConsistent();
-    if( title != "" )
-        msg << title << endl;
-
-    ConfigurePrecision<T>( msg );
-
-    const Int numEntries = A.NumEntries();
-    const Int* srcBuf = A.LockedSourceBuffer();
-    const Int* tgtBuf = A.LockedTargetBuffer();
-    const T* valBuf = A.LockedValueBuffer();
-    for( Int s=0; s<numEntries; ++s )
-        msg << srcBuf[s] << " " << tgtBuf[s] << " " << valBuf[s] << "\n";
-    msg << endl;
-
-    os << msg.str();
+    print::Triplets( A, title, os );
 }
 
 template<typename T>
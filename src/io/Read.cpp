@@ -11,6 +11,7 @@
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
+#include "./Read/BinaryCompressed.hpp"
 #include "./Read/BinaryFlat.hpp"
 #include "./Read/MatrixMarket.hpp"
 
@@ -34,6 +35,9 @@ void Read( Matrix<T>& A, const string filename, FileFormat format )
     case BINARY:
         read::Binary( A, filename );
         break;
+    case BINARY_COMPRESSED:
+        read::BinaryCompressed( A, filename );
+        break;
     case BINARY_FLAT:
         read::BinaryFlat( A, A.Height(), A.Width(), filename );
         break;
@@ -90,6 +94,9 @@ void Read
         case BINARY:
             read::Binary( A, filename );
             break;
+        case BINARY_COMPRESSED:
+            read::BinaryCompressed( A, filename );
+            break;
         case BINARY_FLAT:
             read::BinaryFlat( A, A.Height(), A.Width(), filename );
             break;
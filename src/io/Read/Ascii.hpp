@@ -14,12 +14,13 @@ namespace read {
 
 template<typename T>
 inline void
-Ascii( Matrix<T>& A, const string filename )
+Ascii( Matrix<T>& A, string filename )
 {
     EL_DEBUG_CSE
     std::ifstream file( filename.c_str() );
     if( !file.is_open() ){
       filename = filename + "." + FileExtension(ASCII);
+      file.open( filename.c_str() );
       if( !file.is_open() ) RuntimeError("Could not open ",filename);
     }
 
@@ -64,12 +65,13 @@ Ascii( Matrix<T>& A, const string filename )
 
 template<typename T>
 inline void
-Ascii( AbstractDistMatrix<T>& A, const string filename )
+Ascii( AbstractDistMatrix<T>& A, string filename )
 {
     EL_DEBUG_CSE
     std::ifstream file( filename.c_str() );
     if( !file.is_open() ){
       filename = filename + "." + FileExtension(ASCII);
+      file.open( filename.c_str() );
       if( !file.is_open() ) RuntimeError("Could not open ",filename);
     }
 
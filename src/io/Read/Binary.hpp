@@ -9,12 +9,14 @@
 #ifndef EL_READ_BINARY_HPP
 #define EL_READ_BINARY_HPP
 
+#include "../MemoryMap.hpp"
+
 namespace El {
 namespace read {
 
 template<typename T>
 inline void
-Binary( Matrix<T>& A, const string filename )
+Binary( Matrix<T>& A, string filename )
 {
     EL_DEBUG_CSE
     std::ifstream file( filename.c_str(), std::ios::binary );
@@ -22,6 +24,7 @@ Binary( Matrix<T>& A, const string filename )
 
       //check for automatically added extension  
       filename = filename + "." + FileExtension(BINARY);
+      file.open( filename.c_str(), std::ios::binary );
       if( !file.is_open() ) RuntimeError("Could not open ",filename);
 
     }
@@ -47,7 +50,7 @@ Binary( Matrix<T>& A, const string filename )
 
 template<typename T>
 inline void
-Binary( AbstractDistMatrix<T>& A, const string filename )
+Binary( AbstractDistMatrix<T>& A, string filename )
 {
     EL_DEBUG_CSE
     std::ifstream file( filename.c_str(), std::ios::binary );
@@ -55,6 +58,7 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
 
       //check for automatically added extension  
       filename = filename + "." + FileExtension(BINARY);
+      file.open( filename.c_str(), std::ios::binary );
       if( !file.is_open() ) RuntimeError("Could not open ",filename);
 
     }
@@ -82,32 +86,63 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
             for( Int j=0; j<width; ++j )
                 file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
     }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
     else
     {
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+#ifdef EL_HAVE_POSIX_MMAP
+        // Map the file and gather the local entries with strided loads
+        io::MemoryMap map( filename, numBytes, true );
+        if( map.Viable() )
+        {
+            const char* payload = map.Buffer() + metaBytes;
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                const Int j = A.GlobalCol(jLoc);
+                const T* col =
+                  reinterpret_cast<const T*>(payload) +
+                  size_t(j)*size_t(height);
+                T* ABuf = A.Buffer(0,jLoc);
+                if( A.ColStride() == 1 )
+                    MemCopy( ABuf, col, localHeight );
+                else
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        ABuf[iLoc] = col[A.GlobalRow(iLoc)];
+            }
+            return;
+        }
+#endif
+        if( A.ColStride() == 1 )
+        {
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                const Int j = A.GlobalCol(jLoc);
+                const std::streamoff pos =
+                  metaBytes + size_t(j)*size_t(height)*sizeof(T);
+                file.seekg( pos );
+                file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
+            }
+        }
+        else if( localHeight > 0 )
         {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            // Read the contiguous span of each file column covering the
+            // local rows and then subsample it, which replaces a seek per
+            // entry with a single seek per column
+            const Int firstRow = A.GlobalRow(0);
+            const Int lastRow = A.GlobalRow(localHeight-1);
+            vector<T> colBuf( lastRow-firstRow+1 );
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
+                const Int j = A.GlobalCol(jLoc);
+                const std::streamoff pos =
+                  metaBytes +
+                  (size_t(j)*size_t(height)+size_t(firstRow))*sizeof(T);
                 file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
+                file.read
+                ( (char*)colBuf.data(), (lastRow-firstRow+1)*sizeof(T) );
+                T* ABuf = A.Buffer(0,jLoc);
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    ABuf[iLoc] = colBuf[A.GlobalRow(iLoc)-firstRow];
             }
         }
     }
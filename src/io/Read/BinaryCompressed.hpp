@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_BINARYCOMPRESSED_HPP
+#define EL_READ_BINARYCOMPRESSED_HPP
+
+namespace El {
+namespace read {
+
+// See src/io/Write/BinaryCompressed.hpp for a description of the format
+template<typename T>
+inline void
+BinaryCompressed( Matrix<T>& A, string filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+    {
+        // Check for an automatically added extension
+        filename = filename + "." + FileExtension(BINARY_COMPRESSED);
+        file.open( filename.c_str(), std::ios::binary );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+    }
+
+    Int height, width;
+    file.read( (char*)&height, sizeof(Int) );
+    file.read( (char*)&width,  sizeof(Int) );
+    if( !file )
+        RuntimeError("Could not read the dimensions from ",filename);
+
+    A.Resize( height, width );
+    const size_t dataBytes = size_t(height)*size_t(width)*sizeof(T);
+    std::vector<byte> staging, payload;
+    size_t consumed=0, stagingOff=0;
+
+    // Decompress into a staging buffer and scatter full columns into place;
+    // when the local matrix is contiguous, decompress straight into it
+    const bool contiguous = ( A.Height() == A.LDim() );
+    byte* data = (byte*)A.Buffer();
+    const size_t colBytes = size_t(height)*sizeof(T);
+    Int j=0;
+    while( consumed < dataBytes )
+    {
+        unsigned long long header[2];
+        file.read( (char*)header, sizeof(header) );
+        if( !file )
+            RuntimeError("Could not read a chunk header from ",filename);
+        const size_t rawSize = size_t(header[0]);
+        const size_t payloadSize = size_t(header[1]);
+        if( consumed+rawSize > dataBytes )
+            RuntimeError("Chunk overruns the matrix data in ",filename);
+
+        byte* rawDest;
+        if( contiguous )
+            rawDest = data+consumed;
+        else
+        {
+            staging.resize( stagingOff+rawSize );
+            rawDest = staging.data()+stagingOff;
+        }
+
+        if( payloadSize == rawSize )
+        {
+            file.read( (char*)rawDest, rawSize );
+            if( !file )
+                RuntimeError("Could not read a raw chunk from ",filename);
+        }
+        else
+        {
+            payload.resize( payloadSize );
+            file.read( (char*)payload.data(), payloadSize );
+            if( !file )
+                RuntimeError
+                ("Could not read a compressed chunk from ",filename);
+            Decompress( payload.data(), payloadSize, rawDest, rawSize );
+        }
+        consumed += rawSize;
+
+        if( !contiguous )
+        {
+            // Flush any completed columns from the staging buffer
+            stagingOff += rawSize;
+            size_t flushed=0;
+            while( stagingOff-flushed >= colBytes && j < width )
+            {
+                MemCopy
+                ( (byte*)A.Buffer(0,j), staging.data()+flushed, colBytes );
+                flushed += colBytes;
+                ++j;
+            }
+            staging.erase( staging.begin(), staging.begin()+flushed );
+            stagingOff -= flushed;
+        }
+    }
+    if( !contiguous && stagingOff != 0 )
+        RuntimeError("Chunks of ",filename," did not align with the matrix");
+}
+
+template<typename T>
+inline void
+BinaryCompressed( AbstractDistMatrix<T>& A, string filename )
+{
+    EL_DEBUG_CSE
+    // Sequential decompression dominates, so read on the root and scatter
+    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
+    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+    {
+        BinaryCompressed( A_CIRC_CIRC.Matrix(), filename );
+        A_CIRC_CIRC.Resize
+        ( A_CIRC_CIRC.Matrix().Height(), A_CIRC_CIRC.Matrix().Width() );
+    }
+    A_CIRC_CIRC.MakeSizeConsistent();
+    Copy( A_CIRC_CIRC, A );
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_BINARYCOMPRESSED_HPP
@@ -9,17 +9,20 @@
 #ifndef EL_READ_BINARYFLAT_HPP
 #define EL_READ_BINARYFLAT_HPP
 
+#include "../MemoryMap.hpp"
+
 namespace El {
 namespace read {
 
 template<typename T>
 inline void
-BinaryFlat( Matrix<T>& A, Int height, Int width, const string filename )
+BinaryFlat( Matrix<T>& A, Int height, Int width, string filename )
 {
     EL_DEBUG_CSE
     std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() ){
       filename = filename + "." + FileExtension(BINARY_FLAT);
+      file.open( filename.c_str(), std::ios::binary );
       if( !file.is_open() ) RuntimeError("Could not open ",filename);
     }
 
@@ -40,12 +43,13 @@ BinaryFlat( Matrix<T>& A, Int height, Int width, const string filename )
 template<typename T>
 inline void
 BinaryFlat
-( AbstractDistMatrix<T>& A, Int height, Int width, const string filename )
+( AbstractDistMatrix<T>& A, Int height, Int width, string filename )
 {
     EL_DEBUG_CSE
     std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() ){
       filename = filename + "." + FileExtension(BINARY_FLAT);
+      file.open( filename.c_str(), std::ios::binary );
       if( !file.is_open() ) RuntimeError("Could not open ",filename);
     }
 
@@ -67,32 +71,62 @@ BinaryFlat
                     file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
         }
     }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
     else
     {
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+#ifdef EL_HAVE_POSIX_MMAP
+        // Map the file and gather the local entries with strided loads
+        io::MemoryMap map( filename, numBytes, true );
+        if( map.Viable() )
+        {
+            const char* payload = map.Buffer();
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                const Int j = A.GlobalCol(jLoc);
+                const T* col =
+                  reinterpret_cast<const T*>(payload) +
+                  size_t(j)*size_t(height);
+                T* ABuf = A.Buffer(0,jLoc);
+                if( A.ColStride() == 1 )
+                    MemCopy( ABuf, col, localHeight );
+                else
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        ABuf[iLoc] = col[A.GlobalRow(iLoc)];
+            }
+            return;
+        }
+#endif
+        if( A.ColStride() == 1 )
+        {
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                const Int j = A.GlobalCol(jLoc);
+                const std::streamoff pos =
+                  size_t(j)*size_t(height)*sizeof(T);
+                file.seekg( pos );
+                file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
+            }
+        }
+        else if( localHeight > 0 )
         {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            // Read the contiguous span of each file column covering the
+            // local rows and then subsample it, which replaces a seek per
+            // entry with a single seek per column
+            const Int firstRow = A.GlobalRow(0);
+            const Int lastRow = A.GlobalRow(localHeight-1);
+            vector<T> colBuf( lastRow-firstRow+1 );
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = localIndex*sizeof(T);
+                const Int j = A.GlobalCol(jLoc);
+                const std::streamoff pos =
+                  (size_t(j)*size_t(height)+size_t(firstRow))*sizeof(T);
                 file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
+                file.read
+                ( (char*)colBuf.data(), (lastRow-firstRow+1)*sizeof(T) );
+                T* ABuf = A.Buffer(0,jLoc);
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    ABuf[iLoc] = colBuf[A.GlobalRow(iLoc)-firstRow];
             }
         }
     }
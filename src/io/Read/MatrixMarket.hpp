@@ -9,17 +9,198 @@
 #ifndef EL_READ_MATRIXMARKET_HPP
 #define EL_READ_MATRIXMARKET_HPP
 
+#include "../MemoryMap.hpp"
+
 namespace El {
 namespace read {
 
+namespace matrix_market {
+
+// Parse a real value beginning at 'p' and return the position just beyond
+// it. The fundamental types go through the C conversion routines, while the
+// extended-precision types extract their own token so that no precision is
+// lost by rounding through double.
+inline const char* ParseValue( const char* p, float& value )
+{
+    char* next;
+    value = strtof( p, &next );
+    return next;
+}
+inline const char* ParseValue( const char* p, double& value )
+{
+    char* next;
+    value = strtod( p, &next );
+    return next;
+}
+template<typename Real>
+inline const char* ParseValue( const char* p, Real& value )
+{
+    while( p[0] != '\0' && std::isspace(p[0]) )
+        ++p;
+    const char* tokenEnd = p;
+    while( tokenEnd[0] != '\0' && !std::isspace(tokenEnd[0]) )
+        ++tokenEnd;
+    std::istringstream is( string(p,tokenEnd) );
+    is >> value;
+    return tokenEnd;
+}
+
+#ifdef EL_HAVE_POSIX_MMAP
+// Assembling a large coordinate file into a DistSparseMatrix is dominated by
+// text parsing, so the result is cached in a binary sidecar next to the
+// original file: a small header of [ magic, height, width, numNonzeros ]
+// followed by the row indices, column indices, and values of the fully
+// assembled (and, when applicable, symmetrized) matrix in globally row-major
+// order. Subsequent loads then bypass the text entirely, with each rank
+// bulk-reading an equal slice of the entries and routing them through the
+// distributed update queues.
+const Int sidecarMagic = Int(0x4D4D454C);
+
+template<typename T>
+bool ReadSidecar( DistSparseMatrix<T>& A, const string& filename )
+{
+    EL_DEBUG_CSE
+    const string sidecarName = filename + ".bin";
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Rank 0 decides whether the cache is fresh and well-formed
+    Int meta[4] = {0,0,0,0};
+    if( commRank == 0 )
+    {
+        const time_t fileTime = io::FileModificationTime( filename );
+        const time_t sidecarTime = io::FileModificationTime( sidecarName );
+        if( sidecarTime != time_t(0) && sidecarTime >= fileTime )
+        {
+            std::ifstream probe( sidecarName.c_str(), std::ios::binary );
+            Int header[4] = {0,0,0,0};
+            if( probe.is_open() )
+                probe.read( (char*)header, 4*sizeof(Int) );
+            if( probe && header[0] == sidecarMagic )
+            {
+                const size_t numBytes = size_t(FileSize( probe ));
+                const size_t numBytesExp =
+                  4*sizeof(Int) +
+                  size_t(header[3])*(2*sizeof(Int)+sizeof(T));
+                if( numBytes == numBytesExp )
+                {
+                    meta[0] = 1;
+                    meta[1] = header[1];
+                    meta[2] = header[2];
+                    meta[3] = header[3];
+                }
+            }
+        }
+    }
+    mpi::Broadcast( meta, 4, 0, comm );
+    if( !meta[0] )
+        return false;
+    const Int m = meta[1];
+    const Int n = meta[2];
+    const Int numNonzero = meta[3];
+
+    std::ifstream sidecar( sidecarName.c_str(), std::ios::binary );
+    Int viable = ( sidecar.is_open() ? 1 : 0 );
+    viable = mpi::AllReduce( viable, mpi::MIN, comm );
+    if( !viable )
+        return false;
+
+    // Bulk-read an equal slice of the entries on each rank
+    const Int entryBeg =
+      Int((long long)(numNonzero)*commRank/commSize);
+    const Int entryEnd =
+      Int((long long)(numNonzero)*(commRank+1)/commSize);
+    const Int numLocal = entryEnd - entryBeg;
+    vector<Int> rows(numLocal), cols(numLocal);
+    vector<T> vals(numLocal);
+    const size_t headerBytes = 4*sizeof(Int);
+    sidecar.seekg( headerBytes + size_t(entryBeg)*sizeof(Int) );
+    sidecar.read( (char*)rows.data(), numLocal*sizeof(Int) );
+    sidecar.seekg
+    ( headerBytes + (size_t(numNonzero)+size_t(entryBeg))*sizeof(Int) );
+    sidecar.read( (char*)cols.data(), numLocal*sizeof(Int) );
+    sidecar.seekg
+    ( headerBytes + 2*size_t(numNonzero)*sizeof(Int) +
+      size_t(entryBeg)*sizeof(T) );
+    sidecar.read( (char*)vals.data(), numLocal*sizeof(T) );
+    Int success = ( sidecar ? 1 : 0 );
+    success = mpi::AllReduce( success, mpi::MIN, comm );
+    if( !success )
+        return false;
+
+    Zeros( A, m, n );
+    A.Reserve( numLocal, numLocal );
+    for( Int k=0; k<numLocal; ++k )
+        A.QueueUpdate( rows[k], cols[k], vals[k] );
+    A.ProcessQueues();
+    return true;
+}
+
+template<typename T>
+void WriteSidecar( const DistSparseMatrix<T>& A, const string& filename )
+{
+    EL_DEBUG_CSE
+    const string sidecarName = filename + ".bin";
+    mpi::Comm comm = A.Grid().Comm();
+    const Int localNnz = A.NumLocalEntries();
+    const Int offset = mpi::Scan( localNnz, comm ) - localNnz;
+    const Int numNonzero = mpi::AllReduce( localNnz, comm );
+    const size_t headerBytes = 4*sizeof(Int);
+    const size_t numBytes =
+      headerBytes + size_t(numNonzero)*(2*sizeof(Int)+sizeof(T));
+
+    // The cache is written in parallel through a shared memory map; note
+    // that a failed attempt is harmless, as the zero-filled header cannot
+    // match the magic number and so will never be mistaken for a valid cache
+    Int usable = 0;
+    if( mpi::Rank( comm ) == 0 )
+        usable = ( io::CreateSizedFile( sidecarName, numBytes ) ? 1 : 0 );
+    mpi::Broadcast( usable, 0, comm );
+    if( !usable )
+        return;
+    {
+        io::MemoryMap map( sidecarName, numBytes, false );
+        Int viable = ( map.Viable() ? 1 : 0 );
+        viable = mpi::AllReduce( viable, mpi::MIN, comm );
+        if( !viable )
+            return;
+        char* buffer = map.Buffer();
+        if( mpi::Rank( comm ) == 0 )
+        {
+            Int* header = reinterpret_cast<Int*>(buffer);
+            header[0] = sidecarMagic;
+            header[1] = A.Height();
+            header[2] = A.Width();
+            header[3] = numNonzero;
+        }
+        Int* rows = reinterpret_cast<Int*>(buffer+headerBytes);
+        Int* cols = rows + numNonzero;
+        T* vals =
+          reinterpret_cast<T*>
+          (buffer+headerBytes+2*size_t(numNonzero)*sizeof(Int));
+        for( Int k=0; k<localNnz; ++k )
+        {
+            rows[offset+k] = A.Row(k);
+            cols[offset+k] = A.Col(k);
+            vals[offset+k] = A.Value(k);
+        }
+    }
+    mpi::Barrier( comm );
+}
+#endif // ifdef EL_HAVE_POSIX_MMAP
+
+} // namespace matrix_market
+
 template<typename T>
-void MatrixMarket( Matrix<T>& A, const string filename )
+void MatrixMarket( Matrix<T>& A, string filename )
 {
     EL_DEBUG_CSE
     typedef Base<T> Real;
     std::ifstream file( filename.c_str() );
     if( !file.is_open() ){
       filename = filename + "." + FileExtension(MATRIX_MARKET);
+      file.open( filename.c_str() );
       if( !file.is_open() ) RuntimeError("Could not open ",filename);
     }
 
@@ -219,7 +400,7 @@ void MatrixMarket( Matrix<T>& A, const string filename )
 }
 
 template<typename T>
-void MatrixMarket( AbstractDistMatrix<T>& A, const string filename )
+void MatrixMarket( AbstractDistMatrix<T>& A, string filename )
 {
     EL_DEBUG_CSE
     // TODO: Use a WriteProxy instead
@@ -235,13 +416,14 @@ void MatrixMarket( AbstractDistMatrix<T>& A, const string filename )
 }
 
 template<typename T>
-void MatrixMarket( SparseMatrix<T>& A, const string filename )
+void MatrixMarket( SparseMatrix<T>& A, string filename )
 {
     EL_DEBUG_CSE
     typedef Base<T> Real;
     std::ifstream file( filename.c_str() );
     if( !file.is_open() ){
       filename = filename + "." + FileExtension(MATRIX_MARKET);
+      file.open( filename.c_str() );
       if( !file.is_open() ) RuntimeError("Could not open ",filename);
     }
 
@@ -409,16 +591,22 @@ void MatrixMarket( SparseMatrix<T>& A, const string filename )
 }
 
 template<typename T>
-void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
+void MatrixMarket( DistSparseMatrix<T>& A, string filename )
 {
     EL_DEBUG_CSE
     typedef Base<T> Real;
     std::ifstream file( filename.c_str() );
     if( !file.is_open() ){
       filename = filename + "." + FileExtension(MATRIX_MARKET);
+      file.open( filename.c_str() );
       if( !file.is_open() ) RuntimeError("Could not open ",filename);
     }
 
+#ifdef EL_HAVE_POSIX_MMAP
+    // A fresh sidecar cache from a previous load bypasses text parsing
+    if( matrix_market::ReadSidecar( A, filename ) )
+        return;
+#endif
 
     // Read the header
     // ===============
@@ -515,60 +703,94 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
     // ========================
     Zeros( A, m, n );
 
-    // Fill in the local nonzero entries by passively calling QueueUpdate
-    // ==================================================================
-    int i, j;
+    // Partition the remainder of the file across the ranks at line
+    // granularity, parse each byte range locally, and route the parsed
+    // entries to their owners through the distributed update queues
+    // =================================================================
+    const int commSize = A.Grid().Size();
+    const int commRank = A.Grid().Rank();
+    const std::streamoff dataStart = file.tellg();
+    file.seekg( 0, std::ios::end );
+    const std::streamoff fileEnd = file.tellg();
+    const std::streamoff dataBytes = fileEnd - dataStart;
+    const std::streamoff rangeBeg =
+      dataStart + (dataBytes*commRank)/commSize;
+    const std::streamoff rangeEnd =
+      dataStart + (dataBytes*(commRank+1))/commSize;
+
+    // Read this rank's byte range, preceded by one byte of lookbehind (to
+    // decide whether the range begins mid-line) and extended so that the
+    // final line beginning within the range is complete
+    const std::streamoff adjBeg =
+      ( rangeBeg==dataStart ? dataStart : rangeBeg-1 );
+    string buffer;
+    buffer.resize( rangeEnd-adjBeg );
+    file.seekg( adjBeg );
+    file.read( &buffer[0], rangeEnd-adjBeg );
+    if( rangeEnd < fileEnd && !buffer.empty() && buffer.back() != '\n' )
+    {
+        string lineTail;
+        std::getline( file, lineTail );
+        buffer += lineTail;
+    }
+    // A line is parsed by the rank whose byte range contains its first byte
+    size_t parseOff = 0;
+    if( adjBeg < rangeBeg )
+    {
+        if( buffer[0] == '\n' )
+            parseOff = 1;
+        else
+        {
+            parseOff = buffer.find('\n');
+            parseOff =
+              ( parseOff == string::npos ? buffer.size() : parseOff+1 );
+        }
+    }
+
     Real realPart, imagPart;
     T value;
-    const int commSize = A.Grid().Size();
-    A.Reserve( numNonzero/commSize ); // Assume an even nonzero distribution
-    bool passive = true;
-    for( Int k=0; k<numNonzero; ++k )
+    // Assume an even nonzero distribution
+    A.Reserve( numNonzero/commSize, numNonzero/commSize );
+    Int numParsed = 0;
+    const char* p = buffer.c_str() + parseOff;
+    while( true )
     {
-        if( !std::getline( file, line ) )
-            RuntimeError("Could not get nonzero ",k);
-        std::stringstream lineStream( line );
-        if( !(lineStream >> i) )
-            RuntimeError("Could not extract row coordinate of nonzero ",k);
-        --i; // convert from Fortran to C indexing
+        char* next;
+        const long i = strtol( p, &next, 10 );
+        if( next == p )
+            break;
+        p = next;
+        long j = 1;
         if( isMatrix )
         {
-            if( !(lineStream >> j) )
-                RuntimeError
-                ("Could not extract col coordinate of nonzero ",k);
-            --j;
+            j = strtol( p, &next, 10 );
+            p = next;
         }
-        else
-            j = 0;
-
         if( isPattern )
         {
-            A.QueueUpdate( i, j, T(1), passive );
+            value = T(1);
         }
         else
         {
+            p = matrix_market::ParseValue( p, realPart );
             if( isComplex )
             {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                if( !(lineStream >> imagPart) )
-                    RuntimeError
-                    ("Could not extract imag part of entry (",i,",",j,")");
+                p = matrix_market::ParseValue( p, imagPart );
                 SetRealPart( value, realPart );
                 SetImagPart( value, imagPart );
-                A.QueueUpdate( i, j, value, passive );
             }
             else
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real entry (",i,",",j,")");
-                A.QueueUpdate( i, j, T(realPart), passive );
-            }
+                value = T(realPart);
         }
+        // Convert from Fortran to C indexing
+        A.QueueUpdate( Int(i)-1, Int(j)-1, value );
+        ++numParsed;
     }
-    A.ProcessLocalQueues();
+    const Int numParsedTotal = mpi::AllReduce( numParsed, A.Grid().Comm() );
+    if( numParsedTotal != Int(numNonzero) )
+        RuntimeError
+        ("Parsed ",numParsedTotal," nonzeros but expected ",numNonzero);
+    A.ProcessQueues();
 
     if( isSymmetric )
     {
@@ -587,6 +809,11 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
         MakeSymmetric( LOWER, A, conjugateSkew );
         ScaleTrapezoid( T(-1), UPPER, A, 1 );
     }
+
+#ifdef EL_HAVE_POSIX_MMAP
+    // Cache the assembled matrix so that subsequent loads skip the text
+    matrix_market::WriteSidecar( A, filename );
+#endif
 }
 
 } // namespace read
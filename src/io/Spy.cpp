@@ -49,6 +49,17 @@ void Spy( const AbstractDistMatrix<T>& A, string title, Base<T> tol )
 #ifdef EL_HAVE_QT5
     if( GuiDisabled() )
         LogicError("GUI was disabled");
+    const Int maxRes = DisplayResolution();
+    if( A.Height() > maxRes || A.Width() > maxRes )
+    {
+        // Too large to gather wholesale; pool the magnitudes down to the
+        // display resolution and render the pooled image instead
+        Matrix<Base<T>> P;
+        MaxAbsDownsample( A, P, maxRes, maxRes );
+        if( A.Grid().Rank() == 0 )
+            Spy( P, title+" (downsampled)", tol );
+        return;
+    }
     if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
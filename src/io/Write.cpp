@@ -11,6 +11,7 @@
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
+#include "./Write/BinaryCompressed.hpp"
 #include "./Write/BinaryFlat.hpp"
 #include "./Write/Image.hpp"
 #include "./Write/MatrixMarket.hpp"
@@ -28,6 +29,8 @@ void Write
     case ASCII:         write::Ascii( A, basename, title );       break;
     case ASCII_MATLAB:  write::AsciiMatlab( A, basename, title ); break;
     case BINARY:        write::Binary( A, basename );             break;
+    case BINARY_COMPRESSED:
+                        write::BinaryCompressed( A, basename );   break;
     case BINARY_FLAT:   write::BinaryFlat( A, basename );         break;
     case MATRIX_MARKET: write::MatrixMarket( A, basename );       break;
     case BMP:
@@ -49,6 +52,18 @@ void Write
   string basename, FileFormat format, string title )
 {
     EL_DEBUG_CSE
+    // The binary formats can be written in parallel directly from the local
+    // buffers rather than gathering the matrix onto a single rank
+    if( format == BINARY )
+    {
+        write::Binary( A, basename );
+        return;
+    }
+    if( format == BINARY_FLAT )
+    {
+        write::BinaryFlat( A, basename );
+        return;
+    }
     if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
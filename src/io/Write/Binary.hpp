@@ -9,6 +9,8 @@
 #ifndef EL_WRITE_BINARY_HPP
 #define EL_WRITE_BINARY_HPP
 
+#include "../MemoryMap.hpp"
+
 namespace El {
 namespace write {
 
@@ -35,6 +37,81 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+
+    const string filename = basename + "." + FileExtension(BINARY);
+    const Int height = A.Height();
+    const Int width = A.Width();
+#ifdef EL_HAVE_POSIX_MMAP
+    // Establish a file of the correct size, have every rank map it, and
+    // scatter the local entries into place with strided stores, so that the
+    // matrix is written in parallel from the local buffers rather than being
+    // funneled through a single rank
+    const Grid& g = A.Grid();
+    const size_t metaBytes = 2*sizeof(Int);
+    const size_t numBytes =
+      metaBytes + size_t(height)*size_t(width)*sizeof(T);
+    Int usable = 0;
+    if( g.Rank() == 0 )
+        usable = ( io::CreateSizedFile( filename, numBytes ) ? 1 : 0 );
+    mpi::Broadcast( usable, 0, g.Comm() );
+    if( usable )
+    {
+        {
+            io::MemoryMap map( filename, numBytes, false );
+            // Every byte of the payload must have a writer, so the parallel
+            // path requires the map to be viable on every rank
+            Int viable = ( map.Viable() ? 1 : 0 );
+            viable = mpi::AllReduce( viable, mpi::MIN, g.Comm() );
+            if( !viable )
+                usable = 0;
+            else
+            {
+                if( g.Rank() == 0 )
+                {
+                    Int* meta = reinterpret_cast<Int*>(map.Buffer());
+                    meta[0] = height;
+                    meta[1] = width;
+                }
+                if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
+                {
+                    char* payload = map.Buffer() + metaBytes;
+                    const Int localHeight = A.LocalHeight();
+                    const Int localWidth = A.LocalWidth();
+                    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    {
+                        const Int j = A.GlobalCol(jLoc);
+                        T* col =
+                          reinterpret_cast<T*>(payload) +
+                          size_t(j)*size_t(height);
+                        const T* ABuf = A.LockedBuffer(0,jLoc);
+                        if( A.ColStride() == 1 )
+                            MemCopy( col, ABuf, localHeight );
+                        else
+                            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                                col[A.GlobalRow(iLoc)] = ABuf[iLoc];
+                    }
+                }
+            }
+        }
+        if( usable )
+        {
+            // Do not return until every rank's contribution has been synced
+            mpi::Barrier( g.Comm() );
+            return;
+        }
+    }
+#endif
+    // Fall back to gathering the matrix onto a single rank
+    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
+    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+        Binary( A_CIRC_CIRC.LockedMatrix(), basename );
+}
+
 } // namespace write
 } // namespace El
 
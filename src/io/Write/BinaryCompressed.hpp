@@ -0,0 +1,99 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_BINARYCOMPRESSED_HPP
+#define EL_WRITE_BINARYCOMPRESSED_HPP
+
+namespace El {
+namespace write {
+
+// The format mirrors BINARY (the height and the width, followed by the
+// entries in column-major order), except that the entries are split into
+// fixed-size chunks, each stored as a pair of 64-bit sizes (raw and
+// payload) followed by the payload; a payload equal to the raw size marks
+// an incompressible chunk which was stored verbatim
+namespace binary_compressed {
+
+const size_t chunkSize = size_t(1)<<22;
+
+inline void WriteChunk
+( std::ofstream& file, const byte* raw, size_t rawSize,
+  std::vector<byte>& scratch )
+{
+    if( rawSize == 0 )
+        return;
+    scratch.resize( CompressBound(rawSize) );
+    size_t payloadSize = Compress( raw, rawSize, scratch.data(), rawSize-1 );
+    const byte* payload = scratch.data();
+    if( payloadSize == 0 )
+    {
+        payloadSize = rawSize;
+        payload = raw;
+    }
+    unsigned long long header[2];
+    header[0] = (unsigned long long)rawSize;
+    header[1] = (unsigned long long)payloadSize;
+    file.write( (char*)header, sizeof(header) );
+    file.write( (const char*)payload, payloadSize );
+}
+
+} // namespace binary_compressed
+
+template<typename T>
+inline void
+BinaryCompressed( const Matrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+
+    string filename = basename + "." + FileExtension(BINARY_COMPRESSED);
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    Int n;
+    n = A.Height();
+    file.write( (char*)&n, sizeof(Int) );
+    n = A.Width();
+    file.write( (char*)&n, sizeof(Int) );
+
+    const size_t height = size_t(A.Height());
+    const size_t colBytes = height*sizeof(T);
+    std::vector<byte> staging, scratch;
+    if( size_t(A.LDim()) == height )
+    {
+        // The entries are contiguous; chunk them directly
+        const byte* data = (const byte*)A.LockedBuffer();
+        const size_t totalBytes = colBytes*size_t(A.Width());
+        for( size_t off=0; off<totalBytes;
+             off+=binary_compressed::chunkSize )
+            binary_compressed::WriteChunk
+            ( file, data+off,
+              Min(binary_compressed::chunkSize,totalBytes-off), scratch );
+    }
+    else
+    {
+        // Stage whole columns until a chunk fills
+        for( Int j=0; j<A.Width(); ++j )
+        {
+            const byte* col = (const byte*)A.LockedBuffer(0,j);
+            staging.insert( staging.end(), col, col+colBytes );
+            if( staging.size() >= binary_compressed::chunkSize ||
+                j == A.Width()-1 )
+            {
+                binary_compressed::WriteChunk
+                ( file, staging.data(), staging.size(), scratch );
+                staging.clear();
+            }
+        }
+    }
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_BINARYCOMPRESSED_HPP
@@ -9,6 +9,8 @@
 #ifndef EL_WRITE_BINARYFLAT_HPP
 #define EL_WRITE_BINARYFLAT_HPP
 
+#include "../MemoryMap.hpp"
+
 namespace El {
 namespace write {
 
@@ -30,6 +32,71 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+
+    const string filename = basename + "." + FileExtension(BINARY_FLAT);
+    const Int height = A.Height();
+    const Int width = A.Width();
+#ifdef EL_HAVE_POSIX_MMAP
+    // As in write::Binary, establish an appropriately sized file and have
+    // every rank scatter its local entries through a shared memory map
+    const Grid& g = A.Grid();
+    const size_t numBytes = size_t(height)*size_t(width)*sizeof(T);
+    Int usable = 0;
+    if( g.Rank() == 0 )
+        usable = ( io::CreateSizedFile( filename, numBytes ) ? 1 : 0 );
+    mpi::Broadcast( usable, 0, g.Comm() );
+    if( usable && numBytes > 0 )
+    {
+        {
+            io::MemoryMap map( filename, numBytes, false );
+            Int viable = ( map.Viable() ? 1 : 0 );
+            viable = mpi::AllReduce( viable, mpi::MIN, g.Comm() );
+            if( !viable )
+                usable = 0;
+            else if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
+            {
+                char* payload = map.Buffer();
+                const Int localHeight = A.LocalHeight();
+                const Int localWidth = A.LocalWidth();
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                {
+                    const Int j = A.GlobalCol(jLoc);
+                    T* col =
+                      reinterpret_cast<T*>(payload) +
+                      size_t(j)*size_t(height);
+                    const T* ABuf = A.LockedBuffer(0,jLoc);
+                    if( A.ColStride() == 1 )
+                        MemCopy( col, ABuf, localHeight );
+                    else
+                        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                            col[A.GlobalRow(iLoc)] = ABuf[iLoc];
+                }
+            }
+        }
+        if( usable )
+        {
+            mpi::Barrier( g.Comm() );
+            return;
+        }
+    }
+    else if( usable )
+    {
+        // An empty payload requires no writers
+        mpi::Barrier( g.Comm() );
+        return;
+    }
+#endif
+    // Fall back to gathering the matrix onto a single rank
+    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
+    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+        BinaryFlat( A_CIRC_CIRC.LockedMatrix(), basename );
+}
+
 } // namespace write
 } // namespace El
 
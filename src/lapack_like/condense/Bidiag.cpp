@@ -11,6 +11,8 @@
 #include "./Bidiag/Apply.hpp"
 #include "./Bidiag/LowerBlocked.hpp"
 #include "./Bidiag/UpperBlocked.hpp"
+#include "./Bidiag/UpperToBand.hpp"
+#include "./Bidiag/UpperBandChase.hpp"
 
 namespace El {
 
@@ -27,9 +29,33 @@ void Bidiag
         bidiag::LowerBlocked( A, householderScalarsP, householderScalarsQ );
 }
 
-template<typename F> 
+template<typename F>
+void Bidiag
+( Matrix<F>& A,
+  Matrix<F>& householderScalarsP,
+  Matrix<F>& householderScalarsQ,
+  const BidiagCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.twoStage )
+    {
+        if( A.Height() < A.Width() )
+            LogicError
+            ("Two-stage Bidiag is only supported for matrices at least as "
+             "tall as they are wide");
+        const Int bandwidth =
+          ( ctrl.bandwidth > 0 ? ctrl.bandwidth : Blocksize() );
+        bidiag::UpperToBand
+        ( A, householderScalarsP, householderScalarsQ, bandwidth );
+        bidiag::UpperBandChase( A, bandwidth );
+    }
+    else
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+}
+
+template<typename F>
 void Bidiag
-( AbstractDistMatrix<F>& A, 
+( AbstractDistMatrix<F>& A,
   AbstractDistMatrix<F>& householderScalarsP,
   AbstractDistMatrix<F>& householderScalarsQ )
 {
@@ -40,6 +66,20 @@ void Bidiag
         bidiag::LowerBlocked( A, householderScalarsP, householderScalarsQ );
 }
 
+template<typename F>
+void Bidiag
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalarsP,
+  AbstractDistMatrix<F>& householderScalarsQ,
+  const BidiagCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.twoStage )
+        LogicError
+        ("Two-stage Bidiag is not yet supported for distributed matrices");
+    Bidiag( A, householderScalarsP, householderScalarsQ );
+}
+
 namespace bidiag {
 
 template<typename F>
@@ -173,9 +213,19 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
     Matrix<F>& householderScalarsP, \
     Matrix<F>& householderScalarsQ ); \
   template void Bidiag \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalarsP, \
+    Matrix<F>& householderScalarsQ, \
+    const BidiagCtrl& ctrl ); \
+  template void Bidiag \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& householderScalarsP, \
     AbstractDistMatrix<F>& householderScalarsQ ); \
+  template void Bidiag \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalarsP, \
+    AbstractDistMatrix<F>& householderScalarsQ, \
+    const BidiagCtrl& ctrl ); \
   template void bidiag::Explicit \
   ( Matrix<F>& A, \
     Matrix<F>& P, \
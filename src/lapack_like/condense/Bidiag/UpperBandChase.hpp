@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_UPPERBANDCHASE_HPP
+#define EL_BIDIAG_UPPERBANDCHASE_HPP
+
+namespace El {
+namespace bidiag {
+
+// CITATION
+//
+// Please see
+//
+//   B. Grosser and B. Lang, "Efficient parallel reduction to bidiagonal
+//   form", Parallel Computing, 25 (1999), pp. 969-986
+//
+// for the two-stage approach of reducing a dense matrix to a triangular
+// band matrix and subsequently chasing the band down to bidiagonal form,
+// which LAPACK's gbbrd is the one-stage band analogue of.
+
+// Reduce the upper triangular band matrix (of the given bandwidth) stored
+// in the first 'bandwidth' superdiagonals of the leading square portion of
+// A to upper bidiagonal form. Each row's entries beyond the superdiagonal
+// are annihilated with a Givens rotation of two columns, and the resulting
+// subdiagonal bulge is chased off of the bottom-right corner of the band
+// with alternating row and column rotations. Since the regions
+// immediately surrounding the band of A hold the Householder vectors
+// packed by UpperToBand, the band is chased within a compact band
+// workspace (whose columns the rotations traverse contiguously) and only
+// the resulting two diagonals are written back.
+template<typename F>
+void UpperBandChase( Matrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    const Int b = bandwidth;
+    if( b <= 1 || n <= 2 )
+        return;
+
+    // B(j-i+1,j) stores the band entry (i,j); the extra bottom and top rows
+    // respectively hold the transient subdiagonal bulge and the fill-in one
+    // entry beyond the band
+    Matrix<F> B;
+    Zeros( B, b+3, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=Max(j-b,Int(0)); i<=j; ++i )
+            B(j-i+1,j) = A(i,j);
+    auto ent = [&B]( Int i, Int j ) -> F& { return B(j-i+1,j); };
+
+    // Combine columns (q-1,q) so that the targeted entry of column q is
+    // annihilated; only the rows of the band (and the bulge row, q) can be
+    // nonzero in either column
+    auto applyRight = [&]( Int q, const Real& c, const F& s )
+    {
+        const Int beg = Max( q-b-1, Int(0) );
+        const Int end = Min( q+1, n );
+        for( Int i=beg; i<end; ++i )
+        {
+            const F mu = ent(i,q-1);
+            const F nu = ent(i,q);
+            ent(i,q-1) = c*mu + s*nu;
+            ent(i,q) = -Conj(s)*mu + c*nu;
+        }
+    };
+
+    // Combine rows (p-1,p) so that the targeted entry of row p is
+    // annihilated; row p-1 begins at its diagonal and row p at its bulge,
+    // and the combination can fill one entry past the band of row p-1
+    auto applyLeft = [&]( Int p, const Real& c, const F& s )
+    {
+        const Int beg = Max( p-1, Int(0) );
+        const Int end = Min( p+b+1, n );
+        for( Int j=beg; j<end; ++j )
+        {
+            const F mu = ent(p-1,j);
+            const F nu = ent(p,j);
+            ent(p-1,j) = c*mu + s*nu;
+            ent(p,j) = -Conj(s)*mu + c*nu;
+        }
+    };
+
+    Real c;
+    F s;
+    for( Int j=0; j<n-1; ++j )
+    {
+        const Int iEnd = Min( j+b, n-1 );
+        for( Int i=iEnd; i>j+1; --i )
+        {
+            // Annihilate (j,i) against (j,i-1) with a column rotation,
+            // which introduces a subdiagonal bulge at (i,i-1)
+            Givens( ent(j,i-1), ent(j,i), c, s );
+            applyRight( i, c, s );
+            ent(j,i) = 0;
+
+            // Chase the bulge off of the bottom-right corner of the band
+            Int p = i;
+            while( true )
+            {
+                // Annihilate the subdiagonal bulge (p,p-1) with a row
+                // rotation, which fills in (p-1,p+b) when it exists
+                Givens( ent(p-1,p-1), ent(p,p-1), c, s );
+                applyLeft( p, c, s );
+                ent(p,p-1) = 0;
+                if( p+b >= n )
+                    break;
+
+                // Annihilate the fill-in (p-1,p+b) against (p-1,p+b-1)
+                // with a column rotation, which reintroduces a subdiagonal
+                // bulge at (p+b,p+b-1)
+                Givens( ent(p-1,p+b-1), ent(p-1,p+b), c, s );
+                applyRight( p+b, c, s );
+                ent(p-1,p+b) = 0;
+                p += b;
+            }
+        }
+    }
+
+    // Write the bidiagonal back into A and explicitly zero the annihilated
+    // band entries (the packed Householder vectors are left untouched)
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=Max(j-b,Int(0)); i<=j; ++i )
+            A(i,j) = 0;
+        A(j,j) = ent(j,j);
+        if( j > 0 )
+            A(j-1,j) = ent(j-1,j);
+    }
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_UPPERBANDCHASE_HPP
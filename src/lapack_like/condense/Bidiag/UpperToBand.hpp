@@ -0,0 +1,215 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_UPPERTOBAND_HPP
+#define EL_BIDIAG_UPPERTOBAND_HPP
+
+namespace El {
+namespace bidiag {
+
+// Perform an unblocked Householder QR factorization of the panel P,
+// overwriting its upper triangle with R and the entries below the diagonal
+// with the (implicitly unit-diagonal) Householder vectors. Unlike El::QR,
+// the diagonal of R is not standardized, so that the panel contents exactly
+// equal the transformed matrix.
+template<typename F>
+void UpperToBandPanelQR( Matrix<F>& P, Matrix<F>& t )
+{
+    EL_DEBUG_CSE
+    const Int m = P.Height();
+    const Int n = P.Width();
+    const Int minDim = Min(m,n);
+    t.Resize( minDim, 1 );
+
+    Matrix<F> z21;
+    for( Int k=0; k<minDim; ++k )
+    {
+        const Range<Int> ind1( k ), ind2( k+1, END ), indB( k, END );
+
+        auto alpha11 = P( ind1, ind1 );
+        auto p21     = P( ind2, ind1 );
+        auto pB1     = P( indB, ind1 );
+        auto PB2     = P( indB, ind2 );
+
+        const F tau = LeftReflector( alpha11, p21 );
+        t(k) = tau;
+
+        // Temporarily replace the diagonal entry with the implicit one
+        const F alpha = alpha11(0);
+        alpha11(0) = 1;
+
+        // PB2 := (I - tau pB1 pB1^H) PB2
+        Zeros( z21, PB2.Width(), 1 );
+        Gemv( ADJOINT, F(1), PB2, pB1, F(0), z21 );
+        Ger( -tau, pB1, z21, PB2 );
+
+        alpha11(0) = alpha;
+    }
+}
+
+// Perform an unblocked Householder LQ factorization of the row panel P,
+// overwriting its lower triangle with L and the entries right of the
+// diagonal with the (implicitly unit-diagonal) Householder row vectors
+template<typename F>
+void UpperToBandPanelLQ( Matrix<F>& P, Matrix<F>& t )
+{
+    EL_DEBUG_CSE
+    const Int m = P.Height();
+    const Int n = P.Width();
+    const Int minDim = Min(m,n);
+    t.Resize( minDim, 1 );
+
+    Matrix<F> z21;
+    for( Int k=0; k<minDim; ++k )
+    {
+        const Range<Int> ind1( k ), ind2( k+1, END ), indR( k, END );
+
+        auto alpha11 = P( ind1, ind1 );
+        auto p12     = P( ind1, ind2 );
+        auto p1R     = P( ind1, indR );
+        auto P2R     = P( ind2, indR );
+
+        const F tau = RightReflector( alpha11, p12 );
+        t(k) = tau;
+
+        // Temporarily replace the diagonal entry with the implicit one
+        const F alpha = alpha11(0);
+        alpha11(0) = 1;
+
+        // P2R := P2R (I - tau p1R^T conj(p1R)) = P2R - tau (P2R p1R^T) conj(p1R)
+        Zeros( z21, P2R.Height(), 1 );
+        Gemv( NORMAL, F(1), P2R, p1R, F(0), z21 );
+        Ger( -tau, z21, p1R, P2R );
+
+        alpha11(0) = alpha;
+    }
+}
+
+// Form the upper-triangular factor T such that the product of the
+// Householder transformations is I - V T V^H, where V is the given unit
+// lower-trapezoidal matrix of Householder vectors
+template<typename F>
+void UpperToBandFormT( const Matrix<F>& V, const Matrix<F>& t, Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    const Int m = V.Height();
+    const Int nb = t.Height();
+    Zeros( T, nb, nb );
+
+    Matrix<F> v, z;
+    for( Int k=0; k<nb; ++k )
+    {
+        T(k,k) = t(k);
+        if( k > 0 )
+        {
+            // z := V(:,0:k)^H v_k, exploiting that v_k vanishes above row k
+            auto V0 = V( IR(k,m), IR(0,k) );
+            v = V( IR(k,m), IR(k,k+1) );
+            v(0) = F(1);
+            Zeros( z, k, 1 );
+            Gemv( ADJOINT, F(1), V0, v, F(0), z );
+
+            // T(0:k,k) := -t(k) T(0:k,0:k) z
+            auto T00 = T( IR(0,k), IR(0,k) );
+            auto t01 = T( IR(0,k), IR(k,k+1) );
+            Gemv( NORMAL, -t(k), T00, z, F(0), t01 );
+        }
+    }
+}
+
+// Reduce the (at least as tall as wide) matrix A to an upper triangular
+// band matrix of the given bandwidth by alternating blocked Householder QR
+// factorizations of the diagonal column panels with blocked Householder LQ
+// factorizations of the row panels to their right. Only the narrow panel
+// factorizations require level-2 BLAS; the dominant trailing updates are
+// performed with {Gemm,Trmm}. On exit, the band occupies the first
+// 'bandwidth' superdiagonals of A, the left (Q) Householder vectors are
+// stored below the diagonal, the right (P) Householder vectors are stored
+// right of the band, and their scalars are returned in the corresponding
+// householderScalars vectors.
+template<typename F>
+void UpperToBand
+( Matrix<F>& A,
+  Matrix<F>& householderScalarsP,
+  Matrix<F>& householderScalarsQ,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    EL_DEBUG_ONLY(
+      if( m < n )
+          LogicError("A must be at least as tall as it is wide");
+    )
+    const Int b = Max( bandwidth, Int(1) );
+
+    Int numP = 0;
+    for( Int k=0; k<n; k+=b )
+        numP += Min( Min(b,n-k), Max(n-(k+b),Int(0)) );
+    householderScalarsQ.Resize( n, 1 );
+    householderScalarsP.Resize( numP, 1 );
+
+    Matrix<F> T, U, V, W;
+    Int pOff = 0;
+    for( Int k=0; k<n; k+=b )
+    {
+        const Int pnb = Min( b, n-k );
+
+        // QR-factor the diagonal column panel and apply the transpose of
+        // its block reflector, Q^H = I - V T^H V^H, to the trailing columns
+        auto P = A( IR(k,m), IR(k,k+pnb) );
+        auto tQ1 = householderScalarsQ( IR(k,k+pnb), ALL );
+        UpperToBandPanelQR( P, tQ1 );
+        if( k+pnb < n )
+        {
+            UpperToBandFormT( P, tQ1, T );
+
+            // Expand the unit lower-trapezoidal V from its packed storage
+            V = P;
+            MakeTrapezoidal( LOWER, V, -1 );
+            FillDiagonal( V, F(1) );
+
+            auto A2 = A( IR(k,m), IR(k+pnb,n) );
+            W.Resize( pnb, A2.Width() );
+            Gemm( ADJOINT, NORMAL, F(1), V, A2, W );
+            Trmm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), T, W );
+            Gemm( NORMAL, NORMAL, F(-1), V, W, F(1), A2 );
+        }
+
+        // LQ-factor the row panel right of the band and apply its block
+        // reflector, I - U T U^H, to the rows below it from the right
+        if( k+b < n )
+        {
+            const Int rnb = Min( pnb, n-(k+b) );
+            auto R = A( IR(k,k+rnb), IR(k+b,n) );
+            auto tP1 = householderScalarsP( IR(pOff,pOff+rnb), ALL );
+            pOff += rnb;
+            UpperToBandPanelLQ( R, tP1 );
+            if( k+rnb < m )
+            {
+                // The Householder rows of R, transposed into columns, form
+                // a unit lower-trapezoidal U with I - tau u u^H per column
+                Transpose( R, U );
+                MakeTrapezoidal( LOWER, U, -1 );
+                FillDiagonal( U, F(1) );
+                UpperToBandFormT( U, tP1, T );
+
+                auto B = A( IR(k+rnb,m), IR(k+b,n) );
+                W.Resize( B.Height(), rnb );
+                Gemm( NORMAL, NORMAL, F(1), B, U, W );
+                Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T, W );
+                Gemm( NORMAL, ADJOINT, F(-1), W, U, F(1), B );
+            }
+        }
+    }
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_UPPERTOBAND_HPP
@@ -43,6 +43,8 @@ void Ger2Sub
 
 #include "./HermitianTridiag/LowerBlocked.hpp"
 #include "./HermitianTridiag/LowerBlockedSquare.hpp"
+#include "./HermitianTridiag/LowerToBand.hpp"
+#include "./HermitianTridiag/LowerBandChase.hpp"
 #include "./HermitianTridiag/UpperBlocked.hpp"
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
 
@@ -61,7 +63,30 @@ void HermitianTridiag
         herm_tridiag::UpperBlocked( A, householderScalars );
 }
 
-template<typename F> 
+template<typename F>
+void HermitianTridiag
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.twoStage )
+    {
+        if( uplo != LOWER )
+            LogicError
+            ("Two-stage tridiagonalization is only supported for lower "
+             "storage");
+        const Int bandwidth =
+          ( ctrl.bandwidth > 0 ? ctrl.bandwidth : Blocksize() );
+        herm_tridiag::LowerToBand( A, householderScalars, bandwidth );
+        herm_tridiag::LowerBandChase( A, bandwidth );
+    }
+    else
+        HermitianTridiag( uplo, A, householderScalars );
+}
+
+template<typename F>
 void HermitianTridiag
 ( UpperOrLower uplo,
   AbstractDistMatrix<F>& APre,
@@ -69,6 +94,10 @@ void HermitianTridiag
   const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.twoStage )
+        LogicError
+        ("Two-stage tridiagonalization is not yet supported for distributed "
+         "matrices");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     DistMatrixWriteProxy<F,F,STAR,STAR>
@@ -195,6 +224,11 @@ void ExplicitCondensed
     Matrix<F>& A, \
     Matrix<F>& householderScalars ); \
   template void HermitianTridiag \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void HermitianTridiag \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& householderScalars, \
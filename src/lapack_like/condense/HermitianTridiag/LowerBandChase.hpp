@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_LOWERBANDCHASE_HPP
+#define EL_HERMITIANTRIDIAG_LOWERBANDCHASE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// CITATION
+//
+// Please see
+//
+//   H. R. Schwarz, "Tridiagonalization of a symmetric band matrix",
+//   Numerische Mathematik, 12 (1968), pp. 231-241
+//
+// for the original bulge-chasing reduction of a band matrix to tridiagonal
+// form, which LAPACK's {s,d}sbtrd and {c,z}hbtrd descend from.
+
+// Reduce the lower-stored Hermitian band matrix A (of the given bandwidth)
+// to tridiagonal form by annihilating each column's below-subdiagonal
+// entries with Givens rotations and chasing the resulting bulges off of the
+// bottom-right corner of the band. Since the rotations only touch O(b)
+// entries each, the band is temporarily mirrored into the strictly upper
+// triangle so that the two-sided applications remain contiguous row and
+// column sweeps; the strictly upper triangle is therefore overwritten.
+template<typename F>
+void LowerBandChase( Matrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    if( b <= 1 || n <= 2 )
+        return;
+
+    // Mirror the band into the strictly upper triangle
+    for( Int j=0; j<n; ++j )
+        for( Int i=j+1; i<Min(j+b+1,n); ++i )
+            A(j,i) = Conj(A(i,j));
+
+    // Apply the rotation G = [c, s; -conj(s), c] to rows (p-1,p) and its
+    // adjoint to columns (p-1,p), restricted to the window of potentially
+    // nonzero entries
+    auto applyTwoSided = [&]( Int p, const Real& c, const F& s )
+    {
+        const Int beg = Max( p-b-1, Int(0) );
+        const Int end = Min( p+b+1, n );
+        for( Int j=beg; j<end; ++j )
+        {
+            const F mu = A(p-1,j);
+            const F nu = A(p,j);
+            A(p-1,j) = c*mu + s*nu;
+            A(p,j) = -Conj(s)*mu + c*nu;
+        }
+        for( Int i=beg; i<end; ++i )
+        {
+            const F mu = A(i,p-1);
+            const F nu = A(i,p);
+            A(i,p-1) = mu*c + nu*Conj(s);
+            A(i,p) = -mu*s + nu*c;
+        }
+    };
+
+    Real c;
+    F s;
+    for( Int j=0; j<n-2; ++j )
+    {
+        const Int iEnd = Min( j+b, n-1 );
+        for( Int i=iEnd; i>j+1; --i )
+        {
+            // Annihilate A(i,j) against A(i-1,j)
+            Givens( A(i-1,j), A(i,j), c, s );
+            applyTwoSided( i, c, s );
+            A(i,j) = 0;
+            A(j,i) = 0;
+
+            // Chase the resulting bulge at A(p+b,p-1) down the band
+            for( Int p=i; p+b<n; p+=b )
+            {
+                Givens( A(p+b-1,p-1), A(p+b,p-1), c, s );
+                applyTwoSided( p+b, c, s );
+                A(p+b,p-1) = 0;
+                A(p-1,p+b) = 0;
+            }
+        }
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_LOWERBANDCHASE_HPP
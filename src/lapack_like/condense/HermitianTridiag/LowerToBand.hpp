@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_LOWERTOBAND_HPP
+#define EL_HERMITIANTRIDIAG_LOWERTOBAND_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// Perform an unblocked Householder QR factorization of the panel P,
+// overwriting its upper triangle with R and the entries below the diagonal
+// with the (implicitly unit-diagonal) Householder vectors. Unlike El::QR,
+// the diagonal of R is not standardized, so that the panel contents exactly
+// equal the transformed matrix.
+template<typename F>
+void LowerToBandPanelQR( Matrix<F>& P, Matrix<F>& t )
+{
+    EL_DEBUG_CSE
+    const Int m = P.Height();
+    const Int n = P.Width();
+    const Int minDim = Min(m,n);
+    t.Resize( minDim, 1 );
+
+    Matrix<F> z21;
+    for( Int k=0; k<minDim; ++k )
+    {
+        const Range<Int> ind1( k ), ind2( k+1, END ), indB( k, END );
+
+        auto alpha11 = P( ind1, ind1 );
+        auto p21     = P( ind2, ind1 );
+        auto pB1     = P( indB, ind1 );
+        auto PB2     = P( indB, ind2 );
+
+        const F tau = LeftReflector( alpha11, p21 );
+        t(k) = tau;
+
+        // Temporarily replace the diagonal entry with the implicit one
+        const F alpha = alpha11(0);
+        alpha11(0) = 1;
+
+        // PB2 := (I - tau pB1 pB1^H) PB2
+        Zeros( z21, PB2.Width(), 1 );
+        Gemv( ADJOINT, F(1), PB2, pB1, F(0), z21 );
+        Ger( -tau, pB1, z21, PB2 );
+
+        alpha11(0) = alpha;
+    }
+}
+
+// Form the upper-triangular factor T such that the product of the panel's
+// Householder transformations is I - V T V^H, where the unit
+// lower-trapezoidal V is stored below the diagonal of P
+template<typename F>
+void LowerToBandFormT( const Matrix<F>& P, const Matrix<F>& t, Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    const Int m = P.Height();
+    const Int nb = t.Height();
+    Zeros( T, nb, nb );
+
+    Matrix<F> v, z;
+    for( Int k=0; k<nb; ++k )
+    {
+        T(k,k) = t(k);
+        if( k > 0 )
+        {
+            // z := V(:,0:k)^H v_k, exploiting that v_k vanishes above row k
+            auto V0 = P( IR(k,m), IR(0,k) );
+            v = P( IR(k,m), IR(k,k+1) );
+            v(0) = F(1);
+            Zeros( z, k, 1 );
+            Gemv( ADJOINT, F(1), V0, v, F(0), z );
+
+            // T(0:k,k) := -t(k) T(0:k,0:k) z
+            auto T00 = T( IR(0,k), IR(0,k) );
+            auto t01 = T( IR(0,k), IR(k,k+1) );
+            Gemv( NORMAL, -t(k), T00, z, F(0), t01 );
+        }
+    }
+}
+
+// Reduce the lower-stored Hermitian matrix A to a Hermitian band matrix of
+// the given bandwidth using blocked Householder transformations. Only the
+// narrow panel factorizations require level-2 BLAS; the dominant two-sided
+// trailing updates are performed with {Trmm,Hemm,Gemm,Her2k}. On exit, the
+// band is stored in the lower triangle of A, the Householder vectors are
+// stored below the band, and their scalars are returned in
+// householderScalars.
+template<typename F>
+void LowerToBand( Matrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int b = Max( bandwidth, Int(1) );
+    householderScalars.Resize( Max(n-b,Int(0)), 1 );
+    if( n <= b+1 )
+        return;
+
+    Matrix<F> T, V, W, Y, S;
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int pnb = Min( b, (n-b)-k );
+        const Int m = n-(k+b);
+
+        auto P = A( IR(k+b,n), IR(k,k+pnb) );
+        auto t1 = householderScalars( IR(k,k+pnb), ALL );
+        LowerToBandPanelQR( P, t1 );
+        LowerToBandFormT( P, t1, T );
+
+        // Expand the unit lower-trapezoidal V from its packed storage
+        V = P;
+        MakeTrapezoidal( LOWER, V, -1 );
+        FillDiagonal( V, F(1) );
+
+        // Apply Q^H A22 Q = A22 - V W^H - W V^H, where Q = I - V T V^H,
+        // Y = A22 V T, and W = Y - (1/2) V ((V T)^H Y)
+        auto A22 = A( IR(k+b,n), IR(k+b,n) );
+        W = V;
+        Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T, W );
+        Zeros( Y, m, pnb );
+        Hemm( LEFT, LOWER, F(1), A22, W, F(0), Y );
+        Zeros( S, pnb, pnb );
+        Gemm( ADJOINT, NORMAL, F(1), W, Y, F(0), S );
+        W = Y;
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, S, F(1), W );
+        Her2k( LOWER, NORMAL, F(-1), V, W, Real(1), A22 );
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_LOWERTOBAND_HPP
@@ -10,11 +10,24 @@
 
 #include "./Hessenberg/LowerBlocked.hpp"
 #include "./Hessenberg/UpperBlocked.hpp"
+#include "./Hessenberg/UpperLookahead.hpp"
 #include "./Hessenberg/ApplyQ.hpp"
 #include "./Hessenberg/FormQ.hpp"
 
 namespace El {
 
+namespace {
+
+bool hessenbergLookahead = false;
+
+} // anonymous namespace
+
+void SetHessenbergLookahead( bool lookahead )
+{ hessenbergLookahead = lookahead; }
+
+bool HessenbergLookahead()
+{ return hessenbergLookahead; }
+
 template<typename F>
 void Hessenberg
 ( UpperOrLower uplo,
@@ -36,7 +49,12 @@ void Hessenberg
 {
     EL_DEBUG_CSE
     if( uplo == UPPER )
-        hessenberg::UpperBlocked( A, householderScalars );
+    {
+        if( HessenbergLookahead() )
+            hessenberg::UpperLookahead( A, householderScalars );
+        else
+            hessenberg::UpperBlocked( A, householderScalars );
+    }
     else
         hessenberg::LowerBlocked( A, householderScalars );
 }
@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESSENBERG_UPPER_LOOKAHEAD_HPP
+#define EL_HESSENBERG_UPPER_LOOKAHEAD_HPP
+
+#include "./UpperPanel.hpp"
+
+namespace El {
+namespace hessenberg {
+
+// A one-step lookahead variant of UpperBlocked: the update of the rows above
+// each panel (A0R) is read by neither the subsequent panel factorization
+// (which only touches rows at or below the panel offset) nor the subsequent
+// trailing-matrix update, so it is deferred until after the next panel has
+// been factored. The latency-bound per-column collectives of the panel
+// factorization are thereby not serialized behind the entirety of the
+// previous iteration's aggregated updates.
+template<typename F>
+void UpperLookahead
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre ))
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    householderScalars.Resize( Max(n-1,0), 1 );
+
+    DistMatrix<F,MC,STAR> V01_MC_STAR(g), UB1_MC_STAR(g), VB1_MC_STAR(g);
+    DistMatrix<F,MR,STAR> V21_MR_STAR(g);
+    // Two generations of the reflector panel are alive at once since the
+    // update of the rows above each panel is applied one iteration late
+    DistMatrix<F,MR,STAR> UB1_MR_STAR(g), prevUB1_MR_STAR(g);
+    DistMatrix<F,STAR,STAR> G11_STAR_STAR(g), prevG11_STAR_STAR(g);
+    auto* curU = &UB1_MR_STAR;
+    auto* prevU = &prevUB1_MR_STAR;
+    auto* curG = &G11_STAR_STAR;
+    auto* prevG = &prevG11_STAR_STAR;
+
+    // Apply the deferred update of the rows above the previous panel,
+    //   A0R := A0R - ((A0R UB1) inv(G11)^H) UB1^H
+    auto flushDeferred = [&]( Int kPrev )
+    {
+        auto A0R = A( IR(0,kPrev), IR(kPrev,n) );
+        const Int nbPrev = prevG->Height();
+        V01_MC_STAR.AlignWith( A0R );
+        Zeros( V01_MC_STAR, kPrev, nbPrev );
+        LocalGemm( NORMAL, NORMAL, F(1), A0R, *prevU, F(0), V01_MC_STAR );
+        El::AllReduce( V01_MC_STAR, A0R.RowComm() );
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), *prevG, V01_MC_STAR );
+        LocalGemm( NORMAL, ADJOINT, F(-1), V01_MC_STAR, *prevU, F(1), A0R );
+    };
+
+    const Int bsize = Blocksize();
+    Int kPrev = 0;
+    bool deferredUpdate = false;
+    for( Int k=0; k<n-1; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-1-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         indB( k,    n    ), indR( k, n ),
+                         ind2( k+nb, n    );
+
+        auto ABR = A( indB, indR );
+
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        UB1_MC_STAR.AlignWith( ABR );
+        curU->AlignWith( ABR );
+        VB1_MC_STAR.AlignWith( ABR );
+        UB1_MC_STAR.Resize( n-k, nb );
+        curU->Resize( n-k, nb );
+        VB1_MC_STAR.Resize( n-k, nb );
+        curG->Resize( nb, nb );
+        hessenberg::UpperPanel
+        ( ABR, householderScalars1, UB1_MC_STAR, *curU, VB1_MC_STAR, *curG );
+
+        // Catch the rows above the previous panel up with its reflectors
+        // (the panel factorization just completed only read rows at or
+        // below the current offset and was therefore unaffected)
+        if( deferredUpdate )
+            flushDeferred( kPrev );
+
+        auto AB2 = A( indB, ind2 );
+        auto U21_MR_STAR = (*curU)( IR(nb,END), ALL );
+
+        // AB2 := (I - UB1 inv(G11) UB1^H)(AB2 - VB1 inv(G11)^H U21^H)
+        // -----------------------------------------------------------
+        // AB2 := AB2 - VB1 inv(G11)^H U21^H
+        // (note: VB1 is overwritten)
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), *curG, VB1_MC_STAR );
+        LocalGemm
+        ( NORMAL, ADJOINT, F(-1), VB1_MC_STAR, U21_MR_STAR, F(1), AB2 );
+        // AB2 := AB2 - UB1 (inv(G11) (UB1^H AB2))
+        //      = AB2 - UB1 ((AB2^H UB1) inv(G11)^H)^H
+        V21_MR_STAR.AlignWith( AB2 );
+        Zeros( V21_MR_STAR, AB2.Width(), nb );
+        LocalGemm( ADJOINT, NORMAL, F(1), AB2, UB1_MC_STAR, F(0), V21_MR_STAR );
+        El::AllReduce( V21_MR_STAR, AB2.ColComm() );
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), *curG, V21_MR_STAR );
+        LocalGemm
+        ( NORMAL, ADJOINT, F(-1), UB1_MC_STAR, V21_MR_STAR, F(1), AB2 );
+
+        kPrev = k;
+        std::swap( curU, prevU );
+        std::swap( curG, prevG );
+        deferredUpdate = true;
+    }
+    if( deferredUpdate )
+        flushDeferred( kPrev );
+}
+
+} // namespace hessenberg
+} // namespace El
+
+#endif // ifndef EL_HESSENBERG_UPPER_LOOKAHEAD_HPP
@@ -505,8 +505,7 @@ void GeomEquil
     {
         // Geometrically rescale the columns
         // ---------------------------------
-        ColumnMaxNorms( A, maxAbsVals );
-        ColumnMinAbsNonzero( A, maxAbsVals, minAbsVals );
+        ColumnMaxMinAbsNonzero( A, maxAbsVals, minAbsVals );
         for( Int j=0; j<n; ++j )
         {
             const Real maxAbs = maxAbsVals(j);
@@ -527,8 +526,12 @@ void GeomEquil
 
         // Geometrically rescale the rows
         // ------------------------------
-        RowMaxNorms( A, maxAbsVals );
-        RowMinAbsNonzero( A, maxAbsVals, minAbsVals );
+        // The extrema of the rescaled matrix follow arithmetically from the
+        // row statistics, so the convergence test below does not require
+        // another pass over the entries
+        RowMaxMinAbsNonzero( A, maxAbsVals, minAbsVals );
+        Real newMaxAbsVal = 0;
+        Real newMinAbsVal = limits::Max<Real>();
         for( Int i=0; i<m; ++i )
         {
             const Real maxAbs = maxAbsVals(i);
@@ -538,6 +541,8 @@ void GeomEquil
                 const Real propScale = Sqrt(minAbs*maxAbs);
                 const Real scale = Max(propScale,sqrtDamp*maxAbs);
                 rowScale(i) = scale;
+                newMaxAbsVal = Max(newMaxAbsVal,maxAbs/scale);
+                newMinAbsVal = Min(newMinAbsVal,minAbs/scale);
             }
             else
                 rowScale(i) = Real(1);
@@ -547,9 +552,6 @@ void GeomEquil
 
         // Determine whether we are done or not
         // ------------------------------------
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
         const Real newRatio = newMaxAbsVal / newMinAbsVal;
         if( progress )
             Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
@@ -625,14 +627,19 @@ void StackedGeomEquil
     {
         // Geometrically rescale the columns
         // ---------------------------------
-        ColumnMaxNorms( A, maxAbsValsA );
-        ColumnMaxNorms( B, maxAbsValsB );
+        ColumnMaxMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
+        ColumnMaxMinAbsNonzero( B, maxAbsValsB, minAbsValsB );
         for( Int j=0; j<n; ++j )
-            maxAbsValsA(j) = Max(maxAbsValsA(j),maxAbsValsB(j));
-        ColumnMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
-        ColumnMinAbsNonzero( B, maxAbsValsA, minAbsValsB );
-        for( Int j=0; j<n; ++j )
-            minAbsValsA(j) = Min(minAbsValsA(j),minAbsValsB(j));
+        {
+            const Real maxAbs = Max(maxAbsValsA(j),maxAbsValsB(j));
+            Real minAbs = maxAbs;
+            if( maxAbsValsA(j) > Real(0) )
+                minAbs = Min(minAbs,minAbsValsA(j));
+            if( maxAbsValsB(j) > Real(0) )
+                minAbs = Min(minAbs,minAbsValsB(j));
+            maxAbsValsA(j) = maxAbs;
+            minAbsValsA(j) = minAbs;
+        }
         for( Int j=0; j<n; ++j )
         {
             const Real maxAbs = maxAbsValsA(j);
@@ -652,8 +659,12 @@ void StackedGeomEquil
 
         // Geometrically rescale the rows
         // ------------------------------
-        RowMaxNorms( A, maxAbsValsA );
-        RowMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
+        // The extrema of the rescaled matrices follow arithmetically from
+        // the row statistics, so the convergence test below does not require
+        // further passes over the entries
+        Real newMaxAbsVal = 0;
+        Real newMinAbsVal = limits::Max<Real>();
+        RowMaxMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
         for( Int i=0; i<mA; ++i )
         {
             const Real maxAbs = maxAbsValsA(i);
@@ -663,6 +674,8 @@ void StackedGeomEquil
                 const Real propScale = Sqrt(minAbs*maxAbs);
                 const Real scale = Max(propScale,sqrtDamp*maxAbs);
                 rowScaleA(i) = scale;
+                newMaxAbsVal = Max(newMaxAbsVal,maxAbs/scale);
+                newMinAbsVal = Min(newMinAbsVal,minAbs/scale);
             }
             else
                 rowScaleA(i) = Real(1);
@@ -670,8 +683,7 @@ void StackedGeomEquil
         DiagonalScale( LEFT, NORMAL, rowScaleA, dRowA );
         DiagonalSolve( LEFT, NORMAL, rowScaleA, A );
 
-        RowMinAbsNonzero( B, maxAbsValsB, minAbsValsB );
-        RowMaxNorms( B, maxAbsValsB );
+        RowMaxMinAbsNonzero( B, maxAbsValsB, minAbsValsB );
         for( Int i=0; i<mB; ++i )
         {
             const Real maxAbs = maxAbsValsB(i);
@@ -681,6 +693,8 @@ void StackedGeomEquil
                 const Real propScale = Sqrt(minAbs*maxAbs);
                 const Real scale = Max(propScale,sqrtDamp*maxAbs);
                 rowScaleB(i) = scale;
+                newMaxAbsVal = Max(newMaxAbsVal,maxAbs/scale);
+                newMinAbsVal = Min(newMinAbsVal,minAbs/scale);
             }
             else
                 rowScaleB(i) = Real(1);
@@ -690,12 +704,6 @@ void StackedGeomEquil
 
         // Determine whether we are done or not
         // ------------------------------------
-        auto newMaxAbsA = MaxAbsLoc( A );
-        auto newMaxAbsB = MaxAbsLoc( B );
-        const Real newMaxAbsVal = Max(newMaxAbsA.value,newMaxAbsB.value);
-        const Real newMinAbsValA = MinAbsNonzero( A, newMaxAbsVal );
-        const Real newMinAbsValB = MinAbsNonzero( B, newMaxAbsVal );
-        const Real newMinAbsVal = Min(newMinAbsValA,newMinAbsValB);
         const Real newRatio = newMaxAbsVal / newMinAbsVal;
         if( progress )
             Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
@@ -786,8 +794,7 @@ void GeomEquil
     {
         // Geometrically rescale the columns
         // ---------------------------------
-        ColumnMaxNorms( A, maxAbsVals );
-        ColumnMinAbsNonzero( A, maxAbsVals, minAbsVals );
+        ColumnMaxMinAbsNonzero( A, maxAbsVals, minAbsVals );
         auto& maxAbsValsLoc = maxAbsVals.Matrix();
         auto& minAbsValsLoc = minAbsVals.Matrix();
         scales.Resize( n, 1 );
@@ -810,9 +817,13 @@ void GeomEquil
 
         // Geometrically rescale the rows
         // ------------------------------
-        RowMaxNorms( A, maxAbsVals );
-        RowMinAbsNonzero( A, maxAbsVals, minAbsVals );
+        // The extrema of the rescaled matrix follow arithmetically from the
+        // row statistics, so the convergence test below only requires a pair
+        // of scalar AllReduces rather than further passes over the entries
+        RowMaxMinAbsNonzero( A, maxAbsVals, minAbsVals );
         scales.Resize( m, 1 );
+        Real newMaxAbsVal = 0;
+        Real newMinAbsVal = limits::Max<Real>();
         const Int localHeight = maxAbsVals.LocalHeight();
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
         {
@@ -823,6 +834,8 @@ void GeomEquil
                 const Real propScale = Sqrt(minAbs*maxAbs);
                 const Real scale = Max(propScale,sqrtDamp*maxAbs);
                 scalesLoc(iLoc) = scale;
+                newMaxAbsVal = Max(newMaxAbsVal,maxAbs/scale);
+                newMinAbsVal = Min(newMinAbsVal,minAbs/scale);
             }
             else
                 scalesLoc(iLoc) = 1;
@@ -832,9 +845,8 @@ void GeomEquil
 
         // Determine whether we are done or not
         // ------------------------------------
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
+        newMaxAbsVal = mpi::AllReduce( newMaxAbsVal, mpi::MAX, grid.Comm() );
+        newMinAbsVal = mpi::AllReduce( newMinAbsVal, mpi::MIN, grid.Comm() );
         const Real newRatio = newMaxAbsVal / newMinAbsVal;
         if( progress && commRank == 0 )
             Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
@@ -923,17 +935,21 @@ void StackedGeomEquil
         // Geometrically rescale the columns
         // ---------------------------------
         scales.Resize( n, 1 );
-        ColumnMaxNorms( A, maxAbsValsA );
-        ColumnMaxNorms( B, maxAbsValsB );
+        ColumnMaxMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
+        ColumnMaxMinAbsNonzero( B, maxAbsValsB, minAbsValsB );
         const Int localWidth = maxAbsValsA.LocalHeight();
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            maxAbsValsALoc(jLoc) =
+        {
+            const Real maxAbs =
               Max(maxAbsValsALoc(jLoc),maxAbsValsBLoc(jLoc));
-        ColumnMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
-        ColumnMinAbsNonzero( B, maxAbsValsA, minAbsValsB );
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            minAbsValsALoc(jLoc) =
-              Min(minAbsValsALoc(jLoc),minAbsValsBLoc(jLoc));
+            Real minAbs = maxAbs;
+            if( maxAbsValsALoc(jLoc) > Real(0) )
+                minAbs = Min(minAbs,minAbsValsALoc(jLoc));
+            if( maxAbsValsBLoc(jLoc) > Real(0) )
+                minAbs = Min(minAbs,minAbsValsBLoc(jLoc));
+            maxAbsValsALoc(jLoc) = maxAbs;
+            minAbsValsALoc(jLoc) = minAbs;
+        }
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
         {
             const Real maxAbs = maxAbsValsALoc(jLoc);
@@ -953,9 +969,14 @@ void StackedGeomEquil
 
         // Geometrically rescale the rows
         // ------------------------------
+        // The extrema of the rescaled matrices follow arithmetically from
+        // the row statistics, so the convergence test below only requires a
+        // pair of scalar AllReduces rather than further passes over the
+        // entries
+        Real newMaxAbsVal = 0;
+        Real newMinAbsVal = limits::Max<Real>();
         scales.Resize( mA, 1 );
-        RowMaxNorms( A, maxAbsValsA );
-        ColumnMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
+        RowMaxMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
         const Int localHeightA = maxAbsValsA.LocalHeight();
         for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
         {
@@ -966,6 +987,8 @@ void StackedGeomEquil
                 const Real propScale = Sqrt(minAbs*maxAbs);
                 const Real scale = Max(propScale,sqrtDamp*maxAbs);
                 scalesLoc(iLoc) = scale;
+                newMaxAbsVal = Max(newMaxAbsVal,maxAbs/scale);
+                newMinAbsVal = Min(newMinAbsVal,minAbs/scale);
             }
             else
                 scalesLoc(iLoc) = 1;
@@ -974,8 +997,7 @@ void StackedGeomEquil
         DiagonalSolve( LEFT, NORMAL, scales, A );
 
         scales.Resize( mB, 1 );
-        RowMaxNorms( B, maxAbsValsB );
-        ColumnMinAbsNonzero( B, maxAbsValsB, minAbsValsB );
+        RowMaxMinAbsNonzero( B, maxAbsValsB, minAbsValsB );
         const Int localHeightB = maxAbsValsB.LocalHeight();
         for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
         {
@@ -986,6 +1008,8 @@ void StackedGeomEquil
                 const Real propScale = Sqrt(minAbs*maxAbs);
                 const Real scale = Max(propScale,sqrtDamp*maxAbs);
                 scalesLoc(iLoc) = scale;
+                newMaxAbsVal = Max(newMaxAbsVal,maxAbs/scale);
+                newMinAbsVal = Min(newMinAbsVal,minAbs/scale);
             }
             else
                 scalesLoc(iLoc) = 1;
@@ -995,12 +1019,8 @@ void StackedGeomEquil
 
         // Determine whether we are done or not
         // ------------------------------------
-        auto newMaxAbsA = MaxAbsLoc( A );
-        auto newMaxAbsB = MaxAbsLoc( B );
-        const Real newMaxAbsVal = Max(newMaxAbsA.value,newMaxAbsB.value);
-        const Real newMinAbsValA = MinAbsNonzero( A, newMaxAbsVal );
-        const Real newMinAbsValB = MinAbsNonzero( B, newMaxAbsVal );
-        const Real newMinAbsVal = Min(newMinAbsValA,newMinAbsValB);
+        newMaxAbsVal = mpi::AllReduce( newMaxAbsVal, mpi::MAX, grid.Comm() );
+        newMinAbsVal = mpi::AllReduce( newMinAbsVal, mpi::MIN, grid.Comm() );
         const Real newRatio = newMaxAbsVal / newMinAbsVal;
         if( progress && commRank == 0 )
             Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Util.hpp"
 
 namespace El {
 
@@ -105,17 +106,21 @@ void SymmetricRuizEquil
     const Int n = A.Height();
     Ones( d, n, 1 );
 
-    Matrix<Real> scales;
+    // Since the column norms of the rescaled matrix are measured within the
+    // rescaling sweeps themselves, only the initial measurement requires a
+    // pass over the matrix of its own
+    Matrix<Real> scales, newScales;
+    ColumnMaxNorms( A, scales );
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Rescale the columns (and rows)
         // ------------------------------
-        ColumnMaxNorms( A, scales );
         EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
         EntrywiseMap( scales, MakeFunction(SquareRootScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, scales, d );
-        SymmetricDiagonalSolve( scales, A );
+        SymmetricDiagonalSolveAndColumnMaxNorms( scales, A, newScales );
+        scales = newScales;
     }
     SetIndent( indent );
 }
@@ -133,17 +138,21 @@ void SymmetricRuizEquil
     d.SetGrid( grid );
     Ones( d, n, 1 );
 
-    DistMultiVec<Real> scales(grid);
+    // As in the sequential sparse case, fold the norm measurements into the
+    // rescaling sweeps so that each iteration only traverses the local
+    // entries once
+    DistMultiVec<Real> scales(grid), newScales(grid);
+    ColumnMaxNorms( A, scales );
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Rescale the columns (and rows)
         // ------------------------------
-        ColumnMaxNorms( A, scales );
         EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
         EntrywiseMap( scales, MakeFunction(SquareRootScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, scales, d );
-        SymmetricDiagonalSolve( scales, A );
+        SymmetricDiagonalSolveAndColumnMaxNorms( scales, A, newScales );
+        scales = newScales;
     }
     SetIndent( indent );
 }
@@ -81,6 +81,247 @@ MinAbsNonzero( const DistSparseMatrix<Field>& A, Base<Field> upperBound )
     return mpi::AllReduce( minLocAbs, mpi::MIN, A.Grid().Comm() );
 }
 
+// Fused statistics sweeps for the equilibration iterations
+// ========================================================
+// Each of the following kernels combines a pair of full passes over a
+// sparse matrix into a single pass so that the cost of an equilibration
+// iteration is dominated by applying the scaling rather than by repeatedly
+// measuring norms.
+
+// On return, maxAbsVals(j) is the largest entry magnitude in column j and
+// minAbsVals(j) is the smallest nonzero magnitude in column j (or zero if
+// the column is empty)
+template<typename Field>
+void ColumnMaxMinAbsNonzero
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& maxAbsVals,
+        Matrix<Base<Field>>& minAbsVals )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Width();
+    maxAbsVals.Resize( n, 1 );
+    minAbsVals.Resize( n, 1 );
+    Zero( maxAbsVals );
+    Fill( minAbsVals, limits::Max<Real>() );
+    const Int numEntries = A.NumEntries();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Field* values = A.LockedValueBuffer();
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int j = colBuf[e];
+        const Real absVal = Abs(values[e]);
+        maxAbsVals(j) = Max(maxAbsVals(j),absVal);
+        if( absVal > Real(0) )
+            minAbsVals(j) = Min(minAbsVals(j),absVal);
+    }
+    for( Int j=0; j<n; ++j )
+        if( maxAbsVals(j) == Real(0) )
+            minAbsVals(j) = 0;
+}
+
+template<typename Field>
+void ColumnMaxMinAbsNonzero
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Base<Field>>& maxAbsVals,
+        DistMultiVec<Base<Field>>& minAbsVals )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    maxAbsVals.Resize( A.Width(), 1 );
+    minAbsVals.Resize( A.Width(), 1 );
+    Zero( maxAbsVals );
+    Fill( minAbsVals, limits::Max<Real>() );
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+
+    // Accumulate both extrema in a single local sweep
+    // -----------------------------------------------
+    vector<Real> sendMaxVals( meta.numRecvInds, 0 ),
+                 sendMinVals( meta.numRecvInds, limits::Max<Real>() );
+    const Int numEntries = A.NumLocalEntries();
+    const Field* values = A.LockedValueBuffer();
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int jOff = meta.colOffs[e];
+        const Real absVal = Abs(values[e]);
+        sendMaxVals[jOff] = Max(sendMaxVals[jOff],absVal);
+        if( absVal > Real(0) )
+            sendMinVals[jOff] = Min(sendMinVals[jOff],absVal);
+    }
+
+    // Inject the updates into the network
+    // -----------------------------------
+    const Int numRecvInds = meta.sendInds.size();
+    vector<Real> recvMaxVals( numRecvInds ), recvMinVals( numRecvInds );
+    mpi::AllToAll
+    ( sendMaxVals.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      recvMaxVals.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      A.Grid().Comm() );
+    mpi::AllToAll
+    ( sendMinVals.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      recvMinVals.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      A.Grid().Comm() );
+
+    // Fold in all of the values received
+    // ----------------------------------
+    const Int firstLocalRow = maxAbsVals.FirstLocalRow();
+    auto& maxAbsValsLoc = maxAbsVals.Matrix();
+    auto& minAbsValsLoc = minAbsVals.Matrix();
+    for( Int s=0; s<numRecvInds; ++s )
+    {
+        const Int jLoc = meta.sendInds[s] - firstLocalRow;
+        maxAbsValsLoc(jLoc) = Max(maxAbsValsLoc(jLoc),recvMaxVals[s]);
+        minAbsValsLoc(jLoc) = Min(minAbsValsLoc(jLoc),recvMinVals[s]);
+    }
+    const Int localWidth = maxAbsVals.LocalHeight();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        if( maxAbsValsLoc(jLoc) == Real(0) )
+            minAbsValsLoc(jLoc) = 0;
+}
+
+template<typename Field>
+void RowMaxMinAbsNonzero
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& maxAbsVals,
+        Matrix<Base<Field>>& minAbsVals )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Field* valBuf = A.LockedValueBuffer();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    maxAbsVals.Resize( m, 1 );
+    minAbsVals.Resize( m, 1 );
+    for( Int i=0; i<m; ++i )
+    {
+        Real rowMax = 0;
+        Real rowMin = limits::Max<Real>();
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+        {
+            const Real absVal = Abs(valBuf[e]);
+            rowMax = Max(rowMax,absVal);
+            if( absVal > Real(0) )
+                rowMin = Min(rowMin,absVal);
+        }
+        maxAbsVals(i) = rowMax;
+        minAbsVals(i) = ( rowMax > Real(0) ? rowMin : Real(0) );
+    }
+}
+
+template<typename Field>
+void RowMaxMinAbsNonzero
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Base<Field>>& maxAbsVals,
+        DistMultiVec<Base<Field>>& minAbsVals )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int localHeight = A.LocalHeight();
+    const Field* valBuf = A.LockedValueBuffer();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    maxAbsVals.Resize( A.Height(), 1 );
+    minAbsVals.Resize( A.Height(), 1 );
+    auto& maxAbsValsLoc = maxAbsVals.Matrix();
+    auto& minAbsValsLoc = minAbsVals.Matrix();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        Real rowMax = 0;
+        Real rowMin = limits::Max<Real>();
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+        {
+            const Real absVal = Abs(valBuf[e]);
+            rowMax = Max(rowMax,absVal);
+            if( absVal > Real(0) )
+                rowMin = Min(rowMin,absVal);
+        }
+        maxAbsValsLoc(iLoc) = rowMax;
+        minAbsValsLoc(iLoc) = ( rowMax > Real(0) ? rowMin : Real(0) );
+    }
+}
+
+// Apply the congruence A := inv(D) A inv(D), where D = diag(d), and measure
+// the column norms of the rescaled matrix while its entries are in cache
+template<typename Field>
+void SymmetricDiagonalSolveAndColumnMaxNorms
+( const Matrix<Base<Field>>& d,
+        SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& norms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    norms.Resize( A.Width(), 1 );
+    Zero( norms );
+    const Int numEntries = A.NumEntries();
+    Field* vBuf = A.ValueBuffer();
+    const Int* rowBuf = A.LockedSourceBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* dBuf = d.LockedBuffer();
+    for( Int k=0; k<numEntries; ++k )
+    {
+        const Int i = rowBuf[k];
+        const Int j = colBuf[k];
+        vBuf[k] /= dBuf[i]*dBuf[j];
+        norms(j) = Max(norms(j),Abs(vBuf[k]));
+    }
+}
+
+template<typename Field>
+void SymmetricDiagonalSolveAndColumnMaxNorms
+( const DistMultiVec<Base<Field>>& d,
+        DistSparseMatrix<Field>& A,
+        DistMultiVec<Base<Field>>& norms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    norms.Resize( A.Width(), 1 );
+    Zero( norms );
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+
+    // Pull in the nonlocal scale factors
+    // ----------------------------------
+    const Int numSendInds = meta.sendInds.size();
+    const Int firstLocalRow = d.FirstLocalRow();
+    const Real* dBuf = d.LockedMatrix().LockedBuffer();
+    vector<Real> sendScales( numSendInds );
+    for( Int s=0; s<numSendInds; ++s )
+        sendScales[s] = dBuf[meta.sendInds[s]-firstLocalRow];
+    vector<Real> recvScales( meta.numRecvInds );
+    mpi::AllToAll
+    ( sendScales.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      recvScales.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      A.Grid().Comm() );
+
+    // Rescale the entries and accumulate the local column maxima
+    // ----------------------------------------------------------
+    const Int numEntries = A.NumLocalEntries();
+    Field* vBuf = A.ValueBuffer();
+    const Int* rBuf = A.LockedSourceBuffer();
+    vector<Real> sendMaxVals( meta.numRecvInds, 0 );
+    for( Int k=0; k<numEntries; ++k )
+    {
+        const Int iLoc = rBuf[k] - firstLocalRow;
+        const Int jOff = meta.colOffs[k];
+        vBuf[k] /= recvScales[jOff]*dBuf[iLoc];
+        sendMaxVals[jOff] = Max(sendMaxVals[jOff],Abs(vBuf[k]));
+    }
+
+    // Push the maxima back to the owners of each column
+    // -------------------------------------------------
+    vector<Real> recvMaxVals( numSendInds );
+    mpi::AllToAll
+    ( sendMaxVals.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      recvMaxVals.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      A.Grid().Comm() );
+    auto& normsLoc = norms.Matrix();
+    for( Int s=0; s<numSendInds; ++s )
+    {
+        const Int jLoc = meta.sendInds[s] - firstLocalRow;
+        normsLoc(jLoc) = Max(normsLoc(jLoc),recvMaxVals[s]);
+    }
+}
+
 template<typename Field,Dist U,Dist V>
 void GeometricColumnScaling
 ( const DistMatrix<Field,      U,V   >& A,
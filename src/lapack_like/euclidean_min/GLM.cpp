@@ -183,6 +183,152 @@ void Overwrite
 
 } // namespace glm
 
+// Factored-state solvers
+// ======================
+
+template<typename F>
+void GLMFactorization<F>::Factor( const Matrix<F>& A, const Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    m_ = A.Height();
+    n_ = A.Width();
+    p_ = B.Width();
+    if( m_ != B.Height() )
+        LogicError("A and B must be the same height");
+    if( m_ < n_ )
+        LogicError("GLM requires height(A) >= width(A)");
+    if( n_+p_ < m_ )
+        LogicError("GLM requires width(A)+width(B) >= height(A)");
+
+    // Compute the implicit Generalized QR decomposition of (A,B)
+    A_ = A;
+    B_ = B;
+    GQR( A_, tA_, dA_, B_, tB_, dB_ );
+    factored_ = true;
+}
+
+template<typename F>
+void GLMFactorization<F>::Solve
+( const Matrix<F>& D,
+        Matrix<F>& X,
+        Matrix<F>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor() must be called before Solve()");
+    const Int numRhs = D.Width();
+    if( m_ != D.Height() )
+        LogicError("A and D must be the same height");
+    const bool checkIfSingular = true;
+
+    // G := Q^H D
+    Matrix<F> G( D );
+    qr::ApplyQ( LEFT, ADJOINT, A_, tA_, dA_, G );
+
+    // Partition the relevant matrices
+    auto G1 = G( IR(0,n_),  ALL );
+    auto G2 = G( IR(n_,m_), ALL );
+    auto R11 = A_( IR(0,n_),  IR(0,n_) );
+    auto T12 = B_( IR(0,n_),  IR(n_+p_-m_,p_) );
+    auto T22 = B_( IR(n_,m_), IR(n_+p_-m_,p_) );
+    Zeros( Y, p_, numRhs );
+    auto C2 = Y( IR(n_+p_-m_,p_), ALL );
+
+    // Solve T22 C2 = G2
+    C2 = G2;
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T22, C2, checkIfSingular );
+
+    // G1 := G1 - T12 C2
+    Gemm( NORMAL, NORMAL, F(-1), T12, C2, F(1), G1 );
+
+    // Solve R11 X = G1
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, G1, checkIfSingular );
+    X = G1;
+
+    // Y := Z^H C
+    rq::ApplyQ( LEFT, ADJOINT, B_, tB_, dB_, Y );
+}
+
+template<typename F>
+void DistGLMFactorization<F>::Factor
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    m_ = A.Height();
+    n_ = A.Width();
+    p_ = B.Width();
+    if( m_ != B.Height() )
+        LogicError("A and B must be the same height");
+    if( m_ < n_ )
+        LogicError("GLM requires height(A) >= width(A)");
+    if( n_+p_ < m_ )
+        LogicError("GLM requires width(A)+width(B) >= height(A)");
+    const Grid& g = A.Grid();
+    if( g != B.Grid() )
+        LogicError("All matrices must have the same grid");
+
+    // Compute the implicit Generalized QR decomposition of (A,B)
+    A_.SetGrid( g ); B_.SetGrid( g );
+    tA_.SetGrid( g ); tB_.SetGrid( g );
+    dA_.SetGrid( g ); dB_.SetGrid( g );
+    Copy( A, A_ );
+    Copy( B, B_ );
+    GQR( A_, tA_, dA_, B_, tB_, dB_ );
+    factored_ = true;
+}
+
+template<typename F>
+void DistGLMFactorization<F>::Solve
+( const AbstractDistMatrix<F>& DPre,
+        AbstractDistMatrix<F>& XPre,
+        AbstractDistMatrix<F>& YPre ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor() must be called before Solve()");
+
+    DistMatrixReadProxy<F,F,MC,MR> DProx( DPre );
+    DistMatrixWriteProxy<F,F,MC,MR>
+      XProx( XPre ),
+      YProx( YPre );
+    auto& D = DProx.GetLocked();
+    auto& X = XProx.Get();
+    auto& Y = YProx.Get();
+
+    const Int numRhs = D.Width();
+    if( m_ != D.Height() )
+        LogicError("A and D must be the same height");
+    const bool checkIfSingular = true;
+
+    // G := Q^H D
+    DistMatrix<F> G( D );
+    qr::ApplyQ( LEFT, ADJOINT, A_, tA_, dA_, G );
+
+    // Partition the relevant matrices
+    auto G1 = G( IR(0,n_),  ALL );
+    auto G2 = G( IR(n_,m_), ALL );
+    auto R11 = A_( IR(0,n_),  IR(0,n_) );
+    auto T12 = B_( IR(0,n_),  IR(n_+p_-m_,p_) );
+    auto T22 = B_( IR(n_,m_), IR(n_+p_-m_,p_) );
+    Zeros( Y, p_, numRhs );
+    auto C2 = Y( IR(n_+p_-m_,p_), ALL );
+
+    // Solve T22 C2 = G2
+    C2 = G2;
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T22, C2, checkIfSingular );
+
+    // G1 := G1 - T12 C2
+    Gemm( NORMAL, NORMAL, F(-1), T12, C2, F(1), G1 );
+
+    // Solve R11 X = G1
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, G1, checkIfSingular );
+    X = G1;
+
+    // Y := Z^H C
+    rq::ApplyQ( LEFT, ADJOINT, B_, tB_, dB_, Y );
+}
+
 template<typename F>
 void GLM
 ( const Matrix<F>& A,
@@ -434,6 +580,8 @@ void GLM
     AbstractDistMatrix<F>& B, \
     AbstractDistMatrix<F>& D, \
     AbstractDistMatrix<F>& Y ); \
+  template class GLMFactorization<F>; \
+  template class DistGLMFactorization<F>; \
   template void GLM \
   ( const Matrix<F>& A, \
     const Matrix<F>& B, \
@@ -271,6 +271,161 @@ void Overwrite
 
 } // namespace lse
 
+// Factored-state solvers
+// ======================
+
+template<typename F>
+void LSEFactorization<F>::Factor( const Matrix<F>& A, const Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    m_ = A.Height();
+    n_ = A.Width();
+    p_ = B.Height();
+    if( n_ < p_ )
+        LogicError("LSE requires width(A) >= height(B)");
+    if( m_+p_ < n_ )
+        LogicError("LSE requires height(A)+height(B) >= width(A)");
+
+    // Compute the implicit Generalized RQ decomposition of (B,A)
+    A_ = A;
+    B_ = B;
+    GRQ( B_, tB_, dB_, A_, tA_, dA_ );
+    factored_ = true;
+}
+
+template<typename F>
+void LSEFactorization<F>::Solve
+( const Matrix<F>& C,
+  const Matrix<F>& D,
+        Matrix<F>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor() must be called before Solve()");
+    const Int numRhs = D.Width();
+    if( m_ != C.Height() )
+        LogicError("A and C must be the same height");
+    if( p_ != D.Height() )
+        LogicError("B and D must be the same height");
+    if( numRhs != C.Width() )
+        LogicError("C and D must be the same width");
+    const bool checkIfSingular = true;
+
+    // G := Z^H C
+    Matrix<F> G( C );
+    qr::ApplyQ( LEFT, ADJOINT, A_, tA_, dA_, G );
+
+    // Partition the relevant matrices
+    Zeros( X, n_, numRhs );
+    auto ind1 = IR(0,n_-p_);
+    auto ind2 = IR(n_-p_,n_);
+    auto Y1 = X( ind1, ALL );
+    auto Y2 = X( ind2, ALL );
+    auto T12 = B_( ALL, ind2 );
+    auto R11 = A_( ind1, ind1 );
+    auto R12 = A_( ind1, ind2 );
+    auto G1 = G( ind1, ALL );
+
+    // Solve T12 Y2 = D
+    Y2 = D;
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T12, Y2, checkIfSingular );
+
+    // G1 := G1 - R12 Y2
+    Gemm( NORMAL, NORMAL, F(-1), R12, Y2, F(1), G1 );
+
+    // Solve R11 Y1 = G1
+    Y1 = G1;
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, Y1, checkIfSingular );
+
+    // X := Q^H Y
+    rq::ApplyQ( LEFT, ADJOINT, B_, tB_, dB_, X );
+}
+
+template<typename F>
+void DistLSEFactorization<F>::Factor
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    m_ = A.Height();
+    n_ = A.Width();
+    p_ = B.Height();
+    if( n_ < p_ )
+        LogicError("LSE requires width(A) >= height(B)");
+    if( m_+p_ < n_ )
+        LogicError("LSE requires height(A)+height(B) >= width(A)");
+    const Grid& g = A.Grid();
+    if( g != B.Grid() )
+        LogicError("All matrices must be distributed over the same grid");
+
+    // Compute the implicit Generalized RQ decomposition of (B,A)
+    A_.SetGrid( g ); B_.SetGrid( g );
+    tA_.SetGrid( g ); tB_.SetGrid( g );
+    dA_.SetGrid( g ); dB_.SetGrid( g );
+    Copy( A, A_ );
+    Copy( B, B_ );
+    GRQ( B_, tB_, dB_, A_, tA_, dA_ );
+    factored_ = true;
+}
+
+template<typename F>
+void DistLSEFactorization<F>::Solve
+( const AbstractDistMatrix<F>& CPre,
+  const AbstractDistMatrix<F>& DPre,
+        AbstractDistMatrix<F>& XPre ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor() must be called before Solve()");
+
+    DistMatrixReadProxy<F,F,MC,MR>
+      CProx( CPre ),
+      DProx( DPre );
+    DistMatrixWriteProxy<F,F,MC,MR>
+      XProx( XPre );
+    auto& C = CProx.GetLocked();
+    auto& D = DProx.GetLocked();
+    auto& X = XProx.Get();
+
+    const Int numRhs = D.Width();
+    if( m_ != C.Height() )
+        LogicError("A and C must be the same height");
+    if( p_ != D.Height() )
+        LogicError("B and D must be the same height");
+    if( numRhs != C.Width() )
+        LogicError("C and D must be the same width");
+    const bool checkIfSingular = true;
+
+    // G := Z^H C
+    DistMatrix<F> G( C );
+    qr::ApplyQ( LEFT, ADJOINT, A_, tA_, dA_, G );
+
+    // Partition the relevant matrices
+    Zeros( X, n_, numRhs );
+    auto ind1 = IR(0,n_-p_);
+    auto ind2 = IR(n_-p_,n_);
+    auto Y1 = X( ind1, ALL );
+    auto Y2 = X( ind2, ALL );
+    auto T12 = B_( ALL, ind2 );
+    auto R11 = A_( ind1, ind1 );
+    auto R12 = A_( ind1, ind2 );
+    auto G1 = G( ind1, ALL );
+
+    // Solve T12 Y2 = D
+    Y2 = D;
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T12, Y2, checkIfSingular );
+
+    // G1 := G1 - R12 Y2
+    Gemm( NORMAL, NORMAL, F(-1), R12, Y2, F(1), G1 );
+
+    // Solve R11 Y1 = G1
+    Y1 = G1;
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, Y1, checkIfSingular );
+
+    // X := Q^H Y
+    rq::ApplyQ( LEFT, ADJOINT, B_, tB_, dB_, X );
+}
+
 template<typename F>
 void LSE
 ( const Matrix<F>& A,
@@ -522,6 +677,8 @@ void LSE
     AbstractDistMatrix<F>& C, \
     AbstractDistMatrix<F>& D, \
     AbstractDistMatrix<F>& X, bool computeResidual ); \
+  template class LSEFactorization<F>; \
+  template class DistLSEFactorization<F>; \
   template void LSE \
   ( const Matrix<F>& A, \
     const Matrix<F>& B, \
@@ -67,6 +67,29 @@ void Overwrite
     }
 }
 
+namespace {
+
+// Estimate the condition number of op(A) from the diagonal of the Cholesky
+// factor of its Gram matrix (the ratio of the extreme diagonal entries is a
+// lower bound which is typically sharp enough for method selection)
+template<typename Real>
+Real GramCondEstimate( const Matrix<Real>& d )
+{
+    const Int n = d.Height();
+    Real maxDiag = Real(0);
+    Real minDiag = limits::Max<Real>();
+    for( Int j=0; j<n; ++j )
+    {
+        maxDiag = Max( maxDiag, d(j) );
+        minDiag = Min( minDiag, d(j) );
+    }
+    if( minDiag <= Real(0) )
+        return limits::Max<Real>();
+    return maxDiag / minDiag;
+}
+
+} // anonymous namespace
+
 } // namespace ls
 
 template<typename F>
@@ -74,23 +97,192 @@ void LeastSquares
 ( Orientation orientation,
   const Matrix<F>& A,
   const Matrix<F>& B,
-        Matrix<F>& X )
+        Matrix<F>& X,
+  LeastSquaresAlg alg )
 {
     EL_DEBUG_CSE
-    Matrix<F> ACopy( A );
-    ls::Overwrite( orientation, ACopy, B, X );
+    typedef Base<F> Real;
+
+    const bool normal = ( orientation==NORMAL );
+    const Int m = ( normal ? A.Height() : A.Width()  );
+    const Int n = ( normal ? A.Width()  : A.Height() );
+    // The Gram-matrix approaches below only apply to overdetermined systems
+    // (and conjugation-free orientations)
+    const bool gramApplies =
+      m >= n && !(orientation==TRANSPOSE && IsComplex<F>::value);
+
+    if( alg == LEAST_SQUARES_QR ||
+        (alg == LEAST_SQUARES_AUTO && !gramApplies) )
+    {
+        Matrix<F> ACopy( A );
+        ls::Overwrite( orientation, ACopy, B, X );
+        return;
+    }
+    if( !gramApplies )
+        LogicError
+        ("Normal-equations least squares requires an overdetermined system");
+
+    // Form the Gram matrix, G := op(A)^H op(A), and X := op(A)^H B
+    Matrix<F> G;
+    if( normal )
+    {
+        Herk( LOWER, ADJOINT, Real(1), A, G );
+        Gemm( ADJOINT, NORMAL, F(1), A, B, X );
+    }
+    else
+    {
+        Herk( LOWER, NORMAL, Real(1), A, G );
+        Gemm( NORMAL, NORMAL, F(1), A, B, X );
+    }
+
+    bool refine = ( alg == LEAST_SQUARES_SEMI_NORMAL );
+    if( alg == LEAST_SQUARES_AUTO )
+    {
+        // A conditioning of op(A) near 1/sqrt(eps) squares to the working
+        // precision within the Gram matrix and forces the QR fallback,
+        // while moderate conditioning merely requests a refinement step
+        bool fallback = false;
+        try { Cholesky( LOWER, G ); }
+        catch( std::exception& e ) { fallback = true; }
+        if( !fallback )
+        {
+            Matrix<Real> d;
+            GetRealPartOfDiagonal( G, d );
+            const Real condEst = ls::GramCondEstimate( d );
+            const Real eps = limits::Epsilon<Real>();
+            if( condEst >= Real(1)/(Real(10)*Sqrt(eps)) )
+                fallback = true;
+            else if( condEst >= Pow(eps,Real(-0.25)) )
+                refine = true;
+        }
+        if( fallback )
+        {
+            Matrix<F> ACopy( A );
+            ls::Overwrite( orientation, ACopy, B, X );
+            return;
+        }
+    }
+    else
+        Cholesky( LOWER, G );
+
+    cholesky::SolveAfter( LOWER, NORMAL, G, X );
+
+    if( refine )
+    {
+        // One step of residual refinement in the working precision (the
+        // "corrected semi-normal equations"):
+        //   X := X + (op(A)^H op(A))^{-1} op(A)^H (B - op(A) X)
+        Matrix<F> R( B ), dX;
+        Gemm( orientation, NORMAL, F(-1), A, X, F(1), R );
+        if( normal )
+            Gemm( ADJOINT, NORMAL, F(1), A, R, dX );
+        else
+            Gemm( NORMAL, NORMAL, F(1), A, R, dX );
+        cholesky::SolveAfter( LOWER, NORMAL, G, dX );
+        Axpy( F(1), dX, X );
+    }
 }
 
 template<typename F>
 void LeastSquares
 ( Orientation orientation,
-  const AbstractDistMatrix<F>& A,
-  const AbstractDistMatrix<F>& B,
-        AbstractDistMatrix<F>& X )
+  const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& BPre,
+        AbstractDistMatrix<F>& XPre,
+  LeastSquaresAlg alg )
 {
     EL_DEBUG_CSE
-    DistMatrix<F> ACopy( A );
-    ls::Overwrite( orientation, ACopy, B, X );
+    typedef Base<F> Real;
+
+    DistMatrixReadProxy<F,F,MC,MR>
+      AProx( APre ),
+      BProx( BPre );
+    DistMatrixWriteProxy<F,F,MC,MR>
+      XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& X = XProx.Get();
+
+    const bool normal = ( orientation==NORMAL );
+    const Int m = ( normal ? A.Height() : A.Width()  );
+    const Int n = ( normal ? A.Width()  : A.Height() );
+    // The Gram-matrix approaches below only apply to overdetermined systems
+    // (and conjugation-free orientations)
+    const bool gramApplies =
+      m >= n && !(orientation==TRANSPOSE && IsComplex<F>::value);
+
+    if( alg == LEAST_SQUARES_QR ||
+        (alg == LEAST_SQUARES_AUTO && !gramApplies) )
+    {
+        DistMatrix<F> ACopy( A );
+        ls::Overwrite( orientation, ACopy, B, X );
+        return;
+    }
+    if( !gramApplies )
+        LogicError
+        ("Normal-equations least squares requires an overdetermined system");
+
+    // Form the Gram matrix, G := op(A)^H op(A), and X := op(A)^H B
+    DistMatrix<F> G(A.Grid());
+    if( normal )
+    {
+        Herk( LOWER, ADJOINT, Real(1), A, G );
+        Gemm( ADJOINT, NORMAL, F(1), A, B, X );
+    }
+    else
+    {
+        Herk( LOWER, NORMAL, Real(1), A, G );
+        Gemm( NORMAL, NORMAL, F(1), A, B, X );
+    }
+
+    bool refine = ( alg == LEAST_SQUARES_SEMI_NORMAL );
+    if( alg == LEAST_SQUARES_AUTO )
+    {
+        // A conditioning of op(A) near 1/sqrt(eps) squares to the working
+        // precision within the Gram matrix and forces the QR fallback,
+        // while moderate conditioning merely requests a refinement step.
+        // (The diagonal blocks are factored redundantly, so a failed
+        // factorization throws consistently across the grid.)
+        bool fallback = false;
+        try { Cholesky( LOWER, G ); }
+        catch( std::exception& e ) { fallback = true; }
+        if( !fallback )
+        {
+            DistMatrix<Real,STAR,STAR> d(A.Grid());
+            GetRealPartOfDiagonal( G, d );
+            const Real condEst = ls::GramCondEstimate( d.LockedMatrix() );
+            const Real eps = limits::Epsilon<Real>();
+            if( condEst >= Real(1)/(Real(10)*Sqrt(eps)) )
+                fallback = true;
+            else if( condEst >= Pow(eps,Real(-0.25)) )
+                refine = true;
+        }
+        if( fallback )
+        {
+            DistMatrix<F> ACopy( A );
+            ls::Overwrite( orientation, ACopy, B, X );
+            return;
+        }
+    }
+    else
+        Cholesky( LOWER, G );
+
+    cholesky::SolveAfter( LOWER, NORMAL, G, X );
+
+    if( refine )
+    {
+        // One step of residual refinement in the working precision (the
+        // "corrected semi-normal equations"):
+        //   X := X + (op(A)^H op(A))^{-1} op(A)^H (B - op(A) X)
+        DistMatrix<F> R( B ), dX(A.Grid());
+        Gemm( orientation, NORMAL, F(-1), A, X, F(1), R );
+        if( normal )
+            Gemm( ADJOINT, NORMAL, F(1), A, R, dX );
+        else
+            Gemm( NORMAL, NORMAL, F(1), A, R, dX );
+        cholesky::SolveAfter( LOWER, NORMAL, G, dX );
+        Axpy( F(1), dX, X );
+    }
 }
 
 // The following routines solve either
@@ -503,12 +695,14 @@ void LeastSquares
   ( Orientation orientation, \
     const Matrix<F>& A, \
     const Matrix<F>& B, \
-          Matrix<F>& X ); \
+          Matrix<F>& X, \
+    LeastSquaresAlg alg ); \
   template void LeastSquares \
   ( Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& B, \
-          AbstractDistMatrix<F>& X ); \
+          AbstractDistMatrix<F>& X, \
+    LeastSquaresAlg alg ); \
   template void LeastSquares \
   ( Orientation orientation, \
     const SparseMatrix<F>& A, \
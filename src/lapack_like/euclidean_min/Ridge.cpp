@@ -196,6 +196,143 @@ void Ridge
     }
 }
 
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const vector<Base<Field>>& gammas,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    const bool normal = ( orientation==NORMAL );
+    const Int m = ( normal ? A.Height() : A.Width()  );
+    const Int n = ( normal ? A.Width()  : A.Height() );
+    const Int numRHS = B.Width();
+    const Int numGammas = gammas.size();
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Transpose version of complex RidgePath not yet supported");
+    if( m < n )
+        LogicError("This case not yet supported");
+
+    // A single SVD of A is shared by the entire regularization path
+    Matrix<Field> U, V;
+    Matrix<Real> s;
+    if( orientation == NORMAL )
+    {
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = false;
+        SVD( A, U, s, V, ctrl );
+    }
+    else
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = true;
+        SVD( AAdj, U, s, V, ctrl );
+    }
+
+    // C := U^H B is likewise independent of gamma
+    Matrix<Field> C;
+    Gemm( ADJOINT, NORMAL, Field(1), U, B, C );
+
+    // Each solution only requires diagonally rescaling C and multiplying
+    // by V
+    Zeros( X, n, numRHS*numGammas );
+    Matrix<Real> sMapped;
+    Matrix<Field> CScaled;
+    for( Int j=0; j<numGammas; ++j )
+    {
+        const Real gamma = gammas[j];
+        auto sigmaMap =
+          [=]( const Real& sigma )
+          { return sigma / (sigma*sigma + gamma*gamma); };
+        sMapped = s;
+        EntrywiseMap( sMapped, MakeFunction(sigmaMap) );
+        CScaled = C;
+        DiagonalScale( LEFT, NORMAL, sMapped, CScaled );
+        auto Xj = X( ALL, IR(j*numRHS,(j+1)*numRHS) );
+        Gemm( NORMAL, NORMAL, Field(1), V, CScaled, Field(0), Xj );
+    }
+}
+
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& BPre,
+  const vector<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>& XPre )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadProxy<Field,Field,MC,MR>
+      AProx( APre ),
+      BProx( BPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR>
+      XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& X = XProx.Get();
+
+    const bool normal = ( orientation==NORMAL );
+    const Int m = ( normal ? A.Height() : A.Width()  );
+    const Int n = ( normal ? A.Width()  : A.Height() );
+    const Int numRHS = B.Width();
+    const Int numGammas = gammas.size();
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Transpose version of complex RidgePath not yet supported");
+    if( m < n )
+        LogicError("This case not yet supported");
+
+    // A single SVD of A is shared by the entire regularization path
+    DistMatrix<Field> U(A.Grid()), V(A.Grid());
+    DistMatrix<Real,VR,STAR> s(A.Grid());
+    if( orientation == NORMAL )
+    {
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = false;
+        SVD( A, U, s, V, ctrl );
+    }
+    else
+    {
+        DistMatrix<Field> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = true;
+        SVD( AAdj, U, s, V, ctrl );
+    }
+
+    // C := U^H B is likewise independent of gamma
+    DistMatrix<Field> C(A.Grid());
+    Gemm( ADJOINT, NORMAL, Field(1), U, B, C );
+
+    // Each solution only requires diagonally rescaling C and multiplying
+    // by V
+    Zeros( X, n, numRHS*numGammas );
+    DistMatrix<Real,VR,STAR> sMapped(A.Grid());
+    DistMatrix<Field> CScaled(A.Grid());
+    for( Int j=0; j<numGammas; ++j )
+    {
+        const Real gamma = gammas[j];
+        auto sigmaMap =
+          [=]( const Real& sigma )
+          { return sigma / (sigma*sigma + gamma*gamma); };
+        sMapped = s;
+        EntrywiseMap( sMapped, MakeFunction(sigmaMap) );
+        CScaled = C;
+        DiagonalScale( LEFT, NORMAL, sMapped, CScaled );
+        auto Xj = X( ALL, IR(j*numRHS,(j+1)*numRHS) );
+        Gemm( NORMAL, NORMAL, Field(1), V, CScaled, Field(0), Xj );
+    }
+}
+
 template<typename Field>
 void Ridge
 ( Orientation orientation,
@@ -257,6 +394,18 @@ void Ridge
           Base<Field> gamma, \
           AbstractDistMatrix<Field>& X, \
           RidgeAlg alg ); \
+  template void RidgePath \
+  ( Orientation orientation, \
+    const Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+    const vector<Base<Field>>& gammas, \
+          Matrix<Field>& X ); \
+  template void RidgePath \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+    const vector<Base<Field>>& gammas, \
+          AbstractDistMatrix<Field>& X ); \
   template void Ridge \
   ( Orientation orientation, \
     const SparseMatrix<Field>& A, \
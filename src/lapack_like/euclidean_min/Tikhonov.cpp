@@ -130,6 +130,139 @@ void Tikhonov
     }
 }
 
+// Factored-state solvers
+// ======================
+
+template<typename F>
+void TikhonovFactorization<F>::Factor
+( Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& G,
+  TikhonovAlg alg )
+{
+    EL_DEBUG_CSE
+    const bool normal = ( orientation==NORMAL );
+    const Int m = ( normal ? A.Height() : A.Width()  );
+    const Int n = ( normal ? A.Width()  : A.Height() );
+    if( G.Width() != n )
+        LogicError("Tikhonov matrix was the wrong width");
+    if( orientation == TRANSPOSE && IsComplex<F>::value )
+        LogicError("Transpose version of complex Tikhonov not yet supported");
+    if( m < n )
+        LogicError("This case not yet supported");
+
+    orientation_ = orientation;
+    A_ = A;
+    if( alg == TIKHONOV_CHOLESKY )
+    {
+        if( orientation == NORMAL )
+            Herk( LOWER, ADJOINT, Base<F>(1), A, Z_ );
+        else
+            Herk( LOWER, NORMAL, Base<F>(1), A, Z_ );
+        Herk( LOWER, ADJOINT, Base<F>(1), G, Base<F>(1), Z_ );
+        Cholesky( LOWER, Z_ );
+    }
+    else
+    {
+        const Int mG = G.Height();
+        Zeros( Z_, m+mG, n );
+        auto ZT = Z_( IR(0,m),    IR(0,n) );
+        auto ZB = Z_( IR(m,m+mG), IR(0,n) );
+        if( orientation == NORMAL )
+            ZT = A;
+        else
+            Adjoint( A, ZT );
+        ZB = G;
+        qr::ExplicitTriang( Z_ );
+    }
+    factored_ = true;
+}
+
+template<typename F>
+void TikhonovFactorization<F>::Solve( const Matrix<F>& B, Matrix<F>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor() must be called before Solve()");
+    if( orientation_ == NORMAL )
+        Gemm( ADJOINT, NORMAL, F(1), A_, B, X );
+    else
+        Gemm( NORMAL, NORMAL, F(1), A_, B, X );
+    cholesky::SolveAfter( LOWER, NORMAL, Z_, X );
+}
+
+template<typename F>
+void DistTikhonovFactorization<F>::Factor
+( Orientation orientation,
+  const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& G,
+  TikhonovAlg alg )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    const bool normal = ( orientation==NORMAL );
+    const Int m = ( normal ? A.Height() : A.Width()  );
+    const Int n = ( normal ? A.Width()  : A.Height() );
+    if( G.Width() != n )
+        LogicError("Tikhonov matrix was the wrong width");
+    if( orientation == TRANSPOSE && IsComplex<F>::value )
+        LogicError("Transpose version of complex Tikhonov not yet supported");
+    if( m < n )
+        LogicError("This case not yet supported");
+
+    orientation_ = orientation;
+    A_.SetGrid( A.Grid() );
+    Z_.SetGrid( A.Grid() );
+    A_ = A;
+    if( alg == TIKHONOV_CHOLESKY )
+    {
+        if( orientation == NORMAL )
+            Herk( LOWER, ADJOINT, Base<F>(1), A, Z_ );
+        else
+            Herk( LOWER, NORMAL, Base<F>(1), A, Z_ );
+        Herk( LOWER, ADJOINT, Base<F>(1), G, Base<F>(1), Z_ );
+        Cholesky( LOWER, Z_ );
+    }
+    else
+    {
+        const Int mG = G.Height();
+        Zeros( Z_, m+mG, n );
+        auto ZT = Z_( IR(0,m),    IR(0,n) );
+        auto ZB = Z_( IR(m,m+mG), IR(0,n) );
+        if( orientation == NORMAL )
+            ZT = A;
+        else
+            Adjoint( A, ZT );
+        Copy( G, ZB );
+        qr::ExplicitTriang( Z_ );
+    }
+    factored_ = true;
+}
+
+template<typename F>
+void DistTikhonovFactorization<F>::Solve
+( const AbstractDistMatrix<F>& BPre,
+        AbstractDistMatrix<F>& XPre ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Factor() must be called before Solve()");
+
+    DistMatrixReadProxy<F,F,MC,MR> BProx( BPre );
+    DistMatrixWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& B = BProx.GetLocked();
+    auto& X = XProx.Get();
+
+    if( orientation_ == NORMAL )
+        Gemm( ADJOINT, NORMAL, F(1), A_, B, X );
+    else
+        Gemm( NORMAL, NORMAL, F(1), A_, B, X );
+    cholesky::SolveAfter( LOWER, NORMAL, Z_, X );
+}
+
 // The following routines solve either
 //
 //   Minimum length:
@@ -322,6 +455,8 @@ void Tikhonov
     const AbstractDistMatrix<F>& G, \
           AbstractDistMatrix<F>& X, \
           TikhonovAlg alg ); \
+  template class TikhonovFactorization<F>; \
+  template class DistTikhonovFactorization<F>; \
   template void Tikhonov \
   ( Orientation orientation, \
     const SparseMatrix<F>& A, \
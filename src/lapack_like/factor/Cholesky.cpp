@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./Monitor.hpp"
+
 #include "./Cholesky/LowerVariant3.hpp"
 #include "./Cholesky/UpperVariant3.hpp"
 #include "./Cholesky/ReverseLowerVariant3.hpp"
@@ -21,20 +23,50 @@
 
 namespace El {
 
+namespace {
+
+bool choleskyLookahead = false;
+bool choleskyTaskDAG = false;
+
+} // anonymous namespace
+
+void SetCholeskyLookahead( bool lookahead )
+{ choleskyLookahead = lookahead; }
+
+bool CholeskyLookahead()
+{ return choleskyLookahead; }
+
+void SetCholeskyTaskDAG( bool taskDAG )
+{ choleskyTaskDAG = taskDAG; }
+
+bool CholeskyTaskDAG()
+{ return choleskyTaskDAG; }
+
 // TODO: Pivoted Reverse Cholesky?
 
 template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Cholesky");
     EL_DEBUG_ONLY(
       if( A.Height() != A.Width() )
           LogicError("A must be square");
     )
     if( uplo == LOWER )
-        cholesky::LowerVariant3Blocked( A );
+    {
+        if( CholeskyTaskDAG() )
+            cholesky::LowerVariant3TaskDAG( A );
+        else
+            cholesky::LowerVariant3Blocked( A );
+    }
     else
-        cholesky::UpperVariant3Blocked( A );
+    {
+        if( CholeskyTaskDAG() )
+            cholesky::UpperVariant3TaskDAG( A );
+        else
+            cholesky::UpperVariant3Blocked( A );
+    }
 }
 
 template<typename F>
@@ -90,12 +122,42 @@ void ScaLAPACKHelper( UpperOrLower uplo, AbstractDistMatrix<F>& A )
     RuntimeError("There is no ScaLAPACK support for this datatype");
 }
 
+// Returns the calibrated blocksize for this datatype and grid shape,
+// measuring one at first use when blocksize tuning is enabled
+template<typename F>
+Int TunedBlocksize( const Grid& grid )
+{
+    const string key = BlocksizeTuningKey
+      ( "Cholesky", TypeName<F>(), grid.Height(), grid.Width() );
+    if( HaveTunedBlocksize( key ) )
+        return El::TunedBlocksize( key );
+    if( !BlocksizeTuningEnabled() || CalibratingBlocksize() )
+        return Blocksize();
+
+    const Int n =
+      Min( Int(256*Sqrt(double(grid.Size()))), Int(2048) );
+    DistMatrix<F> AOrig(grid), A(grid);
+    HermitianUniformSpectrum( AOrig, n, 1, 10 );
+    return CalibrateBlocksize
+      ( key,
+        [&]() { A = AOrig; Cholesky( LOWER, A ); },
+        grid.Comm() );
+}
+
 } // anonymous namespace
 
-template<typename F> 
-void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack,
+  const TuningCtrl& tuning )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Cholesky");
+    // An explicitly requested blocksize takes precedence over any
+    // autotuned value
+    BlocksizeGuard nbGuard
+    ( tuning.blocksize > 0 ? tuning.blocksize
+                           : cholesky::TunedBlocksize<F>( A.Grid() ) );
     if( scalapack )
     {
         cholesky::ScaLAPACKHelper( uplo, A );
@@ -103,9 +165,19 @@ void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
     else
     {
         if( uplo == LOWER )
-            cholesky::LowerVariant3Blocked( A );
+        {
+            if( CholeskyLookahead() )
+                cholesky::LowerVariant3Lookahead( A );
+            else
+                cholesky::LowerVariant3Blocked( A );
+        }
         else
-            cholesky::UpperVariant3Blocked( A );
+        {
+            if( CholeskyLookahead() )
+                cholesky::UpperVariant3Lookahead( A );
+            else
+                cholesky::UpperVariant3Blocked( A );
+        }
     }
 }
 
@@ -206,7 +278,8 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
 #define PROTO_BASE(F) \
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void Cholesky \
-  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack ); \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack, \
+    const TuningCtrl& tuning ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
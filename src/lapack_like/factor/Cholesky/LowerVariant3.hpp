@@ -62,11 +62,108 @@ void LowerVariant3Blocked( Matrix<F>& A )
         auto A22 = A( ind2, ind2 );
 
         cholesky::LowerVariant3Unblocked( A11 );
+        factor_monitor::ReportPanel( CholeskyMonitor(), A11, k );
         Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
         Herk( LOWER, NORMAL, Base<F>(-1), A21, Base<F>(1), A22 );
     }
 }
 
+// Execute the right-looking factorization as a DAG of tile tasks whose
+// dependencies are inferred from the tiles that each one reads and writes,
+// so that independent updates from different iterations of the partitioned
+// loop may overlap. The diagonal factorizations cannot throw across a task
+// boundary, so an indefinite pivot merely poisons the remaining tasks and
+// the exception is rethrown after the traversal. When OpenMP task
+// dependencies are unavailable this degrades to the blocked algorithm.
+template<typename F>
+void LowerVariant3TaskDAG( Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+#ifndef EL_HAVE_OMP_TASK_DEPEND
+    LowerVariant3Blocked( A );
+#else
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int numTiles = ( n + bsize - 1 ) / bsize;
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    bool hpdFailure = false;
+    EL_PARALLEL_REGION
+    {
+    EL_SINGLE
+    {
+    for( Int k=0; k<numTiles; ++k )
+    {
+        const Int kOff = k*bsize;
+        const Int kSize = Min( bsize, n-kOff );
+        F* Akk = &ABuf[kOff+kOff*ALDim];
+        EL_TASK_DEPEND(depend(inout:Akk[0]))
+        {
+            if( !hpdFailure )
+            {
+                try
+                {
+                    Matrix<F> A11;
+                    A11.Attach( kSize, kSize, Akk, ALDim );
+                    LowerVariant3Unblocked( A11 );
+                }
+                catch( const NonHPDMatrixException& ) { hpdFailure = true; }
+            }
+        }
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+            const Int iOff = i*bsize;
+            const Int iSize = Min( bsize, n-iOff );
+            F* Aik = &ABuf[iOff+kOff*ALDim];
+            EL_TASK_DEPEND(depend(in:Akk[0]) depend(inout:Aik[0]))
+            {
+                if( !hpdFailure )
+                    blas::Trsm
+                    ( 'R', 'L', 'C', 'N', iSize, kSize,
+                      F(1), Akk, ALDim, Aik, ALDim );
+            }
+        }
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+            const Int iOff = i*bsize;
+            const Int iSize = Min( bsize, n-iOff );
+            F* Aik = &ABuf[iOff+kOff*ALDim];
+            F* Aii = &ABuf[iOff+iOff*ALDim];
+            EL_TASK_DEPEND(depend(in:Aik[0]) depend(inout:Aii[0]))
+            {
+                if( !hpdFailure )
+                    blas::Herk
+                    ( 'L', 'N', iSize, kSize,
+                      -Base<F>(1), Aik, ALDim, Base<F>(1), Aii, ALDim );
+            }
+            for( Int j=k+1; j<i; ++j )
+            {
+                const Int jOff = j*bsize;
+                const Int jSize = Min( bsize, n-jOff );
+                F* Ajk = &ABuf[jOff+kOff*ALDim];
+                F* Aij = &ABuf[iOff+jOff*ALDim];
+                EL_TASK_DEPEND(
+                  depend(in:Aik[0]) depend(in:Ajk[0]) depend(inout:Aij[0]))
+                {
+                    if( !hpdFailure )
+                        blas::Gemm
+                        ( 'N', 'C', iSize, jSize, kSize,
+                          F(-1), Aik, ALDim, Ajk, ALDim, F(1), Aij, ALDim );
+                }
+            }
+        }
+    }
+    }
+    }
+    if( hpdFailure )
+        throw NonHPDMatrixException("A was not numerically HPD");
+#endif
+}
+
 template<typename F>
 void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
 {
@@ -101,6 +198,7 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
 
         A11_STAR_STAR = A11;
         Cholesky( LOWER, A11_STAR_STAR );
+        factor_monitor::ReportPanel( CholeskyMonitor(), A11_STAR_STAR, k );
         A11 = A11_STAR_STAR;
 
         A21_VC_STAR.AlignWith( A22 );
@@ -125,6 +223,107 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// A one-step lookahead variant of the above routine: each iteration eagerly
+// updates only the strip of the trailing matrix which the next panel depends
+// upon and defers the bulk of the rank-nb update until after the next panel
+// has been factored and broadcast, so that the latency-bound panel
+// collectives are not serialized behind the dominant local update
+template<typename F>
+void LowerVariant3Lookahead( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(grid);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(grid);
+    // Two generations of the solved panel are alive at once since the bulk
+    // of each trailing update is applied one iteration late
+    DistMatrix<F,STAR,MC> A21Trans_STAR_MC(grid), prevTrans_STAR_MC(grid);
+    DistMatrix<F,STAR,MR> A21Adj_STAR_MR(grid), prevAdj_STAR_MR(grid);
+    auto* curTrans = &A21Trans_STAR_MC;
+    auto* prevTrans = &prevTrans_STAR_MC;
+    auto* curAdj = &A21Adj_STAR_MR;
+    auto* prevAdj = &prevAdj_STAR_MR;
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    bool deferredUpdate = false;
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        // The current panel column was brought fully up to date at the end
+        // of the previous iteration, so it can be factored immediately
+        A11_STAR_STAR = A11;
+        Cholesky( LOWER, A11_STAR_STAR );
+        factor_monitor::ReportPanel( CholeskyMonitor(), A11_STAR_STAR, k );
+        A11 = A11_STAR_STAR;
+
+        A21_VC_STAR.AlignWith( A22 );
+        A21_VC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR );
+
+        A21_VR_STAR.AlignWith( A22 );
+        A21_VR_STAR = A21_VC_STAR;
+        curTrans->AlignWith( A22 );
+        curAdj->AlignWith( A22 );
+        Transpose( A21_VC_STAR, *curTrans );
+        Adjoint( A21_VR_STAR, *curAdj );
+        Transpose( *curTrans, A21 );
+
+        // Catch the trailing matrix up with the previous panel (the strip
+        // overlapping the current panel column was already applied)
+        if( deferredUpdate )
+        {
+            auto prevTransR = (*prevTrans)( ALL, IR(nb,END) );
+            auto prevAdjR = (*prevAdj)( ALL, IR(nb,END) );
+            LocalTrrk
+            ( LOWER, TRANSPOSE, F(-1), prevTransR, prevAdjR, F(1), A22 );
+        }
+
+        // Eagerly update only the strip which the next panel requires
+        const Int k2 = k + nb;
+        if( k2 < n )
+        {
+            const Int nb2 = Min(bsize,n-k2);
+
+            auto T11 = A22( IR(0,nb2), IR(0,nb2) );
+            auto curTransL = (*curTrans)( ALL, IR(0,nb2) );
+            auto curAdjL = (*curAdj)( ALL, IR(0,nb2) );
+            LocalTrrk
+            ( LOWER, TRANSPOSE, F(-1), curTransL, curAdjL, F(1), T11 );
+
+            if( k2+nb2 < n )
+            {
+                auto T21 = A22( IR(nb2,END), IR(0,nb2) );
+                auto curTransB = (*curTrans)( ALL, IR(nb2,END) );
+                LocalGemm
+                ( TRANSPOSE, NORMAL, F(-1), curTransB, curAdjL, F(1), T21 );
+            }
+
+            std::swap( curTrans, prevTrans );
+            std::swap( curAdj, prevAdj );
+            deferredUpdate = true;
+        }
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
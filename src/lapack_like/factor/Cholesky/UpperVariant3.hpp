@@ -67,11 +67,102 @@ void UpperVariant3Blocked( Matrix<F>& A )
         auto A22 = A( ind2, ind2 );
 
         cholesky::UpperVariant3Unblocked( A11 );
+        factor_monitor::ReportPanel( CholeskyMonitor(), A11, k );
         Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 );
         Herk( UPPER, ADJOINT, Base<F>(-1), A12, Base<F>(1), A22 );
     }
 }
 
+// The upper-triangular analogue of cholesky::LowerVariant3TaskDAG
+template<typename F>
+void UpperVariant3TaskDAG( Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+#ifndef EL_HAVE_OMP_TASK_DEPEND
+    UpperVariant3Blocked( A );
+#else
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int numTiles = ( n + bsize - 1 ) / bsize;
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    bool hpdFailure = false;
+    EL_PARALLEL_REGION
+    {
+    EL_SINGLE
+    {
+    for( Int k=0; k<numTiles; ++k )
+    {
+        const Int kOff = k*bsize;
+        const Int kSize = Min( bsize, n-kOff );
+        F* Akk = &ABuf[kOff+kOff*ALDim];
+        EL_TASK_DEPEND(depend(inout:Akk[0]))
+        {
+            if( !hpdFailure )
+            {
+                try
+                {
+                    Matrix<F> A11;
+                    A11.Attach( kSize, kSize, Akk, ALDim );
+                    UpperVariant3Unblocked( A11 );
+                }
+                catch( const NonHPDMatrixException& ) { hpdFailure = true; }
+            }
+        }
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+            const Int jOff = j*bsize;
+            const Int jSize = Min( bsize, n-jOff );
+            F* Akj = &ABuf[kOff+jOff*ALDim];
+            EL_TASK_DEPEND(depend(in:Akk[0]) depend(inout:Akj[0]))
+            {
+                if( !hpdFailure )
+                    blas::Trsm
+                    ( 'L', 'U', 'C', 'N', kSize, jSize,
+                      F(1), Akk, ALDim, Akj, ALDim );
+            }
+        }
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+            const Int jOff = j*bsize;
+            const Int jSize = Min( bsize, n-jOff );
+            F* Akj = &ABuf[kOff+jOff*ALDim];
+            F* Ajj = &ABuf[jOff+jOff*ALDim];
+            EL_TASK_DEPEND(depend(in:Akj[0]) depend(inout:Ajj[0]))
+            {
+                if( !hpdFailure )
+                    blas::Herk
+                    ( 'U', 'C', jSize, kSize,
+                      -Base<F>(1), Akj, ALDim, Base<F>(1), Ajj, ALDim );
+            }
+            for( Int i=j+1; i<numTiles; ++i )
+            {
+                const Int iOff = i*bsize;
+                const Int iSize = Min( bsize, n-iOff );
+                F* Aki = &ABuf[kOff+iOff*ALDim];
+                F* Aji = &ABuf[jOff+iOff*ALDim];
+                EL_TASK_DEPEND(
+                  depend(in:Akj[0]) depend(in:Aki[0]) depend(inout:Aji[0]))
+                {
+                    if( !hpdFailure )
+                        blas::Gemm
+                        ( 'C', 'N', jSize, iSize, kSize,
+                          F(-1), Akj, ALDim, Aki, ALDim, F(1), Aji, ALDim );
+                }
+            }
+        }
+    }
+    }
+    }
+    if( hpdFailure )
+        throw NonHPDMatrixException("A was not numerically HPD");
+#endif
+}
+
 template<typename F>
 void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
 {
@@ -105,6 +196,7 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
 
         A11_STAR_STAR = A11;
         Cholesky( UPPER, A11_STAR_STAR );
+        factor_monitor::ReportPanel( CholeskyMonitor(), A11_STAR_STAR, k );
         A11 = A11_STAR_STAR;
 
         A12_STAR_VR.AlignWith( A22 );
@@ -122,6 +214,99 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// The transpose of the lookahead scheme described in LowerVariant3.hpp:
+// only the block row which the next panel depends upon is updated eagerly,
+// and the bulk of each trailing update is applied one iteration late, after
+// the next panel factorization's collectives have been issued
+template<typename F>
+void UpperVariant3Lookahead( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(grid);
+    DistMatrix<F,STAR,MC> A12_STAR_MC(grid), prev_STAR_MC(grid);
+    DistMatrix<F,STAR,MR> A12_STAR_MR(grid), prev_STAR_MR(grid);
+    auto* curMC = &A12_STAR_MC;
+    auto* prevMC = &prev_STAR_MC;
+    auto* curMR = &A12_STAR_MR;
+    auto* prevMR = &prev_STAR_MR;
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    bool deferredUpdate = false;
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        // The current panel row was brought fully up to date at the end of
+        // the previous iteration, so it can be factored immediately
+        A11_STAR_STAR = A11;
+        Cholesky( UPPER, A11_STAR_STAR );
+        factor_monitor::ReportPanel( CholeskyMonitor(), A11_STAR_STAR, k );
+        A11 = A11_STAR_STAR;
+
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        curMC->AlignWith( A22 );
+        *curMC = A12_STAR_VR;
+        curMR->AlignWith( A22 );
+        *curMR = A12_STAR_VR;
+        A12 = *curMR;
+
+        // Catch the trailing matrix up with the previous panel (the strip
+        // overlapping the current panel row was already applied)
+        if( deferredUpdate )
+        {
+            auto prevMCR = (*prevMC)( ALL, IR(nb,END) );
+            auto prevMRR = (*prevMR)( ALL, IR(nb,END) );
+            LocalTrrk( UPPER, ADJOINT, F(-1), prevMCR, prevMRR, F(1), A22 );
+        }
+
+        // Eagerly update only the strip which the next panel requires
+        const Int k2 = k + nb;
+        if( k2 < n )
+        {
+            const Int nb2 = Min(bsize,n-k2);
+
+            auto T11 = A22( IR(0,nb2), IR(0,nb2) );
+            auto curMCL = (*curMC)( ALL, IR(0,nb2) );
+            auto curMRL = (*curMR)( ALL, IR(0,nb2) );
+            LocalTrrk( UPPER, ADJOINT, F(-1), curMCL, curMRL, F(1), T11 );
+
+            if( k2+nb2 < n )
+            {
+                auto T12 = A22( IR(0,nb2), IR(nb2,END) );
+                auto curMRRight = (*curMR)( ALL, IR(nb2,END) );
+                LocalGemm
+                ( ADJOINT, NORMAL, F(-1), curMCL, curMRRight, F(1), T12 );
+            }
+
+            std::swap( curMC, prevMC );
+            std::swap( curMR, prevMR );
+            deferredUpdate = true;
+        }
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
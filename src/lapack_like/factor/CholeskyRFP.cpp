@@ -0,0 +1,76 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// A Cholesky factorization which overwrites Rectangular Full Packed storage
+// (see PackRFP) in place: since RFP exposes the lower triangles of A11 and
+// A21 and the (transposed) upper triangle of A22 as ordinary views of the
+// packed rectangle, the usual 2x2 blocked algorithm applies directly, with
+// the trailing subproblem handled as an upper factorization.
+
+namespace El {
+
+template<typename Field>
+void CholeskyRFP( UpperOrLower uplo, Matrix<Field>& ARFP )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("RFP storage is currently only supported for uplo=LOWER");
+    const Int n = RFPDimension( ARFP.Height(), ARFP.Width() );
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    const Int s = ( n1==n2 ? 1 : 0 );
+
+    auto A11 = ARFP( IR(s,s+n1), ALL );
+    auto A21 = ARFP( IR(s+n1,END), ALL );
+    auto A22 = ARFP( IR(0,n2), IR(n1-n2,n1) );
+
+    Cholesky( LOWER, A11 );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, Field(1), A11, A21 );
+    Herk( UPPER, NORMAL, Base<Field>(-1), A21, Base<Field>(1), A22 );
+    Cholesky( UPPER, A22 );
+}
+
+template<typename Field>
+void CholeskyRFP( UpperOrLower uplo, AbstractDistMatrix<Field>& ARFPPre )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("RFP storage is currently only supported for uplo=LOWER");
+    const Int n = RFPDimension( ARFPPre.Height(), ARFPPre.Width() );
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    const Int s = ( n1==n2 ? 1 : 0 );
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( ARFPPre );
+    auto& ARFP = AProx.Get();
+
+    auto A11 = ARFP( IR(s,s+n1), ALL );
+    auto A21 = ARFP( IR(s+n1,END), ALL );
+    auto A22 = ARFP( IR(0,n2), IR(n1-n2,n1) );
+
+    Cholesky( LOWER, A11 );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, Field(1), A11, A21 );
+    Herk( UPPER, NORMAL, Base<Field>(-1), A21, Base<Field>(1), A22 );
+    Cholesky( UPPER, A22 );
+}
+
+#define PROTO(Field) \
+  template void CholeskyRFP( UpperOrLower uplo, Matrix<Field>& ARFP ); \
+  template void CholeskyRFP \
+  ( UpperOrLower uplo, AbstractDistMatrix<Field>& ARFP );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
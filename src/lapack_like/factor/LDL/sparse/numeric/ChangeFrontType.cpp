@@ -25,6 +25,32 @@
 namespace El {
 namespace ldl {
 
+namespace {
+
+// Redistribute a front's dense storage one column panel at a time: a direct
+// assignment between the 1D and 2D distributions materializes full
+// intermediate redistributions, whereas streaming panels into a preallocated
+// target bounds the transient beyond the source and target at a single panel.
+template<typename F,Dist U1,Dist V1,Dist U2,Dist V2>
+void StreamedRedistribution
+( DistMatrix<F,U1,V1>& B, const DistMatrix<F,U2,V2>& A )
+{
+    EL_DEBUG_CSE
+    B.AlignWith( A.DistData() );
+    B.Resize( A.Height(), A.Width() );
+    const Int width = A.Width();
+    const Int bsize = Blocksize();
+    for( Int j=0; j<width; j+=bsize )
+    {
+        const Int nb = Min( bsize, width-j );
+        auto APanel = A( ALL, IR(j,j+nb) );
+        auto BPanel = B( ALL, IR(j,j+nb) );
+        BPanel = APanel;
+    }
+}
+
+} // anonymous namespace
+
 template<typename Field>
 void ChangeFrontType
 ( Front<Field>& front, LDLFrontType type, bool recurse=true );
@@ -67,7 +93,7 @@ void ChangeFrontType( DistFront<F>& front, LDLFrontType type, bool recurse )
             else
             {
                 front.L1D.SetGrid( front.L2D.Grid() );
-                front.L1D = front.L2D;
+                StreamedRedistribution( front.L1D, front.L2D );
             }
             front.L2D.Empty();
         }
@@ -83,7 +109,7 @@ void ChangeFrontType( DistFront<F>& front, LDLFrontType type, bool recurse )
             else
             {
                 front.L2D.SetGrid( front.L1D.Grid() );
-                front.L2D = front.L1D;
+                StreamedRedistribution( front.L2D, front.L1D );
             }
             front.L1D.Empty();
         }
@@ -101,7 +127,7 @@ void ChangeFrontType( DistFront<F>& front, LDLFrontType type, bool recurse )
             else
             {
                 front.L2D.SetGrid( front.L1D.Grid() );
-                front.L2D = front.L1D;
+                StreamedRedistribution( front.L2D, front.L1D );
             }
             front.L1D.Empty();
         }
@@ -137,7 +163,7 @@ void ChangeFrontType( DistFront<F>& front, LDLFrontType type, bool recurse )
             else
             {
                 front.L1D.SetGrid( front.L2D.Grid() );
-                front.L1D = front.L2D;
+                StreamedRedistribution( front.L1D, front.L2D );
             }
             front.L2D.Empty();
         }
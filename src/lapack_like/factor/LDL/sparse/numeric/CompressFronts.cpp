@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// Attempt to replace the given bottom-left block with the low-rank pair
+// U V computed from an adaptive column-pivoted QR factorization, returning
+// whether the compression both met the tolerance and lowered the storage.
+// With B Omega^T ~= Q R, the truncated factorization yields U as the first
+// 'rank' columns of Q and V as the corresponding rows of R with the column
+// pivoting undone, so that U V ~= B up to a backward error of roughly 'tol'.
+template<typename Field>
+bool CompressBlock
+( const Matrix<Field>& B,
+        Matrix<Field>& U,
+        Matrix<Field>& V,
+  const Base<Field>& tol )
+{
+    EL_DEBUG_CSE
+    const Int m = B.Height();
+    const Int n = B.Width();
+
+    Matrix<Field> BCopy( B );
+    Matrix<Field> householderScalars;
+    Matrix<Base<Field>> signature;
+    Permutation Omega;
+    QRCtrl<Base<Field>> ctrl;
+    ctrl.colPiv = true;
+    ctrl.adaptive = true;
+    ctrl.tol = tol;
+    QR( BCopy, householderScalars, signature, Omega, ctrl );
+
+    // The adaptive factorization stops after the achieved rank many steps
+    const Int rank = householderScalars.Height();
+    if( rank*(m+n) >= m*n )
+        return false;
+
+    Identity( U, m, rank );
+    qr::ApplyQ( LEFT, NORMAL, BCopy, householderScalars, signature, U );
+
+    auto R = BCopy( IR(0,rank), ALL );
+    MakeTrapezoidal( UPPER, R );
+    Omega.InversePermuteCols( R );
+    V = R;
+
+    return true;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void CompressFronts
+( Front<Field>& front, const Base<Field>& tol, Int minSize )
+{
+    EL_DEBUG_CSE
+    if( Unfactored(front.type) )
+        LogicError("Cannot compress an unfactored frontal tree");
+    if( BlockFactorization(front.type) )
+        LogicError("Cannot compress a block factorization");
+    if( PivotedFactorization(front.type) )
+        LogicError("Cannot compress a pivoted factorization");
+
+    function<void(Front<Field>&)> compress =
+      [&]( Front<Field>& node )
+      {
+        for( auto& child : node.children )
+            compress( *child );
+
+        if( !node.isCompressed )
+        {
+            if( node.sparseLeaf )
+            {
+                // The entirety of LDense is the bottom-left connectivity
+                const Int m = node.LDense.Height();
+                const Int n = node.LDense.Width();
+                if( Min(m,n) >= minSize &&
+                    CompressBlock( node.LDense, node.ULow, node.VLow, tol ) )
+                {
+                    node.LDense.Empty();
+                    node.isCompressed = true;
+                }
+            }
+            else
+            {
+                const Int m = node.LDense.Height();
+                const Int n = node.LDense.Width();
+                if( Min(m-n,n) >= minSize )
+                {
+                    auto LB = node.LDense( IR(n,m), ALL );
+                    if( CompressBlock( LB, node.ULow, node.VLow, tol ) )
+                    {
+                        // Retain only the top-left triangle
+                        Matrix<Field> LT( node.LDense( IR(0,n), ALL ) );
+                        node.LDense.Empty();
+                        node.LDense = LT;
+                        node.isCompressed = true;
+                    }
+                }
+            }
+        }
+
+        // Detach any remaining view into the slab so that releasing the
+        // slab below actually reclaims the storage of the compressed blocks
+        if( node.LDense.Viewing() )
+        {
+            Matrix<Field> LOwned( node.LDense );
+            node.LDense.Empty();
+            node.LDense = LOwned;
+        }
+      };
+    compress( front );
+    SwapClear( front.slab );
+}
+
+#define PROTO(Field) \
+  template void CompressFronts \
+  ( Front<Field>& front, const Base<Field>& tol, Int minSize );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
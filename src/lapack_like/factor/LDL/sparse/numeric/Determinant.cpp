@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+// With A = P' L D L^[T/H] P for symmetric permutations P, the determinant
+// of A is simply the determinant of the (quasi-)diagonal D, which is the
+// product of the 1x1 pivots and of the determinants of any 2x2 pivot
+// blocks; the permutations contribute nothing since their signs cancel in
+// pairs. The product is accumulated as a SafeProduct so that the
+// log-determinants of very large matrices neither overflow nor underflow.
+
+namespace {
+
+template<typename Field>
+void AccumulateDeterminant
+( const Matrix<Field>& diag,
+  const Matrix<Field>& subdiag,
+  bool isHermitian,
+  bool pivoted,
+  Base<Field> scale,
+  SafeProduct<Field>& det )
+{
+    typedef Base<Field> Real;
+    if( det.rho == Field(0) )
+        return;
+    const Int n = diag.Height();
+    Int i=0;
+    while( i < n )
+    {
+        Field delta;
+        if( pivoted && i+1 < n && subdiag(i) != Field(0) )
+        {
+            // The determinant of the 2x2 pivot block
+            // [delta0, eps^[T/H]; eps, delta1]
+            const Field eps = subdiag(i);
+            const Field upper = ( isHermitian ? Conj(eps) : eps );
+            delta = diag(i)*diag(i+1) - eps*upper;
+            i += 2;
+        }
+        else
+        {
+            delta = diag(i);
+            i += 1;
+        }
+        const Real alpha = Abs(delta);
+        if( alpha == Real(0) )
+        {
+            det.rho = Field(0);
+            det.kappa = 0;
+            return;
+        }
+        det.rho *= delta/alpha;
+        det.kappa += Log(alpha)/scale;
+    }
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void Determinant
+( const Front<Field>& front,
+        Base<Field> scale,
+        SafeProduct<Field>& det )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = front.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        Determinant( *front.children[c], scale, det );
+    AccumulateDeterminant
+    ( front.diag, front.subdiag, front.isHermitian,
+      PivotedFactorization(front.type), scale, det );
+}
+
+template<typename Field>
+void Determinant
+( const DistFront<Field>& front,
+        Base<Field> scale,
+        SafeProduct<Field>& det )
+{
+    EL_DEBUG_CSE
+    if( front.child == nullptr )
+    {
+        Determinant( *front.duplicate, scale, det );
+        return;
+    }
+    Determinant( *front.child, scale, det );
+
+    // Only the root rank of this front's grid accumulates the (gathered)
+    // distributed diagonal, so that the caller's reduction over all ranks
+    // counts each front exactly once
+    DistMatrix<Field,STAR,STAR> diag( front.diag ), subdiag( front.subdiag );
+    if( front.diag.Grid().Rank() == 0 )
+        AccumulateDeterminant
+        ( diag.LockedMatrix(), subdiag.LockedMatrix(), front.isHermitian,
+          PivotedFactorization(front.type), scale, det );
+}
+
+#define PROTO(Field) \
+  template void Determinant \
+  ( const Front<Field>& front, \
+          Base<Field> scale, \
+          SafeProduct<Field>& det ); \
+  template void Determinant \
+  ( const DistFront<Field>& front, \
+          Base<Field> scale, \
+          SafeProduct<Field>& det );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
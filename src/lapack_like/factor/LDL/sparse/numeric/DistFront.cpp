@@ -79,9 +79,11 @@ void UnpackEntriesLocal
         ( *sep.children[c], *node.children[c], *front.children[c],
           A, rRowLengths, rEntries, rTargets, offs, entryOffs );
     }
-    // Mark this node as a sparse leaf if it does not have any children
-    // and is not a duplicate of a dense distributed node
-    if( numChildren == 0 && !front.duplicate )
+    // Mark this node as a sparse leaf if it does not have any children,
+    // carries the SuiteSparse leaf symbolic data (amalgamated leaves do not
+    // and are instead treated as dense fronts), and is not a duplicate of a
+    // dense distributed node
+    if( numChildren == 0 && !node.LOffsets.empty() && !front.duplicate )
         front.sparseLeaf = true;
 
     const Int size = node.size;
@@ -823,7 +825,7 @@ void DistFront<Field>::PullUpdate
     unpackEntries( rootSep, rootInfo, *this );
     if( time && commRank == 0 )
         Output("Unpack: ",timer.Stop()," secs");
-    EL_DEBUG_ONLY(
+    EL_HEAVY_DEBUG_ONLY(
       for( Int q=0; q<commSize; ++q )
           if( entryOffs[q] != rEntriesOffs[q]+rEntriesSizes[q] )
               LogicError("entryOffs were incorrect");
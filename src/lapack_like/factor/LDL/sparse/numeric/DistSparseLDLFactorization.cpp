@@ -56,11 +56,13 @@ void DistSparseLDLFactorization<Field>::Initialize
   const BisectCtrl& bisectCtrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.Initialize");
     info_.reset( new ldl::DistNodeInfo(A.Grid()) );
     separator_.reset( new ldl::DistSeparator );
     ldl::NestedDissection
     ( A.LockedDistGraph(), map_, *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
+    dmvMeta_.Empty();
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
 
@@ -83,6 +85,7 @@ void DistSparseLDLFactorization<Field>::Initialize2DGridGraph
     ( gridDim0, gridDim1, 1, A.LockedDistGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
+    dmvMeta_.Empty();
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
 
@@ -106,6 +109,7 @@ void DistSparseLDLFactorization<Field>::Initialize3DGridGraph
     ( gridDim0, gridDim1, gridDim2, A.LockedDistGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
+    dmvMeta_.Empty();
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
 
@@ -117,6 +121,7 @@ template<typename Field>
 void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.Factor");
     if( !initialized_ )
         LogicError("Must initialize before calling 'Factor()'");
     // We make use of the following rather than checking 'factored_' since it
@@ -145,6 +150,15 @@ void DistSparseLDLFactorization<Field>::ChangeFrontType
     ldl::ChangeFrontType( *front_, frontType );
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Refactor
+( const DistSparseMatrix<Field>& ANew, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    ChangeNonzeroValues( ANew );
+    Factor( frontType );
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::ChangeNonzeroValues
 ( const DistSparseMatrix<Field>& ANew )
@@ -168,13 +182,15 @@ template<typename Field>
 void DistSparseLDLFactorization<Field>::Solve( DistMultiVec<Field>& B ) const
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.Solve");
     if( !factored_ )
         LogicError("Must call Factor() before Solve()");
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
+        ldl::DistMultiVecNode<Field> BNodal;
+        BNodal.Pull( inverseMap_, *info_, B, dmvMeta_ );
         Solve( BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        BNodal.Push( inverseMap_, *info_, B, dmvMeta_ );
     }
     else
     {
@@ -260,6 +276,53 @@ void DistSparseLDLFactorization<Field>::Solve
     }
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::QueueSolve
+( const DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'QueueSolve()'");
+    if( B.Height() != map_.NumSources() )
+        LogicError("Queued right-hand side was the wrong height");
+    queuedRHS_.push_back( B );
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::ProcessSolveQueue
+( DistMultiVec<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before ProcessSolveQueue()");
+    Int numRHS = 0;
+    for( const auto& B : queuedRHS_ )
+        numRHS += B.Width();
+    if( numRHS == 0 )
+    {
+        SwapClear( queuedRHS_ );
+        return;
+    }
+
+    // Concatenate the queued right-hand sides so that a single nodal data
+    // structure (and hence a single blocked tree traversal) handles them all;
+    // each queued DistMultiVec shares the same row distribution, so the
+    // packing is entirely local
+    X.SetGrid( queuedRHS_.front().Grid() );
+    X.Resize( queuedRHS_.front().Height(), numRHS );
+    auto& XLoc = X.Matrix();
+    Int colOff = 0;
+    for( const auto& B : queuedRHS_ )
+    {
+        auto XLocCols = XLoc( ALL, IR(colOff,colOff+B.Width()) );
+        XLocCols = B.LockedMatrix();
+        colOff += B.Width();
+    }
+    SwapClear( queuedRHS_ );
+
+    Solve( X );
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::SolveWithIterativeRefinement
 ( const DistSparseMatrix<Field>& A,
@@ -332,9 +395,10 @@ void DistSparseLDLFactorization<Field>::SolveAgainstL
         LogicError("Must call Factor() before SolveAgainstL()");
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
+        ldl::DistMultiVecNode<Field> BNodal;
+        BNodal.Pull( inverseMap_, *info_, B, dmvMeta_ );
         SolveAgainstL( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        BNodal.Push( inverseMap_, *info_, B, dmvMeta_ );
     }
     else
     {
@@ -379,9 +443,10 @@ void DistSparseLDLFactorization<Field>::MultiplyWithL
         LogicError("Must call Factor() before MultiplyWithL()");
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
+        ldl::DistMultiVecNode<Field> BNodal;
+        BNodal.Pull( inverseMap_, *info_, B, dmvMeta_ );
         MultiplyWithL( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        BNodal.Push( inverseMap_, *info_, B, dmvMeta_ );
     }
     else
     {
@@ -426,9 +491,10 @@ void DistSparseLDLFactorization<Field>::SolveAgainstD
         LogicError("Must call Factor() before SolveAgainstD()");
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
+        ldl::DistMultiVecNode<Field> BNodal;
+        BNodal.Pull( inverseMap_, *info_, B, dmvMeta_ );
         SolveAgainstD( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        BNodal.Push( inverseMap_, *info_, B, dmvMeta_ );
     }
     else
     {
@@ -481,9 +547,10 @@ void DistSparseLDLFactorization<Field>::MultiplyWithD
         LogicError("Must call Factor() before MultiplyWithD()");
     if( FrontIs1D(front_->type) )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
+        ldl::DistMultiVecNode<Field> BNodal;
+        BNodal.Pull( inverseMap_, *info_, B, dmvMeta_ );
         MultiplyWithD( orientation, BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        BNodal.Push( inverseMap_, *info_, B, dmvMeta_ );
     }
     else
     {
@@ -527,6 +594,31 @@ void DistSparseLDLFactorization<Field>::MultiplyWithD
     }
 }
 
+template<typename Field>
+SafeProduct<Field> DistSparseLDLFactorization<Field>::Determinant() const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Determinant()");
+    const Int n = info_->size + info_->off;
+    mpi::Comm comm = info_->Grid().Comm();
+
+    // Accumulate the contributions of this process's local subtree and of
+    // the distributed fronts whose grids it roots
+    SafeProduct<Field> localDet( n );
+    ldl::Determinant( *front_, Base<Field>(n), localDet );
+
+    // The log-magnitudes sum, while the signs/phases multiply
+    SafeProduct<Field> det( n );
+    det.kappa = mpi::AllReduce( localDet.kappa, mpi::SUM, comm );
+    const int commSize = mpi::Size( comm );
+    vector<Field> rhos( commSize );
+    mpi::AllGather( &localDet.rho, 1, rhos.data(), 1, comm );
+    for( int q=0; q<commSize; ++q )
+        det.rho *= rhos[q];
+    return det;
+}
+
 template<typename Field>
 bool DistSparseLDLFactorization<Field>::Factored() const
 { return factored_; }
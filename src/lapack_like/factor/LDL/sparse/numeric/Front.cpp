@@ -86,20 +86,31 @@ void Front<Field>::Pull
     function<void(const NodeInfo&,Front<Field>&)> pull =
       [&]( const NodeInfo& node, Front<Field>& front )
       {
-        // Delete any existing children
-        SwapClear( front.children );
-
+        // Delete any mismatched children (a matching tree of fronts, e.g.,
+        // one built by ReserveStorage, is reused)
         const Int numChildren = node.children.size();
-        front.children.resize( numChildren );
-        for( Int c=0; c<numChildren; ++c )
+        if( Int(front.children.size()) != numChildren )
         {
-            front.children[c].reset( new Front<Field>(&front) );
-            pull( *node.children[c], *front.children[c] );
+            SwapClear( front.children );
+            front.children.resize( numChildren );
+            for( Int c=0; c<numChildren; ++c )
+                front.children[c].reset( new Front<Field>(&front) );
         }
+        for( Int c=0; c<numChildren; ++c )
+            pull( *node.children[c], *front.children[c] );
         // Mark this node as a sparse leaf if it does not have any children
-        if( numChildren == 0 )
+        // and carries the SuiteSparse leaf symbolic data (amalgamated leaves
+        // do not and are instead treated as dense fronts)
+        if( numChildren == 0 && !node.LOffsets.empty() )
             front.sparseLeaf = true;
 
+        // Any compression or spilling from a previous factorization is now
+        // invalid
+        front.isCompressed = false;
+        front.ULow.Empty();
+        front.VLow.Empty();
+        front.spillOffset = -1;
+
         const Int lowerSize = node.lowerStruct.size();
         const Field* AValBuf = A.LockedValueBuffer();
         const Int* AColBuf = A.LockedTargetBuffer();
@@ -206,6 +217,55 @@ void Front<Field>::Pull
     pull( rootInfo, *this );
 }
 
+template<typename Field>
+void Front<Field>::ReserveStorage( const NodeInfo& rootInfo )
+{
+    EL_DEBUG_CSE
+
+    // Build (or reuse) the tree of fronts while counting the dense entries of
+    // each front, whose extents are fully determined by the symbolic analysis
+    Int numTotalEntries = 0;
+    function<void(const NodeInfo&,Front<Field>&)> count =
+      [&]( const NodeInfo& node, Front<Field>& front )
+      {
+        const Int numChildren = node.children.size();
+        if( Int(front.children.size()) != numChildren )
+        {
+            SwapClear( front.children );
+            front.children.resize( numChildren );
+            for( Int c=0; c<numChildren; ++c )
+                front.children[c].reset( new Front<Field>(&front) );
+        }
+        for( Int c=0; c<numChildren; ++c )
+            count( *node.children[c], *front.children[c] );
+
+        const Int lowerSize = node.lowerStruct.size();
+        const bool sparse = numChildren == 0 && !node.LOffsets.empty();
+        const Int height = sparse ? lowerSize : node.size+lowerSize;
+        numTotalEntries += height*node.size;
+      };
+    count( rootInfo, *this );
+
+    // Attach each front's dense storage within the single allocation
+    slab.resize( numTotalEntries );
+    Int off = 0;
+    function<void(const NodeInfo&,Front<Field>&)> attach =
+      [&]( const NodeInfo& node, Front<Field>& front )
+      {
+        const Int numChildren = node.children.size();
+        for( Int c=0; c<numChildren; ++c )
+            attach( *node.children[c], *front.children[c] );
+
+        const Int lowerSize = node.lowerStruct.size();
+        const bool sparse = numChildren == 0 && !node.LOffsets.empty();
+        const Int height = sparse ? lowerSize : node.size+lowerSize;
+        front.LDense.Attach
+        ( height, node.size, slab.data()+off, Max(height,1) );
+        off += height*node.size;
+      };
+    attach( rootInfo, *this );
+}
+
 template<typename Field>
 void Front<Field>::PullUpdate
 ( const SparseMatrix<Field>& A,
@@ -235,6 +295,9 @@ void Front<Field>::PullUpdate
         for( Int c=0; c<numChildren; ++c )
             pull( *node.children[c], *front.children[c] );
 
+        if( front.isCompressed )
+            LogicError("Cannot update a compressed front in place");
+
         const Field* AValBuf = A.LockedValueBuffer();
         const Int* AColBuf = A.LockedTargetBuffer();
         const Int* AOffsetBuf = A.LockedOffsetBuffer();
@@ -321,6 +384,9 @@ void Front<Field>::Push
         for( Int c=0; c<numChildren; ++c )
             push( *node.children[c], *front.children[c] );
 
+        if( front.isCompressed )
+            LogicError("Cannot push a compressed front");
+
         const Int lowerSize = node.lowerStruct.size();
         if( front.sparseLeaf )
         {
@@ -438,6 +504,9 @@ void Front<Field>::Unpack
             PopIndent();
         }
 
+        if( front.isCompressed )
+            LogicError("Cannot unpack a compressed front");
+
         const Int lowerSize = node.lowerStruct.size();
         if( front.sparseLeaf )
         {
@@ -528,6 +597,9 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     type = front.type;
     LDense = front.LDense;
     LSparse = front.LSparse;
+    isCompressed = front.isCompressed;
+    ULow = front.ULow;
+    VLow = front.VLow;
     diag = front.diag;
     subdiag = front.subdiag;
     p = front.p;
@@ -550,7 +622,13 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
 
 template<typename Field>
 Int Front<Field>::Height() const
-{ return sparseLeaf ? LDense.Height()+LDense.Width() : LDense.Height(); }
+{
+    // After compression the bottom-left dimensions live in the low-rank pair
+    // (and, for a dense front, LDense retains only the top-left triangle)
+    if( isCompressed )
+        return ULow.Height() + VLow.Width();
+    return sparseLeaf ? LDense.Height()+LDense.Width() : LDense.Height();
+}
 
 template<typename Field>
 Int Front<Field>::NumEntries() const
@@ -579,12 +657,19 @@ Int Front<Field>::NumEntries() const
             }
 
             // Count the connectivity
-            numEntries += front.LDense.Height() * front.LDense.Width();
+            if( front.isCompressed )
+                numEntries += front.ULow.Height()*front.ULow.Width() +
+                              front.VLow.Height()*front.VLow.Width();
+            else
+                numEntries += front.LDense.Height() * front.LDense.Width();
         }
         else
         {
             // Add in L
             numEntries += front.LDense.Height() * front.LDense.Width();
+            if( front.isCompressed )
+                numEntries += front.ULow.Height()*front.ULow.Width() +
+                              front.VLow.Height()*front.VLow.Width();
         }
         // Add in the workspace for the Schur complement
         numEntries += front.workDense.Height()*front.workDense.Width();
@@ -640,7 +725,12 @@ Int Front<Field>::NumBottomLeftEntries() const
             count( *child );
         const Int m = front.LDense.Height();
         const Int n = front.LDense.Width();
-        if( front.sparseLeaf )
+        if( front.isCompressed )
+        {
+            numEntries += front.ULow.Height()*front.ULow.Width() +
+                          front.VLow.Height()*front.VLow.Width();
+        }
+        else if( front.sparseLeaf )
         {
             numEntries += m*n;
         }
@@ -663,8 +753,15 @@ double Front<Field>::FactorGFlops() const
       {
         for( const auto& child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
-        const double n = front.LDense.Width();
+        // Report the cost of the factorization that was performed, which
+        // predates any compression of the bottom-left blocks
+        const double n =
+          front.isCompressed ? front.VLow.Width() : front.LDense.Width();
+        const double m =
+          front.isCompressed ?
+          ( front.sparseLeaf ? double(front.ULow.Height())
+                             : front.ULow.Height()+n ) :
+          double(front.LDense.Height());
         double realFrontFlops=0;
         if( front.sparseLeaf )
         {
@@ -713,11 +810,26 @@ double Front<Field>::SolveGFlops( Int numRHS ) const
                 LogicError("Matrix has not yet been factored");
 
             const double numEntries = front.LSparse.NumEntries();
-            realFrontFlops = (numEntries+m*n)*numRHS;
+            if( front.isCompressed )
+            {
+                const double rank = front.ULow.Width();
+                realFrontFlops =
+                  (numEntries +
+                   rank*(front.ULow.Height()+front.VLow.Width()))*numRHS;
+            }
+            else
+                realFrontFlops = (numEntries+m*n)*numRHS;
         }
         else
         {
-            realFrontFlops = m*n*numRHS;
+            if( front.isCompressed )
+            {
+                const double rank = front.ULow.Width();
+                realFrontFlops =
+                  (n*n + rank*(front.ULow.Height()+n))*numRHS;
+            }
+            else
+                realFrontFlops = m*n*numRHS;
         }
         gflops += (IsComplex<Field>::value ? 4*realFrontFlops
                                        : realFrontFlops)/1.e9;
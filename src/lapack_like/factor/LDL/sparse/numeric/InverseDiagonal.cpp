@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+// A top-down selected-inversion sweep over a factored frontal tree: with
+// A = L D L^[T/H] and Z = inv(A), each front with columns J and lower
+// structure R satisfies
+//
+//   Z(R,J) = -Z(R,R) W,
+//   Z(J,J) = inv(L_JJ)^[T/H] inv(D_J) inv(L_JJ) - W^[T/H] Z(R,J),
+//
+// where W = L_RJ inv(L_JJ), and the required entries of Z(R,R) were already
+// computed by the ancestors since R is contained in their column sets. The
+// dense Z(R,R) submatrix is assembled for each child from the parent's
+// blocks via the same relative indices used by the solves, so the sweep
+// costs roughly as much as a second factorization rather than a solve per
+// inverse entry.
+
+template<typename Field>
+void InverseDiagonal
+( const NodeInfo& info,
+  const Front<Field>& front,
+        Matrix<Field>& dInv )
+{
+    EL_DEBUG_CSE
+    if( front.type != LDL_1D && front.type != LDL_2D )
+        LogicError("Selected inversion requires vanilla LDL fronts");
+
+    Zeros( dInv, info.off+info.size, 1 );
+
+    function<void(const NodeInfo&,const Front<Field>&,const Matrix<Field>&)>
+      invert =
+      [&]( const NodeInfo& node, const Front<Field>& frontNode,
+           const Matrix<Field>& ZRR )
+      {
+        if( frontNode.isCompressed )
+            LogicError("Cannot invert against a compressed front");
+        const Int n = node.size;
+        const Int lowerSize = node.lowerStruct.size();
+        const bool hermitian = frontNode.isHermitian;
+        const Orientation orient = ( hermitian ? ADJOINT : TRANSPOSE );
+
+        // Form W = L_RJ inv(L_JJ) and X = inv(L_JJ), densifying the
+        // diagonal block of a sparse leaf first
+        Matrix<Field> X, W;
+        if( frontNode.sparseLeaf )
+        {
+            Zeros( X, n, n );
+            for( Int r=0; r<n; ++r )
+                X(r,r) = Field(1);
+            // Each row of LSparse holds a column of the unit-lower factor
+            const Int* offsetBuf = frontNode.LSparse.LockedOffsetBuffer();
+            const Int* colBuf = frontNode.LSparse.LockedTargetBuffer();
+            const Field* valBuf = frontNode.LSparse.LockedValueBuffer();
+            for( Int r=0; r<n; ++r )
+                for( Int e=offsetBuf[r]; e<offsetBuf[r+1]; ++e )
+                    X(colBuf[e],r) = valBuf[e];
+            W = frontNode.LDense;
+            Trsm( RIGHT, LOWER, NORMAL, UNIT, Field(1), X, W );
+            TriangularInverse( LOWER, UNIT, X );
+        }
+        else
+        {
+            auto LJJ = frontNode.LDense( IR(0,n),   ALL );
+            W = frontNode.LDense( IR(n,END), ALL );
+            Trsm( RIGHT, LOWER, NORMAL, UNIT, Field(1), LJJ, W );
+            X = LJJ;
+            TriangularInverse( LOWER, UNIT, X );
+        }
+
+        // Z(J,J) := X^[T/H] inv(D_J) X
+        Matrix<Field> Y( X ), ZJJ;
+        DiagonalSolve( LEFT, NORMAL, frontNode.diag, Y );
+        Gemm( orient, NORMAL, Field(1), X, Y, Field(0), ZJJ );
+
+        // Fold in the coupling to the ancestors (if any)
+        Matrix<Field> ZRJ;
+        if( lowerSize > 0 )
+        {
+            Zeros( ZRJ, lowerSize, n );
+            Gemm( NORMAL, NORMAL, Field(-1), ZRR, W, Field(0), ZRJ );
+            Gemm( orient, NORMAL, Field(-1), W, ZRJ, Field(1), ZJJ );
+        }
+
+        for( Int t=0; t<n; ++t )
+            dInv(node.off+t,0) = ZJJ(t,t);
+
+        // Assemble each child's dense Z(R,R) from this front's blocks
+        const Int numChildren = node.children.size();
+        for( Int c=0; c<numChildren; ++c )
+        {
+            const Int childUSize = node.childRelInds[c].size();
+            Matrix<Field> ZChild;
+            Zeros( ZChild, childUSize, childUSize );
+            for( Int b=0; b<childUSize; ++b )
+            {
+                const Int q = node.childRelInds[c][b];
+                for( Int a=0; a<childUSize; ++a )
+                {
+                    const Int p = node.childRelInds[c][a];
+                    Field value;
+                    if( p < n && q < n )
+                        value = ZJJ(p,q);
+                    else if( p >= n && q < n )
+                        value = ZRJ(p-n,q);
+                    else if( p < n && q >= n )
+                        value = ( hermitian ? Conj(ZRJ(q-n,p))
+                                            : ZRJ(q-n,p) );
+                    else
+                        value = ZRR(p-n,q-n);
+                    ZChild(a,b) = value;
+                }
+            }
+            invert( *node.children[c], *frontNode.children[c], ZChild );
+        }
+      };
+
+    Matrix<Field> ZRoot;
+    invert( info, front, ZRoot );
+}
+
+#define PROTO(Field) \
+  template void InverseDiagonal \
+  ( const NodeInfo& info, \
+    const Front<Field>& front, \
+          Matrix<Field>& dInv );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -67,11 +67,19 @@ inline void LowerBackwardMultiply
         }
     }
 
+    // The children's subtrees are independent and are scheduled as tasks
+    // (which may overlap with the multiplication against this front)
     for( Int c=0; c<numChildren; ++c )
-        LowerBackwardMultiply
-        ( *info.children[c], *front.children[c], *X.children[c], conjugate );
+    {
+        const NodeInfo* childInfo = info.children[c].get();
+        const Front<F>* childFront = front.children[c].get();
+        MatrixNode<F>* childX = X.children[c].get();
+        EL_TASK
+        LowerBackwardMultiply( *childInfo, *childFront, *childX, conjugate );
+    }
 
     FrontLowerBackwardMultiply( front, W, conjugate );
+    EL_TASKWAIT
     if( haveParent )
     {
         X.matrix = W( IR(0,info.size), IR(0,numRHS) );
@@ -135,7 +143,7 @@ inline void LowerBackwardMultiply
             sendSizes[q] = X.commMeta.childRecvInds[q].size()*numRHS;
             recvSizes[q] = X.commMeta.numChildSendInds[q]*numRHS;
         }
-        EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
+        EL_HEAVY_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
         vector<int> sendOffs, recvOffs;
         const int sendBufSize = Scan( sendSizes, sendOffs );
         const int recvBufSize = Scan( recvSizes, recvOffs );
@@ -231,7 +239,7 @@ inline void LowerBackwardMultiply
             sendSizes[q] = X.commMeta.childRecvInds[q].size()/2;
             recvSizes[q] = X.commMeta.numChildSendInds[q];
         }
-        EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
+        EL_HEAVY_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
         vector<int> sendOffs, recvOffs;
         const int sendBufSize = Scan( sendSizes, sendOffs );
         const int recvBufSize = Scan( recvSizes, recvOffs );
@@ -34,10 +34,16 @@ inline void LowerForwardMultiply
 {
     EL_DEBUG_CSE
 
+    // The children's subtrees are independent and are scheduled as tasks
     const Int numChildren = info.children.size();
     for( Int c=0; c<numChildren; ++c )
-        LowerForwardMultiply
-        ( *info.children[c], *front.children[c], *X.children[c] );
+    {
+        const NodeInfo* childInfo = info.children[c].get();
+        const Front<F>* childFront = front.children[c].get();
+        MatrixNode<F>* childX = X.children[c].get();
+        EL_TASK
+        LowerForwardMultiply( *childInfo, *childFront, *childX );
+    }
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
@@ -54,6 +60,7 @@ inline void LowerForwardMultiply
     FrontLowerForwardMultiply( front, W );
 
     // Update using the children (if they exist)
+    EL_TASKWAIT
     for( Int c=0; c<numChildren; ++c )
     {
         auto& childW = X.children[c]->work;
@@ -124,7 +131,7 @@ inline void LowerForwardMultiply
         sendSizes[q] = X.commMeta.numChildSendInds[q]*numRHS;
         recvSizes[q] = X.commMeta.childRecvInds[q].size()*numRHS;
     }
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
+    EL_HEAVY_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
     vector<int> sendOffs, recvOffs;
     const int sendBufSize = Scan( sendSizes, sendOffs );
     const int recvBufSize = Scan( recvSizes, recvOffs );
@@ -223,7 +230,7 @@ inline void LowerForwardMultiply
         sendSizes[q] = X.commMeta.numChildSendInds[q];
         recvSizes[q] = X.commMeta.childRecvInds[q].size()/2;
     }
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
+    EL_HEAVY_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
     vector<int> sendOffs, recvOffs;
     const int sendBufSize = Scan( sendSizes, sendOffs );
     const int recvBufSize = Scan( recvSizes, recvOffs );
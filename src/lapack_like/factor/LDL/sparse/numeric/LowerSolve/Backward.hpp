@@ -78,9 +78,16 @@ inline void LowerBackwardSolve
     else if( haveDupMatParent )
         dupMat->work.Empty();
 
+    // The children's subtrees are independent and are scheduled as tasks
     for( Int c=0; c<numChildren; ++c )
-        LowerBackwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c], conjugate );
+    {
+        const NodeInfo* childInfo = info.children[c].get();
+        const Front<F>* childFront = front.children[c].get();
+        MatrixNode<F>* childX = X.children[c].get();
+        EL_TASK
+        LowerBackwardSolve( *childInfo, *childFront, *childX, conjugate );
+    }
+    EL_TASKWAIT
 }
 
 template<typename F>
@@ -136,7 +143,7 @@ inline void LowerBackwardSolve
         sendSizes[q] = X.commMeta.childRecvInds[q].size()*numRHS;
         recvSizes[q] = X.commMeta.numChildSendInds[q]*numRHS;
     }
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
+    EL_HEAVY_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
     vector<int> sendOffs, recvOffs;
     const int sendBufSize = Scan( sendSizes, sendOffs );
     const int recvBufSize = Scan( recvSizes, recvOffs );
@@ -238,7 +245,7 @@ inline void LowerBackwardSolve
         sendSizes[q] = X.commMeta.childRecvInds[q].size()/2;
         recvSizes[q] = X.commMeta.numChildSendInds[q];
     }
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
+    EL_HEAVY_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
     vector<int> sendOffs, recvOffs;
     const int sendBufSize = Scan( sendSizes, sendOffs );
     const int recvBufSize = Scan( recvSizes, recvOffs );
@@ -33,10 +33,16 @@ void LowerForwardSolve
 {
     EL_DEBUG_CSE
 
+    // The children's subtrees are independent and are scheduled as tasks
     const Int numChildren = info.children.size();
     for( Int c=0; c<numChildren; ++c )
-        LowerForwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
+    {
+        const NodeInfo* childInfo = info.children[c].get();
+        const Front<F>* childFront = front.children[c].get();
+        MatrixNode<F>* childX = X.children[c].get();
+        EL_TASK
+        LowerForwardSolve( *childInfo, *childFront, *childX );
+    }
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
@@ -50,6 +56,7 @@ void LowerForwardSolve
     Zero( WB );
 
     // Update using the children (if they exist)
+    EL_TASKWAIT
     for( Int c=0; c<numChildren; ++c )
     {
         auto& childW = X.children[c]->work;
@@ -60,7 +67,7 @@ void LowerForwardSolve
         auto childU = childW( IR(childSize,childHeight), IR(0,numRHS) );
         for( Int iChild=0; iChild<childUSize; ++iChild )
         {
-            const Int iFront = info.childRelInds[c][iChild]; 
+            const Int iFront = info.childRelInds[c][iChild];
             for( Int j=0; j<numRHS; ++j )
                 W(iFront,j) += childU(iChild,j);
         }
@@ -125,7 +132,7 @@ void LowerForwardSolve
         sendSizes[q] = X.commMeta.numChildSendInds[q]*numRHS;
         recvSizes[q] = X.commMeta.childRecvInds[q].size()*numRHS;
     }
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
+    EL_HEAVY_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
     vector<int> sendOffs, recvOffs;
     const int sendBufSize = Scan( sendSizes, sendOffs );
     const int recvBufSize = Scan( recvSizes, recvOffs );
@@ -233,7 +240,7 @@ void LowerForwardSolve
         sendSizes[q] = X.commMeta.numChildSendInds[q];
         recvSizes[q] = X.commMeta.childRecvInds[q].size()/2;
     }
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
+    EL_HEAVY_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
     vector<int> sendOffs, recvOffs;
     const int sendBufSize = Scan( sendSizes, sendOffs );
     const int recvBufSize = Scan( recvSizes, recvOffs );
@@ -667,7 +667,7 @@ void FrontLowerBackwardSolve
 
     if( front.sparseLeaf )
     {
-        const Int n = front.LDense.Width();
+        const Int n = front.LSparse.Width();
         const F* LValBuf = front.LSparse.LockedValueBuffer();
         const Int* LColBuf = front.LSparse.LockedTargetBuffer();
         const Int* LOffsetBuf = front.LSparse.LockedOffsetBuffer();
@@ -675,13 +675,21 @@ void FrontLowerBackwardSolve
         auto WT = W( IR(0,n), ALL );
         auto WB = W( IR(n,END), ALL );
 
-        const Orientation orientation = 
+        const Orientation orientation =
           ( front.isHermitian ? ADJOINT : TRANSPOSE );
-        Gemm( orientation, NORMAL, F(-1), front.LDense, WB, F(1), WT );
-        
+        if( front.isCompressed )
+        {
+            // WT := WT - (ULow VLow)^[T/H] WB
+            Matrix<F> Z;
+            Gemm( orientation, NORMAL, F(1), front.ULow, WB, F(0), Z );
+            Gemm( orientation, NORMAL, F(-1), front.VLow, Z, F(1), WT );
+        }
+        else
+            Gemm( orientation, NORMAL, F(-1), front.LDense, WB, F(1), WT );
+
         const bool onLeft = true;
         suite_sparse::ldl::LTSolveMulti
-        ( onLeft, WT.Height(), WT.Width(), WT.Buffer(), WT.LDim(), 
+        ( onLeft, WT.Height(), WT.Width(), WT.Buffer(), WT.LDim(),
           LOffsetBuf, LColBuf, LValBuf );
     }
     else
@@ -691,6 +699,19 @@ void FrontLowerBackwardSolve
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerBackwardSolve
             ( front.LDense, front.p, W, conjugate );
+        else if( front.isCompressed )
+        {
+            // Only the top-left triangle of LDense was retained
+            const Int n = front.LDense.Width();
+            auto WT = W( IR(0,n), ALL );
+            auto WB = W( IR(n,END), ALL );
+            const Orientation orientation =
+              ( conjugate ? ADJOINT : TRANSPOSE );
+            Matrix<F> Z;
+            Gemm( orientation, NORMAL, F(1), front.ULow, WB, F(0), Z );
+            Gemm( orientation, NORMAL, F(-1), front.VLow, Z, F(1), WT );
+            Trsm( LEFT, LOWER, orientation, UNIT, F(1), front.LDense, WT, true );
+        }
         else
             FrontVanillaLowerBackwardSolve( front.LDense, W, conjugate );
     }
@@ -98,7 +98,7 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
 
     if( front.sparseLeaf )
     {
-        const Int n = front.LDense.Width();
+        const Int n = front.LSparse.Width();
         const F* LValBuf = front.LSparse.LockedValueBuffer();
         const Int* LColBuf = front.LSparse.LockedTargetBuffer();
         const Int* LOffsetBuf = front.LSparse.LockedOffsetBuffer();
@@ -108,10 +108,18 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
 
         const bool onLeft = true;
         suite_sparse::ldl::LSolveMulti
-        ( onLeft, WT.Height(), WT.Width(), WT.Buffer(), WT.LDim(), 
+        ( onLeft, WT.Height(), WT.Width(), WT.Buffer(), WT.LDim(),
           LOffsetBuf, LColBuf, LValBuf );
 
-        Gemm( NORMAL, NORMAL, F(-1), front.LDense, WT, F(1), WB );
+        if( front.isCompressed )
+        {
+            // WB := WB - ULow (VLow WT)
+            Matrix<F> Z;
+            Gemm( NORMAL, NORMAL, F(1), front.VLow, WT, F(0), Z );
+            Gemm( NORMAL, NORMAL, F(-1), front.ULow, Z, F(1), WB );
+        }
+        else
+            Gemm( NORMAL, NORMAL, F(-1), front.LDense, WT, F(1), WB );
     }
     else
     {
@@ -119,6 +127,17 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
             FrontBlockLowerForwardSolve( front.LDense, W );
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerForwardSolve( front.LDense, front.p, W );
+        else if( front.isCompressed )
+        {
+            // Only the top-left triangle of LDense was retained
+            const Int n = front.LDense.Width();
+            auto WT = W( IR(0,n),   ALL );
+            auto WB = W( IR(n,END), ALL );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), front.LDense, WT );
+            Matrix<F> Z;
+            Gemm( NORMAL, NORMAL, F(1), front.VLow, WT, F(0), Z );
+            Gemm( NORMAL, NORMAL, F(-1), front.ULow, Z, F(1), WB );
+        }
         else
             FrontVanillaLowerForwardSolve( front.LDense, W );
     }
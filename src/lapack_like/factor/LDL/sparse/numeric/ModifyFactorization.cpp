@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+template<typename Field>
+void ModifyFactorization
+( const NodeInfo& info,
+        Front<Field>& front,
+        Base<Field> alpha,
+        Matrix<Field>& W )
+{
+    EL_DEBUG_CSE
+    if( front.type != LDL_1D && front.type != LDL_2D )
+        LogicError("Only vanilla LDL fronts can be modified");
+
+    const Int numUpdates = W.Width();
+    for( Int k=0; k<numUpdates; ++k )
+    {
+        // Mark the union of the elimination-tree paths from the nonzero rows
+        // of the update vector to the root: a front is affected if its
+        // columns intersect the nonzero pattern or if any of its children
+        // are affected
+        vector<pair<const NodeInfo*,Front<Field>*>> path;
+        function<bool(const NodeInfo&,Front<Field>&)> mark =
+          [&]( const NodeInfo& node, Front<Field>& frontNode ) -> bool
+          {
+            bool affected = false;
+            const Int numChildren = node.children.size();
+            for( Int c=0; c<numChildren; ++c )
+                if( mark( *node.children[c], *frontNode.children[c] ) )
+                    affected = true;
+            if( !affected )
+                for( Int t=0; t<node.size; ++t )
+                    if( W(node.off+t,k) != Field(0) )
+                    {
+                        affected = true;
+                        break;
+                    }
+            if( affected )
+                path.emplace_back( &node, &frontNode );
+            return affected;
+          };
+        mark( info, front );
+        // The recursion visited the affected fronts in postorder; ensure that
+        // the columns are processed in elimination order
+        std::sort
+        ( path.begin(), path.end(),
+          []( const pair<const NodeInfo*,Front<Field>*>& a,
+              const pair<const NodeInfo*,Front<Field>*>& b )
+          { return a.first->off < b.first->off; } );
+
+        // Propagate the update along the path via the method C1 of Gill,
+        // Golub, Murray, and Saunders, which modifies each affected column
+        // of L and its pivot while carrying the residual vector and the
+        // running scaling forward
+        Field a = alpha;
+        for( auto& entry : path )
+        {
+            const NodeInfo& node = *entry.first;
+            Front<Field>& frontNode = *entry.second;
+            if( frontNode.sparseLeaf )
+                LogicError
+                ("Cannot modify a sparse leaf front in place; "
+                 "its fixed nonzero pattern cannot accept fill");
+            if( frontNode.isCompressed )
+                LogicError("Cannot modify a compressed front");
+
+            const Int off = node.off;
+            const Int size = node.size;
+            const Int lowerSize = node.lowerStruct.size();
+            const bool hermitian = frontNode.isHermitian;
+            for( Int t=0; t<size; ++t )
+            {
+                const Field p = W(off+t,k);
+                if( p == Field(0) )
+                    continue;
+                const Field d = frontNode.diag(t,0);
+                const Field dNew =
+                  ( hermitian ? d + a*Conj(p)*p : d + a*p*p );
+                if( dNew == Field(0) )
+                    throw SingularMatrixException();
+                const Field beta = ( hermitian ? a*Conj(p)/dNew : a*p/dNew );
+                // Keep the copy of the pivot on the diagonal of LDense (which
+                // the unit-diagonal solves ignore but Push exports) consistent
+                frontNode.diag(t,0) = dNew;
+                frontNode.LDense(t,t) = dNew;
+                a = a*d/dNew;
+
+                // Update the remainder of the column within this front
+                for( Int s=t+1; s<size; ++s )
+                {
+                    W(off+s,k) -= p*frontNode.LDense(s,t);
+                    frontNode.LDense(s,t) += beta*W(off+s,k);
+                }
+                // Update the connectivity, whose rows lie within the columns
+                // of the ancestor fronts on the path
+                for( Int s=0; s<lowerSize; ++s )
+                {
+                    const Int i = node.lowerStruct[s];
+                    W(i,k) -= p*frontNode.LDense(size+s,t);
+                    frontNode.LDense(size+s,t) += beta*W(i,k);
+                }
+            }
+        }
+    }
+}
+
+#define PROTO(Field) \
+  template void ModifyFactorization \
+  ( const NodeInfo& info, \
+          Front<Field>& front, \
+          Base<Field> alpha, \
+          Matrix<Field>& W );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -24,6 +24,7 @@
 #define EL_LDL_PROCESS_HPP
 
 #include "./ProcessFront.hpp"
+#include "../../../Monitor.hpp"
 
 namespace El {
 namespace ldl {
@@ -90,6 +91,7 @@ void Process
           static_cast<const Int*>(nullptr),
           front.isHermitian );
         front.LSparse.ForceConsistency();
+        factor_monitor::ReportPivots( LDLMonitor(), front.diag, info.off );
 
         // Solve against L_{TL}^T from the right
         bool onLeft = false;
@@ -119,12 +121,19 @@ void Process
               LogicError("Front was not the proper size");
         )
 
-        // Process children and add in their updates
+        // Process the children concurrently (their subtrees are independent)
+        // and then add in their updates
         const int numChildren = info.children.size();
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
-
+            const NodeInfo* childInfo = info.children[c].get();
+            Front<Field>* childFront = front.children[c].get();
+            EL_TASK
+            Process( *childInfo, *childFront, factorType );
+        }
+        EL_TASKWAIT
+        for( Int c=0; c<numChildren; ++c )
+        {
             auto& childU = front.children[c]->workDense;
             const int childUSize = childU.Height();
             for( int jChild=0; jChild<childUSize; ++jChild )
@@ -143,6 +152,120 @@ void Process
             childU.Empty();
         }
         ProcessFront( front, factorType );
+        auto FTL = FL( IR(0,info.size), IR(0,info.size) );
+        factor_monitor::ReportPanel( LDLMonitor(), FTL, info.off );
+    }
+}
+
+// Process an entire local elimination tree, scheduling the independent
+// subtrees encountered during the postorder traversal as OpenMP tasks
+// (when task support was detected; otherwise this degrades to the usual
+// sequential postorder traversal)
+template<typename Field>
+void ProcessTree
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+{
+    EL_DEBUG_CSE
+    EL_PARALLEL_REGION
+    {
+        EL_SINGLE
+        {
+            Process( info, front, factorType );
+        }
+    }
+}
+
+// Process an entire local elimination tree except (possibly) for the
+// elimination of the root node: the root's fully-assembled frontal matrix,
+// which is the dense Schur complement of the root separator with respect to
+// every eliminated descendant, is exported just before said elimination.
+// When 'eliminateRoot' is false the root is left unfactored (e.g., so that a
+// structurally singular interface block from a floating subdomain need not
+// be factored), and the resulting partial factorization should be discarded
+// rather than solved against.
+template<typename Field>
+void ProcessWithSchurComplement
+( const NodeInfo& info,
+        Front<Field>& front,
+        LDLFrontType factorType,
+        Matrix<Field>& S,
+        bool eliminateRoot )
+{
+    EL_DEBUG_CSE
+    if( front.sparseLeaf )
+        LogicError
+        ("The root front must be dense in order to extract its Schur "
+         "complement");
+    auto& FL = front.LDense;
+    auto& FBR = front.workDense;
+    FBR.Empty();
+    const int updateSize = info.lowerStruct.size();
+    Zeros( FBR, updateSize, updateSize );
+    EL_DEBUG_ONLY(
+      if( FL.Height() != info.size+updateSize || FL.Width() != info.size )
+          LogicError("Front was not the proper size");
+    )
+
+    // Process the children concurrently (their subtrees are independent)
+    // and then add in their updates
+    const int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+    {
+        const NodeInfo* childInfo = info.children[c].get();
+        Front<Field>* childFront = front.children[c].get();
+        EL_TASK
+        Process( *childInfo, *childFront, factorType );
+    }
+    EL_TASKWAIT
+    for( Int c=0; c<numChildren; ++c )
+    {
+        auto& childU = front.children[c]->workDense;
+        const int childUSize = childU.Height();
+        for( int jChild=0; jChild<childUSize; ++jChild )
+        {
+            const int j = info.childRelInds[c][jChild];
+            for( int iChild=jChild; iChild<childUSize; ++iChild )
+            {
+                const int i = info.childRelInds[c][iChild];
+                const Field value = childU(iChild,jChild);
+                if( j < info.size )
+                    FL(i,j) += value;
+                else
+                    FBR(i-info.size,j-info.size) += value;
+            }
+        }
+        childU.Empty();
+    }
+
+    // Export the assembled Schur complement (only the lower triangle of the
+    // frontal matrix is stored)
+    auto FTL = FL( IR(0,info.size), IR(0,info.size) );
+    S = FTL;
+    MakeSymmetric( LOWER, S, front.isHermitian );
+
+    if( eliminateRoot )
+    {
+        ProcessFront( front, factorType );
+        factor_monitor::ReportPanel( LDLMonitor(), FTL, info.off );
+    }
+}
+
+template<typename Field>
+void ProcessTreeWithSchurComplement
+( const NodeInfo& info,
+        Front<Field>& front,
+        LDLFrontType factorType,
+        Matrix<Field>& S,
+        bool eliminateRoot )
+{
+    EL_DEBUG_CSE
+    EL_PARALLEL_REGION
+    {
+        EL_SINGLE
+        {
+            ProcessWithSchurComplement
+            ( info, front, factorType, S, eliminateRoot );
+        }
     }
 }
 
@@ -158,7 +281,7 @@ void Process
         const Grid& grid = info.Grid();
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        ProcessTree( *info.duplicate, frontDup, factorType );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
@@ -223,7 +346,7 @@ void Process
             sendBuf[offs[q]++] = childU.GetLocal(iChildLoc,jChildLoc);
         }
     }
-    EL_DEBUG_ONLY(
+    EL_HEAVY_DEBUG_ONLY(
       for( int q=0; q<commSize; ++q )
       {
           if( offs[q]-sendOffs[q] != front.commMeta.numChildSendInds[q] )
@@ -237,7 +360,7 @@ void Process
 
     // AllToAll to send and receive the child updates
     vector<Field> recvBuf( recvBufSize );
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
+    EL_HEAVY_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
     SparseAllToAll
     ( sendBuf, sendSizes, sendOffs,
       recvBuf, recvSizes, recvOffs, comm );
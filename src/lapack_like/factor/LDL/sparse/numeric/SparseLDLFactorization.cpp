@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include <cstdio>
+
 #include "./Process.hpp"
 #include "./LowerSolve/Forward.hpp"
 #include "./LowerSolve/Backward.hpp"
@@ -35,6 +37,31 @@ void DiagonalScale
 
 } // namespace ldl
 
+namespace {
+
+// Recursively bound the entry counts of the factor and of the peak of the
+// multifrontal update stack: a node's frontal matrix is live alongside the
+// update matrices of its already-eliminated children, and each child's own
+// peak occurs while its earlier siblings' updates are still retained
+double UpdateStackPeakEntries
+( const ldl::NodeInfo& node, double& factorEntries )
+{
+    const double size = node.size;
+    const double lowerSize = node.lowerStruct.size();
+    factorEntries += (size+lowerSize)*size;
+    double peak = 0, retained = 0;
+    for( const auto& child : node.children )
+    {
+        peak =
+          Max( peak, retained+UpdateStackPeakEntries(*child,factorEntries) );
+        const double childLowerSize = child->lowerStruct.size();
+        retained += childLowerSize*childLowerSize;
+    }
+    return Max( peak, retained+(size+lowerSize)*(size+lowerSize) );
+}
+
+} // anonymous namespace
+
 template<typename Field>
 SparseLDLFactorization<Field>::SparseLDLFactorization()
 { }
@@ -46,12 +73,37 @@ void SparseLDLFactorization<Field>::Initialize
   const BisectCtrl& bisectCtrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.Initialize");
     info_.reset( new ldl::NodeInfo );
     separator_.reset( new ldl::Separator );
     ldl::NestedDissection
     ( A.LockedGraph(), map_, *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
-    front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    front_.reset( new ldl::Front<Field> );
+    front_->ReserveStorage( *info_ );
+    front_->Pull( A, map_, *info_, hermitian );
+
+    initialized_ = true;
+    factored_ = false;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::InitializeWithSchurIndices
+( const SparseMatrix<Field>& A,
+  const vector<Int>& schurInds,
+        bool hermitian,
+  const BisectCtrl& bisectCtrl )
+{
+    EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.InitializeWithSchurIndices");
+    info_.reset( new ldl::NodeInfo );
+    separator_.reset( new ldl::Separator );
+    ldl::NestedDissection
+    ( A.LockedGraph(), schurInds, map_, *separator_, *info_, bisectCtrl );
+    InvertMap( map_, inverseMap_ );
+    front_.reset( new ldl::Front<Field> );
+    front_->ReserveStorage( *info_ );
+    front_->Pull( A, map_, *info_, hermitian );
 
     initialized_ = true;
     factored_ = false;
@@ -72,7 +124,9 @@ void SparseLDLFactorization<Field>::Initialize2DGridGraph
     ( gridDim0, gridDim1, 1, A.LockedGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
-    front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    front_.reset( new ldl::Front<Field> );
+    front_->ReserveStorage( *info_ );
+    front_->Pull( A, map_, *info_, hermitian );
 
     initialized_ = true;
     factored_ = false;
@@ -94,7 +148,9 @@ void SparseLDLFactorization<Field>::Initialize3DGridGraph
     ( gridDim0, gridDim1, gridDim2, A.LockedGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
-    front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    front_.reset( new ldl::Front<Field> );
+    front_->ReserveStorage( *info_ );
+    front_->Pull( A, map_, *info_, hermitian );
 
     initialized_ = true;
     factored_ = false;
@@ -104,6 +160,7 @@ template<typename Field>
 void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.Factor");
     if( !initialized_ )
         LogicError("Must initialize before calling 'Factor()'");
     // We make use of the following rather than checking 'factored_' since it
@@ -114,23 +171,211 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     // Convert from 1D to 2D if necessary
     ChangeFrontType( SYMM_2D );
     
-    // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    // Perform the initial factorization. When GPU offload was enabled, the
+    // imports layer is told to dispatch every dense kernel whose dimensions
+    // reach the front-size threshold for the duration of the traversal, so
+    // that the large ancestor fronts run on the device while the task
+    // scheduler keeps the host threads busy with the small leaf fronts.
+    const bool oldOffload = cublas::GpuOffload();
+    const BlasInt oldOffloadThreshold = cublas::GpuOffloadThreshold();
+    if( gpuOffload_ )
+    {
+        cublas::SetGpuOffloadThreshold( gpuMinFrontSize_ );
+        cublas::SetGpuOffload( true );
+    }
+    ldl::ProcessTree( *info_, *front_, InitialFactorType(frontType) );
+    if( gpuOffload_ )
+    {
+        cublas::SetGpuOffload( oldOffload );
+        cublas::SetGpuOffloadThreshold( oldOffloadThreshold );
+    }
     factored_ = true;
-    
+
     // Convert the fronts from the initial factorization to the requested form
     ChangeFrontType( frontType );
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::EnableGPUOffload
+( bool offload, Int minFrontSize )
+{
+    EL_DEBUG_CSE
+#ifndef EL_HAVE_CUBLAS
+    if( offload )
+        RuntimeError("Elemental was not configured with cuBLAS support");
+#endif
+    if( minFrontSize <= 0 )
+        LogicError("The front-size threshold must be positive");
+    gpuOffload_ = offload;
+    gpuMinFrontSize_ = minFrontSize;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::FactorWithSchurComplement
+( Matrix<Field>& S,
+  bool eliminateSchurBlock,
+  LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.FactorWithSchurComplement");
+    if( !initialized_ )
+        LogicError
+        ("Must initialize before calling 'FactorWithSchurComplement()'");
+    if( !Unfactored(front_->type) )
+        LogicError("Fronts are already marked as factored");
+    if( !eliminateSchurBlock && frontType != LDL_1D && frontType != LDL_2D )
+        LogicError("Partial factorizations require a vanilla LDL front type");
+
+    // Convert from 1D to 2D if necessary
+    ChangeFrontType( SYMM_2D );
+
+    // Perform the (possibly partial) factorization, exporting the root
+    // separator's assembled frontal matrix just before its elimination
+    const bool oldOffload = cublas::GpuOffload();
+    const BlasInt oldOffloadThreshold = cublas::GpuOffloadThreshold();
+    if( gpuOffload_ )
+    {
+        cublas::SetGpuOffloadThreshold( gpuMinFrontSize_ );
+        cublas::SetGpuOffload( true );
+    }
+    ldl::ProcessTreeWithSchurComplement
+    ( *info_, *front_, InitialFactorType(frontType), S, eliminateSchurBlock );
+    if( gpuOffload_ )
+    {
+        cublas::SetGpuOffload( oldOffload );
+        cublas::SetGpuOffloadThreshold( oldOffloadThreshold );
+    }
+
+    if( eliminateSchurBlock )
+    {
+        factored_ = true;
+
+        // Convert the fronts from the initial factorization to the requested
+        // form
+        ChangeFrontType( frontType );
+    }
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::ChangeFrontType( LDLFrontType frontType )
 {
     EL_DEBUG_CSE
     if( !initialized_ )
         LogicError("Must initialize before calling 'ChangeFrontType()'");
+    if( spilled_ )
+        LogicError("Cannot change the front type while the fronts are spilled");
     ldl::ChangeFrontType( *front_, frontType );
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::CompressFronts
+( const Base<Field>& tol, Int minCompressSize )
+{
+    EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.CompressFronts");
+    if( !factored_ )
+        LogicError("Must call Factor() before CompressFronts()");
+    if( spilled_ )
+        LogicError("Cannot compress the fronts while the fronts are spilled");
+    // Note that releasing the storage slab during compression implies that a
+    // subsequent refactorization pays for a fine-grained allocation per front
+    ldl::CompressFronts( *front_, tol, minCompressSize );
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::ModifyFactorization
+( Base<Field> alpha, const Matrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.ModifyFactorization");
+    if( !factored_ )
+        LogicError("Must call Factor() before ModifyFactorization()");
+    if( spilled_ )
+        LogicError("Cannot modify the factorization while the fronts are spilled");
+    if( V.Height() != Int(map_.size()) )
+        LogicError("V was the wrong height");
+    // Permute the rows of the update matrix into the factorization's ordering
+    const Int height = V.Height();
+    const Int width = V.Width();
+    Matrix<Field> W( height, width );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            W( map_[i], j ) = V(i,j);
+    ldl::ModifyFactorization( *info_, *front_, alpha, W );
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::SpillFronts( const string& spillFile )
+{
+    EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.SpillFronts");
+    if( !factored_ )
+        LogicError("Must call Factor() before SpillFronts()");
+    if( spilled_ )
+        LogicError("Fronts are already spilled");
+    ldl::SpillFronts( *front_, spillFile );
+    spillFile_ = spillFile;
+    spilled_ = true;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::UnspillFronts()
+{
+    EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.UnspillFronts");
+    if( !spilled_ )
+        LogicError("Fronts are not spilled");
+    ldl::UnspillFronts( *front_, spillFile_ );
+    std::remove( spillFile_.c_str() );
+    spillFile_.clear();
+    spilled_ = false;
+}
+
+template<typename Field>
+bool SparseLDLFactorization<Field>::FrontsSpilled() const EL_NO_EXCEPT
+{ return spilled_; }
+
+template<typename Field>
+void SparseLDLFactorization<Field>::InverseDiagonal
+( Matrix<Field>& dInv ) const
+{
+    EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.InverseDiagonal");
+    if( !factored_ )
+        LogicError("Must call Factor() before InverseDiagonal()");
+    if( spilled_ )
+        LogicError
+        ("Cannot compute the inverse diagonal while the fronts are spilled");
+    Matrix<Field> dNodal;
+    ldl::InverseDiagonal( *info_, *front_, dNodal );
+    // Permute the result back into the original ordering
+    const Int height = map_.size();
+    dInv.Resize( height, 1 );
+    for( Int i=0; i<height; ++i )
+        dInv(i,0) = dNodal(map_[i],0);
+}
+
+template<typename Field>
+SafeProduct<Field> SparseLDLFactorization<Field>::Determinant() const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Determinant()");
+    const Int n = map_.size();
+    SafeProduct<Field> det( n );
+    ldl::Determinant( *front_, Base<Field>(n), det );
+    return det;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::Refactor
+( const SparseMatrix<Field>& ANew, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    ChangeNonzeroValues( ANew );
+    Factor( frontType );
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::ChangeNonzeroValues
 ( const SparseMatrix<Field>& ANew )
@@ -138,6 +383,8 @@ void SparseLDLFactorization<Field>::ChangeNonzeroValues
     EL_DEBUG_CSE
     if( !initialized_ )
         LogicError("Must initialize before calling 'ChangeNonzeroValues()'");
+    if( spilled_ )
+        LogicError("Cannot change the nonzero values while the fronts are spilled");
     front_->Pull( ANew, map_, *info_ );
     factored_ = false;
 }
@@ -146,6 +393,7 @@ template<typename Field>
 void SparseLDLFactorization<Field>::Solve( Matrix<Field>& B ) const
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("SparseLDL.Solve");
     if( !factored_ )
         LogicError("Must call Factor() before Solve()");
     // TODO(poulson): Reuse a single MatrixNode data structure?
@@ -179,6 +427,44 @@ void SparseLDLFactorization<Field>::Solve( ldl::MatrixNode<Field>& B ) const
     }
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::QueueSolve( const Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'QueueSolve()'");
+    if( B.Height() != Int(map_.size()) )
+        LogicError("Queued right-hand side was the wrong height");
+    queuedRHS_.push_back( B );
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::ProcessSolveQueue( Matrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before ProcessSolveQueue()");
+    const Int n = map_.size();
+    Int numRHS = 0;
+    for( const auto& B : queuedRHS_ )
+        numRHS += B.Width();
+
+    // Concatenate the queued right-hand sides so that a single nodal data
+    // structure (and hence a single blocked tree traversal) handles them all
+    X.Resize( n, numRHS );
+    Int colOff = 0;
+    for( const auto& B : queuedRHS_ )
+    {
+        auto XCols = X( ALL, IR(colOff,colOff+B.Width()) );
+        XCols = B;
+        colOff += B.Width();
+    }
+    SwapClear( queuedRHS_ );
+
+    if( numRHS > 0 )
+        Solve( X );
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::SolveWithIterativeRefinement
 ( const SparseMatrix<Field>& A,
@@ -258,10 +544,30 @@ void SparseLDLFactorization<Field>::SolveAgainstL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before SolveAgainstL()");
-    if( orientation == NORMAL )
-        ldl::LowerForwardSolve( *info_, *front_, B );
-    else
-        ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+    if( spilled_ )
+    {
+        // Stream each front back from the spill file around its use
+        std::ifstream spill( spillFile_.c_str(), std::ios::binary );
+        if( !spill )
+            RuntimeError("Could not open spill file ",spillFile_);
+        if( orientation == NORMAL )
+            ldl::SpilledLowerForwardSolve( *info_, *front_, B, spill );
+        else
+            ldl::SpilledLowerBackwardSolve
+            ( *info_, *front_, B, spill, orientation==ADJOINT );
+        return;
+    }
+    EL_PARALLEL_REGION
+    {
+        EL_SINGLE
+        {
+            if( orientation == NORMAL )
+                ldl::LowerForwardSolve( *info_, *front_, B );
+            else
+                ldl::LowerBackwardSolve
+                ( *info_, *front_, B, orientation==ADJOINT );
+        }
+    }
 }
 
 template<typename Field>
@@ -271,6 +577,8 @@ void SparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
+    if( spilled_ )
+        LogicError("Cannot multiply with L while the fronts are spilled");
     ldl::MatrixNode<Field> BNodal( inverseMap_, *info_, B );
     MultiplyWithL( orientation, BNodal );
     BNodal.Push( inverseMap_, *info_, B );
@@ -283,10 +591,17 @@ void SparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
-    if( orientation == NORMAL )
-        ldl::LowerForwardMultiply( *info_, *front_, B );
-    else
-        ldl::LowerBackwardMultiply( *info_, *front_, B, orientation==ADJOINT );
+    EL_PARALLEL_REGION
+    {
+        EL_SINGLE
+        {
+            if( orientation == NORMAL )
+                ldl::LowerForwardMultiply( *info_, *front_, B );
+            else
+                ldl::LowerBackwardMultiply
+                ( *info_, *front_, B, orientation==ADJOINT );
+        }
+    }
 }
 
 template<typename Field>
@@ -387,6 +702,18 @@ double SparseLDLFactorization<Field>::FactorGFlops() const
     return front_->FactorGFlops();
 }
 
+template<typename Field>
+double SparseLDLFactorization<Field>::MemoryEstimate() const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'MemoryEstimate()'");
+    double factorEntries = 0;
+    const double stackPeakEntries =
+      UpdateStackPeakEntries( *info_, factorEntries );
+    return (factorEntries+stackPeakEntries)*double(sizeof(Field));
+}
+
 template<typename Field>
 double SparseLDLFactorization<Field>::SolveGFlops( Int numRHS ) const
 {
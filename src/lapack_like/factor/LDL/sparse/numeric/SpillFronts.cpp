@@ -0,0 +1,313 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./LowerSolve/FrontForward.hpp"
+#include "./LowerSolve/FrontBackward.hpp"
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// Pack the entries of a matrix into a contiguous column-major byte buffer.
+// The generic implementation copies the raw representation, while the
+// multiple-precision types are routed through their serialization routines
+// since their elements hold heap pointers.
+template<typename Field>
+void PackMatrix( const Matrix<Field>& A, vector<byte>& packed )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const std::size_t colSize = std::size_t(m)*sizeof(Field);
+    packed.resize( colSize*std::size_t(n) );
+    byte* buf = packed.data();
+    for( Int j=0; j<n; ++j )
+    {
+        std::memcpy( buf, A.LockedBuffer(0,j), colSize );
+        buf += colSize;
+    }
+}
+template<typename Field>
+void UnpackMatrix( const vector<byte>& packed, Matrix<Field>& A )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const std::size_t colSize = std::size_t(m)*sizeof(Field);
+    const byte* buf = packed.data();
+    for( Int j=0; j<n; ++j )
+    {
+        std::memcpy( A.Buffer(0,j), buf, colSize );
+        buf += colSize;
+    }
+}
+#ifdef EL_HAVE_MPC
+void PackMatrix( const Matrix<BigFloat>& A, vector<byte>& packed )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    packed.clear();
+    vector<byte> colPacked;
+    for( Int j=0; j<n; ++j )
+    {
+        Serialize( m, A.LockedBuffer(0,j), colPacked );
+        packed.insert( packed.end(), colPacked.begin(), colPacked.end() );
+    }
+}
+void UnpackMatrix( const vector<byte>& packed, Matrix<BigFloat>& A )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const byte* buf = packed.data();
+    for( Int j=0; j<n; ++j )
+        buf = Deserialize( m, buf, A.Buffer(0,j) );
+}
+void PackMatrix( const Matrix<Complex<BigFloat>>& A, vector<byte>& packed )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    packed.clear();
+    vector<byte> colPacked;
+    for( Int j=0; j<n; ++j )
+    {
+        Serialize( m, A.LockedBuffer(0,j), colPacked );
+        packed.insert( packed.end(), colPacked.begin(), colPacked.end() );
+    }
+}
+void UnpackMatrix
+( const vector<byte>& packed, Matrix<Complex<BigFloat>>& A )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const byte* buf = packed.data();
+    for( Int j=0; j<n; ++j )
+        buf = Deserialize( m, buf, A.Buffer(0,j) );
+}
+#endif
+
+// Each record is self-describing (dimensions plus payload size) so that a
+// front can be restored without consulting the symbolic analysis
+template<typename Field>
+void WriteFrontRecord( std::ofstream& file, const Matrix<Field>& A )
+{
+    const long long height = A.Height();
+    const long long width = A.Width();
+    vector<byte> packed;
+    PackMatrix( A, packed );
+    const long long numBytes = packed.size();
+    file.write( reinterpret_cast<const char*>(&height), sizeof(height) );
+    file.write( reinterpret_cast<const char*>(&width), sizeof(width) );
+    file.write( reinterpret_cast<const char*>(&numBytes), sizeof(numBytes) );
+    file.write( reinterpret_cast<const char*>(packed.data()), numBytes );
+}
+template<typename Field>
+void ReadFrontRecord( std::ifstream& file, Matrix<Field>& A )
+{
+    long long height, width, numBytes;
+    file.read( reinterpret_cast<char*>(&height), sizeof(height) );
+    file.read( reinterpret_cast<char*>(&width), sizeof(width) );
+    file.read( reinterpret_cast<char*>(&numBytes), sizeof(numBytes) );
+    vector<byte> packed( numBytes );
+    file.read( reinterpret_cast<char*>(packed.data()), numBytes );
+    if( !file )
+        RuntimeError("Failed while reading a spilled front");
+    A.Resize( height, width );
+    UnpackMatrix( packed, A );
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void SpillFronts( Front<Field>& front, const string& spillFile )
+{
+    EL_DEBUG_CSE
+    if( Unfactored(front.type) )
+        LogicError("Cannot spill an unfactored frontal tree");
+    std::ofstream file
+    ( spillFile.c_str(), std::ios::binary|std::ios::trunc );
+    if( !file )
+        RuntimeError("Could not open spill file ",spillFile);
+    function<void(Front<Field>&)> spill =
+      [&]( Front<Field>& node )
+      {
+        for( auto& child : node.children )
+            spill( *child );
+        node.spillOffset = file.tellp();
+        WriteFrontRecord( file, node.LDense );
+        node.LDense.Empty();
+      };
+    spill( front );
+    if( !file )
+        RuntimeError("Failed while writing spill file ",spillFile);
+    // Release the storage slab which backed the now-spilled fronts
+    SwapClear( front.slab );
+}
+
+template<typename Field>
+void UnspillFronts( Front<Field>& front, const string& spillFile )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( spillFile.c_str(), std::ios::binary );
+    if( !file )
+        RuntimeError("Could not open spill file ",spillFile);
+    function<void(Front<Field>&)> unspill =
+      [&]( Front<Field>& node )
+      {
+        for( auto& child : node.children )
+            unspill( *child );
+        if( node.spillOffset < 0 )
+            LogicError("Front was not spilled");
+        file.seekg( node.spillOffset );
+        ReadFrontRecord( file, node.LDense );
+        node.spillOffset = -1;
+      };
+    unspill( front );
+}
+
+template<typename Field>
+void SpilledLowerForwardSolve
+( const NodeInfo& info,
+        Front<Field>& front,
+        MatrixNode<Field>& X,
+        std::ifstream& spill )
+{
+    EL_DEBUG_CSE
+
+    // The children share the spill stream, so they are visited sequentially
+    // rather than being scheduled as tasks
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        SpilledLowerForwardSolve
+        ( *info.children[c], *front.children[c], *X.children[c], spill );
+
+    // Restore this front's dense storage
+    if( front.spillOffset < 0 )
+        LogicError("Front was not spilled");
+    spill.seekg( front.spillOffset );
+    ReadFrontRecord( spill, front.LDense );
+
+    // Set up a workspace
+    auto& W = X.work;
+    const Int numRHS = X.matrix.Width();
+    W.Resize( front.Height(), numRHS );
+    auto WT = W( IR(0,info.size), ALL );
+    auto WB = W( IR(info.size,END), ALL );
+    WT = X.matrix;
+    Zero( WB );
+
+    // Update using the children (if they exist)
+    for( Int c=0; c<numChildren; ++c )
+    {
+        auto& childW = X.children[c]->work;
+        const Int childSize = info.children[c]->size;
+        const Int childHeight = childW.Height();
+        const Int childUSize = childHeight-childSize;
+
+        auto childU = childW( IR(childSize,childHeight), IR(0,numRHS) );
+        for( Int iChild=0; iChild<childUSize; ++iChild )
+        {
+            const Int iFront = info.childRelInds[c][iChild];
+            for( Int j=0; j<numRHS; ++j )
+                W(iFront,j) += childU(iChild,j);
+        }
+        childW.Empty();
+    }
+
+    // Solve against this front and release its dense storage again
+    FrontLowerForwardSolve( front, W );
+    front.LDense.Empty();
+
+    // Store this node's portion of the result
+    X.matrix = WT;
+}
+
+template<typename Field>
+void SpilledLowerBackwardSolve
+( const NodeInfo& info,
+        Front<Field>& front,
+        MatrixNode<Field>& X,
+        std::ifstream& spill,
+        bool conjugate )
+{
+    EL_DEBUG_CSE
+    const bool haveParent = X.parent != nullptr;
+    auto& W = ( haveParent ? X.work : X.matrix );
+
+    // Restore this front's dense storage around the solve
+    if( front.spillOffset < 0 )
+        LogicError("Front was not spilled");
+    spill.seekg( front.spillOffset );
+    ReadFrontRecord( spill, front.LDense );
+    FrontLowerBackwardSolve( front, W, conjugate );
+    front.LDense.Empty();
+
+    const Int numRHS = X.matrix.Width();
+    if( haveParent )
+        X.matrix = W( IR(0,info.size), IR(0,numRHS) );
+
+    const Int numChildren = front.children.size();
+    for( Int c=0; c<numChildren; ++c )
+    {
+        // Set up a workspace for the child, computing its height from the
+        // symbolic analysis since its dense storage is not resident
+        auto& childW = X.children[c]->work;
+        const Int childSize = info.children[c]->size;
+        const Int childHeight =
+          childSize + Int(info.children[c]->lowerStruct.size());
+        childW.Resize( childHeight, numRHS );
+        auto childWT = childW( IR(0,childSize), ALL );
+        auto childWB = childW( IR(childSize,END), ALL );
+        childWT = X.children[c]->matrix;
+
+        // Update the child's workspace
+        const Int childUSize = childWB.Height();
+        for( Int iChild=0; iChild<childUSize; ++iChild )
+        {
+            const Int i = info.childRelInds[c][iChild];
+            for( Int j=0; j<numRHS; ++j )
+                childWB(iChild,j) = W(i,j);
+        }
+    }
+    if( haveParent )
+        X.work.Empty();
+
+    // The children share the spill stream, so they are visited sequentially
+    // rather than being scheduled as tasks
+    for( Int c=0; c<numChildren; ++c )
+        SpilledLowerBackwardSolve
+        ( *info.children[c], *front.children[c], *X.children[c],
+          spill, conjugate );
+}
+
+#define PROTO(Field) \
+  template void SpillFronts \
+  ( Front<Field>& front, const string& spillFile ); \
+  template void UnspillFronts \
+  ( Front<Field>& front, const string& spillFile ); \
+  template void SpilledLowerForwardSolve \
+  ( const NodeInfo& info, \
+          Front<Field>& front, \
+          MatrixNode<Field>& X, \
+          std::ifstream& spill ); \
+  template void SpilledLowerBackwardSolve \
+  ( const NodeInfo& info, \
+          Front<Field>& front, \
+          MatrixNode<Field>& X, \
+          std::ifstream& spill, \
+          bool conjugate );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
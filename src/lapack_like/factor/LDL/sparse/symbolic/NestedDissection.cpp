@@ -387,6 +387,84 @@ NestedDissectionRecursion
     }
 }
 
+// An estimate of the number of explicitly stored entries of a leaf's front
+// (the lower triangle of the top-left block plus the dense update rows)
+inline double FrontEntryEstimate( const NodeInfo& info )
+{
+    EL_DEBUG_CSE
+    const double size = info.size;
+    const double lowerSize = info.origLowerStruct.size();
+    if( !info.LOffsets.empty() )
+        return double(info.LOffsets.back()) + lowerSize*size;
+    else
+        return (size*(size+1))/2 + lowerSize*size;
+}
+
+inline void
+AmalgamateRecursion( Separator& sep, NodeInfo& info, double fillRatio )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        AmalgamateRecursion( *sep.children[c], *info.children[c], fillRatio );
+    if( numChildren != 2 )
+        return;
+    auto& leftInfo = *info.children[0];
+    auto& rightInfo = *info.children[1];
+    if( !leftInfo.children.empty() || !rightInfo.children.empty() )
+        return;
+
+    // The two leaves and this separator cover the contiguous column range
+    // [leftInfo.off,info.off+info.size), so absorbing both children preserves
+    // the assumption that each node eliminates a contiguous set of columns
+    // (and leaves the reordering untouched)
+    const Int mergedOff = leftInfo.off;
+    const Int mergedSize = leftInfo.size + rightInfo.size + info.size;
+    const Int mergedEnd = mergedOff + mergedSize;
+
+    // The children's connections either land within the merged column range
+    // or join this node's original structure, so the merged lower structure
+    // coincides with what the symbolic analysis would have produced here
+    set<Int> lowerStruct
+    ( info.origLowerStruct.begin(), info.origLowerStruct.end() );
+    for( const Int& i : leftInfo.origLowerStruct )
+        if( i >= mergedEnd )
+            lowerStruct.insert( i );
+    for( const Int& i : rightInfo.origLowerStruct )
+        if( i >= mergedEnd )
+            lowerStruct.insert( i );
+    const double mergedLowerSize = lowerStruct.size();
+
+    const double sepSize = info.size;
+    const double separateEntries =
+      FrontEntryEstimate(leftInfo) + FrontEntryEstimate(rightInfo) +
+      (sepSize*(sepSize+1))/2 + mergedLowerSize*sepSize;
+    const double mergedEntries =
+      (double(mergedSize)*(mergedSize+1))/2 + mergedLowerSize*mergedSize;
+    if( mergedEntries > fillRatio*separateEntries )
+        return;
+
+    // Absorb the children into this node, which becomes a dense leaf
+    // (it intentionally does not carry the SuiteSparse leaf symbolic data)
+    auto& leftSep = *sep.children[0];
+    auto& rightSep = *sep.children[1];
+    vector<Int> mergedInds;
+    mergedInds.reserve( mergedSize );
+    mergedInds.insert
+    ( mergedInds.end(), leftSep.inds.begin(), leftSep.inds.end() );
+    mergedInds.insert
+    ( mergedInds.end(), rightSep.inds.begin(), rightSep.inds.end() );
+    mergedInds.insert( mergedInds.end(), sep.inds.begin(), sep.inds.end() );
+    sep.inds.swap( mergedInds );
+    sep.off = mergedOff;
+    SwapClear( sep.children );
+
+    info.size = mergedSize;
+    info.off = mergedOff;
+    CopySTL( lowerStruct, info.origLowerStruct );
+    SwapClear( info.children );
+}
+
 void NestedDissection
 ( const Graph& graph,
         vector<Int>& map,
@@ -403,6 +481,11 @@ void NestedDissection
 
     NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
 
+    // Amalgamate pairs of small leaves into their parent separators so that
+    // the numeric factorization operates on larger dense fronts
+    if( ctrl.amalgFillRatio > 1 )
+        AmalgamateRecursion( sep, info, ctrl.amalgFillRatio );
+
     // Construct the distributed reordering
     sep.BuildMap( map );
     EL_DEBUG_ONLY(EnsurePermutation(map))
@@ -411,6 +494,119 @@ void NestedDissection
     Analysis( info );
 }
 
+void NestedDissection
+( const Graph& graph,
+  const vector<Int>& rootInds,
+        vector<Int>& map,
+        Separator& sep,
+        NodeInfo& info,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+
+    const Int numSources = graph.NumSources();
+    const Int rootSize = rootInds.size();
+
+    // Mark the pinned vertices and their positions within the root separator
+    vector<Int> rootPos( numSources, -1 );
+    for( Int t=0; t<rootSize; ++t )
+    {
+        const Int i = rootInds[t];
+        if( i < 0 || i >= numSources )
+            LogicError("Root index ",i," was out of bounds");
+        if( rootPos[i] != -1 )
+            LogicError("Root index ",i," was repeated");
+        rootPos[i] = t;
+    }
+    const Int numRemaining = numSources - rootSize;
+
+    // Form the induced subgraph of the unpinned vertices
+    vector<Int> subToOrig( numRemaining ), origToSub( numSources, -1 );
+    Int numSub = 0;
+    for( Int i=0; i<numSources; ++i )
+    {
+        if( rootPos[i] == -1 )
+        {
+            origToSub[i] = numSub;
+            subToOrig[numSub++] = i;
+        }
+    }
+    Graph subgraph( numRemaining );
+    const Int numEdges = graph.NumEdges();
+    subgraph.Reserve( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int source = graph.Source(e);
+        const Int target = graph.Target(e);
+        if( target < numSources &&
+            origToSub[source] != -1 && origToSub[target] != -1 )
+            subgraph.QueueConnection( origToSub[source], origToSub[target] );
+    }
+    subgraph.ProcessQueues();
+
+    // Install the pinned vertices as an artificial root separator and
+    // dissect the remainder of the graph beneath it
+    sep.off = numRemaining;
+    sep.inds = rootInds;
+    // TODO(poulson): Replace with better deletion mechanism
+    SwapClear( sep.children );
+    info.size = rootSize;
+    info.off = numRemaining;
+    info.origLowerStruct.clear();
+    // TODO(poulson): Replace with better deletion mechanism
+    SwapClear( info.children );
+    if( numRemaining > 0 )
+    {
+        sep.children.emplace_back( new Separator(&sep) );
+        info.children.emplace_back( new NodeInfo(&info) );
+        NestedDissectionRecursion
+        ( subgraph, subToOrig, *sep.children.back(), *info.children.back(),
+          0, ctrl );
+        if( ctrl.amalgFillRatio > 1 )
+            AmalgamateRecursion
+            ( *sep.children.back(), *info.children.back(),
+              ctrl.amalgFillRatio );
+
+        // The dissection of the subgraph was unaware of the pinned vertices,
+        // so append each node's connections into the root separator to its
+        // original lower structure (such indices follow every subgraph index,
+        // so sortedness is preserved); the fill between the descendants and
+        // the root block is then propagated by the symbolic analysis below
+        const Int* offsetBuf = graph.LockedOffsetBuffer();
+        const Int* targetBuf = graph.LockedTargetBuffer();
+        function<void(const Separator&,NodeInfo&)> augment =
+          [&]( const Separator& sepNode, NodeInfo& infoNode )
+          {
+            const Int numChildren = sepNode.children.size();
+            for( Int c=0; c<numChildren; ++c )
+                augment( *sepNode.children[c], *infoNode.children[c] );
+            set<Int> rootConn;
+            for( const Int source : sepNode.inds )
+            {
+                const Int edgeOff = offsetBuf[source];
+                const Int numConn = offsetBuf[source+1] - edgeOff;
+                for( Int t=0; t<numConn; ++t )
+                {
+                    const Int target = targetBuf[edgeOff+t];
+                    if( target < numSources && rootPos[target] != -1 )
+                        rootConn.insert( numRemaining + rootPos[target] );
+                }
+            }
+            for( const Int i : rootConn )
+                infoNode.origLowerStruct.push_back( i );
+          };
+        augment( *sep.children.back(), *info.children.back() );
+    }
+
+    // Construct the reordering, which places the pinned vertices last
+    // (in their given order)
+    sep.BuildMap( map );
+    EL_DEBUG_ONLY(EnsurePermutation(map))
+
+    // Run the symbolic analysis
+    Analysis( info );
+}
+
 void NestedDissection
 ( const DistGraph& graph,
         DistMap& map,
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./Monitor.hpp"
+
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
 #include "./LU/Full.hpp"
@@ -16,6 +18,18 @@
 
 namespace El {
 
+namespace {
+
+bool luTournamentPivoting = false;
+
+} // anonymous namespace
+
+void SetLUTournamentPivoting( bool tournament )
+{ luTournamentPivoting = tournament; }
+
+bool LUTournamentPivoting()
+{ return luTournamentPivoting; }
+
 // Performs LU factorization without pivoting
 
 template<typename F>
@@ -26,6 +40,8 @@ void LU( Matrix<F>& A )
     const Int n = A.Width();
     const Int minDim = Min(m,n);
     const Int bsize = Blocksize();
+    const FactorMonitor& monitor = LUMonitor();
+    const double growthBaseline = factor_monitor::GrowthBaseline( monitor, A );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -37,6 +53,7 @@ void LU( Matrix<F>& A )
         auto A22 = A( ind2, ind2 );
 
         lu::Unb( A11 );
+        factor_monitor::ReportPanel( monitor, A11, k, growthBaseline );
         Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11, A21 );
         Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
         Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
@@ -44,9 +61,10 @@ void LU( Matrix<F>& A )
 }
 
 template<typename F>
-void LU( AbstractDistMatrix<F>& APre )
+void LU( AbstractDistMatrix<F>& APre, const TuningCtrl& tuning )
 {
     EL_DEBUG_CSE
+    BlocksizeGuard nbGuard( tuning.blocksize );
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -61,6 +79,8 @@ void LU( AbstractDistMatrix<F>& APre )
     const Int n = A.Width();
     const Int minDim = Min(m,n);
     const Int bsize = Blocksize();
+    const FactorMonitor& monitor = LUMonitor();
+    const double growthBaseline = factor_monitor::GrowthBaseline( monitor, A );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -73,6 +93,7 @@ void LU( AbstractDistMatrix<F>& APre )
 
         A11_STAR_STAR = A11;
         LU( A11_STAR_STAR );
+        factor_monitor::ReportPanel( monitor, A11_STAR_STAR, k, growthBaseline );
         A11 = A11_STAR_STAR;
 
         A21_MC_STAR.AlignWith( A22 );
@@ -116,6 +137,9 @@ void LU( Matrix<F>& A, Permutation& P )
 
     Permutation PB;
 
+    const FactorMonitor& monitor = LUMonitor();
+    const double growthBaseline = factor_monitor::GrowthBaseline( monitor, A );
+
     // Temporaries for accumulating partial permutations for each block
     for( Int k=0; k<minDim; k+=bsize )
     {
@@ -135,6 +159,7 @@ void LU( Matrix<F>& A, Permutation& P )
         lu::Panel( AB1, P, PB, k );
         PB.PermuteRows( AB0 );
         PB.PermuteRows( AB2 );
+        factor_monitor::ReportPanel( monitor, A11, k, growthBaseline );
 
         Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
         Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
@@ -152,9 +177,12 @@ void LU
 }
 
 template<typename F>
-void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
+void LU
+( AbstractDistMatrix<F>& APre, DistPermutation& P,
+  const TuningCtrl& tuning )
 {
     EL_DEBUG_CSE
+    BlocksizeGuard nbGuard( tuning.blocksize );
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -176,6 +204,8 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
+    const FactorMonitor& monitor = LUMonitor();
+    const double growthBaseline = factor_monitor::GrowthBaseline( monitor, A );
     const Int bsize = Blocksize();
     for( Int k=0; k<minDim; k+=bsize )
     {
@@ -199,7 +229,11 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
         ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
         A11_STAR_STAR = A11;
         A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        if( LUTournamentPivoting() )
+            lu::PanelTournament( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        factor_monitor::ReportPanel( monitor, A11_STAR_STAR, k, growthBaseline );
 
         PB.PermuteRows( AB );
 
@@ -232,14 +266,16 @@ void LU
 
 #define PROTO(F) \
   template void LU( Matrix<F>& A ); \
-  template void LU( AbstractDistMatrix<F>& A ); \
+  template void LU \
+  ( AbstractDistMatrix<F>& A, const TuningCtrl& tuning ); \
   template void LU( DistMatrix<F,STAR,STAR>& A ); \
   template void LU \
   ( Matrix<F>& A, \
     Permutation& P ); \
   template void LU \
   ( AbstractDistMatrix<F>& A, \
-    DistPermutation& P ); \
+    DistPermutation& P, \
+    const TuningCtrl& tuning ); \
   template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
@@ -156,6 +156,224 @@ void Panel
     }
 }
 
+// Selects (up to) n winners from a stack of candidate rows via a partially
+// pivoted LU on a scratch copy, applying the same row swaps to the original
+// values and to the global row indices so that, on exit, the leading rows of
+// ZOrig hold the winning (unfactored) rows
+template<typename F>
+void TournamentRound( Matrix<F>& ZOrig, vector<Int>& inds )
+{
+    EL_DEBUG_CSE
+    const Int h = ZOrig.Height();
+    const Int n = ZOrig.Width();
+    const Int numWinners = Min( h, n );
+    Matrix<F> Z( ZOrig );
+    F* ZBuf = Z.Buffer();
+    F* ZOrigBuf = ZOrig.Buffer();
+    const Int ZLDim = Z.LDim();
+    const Int ZOrigLDim = ZOrig.LDim();
+    for( Int k=0; k<numWinners; ++k )
+    {
+        const Int iPiv = blas::MaxInd( h-k, &ZBuf[k+k*ZLDim], 1 ) + k;
+        if( iPiv != k )
+        {
+            blas::Swap( n, &ZBuf[k], ZLDim, &ZBuf[iPiv], ZLDim );
+            blas::Swap( n, &ZOrigBuf[k], ZOrigLDim, &ZOrigBuf[iPiv], ZOrigLDim );
+            std::swap( inds[k], inds[iPiv] );
+        }
+        const F alpha = ZBuf[k+k*ZLDim];
+        if( alpha == F(0) )
+            break; // the remaining candidates are linearly dependent
+        const F alpha11Inv = F(1) / alpha;
+        blas::Scal( h-(k+1), alpha11Inv, &ZBuf[(k+1)+k*ZLDim], 1 );
+        blas::Geru
+        ( h-(k+1), n-(k+1),
+          F(-1), &ZBuf[(k+1)+k*ZLDim], 1, &ZBuf[k+(k+1)*ZLDim], ZLDim,
+          &ZBuf[(k+1)+(k+1)*ZLDim], ZLDim );
+    }
+}
+
+// A tournament-pivoting ("CALU") analogue of the above panel factorization:
+// rather than one MaxLoc AllReduce (and a possible row broadcast) per column,
+// each process selects up to n pivot candidates from its local rows with a
+// partially pivoted LU and the winners are combined up a binary reduction
+// tree, so that only O(log p) latency-bound exchanges are needed per panel.
+// The pivot rows are selected from the unmodified panel, so the resulting
+// pivot sequence (harmlessly) differs from that of classical partial pivoting.
+template<typename F>
+void PanelTournament
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset,
+  vector<F>& pivotBuffer )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    F* ABuf = A.Buffer();
+    F* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = mpi::Rank( colComm );
+    const int colSize = mpi::Size( colComm );
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Buffer()+n != B.Buffer() )
+          LogicError("Buffers of A and B did not properly align");
+    )
+
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+
+    // Stack the local candidate rows (the replicated top block is assigned
+    // to the root of the column team) and select local winners
+    const Int topHeight = ( colRank == 0 ? n : 0 );
+    const Int stackHeight = topHeight + BLocHeight;
+    Matrix<F> cand( stackHeight, n );
+    vector<Int> candInds( stackHeight );
+    for( Int i=0; i<topHeight; ++i )
+        candInds[i] = i;
+    for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+        candInds[topHeight+iLoc] = B.GlobalRow(iLoc) + n;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<topHeight; ++i )
+            cand(i,j) = ABuf[i+j*ALDim];
+        for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+            cand(topHeight+iLoc,j) = BBuf[iLoc+j*BLDim];
+    }
+    TournamentRound( cand, candInds );
+    Int numCand = Min( stackHeight, n );
+
+    // Combine the winners up a binary reduction tree
+    for( int dist=1; dist<colSize; dist*=2 )
+    {
+        if( colRank % (2*dist) == 0 )
+        {
+            const int partner = colRank + dist;
+            if( partner >= colSize )
+                continue;
+            const Int recvCount = mpi::Recv<Int>( partner, colComm );
+            Matrix<F> merged( numCand+recvCount, n );
+            vector<Int> mergedInds( numCand+recvCount );
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<numCand; ++i )
+                    merged(i,j) = cand(i,j);
+            for( Int i=0; i<numCand; ++i )
+                mergedInds[i] = candInds[i];
+            if( recvCount > 0 )
+            {
+                Matrix<F> recvRows( recvCount, n );
+                mpi::Recv
+                ( recvRows.Buffer(), recvCount*n, partner, colComm );
+                mpi::Recv( &mergedInds[numCand], recvCount, partner, colComm );
+                for( Int j=0; j<n; ++j )
+                    for( Int i=0; i<recvCount; ++i )
+                        merged(numCand+i,j) = recvRows(i,j);
+            }
+            TournamentRound( merged, mergedInds );
+            numCand = Min( merged.Height(), n );
+            cand = merged;
+            candInds = mergedInds;
+        }
+        else
+        {
+            const int partner = colRank - dist;
+            mpi::Send( numCand, partner, colComm );
+            if( numCand > 0 )
+            {
+                Matrix<F> sendRows( numCand, n );
+                for( Int j=0; j<n; ++j )
+                    for( Int i=0; i<numCand; ++i )
+                        sendRows(i,j) = cand(i,j);
+                mpi::Send
+                ( sendRows.LockedBuffer(), numCand*n, partner, colComm );
+                mpi::Send( candInds.data(), numCand, partner, colComm );
+            }
+            break;
+        }
+    }
+
+    // The root's candidate stack includes the entire top block, so it always
+    // retains a full set of n winners; broadcast their stacked indices
+    vector<Int> winners( n );
+    if( colRank == 0 )
+        for( Int k=0; k<n; ++k )
+            winners[k] = candInds[k];
+    mpi::Broadcast( winners.data(), n, 0, colComm );
+
+    // Pivot the winning rows to the top of the panel
+    const Int totalHeight = A.Height() + B.Height();
+    vector<Int> pos(totalHeight), at(totalHeight);
+    for( Int i=0; i<totalHeight; ++i )
+    {
+        pos[i] = i;
+        at[i] = i;
+    }
+    pivotBuffer.resize( n );
+    for( Int k=0; k<n; ++k )
+    {
+        const Int iPiv = pos[winners[k]];
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+        if( iPiv == k )
+            continue;
+
+        const Int kOld = at[k], iPivOld = at[iPiv];
+        std::swap( at[k], at[iPiv] );
+        pos[kOld] = iPiv;
+        pos[iPivOld] = k;
+
+        if( iPiv < n )
+        {
+            blas::Swap( n, &ABuf[iPiv], ALDim, &ABuf[k], ALDim );
+        }
+        else
+        {
+            // The owning row of the pivot row packs it into the row buffer
+            // and then overwrites with the current row
+            const Int relIndex = iPiv - n;
+            const int ownerRow = B.RowOwner(relIndex);
+            if( B.IsLocalRow(relIndex) )
+            {
+                const Int iLoc = B.LocalRow(relIndex);
+                for( Int j=0; j<n; ++j )
+                    pivotBuffer[j] = BBuf[iLoc+j*BLDim];
+                for( Int j=0; j<n; ++j )
+                    BBuf[iLoc+j*BLDim] = ABuf[k+j*ALDim];
+            }
+            // The owning row broadcasts within process columns
+            mpi::Broadcast( pivotBuffer.data(), n, ownerRow, colComm );
+            // Overwrite the current row with the pivot row
+            for( Int j=0; j<n; ++j )
+                ABuf[k+j*ALDim] = pivotBuffer[j];
+        }
+    }
+
+    // Eliminate without any further pivoting
+    for( Int k=0; k<n; ++k )
+    {
+        const Int ind2Size = n-k-1;
+        const F* a12Buf = &ABuf[ k    + (k+1)*ALDim];
+              F* a21Buf = &ABuf[(k+1) +  k   *ALDim];
+              F* A22Buf = &ABuf[(k+1) + (k+1)*ALDim];
+
+        const F alpha = ABuf[k+k*ALDim];
+        if( alpha == F(0) )
+            throw SingularMatrixException();
+        const F alpha11Inv = F(1) / alpha;
+        blas::Scal( ind2Size+BLocHeight, alpha11Inv, a21Buf, 1 );
+        blas::Geru
+        ( ind2Size+BLocHeight, ind2Size, F(-1),
+          a21Buf, 1, a12Buf, ALDim, A22Buf, ALDim );
+    }
+}
+
 } // namespace lu
 } // namespace El
 
@@ -0,0 +1,33 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace {
+
+El::FactorMonitor luMonitor, choleskyMonitor, ldlMonitor;
+
+} // anonymous namespace
+
+namespace El {
+
+void SetLUMonitor( FactorMonitor monitor )
+{ ::luMonitor = std::move(monitor); }
+void SetCholeskyMonitor( FactorMonitor monitor )
+{ ::choleskyMonitor = std::move(monitor); }
+void SetLDLMonitor( FactorMonitor monitor )
+{ ::ldlMonitor = std::move(monitor); }
+
+const FactorMonitor& LUMonitor()
+{ return ::luMonitor; }
+const FactorMonitor& CholeskyMonitor()
+{ return ::choleskyMonitor; }
+const FactorMonitor& LDLMonitor()
+{ return ::ldlMonitor; }
+
+} // namespace El
@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_MONITOR_HPP
+#define EL_FACTOR_MONITOR_HPP
+
+namespace El {
+namespace factor_monitor {
+
+// The reference against which LU growth factors are measured: the largest
+// entry magnitude of the original matrix (or one, should the matrix be
+// zero). A zero return disables growth tracking and is produced when no
+// monitor is registered, so that an unmonitored factorization never pays
+// for the extra norm.
+template<typename F>
+double GrowthBaseline( const FactorMonitor& monitor, const Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    if( !monitor )
+        return 0;
+    const double maxAbs = double(MaxNorm( A ));
+    return ( maxAbs > 0 ? maxAbs : 1 );
+}
+
+// The distributed baseline involves an AllReduce but is likewise only
+// formed (once, before the factorization loop) when a monitor exists
+template<typename F>
+double GrowthBaseline
+( const FactorMonitor& monitor, const AbstractDistMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    if( !monitor )
+        return 0;
+    const double maxAbs = double(MaxNorm( A ));
+    return ( maxAbs > 0 ? maxAbs : 1 );
+}
+
+// Fold the diagonal of a factored diagonal block (and, when a growth
+// baseline was supplied, its entry of largest magnitude) into per-panel
+// statistics and hand them to the monitor
+template<typename F>
+void ReportPanel
+( const FactorMonitor& monitor,
+  const Matrix<F>& D,
+  Int offset,
+  double growthBaseline=0 )
+{
+    EL_DEBUG_CSE
+    if( !monitor )
+        return;
+    const Int nb = Min( D.Height(), D.Width() );
+    if( nb == 0 )
+        return;
+    FactorMonitorStats stats;
+    stats.offset = offset;
+    stats.panelSize = nb;
+    stats.minAbsPivot = stats.maxAbsPivot = double(Abs(D(0,0)));
+    for( Int j=1; j<nb; ++j )
+    {
+        const double absPivot = double(Abs(D(j,j)));
+        stats.minAbsPivot = Min( stats.minAbsPivot, absPivot );
+        stats.maxAbsPivot = Max( stats.maxAbsPivot, absPivot );
+    }
+    if( growthBaseline > 0 )
+    {
+        double maxAbsEntry = 0;
+        const Int height = D.Height();
+        const Int width = D.Width();
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<height; ++i )
+                maxAbsEntry = Max( maxAbsEntry, double(Abs(D(i,j))) );
+        stats.growthFactor = maxAbsEntry / growthBaseline;
+    }
+    monitor( stats );
+}
+
+// The [*,*] diagonal blocks are stored redundantly, so every rank scans
+// its own copy and reports identical statistics
+template<typename F>
+void ReportPanel
+( const FactorMonitor& monitor,
+  const DistMatrix<F,STAR,STAR>& D,
+  Int offset,
+  double growthBaseline=0 )
+{ ReportPanel( monitor, D.LockedMatrix(), offset, growthBaseline ); }
+
+// Report an explicitly stored pivot column (e.g., the diagonal of a
+// sparse LDL front)
+template<typename F>
+void ReportPivots
+( const FactorMonitor& monitor, const Matrix<F>& d, Int offset )
+{
+    EL_DEBUG_CSE
+    if( !monitor )
+        return;
+    const Int nb = d.Height();
+    if( nb == 0 )
+        return;
+    FactorMonitorStats stats;
+    stats.offset = offset;
+    stats.panelSize = nb;
+    stats.minAbsPivot = stats.maxAbsPivot = double(Abs(d(0,0)));
+    for( Int j=1; j<nb; ++j )
+    {
+        const double absPivot = double(Abs(d(j,0)));
+        stats.minAbsPivot = Min( stats.minAbsPivot, absPivot );
+        stats.maxAbsPivot = Max( stats.maxAbsPivot, absPivot );
+    }
+    monitor( stats );
+}
+
+} // namespace factor_monitor
+} // namespace El
+
+#endif // ifndef EL_FACTOR_MONITOR_HPP
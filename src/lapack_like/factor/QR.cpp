@@ -18,9 +18,22 @@
 #include "./QR/ColSwap.hpp"
 
 #include "./QR/TS.hpp"
+#include "./QR/TSHouseholder.hpp"
 
 namespace El {
 
+namespace {
+
+Int tsqrAspectThreshold = 16;
+
+} // anonymous namespace
+
+void SetTSQRAspectThreshold( Int threshold )
+{ tsqrAspectThreshold = threshold; }
+
+Int TSQRAspectThreshold()
+{ return tsqrAspectThreshold; }
+
 template<typename F>
 void QR
 ( Matrix<F>& A,
@@ -72,7 +85,14 @@ void QR
   AbstractDistMatrix<Base<F>>& signature )
 {
     EL_DEBUG_CSE
-    qr::Householder( A, householderScalars, signature );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int p = A.Grid().Size();
+    if( n > 0 && m >= TSQRAspectThreshold()*n &&
+        m >= p*n && PowerOfTwo(p) )
+        qr::TSHouseholder( A, householderScalars, signature );
+    else
+        qr::Householder( A, householderScalars, signature );
 }
 
 // Variants which perform (Businger-Golub) column-pivoting
@@ -30,6 +30,7 @@ Householder
     signature.Resize( minDim, 1 );
 
     const Int bsize = Blocksize();
+    Matrix<F> T, VPan, Z;
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -43,8 +44,21 @@ Householder
         auto householderScalars1 = householderScalars( ind1, ALL );
         auto sig1 = signature( ind1, ALL );
 
-        PanelHouseholder( AB1, householderScalars1, sig1 );
-        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+        // The fused panel kernel hands back the compact-WY triangle, so the
+        // trailing update can apply Q^H = (I - V T V^H)^H directly rather
+        // than reconstructing the triangle from the panel
+        PanelHouseholder( AB1, householderScalars1, sig1, T );
+        if( n > k+nb )
+        {
+            VPan = AB1;
+            MakeTrapezoidal( LOWER, VPan );
+            FillDiagonal( VPan, F(1) );
+            Gemm( ADJOINT, NORMAL, F(1), VPan, AB2, Z );
+            Trmm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), T, Z );
+            Gemm( NORMAL, NORMAL, F(-1), VPan, Z, F(1), AB2 );
+            auto AB2Top = AB2( IR(0,nb), ALL );
+            DiagonalScale( LEFT, NORMAL, sig1, AB2Top );
+        }
     }
 }
 
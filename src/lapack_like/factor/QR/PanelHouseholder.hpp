@@ -67,6 +67,145 @@ void PanelHouseholder
     DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
 }
 
+namespace panel_householder {
+
+// Generate the reflectors of the panel while accumulating the compact-WY
+// triangle
+//
+//   H_0 H_1 ... H_{n-1} = I - V T V^H
+//
+// one column at a time (in the style of LAPACK's xLARFT), so that no
+// separate pass over the panel is needed before the trailing update
+template<typename F>
+void Unblocked( Matrix<F>& A, Matrix<F>& householderScalars, Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+
+    Matrix<F> z21;
+
+    for( Int k=0; k<n; ++k )
+    {
+        const Range<Int> ind1( k ), ind2( k+1, END ), indB( k, END );
+
+        auto alpha11 = A( ind1, ind1 );
+        auto a21     = A( ind2, ind1 );
+        auto aB1     = A( indB, ind1 );
+        auto AB2     = A( indB, ind2 );
+
+        const F tau = LeftReflector( alpha11, a21 );
+        householderScalars(k) = tau;
+
+        // Temporarily set aB1 = | 1 |
+        //                       | u |
+        const F alpha = alpha11(0);
+        alpha11(0) = 1;
+
+        // AB2 := (I - tau aB1 aB1^H) AB2
+        Zeros( z21, AB2.Width(), 1 );
+        Gemv( ADJOINT, F(1), AB2, aB1, F(0), z21 );
+        Ger( -tau, aB1, z21, AB2 );
+
+        // Fold the new reflector into the accumulated triangle via
+        // T(0:k,k) := -tau T(0:k,0:k) (V(k:m,0:k)^H aB1)
+        if( k > 0 )
+        {
+            auto V0  = A( indB, IR(0,k) );
+            auto T00 = T( IR(0,k), IR(0,k) );
+            auto t01 = T( IR(0,k), ind1 );
+            Gemv( ADJOINT, -tau, V0, aB1, F(0), t01 );
+            Trmv( UPPER, NORMAL, NON_UNIT, T00, t01 );
+        }
+        T(k,k) = tau;
+
+        // Replace alpha11's value
+        alpha11(0) = alpha;
+    }
+}
+
+// Split the panel in half so that the bulk of the intra-panel updates are
+// applied as GEMMs via the left half's accumulated triangle; the coupling
+// block of T is filled in afterwards via T01 := -T00 (V_L^H V_R) T11
+template<typename F>
+void Recursive( Matrix<F>& A, Matrix<F>& householderScalars, Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( n <= 8 )
+    {
+        Unblocked( A, householderScalars, T );
+        return;
+    }
+    const Int nL = n/2;
+
+    auto AL  = A( ALL, IR(0,nL) );
+    auto AR  = A( ALL, IR(nL,n) );
+    auto ABR = A( IR(nL,m), IR(nL,n) );
+    auto householderScalarsL = householderScalars( IR(0,nL), ALL );
+    auto householderScalarsR = householderScalars( IR(nL,n), ALL );
+    auto T00 = T( IR(0,nL), IR(0,nL) );
+    auto T01 = T( IR(0,nL), IR(nL,n) );
+    auto T11 = T( IR(nL,n), IR(nL,n) );
+
+    Recursive( AL, householderScalarsL, T00 );
+
+    // AR := (I - V_L T00 V_L^H)^H AR
+    Matrix<F> VL( AL ), Z;
+    MakeTrapezoidal( LOWER, VL );
+    FillDiagonal( VL, F(1) );
+    Gemm( ADJOINT, NORMAL, F(1), VL, AR, Z );
+    Trmm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), T00, Z );
+    Gemm( NORMAL, NORMAL, F(-1), VL, Z, F(1), AR );
+
+    Recursive( ABR, householderScalarsR, T11 );
+
+    // T01 := -T00 (V_L(nL:m,:)^H V_R) T11
+    Matrix<F> VBR( ABR );
+    MakeTrapezoidal( LOWER, VBR );
+    FillDiagonal( VBR, F(1) );
+    auto VL2 = VL( IR(nL,m), ALL );
+    Gemm( ADJOINT, NORMAL, F(-1), VL2, VBR, T01 );
+    Trmm( LEFT,  UPPER, NORMAL, NON_UNIT, F(1), T00, T01 );
+    Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T11, T01 );
+}
+
+} // namespace panel_householder
+
+// A fused variant of the panel kernel which also returns the upper
+// triangle T of the compact-WY representation, accumulated during
+// reflector generation instead of being rebuilt from the panel by the
+// trailing update
+template<typename F>
+void PanelHouseholder
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    EL_DEBUG_ONLY(
+      if( m < n )
+          LogicError("The fused panel kernel assumes m >= n");
+    )
+    householderScalars.Resize( n, 1 );
+    signature.Resize( n, 1 );
+    Zeros( T, n, n );
+
+    panel_householder::Recursive( A, householderScalars, T );
+
+    // Form d and rescale R
+    auto R = A( IR(0,n), ALL );
+    GetRealPartOfDiagonal(R,signature);
+    auto sgn = []( const Real& delta )
+               { return delta >= Real(0) ? Real(1) : Real(-1); };
+    EntrywiseMap( signature, MakeFunction(sgn) );
+    DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+}
+
 template<typename F>
 void PanelHouseholder
 ( DistMatrix<F>& A,
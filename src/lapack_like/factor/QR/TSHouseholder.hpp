@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_TS_HOUSEHOLDER_HPP
+#define EL_QR_TS_HOUSEHOLDER_HPP
+
+#include "./TS.hpp"
+
+namespace El {
+namespace qr {
+
+// Factors a tall-skinny matrix with a single binary-tree reduction (TSQR)
+// and then reconstructs the standard compact Householder representation from
+// the explicit thin factors, following Ballard et al., "Reconstructing
+// Householder vectors from Tall-Skinny QR": choosing the sign matrix S from
+// the running diagonal, the unpivoted LU of Q - S is [Y1; Y2] U with Y unit
+// lower-trapezoidal, and Y holds the Householder vectors of A with scalars
+// tau_k = -u_kk conj(s_k). Only the replicated leading n x n block
+// participates in the LU, and the remaining rows satisfy Y2 = Q2 inv(U), so
+// the reconstruction requires no communication beyond forming the explicit
+// factors.
+template<typename F>
+void TSHouseholder
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = APre.Width();
+    const Grid& g = APre.Grid();
+
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Real,Real,MD,STAR> signatureProx( signaturePre );
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+    householderScalars.Resize( n, 1 );
+    signature.Resize( n, 1 );
+
+    // Factor with a single reduction tree and form the explicit thin factors
+    DistMatrix<F,VC,STAR> Q(g);
+    Q = APre;
+    auto treeData = TS( Q );
+    auto R = ts::FormR( Q, treeData );
+    ts::FormQ( Q, treeData );
+
+    // Perform the unpivoted LU of Q - S on the replicated leading block,
+    // choosing each s_k from the running diagonal (which guarantees pivots
+    // of magnitude at least one, since the eliminated columns are unit
+    // vectors scaled by the previous signs)
+    DistMatrix<F,STAR,STAR> B(g);
+    B = Q( IR(0,n), ALL );
+    F* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    vector<F> s(n);
+    for( Int k=0; k<n; ++k )
+    {
+        const F delta = BBuf[k+k*BLDim];
+        const Real absDelta = Abs(delta);
+        s[k] = ( absDelta == Real(0) ? F(-1) : -delta/absDelta );
+        BBuf[k+k*BLDim] = delta - s[k];
+
+        const F upsilon = BBuf[k+k*BLDim];
+        blas::Scal( n-(k+1), F(1)/upsilon, &BBuf[(k+1)+k*BLDim], 1 );
+        blas::Geru
+        ( n-(k+1), n-(k+1),
+          F(-1), &BBuf[(k+1)+k*BLDim], 1, &BBuf[k+(k+1)*BLDim], BLDim,
+          &BBuf[(k+1)+(k+1)*BLDim], BLDim );
+    }
+    for( Int k=0; k<n; ++k )
+        householderScalars.Set( k, 0, -BBuf[k+k*BLDim]*Conj(s[k]) );
+
+    // Rescale R by S and then flip rows to match the convention that the
+    // real parts of R's diagonal are non-negative
+    Matrix<F>& RLoc = R.Matrix();
+    for( Int i=0; i<n; ++i )
+    {
+        const F si = s[i];
+        for( Int j=i; j<n; ++j )
+            RLoc(i,j) *= si;
+        const Real sigma =
+          ( RealPart(RLoc(i,i)) >= Real(0) ? Real(1) : Real(-1) );
+        if( sigma < Real(0) )
+            for( Int j=i; j<n; ++j )
+                RLoc(i,j) = -RLoc(i,j);
+        signature.Set( i, 0, sigma );
+    }
+
+    // Solve for the lower portion of Y and overwrite the leading rows with
+    // Y1's strictly lower part and the rescaled R
+    F* QBuf = Q.Buffer();
+    const Int QLDim = Q.LDim();
+    const Int localOffset = Q.LocalRowOffset( n );
+    const Int localBottom = Q.LocalHeight() - localOffset;
+    blas::Trsm
+    ( 'R', 'U', 'N', 'N', localBottom, n,
+      F(1), BBuf, BLDim, &QBuf[localOffset], QLDim );
+    for( Int iLoc=0; iLoc<localOffset; ++iLoc )
+    {
+        const Int i = Q.GlobalRow( iLoc );
+        for( Int j=0; j<i; ++j )
+            QBuf[iLoc+j*QLDim] = BBuf[i+j*BLDim];
+        for( Int j=i; j<n; ++j )
+            QBuf[iLoc+j*QLDim] = RLoc(i,j);
+    }
+    Copy( Q, APre );
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_TS_HOUSEHOLDER_HPP
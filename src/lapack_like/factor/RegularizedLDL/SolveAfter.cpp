@@ -23,12 +23,17 @@ Int RegularizedSolveAfterNoPromote
         bool time )
 {
     EL_DEBUG_CSE
-    auto applyA =
-      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
-      {
-        Y = X;
-        DiagonalScale( LEFT, NORMAL, reg, Y ); 
-        Multiply( NORMAL, Field(1), A, X, Field(1), Y );
+    // Accumulate the sparse portion of each residual with compensated
+    // arithmetic so that the refinement loop sees residuals of (roughly)
+    // doubled accuracy without promoting the entire solve; the (tiny)
+    // regularization term is subtracted in the working precision.
+    auto applyResidual =
+      [&]( const Matrix<Field>& B0, const Matrix<Field>& X, Matrix<Field>& R )
+      {
+        CompensatedResidual( B0, A, X, R );
+        Matrix<Field> regX( X );
+        DiagonalScale( LEFT, NORMAL, reg, regX );
+        R -= regX;
       };
     auto applyAInv =
       [&]( Matrix<Field>& Y )
@@ -36,8 +41,8 @@ Int RegularizedSolveAfterNoPromote
         sparseLDLFact.Solve( Y );
       };
     return
-      RefinedSolve 
-      ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+      CompensatedRefinedSolve
+      ( applyResidual, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
 template<typename Field>
@@ -55,21 +60,23 @@ Int RegularizedSolveAfterNoPromote
     EL_DEBUG_CSE
 
     // TODO(poulson): Use time in these lambdas
-    auto applyA =
-      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+    auto applyResidual =
+      [&]( const Matrix<Field>& B0, const Matrix<Field>& X, Matrix<Field>& R )
       {
-        Y = X;
-        DiagonalScale( LEFT, NORMAL, reg, Y ); 
-        Multiply( NORMAL, Field(1), A, X, Field(1), Y );
+        CompensatedResidual( B0, A, X, R );
+        Matrix<Field> regX( X );
+        DiagonalScale( LEFT, NORMAL, reg, regX );
+        R -= regX;
       };
-    auto applyAInv = 
+    auto applyAInv =
       [&]( Matrix<Field>& Y )
       {
         DiagonalSolve( LEFT, NORMAL, d, Y );
         sparseLDLFact.Solve( Y );
         DiagonalSolve( LEFT, NORMAL, d, Y );
       };
-    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+    return CompensatedRefinedSolve
+      ( applyResidual, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
 template<typename Field>
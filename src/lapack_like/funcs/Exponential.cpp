@@ -0,0 +1,289 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Scaling-and-squaring evaluation of the matrix exponential with diagonal
+// Pade approximants, following Awad H. Al-Mohy and Nicholas J. Higham's
+// "A new scaling and squaring algorithm for the matrix exponential",
+// SIAM J. Matrix Anal. Appl., 2009. The Pade degree is chosen from the
+// one-norms of the even powers of A formed during the evaluation (which
+// bound ||A^k||^{1/k} far more tightly than ||A|| for nonnormal matrices),
+// and only degree 13 triggers scaling, with the power chosen so that the
+// backward error is of order the unit roundoff. The double-precision
+// degree thresholds are rescaled to other precisions through the leading
+// term of the backward-error series, theta_m ~ u^{1/(2m+1)}.
+
+namespace El {
+
+namespace matrix_exp {
+
+template<typename Real>
+Real PadeTheta( Int m )
+{
+    // Degree thresholds from Table 3.1 of Al-Mohy and Higham (2009)
+    double thetaDouble;
+    switch( m )
+    {
+    case 3:  thetaDouble = 1.495585217958292e-2; break;
+    case 5:  thetaDouble = 2.539398330063230e-1; break;
+    case 7:  thetaDouble = 9.504178996162932e-1; break;
+    case 9:  thetaDouble = 2.097847961257068e0;  break;
+    default: thetaDouble = 5.371920351148152e0;  break;
+    }
+    const Real eps = limits::Epsilon<Real>();
+    const Real epsDouble = Real(limits::Epsilon<double>());
+    return Real(thetaDouble)*Pow( eps/epsDouble, Real(1)/Real(2*m+1) );
+}
+
+inline vector<double> PadeCoefficients( Int m )
+{
+    switch( m )
+    {
+    case 3:
+        return vector<double>{ 120., 60., 12., 1. };
+    case 5:
+        return vector<double>{ 30240., 15120., 3360., 420., 30., 1. };
+    case 7:
+        return vector<double>
+        { 17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1. };
+    case 9:
+        return vector<double>
+        { 17643225600., 8821612800., 2075673600., 302702400., 30270240.,
+          2162160., 110880., 3960., 90., 1. };
+    default:
+        return vector<double>
+        { 64764752532480000., 32382376266240000., 7771770303897600.,
+          1187353796428800., 129060195264000., 10559470521600.,
+          670442572800., 33522128640., 1323241920., 40840800., 960960.,
+          16380., 182., 1. };
+    }
+}
+
+// Form U and V such that the degree-m diagonal Pade approximant of exp(A)
+// is (V-U)^{-1} (V+U); 'powers' holds A^2, A^4, ..., A^{m-1}
+template<typename F,class MatrixType>
+void PadeLow
+( Int m,
+  const MatrixType& A,
+  const vector<const MatrixType*>& powers,
+        MatrixType& U,
+        MatrixType& V )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const auto b = PadeCoefficients( m );
+
+    // U = A (b_1 I + b_3 A^2 + ... + b_m A^{m-1})
+    // V =    b_0 I + b_2 A^2 + ... + b_{m-1} A^{m-1}
+    MatrixType W( A );
+    Identity( W, n, n );
+    Scale( F(Real(b[1])), W );
+    Identity( V, n, n );
+    Scale( F(Real(b[0])), V );
+    const Int numPowers = (m-1)/2;
+    for( Int k=0; k<numPowers; ++k )
+    {
+        Axpy( F(Real(b[2*k+3])), *powers[k], W );
+        Axpy( F(Real(b[2*k+2])), *powers[k], V );
+    }
+    Gemm( NORMAL, NORMAL, F(1), A, W, U );
+}
+
+// The degree-13 evaluation scheme of Higham (2005), which reuses A^6
+// rather than forming A^8, A^10, and A^12
+template<typename F,class MatrixType>
+void Pade13
+( const MatrixType& A,
+  const MatrixType& A2,
+  const MatrixType& A4,
+  const MatrixType& A6,
+        MatrixType& U,
+        MatrixType& V )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const auto b = PadeCoefficients( 13 );
+
+    MatrixType W( A ), Z( A6 );
+    Scale( F(Real(b[13])), Z );
+    Axpy( F(Real(b[11])), A4, Z );
+    Axpy( F(Real(b[9])), A2, Z );
+    Gemm( NORMAL, NORMAL, F(1), A6, Z, W );
+    Axpy( F(Real(b[7])), A6, W );
+    Axpy( F(Real(b[5])), A4, W );
+    Axpy( F(Real(b[3])), A2, W );
+    ShiftDiagonal( W, F(Real(b[1])) );
+    Gemm( NORMAL, NORMAL, F(1), A, W, U );
+
+    Z = A6;
+    Scale( F(Real(b[12])), Z );
+    Axpy( F(Real(b[10])), A4, Z );
+    Axpy( F(Real(b[8])), A2, Z );
+    Gemm( NORMAL, NORMAL, F(1), A6, Z, V );
+    Axpy( F(Real(b[6])), A6, V );
+    Axpy( F(Real(b[4])), A4, V );
+    Axpy( F(Real(b[2])), A2, V );
+    ShiftDiagonal( V, F(Real(b[0])) );
+}
+
+// Overwrite X with (V-U)^{-1} (V+U)
+template<typename F>
+void PadeSolve( const Matrix<F>& U, const Matrix<F>& V, Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    Matrix<F> Q( V );
+    Axpy( F(-1), U, Q );
+    X = V;
+    Axpy( F(1), U, X );
+    Permutation P;
+    LU( Q, P );
+    lu::SolveAfter( NORMAL, Q, P, X );
+}
+
+template<typename F>
+void PadeSolve
+( const DistMatrix<F>& U, const DistMatrix<F>& V, DistMatrix<F>& X )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F> Q( V );
+    Axpy( F(-1), U, Q );
+    X = V;
+    Axpy( F(1), U, X );
+    DistPermutation P( Q.Grid() );
+    LU( Q, P );
+    lu::SolveAfter( NORMAL, Q, P, X );
+}
+
+template<typename F,class MatrixType>
+void ScalingAndSquaring( MatrixType& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( n == 0 )
+        return;
+
+    MatrixType U( A ), V( A ), X( A );
+    const Real normA = OneNorm( A );
+    Int s = 0;
+    if( normA <= PadeTheta<Real>(3) || normA <= PadeTheta<Real>(5) )
+    {
+        MatrixType A2( A );
+        Gemm( NORMAL, NORMAL, F(1), A, A, A2 );
+        const Int m = ( normA <= PadeTheta<Real>(3) ? 3 : 5 );
+        vector<const MatrixType*> powers{ &A2 };
+        if( m == 5 )
+        {
+            MatrixType A4( A );
+            Gemm( NORMAL, NORMAL, F(1), A2, A2, A4 );
+            powers.push_back( &A4 );
+            PadeLow<F>( m, A, powers, U, V );
+        }
+        else
+            PadeLow<F>( m, A, powers, U, V );
+    }
+    else
+    {
+        MatrixType A2( A ), A4( A ), A6( A );
+        Gemm( NORMAL, NORMAL, F(1), A, A, A2 );
+        Gemm( NORMAL, NORMAL, F(1), A2, A2, A4 );
+        Gemm( NORMAL, NORMAL, F(1), A2, A4, A6 );
+
+        // The norms of the formed powers give a much sharper proxy for the
+        // decay of the Taylor remainder than ||A|| when A is nonnormal
+        const Real d4 = Pow( OneNorm(A4), Real(1)/Real(4) );
+        const Real d6 = Pow( OneNorm(A6), Real(1)/Real(6) );
+        const Real eta = Max( d4, d6 );
+        if( eta <= PadeTheta<Real>(7) )
+        {
+            vector<const MatrixType*> powers{ &A2, &A4, &A6 };
+            PadeLow<F>( 7, A, powers, U, V );
+        }
+        else if( eta <= PadeTheta<Real>(9) )
+        {
+            MatrixType A8( A );
+            Gemm( NORMAL, NORMAL, F(1), A2, A6, A8 );
+            vector<const MatrixType*> powers{ &A2, &A4, &A6, &A8 };
+            PadeLow<F>( 9, A, powers, U, V );
+        }
+        else
+        {
+            // Scale A by 2^{-s} so that the degree-13 approximant is
+            // backward stable, reusing the already-formed powers
+            const Real theta13 = PadeTheta<Real>(13);
+            Real t = eta/theta13;
+            while( t > Real(1) )
+            {
+                t /= 2;
+                ++s;
+            }
+            if( s > 0 )
+            {
+                const Real scale = Pow( Real(2), Real(-s) );
+                const Real scale2 = scale*scale;
+                Scale( F(scale), A );
+                Scale( F(scale2), A2 );
+                Scale( F(scale2*scale2), A4 );
+                Scale( F(scale2*scale2*scale2), A6 );
+            }
+            Pade13<F>( A, A2, A4, A6, U, V );
+        }
+    }
+    PadeSolve( U, V, X );
+
+    // Undo the scaling through repeated squaring
+    MatrixType* cur = &X;
+    MatrixType* next = &V;
+    for( Int i=0; i<s; ++i )
+    {
+        Gemm( NORMAL, NORMAL, F(1), *cur, *cur, *next );
+        std::swap( cur, next );
+    }
+    A = *cur;
+}
+
+} // namespace matrix_exp
+
+template<typename Field>
+void Exponential( Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    matrix_exp::ScalingAndSquaring<Field,Matrix<Field>>( A );
+}
+
+template<typename Field>
+void Exponential( AbstractDistMatrix<Field>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    matrix_exp::ScalingAndSquaring<Field,DistMatrix<Field>>( A );
+}
+
+#define PROTO(Field) \
+  template void Exponential( Matrix<Field>& A ); \
+  template void Exponential( AbstractDistMatrix<Field>& A );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
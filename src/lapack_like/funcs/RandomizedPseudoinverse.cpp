@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// A rank-adaptive randomized pseudoinverse in the style of Halko,
+// Martinsson, and Tropp's randomized range finder: Gaussian sketch blocks
+// are projected against the captured basis and orthonormalized until the
+// (stochastically estimated) residual norm falls below the tolerance, at
+// which point A ~= Q (Q^H A) with Q having numerical-rank many columns,
+// and pinv(A) ~= pinv(Q^H A) Q^H only requires the SVD of the small
+// projected factor. When the numerical rank k is far smaller than
+// min(m,n), the cost drops from O(m n min(m,n)) to O(m n k).
+
+namespace El {
+
+template<typename Field>
+Int RandomizedPseudoinverse
+( const Matrix<Field>& A,
+        Matrix<Field>& APinv,
+  Base<Field> tolerance,
+  Int blockSize,
+  Int maxRank )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min( m, n );
+    if( blockSize < 1 )
+        LogicError("blockSize must be positive");
+    if( maxRank <= 0 || maxRank > minDim )
+        maxRank = minDim;
+    const Real eps = limits::Epsilon<Real>();
+    const Real relTol = ( tolerance == Real(0) ? Max(m,n)*eps : tolerance );
+    const Real normA = FrobeniusNorm( A );
+    if( normA == Real(0) )
+    {
+        Zeros( APinv, n, m );
+        return 0;
+    }
+
+    // Adaptively capture an orthonormal basis of the range, one Gaussian
+    // sketch block at a time
+    Matrix<Field> Q, G, Y, T;
+    Int rank = 0;
+    while( rank < maxRank )
+    {
+        const Int l = Min( blockSize, maxRank-rank );
+        Gaussian( G, n, l );
+        Gemm( NORMAL, NORMAL, Field(1), A, G, Y );
+        if( rank > 0 )
+        {
+            // Project out the captured range (twice, to limit the loss of
+            // orthogonality from a single pass)
+            Gemm( ADJOINT, NORMAL, Field(1), Q, Y, T );
+            Gemm( NORMAL, NORMAL, Field(-1), Q, T, Field(1), Y );
+            Gemm( ADJOINT, NORMAL, Field(1), Q, Y, T );
+            Gemm( NORMAL, NORMAL, Field(-1), Q, T, Field(1), Y );
+        }
+
+        // The scaled block norm is a stochastic estimate of the Frobenius
+        // norm of (I - Q Q^H) A (cf. FrobeniusNormEstimate)
+        const Real resEst = FrobeniusNorm(Y)/Sqrt(Real(l));
+        if( resEst <= relTol*normA )
+            break;
+
+        qr::ExplicitUnitary( Y );
+        Matrix<Field> QNew( m, rank+l );
+        auto QNewL = QNew( ALL, IR(0,rank) );
+        auto QNewR = QNew( ALL, IR(rank,rank+l) );
+        QNewL = Q;
+        QNewR = Y;
+        Q = QNew;
+        rank += l;
+    }
+    if( rank == 0 )
+    {
+        Zeros( APinv, n, m );
+        return 0;
+    }
+
+    // A ~= Q B with B := Q^H A, so that pinv(A) ~= pinv(B) Q^H; the small
+    // dense pseudoinverse also truncates any oversampled directions
+    Matrix<Field> B;
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+    Pseudoinverse( B, tolerance );
+    Gemm( NORMAL, ADJOINT, Field(1), B, Q, APinv );
+    return rank;
+}
+
+template<typename Field>
+Int RandomizedPseudoinverse
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& APinvPre,
+  Base<Field> tolerance,
+  Int blockSize,
+  Int maxRank )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> APinvProx( APinvPre );
+    auto& A = AProx.GetLocked();
+    auto& APinv = APinvProx.Get();
+    const Grid& g = A.Grid();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min( m, n );
+    if( blockSize < 1 )
+        LogicError("blockSize must be positive");
+    if( maxRank <= 0 || maxRank > minDim )
+        maxRank = minDim;
+    const Real eps = limits::Epsilon<Real>();
+    const Real relTol = ( tolerance == Real(0) ? Max(m,n)*eps : tolerance );
+    const Real normA = FrobeniusNorm( A );
+    if( normA == Real(0) )
+    {
+        Zeros( APinv, n, m );
+        return 0;
+    }
+
+    // Adaptively capture an orthonormal basis of the range, one Gaussian
+    // sketch block at a time
+    DistMatrix<Field> Q(g), G(g), Y(g), T(g);
+    Int rank = 0;
+    while( rank < maxRank )
+    {
+        const Int l = Min( blockSize, maxRank-rank );
+        Gaussian( G, n, l );
+        Gemm( NORMAL, NORMAL, Field(1), A, G, Y );
+        if( rank > 0 )
+        {
+            // Project out the captured range (twice, to limit the loss of
+            // orthogonality from a single pass)
+            Gemm( ADJOINT, NORMAL, Field(1), Q, Y, T );
+            Gemm( NORMAL, NORMAL, Field(-1), Q, T, Field(1), Y );
+            Gemm( ADJOINT, NORMAL, Field(1), Q, Y, T );
+            Gemm( NORMAL, NORMAL, Field(-1), Q, T, Field(1), Y );
+        }
+
+        // The scaled block norm is a stochastic estimate of the Frobenius
+        // norm of (I - Q Q^H) A (cf. FrobeniusNormEstimate)
+        const Real resEst = FrobeniusNorm(Y)/Sqrt(Real(l));
+        if( resEst <= relTol*normA )
+            break;
+
+        qr::ExplicitUnitary( Y );
+        DistMatrix<Field> QNew( m, rank+l, g );
+        auto QNewL = QNew( ALL, IR(0,rank) );
+        auto QNewR = QNew( ALL, IR(rank,rank+l) );
+        QNewL = Q;
+        QNewR = Y;
+        Q = QNew;
+        rank += l;
+    }
+    if( rank == 0 )
+    {
+        Zeros( APinv, n, m );
+        return 0;
+    }
+
+    // A ~= Q B with B := Q^H A, so that pinv(A) ~= pinv(B) Q^H; the small
+    // dense pseudoinverse also truncates any oversampled directions
+    DistMatrix<Field> B(g);
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+    Pseudoinverse( B, tolerance );
+    Gemm( NORMAL, ADJOINT, Field(1), B, Q, APinv );
+    return rank;
+}
+
+#define PROTO(Field) \
+  template Int RandomizedPseudoinverse \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& APinv, \
+    Base<Field> tolerance, \
+    Int blockSize, \
+    Int maxRank ); \
+  template Int RandomizedPseudoinverse \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& APinv, \
+    Base<Field> tolerance, \
+    Int blockSize, \
+    Int maxRank );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
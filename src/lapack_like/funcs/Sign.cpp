@@ -91,10 +91,10 @@ NewtonSchulzStep
 
     // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(3), XTmp );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), X, XTmp, XNew );
 }
 
 template<typename Field>
@@ -110,10 +110,10 @@ NewtonSchulzStep
 
     // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(3), XTmp );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), X, XTmp, XNew );
 }
 
 // Please see Chapter 5 of Higham's
@@ -197,7 +197,157 @@ Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
+// Begin with scaled Newton iterations (which require an inverse apiece)
+// and switch to the inverse-free Newton-Schulz iteration once it is
+// locally convergent, which is guaranteed when || I - X^2 ||_2 < 1; we
+// monitor the cheap upper bound || I - X^2 ||_1, which costs a single
+// Gemm per iteration rather than a factorization
+template<typename Field>
+Int
+NewtonSchulzHybrid( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = n*limits::Epsilon<Real>();
+
+    Int numIts=0;
+    Matrix<Field> B, E;
+    Matrix<Field> *X=&A, *XNew=&B;
+    bool contractive = false;
+    while( numIts < ctrl.maxIts && !contractive )
+    {
+        // Overwrite XNew with the new iterate
+        NewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate
+        ++numIts;
+        std::swap( X, XNew );
+
+        // Test whether Newton-Schulz has become locally convergent
+        Identity( E, n, n );
+        Gemm( NORMAL, NORMAL, Field(-1), *X, *X, Field(1), E );
+        const Real oneErr = OneNorm( E );
+        contractive = ( oneErr < Real(1) );
+
+        if( ctrl.progress )
+            cout << "after " << numIts << " Newton iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew
+                 << ", ||I-X^2||_1=" << oneErr << ", tol=" << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        {
+            if( X != &A )
+                A = *X;
+            return numIts;
+        }
+    }
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new (inverse-free) iterate
+        NewtonSchulzStep( *X, E, *XNew );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress )
+            cout << "after " << numIts << " Newton-Schulz iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+template<typename Field>
+Int
+NewtonSchulzHybrid( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = n*limits::Epsilon<Real>();
+
+    Int numIts=0;
+    DistMatrix<Field> B(g), E(g);
+    DistMatrix<Field> *X=&A, *XNew=&B;
+    bool contractive = false;
+    while( numIts < ctrl.maxIts && !contractive )
+    {
+        // Overwrite XNew with the new iterate
+        NewtonStep( *X, *XNew, ctrl.scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate
+        ++numIts;
+        std::swap( X, XNew );
+
+        // Test whether Newton-Schulz has become locally convergent
+        Identity( E, n, n );
+        Gemm( NORMAL, NORMAL, Field(-1), *X, *X, Field(1), E );
+        const Real oneErr = OneNorm( E );
+        contractive = ( oneErr < Real(1) );
+
+        if( ctrl.progress && g.Rank() == 0 )
+            cout << "after " << numIts << " Newton iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew
+                 << ", ||I-X^2||_1=" << oneErr << ", tol=" << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        {
+            if( X != &A )
+                A = *X;
+            return numIts;
+        }
+    }
+    while( numIts < ctrl.maxIts )
+    {
+        // Overwrite XNew with the new (inverse-free) iterate
+        NewtonSchulzStep( *X, E, *XNew );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( Real(-1), *XNew, *X );
+        const Real oneDiff = OneNorm( *X );
+        const Real oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( ctrl.progress && g.Rank() == 0 )
+            cout << "after " << numIts << " Newton-Schulz iter's: "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+                 << tol << endl;
+        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+            break;
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
 
 } // namespace sign
 
@@ -205,7 +355,10 @@ template<typename Field>
 void Sign( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl )
 {
     EL_DEBUG_CSE
-    sign::Newton( A, ctrl );
+    if( ctrl.newtonSchulzHybrid )
+        sign::NewtonSchulzHybrid( A, ctrl );
+    else
+        sign::Newton( A, ctrl );
 }
 
 template<typename Field>
@@ -214,7 +367,10 @@ void Sign
 {
     EL_DEBUG_CSE
     Matrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    if( ctrl.newtonSchulzHybrid )
+        sign::NewtonSchulzHybrid( A, ctrl );
+    else
+        sign::Newton( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
 }
 
@@ -226,7 +382,10 @@ void Sign( AbstractDistMatrix<Field>& APre, const SignCtrl<Base<Field>> ctrl )
     DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    sign::Newton( A, ctrl );
+    if( ctrl.newtonSchulzHybrid )
+        sign::NewtonSchulzHybrid( A, ctrl );
+    else
+        sign::Newton( A, ctrl );
 }
 
 template<typename Field>
@@ -243,7 +402,10 @@ void Sign
     auto& N = NProx.Get();
 
     DistMatrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    if( ctrl.newtonSchulzHybrid )
+        sign::NewtonSchulzHybrid( A, ctrl );
+    else
+        sign::Newton( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
 }
 
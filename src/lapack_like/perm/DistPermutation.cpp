@@ -212,6 +212,93 @@ void PermuteRows
     }
 }
 
+// Permute the rows of every matrix in the batch with a single aggregated
+// exchange: within each destination rank, the pivot rows are packed
+// matrix-by-matrix, so that one AllToAll (with the counts scaled by the
+// batch's total local width) carries the data of the entire batch
+template<typename T>
+void PermuteRowBatch
+(       vector<AbstractDistMatrix<T>*>& batch,
+  const PermutationMeta& oldMeta,
+  bool inverse=false )
+{
+    EL_DEBUG_CSE
+    const Int numMatrices = batch.size();
+    Int totalWidth = 0;
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        EL_DEBUG_ONLY(
+          if( batch[k]->ColComm() != oldMeta.comm )
+              LogicError("Invalid communicator in metadata");
+          if( batch[k]->ColAlign() != oldMeta.align )
+              LogicError("Invalid alignment in metadata");
+        )
+        totalWidth += batch[k]->LocalWidth();
+    }
+    if( numMatrices == 0 || totalWidth == 0 || !batch[0]->Participating() )
+        return;
+
+    PermutationMeta meta = oldMeta;
+    meta.ScaleUp( totalWidth );
+
+    auto& idxOut = ( inverse ? meta.recvIdx : meta.sendIdx );
+    auto& ranksOut = ( inverse ? meta.recvRanks : meta.sendRanks );
+    auto& countsOut = ( inverse ? meta.recvCounts : meta.sendCounts );
+    auto& displsOut = ( inverse ? meta.recvDispls : meta.sendDispls );
+    auto& idxIn = ( inverse ? meta.sendIdx : meta.recvIdx );
+    auto& ranksIn = ( inverse ? meta.sendRanks : meta.recvRanks );
+    auto& countsIn = ( inverse ? meta.sendCounts : meta.recvCounts );
+    auto& displsIn = ( inverse ? meta.sendDispls : meta.recvDispls );
+
+    // Fill vectors with the send data
+    auto offsets = displsOut;
+    const int totalSend = ( inverse ? meta.TotalRecv() : meta.TotalSend() );
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(totalSend) );
+    const int numSends = idxOut.size();
+    for( int send=0; send<numSends; ++send )
+    {
+        const int iLoc = idxOut[send];
+        const int rank = ranksOut[send];
+        for( Int k=0; k<numMatrices; ++k )
+        {
+            auto& A = *batch[k];
+            const Int localWidth = A.LocalWidth();
+            StridedMemCopy
+            ( &sendData[offsets[rank]], 1,
+              &A.Buffer()[iLoc], A.LDim(), localWidth );
+            offsets[rank] += localWidth;
+        }
+    }
+
+    // Communicate all pivot rows
+    const int totalRecv = ( inverse ? meta.TotalSend() : meta.TotalRecv() );
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendData.data(), countsOut.data(), displsOut.data(),
+      recvData.data(), countsIn.data(), displsIn.data(),
+      meta.comm );
+
+    // Unpack the recv data
+    offsets = displsIn;
+    const int numRecvs = idxIn.size();
+    for( int recv=0; recv<numRecvs; ++recv )
+    {
+        const int iLoc = idxIn[recv];
+        const int rank = ranksIn[recv];
+        for( Int k=0; k<numMatrices; ++k )
+        {
+            auto& A = *batch[k];
+            const Int localWidth = A.LocalWidth();
+            StridedMemCopy
+            ( &A.Buffer()[iLoc], A.LDim(),
+              &recvData[offsets[rank]], 1, localWidth );
+            offsets[rank] += localWidth;
+        }
+    }
+}
+
 void InvertPermutation
 ( const AbstractDistMatrix<Int>& pPre,
         AbstractDistMatrix<Int>& pInvPre )
@@ -1064,6 +1151,112 @@ void DistPermutation::InversePermuteRows
     }
 }
 
+template<typename T>
+void DistPermutation::PermuteRows
+( vector<AbstractDistMatrix<T>*>& batch ) const
+{
+    EL_DEBUG_CSE
+    if( batch.size() == 0 )
+        return;
+
+    // A swap sequence would trigger the full swap protocol once per matrix,
+    // so convert to an explicit permutation and share its metadata
+    if( swapSequence_ )
+        MakeArbitrary();
+
+    if( staleMeta_ )
+    {
+        rowMeta_.clear();
+        colMeta_.clear();
+        staleMeta_ = false;
+    }
+    if( staleInverse_ )
+    {
+        InvertPermutation( perm_, invPerm_ );
+        staleInverse_ = false;
+    }
+
+    // Group the matrices by their alignment keys and perform one
+    // aggregated exchange per group
+    std::map<keyType_,vector<AbstractDistMatrix<T>*>> groups;
+    for( auto* APtr : batch )
+        groups[keyType_(APtr->ColAlign(),APtr->ColComm())].push_back( APtr );
+    for( auto& group : groups )
+    {
+        const keyType_& key = group.first;
+        auto data = rowMeta_.find( key );
+        if( data == rowMeta_.end() )
+        {
+#ifdef EL_HAVE_STD_EMPLACE
+            rowMeta_.emplace
+            ( std::piecewise_construct,
+              std::forward_as_tuple(key),
+              std::forward_as_tuple
+              (perm_,invPerm_,key.first,key.second) );
+#else
+            auto newPair =
+              std::make_pair
+              (key,PermutationMeta(perm_,invPerm_,key.first,key.second));
+            rowMeta_.insert( newPair );
+#endif
+            data = rowMeta_.find( key );
+        }
+        El::PermuteRowBatch( group.second, data->second );
+    }
+}
+
+template<typename T>
+void DistPermutation::InversePermuteRows
+( vector<AbstractDistMatrix<T>*>& batch ) const
+{
+    EL_DEBUG_CSE
+    if( batch.size() == 0 )
+        return;
+
+    // A swap sequence would trigger the full swap protocol once per matrix,
+    // so convert to an explicit permutation and share its metadata
+    if( swapSequence_ )
+        MakeArbitrary();
+
+    if( staleMeta_ )
+    {
+        rowMeta_.clear();
+        colMeta_.clear();
+        staleMeta_ = false;
+    }
+    if( staleInverse_ )
+    {
+        InvertPermutation( perm_, invPerm_ );
+        staleInverse_ = false;
+    }
+
+    std::map<keyType_,vector<AbstractDistMatrix<T>*>> groups;
+    for( auto* APtr : batch )
+        groups[keyType_(APtr->ColAlign(),APtr->ColComm())].push_back( APtr );
+    for( auto& group : groups )
+    {
+        const keyType_& key = group.first;
+        auto data = rowMeta_.find( key );
+        if( data == rowMeta_.end() )
+        {
+#ifdef EL_HAVE_STD_EMPLACE
+            rowMeta_.emplace
+            ( std::piecewise_construct,
+              std::forward_as_tuple(key),
+              std::forward_as_tuple
+              (perm_,invPerm_,key.first,key.second) );
+#else
+            auto newPair =
+              std::make_pair
+              (key,PermutationMeta(perm_,invPerm_,key.first,key.second));
+            rowMeta_.insert( newPair );
+#endif
+            data = rowMeta_.find( key );
+        }
+        El::PermuteRowBatch( group.second, data->second, true );
+    }
+}
+
 template<typename T>
 void DistPermutation::PermuteSymmetrically
 ( UpperOrLower uplo,
@@ -1228,6 +1421,77 @@ void DistPermutation::ExplicitMatrix( AbstractDistMatrix<Int>& P ) const
         P.Set( i, pLoc(i), 1 );
 }
 
+DistPermutationPlan::DistPermutationPlan() { }
+
+DistPermutationPlan::DistPermutationPlan
+( const DistPermutation& P, Int colAlign, mpi::Comm colComm )
+{
+    EL_DEBUG_CSE
+    Build( P, colAlign, colComm );
+}
+
+void DistPermutationPlan::Build
+( const DistPermutation& P, Int colAlign, mpi::Comm colComm )
+{
+    EL_DEBUG_CSE
+    size_ = P.Height();
+    // Snapshot the permutation (forcing it to be explicit) and compile the
+    // exchange metadata for the requested column distribution
+    DistMatrix<Int,STAR,STAR> p, pInv;
+    P.ExplicitVector( p );
+    pInv.SetGrid( p.Grid() );
+    InvertPermutation( p, pInv );
+    meta_.Update( p, pInv, colAlign, colComm );
+    ready_ = true;
+}
+
+template<typename T>
+void DistPermutationPlan::PermuteRows( AbstractDistMatrix<T>& A ) const
+{
+    EL_DEBUG_CSE
+    if( !ready_ )
+        LogicError("The permutation plan has not been compiled");
+    El::PermuteRows( A, meta_ );
+}
+
+template<typename T>
+void DistPermutationPlan::InversePermuteRows( AbstractDistMatrix<T>& A ) const
+{
+    EL_DEBUG_CSE
+    if( !ready_ )
+        LogicError("The permutation plan has not been compiled");
+    El::PermuteRows( A, meta_, true );
+}
+
+template<typename T>
+void DistPermutationPlan::PermuteRows
+( vector<AbstractDistMatrix<T>*>& batch ) const
+{
+    EL_DEBUG_CSE
+    if( !ready_ )
+        LogicError("The permutation plan has not been compiled");
+    El::PermuteRowBatch( batch, meta_ );
+}
+
+template<typename T>
+void DistPermutationPlan::InversePermuteRows
+( vector<AbstractDistMatrix<T>*>& batch ) const
+{
+    EL_DEBUG_CSE
+    if( !ready_ )
+        LogicError("The permutation plan has not been compiled");
+    El::PermuteRowBatch( batch, meta_, true );
+}
+
+bool DistPermutationPlan::Ready() const EL_NO_EXCEPT
+{ return ready_; }
+
+Int DistPermutationPlan::Height() const EL_NO_EXCEPT
+{ return size_; }
+
+Int DistPermutationPlan::Width() const EL_NO_EXCEPT
+{ return size_; }
+
 #define PROTO(T) \
   template void DistPermutation::PermuteCols \
   ( AbstractDistMatrix<T>& A, \
@@ -1241,6 +1505,18 @@ void DistPermutation::ExplicitMatrix( AbstractDistMatrix<Int>& P ) const
   template void DistPermutation::InversePermuteRows \
   ( AbstractDistMatrix<T>& A, \
     Int offset ) const; \
+  template void DistPermutation::PermuteRows \
+  ( vector<AbstractDistMatrix<T>*>& batch ) const; \
+  template void DistPermutation::InversePermuteRows \
+  ( vector<AbstractDistMatrix<T>*>& batch ) const; \
+  template void DistPermutationPlan::PermuteRows \
+  ( AbstractDistMatrix<T>& A ) const; \
+  template void DistPermutationPlan::InversePermuteRows \
+  ( AbstractDistMatrix<T>& A ) const; \
+  template void DistPermutationPlan::PermuteRows \
+  ( vector<AbstractDistMatrix<T>*>& batch ) const; \
+  template void DistPermutationPlan::InversePermuteRows \
+  ( vector<AbstractDistMatrix<T>*>& batch ) const; \
   template void DistPermutation::PermuteSymmetrically \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<T>& A, \
@@ -101,4 +101,14 @@ PermutationMeta::PermutationMeta
     )
 }
 
+void PermutationMeta::Update
+( const DistMatrix<Int,STAR,STAR>& perm,
+  const DistMatrix<Int,STAR,STAR>& invPerm,
+        Int permAlign,
+        mpi::Comm permComm )
+{
+    EL_DEBUG_CSE
+    *this = PermutationMeta( perm, invPerm, permAlign, permComm );
+}
+
 } // namespace El
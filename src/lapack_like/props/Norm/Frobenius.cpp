@@ -149,17 +149,48 @@ Base<Field> FrobeniusNorm( const AbstractDistMatrix<Field>& A )
     Real norm;
     if( A.Participating() )
     {
-        Real localScale=0, localScaledSquare=1;
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
         const Matrix<Field>& ALoc = A.LockedMatrix();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                UpdateScaledSquare
-                ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
+        if( ReproducibleReductionsEnabled() )
+        {
+            // Pre-rounding requires element-level addends, so the scaled
+            // squares are materialized rather than locally accumulated
+            Real localMax = 0;
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    localMax = Max( localMax, Abs(ALoc(iLoc,jLoc)) );
+            const Real scale =
+              mpi::AllReduce( localMax, mpi::MAX, A.DistComm() );
+            if( scale == Real(0) )
+                norm = 0;
+            else
+            {
+                vector<Real> terms( localHeight*localWidth );
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                {
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    {
+                        const Real relAbs = Abs(ALoc(iLoc,jLoc))/scale;
+                        terms[iLoc+jLoc*localHeight] = relAbs*relAbs;
+                    }
+                }
+                norm = scale*Sqrt(
+                  ReproducibleAllReduceSum
+                  ( terms.data(), localHeight*localWidth, A.DistComm() ) );
+            }
+        }
+        else
+        {
+            Real localScale=0, localScaledSquare=1;
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    UpdateScaledSquare
+                    ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
 
-        norm = NormFromScaledSquare
-          ( localScale, localScaledSquare, A.DistComm() );
+            norm = NormFromScaledSquare
+              ( localScale, localScaledSquare, A.DistComm() );
+        }
     }
     mpi::Broadcast( norm, A.Root(), A.CrossComm() );
     return norm;
@@ -0,0 +1,312 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Hager/Higham one-norm estimation: each iteration applies A to the current
+// probe vector and A^H to the sign pattern of the product, then either
+// certifies the estimate via a duality check or jumps to the coordinate
+// vector of the largest entry of the adjoint apply. The estimate is a lower
+// bound on ||A||_1 which is almost always within a small factor of the truth,
+// and each iteration costs one apply of A and one of A^H rather than the
+// full O(m n) pass of an exact one-norm computation.
+
+namespace El {
+
+namespace {
+
+template<typename Field>
+function<Field(const Field&)> SignMap()
+{
+    return []( const Field& alpha )
+           { return alpha == Field(0) ? Field(1) : alpha/Field(Abs(alpha)); };
+}
+
+} // anonymous namespace
+
+template<typename Field>
+Base<Field> OneNormEstimate( const Matrix<Field>& A, Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m == 0 || n == 0 )
+        return Real(0);
+
+    Matrix<Field> x, y, z, w;
+    Ones( x, n, 1 );
+    x *= Real(1)/Real(n);
+
+    Real estimate = 0;
+    Int lastIndex = -1;
+    for( Int numIts=0; numIts<maxIts; ++numIts )
+    {
+        Gemv( NORMAL, Field(1), A, x, y );
+        const Real newEst = OneNorm( y );
+        if( numIts > 0 && newEst <= estimate )
+            break;
+        estimate = newEst;
+
+        z = y;
+        EntrywiseMap( z, SignMap<Field>() );
+        Gemv( ADJOINT, Field(1), A, z, w );
+        const auto maxLoc = VectorMaxAbsLoc( w );
+        if( maxLoc.value <= RealPart(Dot(x,w)) || maxLoc.index == lastIndex )
+            break;
+        lastIndex = maxLoc.index;
+        Zeros( x, n, 1 );
+        x.Set( maxLoc.index, 0, Field(1) );
+    }
+    return estimate;
+}
+
+template<typename Field>
+Base<Field> OneNormEstimate( const AbstractDistMatrix<Field>& APre, Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m == 0 || n == 0 )
+        return Real(0);
+
+    const Grid& g = A.Grid();
+    DistMatrix<Field> x(g), y(g), z(g), w(g);
+    Ones( x, n, 1 );
+    x *= Real(1)/Real(n);
+
+    Real estimate = 0;
+    Int lastIndex = -1;
+    for( Int numIts=0; numIts<maxIts; ++numIts )
+    {
+        Gemv( NORMAL, Field(1), A, x, y );
+        const Real newEst = OneNorm( y );
+        if( numIts > 0 && newEst <= estimate )
+            break;
+        estimate = newEst;
+
+        z = y;
+        EntrywiseMap( z, SignMap<Field>() );
+        Gemv( ADJOINT, Field(1), A, z, w );
+        const auto maxLoc = VectorMaxAbsLoc( w );
+        if( maxLoc.value <= RealPart(Dot(x,w)) || maxLoc.index == lastIndex )
+            break;
+        lastIndex = maxLoc.index;
+        Zeros( x, n, 1 );
+        x.Set( maxLoc.index, 0, Field(1) );
+    }
+    return estimate;
+}
+
+template<typename Field>
+Base<Field> OneNormEstimate( const SparseMatrix<Field>& A, Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m == 0 || n == 0 )
+        return Real(0);
+
+    Matrix<Field> x, y, z, w;
+    Ones( x, n, 1 );
+    x *= Real(1)/Real(n);
+
+    Real estimate = 0;
+    Int lastIndex = -1;
+    for( Int numIts=0; numIts<maxIts; ++numIts )
+    {
+        Zeros( y, m, 1 );
+        Multiply( NORMAL, Field(1), A, x, Field(0), y );
+        const Real newEst = OneNorm( y );
+        if( numIts > 0 && newEst <= estimate )
+            break;
+        estimate = newEst;
+
+        z = y;
+        EntrywiseMap( z, SignMap<Field>() );
+        Zeros( w, n, 1 );
+        Multiply( ADJOINT, Field(1), A, z, Field(0), w );
+        const auto maxLoc = VectorMaxAbsLoc( w );
+        if( maxLoc.value <= RealPart(Dot(x,w)) || maxLoc.index == lastIndex )
+            break;
+        lastIndex = maxLoc.index;
+        Zeros( x, n, 1 );
+        x.Set( maxLoc.index, 0, Field(1) );
+    }
+    return estimate;
+}
+
+template<typename Field>
+Base<Field> OneNormEstimate( const DistSparseMatrix<Field>& A, Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m == 0 || n == 0 )
+        return Real(0);
+
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    DistMultiVec<Field> x(grid), y(grid), z(grid), w(grid);
+    Ones( x, n, 1 );
+    Scale( Real(1)/Real(n), x );
+
+    Real estimate = 0;
+    Int lastIndex = -1;
+    for( Int numIts=0; numIts<maxIts; ++numIts )
+    {
+        Zeros( y, m, 1 );
+        Multiply( NORMAL, Field(1), A, x, Field(0), y );
+        Real localOneNorm = 0;
+        for( Int iLoc=0; iLoc<y.LocalHeight(); ++iLoc )
+            localOneNorm += Abs(y.GetLocal(iLoc,0));
+        const Real newEst = mpi::AllReduce( localOneNorm, comm );
+        if( numIts > 0 && newEst <= estimate )
+            break;
+        estimate = newEst;
+
+        z = y;
+        EntrywiseMap( z, SignMap<Field>() );
+        Zeros( w, n, 1 );
+        Multiply( ADJOINT, Field(1), A, z, Field(0), w );
+        ValueInt<Real> localMax;
+        localMax.value = -1;
+        localMax.index = 0;
+        for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
+        {
+            const Real absVal = Abs(w.GetLocal(iLoc,0));
+            if( absVal > localMax.value )
+            {
+                localMax.value = absVal;
+                localMax.index = w.GlobalRow(iLoc);
+            }
+        }
+        const auto maxLoc =
+          mpi::AllReduce( localMax, mpi::MaxLocOp<Real>(), comm );
+        if( maxLoc.value <= RealPart(Dot(x,w)) || maxLoc.index == lastIndex )
+            break;
+        lastIndex = maxLoc.index;
+        Zeros( x, n, 1 );
+        x.Set( maxLoc.index, 0, Field(1) );
+    }
+    return estimate;
+}
+
+// A stochastic Frobenius-norm estimate: since E||A z||_2^2 = ||A||_F^2 for
+// Rademacher probe vectors z, a handful of simultaneous applies of A gives
+// an unbiased estimate without an entrywise pass over the matrix.
+
+template<typename Field>
+Base<Field> FrobeniusNormEstimate( const Matrix<Field>& A, Int numSamples )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( numSamples < 1 )
+        LogicError("Expected a positive number of samples");
+    if( A.Height() == 0 || A.Width() == 0 )
+        return Real(0);
+
+    Matrix<Field> Z, Y;
+    Rademacher( Z, A.Width(), numSamples );
+    Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+    return FrobeniusNorm( Y ) / Sqrt( Real(numSamples) );
+}
+
+template<typename Field>
+Base<Field> FrobeniusNormEstimate
+( const AbstractDistMatrix<Field>& APre, Int numSamples )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( numSamples < 1 )
+        LogicError("Expected a positive number of samples");
+    if( APre.Height() == 0 || APre.Width() == 0 )
+        return Real(0);
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    const Grid& g = A.Grid();
+    DistMatrix<Field> Z(g), Y(g);
+    Rademacher( Z, A.Width(), numSamples );
+    Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+    return FrobeniusNorm( Y ) / Sqrt( Real(numSamples) );
+}
+
+template<typename Field>
+Base<Field> FrobeniusNormEstimate
+( const SparseMatrix<Field>& A, Int numSamples )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( numSamples < 1 )
+        LogicError("Expected a positive number of samples");
+    if( A.Height() == 0 || A.Width() == 0 )
+        return Real(0);
+
+    Matrix<Field> Z, Y;
+    Rademacher( Z, A.Width(), numSamples );
+    Zeros( Y, A.Height(), numSamples );
+    Multiply( NORMAL, Field(1), A, Z, Field(0), Y );
+    return FrobeniusNorm( Y ) / Sqrt( Real(numSamples) );
+}
+
+template<typename Field>
+Base<Field> FrobeniusNormEstimate
+( const DistSparseMatrix<Field>& A, Int numSamples )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( numSamples < 1 )
+        LogicError("Expected a positive number of samples");
+    if( A.Height() == 0 || A.Width() == 0 )
+        return Real(0);
+
+    const Grid& grid = A.Grid();
+    DistMultiVec<Field> Z(grid), Y(grid);
+    Zeros( Z, A.Width(), numSamples );
+    // Each process can draw its local entries independently
+    Rademacher( Z.Matrix(), Z.LocalHeight(), numSamples );
+    Zeros( Y, A.Height(), numSamples );
+    Multiply( NORMAL, Field(1), A, Z, Field(0), Y );
+    return FrobeniusNorm( Y ) / Sqrt( Real(numSamples) );
+}
+
+#define PROTO(Field) \
+  template Base<Field> OneNormEstimate \
+  ( const Matrix<Field>& A, Int maxIts ); \
+  template Base<Field> OneNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, Int maxIts ); \
+  template Base<Field> OneNormEstimate \
+  ( const SparseMatrix<Field>& A, Int maxIts ); \
+  template Base<Field> OneNormEstimate \
+  ( const DistSparseMatrix<Field>& A, Int maxIts ); \
+  template Base<Field> FrobeniusNormEstimate \
+  ( const Matrix<Field>& A, Int numSamples ); \
+  template Base<Field> FrobeniusNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, Int numSamples ); \
+  template Base<Field> FrobeniusNormEstimate \
+  ( const SparseMatrix<Field>& A, Int numSamples ); \
+  template Base<Field> FrobeniusNormEstimate \
+  ( const DistSparseMatrix<Field>& A, Int numSamples );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
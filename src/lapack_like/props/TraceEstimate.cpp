@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Hutchinson's stochastic trace estimator: since E[z^H A z] = tr(A) for
+// Rademacher probe vectors z, averaging a handful of quadratic forms gives
+// an unbiased estimate whose cost is a few applies of A. For an explicitly
+// stored matrix the exact trace is of course cheaper; these drivers exist
+// for consistency with the implicit-operator use case (e.g., monitoring
+// tr(inv(A) B) style quantities by composing the apply with a solve).
+
+namespace El {
+
+template<typename Field>
+Field TraceEstimate( const Matrix<Field>& A, Int numSamples )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("Cannot estimate trace of nonsquare matrix");
+    if( numSamples < 1 )
+        LogicError("Expected a positive number of samples");
+    if( n == 0 )
+        return Field(0);
+
+    Matrix<Field> Z, Y;
+    Rademacher( Z, n, numSamples );
+    Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+    // The sum of the quadratic forms is the matched-column inner product
+    return Dot( Z, Y ) / Field(numSamples);
+}
+
+template<typename Field>
+Field TraceEstimate( const AbstractDistMatrix<Field>& APre, Int numSamples )
+{
+    EL_DEBUG_CSE
+    const Int n = APre.Height();
+    if( n != APre.Width() )
+        LogicError("Cannot estimate trace of nonsquare matrix");
+    if( numSamples < 1 )
+        LogicError("Expected a positive number of samples");
+    if( n == 0 )
+        return Field(0);
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    const Grid& g = A.Grid();
+    DistMatrix<Field> Z(g), Y(g);
+    Rademacher( Z, n, numSamples );
+    Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+    return Dot( Z, Y ) / Field(numSamples);
+}
+
+template<typename Field>
+Field TraceEstimate( const SparseMatrix<Field>& A, Int numSamples )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("Cannot estimate trace of nonsquare matrix");
+    if( numSamples < 1 )
+        LogicError("Expected a positive number of samples");
+    if( n == 0 )
+        return Field(0);
+
+    Matrix<Field> Z, Y;
+    Rademacher( Z, n, numSamples );
+    Zeros( Y, n, numSamples );
+    Multiply( NORMAL, Field(1), A, Z, Field(0), Y );
+    return Dot( Z, Y ) / Field(numSamples);
+}
+
+template<typename Field>
+Field TraceEstimate( const DistSparseMatrix<Field>& A, Int numSamples )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("Cannot estimate trace of nonsquare matrix");
+    if( numSamples < 1 )
+        LogicError("Expected a positive number of samples");
+    if( n == 0 )
+        return Field(0);
+
+    const Grid& grid = A.Grid();
+    DistMultiVec<Field> Z(grid), Y(grid);
+    Zeros( Z, n, numSamples );
+    // Each process can draw its local entries independently
+    Rademacher( Z.Matrix(), Z.LocalHeight(), numSamples );
+    Zeros( Y, n, numSamples );
+    Multiply( NORMAL, Field(1), A, Z, Field(0), Y );
+    return Dot( Z, Y ) / Field(numSamples);
+}
+
+#define PROTO(Field) \
+  template Field TraceEstimate \
+  ( const Matrix<Field>& A, Int numSamples ); \
+  template Field TraceEstimate \
+  ( const AbstractDistMatrix<Field>& A, Int numSamples ); \
+  template Field TraceEstimate \
+  ( const SparseMatrix<Field>& A, Int numSamples ); \
+  template Field TraceEstimate \
+  ( const DistSparseMatrix<Field>& A, Int numSamples );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -8,6 +8,54 @@
 */
 #include <El.hpp>
 
+#include <atomic>
+
+namespace {
+
+// An override of the compact-WY accumulation depth (zero defers to the
+// global algorithmic blocksize)
+std::atomic<El::Int> packedReflectorsBlocksize( 0 );
+
+// The maximum width to which consecutive reflector panels may be merged
+// when the target matrix is skinny (zero disables the aggregation)
+std::atomic<El::Int> packedReflectorsAggBudget( 256 );
+
+}
+
+namespace El {
+
+void SetPackedReflectorsBlocksize( Int nb )
+{ ::packedReflectorsBlocksize = Max( nb, Int(0) ); }
+
+Int PackedReflectorsBlocksize() EL_NO_EXCEPT
+{
+    const Int nb =
+      ::packedReflectorsBlocksize.load( std::memory_order_relaxed );
+    return ( nb > 0 ? nb : Blocksize() );
+}
+
+void SetPackedReflectorsAggBudget( Int budget )
+{ ::packedReflectorsAggBudget = Max( budget, Int(0) ); }
+
+Int PackedReflectorsAggBudget() EL_NO_EXCEPT
+{ return ::packedReflectorsAggBudget.load( std::memory_order_relaxed ); }
+
+Int PackedReflectorsBlocksize( Int numReflectors, Int targetDim )
+EL_NO_EXCEPT
+{
+    const Int nb = PackedReflectorsBlocksize();
+    const Int budget = PackedReflectorsAggBudget();
+    if( budget <= nb || targetDim >= budget )
+        return nb;
+    // The target is skinny enough that forming a wider compact-WY triangle
+    // is cheap relative to repeated passes over it: merge consecutive
+    // panels so that the number of passes is independent of the number of
+    // reflectors
+    return Min( budget, Max( nb, numReflectors ) );
+}
+
+} // namespace El
+
 #include "./ApplyPacked/Util.hpp"
 #include "./ApplyPacked/LLHB.hpp"
 #include "./ApplyPacked/LLHF.hpp"
@@ -101,7 +101,7 @@ void LLHBBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = PackedReflectorsBlocksize( diagLength, A.Width() );
     const Int kLast = LastOffset( diagLength, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -255,7 +255,7 @@ void LLHBBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = PackedReflectorsBlocksize( diagLength, A.Width() );
     const Int kLast = LastOffset( diagLength, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
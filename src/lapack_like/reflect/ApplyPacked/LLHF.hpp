@@ -99,7 +99,7 @@ void LLHFBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = PackedReflectorsBlocksize( diagLength, A.Width() );
     for( Int k=0; k<diagLength; k+=bsize )
     {
         const Int nb = Min(bsize,diagLength-k);
@@ -252,7 +252,7 @@ void LLHFBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = PackedReflectorsBlocksize( diagLength, A.Width() );
     for( Int k=0; k<diagLength; k+=bsize )
     {
         const Int nb = Min(bsize,diagLength-k);
@@ -92,7 +92,7 @@ void LUVBBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = PackedReflectorsBlocksize( diagLength, A.Width() );
     const Int kLast = LastOffset( diagLength, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -240,7 +240,7 @@ void LUVBBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = PackedReflectorsBlocksize( diagLength, A.Width() );
     const Int kLast = LastOffset( diagLength, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
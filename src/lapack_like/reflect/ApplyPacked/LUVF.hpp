@@ -100,7 +100,7 @@ void LUVFBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = PackedReflectorsBlocksize( diagLength, A.Width() );
     for( Int k=0; k<diagLength; k+=bsize )
     {
         const Int nb = Min(bsize,diagLength-k);
@@ -255,7 +255,7 @@ void LUVFBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
 
-    const Int bsize = Blocksize();
+    const Int bsize = PackedReflectorsBlocksize( diagLength, A.Width() );
     for( Int k=0; k<diagLength; k+=bsize )
     {
         const Int nb = Min(bsize,diagLength-k);
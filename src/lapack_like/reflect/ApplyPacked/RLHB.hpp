@@ -101,7 +101,7 @@ RLHBBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
     
-    const Int bsize = Blocksize();
+    const Int bsize = PackedReflectorsBlocksize( diagLength, A.Height() );
     const Int kLast = LastOffset( diagLength, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -252,7 +252,7 @@ RLHBBlocked
     const Int iOff = ( offset>=0 ? 0      : -offset );
     const Int jOff = ( offset>=0 ? offset : 0       );
     
-    const Int bsize = Blocksize();
+    const Int bsize = PackedReflectorsBlocksize( diagLength, A.Height() );
     const Int kLast = LastOffset( diagLength, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
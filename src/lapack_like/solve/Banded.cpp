@@ -0,0 +1,234 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename T>
+Int Bandwidth( const SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    Int bandwidth = 0;
+    const Int numEntries = A.NumEntries();
+    for( Int e=0; e<numEntries; ++e )
+        bandwidth = Max( bandwidth, Abs(A.Row(e)-A.Col(e)) );
+    return bandwidth;
+}
+
+template<typename T>
+Int Bandwidth( const DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    Int bandwidth = 0;
+    const Int numLocalEntries = A.NumLocalEntries();
+    for( Int e=0; e<numLocalEntries; ++e )
+        bandwidth = Max( bandwidth, Abs(A.Row(e)-A.Col(e)) );
+    return mpi::AllReduce( bandwidth, mpi::MAX, A.Grid().Comm() );
+}
+
+template<typename T>
+bool BandedSolveViable( const DistSparseMatrix<T>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().Comm();
+    if( A.Height() != A.Width() || mpi::Size(comm) == 1 )
+        return false;
+    // Each partition must absorb its two interface strips and still leave
+    // the bulk of its unknowns interior, so that the decoupled local
+    // factorizations dominate the work on the reduced system
+    const Int minLocalHeight =
+      mpi::AllReduce( A.LocalHeight(), mpi::MIN, comm );
+    return minLocalHeight >= 4*Max(bandwidth,Int(1));
+}
+
+template<typename Field>
+void BandedSolve
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& B,
+  bool hermitian,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("BandedSolve requires a square matrix");
+    if( B.Height() != n )
+        LogicError("B was not conformal with A");
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    if( commSize == 1 )
+    {
+        SparseMatrix<Field> ASeq( A );
+        SparseLDLFactorization<Field> fact;
+        fact.Initialize( ASeq, hermitian, ctrl );
+        fact.Factor();
+        fact.Solve( B.Matrix() );
+        return;
+    }
+
+    const Int mLoc = A.LocalHeight();
+    const Int first = A.FirstLocalRow();
+    const Int nrhs = B.Width();
+    const Int bw = Bandwidth( A );
+    const Int minLocalHeight = mpi::AllReduce( mLoc, mpi::MIN, comm );
+    if( minLocalHeight < 2*bw )
+        LogicError
+        ("Every local row block must be at least twice the bandwidth");
+
+    // Split the locally owned entries into the diagonal block and the
+    // dense couplings to the neighboring row blocks (the bandwidth bound
+    // confines the couplings to strips of width bw)
+    const Int numLocalEntries = A.NumLocalEntries();
+    SparseMatrix<Field> ALoc( mLoc, mLoc );
+    Matrix<Field> BCoup, CCoup;
+    Zeros( BCoup, mLoc, bw );
+    Zeros( CCoup, mLoc, bw );
+    ALoc.Reserve( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int i = A.Row(e) - first;
+        const Int j = A.Col(e);
+        if( j >= first && j < first+mLoc )
+            ALoc.QueueUpdate( i, j-first, A.Value(e) );
+        else if( j >= first+mLoc )
+            BCoup( i, j-(first+mLoc) ) = A.Value(e);
+        else
+            CCoup( i, j-(first-bw) ) = A.Value(e);
+    }
+    ALoc.ProcessQueues();
+
+    // Factor the diagonal block without any communication and solve it
+    // against the local right-hand sides and the spikes
+    SparseLDLFactorization<Field> fact;
+    fact.Initialize( ALoc, hermitian, ctrl );
+    fact.Factor();
+    Matrix<Field> G( B.LockedMatrix() );
+    fact.Solve( G );
+    if( bw == 0 )
+    {
+        B.Matrix() = G;
+        return;
+    }
+    const bool hasPrev = ( commRank != 0 );
+    const bool hasNext = ( commRank != commSize-1 );
+    Matrix<Field> V( BCoup ), W( CCoup );
+    if( hasNext )
+        fact.Solve( V );
+    if( hasPrev )
+        fact.Solve( W );
+
+    // Restricting x_p = g_p - V_p t_{p+1} - W_p b_{p-1} to the top and
+    // bottom strips of each partition yields the block-tridiagonal reduced
+    // system over the interface unknowns, which is small enough to hand to
+    // the general distributed machinery
+    const Int reducedHeight = 2*bw*commSize;
+    const Int tOff = 2*bw*commRank;
+    const Int bOff = tOff + bw;
+    DistSparseMatrix<Field> R( A.Grid() );
+    R.Resize( reducedHeight, reducedHeight );
+    const Int maxUpdates = 2*bw + 4*bw*bw;
+    R.Reserve( maxUpdates, maxUpdates );
+    for( Int r=0; r<bw; ++r )
+    {
+        R.QueueUpdate( tOff+r, tOff+r, Field(1) );
+        R.QueueUpdate( bOff+r, bOff+r, Field(1) );
+    }
+    for( Int c=0; c<bw; ++c )
+    {
+        for( Int r=0; r<bw; ++r )
+        {
+            if( hasNext )
+            {
+                const Int tNextOff = 2*bw*(commRank+1);
+                if( V(r,c) != Field(0) )
+                    R.QueueUpdate( tOff+r, tNextOff+c, V(r,c) );
+                if( V(mLoc-bw+r,c) != Field(0) )
+                    R.QueueUpdate( bOff+r, tNextOff+c, V(mLoc-bw+r,c) );
+            }
+            if( hasPrev )
+            {
+                const Int bPrevOff = 2*bw*(commRank-1) + bw;
+                if( W(r,c) != Field(0) )
+                    R.QueueUpdate( tOff+r, bPrevOff+c, W(r,c) );
+                if( W(mLoc-bw+r,c) != Field(0) )
+                    R.QueueUpdate( bOff+r, bPrevOff+c, W(mLoc-bw+r,c) );
+            }
+        }
+    }
+    R.ProcessQueues();
+    DistMultiVec<Field> F( A.Grid() );
+    Zeros( F, reducedHeight, nrhs );
+    F.Reserve( 2*bw*nrhs );
+    for( Int k=0; k<nrhs; ++k )
+    {
+        for( Int r=0; r<bw; ++r )
+        {
+            F.QueueUpdate( tOff+r, k, G(r,k) );
+            F.QueueUpdate( bOff+r, k, G(mLoc-bw+r,k) );
+        }
+    }
+    F.ProcessQueues();
+    LinearSolve( R, F );
+
+    // Exchange the solved interface strips with the neighboring partitions
+    // and back-substitute with the level-3 kernels
+    if( F.FirstLocalRow() != tOff || F.LocalHeight() != 2*bw )
+        LogicError("Reduced system was unexpectedly distributed");
+    auto& FLoc = F.LockedMatrix();
+    Matrix<Field> myT( bw, nrhs ), myB( bw, nrhs );
+    for( Int k=0; k<nrhs; ++k )
+    {
+        for( Int r=0; r<bw; ++r )
+        {
+            myT(r,k) = FLoc(r,k);
+            myB(r,k) = FLoc(bw+r,k);
+        }
+    }
+    Matrix<Field> tNext( bw, nrhs ), bPrev( bw, nrhs );
+    mpi::Request<Field> sendTReq, sendBReq;
+    if( hasPrev )
+        mpi::ISend( myT.LockedBuffer(), bw*nrhs, commRank-1, comm, sendTReq );
+    if( hasNext )
+        mpi::ISend( myB.LockedBuffer(), bw*nrhs, commRank+1, comm, sendBReq );
+    if( hasNext )
+        mpi::Recv( tNext.Buffer(), bw*nrhs, commRank+1, comm );
+    if( hasPrev )
+        mpi::Recv( bPrev.Buffer(), bw*nrhs, commRank-1, comm );
+    if( hasPrev )
+        mpi::Wait( sendTReq );
+    if( hasNext )
+        mpi::Wait( sendBReq );
+    if( hasNext )
+        Gemm( NORMAL, NORMAL, Field(-1), V, tNext, Field(1), G );
+    if( hasPrev )
+        Gemm( NORMAL, NORMAL, Field(-1), W, bPrev, Field(1), G );
+    B.Matrix() = G;
+}
+
+#define PROTO(Field) \
+  template Int Bandwidth( const SparseMatrix<Field>& A ); \
+  template Int Bandwidth( const DistSparseMatrix<Field>& A ); \
+  template bool BandedSolveViable \
+  ( const DistSparseMatrix<Field>& A, Int bandwidth ); \
+  template void BandedSolve \
+  ( const DistSparseMatrix<Field>& A, \
+          DistMultiVec<Field>& B, \
+    bool hermitian, \
+    const BisectCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
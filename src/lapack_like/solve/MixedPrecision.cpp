@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+// The classic mixed-precision scheme: the O(n^3) factorization is performed
+// in the demoted precision, where it enjoys twice the effective memory
+// bandwidth, while each O(n^2) refinement step applies the original matrix
+// in the working precision so that the usual backward-error guarantees of
+// iterative refinement are recovered.
+
+template<typename Field>
+Int MixedPrecisionLinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+
+    // Factor a demoted copy of A
+    Matrix<FieldLow> ALow;
+    Copy( A, ALow );
+    Permutation P;
+    LU( ALow, P );
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, Field(1), A, X, Y ); };
+    Matrix<FieldLow> XLow;
+    auto applyAInv =
+      [&]( Matrix<Field>& X )
+      {
+        Copy( X, XLow );
+        lu::SolveAfter( NORMAL, ALow, P, XLow );
+        Copy( XLow, X );
+      };
+
+    return RefinedSolve
+    ( applyA, applyAInv, B, ctrl.relTol, ctrl.maxRefineIts, ctrl.progress );
+}
+
+template<typename Field>
+Int MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+
+    // Factor a demoted copy of A
+    Matrix<FieldLow> ALow;
+    Copy( A, ALow );
+    Cholesky( uplo, ALow );
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { Gemm( orientation, NORMAL, Field(1), A, X, Y ); };
+    Matrix<FieldLow> XLow;
+    auto applyAInv =
+      [&]( Matrix<Field>& X )
+      {
+        Copy( X, XLow );
+        cholesky::SolveAfter( uplo, orientation, ALow, XLow );
+        Copy( XLow, X );
+      };
+
+    return RefinedSolve
+    ( applyA, applyAInv, B, ctrl.relTol, ctrl.maxRefineIts, ctrl.progress );
+}
+
+#define PROTO(Field) \
+  template Int MixedPrecisionLinearSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const MixedPrecisionSolveCtrl<Base<Field>>& ctrl ); \
+  template Int MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const MixedPrecisionSolveCtrl<Base<Field>>& ctrl );
+
+// The demoted precision of a (complex) double-precision field is (complex)
+// single precision, so these drivers cannot be offered without the latter
+#ifdef EL_DISABLE_FLOAT
+# define EL_NO_DOUBLE_PROTO
+#endif
+#if defined(EL_DISABLE_FLOAT) || defined(EL_DISABLE_COMPLEX_FLOAT)
+# define EL_NO_COMPLEX_DOUBLE_PROTO
+#endif
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,501 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// Build a CSR representation (over the locally owned sources) of the global
+// indices with which each source may not share a color: its distance-1
+// neighbors, expanded by a second hop for distance-2 colorings. The second
+// hop requires the adjacency lists of the off-process neighbors, which are
+// fetched from their owners with a single request/serve exchange.
+void BuildConflictLists
+( const DistGraph& graph, Int distance,
+  vector<Int>& conflictOffs, vector<Int>& conflictInds )
+{
+    mpi::Comm comm = graph.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+
+    vector<Int> ghostIds, ghostOffs, ghostAdj;
+    if( distance == 2 )
+    {
+        for( Int e=0; e<graph.NumLocalEdges(); ++e )
+            if( graph.SourceOwner(graph.Target(e)) != commRank )
+                ghostIds.push_back( graph.Target(e) );
+        std::sort( ghostIds.begin(), ghostIds.end() );
+        ghostIds.erase
+        ( std::unique( ghostIds.begin(), ghostIds.end() ), ghostIds.end() );
+
+        vector<int> requestCounts(commSize,0), requestDispls(commSize);
+        for( const Int j : ghostIds )
+            ++requestCounts[graph.SourceOwner(j)];
+        Scan( requestCounts, requestDispls );
+        vector<int> serveCounts(commSize);
+        mpi::AllToAll
+        ( requestCounts.data(), 1, serveCounts.data(), 1, comm );
+        vector<int> serveDispls(commSize);
+        const int numServed = Scan( serveCounts, serveDispls );
+        vector<Int> servedIds(numServed);
+        mpi::AllToAll
+        ( ghostIds.data(), requestCounts.data(), requestDispls.data(),
+          servedIds.data(), serveCounts.data(), serveDispls.data(), comm );
+
+        // Exchange the adjacency lengths and then the lists themselves
+        vector<Int> servedLens(numServed);
+        for( int k=0; k<numServed; ++k )
+            servedLens[k] =
+              graph.NumConnections( servedIds[k]-firstLocalSource );
+        vector<Int> ghostLens(ghostIds.size());
+        mpi::AllToAll
+        ( servedLens.data(), serveCounts.data(), serveDispls.data(),
+          ghostLens.data(), requestCounts.data(), requestDispls.data(), comm );
+
+        vector<int> adjSendCounts(commSize,0), adjSendDispls(commSize),
+                    adjRecvCounts(commSize,0), adjRecvDispls(commSize);
+        for( int q=0; q<commSize; ++q )
+        {
+            for( int k=serveDispls[q]; k<serveDispls[q]+serveCounts[q]; ++k )
+                adjSendCounts[q] += int(servedLens[k]);
+            for( int k=requestDispls[q];
+                 k<requestDispls[q]+requestCounts[q]; ++k )
+                adjRecvCounts[q] += int(ghostLens[k]);
+        }
+        const int adjSendTotal = Scan( adjSendCounts, adjSendDispls );
+        const int adjRecvTotal = Scan( adjRecvCounts, adjRecvDispls );
+        vector<Int> adjSendBuf(adjSendTotal);
+        Int pos = 0;
+        for( int k=0; k<numServed; ++k )
+        {
+            const Int off =
+              graph.SourceOffset( servedIds[k]-firstLocalSource );
+            for( Int e=0; e<servedLens[k]; ++e )
+                adjSendBuf[pos++] = graph.Target( off+e );
+        }
+        ghostAdj.resize( adjRecvTotal );
+        mpi::AllToAll
+        ( adjSendBuf.data(), adjSendCounts.data(), adjSendDispls.data(),
+          ghostAdj.data(), adjRecvCounts.data(), adjRecvDispls.data(), comm );
+        ghostOffs.resize( ghostIds.size()+1 );
+        ghostOffs[0] = 0;
+        for( size_t g=0; g<ghostIds.size(); ++g )
+            ghostOffs[g+1] = ghostOffs[g] + ghostLens[g];
+    }
+
+    conflictOffs.resize( numLocalSources+1 );
+    conflictInds.clear();
+    vector<Int> row;
+    for( Int s=0; s<numLocalSources; ++s )
+    {
+        conflictOffs[s] = Int(conflictInds.size());
+        const Int i = s + firstLocalSource;
+        const Int edgeOff = graph.SourceOffset( s );
+        const Int numConn = graph.NumConnections( s );
+        row.clear();
+        for( Int e=0; e<numConn; ++e )
+        {
+            const Int j = graph.Target( edgeOff+e );
+            row.push_back( j );
+            if( distance == 2 )
+            {
+                if( graph.SourceOwner(j) == commRank )
+                {
+                    const Int jLoc = j - firstLocalSource;
+                    const Int subOff = graph.SourceOffset( jLoc );
+                    const Int subConn = graph.NumConnections( jLoc );
+                    for( Int f=0; f<subConn; ++f )
+                        row.push_back( graph.Target(subOff+f) );
+                }
+                else
+                {
+                    const Int g =
+                      Int(std::lower_bound
+                          ( ghostIds.begin(), ghostIds.end(), j ) -
+                          ghostIds.begin());
+                    for( Int f=ghostOffs[g]; f<ghostOffs[g+1]; ++f )
+                        row.push_back( ghostAdj[f] );
+                }
+            }
+        }
+        std::sort( row.begin(), row.end() );
+        row.erase( std::unique( row.begin(), row.end() ), row.end() );
+        for( const Int j : row )
+            if( j != i )
+                conflictInds.push_back( j );
+    }
+    conflictOffs[numLocalSources] = Int(conflictInds.size());
+}
+
+} // anonymous namespace
+
+Int GraphColoring
+( const DistGraph& graph,
+        DistMultiVec<Int>& colors,
+  const GraphColoringCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( graph.NumSources() != graph.NumTargets() )
+        LogicError("Graph coloring requires a square graph");
+    if( ctrl.distance != 1 && ctrl.distance != 2 )
+        LogicError("Only distance-1 and distance-2 colorings are supported");
+    mpi::Comm comm = graph.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+
+    vector<Int> conflictOffs, conflictInds;
+    BuildConflictLists( graph, ctrl.distance, conflictOffs, conflictInds );
+
+    // Set up the exchange of the off-process conflict neighbors
+    vector<Int> ghostIds;
+    for( const Int j : conflictInds )
+        if( graph.SourceOwner(j) != commRank )
+            ghostIds.push_back( j );
+    std::sort( ghostIds.begin(), ghostIds.end() );
+    ghostIds.erase
+    ( std::unique( ghostIds.begin(), ghostIds.end() ), ghostIds.end() );
+    vector<int> requestCounts(commSize,0), requestDispls(commSize);
+    for( const Int j : ghostIds )
+        ++requestCounts[graph.SourceOwner(j)];
+    Scan( requestCounts, requestDispls );
+    vector<int> serveCounts(commSize);
+    mpi::AllToAll( requestCounts.data(), 1, serveCounts.data(), 1, comm );
+    vector<int> serveDispls(commSize);
+    const int numServed = Scan( serveCounts, serveDispls );
+    vector<Int> serveIds(numServed);
+    mpi::AllToAll
+    ( ghostIds.data(), requestCounts.data(), requestDispls.data(),
+      serveIds.data(), serveCounts.data(), serveDispls.data(), comm );
+
+    // Draw the priorities (ties are broken by the global index) and share
+    // those of the ghosts once, since they do not change between rounds
+    vector<double> weights(numLocalSources);
+    for( auto& weight : weights )
+        weight = SampleUniform<double>();
+    vector<double> serveWeights(numServed);
+    for( int k=0; k<numServed; ++k )
+        serveWeights[k] = weights[serveIds[k]-firstLocalSource];
+    vector<double> ghostWeights(ghostIds.size());
+    mpi::AllToAll
+    ( serveWeights.data(), serveCounts.data(), serveDispls.data(),
+      ghostWeights.data(), requestCounts.data(), requestDispls.data(), comm );
+
+    colors.SetGrid( graph.Grid() );
+    colors.Resize( numSources, 1 );
+    Fill( colors, Int(-1) );
+    auto& colorsLoc = colors.Matrix();
+
+    auto ghostIndex =
+      [&]( Int j )
+      {
+          return Int(std::lower_bound
+                     ( ghostIds.begin(), ghostIds.end(), j ) -
+                     ghostIds.begin());
+      };
+
+    vector<Int> serveColors(numServed), ghostColors(ghostIds.size());
+    vector<char> claimed;
+    Int numLocalUncolored = numLocalSources;
+    Int round = 0;
+    while( true )
+    {
+        const Int numUncolored = mpi::AllReduce( numLocalUncolored, comm );
+        if( numUncolored == 0 )
+            break;
+        if( ctrl.progress && commRank == 0 )
+            Output("coloring round ",round,": ",numUncolored," uncolored");
+
+        // Refresh the colors of the ghost conflict neighbors
+        for( int k=0; k<numServed; ++k )
+            serveColors[k] = colorsLoc(serveIds[k]-firstLocalSource,0);
+        mpi::AllToAll
+        ( serveColors.data(), serveCounts.data(), serveDispls.data(),
+          ghostColors.data(), requestCounts.data(), requestDispls.data(),
+          comm );
+
+        for( Int s=0; s<numLocalSources; ++s )
+        {
+            if( colorsLoc(s,0) != -1 )
+                continue;
+            const Int i = s + firstLocalSource;
+            const double weight = weights[s];
+
+            // A vertex only colors itself when it outranks every uncolored
+            // conflict neighbor; no two adjacent vertices can simultaneously
+            // outrank each other, so concurrent claims never conflict
+            bool outranks = true;
+            for( Int k=conflictOffs[s]; k<conflictOffs[s+1] && outranks;
+                 ++k )
+            {
+                const Int j = conflictInds[k];
+                Int nbrColor;
+                double nbrWeight;
+                if( graph.SourceOwner(j) == commRank )
+                {
+                    nbrColor = colorsLoc(j-firstLocalSource,0);
+                    nbrWeight = weights[j-firstLocalSource];
+                }
+                else
+                {
+                    const Int g = ghostIndex( j );
+                    nbrColor = ghostColors[g];
+                    nbrWeight = ghostWeights[g];
+                }
+                if( nbrColor == -1 &&
+                    (nbrWeight > weight ||
+                     (nbrWeight == weight && j > i)) )
+                    outranks = false;
+            }
+            if( !outranks )
+                continue;
+
+            // Claim the smallest color absent from the neighborhood (the
+            // degree bounds the colors which can possibly be blocked)
+            const Int degree = conflictOffs[s+1] - conflictOffs[s];
+            claimed.assign( degree+1, 0 );
+            for( Int k=conflictOffs[s]; k<conflictOffs[s+1]; ++k )
+            {
+                const Int j = conflictInds[k];
+                const Int nbrColor =
+                  ( graph.SourceOwner(j) == commRank
+                    ? colorsLoc(j-firstLocalSource,0)
+                    : ghostColors[ghostIndex(j)] );
+                if( nbrColor != -1 && nbrColor <= degree )
+                    claimed[nbrColor] = 1;
+            }
+            Int color = 0;
+            while( claimed[color] )
+                ++color;
+            colorsLoc(s,0) = color;
+            --numLocalUncolored;
+        }
+        ++round;
+    }
+
+    Int maxColor = -1;
+    for( Int s=0; s<numLocalSources; ++s )
+        maxColor = Max( maxColor, colorsLoc(s,0) );
+    return mpi::AllReduce( maxColor, mpi::MAX, comm ) + 1;
+}
+
+template<typename Field>
+MulticolorSmoother<Field>::MulticolorSmoother
+( const DistSparseMatrix<Field>& A, const GraphColoringCtrl& ctrl )
+: A_(&A)
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Int> colors(A.Grid());
+    numColors_ = GraphColoring( A.LockedDistGraph(), colors, ctrl );
+    const Int localHeight = A.LocalHeight();
+    localColors_.resize( localHeight );
+    for( Int s=0; s<localHeight; ++s )
+        localColors_[s] = colors.GetLocal( s, 0 );
+    BuildStages();
+}
+
+template<typename Field>
+MulticolorSmoother<Field>::MulticolorSmoother
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Int>& colors,
+  Int numColors )
+: A_(&A), numColors_(numColors)
+{
+    EL_DEBUG_CSE
+    if( colors.Height() != A.Height() )
+        LogicError("Coloring did not conform with the matrix");
+    const Int localHeight = A.LocalHeight();
+    localColors_.resize( localHeight );
+    for( Int s=0; s<localHeight; ++s )
+        localColors_[s] = colors.GetLocal( s, 0 );
+    BuildStages();
+}
+
+template<typename Field>
+void MulticolorSmoother<Field>::BuildStages()
+{
+    EL_DEBUG_CSE
+    const DistSparseMatrix<Field>& A = *A_;
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Multicolor smoothing requires a square matrix");
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+
+    // Invert the diagonal for the updates; a missing or zero diagonal
+    // entry degrades to an unscaled update
+    dInv_.SetGrid( A.Grid() );
+    Ones( dInv_, n, 1 );
+    for( Int s=0; s<localHeight; ++s )
+    {
+        const Int i = s + firstLocalRow;
+        const Int off = A.RowOffset( s );
+        const Int numConn = A.NumConnections( s );
+        for( Int e=0; e<numConn; ++e )
+            if( A.Col(off+e) == i && A.Value(off+e) != Field(0) )
+                dInv_.SetLocal( s, 0, Field(1)/A.Value(off+e) );
+    }
+
+    stages_.clear();
+    stages_.resize( numColors_ );
+    for( Int s=0; s<localHeight; ++s )
+    {
+        const Int color = localColors_[s];
+        if( color < 0 || color >= numColors_ )
+            LogicError
+            ("Invalid color ",color," of global row ",s+firstLocalRow);
+        stages_[color].rows.push_back( s );
+    }
+
+    // The off-process solution entries read by each class and, via one
+    // exchange per class, the local entries each class must publish
+    for( Int c=0; c<numColors_; ++c )
+    {
+        Stage& stage = stages_[c];
+        for( const Int s : stage.rows )
+        {
+            const Int off = A.RowOffset( s );
+            const Int numConn = A.NumConnections( s );
+            for( Int e=0; e<numConn; ++e )
+                if( A.RowOwner(A.Col(off+e)) != commRank )
+                    stage.requestIds.push_back( A.Col(off+e) );
+        }
+        std::sort( stage.requestIds.begin(), stage.requestIds.end() );
+        stage.requestIds.erase
+        ( std::unique( stage.requestIds.begin(), stage.requestIds.end() ),
+          stage.requestIds.end() );
+        stage.requestCounts.assign( commSize, 0 );
+        for( const Int j : stage.requestIds )
+            ++stage.requestCounts[A.RowOwner(j)];
+        stage.requestDispls.resize( commSize );
+        Scan( stage.requestCounts, stage.requestDispls );
+        stage.serveCounts.resize( commSize );
+        mpi::AllToAll
+        ( stage.requestCounts.data(), 1, stage.serveCounts.data(), 1, comm );
+        stage.serveDispls.resize( commSize );
+        const int numServed = Scan( stage.serveCounts, stage.serveDispls );
+        stage.serveIds.resize( numServed );
+        mpi::AllToAll
+        ( stage.requestIds.data(), stage.requestCounts.data(),
+          stage.requestDispls.data(),
+          stage.serveIds.data(), stage.serveCounts.data(),
+          stage.serveDispls.data(), comm );
+    }
+}
+
+template<typename Field>
+void MulticolorSmoother<Field>::Sweep
+( const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  bool reverse ) const
+{
+    EL_DEBUG_CSE
+    const DistSparseMatrix<Field>& A = *A_;
+    if( B.Height() != A.Height() || X.Height() != A.Height() ||
+        B.Width() != X.Width() )
+        LogicError("Smoother operands did not conform");
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int width = B.Width();
+    const Int firstLocalRow = A.FirstLocalRow();
+    auto& XLoc = X.Matrix();
+    auto& BLoc = B.LockedMatrix();
+    auto& dInvLoc = dInv_.LockedMatrix();
+
+    vector<Field> sendVals, recvVals;
+    vector<int> sendCounts(commSize), sendDispls(commSize),
+                recvCounts(commSize), recvDispls(commSize);
+    for( Int stageInd=0; stageInd<numColors_; ++stageInd )
+    {
+        const Stage& stage =
+          stages_[ reverse ? numColors_-1-stageInd : stageInd ];
+
+        // Refresh the off-process solution entries which this class reads
+        const int numServed = int(stage.serveIds.size());
+        const int numRequested = int(stage.requestIds.size());
+        sendVals.resize( size_t(numServed)*width );
+        for( int k=0; k<numServed; ++k )
+        {
+            const Int jLoc = stage.serveIds[k] - firstLocalRow;
+            for( Int t=0; t<width; ++t )
+                sendVals[size_t(k)*width+t] = XLoc(jLoc,t);
+        }
+        recvVals.resize( size_t(numRequested)*width );
+        for( int q=0; q<commSize; ++q )
+        {
+            sendCounts[q] = stage.serveCounts[q]*width;
+            sendDispls[q] = stage.serveDispls[q]*width;
+            recvCounts[q] = stage.requestCounts[q]*width;
+            recvDispls[q] = stage.requestDispls[q]*width;
+        }
+        mpi::AllToAll
+        ( sendVals.data(), sendCounts.data(), sendDispls.data(),
+          recvVals.data(), recvCounts.data(), recvDispls.data(), comm );
+
+        // The rows within a class do not couple, so update them in any
+        // order (or concurrently)
+        const Int numRows = Int(stage.rows.size());
+        EL_PARALLEL_FOR
+        for( Int r=0; r<numRows; ++r )
+        {
+            const Int s = stage.rows[r];
+            const Int i = s + firstLocalRow;
+            const Int off = A.RowOffset( s );
+            const Int numConn = A.NumConnections( s );
+            for( Int t=0; t<width; ++t )
+            {
+                Field acc = BLoc(s,t);
+                for( Int e=0; e<numConn; ++e )
+                {
+                    const Int j = A.Col(off+e);
+                    if( j == i )
+                        continue;
+                    Field xj;
+                    if( A.RowOwner(j) == commRank )
+                        xj = XLoc(j-firstLocalRow,t);
+                    else
+                    {
+                        const Int g =
+                          Int(std::lower_bound
+                              ( stage.requestIds.begin(),
+                                stage.requestIds.end(), j ) -
+                              stage.requestIds.begin());
+                        xj = recvVals[size_t(g)*width+t];
+                    }
+                    acc -= A.Value(off+e)*xj;
+                }
+                XLoc(s,t) = dInvLoc(s,0)*acc;
+            }
+        }
+    }
+}
+
+template<typename Field>
+Int MulticolorSmoother<Field>::NumColors() const EL_NO_EXCEPT
+{ return numColors_; }
+
+#define PROTO(Field) template class MulticolorSmoother<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
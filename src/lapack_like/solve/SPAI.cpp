@@ -0,0 +1,347 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace spai {
+
+// Solve the pattern-constrained least-squares problem of a single column,
+// min || AHat mHat - eHat ||_2, and queue the (optionally thresholded)
+// entries of the solution into M. The subproblems of distinct columns are
+// entirely independent.
+template<typename Field>
+void SolveColumn
+( Int j,
+  const vector<Int>& colSet,
+  const vector<Int>& rowSet,
+        vector<Int>& rowPos,
+        Matrix<Field>& AHat,
+        Matrix<Field>& eHat,
+        Matrix<Field>& mHat,
+  Base<Field> dropTol,
+  function<void(Int,Int,Field)> queueUpdate )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int numRows = rowSet.size();
+    const Int numCols = colSet.size();
+
+    Zeros( eHat, numRows, 1 );
+    if( rowPos[j] >= 0 )
+        eHat( rowPos[j] ) = Field(1);
+    LeastSquares( NORMAL, AHat, eHat, mHat );
+
+    Real maxAbs = 0;
+    for( Int c=0; c<numCols; ++c )
+        maxAbs = Max( maxAbs, Abs(mHat(c)) );
+    for( Int c=0; c<numCols; ++c )
+        if( Abs(mHat(c)) > dropTol*maxAbs )
+            queueUpdate( colSet[c], j, mHat(c) );
+}
+
+} // namespace spai
+
+template<typename Field>
+void SPAI
+( const SparseMatrix<Field>& A,
+        SparseMatrix<Field>& M,
+  const SPAICtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Approximate inverses require square matrices");
+
+    // Column accesses of A are row accesses of its transpose
+    SparseMatrix<Field> ATrans;
+    Transpose( A, ATrans );
+
+    M.Resize( n, n );
+    M.Reserve( A.NumEntries() );
+    auto queueUpdate =
+      function<void(Int,Int,Field)>
+      ( [&M]( Int i, Int j, Field value ) { M.QueueUpdate( i, j, value ); } );
+
+    Matrix<Field> AHat, eHat, mHat;
+    vector<Int> colSet, rowSet;
+    vector<Int> rowPos( n, -1 ); // global row |-> position within rowSet
+    for( Int j=0; j<n; ++j )
+    {
+        // The pattern of m_j is that of A's j'th column
+        colSet.clear();
+        const Int patternOff = ATrans.RowOffset( j );
+        const Int patternSize = ATrans.NumConnections( j );
+        bool sawDiagonal = false;
+        for( Int e=0; e<patternSize; ++e )
+        {
+            colSet.push_back( ATrans.Col(patternOff+e) );
+            sawDiagonal = sawDiagonal || ( colSet.back() == j );
+        }
+        if( ctrl.forceDiagonal && !sawDiagonal )
+            colSet.push_back( j );
+        if( colSet.empty() )
+            continue;
+
+        // The relevant rows are those where A(:,colSet) has structure, and
+        // the subproblem matrix is A restricted to (rowSet,colSet)
+        rowSet.clear();
+        for( const Int k : colSet )
+        {
+            const Int off = ATrans.RowOffset( k );
+            const Int size = ATrans.NumConnections( k );
+            for( Int e=0; e<size; ++e )
+            {
+                const Int i = ATrans.Col(off+e);
+                if( rowPos[i] < 0 )
+                {
+                    rowPos[i] = rowSet.size();
+                    rowSet.push_back( i );
+                }
+            }
+        }
+        Zeros( AHat, rowSet.size(), colSet.size() );
+        for( Int c=0; c<Int(colSet.size()); ++c )
+        {
+            const Int k = colSet[c];
+            const Int off = ATrans.RowOffset( k );
+            const Int size = ATrans.NumConnections( k );
+            for( Int e=0; e<size; ++e )
+                AHat( rowPos[ATrans.Col(off+e)], c ) = ATrans.Value(off+e);
+        }
+
+        spai::SolveColumn
+        ( j, colSet, rowSet, rowPos, AHat, eHat, mHat, ctrl.dropTol,
+          queueUpdate );
+
+        for( const Int i : rowSet )
+            rowPos[i] = -1;
+    }
+    M.ProcessQueues();
+}
+
+template<typename Field>
+void SPAI
+( const DistSparseMatrix<Field>& A,
+        DistSparseMatrix<Field>& M,
+  const SPAICtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Approximate inverses require square matrices");
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Each process owns a set of rows of A^T, i.e., a set of columns of A,
+    // whose subproblems it will solve
+    DistSparseMatrix<Field> ATrans(A.Grid());
+    Transpose( A, ATrans );
+    const Int localHeight = ATrans.LocalHeight();
+    const Int firstLocalRow = ATrans.FirstLocalRow();
+
+    // The subproblem of a local column j touches the rows of A^T indexed by
+    // the pattern of column j; collect the off-process ones
+    vector<Int> neededRows;
+    for( Int localRow=0; localRow<localHeight; ++localRow )
+    {
+        const Int off = ATrans.RowOffset( localRow );
+        const Int size = ATrans.NumConnections( localRow );
+        for( Int e=0; e<size; ++e )
+        {
+            const Int k = ATrans.Col(off+e);
+            if( ATrans.RowOwner(k) != commRank )
+                neededRows.push_back( k );
+        }
+        if( ctrl.forceDiagonal )
+        {
+            const Int j = localRow + firstLocalRow;
+            if( ATrans.RowOwner(j) != commRank )
+                neededRows.push_back( j );
+        }
+    }
+    std::sort( neededRows.begin(), neededRows.end() );
+    neededRows.erase
+    ( std::unique( neededRows.begin(), neededRows.end() ),
+      neededRows.end() );
+
+    // Request the needed rows from their owners (neededRows is sorted, and
+    // the row ownership is contiguous, so the requests are grouped by rank)
+    vector<int> requestCounts(commSize,0), requestDispls(commSize);
+    for( const Int k : neededRows )
+        ++requestCounts[ATrans.RowOwner(k)];
+    Scan( requestCounts, requestDispls );
+    vector<int> serveCounts(commSize);
+    mpi::AllToAll( requestCounts.data(), 1, serveCounts.data(), 1, comm );
+    vector<int> serveDispls(commSize);
+    const int numServed = Scan( serveCounts, serveDispls );
+    vector<Int> servedRows(numServed);
+    mpi::AllToAll
+    ( neededRows.data(), requestCounts.data(), requestDispls.data(),
+      servedRows.data(), serveCounts.data(), serveDispls.data(), comm );
+
+    // Reply with the size of each served row, so that both sides can set
+    // up the entry exchange
+    vector<Int> servedSizes(numServed);
+    for( int q=0; q<numServed; ++q )
+        servedSizes[q] =
+          ATrans.NumConnections( servedRows[q]-firstLocalRow );
+    vector<Int> ghostSizes(neededRows.size());
+    mpi::AllToAll
+    ( servedSizes.data(), serveCounts.data(), serveDispls.data(),
+      ghostSizes.data(), requestCounts.data(), requestDispls.data(), comm );
+
+    // Exchange the entries themselves
+    vector<int> serveEntryCounts(commSize,0), requestEntryCounts(commSize,0);
+    for( int r=0; r<commSize; ++r )
+    {
+        for( int q=serveDispls[r]; q<serveDispls[r]+serveCounts[r]; ++q )
+            serveEntryCounts[r] += servedSizes[q];
+        for( int q=requestDispls[r]; q<requestDispls[r]+requestCounts[r];
+             ++q )
+            requestEntryCounts[r] += ghostSizes[q];
+    }
+    vector<int> serveEntryDispls(commSize), requestEntryDispls(commSize);
+    const int numServedEntries = Scan( serveEntryCounts, serveEntryDispls );
+    const int numGhostEntries = Scan( requestEntryCounts, requestEntryDispls );
+    vector<Int> servedCols(numServedEntries);
+    vector<Field> servedVals(numServedEntries);
+    Int pack = 0;
+    for( int q=0; q<numServed; ++q )
+    {
+        const Int localRow = servedRows[q] - firstLocalRow;
+        const Int off = ATrans.RowOffset( localRow );
+        for( Int e=0; e<servedSizes[q]; ++e, ++pack )
+        {
+            servedCols[pack] = ATrans.Col(off+e);
+            servedVals[pack] = ATrans.Value(off+e);
+        }
+    }
+    vector<Int> ghostCols(numGhostEntries);
+    vector<Field> ghostVals(numGhostEntries);
+    mpi::AllToAll
+    ( servedCols.data(), serveEntryCounts.data(), serveEntryDispls.data(),
+      ghostCols.data(), requestEntryCounts.data(),
+      requestEntryDispls.data(), comm );
+    mpi::AllToAll
+    ( servedVals.data(), serveEntryCounts.data(), serveEntryDispls.data(),
+      ghostVals.data(), requestEntryCounts.data(),
+      requestEntryDispls.data(), comm );
+    vector<Int> ghostOffsets(neededRows.size()+1);
+    ghostOffsets[0] = 0;
+    for( size_t q=0; q<neededRows.size(); ++q )
+        ghostOffsets[q+1] = ghostOffsets[q] + ghostSizes[q];
+
+    // Locate a (possibly off-process) row of A^T: the local storage is
+    // preferred, and the ghost arrays serve the rest
+    auto findRow =
+      [&]( Int k, const Int*& cols, const Field*& vals, Int& size )
+      {
+          if( ATrans.RowOwner(k) == commRank )
+          {
+              const Int localRow = k - firstLocalRow;
+              const Int off = ATrans.RowOffset( localRow );
+              size = ATrans.NumConnections( localRow );
+              cols = ATrans.LockedTargetBuffer() + off;
+              vals = ATrans.LockedValueBuffer() + off;
+          }
+          else
+          {
+              const auto it =
+                std::lower_bound
+                ( neededRows.begin(), neededRows.end(), k );
+              const Int q = it - neededRows.begin();
+              size = ghostSizes[q];
+              cols = ghostCols.data() + ghostOffsets[q];
+              vals = ghostVals.data() + ghostOffsets[q];
+          }
+      };
+
+    // Solve the independent subproblems of the locally owned columns
+    M.SetGrid( A.Grid() );
+    M.Resize( n, n );
+    M.Reserve( ATrans.NumLocalEntries(), ATrans.NumLocalEntries() );
+    auto queueUpdate =
+      function<void(Int,Int,Field)>
+      ( [&M]( Int i, Int j, Field value )
+        { M.QueueUpdate( i, j, value ); } );
+
+    Matrix<Field> AHat, eHat, mHat;
+    vector<Int> colSet, rowSet;
+    vector<Int> rowPos( n, -1 );
+    const Int* cols; const Field* vals; Int size;
+    for( Int localRow=0; localRow<localHeight; ++localRow )
+    {
+        const Int j = localRow + firstLocalRow;
+
+        colSet.clear();
+        const Int patternOff = ATrans.RowOffset( localRow );
+        const Int patternSize = ATrans.NumConnections( localRow );
+        bool sawDiagonal = false;
+        for( Int e=0; e<patternSize; ++e )
+        {
+            colSet.push_back( ATrans.Col(patternOff+e) );
+            sawDiagonal = sawDiagonal || ( colSet.back() == j );
+        }
+        if( ctrl.forceDiagonal && !sawDiagonal )
+            colSet.push_back( j );
+        if( colSet.empty() )
+            continue;
+
+        rowSet.clear();
+        for( const Int k : colSet )
+        {
+            findRow( k, cols, vals, size );
+            for( Int e=0; e<size; ++e )
+            {
+                const Int i = cols[e];
+                if( rowPos[i] < 0 )
+                {
+                    rowPos[i] = rowSet.size();
+                    rowSet.push_back( i );
+                }
+            }
+        }
+        Zeros( AHat, rowSet.size(), colSet.size() );
+        for( Int c=0; c<Int(colSet.size()); ++c )
+        {
+            findRow( colSet[c], cols, vals, size );
+            for( Int e=0; e<size; ++e )
+                AHat( rowPos[cols[e]], c ) = vals[e];
+        }
+
+        spai::SolveColumn
+        ( j, colSet, rowSet, rowPos, AHat, eHat, mHat, ctrl.dropTol,
+          queueUpdate );
+
+        for( const Int i : rowSet )
+            rowPos[i] = -1;
+    }
+    M.ProcessQueues();
+}
+
+#define PROTO(Field) \
+  template void SPAI \
+  ( const SparseMatrix<Field>& A, \
+          SparseMatrix<Field>& M, \
+    const SPAICtrl<Base<Field>>& ctrl ); \
+  template void SPAI \
+  ( const DistSparseMatrix<Field>& A, \
+          DistSparseMatrix<Field>& M, \
+    const SPAICtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
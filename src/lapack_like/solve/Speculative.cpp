@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+SpeculativeSolver<Field>::SpeculativeSolver( const Grid& grid )
+: grid_(grid.Comm(),grid.Height()),
+  localDone_(false),
+  distributedWon_(false)
+{ }
+
+template<typename Field>
+SpeculativeSolver<Field>::~SpeculativeSolver()
+{ Drain(); }
+
+template<typename Field>
+void SpeculativeSolver<Field>::Drain()
+{
+    EL_DEBUG_CSE
+    if( background_.joinable() )
+        background_.join();
+}
+
+template<typename Field>
+bool SpeculativeSolver<Field>::DistributedWon() const EL_NO_EXCEPT
+{ return distributedWon_.load(); }
+
+template<typename Field>
+void SpeculativeSolver<Field>::Solve
+( const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != B.Height() )
+        LogicError("B was not conformal with A");
+    Drain();
+    localDone_.store( false );
+    distributedWon_.store( false );
+
+    // Replicate the operands; this is the only communication which the
+    // calling lane performs
+    DistMatrix<Field,STAR,STAR> ARep( A ), BRep( B );
+
+    // Stage the background lane's operands on the private grid from the
+    // replicated data (purely locally), so that it shares no state with
+    // the caller, and launch the distributed solve. The losing lane cannot
+    // be aborted mid-collective; it drains in the background and its
+    // result is discarded at the next Drain.
+    const bool speculate =
+      ( grid_.Size() > 1 && mpi::QueryThread() == mpi::THREAD_MULTIPLE );
+    if( speculate )
+    {
+        const Int n = A.Height();
+        const Int numRHS = B.Width();
+        ABack_.reset( new DistMatrix<Field>(grid_) );
+        BBack_.reset( new DistMatrix<Field>(grid_) );
+        ABack_->Resize( n, n );
+        BBack_->Resize( n, numRHS );
+        auto& ABackLoc = ABack_->Matrix();
+        for( Int jLoc=0; jLoc<ABackLoc.Width(); ++jLoc )
+            for( Int iLoc=0; iLoc<ABackLoc.Height(); ++iLoc )
+                ABackLoc(iLoc,jLoc) =
+                  ARep.GetLocal
+                  ( ABack_->GlobalRow(iLoc), ABack_->GlobalCol(jLoc) );
+        auto& BBackLoc = BBack_->Matrix();
+        for( Int jLoc=0; jLoc<BBackLoc.Width(); ++jLoc )
+            for( Int iLoc=0; iLoc<BBackLoc.Height(); ++iLoc )
+                BBackLoc(iLoc,jLoc) =
+                  BRep.GetLocal
+                  ( BBack_->GlobalRow(iLoc), BBack_->GlobalCol(jLoc) );
+        background_ = std::thread
+          ( [this]()
+            {
+                lin_solve::Overwrite( *ABack_, *BBack_ );
+                if( !localDone_.load() )
+                    distributedWon_.store( true );
+            } );
+    }
+
+    // The calling lane: solve the replicated system with the sequential
+    // kernels and install the result (a purely local redistribution)
+    lin_solve::Overwrite( ARep.Matrix(), BRep.Matrix() );
+    localDone_.store( true );
+    Copy( BRep, B );
+}
+
+#define PROTO(Field) template class SpeculativeSolver<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -136,6 +136,14 @@ void SymmetricSolve
     EL_DEBUG_CSE
     if( tryLDL )
     {
+        // A narrowly banded matrix is better served by SPIKE-style
+        // partitioning than by the general multifrontal machinery
+        const Int bandwidth = Bandwidth( A );
+        if( BandedSolveViable( A, bandwidth ) )
+        {
+            BandedSolve( A, B, hermitian, ctrl );
+            return;
+        }
         const BisectCtrl ctrl;
         DistSparseLDLFactorization<Field> sparseLDLFact;
         sparseLDLFact.Initialize( A, hermitian, ctrl );
@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Circulant-preconditioned FGMRES for square Toeplitz systems: the matrix
+// is applied in O(n log n) through its power-of-two circulant embedding
+// (see ToeplitzOperator), and Strang's circulant approximation -- the
+// circulant matrix which copies the central diagonals of A -- serves as the
+// preconditioner. Its inverse is itself a circulant and is therefore also
+// applied in O(n log n) via the DFT, and for well-conditioned generating
+// symbols the preconditioned spectrum clusters at one, so that the
+// iteration count is O(1) in n. Hankel systems reduce to Toeplitz systems
+// by reversing the rows of both the matrix and the right-hand sides.
+
+namespace El {
+
+template<typename Real>
+Int ToeplitzSolve
+( const vector<Complex<Real>>& a,
+        Matrix<Complex<Real>>& B,
+        Real relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int n = B.Height();
+    if( n == 0 )
+        return 0;
+    if( a.size() != Unsigned(2*n-1) )
+        LogicError("a was the wrong size");
+    const Real eps = limits::Epsilon<Real>();
+
+    auto toepOp = ToeplitzOperator( n, n, a );
+
+    // Form the first column of Strang's circulant approximation, which
+    // wraps the central diagonals of the Toeplitz matrix: the k'th diagonal
+    // is a[k+n-1]
+    vector<C> c( n );
+    for( Int k=0; k<n; ++k )
+        c[k] = ( k < (n+1)/2 ? a[k+n-1] : a[k-1] );
+
+    // Compute the eigenvalues of the preconditioner through the (unitary)
+    // DFT and invert them, flooring any eigenvalue which is negligible
+    // relative to the largest so that a (nearly) singular preconditioner
+    // degrades gracefully instead of destroying the iteration
+    auto fourierOp = FourierOperator<Real>( n );
+    const Real nSqrt = Sqrt( Real(n) );
+    Matrix<C> cCol( n, 1 ), eigCol;
+    for( Int i=0; i<n; ++i )
+        cCol(i) = c[i];
+    fourierOp.Apply( cCol, eigCol );
+    eigCol *= nSqrt;
+    Real maxAbsEig = 0;
+    for( Int i=0; i<n; ++i )
+        maxAbsEig = Max( maxAbsEig, Abs(eigCol(i)) );
+    if( maxAbsEig == Real(0) )
+    {
+        // The approximation vanished; fall back to an identity
+        // preconditioner
+        Fill( eigCol, C(1) );
+        maxAbsEig = 1;
+    }
+    const Real floor = eps*maxAbsEig;
+    for( Int i=0; i<n; ++i )
+    {
+        const Real absEig = Abs(eigCol(i));
+        if( absEig < floor )
+            eigCol(i) = ( absEig == Real(0) ? C(floor)
+                                            : eigCol(i)*(floor/absEig) );
+        eigCol(i) = C(1)/eigCol(i);
+    }
+
+    // The inverse of a circulant is the circulant whose symbol is the
+    // entrywise inverse, so its first column is the inverse DFT of the
+    // inverted eigenvalues
+    Matrix<C> cInvCol;
+    fourierOp.AdjointApply( eigCol, cInvCol );
+    cInvCol *= Real(1)/nSqrt;
+    vector<C> cInv( n );
+    for( Int i=0; i<n; ++i )
+        cInv[i] = cInvCol(i);
+    auto precondOp = CirculantOperator( cInv );
+
+    auto applyA =
+      [&]( C alpha, const Matrix<C>& x, C beta, Matrix<C>& y )
+      {
+        Matrix<C> t;
+        toepOp.Apply( x, t );
+        Scale( beta, y );
+        Axpy( alpha, t, y );
+      };
+    auto precond =
+      [&]( Matrix<C>& b )
+      {
+        Matrix<C> t;
+        precondOp.Apply( b, t );
+        b = t;
+      };
+    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+}
+
+template<typename Real>
+Int HankelSolve
+( const vector<Complex<Real>>& a,
+        Matrix<Complex<Real>>& B,
+        Real relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int n = B.Height();
+    if( n == 0 )
+        return 0;
+    if( a.size() != Unsigned(2*n-1) )
+        LogicError("a was the wrong size");
+
+    // Reversing the rows of the Hankel matrix yields the Toeplitz matrix
+    // generated by the reversed vector, so it suffices to reverse the
+    // right-hand sides and the generator (the solution is untouched)
+    vector<C> t( 2*n-1 );
+    for( Int p=0; p<2*n-1; ++p )
+        t[p] = a[2*n-2-p];
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<n/2; ++i )
+            std::swap( B(i,j), B(n-1-i,j) );
+    return ToeplitzSolve( t, B, relTol, restart, maxIts, progress );
+}
+
+#define PROTO(Real) \
+  template Int ToeplitzSolve \
+  ( const vector<Complex<Real>>& a, \
+          Matrix<Complex<Real>>& B, \
+          Real relTol, \
+          Int restart, \
+          Int maxIts, \
+          bool progress ); \
+  template Int HankelSolve \
+  ( const vector<Complex<Real>>& a, \
+          Matrix<Complex<Real>>& B, \
+          Real relTol, \
+          Int restart, \
+          Int maxIts, \
+          bool progress );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+TwoLevelAggregation<Field>::TwoLevelAggregation
+( const DistSparseMatrix<Field>& A,
+  const AggregationCtrl<Base<Field>>& ctrl )
+: A_(&A), ctrl_(ctrl)
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Aggregation requires a square matrix");
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+
+    // Invert the diagonal for the Jacobi smoother; a missing or zero
+    // diagonal entry degrades to an unscaled update
+    dInv_.SetGrid( A.Grid() );
+    Ones( dInv_, n, 1 );
+    for( Int localRow=0; localRow<localHeight; ++localRow )
+    {
+        const Int i = localRow + firstLocalRow;
+        const Int off = A.RowOffset( localRow );
+        const Int size = A.NumConnections( localRow );
+        for( Int e=0; e<size; ++e )
+            if( A.Col(off+e) == i && A.Value(off+e) != Field(0) )
+                dInv_.SetLocal( localRow, 0, Field(1)/A.Value(off+e) );
+    }
+
+    // Decoupled greedy aggregation of the locally owned subgraph: a vertex
+    // whose local neighborhood is untouched roots a new aggregate over that
+    // neighborhood, and the leftovers then join an adjacent aggregate (or
+    // become singletons). Cross-process edges influence the coarse operator
+    // but not the aggregate shapes.
+    localAggs_.assign( localHeight, -1 );
+    Int numLocalAggs = 0;
+    for( Int s=0; s<localHeight; ++s )
+    {
+        if( localAggs_[s] != -1 )
+            continue;
+        const Int off = A.RowOffset( s );
+        const Int size = A.NumConnections( s );
+        bool untouched = true;
+        for( Int e=0; e<size && untouched; ++e )
+        {
+            const Int j = A.Col(off+e);
+            if( A.RowOwner(j) == commRank &&
+                localAggs_[j-firstLocalRow] != -1 )
+                untouched = false;
+        }
+        if( !untouched )
+            continue;
+        localAggs_[s] = numLocalAggs;
+        for( Int e=0; e<size; ++e )
+        {
+            const Int j = A.Col(off+e);
+            if( A.RowOwner(j) == commRank )
+                localAggs_[j-firstLocalRow] = numLocalAggs;
+        }
+        ++numLocalAggs;
+    }
+    for( Int s=0; s<localHeight; ++s )
+    {
+        if( localAggs_[s] != -1 )
+            continue;
+        const Int off = A.RowOffset( s );
+        const Int size = A.NumConnections( s );
+        for( Int e=0; e<size; ++e )
+        {
+            const Int j = A.Col(off+e);
+            if( A.RowOwner(j) == commRank &&
+                localAggs_[j-firstLocalRow] != -1 )
+            {
+                localAggs_[s] = localAggs_[j-firstLocalRow];
+                break;
+            }
+        }
+        if( localAggs_[s] == -1 )
+            localAggs_[s] = numLocalAggs++;
+    }
+
+    // Number the aggregates globally
+    const Int aggOffset = mpi::Scan( numLocalAggs, comm ) - numLocalAggs;
+    coarseSize_ = mpi::AllReduce( numLocalAggs, comm );
+    for( auto& agg : localAggs_ )
+        agg += aggOffset;
+
+    // Fetch the aggregate of every off-process neighbor from its owner
+    vector<Int> neededRows;
+    for( Int e=0; e<A.NumLocalEntries(); ++e )
+        if( A.RowOwner(A.Col(e)) != commRank )
+            neededRows.push_back( A.Col(e) );
+    std::sort( neededRows.begin(), neededRows.end() );
+    neededRows.erase
+    ( std::unique( neededRows.begin(), neededRows.end() ),
+      neededRows.end() );
+    vector<int> requestCounts(commSize,0), requestDispls(commSize);
+    for( const Int k : neededRows )
+        ++requestCounts[A.RowOwner(k)];
+    Scan( requestCounts, requestDispls );
+    vector<int> serveCounts(commSize);
+    mpi::AllToAll( requestCounts.data(), 1, serveCounts.data(), 1, comm );
+    vector<int> serveDispls(commSize);
+    const int numServed = Scan( serveCounts, serveDispls );
+    vector<Int> servedRows(numServed);
+    mpi::AllToAll
+    ( neededRows.data(), requestCounts.data(), requestDispls.data(),
+      servedRows.data(), serveCounts.data(), serveDispls.data(), comm );
+    vector<Int> servedAggs(numServed);
+    for( int q=0; q<numServed; ++q )
+        servedAggs[q] = localAggs_[servedRows[q]-firstLocalRow];
+    vector<Int> ghostAggs(neededRows.size());
+    mpi::AllToAll
+    ( servedAggs.data(), serveCounts.data(), serveDispls.data(),
+      ghostAggs.data(), requestCounts.data(), requestDispls.data(), comm );
+    auto columnAgg =
+      [&]( Int j ) -> Int
+      {
+          if( A.RowOwner(j) == commRank )
+              return localAggs_[j-firstLocalRow];
+          const auto it =
+            std::lower_bound( neededRows.begin(), neededRows.end(), j );
+          return ghostAggs[it-neededRows.begin()];
+      };
+
+    // Assemble the Galerkin coarse operator of the piecewise-constant
+    // prolongator, Ac(I,J) = sum_{i in I, j in J} A(i,j), directly through
+    // the (duplicate-summing) sparse update queues
+    ACoarse_.SetGrid( A.Grid() );
+    ACoarse_.Resize( coarseSize_, coarseSize_ );
+    const Int numLocalEntries = A.NumLocalEntries();
+    ACoarse_.Reserve( numLocalEntries, numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+        ACoarse_.QueueUpdate
+        ( localAggs_[A.Row(e)-firstLocalRow], columnAgg(A.Col(e)),
+          A.Value(e) );
+    ACoarse_.ProcessQueues();
+
+    // Factor the coarse operator once; every V-cycle reuses the fronts
+    coarseFact_.Initialize( ACoarse_, true, ctrl_.bisectCtrl );
+    coarseFact_.Factor( LDL_INTRAPIV_1D );
+}
+
+template<typename Field>
+void TwoLevelAggregation<Field>::Apply( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    const auto& A = *A_;
+    const Int n = A.Height();
+    EL_DEBUG_ONLY(
+      if( B.Height() != n )
+          LogicError("B was not conformal with the fine operator");
+    )
+    mpi::Comm comm = A.Grid().Comm();
+    const Int width = B.Width();
+    const Int localHeight = A.LocalHeight();
+    const Field omega = ctrl_.damping;
+    auto& dInvLoc = dInv_.LockedMatrix();
+
+    DistMultiVec<Field> Z(A.Grid()), R(A.Grid());
+    Zeros( Z, n, width );
+    auto smooth =
+      [&]()
+      {
+          auto& ZLoc = Z.Matrix();
+          auto& RLoc = R.LockedMatrix();
+          for( Int k=0; k<width; ++k )
+              for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                  ZLoc(iLoc,k) += omega*dInvLoc(iLoc)*RLoc(iLoc,k);
+      };
+    auto refreshResidual =
+      [&]()
+      {
+          R = B;
+          Multiply( NORMAL, Field(-1), A, Z, Field(1), R );
+      };
+
+    // Pre-smooth with damped Jacobi (the first sweep sees a zero guess)
+    R = B;
+    for( Int sweep=0; sweep<ctrl_.numSweeps; ++sweep )
+    {
+        if( sweep > 0 )
+            refreshResidual();
+        smooth();
+    }
+
+    // Restrict the residual, solve on the coarse level, and prolongate the
+    // correction; the coarse correction is replicated so that each process
+    // can update its fine rows without a second exchange
+    refreshResidual();
+    DistMultiVec<Field> RC(A.Grid());
+    Zeros( RC, coarseSize_, width );
+    RC.Reserve( localHeight*width );
+    auto& RLoc = R.LockedMatrix();
+    for( Int k=0; k<width; ++k )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            RC.QueueUpdate( localAggs_[iLoc], k, RLoc(iLoc,k) );
+    RC.ProcessQueues();
+    coarseFact_.Solve( RC );
+    Matrix<Field> ZCFull;
+    Zeros( ZCFull, coarseSize_, width );
+    auto& RCLoc = RC.LockedMatrix();
+    for( Int k=0; k<width; ++k )
+        for( Int iLoc=0; iLoc<RC.LocalHeight(); ++iLoc )
+            ZCFull( RC.GlobalRow(iLoc), k ) = RCLoc(iLoc,k);
+    mpi::AllReduce( ZCFull.Buffer(), coarseSize_*width, comm );
+    auto& ZLoc = Z.Matrix();
+    for( Int k=0; k<width; ++k )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            ZLoc(iLoc,k) += ZCFull( localAggs_[iLoc], k );
+
+    // Post-smooth
+    for( Int sweep=0; sweep<ctrl_.numSweeps; ++sweep )
+    {
+        refreshResidual();
+        smooth();
+    }
+    B = Z;
+}
+
+template<typename Field>
+Int TwoLevelAggregation<Field>::CoarseSize() const EL_NO_EXCEPT
+{ return coarseSize_; }
+
+#define PROTO(Field) template class TwoLevelAggregation<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
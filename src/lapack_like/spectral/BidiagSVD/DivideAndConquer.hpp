@@ -607,46 +607,74 @@ Merge
     else
         VSecular.Resize( numUndeflated, numUndeflated );
 
-    // For temporarily storing dUndeflated + d(j)
-    Matrix<Real> plusShift;
-    if( ctrl.wantU )
-        View( plusShift, USecular, ALL, IR(0) );
-    else
-        plusShift.Resize( numUndeflated, 1 );
-
-    for( Int j=0; j<numUndeflated; ++j )
+    // The secular solves for distinct singular values are independent given
+    // per-caller scratch for dUndeflated + d(j), and the multiplicative
+    // corrections to r commute, so the batch can be threaded by giving each
+    // thread its own scratch and correction vector
+    auto solveSecular =
+      [&]( Int j,
+           Matrix<Real>& plusShiftLoc,
+           Matrix<Real>& rCorrectedLoc,
+           SecularSVDInfo& secularInfoLoc )
     {
         auto minusShift = VSecular( ALL, IR(j) );
 
         auto valueInfo =
           SecularSingularValue
-          ( j, dUndeflated, rho, rUndeflated, d(j), minusShift, plusShift,
+          ( j, dUndeflated, rho, rUndeflated, d(j), minusShift, plusShiftLoc,
             dcCtrl.secularCtrl );
         if( ctrl.progress )
             Output("Secular singular value ",j," is ",d(j));
 
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
+        secularInfoLoc.numIterations += valueInfo.numIterations;
+        secularInfoLoc.numAlternations += valueInfo.numAlternations;
+        secularInfoLoc.numCubicIterations += valueInfo.numCubicIterations;
+        secularInfoLoc.numCubicFailures += valueInfo.numCubicFailures;
 
-        // minusShift currently holds dUndeflated-d(j) and plusShift
+        // minusShift currently holds dUndeflated-d(j) and plusShiftLoc
         // holds dUndeflated+d(j). Overwrite minusShift with their
         // element-wise product since that is all we require from here on
         // out.
         for( Int k=0; k<numUndeflated; ++k )
-            minusShift(k) *= plusShift(k);
+            minusShift(k) *= plusShiftLoc(k);
 
-        rCorrected(j) *= minusShift(j);
+        rCorrectedLoc(j) *= minusShift(j);
         for( Int k=0; k<numUndeflated; ++k )
         {
             if( k == j )
                 continue;
-            rCorrected(k) *= minusShift(k) /
+            rCorrectedLoc(k) *= minusShift(k) /
               ((dUndeflated(j)+dUndeflated(k))*
                (dUndeflated(j)-dUndeflated(k)));
         }
+    };
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    {
+        Matrix<Real> plusShiftLoc( numUndeflated, 1 );
+        Matrix<Real> rCorrectedLoc;
+        Ones( rCorrectedLoc, numUndeflated, 1 );
+        SecularSVDInfo secularInfoLoc;
+        #pragma omp for schedule(dynamic)
+        for( Int j=0; j<numUndeflated; ++j )
+            solveSecular( j, plusShiftLoc, rCorrectedLoc, secularInfoLoc );
+        #pragma omp critical (BidiagSVDDCSecular)
+        {
+            for( Int k=0; k<numUndeflated; ++k )
+                rCorrected(k) *= rCorrectedLoc(k);
+            secularInfo.numIterations += secularInfoLoc.numIterations;
+            secularInfo.numAlternations += secularInfoLoc.numAlternations;
+            secularInfo.numCubicIterations +=
+              secularInfoLoc.numCubicIterations;
+            secularInfo.numCubicFailures += secularInfoLoc.numCubicFailures;
+        }
     }
+#else
+    // For temporarily storing dUndeflated + d(j)
+    Matrix<Real> plusShift( numUndeflated, 1 );
+    for( Int j=0; j<numUndeflated; ++j )
+        solveSecular( j, plusShift, rCorrected, secularInfo );
+#endif
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(rUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
@@ -1467,11 +1495,16 @@ Merge
     auto& USecularLoc = USecular.Matrix();
     auto& VSecularLoc = VSecular.Matrix();
 
-    // For temporarily storing dUndeflated + d(j)
-    Matrix<Real> plusShift( numUndeflated, 1 );
-
+    // The secular solves for this process's batch of singular values are
+    // independent given per-caller scratch for dUndeflated + d(j), and the
+    // multiplicative corrections to r commute, so the local batch can be
+    // threaded by giving each thread its own scratch and correction vector
     const Int numUndeflatedLoc = VSecularLoc.Width();
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+    auto solveSecular =
+      [&]( Int jLoc,
+           Matrix<Real>& plusShiftLoc,
+           Matrix<Real>& rCorrectedLoc,
+           SecularSVDInfo& secularInfoLoc )
     {
         const Int j = VSecular.GlobalCol(jLoc);
         auto minusShift = VSecularLoc( ALL, IR(jLoc) );
@@ -1479,33 +1512,60 @@ Merge
         auto valueInfo =
           SecularSingularValue
           ( j, dUndeflated, rho, rUndeflated, dSecularLoc(jLoc),
-            minusShift, plusShift, dcCtrl.secularCtrl );
+            minusShift, plusShiftLoc, dcCtrl.secularCtrl );
         if( ctrl.progress && amRoot )
             Output("Secular singular value ",j," is ",dSecularLoc(jLoc));
 
         // We will sum these across all of the processors at the top-level
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
+        secularInfoLoc.numIterations += valueInfo.numIterations;
+        secularInfoLoc.numAlternations += valueInfo.numAlternations;
+        secularInfoLoc.numCubicIterations += valueInfo.numCubicIterations;
+        secularInfoLoc.numCubicFailures += valueInfo.numCubicFailures;
 
-        // minusShift currently holds dUndeflated-d(j) and plusShift
+        // minusShift currently holds dUndeflated-d(j) and plusShiftLoc
         // holds dUndeflated+d(j). Overwrite minusShift with their
         // element-wise product since that is all we require from here on
         // out.
         for( Int k=0; k<numUndeflated; ++k )
-            minusShift(k) *= plusShift(k);
+            minusShift(k) *= plusShiftLoc(k);
 
-        rCorrected(j) *= minusShift(j);
+        rCorrectedLoc(j) *= minusShift(j);
         for( Int k=0; k<numUndeflated; ++k )
         {
             if( k == j )
                 continue;
-            rCorrected(k) *= minusShift(k) /
+            rCorrectedLoc(k) *= minusShift(k) /
               ((dUndeflated(j)+dUndeflated(k))*
                (dUndeflated(j)-dUndeflated(k)));
         }
+    };
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    {
+        Matrix<Real> plusShiftLoc( numUndeflated, 1 );
+        Matrix<Real> rCorrectedLoc;
+        Ones( rCorrectedLoc, numUndeflated, 1 );
+        SecularSVDInfo secularInfoLoc;
+        #pragma omp for schedule(dynamic)
+        for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+            solveSecular( jLoc, plusShiftLoc, rCorrectedLoc, secularInfoLoc );
+        #pragma omp critical (BidiagSVDDCSecularDist)
+        {
+            for( Int k=0; k<numUndeflated; ++k )
+                rCorrected(k) *= rCorrectedLoc(k);
+            secularInfo.numIterations += secularInfoLoc.numIterations;
+            secularInfo.numAlternations += secularInfoLoc.numAlternations;
+            secularInfo.numCubicIterations +=
+              secularInfoLoc.numCubicIterations;
+            secularInfo.numCubicFailures += secularInfoLoc.numCubicFailures;
+        }
     }
+#else
+    // For temporarily storing dUndeflated + d(j)
+    Matrix<Real> plusShift( numUndeflated, 1 );
+    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+        solveSecular( jLoc, plusShift, rCorrected, secularInfo );
+#endif
     AllReduce( rCorrected, g.VRComm(), mpi::PROD );
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(rUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
@@ -1795,11 +1855,46 @@ DivideAndConquer
         Zeros( V1, 2, n-(split+1) );
     }
 
-    Matrix<Real> s0;
-    auto info0 = DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, ctrl );
-
-    Matrix<Real> s1;
-    auto info1 = DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl );
+    // The two subproblems are entirely independent (they touch disjoint
+    // views of U and V), so they are solved as concurrent tasks when hybrid
+    // parallelism is available; the recursive calls spawn further tasks
+    // into the same team
+    Matrix<Real> s0, s1;
+    DCInfo info0, info1;
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+    {
+        #pragma omp parallel
+        #pragma omp single
+        {
+            #pragma omp task default(shared)
+            {
+                info0 =
+                  DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, ctrl );
+            }
+            #pragma omp task default(shared)
+            {
+                info1 =
+                  DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl );
+            }
+        }
+    }
+    else
+    {
+        #pragma omp task default(shared)
+        {
+            info0 = DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, ctrl );
+        }
+        #pragma omp task default(shared)
+        {
+            info1 = DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl );
+        }
+        #pragma omp taskwait
+    }
+#else
+    info0 = DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, ctrl );
+    info1 = DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl );
+#endif
 
     if( !ctrl.wantV )
     {
@@ -60,6 +60,144 @@ ExtremalSingValEst( const DistSparseMatrix<F>& A, Int basisSize )
     return extremal;
 }
 
+template<typename F>
+pair<Base<F>,Base<F>>
+ExtremalSingValEst
+( const MatrixFreeOperator<F>& A,
+        Matrix<F>& v,
+  const ExtremalSingValEstCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min( m, n );
+    pair<Real,Real> extremal(0,0);
+    if( minDim == 0 )
+        return extremal;
+    const Int maxSteps = Min( Max(ctrl.maxBasisSize,Int(1)), minDim );
+    const Real relTol =
+      ( ctrl.relTol > Real(0) ? ctrl.relTol : Pow(eps,Real(0.25)) );
+
+    Matrix<F> u, w, V;
+    Zeros( V, n, maxSteps );
+
+    // Warm start from the previous call's right vector when one was
+    // supplied; a single power-iteration step on A^H A sharpens the start
+    // when the operator has drifted since the previous call
+    bool warm = ( v.Height() == n && v.Width() == 1 );
+    if( warm )
+    {
+        A.Apply( v, u );
+        A.AdjointApply( u, w );
+        const Real wNrm = FrobeniusNorm( w );
+        if( wNrm > Real(0) )
+        {
+            v = w;
+            v *= 1/wNrm;
+        }
+        else
+            warm = false;
+    }
+    if( !warm )
+    {
+        Uniform( v, n, 1 );
+        Shift( v, SampleUniform<F>() );
+        const Real vNrm = FrobeniusNorm( v );
+        v *= 1/vNrm;
+    }
+
+    // Run the Golub-Kahan recurrence
+    //
+    //   A V_k = U_k B_k,  A^H U_k = V_k B_k^H + beta_k v_{k+1} e_k^H,
+    //
+    // with B_k upper bidiagonal (diagonal alpha, superdiagonal beta), and
+    // test the singular values of B_k for stagnation after each step
+    Matrix<Real> alpha, beta, s;
+    Zeros( alpha, maxSteps, 1 );
+    Zeros( beta,  maxSteps, 1 );
+    Real maxPrev = -1, minPrev = -1;
+    Int numSteps = 0;
+    for( Int k=0; k<maxSteps; ++k )
+    {
+        auto vCol = V( ALL, IR(k) );
+        vCol = v;
+
+        // u := (A v_k - beta_{k-1} u_{k-1}) / alpha_k
+        // -------------------------------------------
+        A.Apply( v, w );
+        if( k > 0 )
+            Axpy( -F(beta(k-1)), u, w );
+        u = w;
+        alpha(k) = FrobeniusNorm( u );
+        if( alpha(k) <= eps )
+            break;
+        u *= 1/alpha(k);
+        numSteps = k+1;
+
+        // w := A^H u_k - alpha_k v_k
+        // --------------------------
+        A.AdjointApply( u, w );
+        Axpy( -F(alpha(k)), v, w );
+        beta(k) = FrobeniusNorm( w );
+
+        // Test the estimates for stagnation
+        // ---------------------------------
+        auto d = alpha( IR(0,k+1), ALL );
+        auto e = beta( IR(0,k), ALL );
+        BidiagSVD( UPPER, d, e, s );
+        Real maxEst = 0, minEst = limits::Max<Real>();
+        for( Int i=0; i<s.Height(); ++i )
+        {
+            maxEst = Max( maxEst, s(i) );
+            minEst = Min( minEst, s(i) );
+        }
+        if( ctrl.progress )
+            Output
+            ("ExtremalSingValEst: step ",k,", sigMax=",maxEst,
+             ", sigMin=",minEst);
+        if( k+1 >= ctrl.minBasisSize && maxPrev >= Real(0) &&
+            Abs(maxEst-maxPrev) <= relTol*maxEst &&
+            Abs(minEst-minPrev) <= relTol*maxEst )
+        {
+            extremal = pair<Real,Real>(minEst,maxEst);
+            break;
+        }
+        maxPrev = maxEst;
+        minPrev = minEst;
+        extremal = pair<Real,Real>(minEst,maxEst);
+
+        if( beta(k) <= eps )
+            break;
+        v = w;
+        v *= 1/beta(k);
+    }
+    if( numSteps == 0 )
+        return extremal;
+
+    // Overwrite v with the dominant right Ritz vector to warm start the
+    // next call
+    Matrix<Real> BU, BV;
+    auto d = alpha( IR(0,numSteps), ALL );
+    auto e = beta( IR(0,numSteps-1), ALL );
+    BidiagSVD( UPPER, d, e, BU, s, BV );
+    Int jMax = 0;
+    for( Int j=1; j<s.Height(); ++j )
+        if( s(j) > s(jMax) )
+            jMax = j;
+    Matrix<F> z;
+    auto zCol = BV( ALL, IR(jMax) );
+    Copy( zCol, z );
+    auto Vk = V( ALL, IR(0,numSteps) );
+    Gemv( NORMAL, F(1), Vk, z, v );
+    const Real vNrm = FrobeniusNorm( v );
+    if( vNrm > Real(0) )
+        v *= 1/vNrm;
+
+    return extremal;
+}
+
 template<typename F>
 pair<Base<F>,Base<F>>
 HermitianExtremalSingValEst( const SparseMatrix<F>& A, Int basisSize )
@@ -121,6 +259,10 @@ HermitianExtremalSingValEst( const DistSparseMatrix<F>& A, Int basisSize )
   ( const SparseMatrix<F>& A, Int basisSize ); \
   template pair<Base<F>,Base<F>> ExtremalSingValEst \
   ( const DistSparseMatrix<F>& A, Int basisSize ); \
+  template pair<Base<F>,Base<F>> ExtremalSingValEst \
+  ( const MatrixFreeOperator<F>& A, \
+          Matrix<F>& v, \
+    const ExtremalSingValEstCtrl<Base<F>>& ctrl ); \
   template pair<Base<F>,Base<F>> HermitianExtremalSingValEst \
   ( const SparseMatrix<F>& A, Int basisSize ); \
   template pair<Base<F>,Base<F>> HermitianExtremalSingValEst \
@@ -0,0 +1,82 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+Int FilteredSubspaceEig
+( const SparseMatrix<Field>& A,
+        Base<Field> a,
+        Base<Field> b,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& Q,
+  const FilteredSubspaceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return FilteredSubspaceEig<Field>( n, applyA, a, b, w, Q, ctrl );
+}
+
+template<typename Field>
+Int FilteredSubspaceEig
+( const DistSparseMatrix<Field>& A,
+        Base<Field> a,
+        Base<Field> b,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& Q,
+  const FilteredSubspaceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return FilteredSubspaceEig<Field>( n, applyA, a, b, w, Q, ctrl );
+}
+
+#define PROTO(Field) \
+  template Int FilteredSubspaceEig \
+  ( const SparseMatrix<Field>& A, \
+          Base<Field> a, \
+          Base<Field> b, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& Q, \
+    const FilteredSubspaceCtrl<Base<Field>>& ctrl ); \
+  template Int FilteredSubspaceEig \
+  ( const DistSparseMatrix<Field>& A, \
+          Base<Field> a, \
+          Base<Field> b, \
+          AbstractDistMatrix<Base<Field>>& w, \
+          DistMultiVec<Field>& Q, \
+    const FilteredSubspaceCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,382 @@
+/*
+   Copyright (c) 2009-2017, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_HERM_EIG_JACOBI_HPP
+#define EL_SPECTRAL_HERM_EIG_JACOBI_HPP
+
+// A blocked cyclic Jacobi eigensolver: the matrix is partitioned into a
+// square grid of blocks, and, for each pair of block indices, the 2x2 block
+// subproblem is diagonalized with a dense eigensolve whose (small) unitary
+// factor is then applied to the full matrix as a Gemm-rich block rotation.
+// The pairs are scheduled with a round-robin tournament so that each sweep
+// touches every pair exactly once. Jacobi avoids the memory-bound
+// tridiagonalization which dominates the standard dense path for
+// small-to-medium matrices and, since every transformation is a rotation
+// determined from a subproblem solved to full accuracy, it computes the
+// small eigenvalues of graded matrices with better relative accuracy.
+
+namespace El {
+namespace herm_eig {
+namespace jacobi {
+
+template<typename F>
+void Helper
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Q,
+  bool wantVectors,
+  const HermitianJacobiCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol > Real(0) ? ctrl.tol : Real(n)*eps );
+    const Int bsize = Min( Max( ctrl.blockSize, Int(1) ), Max(n,Int(1)) );
+    const Int numBlocks = ( n==0 ? 0 : (n+bsize-1)/bsize );
+
+    MakeHermitian( uplo, A );
+    if( wantVectors )
+        Identity( Q, n, n );
+    w.Resize( n, 1 );
+    if( n == 0 )
+        return;
+    if( numBlocks == 1 )
+    {
+        // A single block cannot be paired
+        if( wantVectors )
+            HermitianEig( LOWER, A, w, Q );
+        else
+            HermitianEig( LOWER, A, w );
+        return;
+    }
+    const Real frobA = FrobeniusNorm( A );
+
+    auto blockInd = [&]( Int k )
+    { return IR(k*bsize,Min((k+1)*bsize,n)); };
+
+    // Diagonalize the block pair (p,q) and apply the rotation
+    auto rotatePair = [&]( Int p, Int q )
+    {
+        auto indP = blockInd( p );
+        auto indQ = blockInd( q );
+        const Int bp = indP.end - indP.beg;
+        const Int bq = indQ.end - indQ.beg;
+        const Int s = bp + bq;
+
+        // Skip pairs whose coupling is already negligible
+        if( FrobeniusNorm(A(indP,indQ)) <= eps*frobA )
+            return;
+
+        // Gather and solve the 2x2 block subproblem
+        Matrix<F> B, J;
+        Matrix<Real> lambda;
+        Zeros( B, s, s );
+        auto BTL = B( IR(0,bp),  IR(0,bp)  ); BTL = A( indP, indP );
+        auto BTR = B( IR(0,bp),  IR(bp,s)  ); BTR = A( indP, indQ );
+        auto BBL = B( IR(bp,s),  IR(0,bp)  ); BBL = A( indQ, indP );
+        auto BBR = B( IR(bp,s),  IR(bp,s)  ); BBR = A( indQ, indQ );
+        HermitianEig( LOWER, B, lambda, J );
+
+        // Apply the block rotation to the paired block columns
+        Matrix<F> C, CNew;
+        Zeros( C, n, s );
+        {
+            auto CL = C( ALL, IR(0,bp) ); CL = A( ALL, indP );
+            auto CR = C( ALL, IR(bp,s) ); CR = A( ALL, indQ );
+        }
+        Zeros( CNew, n, s );
+        Gemm( NORMAL, NORMAL, F(1), C, J, F(0), CNew );
+        {
+            auto AP = A( ALL, indP ); AP = CNew( ALL, IR(0,bp) );
+            auto AQ = A( ALL, indQ ); AQ = CNew( ALL, IR(bp,s) );
+        }
+
+        // ...and to the paired block rows
+        Matrix<F> R, RNew;
+        Zeros( R, s, n );
+        {
+            auto RT = R( IR(0,bp), ALL ); RT = A( indP, ALL );
+            auto RB = R( IR(bp,s), ALL ); RB = A( indQ, ALL );
+        }
+        Zeros( RNew, s, n );
+        Gemm( ADJOINT, NORMAL, F(1), J, R, F(0), RNew );
+        {
+            auto AP = A( indP, ALL ); AP = RNew( IR(0,bp), ALL );
+            auto AQ = A( indQ, ALL ); AQ = RNew( IR(bp,s), ALL );
+        }
+
+        // Accumulate the rotation into the eigenvector basis
+        if( wantVectors )
+        {
+            Zeros( C, n, s );
+            auto CL = C( ALL, IR(0,bp) ); CL = Q( ALL, indP );
+            auto CR = C( ALL, IR(bp,s) ); CR = Q( ALL, indQ );
+            Gemm( NORMAL, NORMAL, F(1), C, J, F(0), CNew );
+            auto QP = Q( ALL, indP ); QP = CNew( ALL, IR(0,bp) );
+            auto QQ = Q( ALL, indQ ); QQ = CNew( ALL, IR(bp,s) );
+        }
+    };
+
+    // The round-robin tournament (the circle method, with a bye slot when
+    // the number of blocks is odd)
+    const Int numSlots = numBlocks + (numBlocks%2);
+    vector<Int> slots( numSlots );
+    for( Int k=0; k<numSlots; ++k )
+        slots[k] = ( k < numBlocks ? k : -1 );
+
+    for( Int sweep=0; sweep<ctrl.maxSweeps; ++sweep )
+    {
+        Real diagSq = 0;
+        for( Int k=0; k<numBlocks; ++k )
+        {
+            const Real blockNorm = FrobeniusNorm( A(blockInd(k),blockInd(k)) );
+            diagSq += blockNorm*blockNorm;
+        }
+        const Real offNorm = Sqrt( Max( frobA*frobA-diagSq, Real(0) ) );
+        if( ctrl.progress )
+            Output
+            ("HermitianJacobi: sweep ",sweep,", off(A)=",offNorm,
+             ", ||A||_F=",frobA);
+        if( offNorm <= tol*frobA )
+            break;
+
+        for( Int round=0; round<numSlots-1; ++round )
+        {
+            for( Int i=0; i<numSlots/2; ++i )
+            {
+                Int p = slots[i];
+                Int q = slots[numSlots-1-i];
+                if( p < 0 || q < 0 )
+                    continue;
+                if( p > q )
+                    std::swap( p, q );
+                rotatePair( p, q );
+            }
+            // Rotate all but the first slot
+            const Int last = slots[numSlots-1];
+            for( Int k=numSlots-1; k>1; --k )
+                slots[k] = slots[k-1];
+            slots[1] = last;
+        }
+    }
+    GetRealPartOfDiagonal( A, w );
+}
+
+template<typename F>
+void Helper
+( UpperOrLower uplo,
+  DistMatrix<F>& A,
+  DistMatrix<Base<F>,STAR,STAR>& w,
+  DistMatrix<F>& Q,
+  bool wantVectors,
+  const HermitianJacobiCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Grid& grid = A.Grid();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol > Real(0) ? ctrl.tol : Real(n)*eps );
+    const Int bsize = Min( Max( ctrl.blockSize, Int(1) ), Max(n,Int(1)) );
+    const Int numBlocks = ( n==0 ? 0 : (n+bsize-1)/bsize );
+
+    MakeHermitian( uplo, A );
+    if( wantVectors )
+        Identity( Q, n, n );
+    w.Resize( n, 1 );
+    if( n == 0 )
+        return;
+    if( numBlocks == 1 )
+    {
+        if( wantVectors )
+            HermitianEig( LOWER, A, w, Q );
+        else
+            HermitianEig( LOWER, A, w );
+        return;
+    }
+    const Real frobA = FrobeniusNorm( A );
+
+    auto blockInd = [&]( Int k )
+    { return IR(k*bsize,Min((k+1)*bsize,n)); };
+
+    auto rotatePair = [&]( Int p, Int q )
+    {
+        auto indP = blockInd( p );
+        auto indQ = blockInd( q );
+        const Int bp = indP.end - indP.beg;
+        const Int bq = indQ.end - indQ.beg;
+        const Int s = bp + bq;
+
+        // Skip pairs whose coupling is already negligible
+        if( FrobeniusNorm(A(indP,indQ)) <= eps*frobA )
+            return;
+
+        // Gather the 2x2 block subproblem onto every process and solve it
+        // redundantly, so that the rotation is applied without a broadcast
+        DistMatrix<F,STAR,STAR> BPP( A(indP,indP) ), BPQ( A(indP,indQ) ),
+                                BQP( A(indQ,indP) ), BQQ( A(indQ,indQ) );
+        Matrix<F> B, JLoc;
+        Matrix<Real> lambda;
+        Zeros( B, s, s );
+        auto BTL = B( IR(0,bp), IR(0,bp) ); BTL = BPP.Matrix();
+        auto BTR = B( IR(0,bp), IR(bp,s) ); BTR = BPQ.Matrix();
+        auto BBL = B( IR(bp,s), IR(0,bp) ); BBL = BQP.Matrix();
+        auto BBR = B( IR(bp,s), IR(bp,s) ); BBR = BQQ.Matrix();
+        HermitianEig( LOWER, B, lambda, JLoc );
+        DistMatrix<F,STAR,STAR> J(grid);
+        J.Resize( s, s );
+        J.Matrix() = JLoc;
+
+        // Apply the block rotation to the paired block columns
+        DistMatrix<F> C(grid), CNew(grid);
+        Zeros( C, n, s );
+        {
+            auto CL = C( ALL, IR(0,bp) ); CL = A( ALL, indP );
+            auto CR = C( ALL, IR(bp,s) ); CR = A( ALL, indQ );
+        }
+        Zeros( CNew, n, s );
+        Gemm( NORMAL, NORMAL, F(1), C, J, F(0), CNew );
+        {
+            auto AP = A( ALL, indP ); AP = CNew( ALL, IR(0,bp) );
+            auto AQ = A( ALL, indQ ); AQ = CNew( ALL, IR(bp,s) );
+        }
+
+        // ...and to the paired block rows
+        DistMatrix<F> R(grid), RNew(grid);
+        Zeros( R, s, n );
+        {
+            auto RT = R( IR(0,bp), ALL ); RT = A( indP, ALL );
+            auto RB = R( IR(bp,s), ALL ); RB = A( indQ, ALL );
+        }
+        Zeros( RNew, s, n );
+        Gemm( ADJOINT, NORMAL, F(1), J, R, F(0), RNew );
+        {
+            auto AP = A( indP, ALL ); AP = RNew( IR(0,bp), ALL );
+            auto AQ = A( indQ, ALL ); AQ = RNew( IR(bp,s), ALL );
+        }
+
+        // Accumulate the rotation into the eigenvector basis
+        if( wantVectors )
+        {
+            Zeros( C, n, s );
+            auto CL = C( ALL, IR(0,bp) ); CL = Q( ALL, indP );
+            auto CR = C( ALL, IR(bp,s) ); CR = Q( ALL, indQ );
+            Gemm( NORMAL, NORMAL, F(1), C, J, F(0), CNew );
+            auto QP = Q( ALL, indP ); QP = CNew( ALL, IR(0,bp) );
+            auto QQ = Q( ALL, indQ ); QQ = CNew( ALL, IR(bp,s) );
+        }
+    };
+
+    const Int numSlots = numBlocks + (numBlocks%2);
+    vector<Int> slots( numSlots );
+    for( Int k=0; k<numSlots; ++k )
+        slots[k] = ( k < numBlocks ? k : -1 );
+
+    for( Int sweep=0; sweep<ctrl.maxSweeps; ++sweep )
+    {
+        Real diagSq = 0;
+        for( Int k=0; k<numBlocks; ++k )
+        {
+            const Real blockNorm = FrobeniusNorm( A(blockInd(k),blockInd(k)) );
+            diagSq += blockNorm*blockNorm;
+        }
+        const Real offNorm = Sqrt( Max( frobA*frobA-diagSq, Real(0) ) );
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output
+            ("HermitianJacobi: sweep ",sweep,", off(A)=",offNorm,
+             ", ||A||_F=",frobA);
+        if( offNorm <= tol*frobA )
+            break;
+
+        for( Int round=0; round<numSlots-1; ++round )
+        {
+            for( Int i=0; i<numSlots/2; ++i )
+            {
+                Int p = slots[i];
+                Int q = slots[numSlots-1-i];
+                if( p < 0 || q < 0 )
+                    continue;
+                if( p > q )
+                    std::swap( p, q );
+                rotatePair( p, q );
+            }
+            const Int last = slots[numSlots-1];
+            for( Int k=numSlots-1; k>1; --k )
+                slots[k] = slots[k-1];
+            slots[1] = last;
+        }
+    }
+    GetRealPartOfDiagonal( A, w );
+}
+
+} // namespace jacobi
+
+template<typename F>
+void Jacobi
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  const HermitianJacobiCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> Q;
+    jacobi::Helper( uplo, A, w, Q, false, ctrl );
+}
+
+template<typename F>
+void Jacobi
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Q,
+  const HermitianJacobiCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    jacobi::Helper( uplo, A, w, Q, true, ctrl );
+}
+
+template<typename F>
+void Jacobi
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& wPre,
+  const HermitianJacobiCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,STAR,STAR> wProx( wPre );
+    auto& A = AProx.Get();
+    auto& w = wProx.Get();
+    DistMatrix<F> Q( A.Grid() );
+    jacobi::Helper( uplo, A, w, Q, false, ctrl );
+}
+
+template<typename F>
+void Jacobi
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& wPre,
+  AbstractDistMatrix<F>& QPre,
+  const HermitianJacobiCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,STAR,STAR> wProx( wPre );
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& A = AProx.Get();
+    auto& w = wProx.Get();
+    auto& Q = QProx.Get();
+    jacobi::Helper( uplo, A, w, Q, true, ctrl );
+}
+
+} // namespace herm_eig
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_HERM_EIG_JACOBI_HPP
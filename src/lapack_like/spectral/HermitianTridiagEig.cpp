@@ -1205,10 +1205,25 @@ MRRRHelper
     herm_tridiag_eig::Info rangeInfo;
     vector<double> wVector(n);
     if( ctrl.subset.rangeSubset )
+    {
+        // The window boundaries are only known up to the above estimate, so
+        // spectrum slicing does not apply
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
             wVector.data(), Q.Buffer(), Q.LDim(), w.ColComm(),
             ctrl.subset.lowerBound, ctrl.subset.upperBound );
+    }
+    else if( ctrl.mrrrCtrl.numSlices > 1 )
+    {
+        const Int lowerIndex =
+          ( ctrl.subset.indexSubset ? ctrl.subset.lowerIndex : 0 );
+        const Int upperIndex =
+          ( ctrl.subset.indexSubset ? ctrl.subset.upperIndex : n-1 );
+        rangeInfo = herm_tridiag_eig::SlicedEig
+          ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
+            wVector.data(), Q.Buffer(), Q.LDim(), w.ColComm(),
+            int(lowerIndex), int(upperIndex), int(ctrl.mrrrCtrl.numSlices) );
+    }
     else if( ctrl.subset.indexSubset )
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
@@ -1293,10 +1308,25 @@ MRRRHelper
     herm_tridiag_eig::Info rangeInfo;
     vector<double> wVector(n);
     if( ctrl.subset.rangeSubset )
+    {
+        // The window boundaries are only known up to the above estimate, so
+        // spectrum slicing does not apply
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
             wVector.data(), QReal.Buffer(), QReal.LDim(), w.ColComm(),
             ctrl.subset.lowerBound, ctrl.subset.upperBound );
+    }
+    else if( ctrl.mrrrCtrl.numSlices > 1 )
+    {
+        const Int lowerIndex =
+          ( ctrl.subset.indexSubset ? ctrl.subset.lowerIndex : 0 );
+        const Int upperIndex =
+          ( ctrl.subset.indexSubset ? ctrl.subset.upperIndex : n-1 );
+        rangeInfo = herm_tridiag_eig::SlicedEig
+          ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
+            wVector.data(), QReal.Buffer(), QReal.LDim(), w.ColComm(),
+            int(lowerIndex), int(upperIndex), int(ctrl.mrrrCtrl.numSlices) );
+    }
     else if( ctrl.subset.indexSubset )
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
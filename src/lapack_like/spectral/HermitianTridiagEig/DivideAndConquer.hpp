@@ -431,7 +431,13 @@ Merge
     else
         QSecular.Resize( numUndeflated, numUndeflated );
 
-    for( Int j=0; j<numUndeflated; ++j )
+    // The secular solves for distinct eigenvalues are independent, and the
+    // multiplicative corrections to r commute, so the batch can be threaded
+    // by giving each thread its own correction vector
+    auto solveSecular =
+      [&]( Int j,
+           Matrix<Real>& rCorrectedLoc,
+           SecularEVDInfo& secularInfoLoc )
     {
         auto minusShift = QSecular( ALL, IR(j) );
 
@@ -442,19 +448,43 @@ Merge
         if( ctrl.progress )
             Output("Secular eigenvalue ",j," is ",d(j));
 
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
+        secularInfoLoc.numIterations += valueInfo.numIterations;
+        secularInfoLoc.numAlternations += valueInfo.numAlternations;
+        secularInfoLoc.numCubicIterations += valueInfo.numCubicIterations;
+        secularInfoLoc.numCubicFailures += valueInfo.numCubicFailures;
 
-        rCorrected(j) *= minusShift(j);
+        rCorrectedLoc(j) *= minusShift(j);
         for( Int k=0; k<numUndeflated; ++k )
         {
             if( k == j )
                 continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
+            rCorrectedLoc(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
+        }
+    };
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    {
+        Matrix<Real> rCorrectedLoc;
+        Ones( rCorrectedLoc, numUndeflated, 1 );
+        SecularEVDInfo secularInfoLoc;
+        #pragma omp for schedule(dynamic)
+        for( Int j=0; j<numUndeflated; ++j )
+            solveSecular( j, rCorrectedLoc, secularInfoLoc );
+        #pragma omp critical (TridiagEigDCSecular)
+        {
+            for( Int k=0; k<numUndeflated; ++k )
+                rCorrected(k) *= rCorrectedLoc(k);
+            secularInfo.numIterations += secularInfoLoc.numIterations;
+            secularInfo.numAlternations += secularInfoLoc.numAlternations;
+            secularInfo.numCubicIterations +=
+              secularInfoLoc.numCubicIterations;
+            secularInfo.numCubicFailures += secularInfoLoc.numCubicFailures;
         }
     }
+#else
+    for( Int j=0; j<numUndeflated; ++j )
+        solveSecular( j, rCorrected, secularInfo );
+#endif
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
@@ -973,8 +1003,14 @@ Merge
     auto& dSecularLoc = dSecular.Matrix();
     auto& QSecularLoc = QSecular.Matrix();
 
+    // The local secular solves are independent, and the multiplicative
+    // corrections to r commute, so the local batch can be threaded by giving
+    // each thread its own correction vector
     const Int numUndeflatedLoc = QSecularLoc.Width();
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+    auto solveSecular =
+      [&]( Int jLoc,
+           Matrix<Real>& rCorrectedLoc,
+           SecularEVDInfo& secularInfoLoc )
     {
         const Int j = QSecular.GlobalCol(jLoc);
         auto minusShift = QSecularLoc( ALL, IR(jLoc) );
@@ -987,19 +1023,43 @@ Merge
             Output("Secular eigenvalue ",j," is ",dSecularLoc(jLoc));
 
         // We will sum these across all of the processors at the top-level
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
+        secularInfoLoc.numIterations += valueInfo.numIterations;
+        secularInfoLoc.numAlternations += valueInfo.numAlternations;
+        secularInfoLoc.numCubicIterations += valueInfo.numCubicIterations;
+        secularInfoLoc.numCubicFailures += valueInfo.numCubicFailures;
 
-        rCorrected(j) *= minusShift(j);
+        rCorrectedLoc(j) *= minusShift(j);
         for( Int k=0; k<numUndeflated; ++k )
         {
             if( k == j )
                 continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
+            rCorrectedLoc(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
+        }
+    };
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    {
+        Matrix<Real> rCorrectedLoc;
+        Ones( rCorrectedLoc, numUndeflated, 1 );
+        SecularEVDInfo secularInfoLoc;
+        #pragma omp for schedule(dynamic)
+        for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+            solveSecular( jLoc, rCorrectedLoc, secularInfoLoc );
+        #pragma omp critical (TridiagEigDCSecularDist)
+        {
+            for( Int k=0; k<numUndeflated; ++k )
+                rCorrected(k) *= rCorrectedLoc(k);
+            secularInfo.numIterations += secularInfoLoc.numIterations;
+            secularInfo.numAlternations += secularInfoLoc.numAlternations;
+            secularInfo.numCubicIterations +=
+              secularInfoLoc.numCubicIterations;
+            secularInfo.numCubicFailures += secularInfoLoc.numCubicFailures;
         }
     }
+#else
+    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+        solveSecular( jLoc, rCorrected, secularInfo );
+#endif
     AllReduce( rCorrected, g.VRComm(), mpi::PROD );
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
@@ -1179,11 +1239,44 @@ DivideAndConquer
         Zeros( Q1, 2, n-split );
     }
 
-    Matrix<Real> w0;
-    auto info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl );
-
-    Matrix<Real> w1;
-    auto info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl );
+    // The two subproblems are entirely independent (they touch disjoint
+    // views of Q), so they are solved as concurrent tasks when hybrid
+    // parallelism is available; the recursive calls spawn further tasks
+    // into the same team
+    Matrix<Real> w0, w1;
+    DCInfo info0, info1;
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+    {
+        #pragma omp parallel
+        #pragma omp single
+        {
+            #pragma omp task default(shared)
+            {
+                info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl );
+            }
+            #pragma omp task default(shared)
+            {
+                info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl );
+            }
+        }
+    }
+    else
+    {
+        #pragma omp task default(shared)
+        {
+            info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl );
+        }
+        #pragma omp task default(shared)
+        {
+            info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl );
+        }
+        #pragma omp taskwait
+    }
+#else
+    info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl );
+    info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl );
+#endif
 
     if( !ctrl.wantEigVecs )
     {
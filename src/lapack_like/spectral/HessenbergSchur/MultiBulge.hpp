@@ -250,7 +250,21 @@ MultiBulge
             continue;
         }
 
-        const Int numShiftsRec = ctrl.numShifts( n, iterWinSize );
+        Int numShiftsRec = ctrl.numShifts( n, iterWinSize );
+        if( ctrl.scaleShiftsForGrid )
+        {
+            // The sequentially-motivated recommendation can leave most of
+            // the diagonal blocks of a large grid without a bulge chain, so
+            // raise it until the chase can occupy every other diagonal
+            // block (the shift window eigensolve is redundantly handled, so
+            // we avoid requesting more than half of the iteration window)
+            const Int numDiagBlocks = Max( iterWinSize/blockSize, 1 );
+            const Int bulgesPerBlock = ctrl.numBulgesPerBlock( blockSize );
+            const Int targetShifts = 2*bulgesPerBlock*((numDiagBlocks+1)/2);
+            numShiftsRec = Max( numShiftsRec, targetShifts );
+            numShiftsRec = Min( numShiftsRec, iterWinSize/2 );
+            numShiftsRec = Max( 2, numShiftsRec-Mod(numShiftsRec,2) );
+        }
         if( ctrl.progress && grid.Rank() == 0 )
         {
             Output("Iter. ",info.numIterations,": ");
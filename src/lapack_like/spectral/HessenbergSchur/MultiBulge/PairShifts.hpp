@@ -33,7 +33,7 @@ void PairShifts( Matrix<Complex<Real>>& shifts )
         }
     }
 
-    EL_DEBUG_ONLY(
+    EL_HEAVY_DEBUG_ONLY(
       for( Int i=numShifts-1; i>=2; i-=2 )
       {
           if( shifts(i).imag() != -shifts(i-1).imag() )
@@ -215,7 +215,9 @@ void Sweep
     if( !IsComplex<Field>::value )
         PairShifts( shifts );
 
-    const Int maxBulgesPerSweep = Max( n/6, 1 );
+    Int maxBulgesPerSweep = Max( n/6, 1 );
+    if( ctrl.maxBulgesPerSweep > 0 )
+        maxBulgesPerSweep = Min( ctrl.maxBulgesPerSweep, maxBulgesPerSweep );
     const Int maxShiftsPerSweep = 2*maxBulgesPerSweep;
     for( Int shiftStart=0; shiftStart<numShifts; shiftStart+=maxShiftsPerSweep )
     {
@@ -258,7 +260,9 @@ void Sweep
     if( !IsComplex<Field>::value )
         PairShifts( validShifts.Matrix() );
 
-    const Int maxBulgesPerSweep = Max( n/6, 1 );
+    Int maxBulgesPerSweep = Max( n/6, 1 );
+    if( ctrl.maxBulgesPerSweep > 0 )
+        maxBulgesPerSweep = Min( ctrl.maxBulgesPerSweep, maxBulgesPerSweep );
     const Int maxShiftsPerSweep = 2*maxBulgesPerSweep;
     for( Int shiftStart=0; shiftStart<numShifts; shiftStart+=maxShiftsPerSweep )
     {
@@ -9,6 +9,7 @@
 #ifndef EL_SCHUR_HESS_MULTIBULGE_SWEEP_COMPUTE_REFLECTORS_HPP
 #define EL_SCHUR_HESS_MULTIBULGE_SWEEP_COMPUTE_REFLECTORS_HPP
 
+#include "../../Util/SmallReflector.hpp"
 #include "./IntroduceBulge.hpp"
 
 namespace El {
@@ -60,16 +61,16 @@ void ComputeReflectors
 
         if( bulgeBeg == winBeg-1 )
         {
-            auto ind1 = IR(bulgeBeg+1,bulgeBeg+3);
-            auto H11BR = H(ind1,ind1);
-            IntroduceBulge( H11BR, shift0, shift1, w );
+            IntroduceBulge<2>
+            ( H.LockedBuffer(bulgeBeg+1,bulgeBeg+1), H.LDim(),
+              shift0, shift1, w );
         }
         else
         {
             // Find the reflection for chasing the 3x3 bulge
             Field beta = H( bulgeBeg+1, bulgeBeg );
             w[1] = H( bulgeBeg+2, bulgeBeg );
-            w[0] = lapack::Reflector( 2, beta, &w[1], 1 );
+            w[0] = util::SmallReflector<2>( beta, &w[1] );
             H( bulgeBeg+1, bulgeBeg ) = beta;
             H( bulgeBeg+2, bulgeBeg ) = realZero;
         }
@@ -80,12 +81,11 @@ void ComputeReflectors
         const Complex<Real> shift1 = shifts(2*bulge+1);
         const Int bulgeBeg = packetBeg + 3*bulge;
         Field* w = &W(0,bulge);
-        auto ind1 = IR(bulgeBeg+1,bulgeBeg+4);
-        auto H11BR = H(ind1,ind1);
+        const Field* H11Buf = H.LockedBuffer(bulgeBeg+1,bulgeBeg+1);
 
         if( bulgeBeg == winBeg-1 )
         {
-            IntroduceBulge( H11BR, shift0, shift1, w );
+            IntroduceBulge<3>( H11Buf, H.LDim(), shift0, shift1, w );
         }
         else
         {
@@ -97,7 +97,7 @@ void ComputeReflectors
             Field beta = eta10;
             w[1] = eta20;
             w[2] = eta30;
-            w[0] = lapack::Reflector( 3, beta, &w[1], 1 );
+            w[0] = util::SmallReflector<3>( beta, &w[1] );
 
             // "Vigilantly" search for a deflation
             // (deflation within the interior is exceedingly rare,
@@ -114,7 +114,8 @@ void ComputeReflectors
             else
             {
                 // Bulge has collapsed
-                IntroduceBulge( H11BR, shift0, shift1, wCand.data() );
+                IntroduceBulge<3>
+                ( H11Buf, H.LDim(), shift0, shift1, wCand.data() );
                 Field innerProd = wCand[0]*(eta10+Conj(wCand[1])*eta20);
 
                 const Field& eta00 = H(bulgeBeg,  bulgeBeg  );
@@ -9,23 +9,28 @@
 #ifndef EL_SCHUR_HESS_MULTIBULGE_SWEEP_INTRODUCE_BULGE_HPP
 #define EL_SCHUR_HESS_MULTIBULGE_SWEEP_INTRODUCE_BULGE_HPP
 
+#include "../../Util/SmallReflector.hpp"
+
 namespace El {
 namespace hess_schur {
 namespace multibulge {
 
-template<typename Real>
+// The bulge-chasing loops call the following kernels once per bulge per step,
+// so the order of the seed (two or three) is lifted into a template parameter
+// and the relevant diagonal block is passed by buffer and leading dimension
+// in order to avoid repeatedly forming submatrix views.
+
+template<Int n,typename Real>
 void ImplicitQQuadraticSeed
-( const Matrix<Real>& H,
+( const Real* H, Int HLDim,
   const Complex<Real>& shift0,
   const Complex<Real>& shift1,
         Real* v )
 {
+    static_assert( n == 2 || n == 3, "Expected n to be 2 or 3" );
     EL_DEBUG_CSE
     const Real zero(0);
-    const Int n = H.Height();
     EL_DEBUG_ONLY(
-      if( n != 2 && n != 3 )
-          LogicError("Expected n to be 2 or 3");
       const bool bothReal = ( shift0.imag() == zero && shift1.imag() == zero );
       const bool conjugate = ( shift0.imag() == -shift1.imag() );
       if( !bothReal && !conjugate )
@@ -33,10 +38,10 @@ void ImplicitQQuadraticSeed
     )
     if( n == 2 )
     {
-        const Real& eta00 = H(0,0);
-        const Real& eta01 = H(0,1);
-        const Real& eta10 = H(1,0);
-        const Real& eta11 = H(1,1);
+        const Real& eta00 = H[0+0*HLDim];
+        const Real& eta01 = H[0+1*HLDim];
+        const Real& eta10 = H[1+0*HLDim];
+        const Real& eta11 = H[1+1*HLDim];
 
         // It seems arbitrary whether the scale is computed relative
         // to shift0 or shift1, but we follow LAPACK's convention.
@@ -59,15 +64,15 @@ void ImplicitQQuadraticSeed
     }
     else
     {
-        const Real& eta00 = H(0,0);
-        const Real& eta01 = H(0,1);
-        const Real& eta02 = H(0,2);
-        const Real& eta10 = H(1,0);
-        const Real& eta11 = H(1,1);
-        const Real& eta12 = H(1,2);
-        const Real& eta20 = H(2,0);
-        const Real& eta21 = H(2,1);
-        const Real& eta22 = H(2,2);
+        const Real& eta00 = H[0+0*HLDim];
+        const Real& eta01 = H[0+1*HLDim];
+        const Real& eta02 = H[0+2*HLDim];
+        const Real& eta10 = H[1+0*HLDim];
+        const Real& eta11 = H[1+1*HLDim];
+        const Real& eta12 = H[1+2*HLDim];
+        const Real& eta20 = H[2+0*HLDim];
+        const Real& eta21 = H[2+1*HLDim];
+        const Real& eta22 = H[2+2*HLDim];
 
         const Real scale = OneAbs(eta00-shift1) + Abs(eta10) + Abs(eta20);
         if( scale == zero )
@@ -90,27 +95,23 @@ void ImplicitQQuadraticSeed
     }
 }
 
-template<typename Field>
+template<Int n,typename Field>
 void ImplicitQQuadraticSeed
-( const Matrix<Field>& H,
+( const Field* H, Int HLDim,
   const Field& shift0,
   const Field& shift1,
         Field* v )
 {
+    static_assert( n == 2 || n == 3, "Expected n to be 2 or 3" );
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     const Real zero(0);
-    const Int n = H.Height();
-    EL_DEBUG_ONLY(
-      if( n != 2 && n != 3 )
-          LogicError("Expected n to be 2 or 3");
-    )
     if( n == 2 )
     {
-        const Field& eta00 = H(0,0);
-        const Field& eta01 = H(0,1);
-        const Field& eta10 = H(1,0);
-        const Field& eta11 = H(1,1);
+        const Field& eta00 = H[0+0*HLDim];
+        const Field& eta01 = H[0+1*HLDim];
+        const Field& eta10 = H[1+0*HLDim];
+        const Field& eta11 = H[1+1*HLDim];
 
         // It seems arbitrary whether the scale is computed relative
         // to shift0 or shift1, but we follow LAPACK's convention.
@@ -131,15 +132,15 @@ void ImplicitQQuadraticSeed
     }
     else
     {
-        const Field& eta00 = H(0,0);
-        const Field& eta01 = H(0,1);
-        const Field& eta02 = H(0,2);
-        const Field& eta10 = H(1,0);
-        const Field& eta11 = H(1,1);
-        const Field& eta12 = H(1,2);
-        const Field& eta20 = H(2,0);
-        const Field& eta21 = H(2,1);
-        const Field& eta22 = H(2,2);
+        const Field& eta00 = H[0+0*HLDim];
+        const Field& eta01 = H[0+1*HLDim];
+        const Field& eta02 = H[0+2*HLDim];
+        const Field& eta10 = H[1+0*HLDim];
+        const Field& eta11 = H[1+1*HLDim];
+        const Field& eta12 = H[1+2*HLDim];
+        const Field& eta20 = H[2+0*HLDim];
+        const Field& eta21 = H[2+1*HLDim];
+        const Field& eta22 = H[2+2*HLDim];
 
         const Real scale = OneAbs(eta00-shift1) + OneAbs(eta10) + OneAbs(eta20);
         if( scale == zero )
@@ -159,6 +160,60 @@ void ImplicitQQuadraticSeed
     }
 }
 
+template<Int n,typename Field>
+void IntroduceBulge
+( const Field* H, Int HLDim,
+  const Complex<Base<Field>>& shift0,
+  const Complex<Base<Field>>& shift1,
+        Field* v )
+{
+    EL_DEBUG_CSE
+    ImplicitQQuadraticSeed<n>( H, HLDim, shift0, shift1, v );
+    Field beta = v[0];
+    v[0] = util::SmallReflector<n>( beta, &v[1] );
+}
+
+// The following Matrix-based wrappers dispatch to the fixed-order kernels
+// above after inspecting the (runtime) height of the diagonal block.
+
+template<typename Real>
+void ImplicitQQuadraticSeed
+( const Matrix<Real>& H,
+  const Complex<Real>& shift0,
+  const Complex<Real>& shift1,
+        Real* v )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    EL_DEBUG_ONLY(
+      if( n != 2 && n != 3 )
+          LogicError("Expected n to be 2 or 3");
+    )
+    if( n == 2 )
+        ImplicitQQuadraticSeed<2>( H.LockedBuffer(), H.LDim(), shift0, shift1, v );
+    else
+        ImplicitQQuadraticSeed<3>( H.LockedBuffer(), H.LDim(), shift0, shift1, v );
+}
+
+template<typename Field>
+void ImplicitQQuadraticSeed
+( const Matrix<Field>& H,
+  const Field& shift0,
+  const Field& shift1,
+        Field* v )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    EL_DEBUG_ONLY(
+      if( n != 2 && n != 3 )
+          LogicError("Expected n to be 2 or 3");
+    )
+    if( n == 2 )
+        ImplicitQQuadraticSeed<2>( H.LockedBuffer(), H.LDim(), shift0, shift1, v );
+    else
+        ImplicitQQuadraticSeed<3>( H.LockedBuffer(), H.LDim(), shift0, shift1, v );
+}
+
 template<typename Field>
 void IntroduceBulge
 ( const Matrix<Field>& H,
@@ -168,9 +223,14 @@ void IntroduceBulge
 {
     EL_DEBUG_CSE
     const Int n = H.Height();
-    ImplicitQQuadraticSeed( H, shift0, shift1, v );
-    Field beta = v[0];
-    v[0] = lapack::Reflector( n, beta, &v[1], 1 );
+    EL_DEBUG_ONLY(
+      if( n != 2 && n != 3 )
+          LogicError("Expected n to be 2 or 3");
+    )
+    if( n == 2 )
+        IntroduceBulge<2>( H.LockedBuffer(), H.LDim(), shift0, shift1, v );
+    else
+        IntroduceBulge<3>( H.LockedBuffer(), H.LDim(), shift0, shift1, v );
 }
 
 } // namespace multibulge
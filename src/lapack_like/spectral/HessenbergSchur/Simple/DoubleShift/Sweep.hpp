@@ -9,6 +9,8 @@
 #ifndef EL_HESS_SCHUR_DOUBLE_SHIFT_SWEEP_HPP
 #define EL_HESS_SCHUR_DOUBLE_SHIFT_SWEEP_HPP
 
+#include "../../Util/SmallReflector.hpp"
+
 namespace El {
 namespace hess_schur {
 namespace double_shift {
@@ -136,7 +138,10 @@ void Sweep
         {
             MemCopy( v.data(), &H(k,k-1), numReflect );
         }
-        Real tau0 = lapack::Reflector( numReflect, v[0], &v[1], 1 );
+        Real tau0 =
+          ( numReflect == 2 ?
+            util::SmallReflector<2>( v[0], &v[1] ) :
+            util::SmallReflector<3>( v[0], &v[1] ) );
         if( k > shiftStart )
         {
             H(k,  k-1) = v[0];
@@ -256,7 +261,10 @@ void SweepOpt
         {
             MemCopy( v.data(), &HBuf[k+(k-1)*HLDim], numReflect );
         }
-        Real tau0 = lapack::Reflector( numReflect, v[0], &v[1], 1 );
+        Real tau0 =
+          ( numReflect == 2 ?
+            util::SmallReflector<2>( v[0], &v[1] ) :
+            util::SmallReflector<3>( v[0], &v[1] ) );
         if( k > shiftStart )
         {
             HBuf[ k   +(k-1)*HLDim] = v[0];
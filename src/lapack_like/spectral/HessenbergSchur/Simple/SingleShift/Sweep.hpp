@@ -9,6 +9,8 @@
 #ifndef EL_HESS_SCHUR_SINGLE_SHIFT_SWEEP_HPP
 #define EL_HESS_SCHUR_SINGLE_SHIFT_SWEEP_HPP
 
+#include "../../Util/SmallReflector.hpp"
+
 namespace El {
 namespace hess_schur {
 
@@ -247,15 +249,15 @@ void Sweep
             nu0 = H(k,k-1);
             nu1 = RealPart( H(k+1,k-1) );
         }
-        Field tau0 = lapack::Reflector( 2, nu0, &nu1, 1 );
+        Field tau0 = util::SmallReflector<2>( nu0, &nu1 );
         if( k > shiftStart )
         {
             H(k,  k-1) = nu0;
             H(k+1,k-1) = 0;
         }
-        // The formulas within lapack::Reflector trivially imply that
+        // The formulas within util::SmallReflector trivially imply that
         // tau0*Conj(nu1) will be real if nu1 was real on entry to
-        // lapack::Reflector (an equivalent claim is made within ZLAHQR)
+        // util::SmallReflector (an equivalent claim is made within ZLAHQR)
         Real tau1 = RealPart(tau0*Conj(nu1));
 
         // Apply the Householder reflector from the left
@@ -374,15 +376,15 @@ void SweepOpt
             nu1 = RealPart( HBuf[(k+1)+(k-1)*HLDim] );
         }
         // TODO(poulson): Assert nu1 is real
-        Field tau0 = lapack::Reflector( 2, nu0, &nu1, 1 );
+        Field tau0 = util::SmallReflector<2>( nu0, &nu1 );
         if( k > shiftStart )
         {
             HBuf[ k   +(k-1)*HLDim] = nu0;
             HBuf[(k+1)+(k-1)*HLDim] = 0;
         }
-        // The formulas within lapack::Reflector trivially imply that
+        // The formulas within util::SmallReflector trivially imply that
         // tau0*Conj(nu1) will be real if nu1 was real on entry to
-        // lapack::Reflector (an equivalent claim is made within ZLAHQR)
+        // util::SmallReflector (an equivalent claim is made within ZLAHQR)
         Real tau1 = RealPart(tau0*Conj(nu1));
 
         // Apply the Householder reflector from the left
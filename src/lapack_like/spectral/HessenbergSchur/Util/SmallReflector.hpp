@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESS_SCHUR_UTIL_SMALL_REFLECTOR_HPP
+#define EL_HESS_SCHUR_UTIL_SMALL_REFLECTOR_HPP
+
+namespace El {
+namespace hess_schur {
+namespace util {
+
+// A fixed-order equivalent of lapack::Reflector for the order two and three
+// Householder transformations generated within the single, double, and
+// multibulge Hessenberg QR sweeps. Said sweeps generate one such reflector
+// per (bulge, step) pair, and lifting the order into a template parameter
+// allows the norm and rescaling loops to be unrolled and inlined into the
+// sweep rather than making an out-of-line call which, in turn, calls
+// blas::Nrm2 and blas::Scal on one and two entry vectors.
+//
+// As with lapack::Reflector, the convention is that
+//
+//   H = I - tau [1; v] [1; v]'
+//
+// satisfies H [chi; x] = [beta; 0], with tau returned, beta overwriting chi,
+// and v overwriting x.
+//
+template<Int n,typename Field>
+Field SmallReflector( Field& chi, Field* x )
+{
+    static_assert( n == 2 || n == 3, "Reflector order must be 2 or 3" );
+    typedef Base<Field> Real;
+    const Real zero(0);
+
+    Real norm = ( n == 2 ? Abs(x[0]) : SafeNorm( Abs(x[0]), Abs(x[1]) ) );
+    Field alpha = chi;
+    if( norm == zero && ImagPart(alpha) == zero )
+    {
+        chi *= -1;
+        return Field(2);
+    }
+
+    Real beta;
+    if( RealPart(alpha) <= zero )
+        beta = SafeNorm( alpha, norm );
+    else
+        beta = -SafeNorm( alpha, norm );
+
+    // Rescale if the vector is too small
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real epsilon = limits::Epsilon<Real>();
+    const Real safeInv = safeMin/epsilon;
+    Int count = 0;
+    if( Abs(beta) < safeInv )
+    {
+        Real invOfSafeInv = Real(1)/safeInv;
+        do
+        {
+            ++count;
+            x[0] *= invOfSafeInv;
+            if( n == 3 )
+                x[1] *= invOfSafeInv;
+            alpha *= invOfSafeInv;
+            beta *= invOfSafeInv;
+        } while( Abs(beta) < safeInv );
+
+        norm = ( n == 2 ? Abs(x[0]) : SafeNorm( Abs(x[0]), Abs(x[1]) ) );
+        if( RealPart(alpha) <= 0 )
+            beta = SafeNorm( alpha, norm );
+        else
+            beta = -SafeNorm( alpha, norm );
+    }
+
+    Field tau = (beta-Conj(alpha)) / beta;
+    const Field scale = Field(1) / (alpha-beta);
+    x[0] *= scale;
+    if( n == 3 )
+        x[1] *= scale;
+
+    // Undo the scaling
+    for( Int j=0; j<count; ++j )
+        beta *= safeInv;
+
+    chi = beta;
+    return tau;
+}
+
+} // namespace util
+} // namespace hess_schur
+} // namespace El
+
+#endif // ifndef EL_HESS_SCHUR_UTIL_SMALL_REFLECTOR_HPP
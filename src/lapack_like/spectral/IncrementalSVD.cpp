@@ -0,0 +1,311 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+IncrementalSVD<Field>::IncrementalSVD( Int maxRank, Int reorthogPeriod )
+: maxRank_(maxRank), reorthogPeriod_(reorthogPeriod)
+{
+    EL_DEBUG_CSE
+    if( maxRank < 1 )
+        LogicError("The maximum rank must be positive");
+    if( reorthogPeriod < 0 )
+        LogicError("The re-orthogonalization period cannot be negative");
+}
+
+template<typename Field>
+void IncrementalSVD<Field>::Initialize( const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    SVD( A, U_, s_, V_ );
+    Truncate();
+    numModsSinceReorthog_ = 0;
+    initialized_ = true;
+}
+
+template<typename Field>
+void IncrementalSVD<Field>::Update( const Matrix<Field>& C )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( !initialized_ )
+    {
+        Initialize( C );
+        return;
+    }
+    const Int m = U_.Height();
+    if( C.Height() != m )
+        LogicError("The new columns did not conform with the factorization");
+    const Int r = s_.Height();
+    const Int b = C.Width();
+    const Int nOld = V_.Height();
+    if( b == 0 )
+        return;
+
+    // Split the new block into its components within and orthogonal to the
+    // current left basis, C = U L + J K, with J orthonormal
+    Matrix<Field> L, J, K;
+    Zeros( L, r, b );
+    Gemm( ADJOINT, NORMAL, Field(1), U_, C, Field(0), L );
+    J = C;
+    Gemm( NORMAL, NORMAL, Field(-1), U_, L, Field(1), J );
+    qr::Explicit( J, K );
+
+    // Re-diagonalize the (r+b)-dimensional core, [diag(s), L; 0, K]
+    Matrix<Field> M, UM, VM;
+    Matrix<Real> sM;
+    Zeros( M, r+b, r+b );
+    for( Int i=0; i<r; ++i )
+        M(i,i) = s_(i);
+    auto MTR = M( IR(0,r), IR(r,r+b) );
+    MTR = L;
+    auto MBR = M( IR(r,r+b), IR(r,r+b) );
+    MBR = K;
+    SVD( M, UM, sM, VM );
+
+    // Rotate the bases, U := [U, J] UM and V := [V, 0; 0, I] VM
+    Matrix<Field> UExt, VExt;
+    Zeros( UExt, m, r+b );
+    auto UExtL = UExt( ALL, IR(0,r) );
+    UExtL = U_;
+    auto UExtR = UExt( ALL, IR(r,r+b) );
+    UExtR = J;
+    Zeros( U_, m, r+b );
+    Gemm( NORMAL, NORMAL, Field(1), UExt, UM, Field(0), U_ );
+    Zeros( VExt, nOld+b, r+b );
+    auto VExtTL = VExt( IR(0,nOld), IR(0,r) );
+    VExtTL = V_;
+    for( Int i=0; i<b; ++i )
+        VExt(nOld+i,r+i) = Field(1);
+    Zeros( V_, nOld+b, r+b );
+    Gemm( NORMAL, NORMAL, Field(1), VExt, VM, Field(0), V_ );
+    s_ = sM;
+
+    Truncate();
+    ++numModsSinceReorthog_;
+    MaybeReorthogonalize();
+}
+
+template<typename Field>
+void IncrementalSVD<Field>::Downdate( Int numColumns )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    if( !initialized_ )
+        LogicError("The factorization has not been initialized");
+    if( numColumns > V_.Height() )
+        LogicError("Attempted to expire more columns than the window holds");
+    const Int m = U_.Height();
+
+    for( Int col=0; col<numColumns; ++col )
+    {
+        const Int r = s_.Height();
+        const Int nWin = V_.Height();
+
+        // The expired column is a = U diag(s) h, where h = V^H e_0 encodes
+        // the leading row of V; removing it is the rank-one downdate
+        // A - a e_0^H, which leaves the leading row of V numerically zero
+        Matrix<Field> h, sh, a;
+        Zeros( h, r, 1 );
+        for( Int j=0; j<r; ++j )
+            h(j) = Conj(V_(0,j));
+        sh = h;
+        for( Int j=0; j<r; ++j )
+            sh(j) *= s_(j);
+        Zeros( a, m, 1 );
+        Gemm( NORMAL, NORMAL, Field(1), U_, sh, Field(0), a );
+
+        // Orthogonalize the modification against the bases; the left-hand
+        // residual vanishes in exact arithmetic (the column lies in the
+        // span of U), so its branch merely mops up rounding drift
+        Matrix<Field> l, p, q;
+        Zeros( l, r, 1 );
+        Gemm( ADJOINT, NORMAL, Field(1), U_, a, Field(0), l );
+        p = a;
+        Gemm( NORMAL, NORMAL, Field(-1), U_, l, Field(1), p );
+        Real pNorm = FrobeniusNorm( p );
+        if( pNorm <= eps*Max(FrobeniusNorm(a),Real(1)) )
+        {
+            pNorm = 0;
+            Zeros( p, m, 1 );
+        }
+        else
+            p *= 1/pNorm;
+        Zeros( q, nWin, 1 );
+        q(0) = Field(1);
+        Gemm( NORMAL, NORMAL, Field(-1), V_, h, Field(1), q );
+        Real qNorm = FrobeniusNorm( q );
+        if( qNorm <= eps )
+        {
+            qNorm = 0;
+            Zeros( q, nWin, 1 );
+        }
+        else
+            q *= 1/qNorm;
+
+        // Re-diagonalize the (r+1)-dimensional core,
+        // diag([s; 0]) - [l; ||p||] [h; ||q||]^H
+        Matrix<Field> M, UM, VM, lExt, hExt;
+        Matrix<Real> sM;
+        Zeros( M, r+1, r+1 );
+        for( Int i=0; i<r; ++i )
+            M(i,i) = s_(i);
+        Zeros( lExt, r+1, 1 );
+        auto lTop = lExt( IR(0,r), ALL );
+        lTop = l;
+        lExt(r) = pNorm;
+        Zeros( hExt, r+1, 1 );
+        auto hTop = hExt( IR(0,r), ALL );
+        hTop = h;
+        hExt(r) = qNorm;
+        Ger( Field(-1), lExt, hExt, M );
+        SVD( M, UM, sM, VM );
+
+        // Rotate the bases and discard the (numerically zero) expired row
+        // of V
+        Matrix<Field> UExt, VExt, UNew, VNew;
+        Zeros( UExt, m, r+1 );
+        auto UExtL = UExt( ALL, IR(0,r) );
+        UExtL = U_;
+        auto UExtR = UExt( ALL, IR(r) );
+        UExtR = p;
+        Zeros( UNew, m, r+1 );
+        Gemm( NORMAL, NORMAL, Field(1), UExt, UM, Field(0), UNew );
+        U_ = UNew;
+        Zeros( VExt, nWin, r+1 );
+        auto VExtL = VExt( ALL, IR(0,r) );
+        VExtL = V_;
+        auto VExtR = VExt( ALL, IR(r) );
+        VExtR = q;
+        Zeros( VNew, nWin, r+1 );
+        Gemm( NORMAL, NORMAL, Field(1), VExt, VM, Field(0), VNew );
+        Matrix<Field> VShrunk( VNew(IR(1,nWin),ALL) );
+        V_ = VShrunk;
+        s_ = sM;
+
+        Truncate();
+        ++numModsSinceReorthog_;
+    }
+    MaybeReorthogonalize();
+}
+
+template<typename Field>
+void IncrementalSVD<Field>::Reorthogonalize()
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( !initialized_ || s_.Height() == 0 )
+        return;
+    const Int m = U_.Height();
+    const Int nWin = V_.Height();
+    const Int r = s_.Height();
+
+    // Restore the bases to orthonormality and absorb the triangular
+    // factors (and the singular values) into a small core, whose dense SVD
+    // then restores the diagonal form
+    Matrix<Field> RU, RV;
+    qr::Explicit( U_, RU );
+    qr::Explicit( V_, RV );
+    Matrix<Field> M( RU ), MCore, UM, VM;
+    Matrix<Real> sM;
+    DiagonalScale( RIGHT, NORMAL, s_, M );
+    Zeros( MCore, r, r );
+    Gemm( NORMAL, ADJOINT, Field(1), M, RV, Field(0), MCore );
+    SVD( MCore, UM, sM, VM );
+    Matrix<Field> UNew, VNew;
+    Zeros( UNew, m, r );
+    Gemm( NORMAL, NORMAL, Field(1), U_, UM, Field(0), UNew );
+    U_ = UNew;
+    Zeros( VNew, nWin, r );
+    Gemm( NORMAL, NORMAL, Field(1), V_, VM, Field(0), VNew );
+    V_ = VNew;
+    s_ = sM;
+
+    numModsSinceReorthog_ = 0;
+    Truncate();
+}
+
+template<typename Field>
+void IncrementalSVD<Field>::Truncate()
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int numVals = s_.Height();
+    if( numVals == 0 )
+        return;
+    const Real tol = Max(U_.Height(),V_.Height())*eps*s_(0);
+    Int rank = Min( maxRank_, numVals );
+    while( rank > 1 && s_(rank-1) <= tol )
+        --rank;
+    if( rank == numVals )
+        return;
+    U_.Resize( U_.Height(), rank );
+    V_.Resize( V_.Height(), rank );
+    s_.Resize( rank, 1 );
+}
+
+template<typename Field>
+void IncrementalSVD<Field>::MaybeReorthogonalize()
+{
+    EL_DEBUG_CSE
+    if( reorthogPeriod_ > 0 && numModsSinceReorthog_ >= reorthogPeriod_ )
+        Reorthogonalize();
+}
+
+template<typename Field>
+Int IncrementalSVD<Field>::Rank() const EL_NO_EXCEPT
+{ return s_.Height(); }
+
+template<typename Field>
+Int IncrementalSVD<Field>::Height() const EL_NO_EXCEPT
+{ return U_.Height(); }
+
+template<typename Field>
+Int IncrementalSVD<Field>::NumColumns() const EL_NO_EXCEPT
+{ return V_.Height(); }
+
+template<typename Field>
+const Matrix<Field>& IncrementalSVD<Field>::U() const
+{
+    if( !initialized_ )
+        LogicError("The factorization has not been initialized");
+    return U_;
+}
+
+template<typename Field>
+const Matrix<Base<Field>>& IncrementalSVD<Field>::SingularValues() const
+{
+    if( !initialized_ )
+        LogicError("The factorization has not been initialized");
+    return s_;
+}
+
+template<typename Field>
+const Matrix<Field>& IncrementalSVD<Field>::V() const
+{
+    if( !initialized_ )
+        LogicError("The factorization has not been initialized");
+    return V_;
+}
+
+#define PROTO(Field) \
+  template class IncrementalSVD<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
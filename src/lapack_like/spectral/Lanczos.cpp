@@ -94,6 +94,84 @@ Base<Field> LanczosDecomp
     return LanczosDecomp( n, applyA, V, T, v, basisSize );
 }
 
+template<typename Field>
+void Lanczos
+( const MatrixFreeOperator<Field>& A,
+        Matrix<Base<Field>>& T,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { A.Apply( X, Y ); };
+    Lanczos<Field>( n, applyA, T, basisSize );
+}
+
+template<typename Field>
+Base<Field> LanczosDecomp
+( const MatrixFreeOperator<Field>& A,
+        Matrix<Field>& V,
+        Matrix<Base<Field>>& T,
+        Matrix<Field>& v,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      { A.Apply( X, Y ); };
+    return LanczosDecomp( n, applyA, V, T, v, basisSize );
+}
+
+template<typename Field>
+Int RestartedLanczos
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& Q,
+  const LanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return RestartedLanczos<Field>( n, applyA, w, Q, ctrl );
+}
+
+template<typename Field>
+Int RestartedLanczos
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& Q,
+  const LanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return RestartedLanczos<Field>( n, applyA, w, Q, ctrl );
+}
+
 #define PROTO(Field) \
   template void Lanczos \
   ( const SparseMatrix<Field>& A, \
@@ -114,7 +192,27 @@ Base<Field> LanczosDecomp
           DistMultiVec<Field>& V, \
           AbstractDistMatrix<Base<Field>>& T, \
           DistMultiVec<Field>& v, \
-          Int basisSize );
+          Int basisSize ); \
+  template void Lanczos \
+  ( const MatrixFreeOperator<Field>& A, \
+          Matrix<Base<Field>>& T, \
+          Int basisSize ); \
+  template Base<Field> LanczosDecomp \
+  ( const MatrixFreeOperator<Field>& A, \
+          Matrix<Field>& V, \
+          Matrix<Base<Field>>& T, \
+          Matrix<Field>& v, \
+          Int basisSize ); \
+  template Int RestartedLanczos \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& Q, \
+    const LanczosCtrl<Base<Field>>& ctrl ); \
+  template Int RestartedLanczos \
+  ( const DistSparseMatrix<Field>& A, \
+          AbstractDistMatrix<Base<Field>>& w, \
+          DistMultiVec<Field>& Q, \
+    const LanczosCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
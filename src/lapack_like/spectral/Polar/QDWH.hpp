@@ -24,6 +24,107 @@ namespace El {
 
 namespace polar {
 
+// Given the upper-triangular factor R of a QR factorization of the rescaled
+// matrix, estimate sMinUpper = 1 / || inv(R) ||_1 via the Hager-Higham
+// algorithm applied through triangular solves (see Higham and Tisseur's
+// "A Block Algorithm for Matrix 1-Norm Estimation, with an Application to
+// 1-Norm Pseudospectra" [CITATION]) rather than through the one norm of an
+// explicitly formed inverse. The dynamical weighting is only helped, never
+// broken, by the estimate being inexact.
+
+template<typename F>
+Base<F> QDWHSMinUpper( const Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = R.Height();
+    const Int maxIts = 5;
+    if( n == 0 )
+        return Real(1);
+    // An exactly singular factor admits the trivial lower bound of zero (and
+    // would produce Infs and NaNs in the triangular solves)
+    if( MinAbsLoc(GetDiagonal(R)).value == Real(0) )
+        return Real(0);
+
+    auto entrySign = []( const F& alpha )
+      { return ( alpha == F(0) ? F(1) : alpha/F(Abs(alpha)) ); };
+
+    Matrix<F> x, z;
+    Ones( x, n, 1 );
+    x *= Real(1)/Real(n);
+    Real oneNormInv = 0;
+    Int jPrev = -1;
+    for( Int numIts=0; numIts<maxIts; ++numIts )
+    {
+        // x := inv(R) x
+        Trsv( UPPER, NORMAL, NON_UNIT, R, x );
+        const Real oneNormInvNew = OneNorm( x );
+        if( numIts > 0 && oneNormInvNew <= oneNormInv )
+            break;
+        oneNormInv = oneNormInvNew;
+
+        // z := inv(R)^H sign(x)
+        z = x;
+        EntrywiseMap( z, function<F(const F&)>(entrySign) );
+        Trsv( UPPER, ADJOINT, NON_UNIT, R, z );
+
+        const auto maxLoc = VectorMaxAbsLoc( z );
+        if( jPrev != -1 && maxLoc.value <= RealPart(z(jPrev)) )
+            break;
+        jPrev = maxLoc.index;
+        Zeros( x, n, 1 );
+        x(jPrev) = F(1);
+    }
+    return Real(1)/oneNormInv;
+}
+
+template<typename F>
+Base<F> QDWHSMinUpper( const DistMatrix<F>& R )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = R.Grid();
+    const Int n = R.Height();
+    const Int maxIts = 5;
+    if( n == 0 )
+        return Real(1);
+    // An exactly singular factor admits the trivial lower bound of zero (and
+    // would produce Infs and NaNs in the triangular solves)
+    if( MinAbsLoc(GetDiagonal(R)).value == Real(0) )
+        return Real(0);
+
+    auto entrySign = []( const F& alpha )
+      { return ( alpha == F(0) ? F(1) : alpha/F(Abs(alpha)) ); };
+
+    DistMatrix<F> x(g), z(g);
+    Ones( x, n, 1 );
+    x *= Real(1)/Real(n);
+    Real oneNormInv = 0;
+    Int jPrev = -1;
+    for( Int numIts=0; numIts<maxIts; ++numIts )
+    {
+        // x := inv(R) x
+        Trsv( UPPER, NORMAL, NON_UNIT, R, x );
+        const Real oneNormInvNew = OneNorm( x );
+        if( numIts > 0 && oneNormInvNew <= oneNormInv )
+            break;
+        oneNormInv = oneNormInvNew;
+
+        // z := inv(R)^H sign(x)
+        z = x;
+        EntrywiseMap( z, function<F(const F&)>(entrySign) );
+        Trsv( UPPER, ADJOINT, NON_UNIT, R, z );
+
+        const auto maxLoc = VectorMaxAbsLoc( z );
+        if( jPrev != -1 && maxLoc.value <= RealPart(z.Get(jPrev,0)) )
+            break;
+        jPrev = maxLoc.index;
+        Zeros( x, n, 1 );
+        x.Set( jPrev, 0, F(1) );
+    }
+    return Real(1)/oneNormInv;
+}
+
 template<typename F>
 QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
 {
@@ -123,29 +224,13 @@ QDWHInfo QDWH( Matrix<F>& A, const QDWHCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
+    // Form the triangular factor of a QR factorization (which shares its
+    // singular values with the rescaled matrix) and cheaply estimate
+    // 1 / || inv(R) ||_1 from it via Hager-Higham rather than explicitly
+    // forming an inverse
     Matrix<F> Y( A );
-    if( A.Height() > A.Width() )
-    {
-        qr::ExplicitTriang( Y );
-        try
-        {
-            TriangularInverse( UPPER, NON_UNIT, Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
-    else
-    {
-        try
-        {
-            Inverse( Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
+    qr::ExplicitTriang( Y );
+    const Real sMinUpper = QDWHSMinUpper( Y );
 
     return QDWHInner( A, sMinUpper, ctrl );
 }
@@ -274,29 +359,13 @@ QDWH( AbstractDistMatrix<F>& APre, const QDWHCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
+    // Form the triangular factor of a QR factorization (which shares its
+    // singular values with the rescaled matrix) and cheaply estimate
+    // 1 / || inv(R) ||_1 from it via Hager-Higham rather than explicitly
+    // forming an inverse
     DistMatrix<F> Y( A );
-    if( A.Height() > A.Width() )
-    {
-        qr::ExplicitTriang( Y );
-        try
-        {
-            TriangularInverse( UPPER, NON_UNIT, Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
-    else
-    {
-        try
-        {
-            Inverse( Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
+    qr::ExplicitTriang( Y );
+    const Real sMinUpper = QDWHSMinUpper( Y );
 
     return QDWHInner( A, sMinUpper, ctrl );
 }
@@ -442,17 +511,13 @@ QDWH( UpperOrLower uplo, Matrix<F>& A, const QDWHCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
+    // Form the triangular factor of a QR factorization (which shares its
+    // singular values with the rescaled matrix) and cheaply estimate
+    // 1 / || inv(R) ||_1 from it via Hager-Higham rather than explicitly
+    // forming an inverse
     Matrix<F> Y( A );
-    try
-    {
-        Inverse( Y );
-        sMinUpper = Real(1) / OneNorm( Y );
-    } catch( SingularMatrixException& e ) { sMinUpper = 0; }
+    qr::ExplicitTriang( Y );
+    const Real sMinUpper = polar::QDWHSMinUpper( Y );
 
     return QDWHInner( uplo, A, sMinUpper, ctrl );
 }
@@ -596,17 +661,13 @@ QDWH( UpperOrLower uplo, AbstractDistMatrix<F>& APre, const QDWHCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
+    // Form the triangular factor of a QR factorization (which shares its
+    // singular values with the rescaled matrix) and cheaply estimate
+    // 1 / || inv(R) ||_1 from it via Hager-Higham rather than explicitly
+    // forming an inverse
     DistMatrix<F> Y( A );
-    try
-    {
-        Inverse( Y );
-        sMinUpper = Real(1) / OneNorm( Y );
-    } catch( SingularMatrixException& e ) { sMinUpper = 0; }
+    qr::ExplicitTriang( Y );
+    const Real sMinUpper = polar::QDWHSMinUpper( Y );
 
     return QDWHInner( uplo, A, sMinUpper, ctrl );
 }
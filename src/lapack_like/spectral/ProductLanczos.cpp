@@ -98,6 +98,76 @@ Base<Field> ProductLanczosDecomp
     }
 }
 
+template<typename Field>
+void ProductLanczos
+( const MatrixFreeOperator<Field>& A,
+        Matrix<Base<Field>>& T,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    Matrix<Field> S;
+
+    if( m >= n )
+    {
+        auto applyA =
+          [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+          {
+              A.Apply( X, S );
+              A.AdjointApply( S, Y );
+          };
+        Lanczos<Field>( n, applyA, T, basisSize );
+    }
+    else
+    {
+        auto applyA =
+          [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+          {
+              A.AdjointApply( X, S );
+              A.Apply( S, Y );
+          };
+        Lanczos<Field>( m, applyA, T, basisSize );
+    }
+}
+
+template<typename Field>
+Base<Field> ProductLanczosDecomp
+( const MatrixFreeOperator<Field>& A,
+        Matrix<Field>& V,
+        Matrix<Base<Field>>& T,
+        Matrix<Field>& v,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    Matrix<Field> S;
+
+    if( m >= n )
+    {
+        auto applyA =
+          [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+          {
+              A.Apply( X, S );
+              A.AdjointApply( S, Y );
+          };
+        return LanczosDecomp( n, applyA, V, T, v, basisSize );
+    }
+    else
+    {
+        auto applyA =
+          [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+          {
+              A.AdjointApply( X, S );
+              A.Apply( S, Y );
+          };
+        return LanczosDecomp( m, applyA, V, T, v, basisSize );
+    }
+}
+
 template<typename Field>
 void ProductLanczos
 ( const DistSparseMatrix<Field>& A,
@@ -208,6 +278,16 @@ Base<Field> ProductLanczosDecomp
           DistMultiVec<Field>& V, \
           AbstractDistMatrix<Base<Field>>& T, \
           DistMultiVec<Field>& v, \
+          Int basisSize ); \
+  template void ProductLanczos \
+  ( const MatrixFreeOperator<Field>& A, \
+          Matrix<Base<Field>>& T, \
+          Int basisSize ); \
+  template Base<Field> ProductLanczosDecomp \
+  ( const MatrixFreeOperator<Field>& A, \
+          Matrix<Field>& V, \
+          Matrix<Base<Field>>& T, \
+          Matrix<Field>& v, \
           Int basisSize );
 
 #define EL_NO_INT_PROTO
@@ -21,6 +21,86 @@
 
 namespace El {
 
+namespace pspec {
+
+// Propagate a large cloud of shifts through the shared multi-shift solves
+// in contiguous batches of at most maxBatchWidth shifts (each of which
+// still deflates its converged shifts internally) so that the iterate
+// storage never exceeds maxBatchWidth columns
+template<typename Real,class CloudType>
+Matrix<Int> BatchCloud
+( const Matrix<Complex<Real>>& shifts,
+        Matrix<Real>& invNorms,
+        Int maxBatchWidth,
+  const CloudType& cloud )
+{
+    EL_DEBUG_CSE
+    const Int numShifts = shifts.Height();
+    Matrix<Int> itCounts;
+    Zeros( itCounts, numShifts, 1 );
+    invNorms.Resize( numShifts, 1 );
+    for( Int shiftOff=0; shiftOff<numShifts; shiftOff+=maxBatchWidth )
+    {
+        const Int batchSize = Min( maxBatchWidth, numShifts-shiftOff );
+        auto shiftsBatch = shifts( IR(shiftOff,shiftOff+batchSize), ALL );
+        Matrix<Real> invNormsBatch;
+        auto itCountsBatch = cloud( shiftsBatch, invNormsBatch );
+        auto invNormsSub = invNorms( IR(shiftOff,shiftOff+batchSize), ALL );
+        invNormsSub = invNormsBatch;
+        auto itCountsSub = itCounts( IR(shiftOff,shiftOff+batchSize), ALL );
+        itCountsSub = itCountsBatch;
+    }
+    return itCounts;
+}
+
+template<typename Real,class CloudType>
+DistMatrix<Int,VR,STAR> BatchCloud
+( const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        AbstractDistMatrix<Real>& invNorms,
+        Int maxBatchWidth,
+  const CloudType& cloud )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& g = shifts.Grid();
+    const Int numShifts = shifts.Height();
+    DistMatrix<Int,VR,STAR> itCounts(g);
+    itCounts.AlignWith( shifts );
+    Zeros( itCounts, numShifts, 1 );
+    DistMatrix<Real,VR,STAR> invNormsFull(g);
+    invNormsFull.AlignWith( shifts );
+    Zeros( invNormsFull, numShifts, 1 );
+    for( Int shiftOff=0; shiftOff<numShifts; shiftOff+=maxBatchWidth )
+    {
+        const Int batchSize = Min( maxBatchWidth, numShifts-shiftOff );
+        DistMatrix<C,VR,STAR> shiftsBatch(g);
+        shiftsBatch = shifts( IR(shiftOff,shiftOff+batchSize), ALL );
+        DistMatrix<Real,VR,STAR> invNormsBatch(g);
+        auto itCountsBatch = cloud( shiftsBatch, invNormsBatch );
+        auto invNormsSub =
+          invNormsFull( IR(shiftOff,shiftOff+batchSize), ALL );
+        invNormsSub = invNormsBatch;
+        auto itCountsSub = itCounts( IR(shiftOff,shiftOff+batchSize), ALL );
+        itCountsSub = itCountsBatch;
+    }
+    Copy( invNormsFull, invNorms );
+    return itCounts;
+}
+
+// Image snapshots of an individual batch could not be reshaped into the
+// full portrait grid, so they are disabled within each batch
+template<typename Real>
+PseudospecCtrl<Real> BatchSubCtrl( const PseudospecCtrl<Real>& psCtrl )
+{
+    auto subCtrl = psCtrl;
+    subCtrl.maxBatchWidth = 0;
+    subCtrl.snapCtrl.realSize = 0;
+    subCtrl.snapCtrl.imagSize = 0;
+    return subCtrl;
+}
+
+} // namespace pspec
+
 template<typename Field>
 Matrix<Int> TriangularSpectralCloud
 ( const Matrix<Field>& UPre,
@@ -32,6 +112,17 @@ Matrix<Int> TriangularSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const Matrix<C>& shiftsBatch, Matrix<Real>& invNormsBatch )
+          { return TriangularSpectralCloud
+            ( UPre, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // Force U to be complex in as cheap of a manner as possible
     MatrixReadProxy<Field,C> UProx( UPre );
     auto& U = UProx.GetLocked();
@@ -85,6 +176,17 @@ Matrix<Int> TriangularSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const Matrix<C>& shiftsBatch, Matrix<Real>& invNormsBatch )
+          { return TriangularSpectralCloud
+            ( UPre, QPre, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // Force U to be complex as cheaply as possible
     MatrixReadProxy<Field,C> UProx( UPre );
     auto& U = UProx.GetLocked();
@@ -139,6 +241,18 @@ Matrix<Int> QuasiTriangularSpectralCloud
 {
     EL_DEBUG_CSE
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const Matrix<Complex<Real>>& shiftsBatch,
+                     Matrix<Real>& invNormsBatch )
+          { return QuasiTriangularSpectralCloud
+            ( U, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // Check if the off-diagonal is sufficiently small; if so, compute the
     // pseudospectrum analytically from the eigenvalues. This also takes care
     // of the case where the matrix is a constant multiple of the identity
@@ -174,6 +288,18 @@ Matrix<Int> QuasiTriangularSpectralCloud
 {
     EL_DEBUG_CSE
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const Matrix<Complex<Real>>& shiftsBatch,
+                     Matrix<Real>& invNormsBatch )
+          { return QuasiTriangularSpectralCloud
+            ( U, Q, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // Check if the off-diagonal is sufficiently small; if so, compute the
     // pseudospectrum analytically from the eigenvalues. This also takes care
     // of the case where the matrix is a constant multiple of the identity
@@ -210,6 +336,17 @@ Matrix<Int> HessenbergSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const Matrix<C>& shiftsBatch, Matrix<Real>& invNormsBatch )
+          { return HessenbergSpectralCloud
+            ( HPre, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // Force H to be complex as cheaply as possible
     MatrixReadProxy<Field,C> HProx( HPre );
     auto& H = HProx.GetLocked();
@@ -246,6 +383,17 @@ Matrix<Int> HessenbergSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const Matrix<C>& shiftsBatch, Matrix<Real>& invNormsBatch )
+          { return HessenbergSpectralCloud
+            ( HPre, QPre, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // Force H to be complex as cheaply as possible
     MatrixReadProxy<Field,C> HProx( HPre );
     auto& H = HProx.GetLocked();
@@ -294,6 +442,18 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
     DistMatrixReadProxy<C,C,VR,STAR> shiftsProx( shiftsPre );
     auto& shifts = shiftsProx.GetLocked();
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch )
+          { return TriangularSpectralCloud
+            ( UPre, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // Check if the off-diagonal is sufficiently small; if so, compute the
     // pseudospectrum analytically from the eigenvalues. This also takes care
     // of the case where the matrix is a constant multiple of the identity
@@ -352,6 +512,18 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
     DistMatrixReadProxy<C,C,VR,STAR> shiftsProx( shiftsPre );
     auto& shifts = shiftsProx.GetLocked();
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch )
+          { return TriangularSpectralCloud
+            ( UPre, QPre, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // Check if the off-diagonal is sufficiently small; if so, compute the
     // pseudospectrum analytically from the eigenvalues. This also takes care
     // of the case where the matrix is a constant multiple of the identity
@@ -414,6 +586,18 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     DistMatrixReadProxy<C,C,VR,STAR> shiftsProx( shiftsPre );
     auto& shifts = shiftsProx.GetLocked();
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch )
+          { return QuasiTriangularSpectralCloud
+            ( U, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // Check if the off-diagonal is sufficiently small; if so, compute the
     // pseudospectrum analytically from the eigenvalues. This also takes care
     // of the case where the matrix is a constant multiple of the identity
@@ -460,6 +644,18 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     DistMatrixReadProxy<C,C,VR,STAR> shiftsProx( shiftsPre );
     auto& shifts = shiftsProx.GetLocked();
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch )
+          { return QuasiTriangularSpectralCloud
+            ( UPre, QPre, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // Check if the off-diagonal is sufficiently small; if so, compute the
     // pseudospectrum analytically from the eigenvalues. This also takes care
     // of the case where the matrix is a constant multiple of the identity
@@ -505,6 +701,18 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     DistMatrixReadProxy<C,C,VR,STAR> shiftsProx( shiftsPre );
     auto& shifts = shiftsProx.GetLocked();
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch )
+          { return HessenbergSpectralCloud
+            ( HPre, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // TODO: Check if the subdiagonal is sufficiently small, and, if so, revert
     //       to TriangularSpectralCloud
     psCtrl.schur = false;
@@ -544,6 +752,18 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     DistMatrixReadProxy<C,C,VR,STAR> shiftsProx( shiftsPre );
     auto& shifts = shiftsProx.GetLocked();
 
+    if( psCtrl.maxBatchWidth > 0 && shifts.Height() > psCtrl.maxBatchWidth )
+    {
+        auto subCtrl = pspec::BatchSubCtrl( psCtrl );
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shiftsBatch,
+                     DistMatrix<Real,VR,STAR>& invNormsBatch )
+          { return HessenbergSpectralCloud
+            ( HPre, QPre, shiftsBatch, invNormsBatch, subCtrl ); };
+        return pspec::BatchCloud
+        ( shifts, invNorms, psCtrl.maxBatchWidth, cloud );
+    }
+
     // TODO: Check if the subdiagonal is sufficiently small, and, if so, revert
     //       to TriangularSpectralCloud
     psCtrl.schur = false;
@@ -10,6 +10,7 @@
 
 #include "./SVD/Chan.hpp"
 #include "./SVD/Product.hpp"
+#include "./SVD/Randomized.hpp"
 
 namespace El {
 
@@ -209,6 +210,8 @@ SVDInfo SVD
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.useRandomized )
+        return svd::Randomized( A, U, s, V, ctrl );
     auto ACopy( A );
     auto ctrlMod( ctrl );
     ctrlMod.overwrite = true;
@@ -224,6 +227,8 @@ SVDInfo SVD
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.useRandomized )
+        return svd::Randomized( A, U, s, V, ctrl );
     const auto& bidiagSVDCtrl = ctrl.bidiagSVDCtrl;
     if( (bidiagSVDCtrl.wantU && bidiagSVDCtrl.accumulateU) ||
         (bidiagSVDCtrl.wantV && bidiagSVDCtrl.accumulateV) )
@@ -279,6 +284,8 @@ SVDInfo SVD
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.useRandomized )
+        return svd::Randomized( A, U, s, V, ctrl );
     DistMatrix<Field> ACopy( A );
     auto ctrlMod( ctrl );
     ctrlMod.overwrite = true;
@@ -294,6 +301,8 @@ SVDInfo SVD
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.useRandomized )
+        return svd::Randomized( A, U, s, V, ctrl );
     const auto& bidiagSVDCtrl = ctrl.bidiagSVDCtrl;
     if( (bidiagSVDCtrl.wantU && bidiagSVDCtrl.accumulateU) ||
         (bidiagSVDCtrl.wantV && bidiagSVDCtrl.accumulateV) )
@@ -766,7 +775,19 @@ SVDInfo TSQR
   ( const AbstractDistMatrix<Field>& A, \
           AbstractDistMatrix<Field>& U, \
           AbstractDistMatrix<Base<Field>>& s, \
-          AbstractDistMatrix<Field>& V );
+          AbstractDistMatrix<Field>& V ); \
+  template SVDInfo svd::Randomized \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          Matrix<Field>& V, \
+    const SVDCtrl<Base<Field>>& ctrl ); \
+  template SVDInfo svd::Randomized \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& U, \
+          AbstractDistMatrix<Base<Field>>& s, \
+          AbstractDistMatrix<Field>& V, \
+    const SVDCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
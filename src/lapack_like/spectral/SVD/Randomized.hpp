@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_SVD_RANDOMIZED_HPP
+#define EL_SPECTRAL_SVD_RANDOMIZED_HPP
+
+namespace El {
+namespace svd {
+
+// CITATION
+//
+// Please see
+//
+//   N. Halko, P. G. Martinsson, and J. A. Tropp,
+//   "Finding structure with randomness: Probabilistic algorithms for
+//   constructing approximate matrix decompositions",
+//   SIAM Review, 53(2), pp. 217--288, 2011,
+//
+// particularly Algorithms 4.4 and 5.1, for the randomized range-finder with
+// power iteration that the following drivers implement. The sketched range
+// is reorthogonalized after every application of A or A^H (via
+// qr::ExplicitUnitary) to avoid collapsing onto the dominant singular
+// subspace in finite precision.
+
+template<typename Field>
+SVDInfo Randomized
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    if( m < n )
+    {
+        // Apply the algorithm to A^H and swap the roles of U and V
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        return Randomized( AAdj, V, s, U, ctrl );
+    }
+
+    const Int rank = ctrl.randomizedCtrl.rank;
+    if( rank <= 0 )
+        LogicError("Randomized SVD requires a positive rank target");
+    const Int numOversample = Max( ctrl.randomizedCtrl.oversample, Int(0) );
+    const Int l = Min( rank+numOversample, n );
+
+    // Sketch the range of A with a Gaussian test matrix and sharpen the
+    // estimate with power iterations
+    Matrix<Field> Omega, Q, Z;
+    Gaussian( Omega, n, l );
+    Zeros( Q, m, l );
+    Gemm( NORMAL, NORMAL, Field(1), A, Omega, Field(0), Q );
+    qr::ExplicitUnitary( Q );
+    for( Int iter=0; iter<ctrl.randomizedCtrl.numPowerIts; ++iter )
+    {
+        Zeros( Z, n, l );
+        Gemm( ADJOINT, NORMAL, Field(1), A, Q, Field(0), Z );
+        qr::ExplicitUnitary( Z );
+        Zeros( Q, m, l );
+        Gemm( NORMAL, NORMAL, Field(1), A, Z, Field(0), Q );
+        qr::ExplicitUnitary( Q );
+    }
+
+    // A ~= Q (Q^H A), so the singular triplets can be recovered from the
+    // (tall) small dense SVD of C := (Q^H A)^H = UC Sigma VC^H via
+    // A ~= (Q VC) Sigma UC^H
+    Matrix<Field> C, UC, VC;
+    Zeros( C, n, l );
+    Gemm( ADJOINT, NORMAL, Field(1), A, Q, Field(0), C );
+    SVDCtrl<Real> subCtrl;
+    subCtrl.overwrite = true;
+    subCtrl.useLAPACK = ctrl.useLAPACK;
+    auto info = SVD( C, UC, s, VC, subCtrl );
+
+    // Truncate to the target rank (and, optionally, relative tolerance)
+    Int k = Min( rank, s.Height() );
+    const Real relTol = Real(ctrl.randomizedCtrl.relTol);
+    if( relTol > Real(0) && s.Height() > 0 )
+    {
+        const Real thresh = relTol*s(0);
+        while( k > 0 && s(k-1) <= thresh )
+            --k;
+    }
+    s.Resize( k, 1 );
+    auto VCk = VC( ALL, IR(0,k) );
+    Zeros( U, m, k );
+    Gemm( NORMAL, NORMAL, Field(1), Q, VCk, Field(0), U );
+    auto UCk = UC( ALL, IR(0,k) );
+    V = UCk;
+
+    return info;
+}
+
+template<typename Field>
+SVDInfo Randomized
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    if( m < n )
+    {
+        // Apply the algorithm to A^H and swap the roles of U and V
+        DistMatrix<Field> AAdj(g);
+        Adjoint( A, AAdj );
+        return Randomized( AAdj, V, s, U, ctrl );
+    }
+
+    const Int rank = ctrl.randomizedCtrl.rank;
+    if( rank <= 0 )
+        LogicError("Randomized SVD requires a positive rank target");
+    const Int numOversample = Max( ctrl.randomizedCtrl.oversample, Int(0) );
+    const Int l = Min( rank+numOversample, n );
+
+    // Sketch the range of A with a Gaussian test matrix and sharpen the
+    // estimate with power iterations
+    DistMatrix<Field> Omega(g), Q(g), Z(g);
+    Gaussian( Omega, n, l );
+    Zeros( Q, m, l );
+    Gemm( NORMAL, NORMAL, Field(1), A, Omega, Field(0), Q );
+    qr::ExplicitUnitary( Q );
+    for( Int iter=0; iter<ctrl.randomizedCtrl.numPowerIts; ++iter )
+    {
+        Zeros( Z, n, l );
+        Gemm( ADJOINT, NORMAL, Field(1), A, Q, Field(0), Z );
+        qr::ExplicitUnitary( Z );
+        Zeros( Q, m, l );
+        Gemm( NORMAL, NORMAL, Field(1), A, Z, Field(0), Q );
+        qr::ExplicitUnitary( Q );
+    }
+
+    // A ~= Q (Q^H A), so the singular triplets can be recovered from the
+    // (tall) small dense SVD of C := (Q^H A)^H = UC Sigma VC^H via
+    // A ~= (Q VC) Sigma UC^H
+    DistMatrix<Field> C(g), UC(g), VC(g);
+    Zeros( C, n, l );
+    Gemm( ADJOINT, NORMAL, Field(1), A, Q, Field(0), C );
+    SVDCtrl<Real> subCtrl;
+    subCtrl.overwrite = true;
+    subCtrl.useLAPACK = ctrl.useLAPACK;
+    subCtrl.useScaLAPACK = ctrl.useScaLAPACK;
+    auto info = SVD( C, UC, s, VC, subCtrl );
+
+    // Truncate to the target rank (and, optionally, relative tolerance)
+    Int k = Min( rank, s.Height() );
+    const Real relTol = Real(ctrl.randomizedCtrl.relTol);
+    if( relTol > Real(0) && s.Height() > 0 )
+    {
+        const Real thresh = relTol*s.Get(0,0);
+        while( k > 0 && s.Get(k-1,0) <= thresh )
+            --k;
+    }
+    s.Resize( k, 1 );
+    auto VCk = VC( ALL, IR(0,k) );
+    DistMatrix<Field> UTrunc(g);
+    Zeros( UTrunc, m, k );
+    Gemm( NORMAL, NORMAL, Field(1), Q, VCk, Field(0), UTrunc );
+    Copy( UTrunc, U );
+    auto UCk = UC( ALL, IR(0,k) );
+    Copy( UCk, V );
+
+    return info;
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_SVD_RANDOMIZED_HPP
@@ -11,6 +11,7 @@
 #include "./Schur/CheckReal.hpp"
 #include "./Schur/RealToComplex.hpp"
 #include "./Schur/QuasiTriangEig.hpp"
+#include "./Schur/Reorder.hpp"
 #include "./Schur/Condense.hpp"
 #include "./Schur/SDC.hpp"
 #include "./Schur/InverseFreeSDC.hpp"
@@ -130,7 +131,16 @@ void Schur
   schur::QuasiTriangEig( const AbstractDistMatrix<F>& U ); \
   template void schur::QuasiTriangEig \
   ( const AbstractDistMatrix<F>& U, \
-          AbstractDistMatrix<Complex<Base<F>>>& w );
+          AbstractDistMatrix<Complex<Base<F>>>& w ); \
+  template Int schur::ReorderSchur \
+  ( Matrix<F>& U, \
+    const vector<bool>& select, \
+    Int windowSize ); \
+  template Int schur::ReorderSchur \
+  ( Matrix<F>& U, \
+    Matrix<F>& Q, \
+    const vector<bool>& select, \
+    Int windowSize );
 
 #define PROTO_REAL(Real) \
   PROTO(Real) \
@@ -0,0 +1,181 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SCHUR_REORDER_HPP
+#define EL_SCHUR_REORDER_HPP
+
+namespace El {
+namespace schur {
+namespace reorder {
+
+// Swap the adjacent eigenvalues U(j,j) and U(j+1,j+1) with a unitary
+// similarity whose first column is the (unnormalized) eigenvector
+// [U(j,j+1), U(j+1,j+1)-U(j,j)] of the trailing eigenvalue, i.e., the
+// solution of the scalar Sylvester equation
+//
+//   U(j,j) x - x U(j+1,j+1) = -U(j,j+1)
+//
+// cleared of its denominator. The rotation is only applied within the rows
+// and columns of the window [winBeg,winBeg+W.Height()) and is accumulated
+// into W so that the out-of-window updates can later be performed as GEMMs.
+template<typename Field>
+void SwapWithinWindow( Matrix<Field>& U, Matrix<Field>& W, Int winBeg, Int j )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int winLen = W.Height();
+    const Int winEnd = winBeg + winLen;
+
+    const Field chi00 = U(j,  j  );
+    const Field chi01 = U(j,  j+1);
+    const Field chi11 = U(j+1,j+1);
+    Real c;
+    Field s;
+    Givens( chi01, chi11-chi00, c, s );
+
+    // Apply G = | c, s; -Conj(s), c | from the left to rows j and j+1
+    for( Int k=j; k<winEnd; ++k )
+    {
+        const Field upsilon0 = U(j,  k);
+        const Field upsilon1 = U(j+1,k);
+        U(j,  k) =        c*upsilon0 + s*upsilon1;
+        U(j+1,k) = -Conj(s)*upsilon0 + c*upsilon1;
+    }
+    // Apply G^H from the right to columns j and j+1
+    for( Int i=winBeg; i<j+2; ++i )
+    {
+        const Field upsilon0 = U(i,j  );
+        const Field upsilon1 = U(i,j+1);
+        U(i,j  ) =  c*upsilon0 + Conj(s)*upsilon1;
+        U(i,j+1) = -s*upsilon0 +       c*upsilon1;
+    }
+    // Accumulate G^H into the window transformation
+    const Int jLoc = j - winBeg;
+    for( Int i=0; i<winLen; ++i )
+    {
+        const Field omega0 = W(i,jLoc  );
+        const Field omega1 = W(i,jLoc+1);
+        W(i,jLoc  ) =  c*omega0 + Conj(s)*omega1;
+        W(i,jLoc+1) = -s*omega0 +       c*omega1;
+    }
+    U(j+1,j) = Field(0);
+}
+
+template<typename Field>
+Int Helper
+( Matrix<Field>& U,
+  Matrix<Field>& Q,
+  bool accumulate,
+  const vector<bool>& select,
+  Int windowSize )
+{
+    EL_DEBUG_CSE
+    const Int n = U.Height();
+    EL_DEBUG_ONLY(
+      if( U.Width() != n )
+          LogicError("Schur factor must be square");
+      if( Int(select.size()) != n )
+          LogicError("The selection must assign a flag to each eigenvalue");
+      if( accumulate && (Q.Height() != n || Q.Width() != n) )
+          LogicError("Schur vectors were of the wrong size");
+    )
+    for( Int j=0; j<n-1; ++j )
+        if( U(j+1,j) != Field(0) )
+            LogicError
+            ("ReorderSchur requires a genuinely triangular Schur form; "
+             "please run schur::RealToComplex first");
+    const Int nw = ( windowSize > 0 ? windowSize : Blocksize() );
+
+    Matrix<Field> W, B;
+    Int clusterSize = 0;
+    Int k = 0;
+    while( k < n )
+    {
+        if( !select[k] )
+        {
+            ++k;
+            continue;
+        }
+        // Find the contiguous run of selected eigenvalues starting at k
+        // (everything at or beyond position k is still in its original place)
+        Int runEnd = k+1;
+        while( runEnd < n && select[runEnd] )
+            ++runEnd;
+        const Int q = runEnd - k;
+
+        // Drag the run up to the top of the unassembled portion through a
+        // sequence of diagonal windows
+        Int top = k;
+        while( top > clusterSize )
+        {
+            const Int winLen = Min( Max(nw,q+1), top-clusterSize+q );
+            const Int winBeg = top + q - winLen;
+            const Int winEnd = winBeg + winLen;
+            Identity( W, winLen, winLen );
+
+            // Bubble each member of the run (topmost first) to the window top
+            for( Int u=0; u<q; ++u )
+                for( Int j=top+u-1; j>=winBeg+u; --j )
+                    SwapWithinWindow( U, W, winBeg, j );
+
+            // Broadcast the accumulated window transformation to the
+            // out-of-window rows and columns (and the Schur vectors)
+            if( winBeg > 0 )
+            {
+                auto U01 = U( IR(0,winBeg), IR(winBeg,winEnd) );
+                B = U01;
+                Gemm( NORMAL, NORMAL, Field(1), B, W, U01 );
+            }
+            if( winEnd < n )
+            {
+                auto U12 = U( IR(winBeg,winEnd), IR(winEnd,n) );
+                B = U12;
+                Gemm( ADJOINT, NORMAL, Field(1), W, B, U12 );
+            }
+            if( accumulate )
+            {
+                auto Q1 = Q( ALL, IR(winBeg,winEnd) );
+                B = Q1;
+                Gemm( NORMAL, NORMAL, Field(1), B, W, Q1 );
+            }
+            top = winBeg;
+        }
+        clusterSize += q;
+        k = runEnd;
+    }
+    return clusterSize;
+}
+
+} // namespace reorder
+
+template<typename Field>
+Int ReorderSchur
+( Matrix<Field>& U,
+  const vector<bool>& select,
+  Int windowSize )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> Q;
+    return reorder::Helper( U, Q, false, select, windowSize );
+}
+
+template<typename Field>
+Int ReorderSchur
+( Matrix<Field>& U,
+  Matrix<Field>& Q,
+  const vector<bool>& select,
+  Int windowSize )
+{
+    EL_DEBUG_CSE
+    return reorder::Helper( U, Q, true, select, windowSize );
+}
+
+} // namespace schur
+} // namespace El
+
+#endif // ifndef EL_SCHUR_REORDER_HPP
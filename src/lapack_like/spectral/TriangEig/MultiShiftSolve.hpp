@@ -593,6 +593,14 @@ void MultiShiftSolve
     const Int bsize = Blocksize();
     const Int kLast = LastOffset( m, bsize );
 
+    const Real oneHalf = Real(1)/Real(2);
+
+    const Real underflow = limits::SafeMin<Real>();
+    const Real overflow = limits::Max<Real>();
+    const Real ulp = limits::Precision<Real>();
+    const Real smallNum = Max( underflow/ulp, Real(1)/(overflow*ulp) );
+    const Real bigNum = Real(1)/smallNum;
+
     DistMatrixReadProxy<Field,Field,MC,MR> UProx( UPre );
     DistMatrixReadProxy<Field,Field,VR,STAR> shiftsProx( shiftsPre );
     DistMatrixReadWriteProxy<Field,Field,MC,MR> XProx( XPre );
@@ -609,12 +617,36 @@ void MultiShiftSolve
     DistMatrix<Field,STAR,VR  > X1_STAR_VR(g);
     DistMatrix<Field,VR,  STAR> scalesUpdate_VR_STAR(g);
     DistMatrix<Field,MR,  STAR> scalesUpdate_MR_STAR(g);
+    DistMatrix<Real,STAR,STAR> cNorms_STAR_STAR(g);
 
     Ones( scales, n, 1 );
     scalesUpdate_VR_STAR.Resize( n, 1 );
 
-    // TODO(poulson): Intitialize XMax with the largest entry of each RHS
-    // TODO(poulson): Rescale X if any of the columns are too large
+    // Determine the largest entry of each RHS and rescale the overly large
+    // columns (since the strictly lower portion of each column of X is zero,
+    // the full column norms agree with those of the active trapezoids)
+    DistMatrix<Real,MR,STAR> XMax_MR_STAR(g);
+    ColumnMaxNorms( X, XMax_MR_STAR );
+    DistMatrix<Field,MR,STAR> rescale_MR_STAR(g);
+    rescale_MR_STAR.AlignWith( XMax_MR_STAR );
+    Ones( rescale_MR_STAR, n, 1 );
+    auto& XMaxLoc = XMax_MR_STAR.Matrix();
+    auto& rescaleLoc = rescale_MR_STAR.Matrix();
+    const Int XLocalWidth = X.LocalWidth();
+    for( Int jLoc=0; jLoc<XLocalWidth; ++jLoc )
+    {
+        Real xjMax = XMaxLoc(jLoc);
+        if( xjMax >= bigNum )
+        {
+            const Real s = oneHalf*bigNum/xjMax;
+            blas::Scal( X.LocalHeight(), s, X.Buffer(0,jLoc), 1 );
+            xjMax *= s;
+            rescaleLoc(jLoc) = s;
+        }
+        xjMax = Max( xjMax, 2*smallNum );
+        XMaxLoc(jLoc) = xjMax;
+    }
+    DiagonalScale( LEFT, NORMAL, rescale_MR_STAR, scales );
 
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -647,10 +679,27 @@ void MultiShiftSolve
         X1_STAR_MR = X1_STAR_VR; // X1[* ,MR]  <- X1[* ,VR]
         X1 = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
 
+        // Compute the mean infinity norm of the columns of U01 for the
+        // forthcoming GEMM overflow checks
+        // Note: nb*cNorm is the sum of infinity norms
+        Real cNorm = 0;
+        if( k > 0 )
+        {
+            U01_MC_STAR.AlignWith( X0 );
+            U01_MC_STAR = U01; // U01[MC,* ] <- U01[MC,MR]
+            ColumnMaxNorms( U01_MC_STAR, cNorms_STAR_STAR );
+            auto& cNormsLoc = cNorms_STAR_STAR.Matrix();
+            for( Int j=0; j<nb; ++j )
+                cNorm += cNormsLoc(j) / nb;
+        }
+
         // Apply scalings on RHS
         scalesUpdate_MR_STAR.AlignWith( X1 );
         scalesUpdate_MR_STAR = scalesUpdate_VR_STAR;
         auto& scalesUpdateLoc = scalesUpdate_MR_STAR.Matrix();
+        auto XMaxActive = XMax_MR_STAR( IR(k,END), ALL );
+        auto& XMaxActiveLoc = XMaxActive.Matrix();
+        auto& X1_STAR_MR_Loc = X1_STAR_MR.Matrix();
         const Int X1LocalWidth = X1.LocalWidth();
         for( Int jActiveLoc=0; jActiveLoc<X1LocalWidth; ++jActiveLoc )
         {
@@ -662,8 +711,7 @@ void MultiShiftSolve
                 ( X0.LocalHeight(), sigma, X0.Buffer(0,jActiveLoc), 1 );
                 blas::Scal
                 ( X2.LocalHeight(), sigma, X2.Buffer(0,jActiveLoc), 1 );
-
-                // TODO(poulson): Update XMax
+                XMaxActiveLoc(jActiveLoc) *= sigma;
             }
             else
             {
@@ -671,19 +719,49 @@ void MultiShiftSolve
                 // have an effect. This is somewhat of a hack.
                 scalesUpdateLoc(jActiveLoc) = Field(1);
             }
+
+            if( k > 0 )
+            {
+                // Check for possible overflows in GEMM
+                // Note: G(i+1) <= G(i) + nb*cNorm*|| X1[:,j] ||_infty
+                Real xjMax = XMaxActiveLoc(jActiveLoc);
+                Real X1Max = 0;
+                for( Int i=0; i<nb; ++i )
+                    X1Max = Max( X1Max, Abs(X1_STAR_MR_Loc(i,jActiveLoc)) );
+                Real s = 1;
+                if( X1Max >= 1 &&
+                    cNorm >= (bigNum-xjMax)/X1Max/nb )
+                {
+                    s = oneHalf/(X1Max*nb);
+                }
+                else if( X1Max < 1 &&
+                         cNorm*X1Max >= (bigNum-xjMax)/nb )
+                {
+                    s = oneHalf/nb;
+                }
+                if( s != Real(1) )
+                {
+                    blas::Scal
+                    ( X0.LocalHeight(), s, X0.Buffer(0,jActiveLoc), 1 );
+                    blas::Scal
+                    ( X1.LocalHeight(), s, X1.Buffer(0,jActiveLoc), 1 );
+                    blas::Scal
+                    ( X2.LocalHeight(), s, X2.Buffer(0,jActiveLoc), 1 );
+                    blas::Scal( nb, s, X1_STAR_MR.Buffer(0,jActiveLoc), 1 );
+                    scalesUpdateLoc(jActiveLoc) *= s;
+                    xjMax *= s;
+                    X1Max *= s;
+                }
+                XMaxActiveLoc(jActiveLoc) = xjMax + nb*cNorm*X1Max;
+            }
         }
         auto scalesActive = scales(IR(k,END),ALL);
         DiagonalScale( LEFT,  NORMAL, scalesUpdate_MR_STAR, scalesActive );
 
         if( k > 0 )
         {
-            // TODO(poulson): Compute infinity norms of columns in U01
-            // TODO(poulson): Check for possible overflows in GEMM
-
             // Update RHS with GEMM
             // X0[MC,MR] -= U01[MC,* ] X1[* ,MR]
-            U01_MC_STAR.AlignWith( X0 );
-            U01_MC_STAR = U01; // U01[MC,* ] <- U01[MC,MR]
             LocalGemm
             ( NORMAL, NORMAL,
               Field(-1), U01_MC_STAR, X1_STAR_MR, Field(1), X0 );
@@ -152,8 +152,16 @@ Int Bisect
     while( sourceOff <= numLocalSources)
     { xAdj[sourceOff++] = validCounter; }
 
+#ifdef EL_HAVE_PARMETIS
+    const bool sequential = ctrl.sequential;
+#else
+    // Gracefully fall back to the gather-based sequential partitioner
+    // rather than erroring out when the distributed backend is unavailable
+    const bool sequential = true;
+#endif
+
     vector<idx_t> sizes(3);
-    if( ctrl.sequential )
+    if( sequential )
     {
         // Gather the number of local valid edges on the root process
         vector<Int> edgeSizes( commSize ), edgeOffs;
@@ -314,8 +322,6 @@ Int Bisect
 
         // Since idx_t might be different than Int
         std::copy( perm_idx_t.begin(), perm_idx_t.end(), perm.Buffer() );
-#else
-        LogicError("ParMETIS was not available");
 #endif
     }
     EL_DEBUG_ONLY(EnsurePermutation( perm ))
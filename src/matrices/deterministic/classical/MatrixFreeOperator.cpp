@@ -0,0 +1,449 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/matrices.hpp>
+
+namespace El {
+
+namespace {
+
+Int NextPowerOfTwo( Int n )
+{
+    Int m = 1;
+    while( m < n )
+        m <<= 1;
+    return m;
+}
+
+// An iterative radix-2 Cooley-Tukey transform over a power-of-two length.
+// The inverse includes the 1/n scaling.
+template<typename Real>
+void FFTPow2( Complex<Real>* x, Int n, bool inverse )
+{
+    typedef Complex<Real> C;
+    for( Int i=1, jRev=0; i<n; ++i )
+    {
+        Int bit = n >> 1;
+        for( ; jRev&bit; bit>>=1 )
+            jRev ^= bit;
+        jRev ^= bit;
+        if( i < jRev )
+            std::swap( x[i], x[jRev] );
+    }
+    const Real pi = 4*Atan( Real(1) );
+    for( Int len=2; len<=n; len<<=1 )
+    {
+        const Real theta = (inverse ? 2 : -2)*pi/Real(len);
+        const C wLen( Cos(theta), Sin(theta) );
+        for( Int i=0; i<n; i+=len )
+        {
+            C w( Real(1) );
+            for( Int k=0; k<len/2; ++k )
+            {
+                const C u = x[i+k];
+                const C t = w*x[i+k+len/2];
+                x[i+k] = u + t;
+                x[i+k+len/2] = u - t;
+                w *= wLen;
+            }
+        }
+    }
+    if( inverse )
+        for( Int i=0; i<n; ++i )
+            x[i] /= Real(n);
+}
+
+// The quadratic chirp w_j = exp( -pi i j^2 / n ), with the exponent
+// reduced modulo 2n to preserve accuracy for large indices
+template<typename Real>
+Complex<Real> Chirp( Int j, Int n )
+{
+    const Real pi = 4*Atan( Real(1) );
+    const long long jSqrMod = (static_cast<long long>(j)*j) % (2LL*n);
+    const Real theta = -pi*Real(jSqrMod)/Real(n);
+    return Complex<Real>( Cos(theta), Sin(theta) );
+}
+
+// Bluestein's reduction of a length-n DFT to a power-of-two circular
+// convolution, for lengths which are not themselves powers of two
+template<typename Real>
+void FFTBluestein( Complex<Real>* x, Int n )
+{
+    typedef Complex<Real> C;
+    const Int M = NextPowerOfTwo( 2*n-1 );
+
+    vector<C> a( M, C(0) ), b( M, C(0) );
+    for( Int j=0; j<n; ++j )
+    {
+        const C w = Chirp<Real>( j, n );
+        a[j] = x[j]*w;
+        b[j] = Conj( w );
+        if( j > 0 )
+            b[M-j] = Conj( w );
+    }
+    FFTPow2( a.data(), M, false );
+    FFTPow2( b.data(), M, false );
+    for( Int j=0; j<M; ++j )
+        a[j] *= b[j];
+    FFTPow2( a.data(), M, true );
+    for( Int k=0; k<n; ++k )
+        x[k] = Chirp<Real>( k, n )*a[k];
+}
+
+// The unnormalized forward transform for an arbitrary length
+template<typename Real>
+void FFT( Complex<Real>* x, Int n )
+{
+    if( (n & (n-1)) == 0 )
+        FFTPow2( x, n, false );
+    else
+        FFTBluestein( x, n );
+}
+
+// The inverse transform (including the 1/n scaling) via conjugation
+template<typename Real>
+void InverseFFT( Complex<Real>* x, Int n )
+{
+    if( (n & (n-1)) == 0 )
+    {
+        FFTPow2( x, n, true );
+    }
+    else
+    {
+        for( Int j=0; j<n; ++j )
+            x[j] = Conj( x[j] );
+        FFTBluestein( x, n );
+        for( Int j=0; j<n; ++j )
+            x[j] = Conj( x[j] )/Real(n);
+    }
+}
+
+// The eigenvalues (under the DFT) of the power-of-two circulant embedding
+// of the m x n Toeplitz matrix with A(i,j) = a[i-j+(n-1)]
+template<typename Real>
+vector<Complex<Real>>
+ToeplitzEmbeddingEigs( Int m, Int n, const vector<Complex<Real>>& a )
+{
+    typedef Complex<Real> C;
+    const Int M = NextPowerOfTwo( m+n-1 );
+    vector<C> c( M, C(0) );
+    for( Int k=0; k<m; ++k )
+        c[k] = a[k+n-1];
+    for( Int l=1; l<n; ++l )
+        c[M-l] = a[n-1-l];
+    FFTPow2( c.data(), M, false );
+    return c;
+}
+
+// Y(:,j) := the first 'height' entries of the circular convolution of the
+// zero-padded X(:,j) with the embedding whose eigenvalues are 'eigs'
+template<typename Real>
+void ApplyEmbedding
+( const vector<Complex<Real>>& eigs,
+  Int height,
+  const Matrix<Complex<Real>>& X,
+        Matrix<Complex<Real>>& Y )
+{
+    typedef Complex<Real> C;
+    const Int M = eigs.size();
+    const Int width = X.Width();
+    Y.Resize( height, width );
+    vector<C> work( M );
+    for( Int j=0; j<width; ++j )
+    {
+        const Int xHeight = X.Height();
+        for( Int i=0; i<xHeight; ++i )
+            work[i] = X(i,j);
+        std::fill( work.begin()+xHeight, work.end(), C(0) );
+        FFTPow2( work.data(), M, false );
+        for( Int i=0; i<M; ++i )
+            work[i] *= eigs[i];
+        FFTPow2( work.data(), M, true );
+        for( Int i=0; i<height; ++i )
+            Y(i,j) = work[i];
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+MatrixFreeOperator<T>::MatrixFreeOperator()
+: height_(0), width_(0)
+{ }
+
+template<typename T>
+MatrixFreeOperator<T>::MatrixFreeOperator
+( Int height, Int width,
+  ApplyFunction apply,
+  ApplyFunction adjointApply )
+: height_(height), width_(width),
+  apply_(std::move(apply)), adjointApply_(std::move(adjointApply))
+{ }
+
+template<typename T>
+Int MatrixFreeOperator<T>::Height() const EL_NO_EXCEPT
+{ return height_; }
+
+template<typename T>
+Int MatrixFreeOperator<T>::Width() const EL_NO_EXCEPT
+{ return width_; }
+
+template<typename T>
+void MatrixFreeOperator<T>::Apply( const Matrix<T>& X, Matrix<T>& Y ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( X.Height() != width_ )
+          LogicError("The height of X must match the width of the operator");
+    )
+    if( !apply_ )
+        LogicError("The operator's application was not defined");
+    apply_( X, Y );
+}
+
+template<typename T>
+void MatrixFreeOperator<T>::AdjointApply
+( const Matrix<T>& X, Matrix<T>& Y ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( X.Height() != height_ )
+          LogicError("The height of X must match the height of the operator");
+    )
+    if( !adjointApply_ )
+        LogicError("The operator's adjoint application was not defined");
+    adjointApply_( X, Y );
+}
+
+template<typename T>
+void MatrixFreeOperator<T>::operator()
+( const Matrix<T>& X, Matrix<T>& Y ) const
+{ Apply( X, Y ); }
+
+template<typename Real>
+MatrixFreeOperator<Complex<Real>> FourierOperator( Int n )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Real nSqrt = Sqrt( Real(n) );
+
+    auto apply =
+      [=]( const Matrix<C>& X, Matrix<C>& Y )
+      {
+          const Int width = X.Width();
+          Y = X;
+          for( Int j=0; j<width; ++j )
+          {
+              FFT( Y.Buffer(0,j), n );
+              for( Int i=0; i<n; ++i )
+                  Y(i,j) /= nSqrt;
+          }
+      };
+    // The adjoint of the unitary DFT is sqrt(n) times the inverse DFT
+    auto adjointApply =
+      [=]( const Matrix<C>& X, Matrix<C>& Y )
+      {
+          const Int width = X.Width();
+          Y = X;
+          for( Int j=0; j<width; ++j )
+          {
+              InverseFFT( Y.Buffer(0,j), n );
+              for( Int i=0; i<n; ++i )
+                  Y(i,j) *= nSqrt;
+          }
+      };
+    return MatrixFreeOperator<C>( n, n, apply, adjointApply );
+}
+
+template<typename Real>
+MatrixFreeOperator<Complex<Real>>
+CirculantOperator( const vector<Complex<Real>>& a )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int n = a.size();
+
+    // A circulant matrix is diagonalized by the DFT, so its application is
+    // an entrywise scaling between a forward and an inverse transform
+    auto eigs = std::make_shared<vector<C>>( a );
+    FFT( eigs->data(), n );
+
+    auto apply =
+      [=]( const Matrix<C>& X, Matrix<C>& Y )
+      {
+          const Int width = X.Width();
+          Y = X;
+          for( Int j=0; j<width; ++j )
+          {
+              FFT( Y.Buffer(0,j), n );
+              for( Int i=0; i<n; ++i )
+                  Y(i,j) *= (*eigs)[i];
+              InverseFFT( Y.Buffer(0,j), n );
+          }
+      };
+    auto adjointApply =
+      [=]( const Matrix<C>& X, Matrix<C>& Y )
+      {
+          const Int width = X.Width();
+          Y = X;
+          for( Int j=0; j<width; ++j )
+          {
+              FFT( Y.Buffer(0,j), n );
+              for( Int i=0; i<n; ++i )
+                  Y(i,j) *= Conj( (*eigs)[i] );
+              InverseFFT( Y.Buffer(0,j), n );
+          }
+      };
+    return MatrixFreeOperator<C>( n, n, apply, adjointApply );
+}
+
+template<typename Real>
+MatrixFreeOperator<Complex<Real>>
+ToeplitzOperator( Int m, Int n, const vector<Complex<Real>>& a )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int length = m+n-1;
+    if( a.size() != Unsigned(length) )
+        LogicError("a was the wrong size");
+
+    // The adjoint is the n x m Toeplitz matrix generated by the reversed
+    // conjugates, A^H(i,j) = Conj(a[(m+n-2)-(i-j+(m-1))])
+    vector<C> aAdj( length );
+    for( Int p=0; p<length; ++p )
+        aAdj[p] = Conj( a[length-1-p] );
+
+    auto eigs = std::make_shared<vector<C>>
+      ( ToeplitzEmbeddingEigs( m, n, a ) );
+    auto eigsAdj = std::make_shared<vector<C>>
+      ( ToeplitzEmbeddingEigs( n, m, aAdj ) );
+
+    auto apply =
+      [=]( const Matrix<C>& X, Matrix<C>& Y )
+      { ApplyEmbedding( *eigs, m, X, Y ); };
+    auto adjointApply =
+      [=]( const Matrix<C>& X, Matrix<C>& Y )
+      { ApplyEmbedding( *eigsAdj, n, X, Y ); };
+    return MatrixFreeOperator<C>( m, n, apply, adjointApply );
+}
+
+template<typename Real>
+MatrixFreeOperator<Complex<Real>>
+HankelOperator( Int m, Int n, const vector<Complex<Real>>& a )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int length = m+n-1;
+    if( a.size() != Unsigned(length) )
+        LogicError("a was the wrong size");
+
+    // Reversing the rows of the Hankel matrix yields the Toeplitz matrix
+    // generated by the reversed vector, so the application is a circulant
+    // embedding apply followed by a row reversal. The adjoint is the n x m
+    // Hankel matrix generated by the conjugates.
+    vector<C> t( length ), tAdj( length );
+    for( Int p=0; p<length; ++p )
+    {
+        t[p] = a[length-1-p];
+        tAdj[p] = Conj( a[length-1-p] );
+    }
+    auto eigs = std::make_shared<vector<C>>
+      ( ToeplitzEmbeddingEigs( m, n, t ) );
+    auto eigsAdj = std::make_shared<vector<C>>
+      ( ToeplitzEmbeddingEigs( n, m, tAdj ) );
+
+    auto apply =
+      [=]( const Matrix<C>& X, Matrix<C>& Y )
+      {
+          ApplyEmbedding( *eigs, m, X, Y );
+          const Int width = Y.Width();
+          for( Int j=0; j<width; ++j )
+              for( Int i=0; i<m/2; ++i )
+                  std::swap( Y(i,j), Y(m-1-i,j) );
+      };
+    auto adjointApply =
+      [=]( const Matrix<C>& X, Matrix<C>& Y )
+      {
+          ApplyEmbedding( *eigsAdj, n, X, Y );
+          const Int width = Y.Width();
+          for( Int j=0; j<width; ++j )
+              for( Int i=0; i<n/2; ++i )
+                  std::swap( Y(i,j), Y(n-1-i,j) );
+      };
+    return MatrixFreeOperator<C>( m, n, apply, adjointApply );
+}
+
+template<typename T>
+MatrixFreeOperator<T>
+BandedOperator( Int lowerBandwidth, Int upperBandwidth, Matrix<T> A )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int kl = Max( lowerBandwidth, Int(0) );
+    const Int ku = Max( upperBandwidth, Int(0) );
+    auto APtr = std::make_shared<Matrix<T>>( std::move(A) );
+    auto apply =
+      [=]( const Matrix<T>& X, Matrix<T>& Y )
+      {
+          Y.Resize( m, X.Width() );
+          BandedGemm( NORMAL, kl, ku, T(1), *APtr, X, T(0), Y );
+      };
+    auto adjointApply =
+      [=]( const Matrix<T>& X, Matrix<T>& Y )
+      {
+          Y.Resize( n, X.Width() );
+          BandedGemm( ADJOINT, kl, ku, T(1), *APtr, X, T(0), Y );
+      };
+    return MatrixFreeOperator<T>( m, n, apply, adjointApply );
+}
+
+template<typename T>
+MatrixFreeOperator<T>
+HessenbergOperator( UpperOrLower uplo, Matrix<T> H )
+{
+    EL_DEBUG_CSE
+    const Int m = H.Height();
+    const Int n = H.Width();
+    if( uplo == UPPER )
+        return BandedOperator( 1, Max(n-1,Int(0)), std::move(H) );
+    else
+        return BandedOperator( Max(m-1,Int(0)), 1, std::move(H) );
+}
+
+#define PROTO(Real) \
+  template class MatrixFreeOperator<Real>; \
+  template class MatrixFreeOperator<Complex<Real>>; \
+  template MatrixFreeOperator<Real> BandedOperator \
+  ( Int lowerBandwidth, Int upperBandwidth, Matrix<Real> A ); \
+  template MatrixFreeOperator<Complex<Real>> BandedOperator \
+  ( Int lowerBandwidth, Int upperBandwidth, Matrix<Complex<Real>> A ); \
+  template MatrixFreeOperator<Real> HessenbergOperator \
+  ( UpperOrLower uplo, Matrix<Real> H ); \
+  template MatrixFreeOperator<Complex<Real>> HessenbergOperator \
+  ( UpperOrLower uplo, Matrix<Complex<Real>> H ); \
+  template MatrixFreeOperator<Complex<Real>> FourierOperator( Int n ); \
+  template MatrixFreeOperator<Complex<Real>> CirculantOperator \
+  ( const vector<Complex<Real>>& a ); \
+  template MatrixFreeOperator<Complex<Real>> ToeplitzOperator \
+  ( Int m, Int n, const vector<Complex<Real>>& a ); \
+  template MatrixFreeOperator<Complex<Real>> HankelOperator \
+  ( Int m, Int n, const vector<Complex<Real>>& a );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
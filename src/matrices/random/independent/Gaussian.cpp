@@ -21,21 +21,76 @@ void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
 
-template<typename F>
-void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+namespace gaussian {
+
+// Counter-based path: every rank draws its local entries directly from
+// their global indices, so the generated matrix is bit-identical for every
+// grid shape and process count and no rank waits on another's stream
+template<typename F,typename=EnableIf<IsStdScalar<F>>>
+void FillDist( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{
+    const uint64_t stream = NextPhiloxStream();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    F* ABuf = A.Matrix().Buffer();
+    const Int ALDim = A.Matrix().LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            ABuf[iLoc+jLoc*ALDim] =
+              CounterSampleNormal( stream, A.GlobalRow(iLoc), j, mean, stddev );
+    }
+}
+
+// Extended-precision samples would be truncated by the double-precision
+// counter transform, so such types keep the redundant-rank stream
+template<typename F,typename=DisableIf<IsStdScalar<F>>,typename=void>
+void FillDist( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
-    EL_DEBUG_CSE
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
 }
 
+template<typename F,typename=EnableIf<IsStdScalar<F>>>
+void FillDist( DistMultiVec<F>& A, F mean, Base<F> stddev )
+{
+    const uint64_t stream = NextPhiloxStream();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    const Int width = A.Width();
+    F* ABuf = A.Matrix().Buffer();
+    const Int ALDim = A.Matrix().LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            ABuf[iLoc+j*ALDim] =
+              CounterSampleNormal( stream, firstLocalRow+iLoc, j, mean, stddev );
+}
+
+template<typename F,typename=DisableIf<IsStdScalar<F>>,typename=void>
+void FillDist( DistMultiVec<F>& A, F mean, Base<F> stddev )
+{
+    auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
+    EntrywiseFill( A, function<F()>(sampleNormal) );
+}
+
+} // namespace gaussian
+
+template<typename F>
+void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{
+    EL_DEBUG_CSE
+    gaussian::FillDist( A, mean, stddev );
+}
+
 template<typename F>
 void MakeGaussian( DistMultiVec<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
-    auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
-    EntrywiseFill( A, function<F()>(sampleNormal) );
+    gaussian::FillDist( A, mean, stddev );
 }
 
 template<typename F>
@@ -30,15 +30,83 @@ void Uniform( Matrix<T>& A, Int m, Int n, T center, Base<T> radius )
     MakeUniform( A, center, radius );
 }
 
+namespace uniform {
+
+// The counter transform draws through double-precision uniforms, which
+// suits the standard (non-integral) scalars
 template<typename T>
-void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+struct CounterFillable
+{
+    static const bool value =
+      IsStdScalar<T>::value && !IsIntegral<Base<T>>::value;
+};
+
+// Counter-based path: every rank draws its local entries directly from
+// their global indices, so the generated matrix is bit-identical for every
+// grid shape and process count and no rank waits on another's stream
+template<typename T,typename=EnableIf<CounterFillable<T>>>
+void FillDist( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{
+    const uint64_t stream = NextPhiloxStream();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    T* ABuf = A.Matrix().Buffer();
+    const Int ALDim = A.Matrix().LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            ABuf[iLoc+jLoc*ALDim] =
+              CounterSampleBall( stream, A.GlobalRow(iLoc), j, center, radius );
+    }
+}
+
+// The remaining types (extended-precision and integral) keep the
+// redundant-rank stream
+template<typename T,typename=DisableIf<CounterFillable<T>>,typename=void>
+void FillDist( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
-    EL_DEBUG_CSE
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
 }
 
+template<typename T,typename=EnableIf<CounterFillable<T>>>
+void FillDist( DistMultiVec<T>& X, T center, Base<T> radius )
+{
+    const uint64_t stream = NextPhiloxStream();
+    const Int firstLocalRow = X.FirstLocalRow();
+    const Int localHeight = X.LocalHeight();
+    const Int width = X.Width();
+    T* XBuf = X.Matrix().Buffer();
+    const Int XLDim = X.Matrix().LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            XBuf[iLoc+j*XLDim] =
+              CounterSampleBall( stream, firstLocalRow+iLoc, j, center, radius );
+}
+
+template<typename T,typename=DisableIf<CounterFillable<T>>,typename=void>
+void FillDist( DistMultiVec<T>& X, T center, Base<T> radius )
+{
+    const int localHeight = X.LocalHeight();
+    const int width = X.Width();
+    for( int j=0; j<width; ++j )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            X.SetLocal( iLocal, j, SampleBall(center,radius) );
+}
+
+} // namespace uniform
+
+template<typename T>
+void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{
+    EL_DEBUG_CSE
+    uniform::FillDist( A, center, radius );
+}
+
 template<typename T>
 void Uniform( AbstractDistMatrix<T>& A, Int m, Int n, T center, Base<T> radius )
 {
@@ -51,11 +119,7 @@ template<typename T>
 void MakeUniform( DistMultiVec<T>& X, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
-    const int localHeight = X.LocalHeight();
-    const int width = X.Width();
-    for( int j=0; j<width; ++j )
-        for( int iLocal=0; iLocal<localHeight; ++iLocal )
-            X.SetLocal( iLocal, j, SampleBall(center,radius) );
+    uniform::FillDist( X, center, radius );
 }
 
 template<typename T>
@@ -107,10 +107,12 @@ Int ADMM
         xHat *= ctrl.alpha;
         Axpy( 1-ctrl.alpha, zOld, xHat );
 
-        // z := SoftThresh(xHat+u,1/rho)
+        // z := SoftThresh(xHat+u,1/rho), fusing the computation of
+        // || z ||_F (needed below for the convergence test) into the same
+        // pass over the data
         z = xHat;
         z += u;
-        SoftThreshold( z, 1/ctrl.rho );
+        const Real zNorm = SoftThresholdNorm( z, 1/ctrl.rho );
 
         // u := u + (xHat - z)
         u += xHat;
@@ -127,7 +129,7 @@ Int ADMM
         const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+            ctrl.relTol*Max(FrobeniusNorm(x),zNorm);
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
 
@@ -214,6 +216,20 @@ Int ADMM
 
     // Start the basis pursuit
     Int numIter=0;
+    // When requested (and when the MPI implementation provides non-blocking
+    // collectives), the convergence test is pipelined: the local
+    // contributions to its norms are combined with a single non-blocking
+    // allreduce which is only completed after the next solve, so that the
+    // reduction latencies are hidden behind computation at the price of
+    // testing residuals which are one iteration stale.
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const bool pipeline = ctrl.pipelineConvergence;
+#else
+    const bool pipeline = false;
+#endif
+    mpi::Request<Real> normRequest;
+    bool normsPending = false;
+    Real localNormSquares[5], globalNormSquares[5];
     DistMatrix<Field> x(grid), u(grid), t(grid), zOld(grid), xHat(grid);
     Zeros( x, n, 1 );
     Zeros( z, n, 1 );
@@ -251,15 +267,73 @@ Int ADMM
         xHat *= ctrl.alpha;
         Axpy( 1-ctrl.alpha, zOld, xHat );
 
-        // z := SoftThresh(xHat+u,1/rho)
+        // z := SoftThresh(xHat+u,1/rho), fusing the computation of
+        // || z ||_F (needed below for the convergence test) into the same
+        // pass over the data
         z = xHat;
         z += u;
-        SoftThreshold( z, 1/ctrl.rho );
+        Real zNorm = 0;
+        if( pipeline )
+        {
+            // Only the local part of || z ||_F is needed here, as its
+            // combination is folded into the non-blocking reduction below
+            const Real zNormLoc = SoftThresholdNorm( z.Matrix(), 1/ctrl.rho );
+            localNormSquares[3] = zNormLoc*zNormLoc;
+        }
+        else
+            zNorm = SoftThresholdNorm( z, 1/ctrl.rho );
 
         // u := u + (xHat - z)
         u += xHat;
         u -= z;
 
+        if( pipeline )
+        {
+            // Finish combining the previous iteration's norms and apply its
+            // (one iteration stale) convergence test
+            bool converged = false;
+            if( normsPending )
+            {
+                mpi::Wait( normRequest );
+                normsPending = false;
+                const Real rNorm = Sqrt(globalNormSquares[0]);
+                const Real sNorm = Abs(ctrl.rho)*Sqrt(globalNormSquares[1]);
+                const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
+                    ctrl.relTol*
+                    Max(Sqrt(globalNormSquares[2]),Sqrt(globalNormSquares[3]));
+                const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
+                    ctrl.relTol*Abs(ctrl.rho)*Sqrt(globalNormSquares[4]);
+                if( ctrl.progress && grid.Rank() == 0 )
+                    Output
+                    (numIter-1,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
+                     ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual);
+                converged = ( rNorm < epsPri && sNorm < epsDual );
+            }
+            if( converged )
+                break;
+
+            // Queue the reduction of this iteration's local contributions
+            s = x;
+            s -= z;
+            Real normLoc = FrobeniusNorm( s.LockedMatrix() );
+            localNormSquares[0] = normLoc*normLoc;
+            s = z;
+            s -= zOld;
+            normLoc = FrobeniusNorm( s.LockedMatrix() );
+            localNormSquares[1] = normLoc*normLoc;
+            normLoc = FrobeniusNorm( x.LockedMatrix() );
+            localNormSquares[2] = normLoc*normLoc;
+            normLoc = FrobeniusNorm( u.LockedMatrix() );
+            localNormSquares[4] = normLoc*normLoc;
+            mpi::IAllReduce
+            ( localNormSquares, globalNormSquares, 5, grid.VCComm(),
+              normRequest );
+            normsPending = true;
+
+            ++numIter;
+            continue;
+        }
+
         // rNorm := || x - z ||_2
         s = x;
         s -= z;
@@ -271,7 +345,7 @@ Int ADMM
         const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+            ctrl.relTol*Max(FrobeniusNorm(x),zNorm);
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
 
@@ -289,6 +363,8 @@ Int ADMM
             break;
         ++numIter;
     }
+    if( normsPending )
+        mpi::Wait( normRequest );
     if( ctrl.maxIter == numIter )
         RuntimeError("Basis pursuit failed to converge");
     return numIter;
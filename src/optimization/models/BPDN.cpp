@@ -70,6 +70,30 @@ void BPDN
     bpdn::IPM( A, b, lambda, x, ctrl.ipmCtrl );
 }
 
+template<typename Real>
+void BPDNPath
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const vector<Real>& lambdas,
+        Matrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    bpdn::ADMMPath( A, b, lambdas, X, ctrl );
+}
+
+template<typename Real>
+void BPDNPath
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+  const vector<Real>& lambdas,
+        AbstractDistMatrix<Real>& X,
+  const bpdn::ADMMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    bpdn::ADMMPath( A, b, lambdas, X, ctrl );
+}
+
 #define PROTO(Real) \
   template void BPDN \
   ( const Matrix<Real>& A, \
@@ -94,7 +118,19 @@ void BPDN
     const DistMultiVec<Real>& b, \
           Real lambda, \
           DistMultiVec<Real>& x, \
-    const BPDNCtrl<Real>& ctrl );
+    const BPDNCtrl<Real>& ctrl ); \
+  template void BPDNPath \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const vector<Real>& lambdas, \
+          Matrix<Real>& X, \
+    const bpdn::ADMMCtrl<Real>& ctrl ); \
+  template void BPDNPath \
+  ( const AbstractDistMatrix<Real>& A, \
+    const AbstractDistMatrix<Real>& b, \
+    const vector<Real>& lambdas, \
+          AbstractDistMatrix<Real>& X, \
+    const bpdn::ADMMCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
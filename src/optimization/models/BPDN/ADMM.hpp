@@ -113,10 +113,12 @@ Int ADMM
         xHat *= ctrl.alpha;
         Axpy( 1-ctrl.alpha, zOld, xHat );
 
-        // z := SoftThresh(xHat+u,lambda/rho)
+        // z := SoftThresh(xHat+u,lambda/rho), fusing the computation of
+        // || z ||_F (needed below for the convergence test) into the same
+        // pass over the data
         z = xHat;
         z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
+        const Real zNorm = SoftThresholdNorm( z, lambda/ctrl.rho );
 
         // u := u + (xHat - z)
         u += xHat;
@@ -133,7 +135,7 @@ Int ADMM
         const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+            ctrl.relTol*Max(FrobeniusNorm(x),zNorm);
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
 
@@ -204,6 +206,20 @@ Int ADMM
 
     // Start the LASSO
     Int numIter=0;
+    // When requested (and when the MPI implementation provides non-blocking
+    // collectives), the convergence test is pipelined: the local
+    // contributions to its norms are combined with a single non-blocking
+    // allreduce which is only completed after the next solve, so that the
+    // reduction latencies are hidden behind computation at the price of
+    // testing residuals which are one iteration stale.
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const bool pipeline = ctrl.pipelineConvergence;
+#else
+    const bool pipeline = false;
+#endif
+    mpi::Request<Real> normRequest;
+    bool normsPending = false;
+    Real localNormSquares[5], globalNormSquares[5];
     DistMatrix<Field> x(g), u(g), s(g), zOld(g), xHat(g);
     Zeros( x, n, 1 );
     Zeros( z, n, 1 );
@@ -251,15 +267,74 @@ Int ADMM
         xHat *= ctrl.alpha;
         Axpy( 1-ctrl.alpha, zOld, xHat );
 
-        // z := SoftThresh(xHat+u,lambda/rho)
+        // z := SoftThresh(xHat+u,lambda/rho), fusing the computation of
+        // || z ||_F (needed below for the convergence test) into the same
+        // pass over the data
         z = xHat;
         z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
+        Real zNorm = 0;
+        if( pipeline )
+        {
+            // Only the local part of || z ||_F is needed here, as its
+            // combination is folded into the non-blocking reduction below
+            const Real zNormLoc =
+              SoftThresholdNorm( z.Matrix(), lambda/ctrl.rho );
+            localNormSquares[3] = zNormLoc*zNormLoc;
+        }
+        else
+            zNorm = SoftThresholdNorm( z, lambda/ctrl.rho );
 
         // u := u + (xHat - z)
         u += xHat;
         u -= z;
 
+        if( pipeline )
+        {
+            // Finish combining the previous iteration's norms and apply its
+            // (one iteration stale) convergence test
+            bool converged = false;
+            if( normsPending )
+            {
+                mpi::Wait( normRequest );
+                normsPending = false;
+                const Real rNorm = Sqrt(globalNormSquares[0]);
+                const Real sNorm = Abs(ctrl.rho)*Sqrt(globalNormSquares[1]);
+                const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
+                    ctrl.relTol*
+                    Max(Sqrt(globalNormSquares[2]),Sqrt(globalNormSquares[3]));
+                const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
+                    ctrl.relTol*Abs(ctrl.rho)*Sqrt(globalNormSquares[4]);
+                if( ctrl.progress && g.Rank() == 0 )
+                    Output
+                    (numIter-1,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
+                     ", |rho| ||z-zOld||_2=",sNorm,", and epsDual=",epsDual);
+                converged = ( rNorm < epsPri && sNorm < epsDual );
+            }
+            if( converged )
+                break;
+
+            // Queue the reduction of this iteration's local contributions
+            s = x;
+            s -= z;
+            Real normLoc = FrobeniusNorm( s.LockedMatrix() );
+            localNormSquares[0] = normLoc*normLoc;
+            s = z;
+            s -= zOld;
+            normLoc = FrobeniusNorm( s.LockedMatrix() );
+            localNormSquares[1] = normLoc*normLoc;
+            normLoc = FrobeniusNorm( x.LockedMatrix() );
+            localNormSquares[2] = normLoc*normLoc;
+            normLoc = FrobeniusNorm( u.LockedMatrix() );
+            localNormSquares[4] = normLoc*normLoc;
+            mpi::IAllReduce
+            ( localNormSquares, globalNormSquares, 5, g.VCComm(),
+              normRequest );
+            normsPending = true;
+
+            ++numIter;
+            continue;
+        }
+
         // rNorm := || x - z ||_2
         s = x;
         s -= z;
@@ -271,7 +346,7 @@ Int ADMM
         const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
+            ctrl.relTol*Max(FrobeniusNorm(x),zNorm);
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
 
@@ -294,10 +369,314 @@ Int ADMM
             break;
         ++numIter;
     }
+    if( normsPending )
+        mpi::Wait( normRequest );
     if( ctrl.maxIter == numIter )
         RuntimeError("Lasso failed to converge");
     return numIter;
 }
 
+// Sweep out an entire regularization path. The matrix of the x-update,
+// A^H A + rho (or A A^H + rho when the Woodbury identity is preferable),
+// does not depend upon lambda, and so its factorization (or explicit
+// inverse) is computed once and shared by every solve; furthermore, each
+// solve is warm-started from the solution of the previous value of lambda,
+// which keeps the per-lambda iteration counts low when the path is traversed
+// from the largest value of lambda to the smallest. The solutions are
+// returned as the columns of Z, ordered as in 'lambdas', and the total
+// number of inner iterations is returned.
+template<typename Field>
+Int ADMMPath
+( const Matrix<Field>& A,
+  const Matrix<Field>& b,
+  const vector<Base<Field>>& lambdas,
+        Matrix<Field>& Z,
+  const ADMMCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numLambdas = lambdas.size();
+
+    Matrix<Field> P;
+    if( m >= n )
+    {
+        Identity( P, n, n );
+        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
+    }
+    else
+    {
+        Identity( P, m, m );
+        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
+    }
+    if( ctrl.inv )
+        HPDInverse( LOWER, P );
+    else
+        Cholesky( LOWER, P );
+
+    // Cache w := A^H b
+    Matrix<Field> w;
+    Gemv( ADJOINT, Field(1), A, b, w );
+
+    Zeros( Z, n, numLambdas );
+    Int totalIter=0;
+    Matrix<Field> x, z, u, s, zOld, xHat;
+    Zeros( x, n, 1 );
+    Zeros( z, n, 1 );
+    Zeros( u, n, 1 );
+    for( Int j=0; j<numLambdas; ++j )
+    {
+        const Real lambda = lambdas[j];
+        Int numIter=0;
+        while( numIter < ctrl.maxIter )
+        {
+            zOld = z;
+
+            // x := (A^H A + rho) \ (A^H b + rho*(z-u))
+            x = w;
+            Axpy(  ctrl.rho, z, x );
+            Axpy( -ctrl.rho, u, x );
+            if( m >= n )
+            {
+                if( ctrl.inv )
+                {
+                    s = x;
+                    Hemv( LOWER, Field(1), P, s, Field(0), x );
+                }
+                else
+                {
+                    Trsv( LOWER, NORMAL, NON_UNIT, P, x );
+                    Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
+                }
+            }
+            else
+            {
+                Gemv( NORMAL, Field(1), A, x, s );
+                if( ctrl.inv )
+                {
+                    auto t( s );
+                    Hemv( LOWER, Field(1), P, t, Field(0), s );
+                }
+                else
+                {
+                    Trsv( LOWER, NORMAL, NON_UNIT, P, s );
+                    Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
+                }
+                Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
+                x *= 1/ctrl.rho;
+            }
+
+            // xHat := alpha x + (1-alpha) zOld
+            xHat = x;
+            xHat *= ctrl.alpha;
+            Axpy( 1-ctrl.alpha, zOld, xHat );
+
+            // z := SoftThresh(xHat+u,lambda/rho)
+            z = xHat;
+            z += u;
+            const Real zNorm = SoftThresholdNorm( z, lambda/ctrl.rho );
+
+            // u := u + (xHat - z)
+            u += xHat;
+            u -= z;
+
+            // rNorm := || x - z ||_2
+            s = x;
+            s -= z;
+            const Real rNorm = FrobeniusNorm( s );
+
+            // sNorm := || rho*(z-zOld) ||_2
+            s = z;
+            s -= zOld;
+            const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+
+            const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
+                ctrl.relTol*Max(FrobeniusNorm(x),zNorm);
+            const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
+                ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+
+            if( ctrl.progress )
+            {
+                s = b;
+                Gemv( NORMAL, Field(-1), A, x, Field(1), s );
+                const Real resid = FrobeniusNorm( s );
+                const Real obj =
+                  Real(1)/Real(2)*resid*resid + lambda*OneNorm(z);
+                Output
+                ("lambda=",lambda,", ",numIter,": ||x-z||_2=",rNorm,
+                 ", epsPri=",epsPri,", |rho| ||z-zOld||_2=",sNorm,
+                 ", and epsDual=",epsDual,", objective=",obj);
+            }
+
+            if( rNorm < epsPri && sNorm < epsDual )
+                break;
+            ++numIter;
+        }
+        if( ctrl.maxIter == numIter )
+            RuntimeError("Lasso failed to converge for lambda=",lambda);
+        totalIter += numIter;
+
+        auto zj = Z( ALL, IR(j) );
+        zj = z;
+    }
+    return totalIter;
+}
+
+// As above, but distributed. The convergence tests of the path driver are
+// always applied with blocking reductions, as the warm starts already keep
+// the iteration counts low.
+template<typename Field>
+Int ADMMPath
+( const AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& bPre,
+  const vector<Base<Field>>& lambdas,
+        AbstractDistMatrix<Field>& ZPre,
+  const ADMMCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixReadProxy<Field,Field,MC,MR>
+      AProx( APre ),
+      bProx( bPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR>
+      ZProx( ZPre );
+    auto& A = AProx.GetLocked();
+    auto& b = bProx.GetLocked();
+    auto& Z = ZProx.Get();
+
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numLambdas = lambdas.size();
+    const Grid& g = A.Grid();
+
+    DistMatrix<Field> P(g);
+    if( m >= n )
+    {
+        Identity( P, n, n );
+        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
+    }
+    else
+    {
+        Identity( P, m, m );
+        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
+    }
+    if( ctrl.inv )
+        HPDInverse( LOWER, P );
+    else
+        Cholesky( LOWER, P );
+
+    // Cache w := A^H b
+    DistMatrix<Field> w(g);
+    Gemv( ADJOINT, Field(1), A, b, w );
+
+    Zeros( Z, n, numLambdas );
+    Int totalIter=0;
+    DistMatrix<Field> x(g), z(g), u(g), s(g), zOld(g), xHat(g);
+    Zeros( x, n, 1 );
+    Zeros( z, n, 1 );
+    Zeros( u, n, 1 );
+    for( Int j=0; j<numLambdas; ++j )
+    {
+        const Real lambda = lambdas[j];
+        Int numIter=0;
+        while( numIter < ctrl.maxIter )
+        {
+            zOld = z;
+
+            // x := (A^H A + rho) \ (A^H b + rho*(z-u))
+            x = w;
+            Axpy(  ctrl.rho, z, x );
+            Axpy( -ctrl.rho, u, x );
+            if( m >= n )
+            {
+                if( ctrl.inv )
+                {
+                    s = x;
+                    Hemv( LOWER, Field(1), P, s, Field(0), x );
+                }
+                else
+                {
+                    Trsv( LOWER, NORMAL, NON_UNIT, P, x );
+                    Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
+                }
+            }
+            else
+            {
+                Gemv( NORMAL, Field(1), A, x, s );
+                if( ctrl.inv )
+                {
+                    auto t( s );
+                    Hemv( LOWER, Field(1), P, t, Field(0), s );
+                }
+                else
+                {
+                    Trsv( LOWER, NORMAL, NON_UNIT, P, s );
+                    Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
+                }
+                Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
+                x *= 1/ctrl.rho;
+            }
+
+            // xHat := alpha x + (1-alpha) zOld
+            xHat = x;
+            xHat *= ctrl.alpha;
+            Axpy( 1-ctrl.alpha, zOld, xHat );
+
+            // z := SoftThresh(xHat+u,lambda/rho)
+            z = xHat;
+            z += u;
+            const Real zNorm = SoftThresholdNorm( z, lambda/ctrl.rho );
+
+            // u := u + (xHat - z)
+            u += xHat;
+            u -= z;
+
+            // rNorm := || x - z ||_2
+            s = x;
+            s -= z;
+            const Real rNorm = FrobeniusNorm( s );
+
+            // sNorm := || rho*(z-zOld) ||_2
+            s = z;
+            s -= zOld;
+            const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+
+            const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
+                ctrl.relTol*Max(FrobeniusNorm(x),zNorm);
+            const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
+                ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+
+            if( ctrl.progress )
+            {
+                s = b;
+                Gemv( NORMAL, Field(-1), A, x, Field(1), s );
+                const Real resid = FrobeniusNorm( s );
+                const Real obj =
+                  Real(1)/Real(2)*resid*resid + lambda*OneNorm(z);
+                if( g.Rank() == 0 )
+                {
+                    Output
+                    ("lambda=",lambda,", ",numIter,": ||x-z||_2=",rNorm,
+                     ", epsPri=",epsPri,", |rho| ||z-zOld||_2=",sNorm,
+                     ", and epsDual=",epsDual,", objective=",obj);
+                }
+            }
+
+            if( rNorm < epsPri && sNorm < epsDual )
+                break;
+            ++numIter;
+        }
+        if( ctrl.maxIter == numIter )
+            RuntimeError("Lasso failed to converge for lambda=",lambda);
+        totalIter += numIter;
+
+        auto zj = Z( ALL, IR(j) );
+        zj = z;
+    }
+    return totalIter;
+}
+
 } // namespace bpdn
 } // namespace El
@@ -31,7 +31,7 @@ void SoftThreshold( Matrix<Field>& A, const Base<Field>& tau, bool relative )
         tauMod *= MaxNorm(A);
     auto softThresh =
       [&]( const Field& alpha ) { return SoftThreshold(alpha,tauMod); };
-    EntrywiseMap( A, MakeFunction(softThresh) );
+    EntrywiseKernel( A, softThresh );
 }
 
 template<typename Field>
@@ -44,7 +44,62 @@ void SoftThreshold
         tauMod *= MaxNorm(A);
     auto softThresh =
       [&]( const Field& alpha ) { return SoftThreshold(alpha,tauMod); };
-    EntrywiseMap( A, MakeFunction(softThresh) );
+    EntrywiseKernel( A.Matrix(), softThresh );
+}
+
+template<typename Field>
+Base<Field> SoftThresholdNorm
+( Matrix<Field>& A, const Base<Field>& tau, bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real tauMod = tau;
+    if( relative )
+        tauMod *= MaxNorm(A);
+    auto softThresh =
+      [&]( const Field& alpha ) { return SoftThreshold(alpha,tauMod); };
+    Real scale = 0;
+    Real scaledSquare = 1;
+    EntrywiseKernelScaledSquare( A, softThresh, scale, scaledSquare );
+    return scale*Sqrt(scaledSquare);
+}
+
+template<typename Field>
+Base<Field> SoftThresholdNorm
+( AbstractDistMatrix<Field>& A, const Base<Field>& tau, bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Real tauMod = tau;
+    if( relative )
+        tauMod *= MaxNorm(A);
+    auto softThresh =
+      [&]( const Field& alpha ) { return SoftThreshold(alpha,tauMod); };
+    Real norm;
+    if( A.Participating() )
+    {
+        Real localScale = 0;
+        Real localScaledSquare = 1;
+        EntrywiseKernelScaledSquare
+        ( A.Matrix(), softThresh, localScale, localScaledSquare );
+
+        // Combine as in FrobeniusNorm: equilibrate the local scaled sums to
+        // the largest scale before summing them
+        const Real scale =
+          mpi::AllReduce( localScale, mpi::MAX, A.DistComm() );
+        if( scale != Real(0) )
+        {
+            const Real relScale = localScale/scale;
+            localScaledSquare *= relScale*relScale;
+            const Real scaledSquare =
+              mpi::AllReduce( localScaledSquare, A.DistComm() );
+            norm = scale*Sqrt(scaledSquare);
+        }
+        else
+            norm = 0;
+    }
+    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
+    return norm;
 }
 
 #define PROTO(Field) \
@@ -53,6 +108,10 @@ void SoftThreshold
   template void SoftThreshold \
   ( Matrix<Field>& A, const Base<Field>& tau, bool relative ); \
   template void SoftThreshold \
+  ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, bool relative ); \
+  template Base<Field> SoftThresholdNorm \
+  ( Matrix<Field>& A, const Base<Field>& tau, bool relative ); \
+  template Base<Field> SoftThresholdNorm \
   ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, bool relative );
 
 #define EL_NO_INT_PROTO
@@ -1235,6 +1235,180 @@ const MPSMeta& MPSReader::Meta() const
 
 namespace read_mps {
 
+// To avoid both re-parsing the (potentially very large) MPS file on every
+// rank and re-parsing it on every solve of the same model, the parse is
+// packed into a contiguous entry list which can be cheaply broadcast and
+// cached in a binary sidecar file ("<filename>.emc"). The cache records the
+// size of the MPS file and the parsing options so that it is invalidated
+// whenever either changes; loading or writing the cache is always
+// best-effort, with a full parse as the fallback.
+
+inline string MPSCacheFilename( const string& filename )
+{ return filename + ".emc"; }
+
+inline bool LoadMPSCache
+( const string& filename,
+  bool minimize,
+  bool keepNonnegativeWithZeroUpperBound,
+        MPSMeta& meta,
+        vector<AffineLPEntry<double>>& entries )
+{
+    EL_DEBUG_CSE
+    std::ifstream mpsFile( filename.c_str(), std::ios::binary|std::ios::ate );
+    if( !mpsFile.is_open() )
+        return false;
+    const std::streamoff mpsSize = mpsFile.tellg();
+    mpsFile.close();
+
+    std::ifstream cache
+    ( MPSCacheFilename(filename).c_str(), std::ios::binary );
+    if( !cache.is_open() )
+        return false;
+
+    char magic[8];
+    cache.read( magic, 8 );
+    if( !cache || string(magic,8) != string("ElMPSC01") )
+        return false;
+    std::int64_t header[6];
+    cache.read( reinterpret_cast<char*>(header), sizeof(header) );
+    if( !cache ||
+        header[0] != std::int64_t(mpsSize) ||
+        header[1] != std::int64_t(sizeof(Int)) ||
+        header[2] != std::int64_t(sizeof(AffineLPEntry<double>)) ||
+        header[3] != std::int64_t(minimize) ||
+        header[4] != std::int64_t(keepNonnegativeWithZeroUpperBound) )
+        return false;
+
+    std::int64_t metaScalars[5];
+    cache.read( reinterpret_cast<char*>(metaScalars), sizeof(metaScalars) );
+    if( !cache )
+        return false;
+    meta.m = Int(metaScalars[0]);
+    meta.n = Int(metaScalars[1]);
+    meta.k = Int(metaScalars[2]);
+    meta.numEqualityEntries = Int(metaScalars[3]);
+    meta.numInequalityEntries = Int(metaScalars[4]);
+
+    entries.resize( std::size_t(header[5]) );
+    cache.read
+    ( reinterpret_cast<char*>(entries.data()),
+      header[5]*std::int64_t(sizeof(AffineLPEntry<double>)) );
+    if( !cache )
+    {
+        entries.clear();
+        return false;
+    }
+    return true;
+}
+
+inline void SaveMPSCache
+( const string& filename,
+  bool minimize,
+  bool keepNonnegativeWithZeroUpperBound,
+  const MPSMeta& meta,
+  const vector<AffineLPEntry<double>>& entries )
+{
+    EL_DEBUG_CSE
+    std::ifstream mpsFile( filename.c_str(), std::ios::binary|std::ios::ate );
+    if( !mpsFile.is_open() )
+        return;
+    const std::streamoff mpsSize = mpsFile.tellg();
+    mpsFile.close();
+
+    std::ofstream cache
+    ( MPSCacheFilename(filename).c_str(),
+      std::ios::binary|std::ios::trunc );
+    if( !cache.is_open() )
+        return;
+
+    cache.write( "ElMPSC01", 8 );
+    const std::int64_t header[6] =
+      { std::int64_t(mpsSize),
+        std::int64_t(sizeof(Int)),
+        std::int64_t(sizeof(AffineLPEntry<double>)),
+        std::int64_t(minimize),
+        std::int64_t(keepNonnegativeWithZeroUpperBound),
+        std::int64_t(entries.size()) };
+    cache.write( reinterpret_cast<const char*>(header), sizeof(header) );
+    const std::int64_t metaScalars[5] =
+      { std::int64_t(meta.m),
+        std::int64_t(meta.n),
+        std::int64_t(meta.k),
+        std::int64_t(meta.numEqualityEntries),
+        std::int64_t(meta.numInequalityEntries) };
+    cache.write
+    ( reinterpret_cast<const char*>(metaScalars), sizeof(metaScalars) );
+    cache.write
+    ( reinterpret_cast<const char*>(entries.data()),
+      std::int64_t(entries.size())*std::int64_t(sizeof(AffineLPEntry<double>)) );
+}
+
+inline void GatherEntries
+( const string& filename,
+  bool compressed,
+  bool minimize,
+  bool keepNonnegativeWithZeroUpperBound,
+        MPSMeta& meta,
+        vector<AffineLPEntry<double>>& entries )
+{
+    EL_DEBUG_CSE
+    if( LoadMPSCache
+        ( filename, minimize, keepNonnegativeWithZeroUpperBound,
+          meta, entries ) )
+        return;
+    MPSReader reader
+      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
+    meta = reader.Meta();
+    entries.reserve
+    ( meta.numEqualityEntries + meta.numInequalityEntries +
+      meta.m + meta.k + meta.n );
+    while( reader.QueuedEntry() )
+        entries.push_back( reader.GetEntry() );
+    SaveMPSCache
+    ( filename, minimize, keepNonnegativeWithZeroUpperBound, meta, entries );
+}
+
+// Broadcast the scalar metadata and the packed entry list from the root so
+// that only a single rank needs to touch the MPS file (or its cache). The
+// entries are broadcast as raw bytes in bounded chunks to avoid overflowing
+// the 'int' count of the underlying MPI routine.
+inline void BroadcastEntries
+( MPSMeta& meta, vector<AffineLPEntry<double>>& entries, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    Int header[6];
+    if( commRank == 0 )
+    {
+        header[0] = meta.m;
+        header[1] = meta.n;
+        header[2] = meta.k;
+        header[3] = meta.numEqualityEntries;
+        header[4] = meta.numInequalityEntries;
+        header[5] = Int(entries.size());
+    }
+    mpi::Broadcast( header, 6, 0, comm );
+    if( commRank != 0 )
+    {
+        meta.m = header[0];
+        meta.n = header[1];
+        meta.k = header[2];
+        meta.numEqualityEntries = header[3];
+        meta.numInequalityEntries = header[4];
+        entries.resize( header[5] );
+    }
+    byte* buffer = reinterpret_cast<byte*>(entries.data());
+    std::size_t numBytes = entries.size()*sizeof(AffineLPEntry<double>);
+    const std::size_t chunkSize = std::size_t(1) << 30;
+    while( numBytes > 0 )
+    {
+        const std::size_t thisChunk = Min( numBytes, chunkSize );
+        mpi::Broadcast( buffer, int(thisChunk), 0, comm );
+        buffer += thisChunk;
+        numBytes -= thisChunk;
+    }
+}
+
 template<typename Real>
 void Helper
 ( AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem,
@@ -1248,9 +1422,11 @@ void Helper
     if( compressed )
         LogicError("Compressed MPS is not yet supported");
 
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
-    const MPSMeta& meta = reader.Meta();
+    MPSMeta meta;
+    vector<AffineLPEntry<double>> entries;
+    GatherEntries
+    ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound,
+      meta, entries );
     if( metadataSummary )
         meta.PrintSummary();
 
@@ -1259,9 +1435,8 @@ void Helper
     Zeros( problem.b, meta.m, 1 );
     Zeros( problem.G, meta.k, meta.n );
     Zeros( problem.h, meta.k, 1 );
-    while( reader.QueuedEntry() )
+    for( const AffineLPEntry<double>& entry : entries )
     {
-        const AffineLPEntry<double> entry = reader.GetEntry();
         if( entry.type == AFFINE_LP_COST_VECTOR )
         {
             if( problem.c(entry.row) != Real(0) )
@@ -1313,16 +1488,18 @@ void Helper
 {
     EL_DEBUG_CSE
 
-    // TODO(poulson): Consider loading on a single process and then distributing
-    // the results instead.
-
     if( compressed )
         LogicError("Compressed MPS is not yet supported");
 
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
-    const MPSMeta& meta = reader.Meta();
-    if( metadataSummary && problem.A.Grid().Rank() == 0 )
+    const Grid& grid = problem.A.Grid();
+    MPSMeta meta;
+    vector<AffineLPEntry<double>> entries;
+    if( grid.Rank() == 0 )
+        GatherEntries
+        ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound,
+          meta, entries );
+    BroadcastEntries( meta, entries, grid.Comm() );
+    if( metadataSummary && grid.Rank() == 0 )
         meta.PrintSummary();
 
     Zeros( problem.c, meta.n, 1 );
@@ -1331,9 +1508,8 @@ void Helper
     Zeros( problem.G, meta.k, meta.n );
     Zeros( problem.h, meta.k, 1 );
 
-    while( reader.QueuedEntry() )
+    for( const AffineLPEntry<double>& entry : entries )
     {
-        const AffineLPEntry<double> entry = reader.GetEntry();
         if( entry.type == AFFINE_LP_COST_VECTOR )
             problem.c.Set( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
@@ -1360,9 +1536,11 @@ void Helper
     if( compressed )
         LogicError("Compressed MPS is not yet supported");
 
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
-    const MPSMeta& meta = reader.Meta();
+    MPSMeta meta;
+    vector<AffineLPEntry<double>> entries;
+    GatherEntries
+    ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound,
+      meta, entries );
     if( metadataSummary )
         meta.PrintSummary();
 
@@ -1374,9 +1552,8 @@ void Helper
 
     problem.A.Reserve( meta.numEqualityEntries );
     problem.G.Reserve( meta.numInequalityEntries );
-    while( reader.QueuedEntry() )
+    for( const AffineLPEntry<double>& entry : entries )
     {
-        const AffineLPEntry<double> entry = reader.GetEntry();
         if( entry.type == AFFINE_LP_COST_VECTOR )
             problem.c.Set( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
@@ -1405,10 +1582,15 @@ void Helper
     if( compressed )
         LogicError("Compressed MPS is not yet supported");
 
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
-    const MPSMeta& meta = reader.Meta();
-    if( metadataSummary && problem.A.Grid().Rank() == 0 )
+    const Grid& grid = problem.A.Grid();
+    MPSMeta meta;
+    vector<AffineLPEntry<double>> entries;
+    if( grid.Rank() == 0 )
+        GatherEntries
+        ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound,
+          meta, entries );
+    BroadcastEntries( meta, entries, grid.Comm() );
+    if( metadataSummary && grid.Rank() == 0 )
         meta.PrintSummary();
 
     Zeros( problem.c, meta.n, 1 );
@@ -1420,9 +1602,8 @@ void Helper
     bool passive=true;
     problem.A.Reserve( meta.numEqualityEntries );
     problem.G.Reserve( meta.numInequalityEntries );
-    while( reader.QueuedEntry() )
+    for( const AffineLPEntry<double>& entry : entries )
     {
-        const AffineLPEntry<double> entry = reader.GetEntry();
         if( entry.type == AFFINE_LP_COST_VECTOR )
             problem.c.Set( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
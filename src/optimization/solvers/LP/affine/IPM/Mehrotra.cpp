@@ -480,8 +480,15 @@ void EquilibratedMehrotra
         return true;
       };
 
-    AffineLPSolution<Matrix<Real>> affineCorrection, correction;
+    AffineLPSolution<Matrix<Real>> affineCorrection, correction, candidate;
     AffineLPResidual<Matrix<Real>> residual, error;
+    Matrix<Real> rmuCor, zeroN, zeroM, zeroK;
+    if( ctrl.maxGondzioCorrections > 0 )
+    {
+        Zeros( zeroN, n, 1 );
+        Zeros( zeroM, m, 1 );
+        Zeros( zeroK, k, 1 );
+    }
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -692,14 +699,85 @@ void EquilibratedMehrotra
           correction.x, correction.y, correction.z, correction.s );
         // TODO(poulson): Residual checks
 
-        // Update the current estimates
-        // ============================
+        // Compute the length of the combined step
+        // =======================================
         Real alphaPri =
           pos_orth::MaxStep( solution.s, correction.s, 1/ctrl.maxStepRatio );
         Real alphaDual =
           pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+
+        // Attempt Gondzio-style centrality corrections, each of which
+        // reuses the existing factorization and so only costs one solve
+        // =============================================================
+        for( Int corrector=0; corrector<ctrl.maxGondzioCorrections;
+             ++corrector )
+        {
+            const Real betaMin = Real(1)/Real(10);
+            const Real betaMax = Real(10);
+            const Real deltaAlpha = Real(3)/Real(10);
+            const Real gammaAlpha = Real(1)/Real(10);
+            const Real muTarget = sigma*mu;
+
+            // Measure how far the complementarity of an enlarged trial
+            // step falls outside [betaMin*muTarget,betaMax*muTarget]
+            // ---------------------------------------------------------
+            candidate.s = solution.s;
+            candidate.z = solution.z;
+            Axpy( Min(alphaPri+deltaAlpha,Real(1)), correction.s,
+              candidate.s );
+            Axpy( Min(alphaDual+deltaAlpha,Real(1)), correction.z,
+              candidate.z );
+            rmuCor = candidate.z;
+            DiagonalScale( LEFT, NORMAL, candidate.s, rmuCor );
+            EntrywiseMap
+            ( rmuCor,
+              function<Real(const Real&)>
+              ( [=]( const Real& nu )
+                { return
+                    nu - Min(Max(nu,betaMin*muTarget),betaMax*muTarget);
+                } ) );
+
+            // Solve for the corrector direction
+            // ---------------------------------
+            KKTRHS( zeroN, zeroM, zeroK, rmuCor, solution.z, d );
+            if( !attemptToSolve(d) )
+                break;
+            ExpandSolution
+            ( m, n, d, rmuCor, solution.s, solution.z,
+              candidate.x, candidate.y, candidate.z, candidate.s );
+
+            // Only accept the correction if it sufficiently lengthens the
+            // attainable step
+            // -----------------------------------------------------------
+            Axpy( Real(1), correction.x, candidate.x );
+            Axpy( Real(1), correction.y, candidate.y );
+            Axpy( Real(1), correction.z, candidate.z );
+            Axpy( Real(1), correction.s, candidate.s );
+            Real alphaCorPri =
+              pos_orth::MaxStep
+              ( solution.s, candidate.s, 1/ctrl.maxStepRatio );
+            Real alphaCorDual =
+              pos_orth::MaxStep
+              ( solution.z, candidate.z, 1/ctrl.maxStepRatio );
+            alphaCorPri = Min(ctrl.maxStepRatio*alphaCorPri,Real(1));
+            alphaCorDual = Min(ctrl.maxStepRatio*alphaCorDual,Real(1));
+            if( Min(alphaCorPri,alphaCorDual) <
+                Min(alphaPri,alphaDual) + gammaAlpha*deltaAlpha )
+                break;
+            correction.x = candidate.x;
+            correction.y = candidate.y;
+            correction.z = candidate.z;
+            correction.s = candidate.s;
+            alphaPri = alphaCorPri;
+            alphaDual = alphaCorDual;
+            if( ctrl.print )
+                Output("Accepted centrality correction ",corrector);
+        }
+
+        // Update the current estimates
+        // ============================
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
         if( ctrl.print )
@@ -727,6 +805,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     if( ctrl.outerEquil )
     {
         AffineLPProblem<Matrix<Real>,Matrix<Real>> equilibratedProblem;
@@ -789,9 +868,36 @@ void EquilibratedMehrotra
         }
     }
 
+    // Checkpointing of the (equilibrated) iterate: the four solution
+    // vectors are packed into a single column, (x;y;z;s), so that each
+    // snapshot is a single asynchronously drained file
+    const bool checkpointing = ( ctrl.checkpointBasename != "" );
+    CheckpointWriter<Real> checkpointWriter;
+    DistMatrix<Real> packedIterate(grid);
+    bool primalInit = ctrl.primalInit;
+    bool dualInit = ctrl.dualInit;
+    if( checkpointing && ctrl.resume )
+    {
+        RestoreCheckpoint( packedIterate, ctrl.checkpointBasename );
+        if( packedIterate.Height() != n+m+2*k || packedIterate.Width() != 1 )
+            RuntimeError
+            ("Checkpoint dimensions did not match the (equilibrated) "
+             "problem");
+        auto xRes = packedIterate( IR(0,n),         ALL );
+        auto yRes = packedIterate( IR(n,n+m),       ALL );
+        auto zRes = packedIterate( IR(n+m,n+m+k),   ALL );
+        auto sRes = packedIterate( IR(n+m+k,END),   ALL );
+        Copy( xRes, solution.x );
+        Copy( yRes, solution.y );
+        Copy( zRes, solution.z );
+        Copy( sRes, solution.s );
+        // Enter the warm-start path with the restored iterate
+        primalInit = dualInit = true;
+    }
+
     Initialize
     ( problem, solution,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+      primalInit, dualInit, ctrl.standardInitShift );
 
     Real relError = 1;
     DistMatrix<Real> J(grid), d(grid);
@@ -823,11 +929,19 @@ void EquilibratedMehrotra
       };
 
     AffineLPResidual<DistMatrix<Real>> residual, error;
-    AffineLPSolution<DistMatrix<Real>> affineCorrection, correction;
+    AffineLPSolution<DistMatrix<Real>> affineCorrection, correction, candidate;
     ForceSimpleAlignments( residual, grid );
     ForceSimpleAlignments( error, grid );
     ForceSimpleAlignments( affineCorrection, grid );
     ForceSimpleAlignments( correction, grid );
+    ForceSimpleAlignments( candidate, grid );
+    DistMatrix<Real> rmuCor(grid), zeroN(grid), zeroM(grid), zeroK(grid);
+    if( ctrl.maxGondzioCorrections > 0 )
+    {
+        Zeros( zeroN, n, 1 );
+        Zeros( zeroM, m, 1 );
+        Zeros( zeroK, k, 1 );
+    }
 
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
@@ -1037,14 +1151,85 @@ void EquilibratedMehrotra
           correction.x, correction.y, correction.z, correction.s );
         // TODO(poulson): Residual checks
 
-        // Update the current estimates
-        // ============================
+        // Compute the length of the combined step
+        // =======================================
         Real alphaPri =
           pos_orth::MaxStep( solution.s, correction.s, 1/ctrl.maxStepRatio );
         Real alphaDual =
           pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+
+        // Attempt Gondzio-style centrality corrections, each of which
+        // reuses the existing factorization and so only costs one solve
+        // =============================================================
+        for( Int corrector=0; corrector<ctrl.maxGondzioCorrections;
+             ++corrector )
+        {
+            const Real betaMin = Real(1)/Real(10);
+            const Real betaMax = Real(10);
+            const Real deltaAlpha = Real(3)/Real(10);
+            const Real gammaAlpha = Real(1)/Real(10);
+            const Real muTarget = sigma*mu;
+
+            // Measure how far the complementarity of an enlarged trial
+            // step falls outside [betaMin*muTarget,betaMax*muTarget]
+            // ---------------------------------------------------------
+            candidate.s = solution.s;
+            candidate.z = solution.z;
+            Axpy( Min(alphaPri+deltaAlpha,Real(1)), correction.s,
+              candidate.s );
+            Axpy( Min(alphaDual+deltaAlpha,Real(1)), correction.z,
+              candidate.z );
+            rmuCor = candidate.z;
+            DiagonalScale( LEFT, NORMAL, candidate.s, rmuCor );
+            EntrywiseMap
+            ( rmuCor,
+              function<Real(const Real&)>
+              ( [=]( const Real& nu )
+                { return
+                    nu - Min(Max(nu,betaMin*muTarget),betaMax*muTarget);
+                } ) );
+
+            // Solve for the corrector direction
+            // ---------------------------------
+            KKTRHS( zeroN, zeroM, zeroK, rmuCor, solution.z, d );
+            if( !attemptToSolve(d) )
+                break;
+            ExpandSolution
+            ( m, n, d, rmuCor, solution.s, solution.z,
+              candidate.x, candidate.y, candidate.z, candidate.s );
+
+            // Only accept the correction if it sufficiently lengthens the
+            // attainable step
+            // -----------------------------------------------------------
+            Axpy( Real(1), correction.x, candidate.x );
+            Axpy( Real(1), correction.y, candidate.y );
+            Axpy( Real(1), correction.z, candidate.z );
+            Axpy( Real(1), correction.s, candidate.s );
+            Real alphaCorPri =
+              pos_orth::MaxStep
+              ( solution.s, candidate.s, 1/ctrl.maxStepRatio );
+            Real alphaCorDual =
+              pos_orth::MaxStep
+              ( solution.z, candidate.z, 1/ctrl.maxStepRatio );
+            alphaCorPri = Min(ctrl.maxStepRatio*alphaCorPri,Real(1));
+            alphaCorDual = Min(ctrl.maxStepRatio*alphaCorDual,Real(1));
+            if( Min(alphaCorPri,alphaCorDual) <
+                Min(alphaPri,alphaDual) + gammaAlpha*deltaAlpha )
+                break;
+            correction.x = candidate.x;
+            correction.y = candidate.y;
+            correction.z = candidate.z;
+            correction.s = candidate.s;
+            alphaPri = alphaCorPri;
+            alphaDual = alphaCorDual;
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted centrality correction ",corrector);
+        }
+
+        // Update the current estimates
+        // ============================
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
         if( ctrl.print && commRank == 0 )
@@ -1061,6 +1246,22 @@ void EquilibratedMehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
+        // Snapshot the updated iterate
+        // ============================
+        if( checkpointing && ctrl.checkpointFreq > 0 &&
+            (numIts+1) % ctrl.checkpointFreq == 0 )
+        {
+            Zeros( packedIterate, n+m+2*k, 1 );
+            auto xPack = packedIterate( IR(0,n),         ALL );
+            auto yPack = packedIterate( IR(n,n+m),       ALL );
+            auto zPack = packedIterate( IR(n+m,n+m+k),   ALL );
+            auto sPack = packedIterate( IR(n+m+k,END),   ALL );
+            Copy( solution.x, xPack );
+            Copy( solution.y, yPack );
+            Copy( solution.z, zPack );
+            Copy( solution.s, sPack );
+            checkpointWriter.Put( packedIterate, ctrl.checkpointBasename );
+        }
     }
     SetIndent( indent );
 }
@@ -1072,6 +1273,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Grid& grid = problem.A.Grid();
     if( ctrl.outerEquil )
     {
@@ -1187,6 +1389,120 @@ void EquilibratedMehrotra
     Matrix<Real> dInner;
     SparseMatrix<Real> J, JOrig;
     Matrix<Real> d, w;
+    // The values of the dynamic cone diagonal, s o inv(z), at the last
+    // numeric factorization (only maintained if factorization recycling
+    // was requested)
+    Matrix<Real> coneDiagFact;
+    bool haveConeDiagFact = false;
+    // Optionally perform the numeric factorizations in the next-lowest
+    // precision; the refinement loop of the regularized solves then recovers
+    // the working-precision accuracy
+#ifdef EL_DISABLE_FLOAT
+    // Degrade to the working precision when the demotion would land on the
+    // (omitted) single-precision instantiations
+    typedef typename std::conditional<IsSame<Demote<Real>,float>::value,
+                                      Real,Demote<Real>>::type RealLo;
+#else
+    typedef Demote<Real> RealLo;
+#endif
+    bool useMixedFact = ctrl.mixedPrecision && !IsSame<Real,RealLo>::value;
+    SparseMatrix<RealLo> JLo;
+    SparseLDLFactorization<RealLo> sparseLDLFactLo;
+    Matrix<RealLo> dLo;
+    bool ldlFactLoSymbolic = false;
+    // The full-precision symbolic analysis already exists unless the
+    // initialization solves were skipped due to a warm start
+    bool ldlFactSymbolic = !(ctrl.primalInit && ctrl.dualInit);
+    auto factorFullPrecision = [&]()
+      {
+        if( !ldlFactSymbolic )
+        {
+            const bool hermitian = true;
+            const BisectCtrl bisectCtrl;
+            sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+            ldlFactSymbolic = true;
+        }
+        else
+            sparseLDLFact.ChangeNonzeroValues( J );
+        sparseLDLFact.Factor();
+      };
+    auto factorDemoted = [&]()
+      {
+        Copy( J, JLo );
+        if( !ldlFactLoSymbolic )
+        {
+            const bool hermitian = true;
+            const BisectCtrl bisectCtrl;
+            sparseLDLFactLo.Initialize( JLo, hermitian, bisectCtrl );
+            ldlFactLoSymbolic = true;
+        }
+        else
+            sparseLDLFactLo.ChangeNonzeroValues( JLo );
+        sparseLDLFactLo.Factor();
+      };
+    // An optional least-recently-used cache of past KKT factorizations,
+    // keyed on the dynamic cone diagonal at factorization time. Before each
+    // fresh factorization the cache is searched for an entry within the
+    // relative tolerance 'factRefreshTol', and a hit is reused as the
+    // preconditioner for the iterative refinement in the same manner as the
+    // most-recent-factorization recycling.
+    const bool factCacheEnabled =
+      ctrl.factCacheSize > 1 && ctrl.factRefreshTol > Real(0) &&
+      !(ctrl.mixedPrecision && !IsSame<Real,RealLo>::value);
+    const Int numCacheSlots = factCacheEnabled ? ctrl.factCacheSize : 0;
+    vector<unique_ptr<SparseLDLFactorization<Real>>>
+      cacheFacts( numCacheSlots );
+    vector<Matrix<Real>> cacheDInner( numCacheSlots ),
+      cacheConeDiag( numCacheSlots );
+    vector<Int> cacheLastUse( numCacheSlots, 0 );
+    Int cacheClock = 0;
+    Int activeSlot = -1;
+    auto activeFact = [&]() -> SparseLDLFactorization<Real>&
+      {
+        return activeSlot >= 0 ? *cacheFacts[activeSlot] : sparseLDLFact;
+      };
+    auto activeDInner = [&]() -> Matrix<Real>&
+      {
+        return activeSlot >= 0 ? cacheDInner[activeSlot] : dInner;
+      };
+    auto factorIntoCache = [&]()
+      {
+        // Fill the first empty slot, or evict the least recently used
+        Int slot = -1;
+        for( Int j=0; j<numCacheSlots; ++j )
+        {
+            if( !cacheFacts[j] )
+            {
+                slot = j;
+                break;
+            }
+        }
+        if( slot == -1 )
+        {
+            slot = 0;
+            for( Int j=1; j<numCacheSlots; ++j )
+                if( cacheLastUse[j] < cacheLastUse[slot] )
+                    slot = j;
+        }
+        if( !cacheFacts[slot] )
+        {
+            // Every KKT system shares the same sparsity pattern, so each
+            // slot only pays for its symbolic analysis once
+            cacheFacts[slot].reset( new SparseLDLFactorization<Real> );
+            const bool hermitian = true;
+            const BisectCtrl bisectCtrl;
+            cacheFacts[slot]->Initialize( J, hermitian, bisectCtrl );
+        }
+        else
+            cacheFacts[slot]->ChangeNonzeroValues( J );
+        cacheFacts[slot]->Factor();
+        cacheDInner[slot] = dInner;
+        cacheConeDiag[slot].Resize( k, 1 );
+        for( Int i=0; i<k; ++i )
+            cacheConeDiag[slot](i) = solution.s(i)/solution.z(i);
+        cacheLastUse[slot] = ++cacheClock;
+        activeSlot = slot;
+      };
     auto attemptToFactor = [&]( const Real& wMaxNorm )
       {
         try
@@ -1198,17 +1514,34 @@ void EquilibratedMehrotra
             else
                 Ones( dInner, J.Height(), 1 );
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
+            if( useMixedFact )
             {
-                const bool hermitian = true;
-                const BisectCtrl bisectCtrl;
-                sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                try { factorDemoted(); }
+                catch(...)
+                {
+                    // The demoted factorization failed outright, e.g., due
+                    // to the regularization underflowing
+                    if( ctrl.print )
+                        Output
+                        ("Falling back to a full-precision KKT "
+                         "factorization");
+                    useMixedFact = false;
+                }
             }
-            else
+            if( !useMixedFact )
+            {
+                if( factCacheEnabled )
+                    factorIntoCache();
+                else
+                    factorFullPrecision();
+            }
+            if( ctrl.factRefreshTol > Real(0) )
             {
-                sparseLDLFact.ChangeNonzeroValues( J );
+                coneDiagFact.Resize( k, 1 );
+                for( Int i=0; i<k; ++i )
+                    coneDiagFact(i) = solution.s(i)/solution.z(i);
+                haveConeDiagFact = true;
             }
-            sparseLDLFact.Factor();
         }
         catch(...)
         {
@@ -1219,32 +1552,111 @@ void EquilibratedMehrotra
         }
         return true;
       };
-    auto attemptToSolve = [&]( Matrix<Real>& rhs )
+    auto attemptMixedSolve = [&]( Matrix<Real>& rhs )
       {
+        auto applyA =
+          [&]( const Matrix<Real>& X, Matrix<Real>& Y )
+          {
+            Y = X;
+            DiagonalScale( LEFT, NORMAL, regTmp, Y );
+            Multiply( NORMAL, Real(1), JOrig, X, Real(1), Y );
+          };
+        auto applyAInv =
+          [&]( Matrix<Real>& Y )
+          {
+            DiagonalSolve( LEFT, NORMAL, dInner, Y );
+            Copy( Y, dLo );
+            sparseLDLFactLo.Solve( dLo );
+            Copy( dLo, Y );
+            DiagonalSolve( LEFT, NORMAL, dInner, Y );
+          };
+        auto rhsOrig( rhs );
+        const Real bNorm = MaxNorm( rhs );
         try
         {
+            RefinedSolve
+            ( applyA, applyAInv, rhs,
+              ctrl.solveCtrl.relTol,
+              ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+            // Only accept the solution if the refinement over the demoted
+            // factorization actually reached the requested tolerance
+            Matrix<Real> y;
+            applyA( rhs, y );
+            y -= rhsOrig;
+            if( MaxNorm(y) <= ctrl.solveCtrl.relTol*bNorm )
+                return true;
+        }
+        catch(...) { }
+        rhs = rhsOrig;
+        return false;
+      };
+    auto attemptToSolve = [&]( Matrix<Real>& rhs, bool canFail )
+      {
+        try
+        {
+            if( useMixedFact )
+            {
+                if( attemptMixedSolve( rhs ) )
+                    return true;
+                // The demoted refinement stalled or failed; permanently
+                // fall back to full-precision factorizations
+                if( ctrl.print )
+                    Output
+                    ("Mixed-precision refinement stalled; falling back to "
+                     "a full-precision KKT factorization");
+                useMixedFact = false;
+                factorFullPrecision();
+            }
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
+                ( JOrig, regTmp, activeDInner(), activeFact(), rhs,
+                  ctrl.solveCtrl );
             else
                 reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
+                ( JOrig, regTmp, activeDInner(), activeFact(), rhs,
                   ctrl.solveCtrl.relTol,
                   ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress );
         }
         catch(...)
         {
-            if( relError > ctrl.minTol )
+            if( !canFail && relError > ctrl.minTol )
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
             return false;
         }
         return true;
       };
+    auto attemptToSolveWithFallback =
+      [&]( Matrix<Real>& rhs, bool& staleFactorization, const Real& wMaxNorm )
+      {
+        if( !staleFactorization )
+            return attemptToSolve( rhs, false );
+        auto rhsSaved( rhs );
+        if( attemptToSolve( rhs, true ) )
+            return true;
+        // The refinement did not converge with the recycled factorization,
+        // so fall back to a fresh one
+        if( ctrl.print )
+            Output("Falling back to a fresh KKT factorization");
+        staleFactorization = false;
+        rhs = rhsSaved;
+        J = JOrig;
+        J.FreezeSparsity();
+        UpdateDiagonal( J, Real(1), regTmp );
+        return attemptToFactor(wMaxNorm) && attemptToSolve(rhs,false);
+      };
 
     AffineLPResidual<Matrix<Real>> residual, error;
-    AffineLPSolution<Matrix<Real>> affineCorrection, correction;
+    AffineLPSolution<Matrix<Real>> affineCorrection, correction, candidate;
+    Matrix<Real> rmuCor, zeroN, zeroM, zeroK;
+    if( ctrl.maxGondzioCorrections > 0 )
+    {
+        Zeros( zeroN, n, 1 );
+        Zeros( zeroM, m, 1 );
+        Zeros( zeroK, k, 1 );
+    }
 
     const Int indent = PushIndent();
     for( ; numIts<=ctrl.maxIts; ++numIts )
@@ -1361,15 +1773,69 @@ void EquilibratedMehrotra
           residual.primalConic,
           residual.dualConic,
           solution.z, d );
-        J = JOrig;
-        J.FreezeSparsity();
-        UpdateDiagonal( J, Real(1), regTmp );
+
+        // Decide whether the previous factorization can be recycled as the
+        // preconditioner for the iterative refinement
+        // ----------------------------------------------------------------
+        bool staleFactorization = false;
+        if( factCacheEnabled )
+        {
+            // Search the cache for a factorization whose cone diagonal is
+            // within the refresh tolerance of the current one
+            Int bestSlot = -1;
+            Real bestChange = 0;
+            for( Int j=0; j<numCacheSlots; ++j )
+            {
+                if( !cacheFacts[j] )
+                    continue;
+                Real coneDiagRelChange = 0;
+                for( Int i=0; i<k; ++i )
+                {
+                    const Real coneDiag = solution.s(i)/solution.z(i);
+                    coneDiagRelChange =
+                      Max( coneDiagRelChange,
+                           Abs(coneDiag-cacheConeDiag[j](i))/
+                           cacheConeDiag[j](i) );
+                }
+                if( bestSlot == -1 || coneDiagRelChange < bestChange )
+                {
+                    bestSlot = j;
+                    bestChange = coneDiagRelChange;
+                }
+            }
+            if( bestSlot != -1 && bestChange <= ctrl.factRefreshTol )
+            {
+                activeSlot = bestSlot;
+                cacheLastUse[bestSlot] = ++cacheClock;
+                staleFactorization = true;
+            }
+        }
+        else if( ctrl.factRefreshTol > Real(0) && haveConeDiagFact )
+        {
+            Real coneDiagRelChange = 0;
+            for( Int i=0; i<k; ++i )
+            {
+                const Real coneDiag = solution.s(i)/solution.z(i);
+                coneDiagRelChange =
+                  Max( coneDiagRelChange,
+                       Abs(coneDiag-coneDiagFact(i))/coneDiagFact(i) );
+            }
+            staleFactorization = coneDiagRelChange <= ctrl.factRefreshTol;
+        }
 
         // Solve for the direction
         // -----------------------
-        if( !attemptToFactor(wMaxNorm) )
-            break;
-        if( !attemptToSolve(d) )
+        if( !staleFactorization )
+        {
+            J = JOrig;
+            J.FreezeSparsity();
+            UpdateDiagonal( J, Real(1), regTmp );
+            if( !attemptToFactor(wMaxNorm) )
+                break;
+        }
+        else if( ctrl.print )
+            Output("Recycling the previous KKT factorization");
+        if( !attemptToSolveWithFallback(d,staleFactorization,wMaxNorm) )
             break;
         ExpandSolution
         ( m, n, d, residual.dualConic, solution.s, solution.z,
@@ -1465,20 +1931,91 @@ void EquilibratedMehrotra
           solution.z, d );
         // Solve for the proposed step
         // ---------------------------
-        if( !attemptToSolve(d) )
+        if( !attemptToSolveWithFallback(d,staleFactorization,wMaxNorm) )
             break;
         ExpandSolution
         ( m, n, d, residual.dualConic, solution.s, solution.z,
           correction.x, correction.y, correction.z, correction.s );
 
-        // Update the current estimates
-        // ============================
+        // Compute the length of the combined step
+        // =======================================
         Real alphaPri =
           pos_orth::MaxStep( solution.s, correction.s, 1/ctrl.maxStepRatio );
         Real alphaDual =
           pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+
+        // Attempt Gondzio-style centrality corrections, each of which
+        // reuses the existing factorization and so only costs one solve
+        // =============================================================
+        for( Int corrector=0; corrector<ctrl.maxGondzioCorrections;
+             ++corrector )
+        {
+            const Real betaMin = Real(1)/Real(10);
+            const Real betaMax = Real(10);
+            const Real deltaAlpha = Real(3)/Real(10);
+            const Real gammaAlpha = Real(1)/Real(10);
+            const Real muTarget = sigma*mu;
+
+            // Measure how far the complementarity of an enlarged trial
+            // step falls outside [betaMin*muTarget,betaMax*muTarget]
+            // ---------------------------------------------------------
+            candidate.s = solution.s;
+            candidate.z = solution.z;
+            Axpy( Min(alphaPri+deltaAlpha,Real(1)), correction.s,
+              candidate.s );
+            Axpy( Min(alphaDual+deltaAlpha,Real(1)), correction.z,
+              candidate.z );
+            rmuCor = candidate.z;
+            DiagonalScale( LEFT, NORMAL, candidate.s, rmuCor );
+            EntrywiseMap
+            ( rmuCor,
+              function<Real(const Real&)>
+              ( [=]( const Real& nu )
+                { return
+                    nu - Min(Max(nu,betaMin*muTarget),betaMax*muTarget);
+                } ) );
+
+            // Solve for the corrector direction
+            // ---------------------------------
+            KKTRHS( zeroN, zeroM, zeroK, rmuCor, solution.z, d );
+            if( !attemptToSolveWithFallback(d,staleFactorization,wMaxNorm) )
+                break;
+            ExpandSolution
+            ( m, n, d, rmuCor, solution.s, solution.z,
+              candidate.x, candidate.y, candidate.z, candidate.s );
+
+            // Only accept the correction if it sufficiently lengthens the
+            // attainable step
+            // -----------------------------------------------------------
+            Axpy( Real(1), correction.x, candidate.x );
+            Axpy( Real(1), correction.y, candidate.y );
+            Axpy( Real(1), correction.z, candidate.z );
+            Axpy( Real(1), correction.s, candidate.s );
+            Real alphaCorPri =
+              pos_orth::MaxStep
+              ( solution.s, candidate.s, 1/ctrl.maxStepRatio );
+            Real alphaCorDual =
+              pos_orth::MaxStep
+              ( solution.z, candidate.z, 1/ctrl.maxStepRatio );
+            alphaCorPri = Min(ctrl.maxStepRatio*alphaCorPri,Real(1));
+            alphaCorDual = Min(ctrl.maxStepRatio*alphaCorDual,Real(1));
+            if( Min(alphaCorPri,alphaCorDual) <
+                Min(alphaPri,alphaDual) + gammaAlpha*deltaAlpha )
+                break;
+            correction.x = candidate.x;
+            correction.y = candidate.y;
+            correction.z = candidate.z;
+            correction.s = candidate.s;
+            alphaPri = alphaCorPri;
+            alphaDual = alphaCorDual;
+            if( ctrl.print )
+                Output("Accepted centrality correction ",corrector);
+        }
+
+        // Update the current estimates
+        // ============================
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
         if( ctrl.print )
@@ -1506,6 +2043,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     if( ctrl.outerEquil )
     {
         AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> equilibratedProblem;
@@ -1590,13 +2128,40 @@ void EquilibratedMehrotra
             Output("Imbalance factor of J: ",imbalanceJ);
     }
 
+    // Checkpointing of the (equilibrated) iterate: the four solution
+    // vectors are packed into a single column, (x;y;z;s), so that each
+    // snapshot is a single asynchronously drained file
+    const bool checkpointing = ( ctrl.checkpointBasename != "" );
+    CheckpointWriter<Real> checkpointWriter;
+    DistMatrix<Real> packedIterate(grid);
+    bool primalInit = ctrl.primalInit;
+    bool dualInit = ctrl.dualInit;
+    if( checkpointing && ctrl.resume )
+    {
+        RestoreCheckpoint( packedIterate, ctrl.checkpointBasename );
+        if( packedIterate.Height() != n+m+2*k || packedIterate.Width() != 1 )
+            RuntimeError
+            ("Checkpoint dimensions did not match the (equilibrated) "
+             "problem");
+        auto xRes = packedIterate( IR(0,n),         ALL );
+        auto yRes = packedIterate( IR(n,n+m),       ALL );
+        auto zRes = packedIterate( IR(n+m,n+m+k),   ALL );
+        auto sRes = packedIterate( IR(n+m+k,END),   ALL );
+        Copy( xRes, solution.x );
+        Copy( yRes, solution.y );
+        Copy( zRes, solution.z );
+        Copy( sRes, solution.s );
+        // Enter the warm-start path with the restored iterate
+        primalInit = dualInit = true;
+    }
+
     if( commRank == 0 && ctrl.time )
         timer.Start();
     DistSparseLDLFactorization<Real> sparseLDLFact;
     Initialize
     ( problem, solution, JStatic, regTmp,
       sparseLDLFact,
-      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+      primalInit, dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1604,6 +2169,124 @@ void EquilibratedMehrotra
     Real relError = 1;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
     DistMultiVec<Real> d(grid), w(grid), dInner(grid);
+    // The local values of the dynamic cone diagonal, s o inv(z), at the last
+    // numeric factorization (only maintained if factorization recycling was
+    // requested)
+    Matrix<Real> coneDiagFact;
+    bool haveConeDiagFact = false;
+    // Optionally perform the numeric factorizations in the next-lowest
+    // precision; the refinement loop of the regularized solves then recovers
+    // the working-precision accuracy
+#ifdef EL_DISABLE_FLOAT
+    // Degrade to the working precision when the demotion would land on the
+    // (omitted) single-precision instantiations
+    typedef typename std::conditional<IsSame<Demote<Real>,float>::value,
+                                      Real,Demote<Real>>::type RealLo;
+#else
+    typedef Demote<Real> RealLo;
+#endif
+    bool useMixedFact = ctrl.mixedPrecision && !IsSame<Real,RealLo>::value;
+    DistSparseMatrix<RealLo> JLo(grid);
+    DistSparseLDLFactorization<RealLo> sparseLDLFactLo;
+    DistMultiVec<RealLo> dLo(grid);
+    bool ldlFactLoSymbolic = false;
+    // The full-precision symbolic analysis already exists unless the
+    // initialization solves were skipped due to a warm start
+    bool ldlFactSymbolic = !(ctrl.primalInit && ctrl.dualInit);
+    auto factorFullPrecision = [&]()
+      {
+        if( !ldlFactSymbolic )
+        {
+            const bool hermitian = true;
+            const BisectCtrl bisectCtrl;
+            sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+            ldlFactSymbolic = true;
+        }
+        else
+            sparseLDLFact.ChangeNonzeroValues( J );
+        sparseLDLFact.Factor( LDL_2D );
+      };
+    auto factorDemoted = [&]()
+      {
+        Copy( J, JLo );
+        if( !ldlFactLoSymbolic )
+        {
+            const bool hermitian = true;
+            const BisectCtrl bisectCtrl;
+            sparseLDLFactLo.Initialize( JLo, hermitian, bisectCtrl );
+            ldlFactLoSymbolic = true;
+        }
+        else
+            sparseLDLFactLo.ChangeNonzeroValues( JLo );
+        sparseLDLFactLo.Factor( LDL_2D );
+      };
+    // An optional least-recently-used cache of past KKT factorizations,
+    // keyed on the dynamic cone diagonal at factorization time. Before each
+    // fresh factorization the cache is searched for an entry within the
+    // relative tolerance 'factRefreshTol', and a hit is reused as the
+    // preconditioner for the iterative refinement in the same manner as the
+    // most-recent-factorization recycling.
+    const bool factCacheEnabled =
+      ctrl.factCacheSize > 1 && ctrl.factRefreshTol > Real(0) &&
+      !(ctrl.mixedPrecision && !IsSame<Real,RealLo>::value);
+    const Int numCacheSlots = factCacheEnabled ? ctrl.factCacheSize : 0;
+    vector<unique_ptr<DistSparseLDLFactorization<Real>>>
+      cacheFacts( numCacheSlots );
+    vector<DistMultiVec<Real>> cacheDInner
+      ( numCacheSlots, DistMultiVec<Real>(grid) );
+    // The cone diagonals are stored as their local values
+    vector<Matrix<Real>> cacheConeDiag( numCacheSlots );
+    vector<Int> cacheLastUse( numCacheSlots, 0 );
+    Int cacheClock = 0;
+    Int activeSlot = -1;
+    auto activeFact = [&]() -> DistSparseLDLFactorization<Real>&
+      {
+        return activeSlot >= 0 ? *cacheFacts[activeSlot] : sparseLDLFact;
+      };
+    auto activeDInner = [&]() -> DistMultiVec<Real>&
+      {
+        return activeSlot >= 0 ? cacheDInner[activeSlot] : dInner;
+      };
+    auto factorIntoCache = [&]()
+      {
+        // Fill the first empty slot, or evict the least recently used
+        Int slot = -1;
+        for( Int j=0; j<numCacheSlots; ++j )
+        {
+            if( !cacheFacts[j] )
+            {
+                slot = j;
+                break;
+            }
+        }
+        if( slot == -1 )
+        {
+            slot = 0;
+            for( Int j=1; j<numCacheSlots; ++j )
+                if( cacheLastUse[j] < cacheLastUse[slot] )
+                    slot = j;
+        }
+        if( !cacheFacts[slot] )
+        {
+            // Every KKT system shares the same sparsity pattern, so each
+            // slot only pays for its symbolic analysis once
+            cacheFacts[slot].reset( new DistSparseLDLFactorization<Real> );
+            const bool hermitian = true;
+            const BisectCtrl bisectCtrl;
+            cacheFacts[slot]->Initialize( J, hermitian, bisectCtrl );
+        }
+        else
+            cacheFacts[slot]->ChangeNonzeroValues( J );
+        cacheFacts[slot]->Factor( LDL_2D );
+        cacheDInner[slot] = dInner;
+        const Int kLoc = solution.s.LocalHeight();
+        cacheConeDiag[slot].Resize( kLoc, 1 );
+        for( Int iLoc=0; iLoc<kLoc; ++iLoc )
+            cacheConeDiag[slot](iLoc) =
+              solution.s.GetLocal(iLoc,0)/solution.z.GetLocal(iLoc,0);
+        cacheLastUse[slot] = ++cacheClock;
+        activeSlot = slot;
+      };
     auto attemptToFactor = [&]( const Real& wMaxNorm )
       {
         try
@@ -1619,22 +2302,40 @@ void EquilibratedMehrotra
             if( commRank == 0 && ctrl.time )
                 Output("Equilibration: ",timer.Stop()," secs");
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
+            if( commRank == 0 && ctrl.time )
+                timer.Start();
+            if( useMixedFact )
             {
-                const bool hermitian = true;
-                const BisectCtrl bisectCtrl;
-                sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                try { factorDemoted(); }
+                catch(...)
+                {
+                    // The demoted factorization failed outright, e.g., due
+                    // to the regularization underflowing
+                    if( ctrl.print && commRank == 0 )
+                        Output
+                        ("Falling back to a full-precision KKT "
+                         "factorization");
+                    useMixedFact = false;
+                }
             }
-            else
+            if( !useMixedFact )
             {
-                sparseLDLFact.ChangeNonzeroValues( J );
+                if( factCacheEnabled )
+                    factorIntoCache();
+                else
+                    factorFullPrecision();
             }
-
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
-            sparseLDLFact.Factor( LDL_2D );
             if( commRank == 0 && ctrl.time )
                 Output("LDL: ",timer.Stop()," secs");
+            if( ctrl.factRefreshTol > Real(0) )
+            {
+                const Int kLoc = solution.s.LocalHeight();
+                coneDiagFact.Resize( kLoc, 1 );
+                for( Int iLoc=0; iLoc<kLoc; ++iLoc )
+                    coneDiagFact(iLoc) =
+                      solution.s.GetLocal(iLoc,0)/solution.z.GetLocal(iLoc,0);
+                haveConeDiagFact = true;
+            }
         }
         catch(...)
         {
@@ -1645,18 +2346,75 @@ void EquilibratedMehrotra
         }
         return true;
       };
-    auto attemptToSolve = [&]( DistMultiVec<Real>& rhs )
+    auto attemptMixedSolve = [&]( DistMultiVec<Real>& rhs )
+      {
+        auto applyA =
+          [&]( const DistMultiVec<Real>& X, DistMultiVec<Real>& Y )
+          {
+            Y = X;
+            DiagonalScale( LEFT, NORMAL, regTmp, Y );
+            Multiply( NORMAL, Real(1), JOrig, X, Real(1), Y );
+          };
+        auto applyAInv =
+          [&]( DistMultiVec<Real>& Y )
+          {
+            DiagonalSolve( LEFT, NORMAL, dInner, Y );
+            Copy( Y, dLo );
+            sparseLDLFactLo.Solve( dLo );
+            Copy( dLo, Y );
+            DiagonalSolve( LEFT, NORMAL, dInner, Y );
+          };
+        auto rhsOrig( rhs );
+        const Real bNorm = MaxNorm( rhs );
+        try
+        {
+            RefinedSolve
+            ( applyA, applyAInv, rhs,
+              ctrl.solveCtrl.relTol,
+              ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+            // Only accept the solution if the refinement over the demoted
+            // factorization actually reached the requested tolerance
+            DistMultiVec<Real> y(grid);
+            applyA( rhs, y );
+            y -= rhsOrig;
+            if( MaxNorm(y) <= ctrl.solveCtrl.relTol*bNorm )
+                return true;
+        }
+        catch(...) { }
+        rhs = rhsOrig;
+        return false;
+      };
+    auto attemptToSolve = [&]( DistMultiVec<Real>& rhs, bool canFail )
       {
         try
         {
             if( commRank == 0 && ctrl.time )
                 timer.Start();
+            if( useMixedFact )
+            {
+                if( attemptMixedSolve( rhs ) )
+                {
+                    if( commRank == 0 && ctrl.time )
+                        Output("Affine: ",timer.Stop()," secs");
+                    return true;
+                }
+                // The demoted refinement stalled or failed; permanently
+                // fall back to full-precision factorizations
+                if( ctrl.print && commRank == 0 )
+                    Output
+                    ("Mixed-precision refinement stalled; falling back to "
+                     "a full-precision KKT factorization");
+                useMixedFact = false;
+                factorFullPrecision();
+            }
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
+                ( JOrig, regTmp, activeDInner(), activeFact(), rhs,
+                  ctrl.solveCtrl );
             else
                 reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
+                ( JOrig, regTmp, activeDInner(), activeFact(), rhs,
                   ctrl.solveCtrl.relTol,
                   ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress );
@@ -1665,21 +2423,50 @@ void EquilibratedMehrotra
         }
         catch(...)
         {
-            if( relError > ctrl.minTol )
+            if( !canFail && relError > ctrl.minTol )
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
             return false;
         }
         return true;
       };
+    auto attemptToSolveWithFallback =
+      [&]( DistMultiVec<Real>& rhs, bool& staleFactorization,
+           const Real& wMaxNorm )
+      {
+        if( !staleFactorization )
+            return attemptToSolve( rhs, false );
+        auto rhsSaved( rhs );
+        if( attemptToSolve( rhs, true ) )
+            return true;
+        // The refinement did not converge with the recycled factorization,
+        // so fall back to a fresh one
+        if( ctrl.print && commRank == 0 )
+            Output("Falling back to a fresh KKT factorization");
+        staleFactorization = false;
+        rhs = rhsSaved;
+        J = JOrig;
+        J.FreezeSparsity();
+        J.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
+        UpdateDiagonal( J, Real(1), regTmp );
+        return attemptToFactor(wMaxNorm) && attemptToSolve(rhs,false);
+      };
 
     AffineLPResidual<DistMultiVec<Real>> residual, error;
-    AffineLPSolution<DistMultiVec<Real>> affineCorrection, correction;
+    AffineLPSolution<DistMultiVec<Real>> affineCorrection, correction, candidate;
 
     ForceSimpleAlignments( residual, grid );
     ForceSimpleAlignments( error, grid );
     ForceSimpleAlignments( affineCorrection, grid );
     ForceSimpleAlignments( correction, grid );
+    ForceSimpleAlignments( candidate, grid );
+    DistMultiVec<Real> rmuCor(grid), zeroN(grid), zeroM(grid), zeroK(grid);
+    if( ctrl.maxGondzioCorrections > 0 )
+    {
+        Zeros( zeroN, n, 1 );
+        Zeros( zeroM, m, 1 );
+        Zeros( zeroK, k, 1 );
+    }
 
     const Int indent = PushIndent();
     for( ; numIts<=ctrl.maxIts; ++numIts )
@@ -1798,16 +2585,79 @@ void EquilibratedMehrotra
           residual.primalConic,
           residual.dualConic,
           solution.z, d );
-        J = JOrig;
-        J.FreezeSparsity();
-        J.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
-        UpdateDiagonal( J, Real(1), regTmp );
+
+        // Decide whether the previous factorization can be recycled as the
+        // preconditioner for the iterative refinement
+        // ----------------------------------------------------------------
+        bool staleFactorization = false;
+        if( factCacheEnabled )
+        {
+            // Search the cache for a factorization whose cone diagonal is
+            // within the refresh tolerance of the current one
+            vector<Real> slotChanges( numCacheSlots, 0 );
+            const Int kLoc = solution.s.LocalHeight();
+            for( Int j=0; j<numCacheSlots; ++j )
+            {
+                if( !cacheFacts[j] )
+                    continue;
+                for( Int iLoc=0; iLoc<kLoc; ++iLoc )
+                {
+                    const Real coneDiag =
+                      solution.s.GetLocal(iLoc,0)/solution.z.GetLocal(iLoc,0);
+                    slotChanges[j] =
+                      Max( slotChanges[j],
+                           Abs(coneDiag-cacheConeDiag[j](iLoc))/
+                           cacheConeDiag[j](iLoc) );
+                }
+            }
+            mpi::AllReduce
+            ( slotChanges.data(), numCacheSlots, mpi::MAX, grid.Comm() );
+            Int bestSlot = -1;
+            for( Int j=0; j<numCacheSlots; ++j )
+            {
+                if( !cacheFacts[j] )
+                    continue;
+                if( bestSlot == -1 || slotChanges[j] < slotChanges[bestSlot] )
+                    bestSlot = j;
+            }
+            if( bestSlot != -1 && slotChanges[bestSlot] <= ctrl.factRefreshTol )
+            {
+                activeSlot = bestSlot;
+                cacheLastUse[bestSlot] = ++cacheClock;
+                staleFactorization = true;
+            }
+        }
+        else if( ctrl.factRefreshTol > Real(0) && haveConeDiagFact )
+        {
+            Real coneDiagRelChange = 0;
+            const Int kLoc = solution.s.LocalHeight();
+            for( Int iLoc=0; iLoc<kLoc; ++iLoc )
+            {
+                const Real coneDiag =
+                  solution.s.GetLocal(iLoc,0)/solution.z.GetLocal(iLoc,0);
+                coneDiagRelChange =
+                  Max( coneDiagRelChange,
+                       Abs(coneDiag-coneDiagFact(iLoc))/coneDiagFact(iLoc) );
+            }
+            coneDiagRelChange =
+              mpi::AllReduce( coneDiagRelChange, mpi::MAX, grid.Comm() );
+            staleFactorization = coneDiagRelChange <= ctrl.factRefreshTol;
+        }
+        if( !staleFactorization )
+        {
+            J = JOrig;
+            J.FreezeSparsity();
+            J.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
+            UpdateDiagonal( J, Real(1), regTmp );
+        }
+        else if( ctrl.print && commRank == 0 )
+            Output("Recycling the previous KKT factorization");
 
         // Solve for the direction
         // -----------------------
-        if( !attemptToFactor(wMaxNorm) )
+        if( !staleFactorization && !attemptToFactor(wMaxNorm) )
             break;
-        if( !attemptToSolve(d) )
+        if( !attemptToSolveWithFallback(d,staleFactorization,wMaxNorm) )
             break;
         ExpandSolution
         ( m, n, d, residual.dualConic, solution.s, solution.z,
@@ -1904,20 +2754,91 @@ void EquilibratedMehrotra
           solution.z, d );
         // Solve for the direction
         // -----------------------
-        if( !attemptToSolve(d) )
+        if( !attemptToSolveWithFallback(d,staleFactorization,wMaxNorm) )
             break;
         ExpandSolution
         ( m, n, d, residual.dualConic, solution.s, solution.z,
           correction.x, correction.y, correction.z, correction.s );
 
-        // Update the current estimates
-        // ============================
+        // Compute the length of the combined step
+        // =======================================
         Real alphaPri =
           pos_orth::MaxStep( solution.s, correction.s, 1/ctrl.maxStepRatio );
         Real alphaDual =
           pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+
+        // Attempt Gondzio-style centrality corrections, each of which
+        // reuses the existing factorization and so only costs one solve
+        // =============================================================
+        for( Int corrector=0; corrector<ctrl.maxGondzioCorrections;
+             ++corrector )
+        {
+            const Real betaMin = Real(1)/Real(10);
+            const Real betaMax = Real(10);
+            const Real deltaAlpha = Real(3)/Real(10);
+            const Real gammaAlpha = Real(1)/Real(10);
+            const Real muTarget = sigma*mu;
+
+            // Measure how far the complementarity of an enlarged trial
+            // step falls outside [betaMin*muTarget,betaMax*muTarget]
+            // ---------------------------------------------------------
+            candidate.s = solution.s;
+            candidate.z = solution.z;
+            Axpy( Min(alphaPri+deltaAlpha,Real(1)), correction.s,
+              candidate.s );
+            Axpy( Min(alphaDual+deltaAlpha,Real(1)), correction.z,
+              candidate.z );
+            rmuCor = candidate.z;
+            DiagonalScale( LEFT, NORMAL, candidate.s, rmuCor );
+            EntrywiseMap
+            ( rmuCor,
+              function<Real(const Real&)>
+              ( [=]( const Real& nu )
+                { return
+                    nu - Min(Max(nu,betaMin*muTarget),betaMax*muTarget);
+                } ) );
+
+            // Solve for the corrector direction
+            // ---------------------------------
+            KKTRHS( zeroN, zeroM, zeroK, rmuCor, solution.z, d );
+            if( !attemptToSolveWithFallback(d,staleFactorization,wMaxNorm) )
+                break;
+            ExpandSolution
+            ( m, n, d, rmuCor, solution.s, solution.z,
+              candidate.x, candidate.y, candidate.z, candidate.s );
+
+            // Only accept the correction if it sufficiently lengthens the
+            // attainable step
+            // -----------------------------------------------------------
+            Axpy( Real(1), correction.x, candidate.x );
+            Axpy( Real(1), correction.y, candidate.y );
+            Axpy( Real(1), correction.z, candidate.z );
+            Axpy( Real(1), correction.s, candidate.s );
+            Real alphaCorPri =
+              pos_orth::MaxStep
+              ( solution.s, candidate.s, 1/ctrl.maxStepRatio );
+            Real alphaCorDual =
+              pos_orth::MaxStep
+              ( solution.z, candidate.z, 1/ctrl.maxStepRatio );
+            alphaCorPri = Min(ctrl.maxStepRatio*alphaCorPri,Real(1));
+            alphaCorDual = Min(ctrl.maxStepRatio*alphaCorDual,Real(1));
+            if( Min(alphaCorPri,alphaCorDual) <
+                Min(alphaPri,alphaDual) + gammaAlpha*deltaAlpha )
+                break;
+            correction.x = candidate.x;
+            correction.y = candidate.y;
+            correction.z = candidate.z;
+            correction.s = candidate.s;
+            alphaPri = alphaCorPri;
+            alphaDual = alphaCorDual;
+            if( ctrl.print && commRank == 0 )
+                Output("Accepted centrality correction ",corrector);
+        }
+
+        // Update the current estimates
+        // ============================
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
         if( ctrl.print && commRank == 0 )
@@ -1934,6 +2855,22 @@ void EquilibratedMehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
+        // Snapshot the updated iterate
+        // ============================
+        if( checkpointing && ctrl.checkpointFreq > 0 &&
+            (numIts+1) % ctrl.checkpointFreq == 0 )
+        {
+            Zeros( packedIterate, n+m+2*k, 1 );
+            auto xPack = packedIterate( IR(0,n),         ALL );
+            auto yPack = packedIterate( IR(n,n+m),       ALL );
+            auto zPack = packedIterate( IR(n+m,n+m+k),   ALL );
+            auto sPack = packedIterate( IR(n+m+k,END),   ALL );
+            Copy( solution.x, xPack );
+            Copy( solution.y, yPack );
+            Copy( solution.z, zPack );
+            Copy( solution.s, sPack );
+            checkpointWriter.Put( packedIterate, ctrl.checkpointBasename );
+        }
     }
     SetIndent( indent );
 }
@@ -1945,6 +2882,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     if( ctrl.outerEquil )
     {
         const Grid& grid = problem.A.Grid();
@@ -92,6 +92,15 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the cone,
+        // as iterates inherited from a nearly converged solve lie almost on
+        // its boundary. The entrywise clip is preferred over the standard
+        // shift here since the latter would move every entry of a nearly
+        // optimal iterate a unit distance from its converged value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        LowerClip( solution.s, sqrtEps*Max(Nrm2(solution.s),Real(1)) );
+        LowerClip( solution.z, sqrtEps*Max(Nrm2(solution.z),Real(1)) );
         return;
     }
 
@@ -219,6 +228,15 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the cone,
+        // as iterates inherited from a nearly converged solve lie almost on
+        // its boundary. The entrywise clip is preferred over the standard
+        // shift here since the latter would move every entry of a nearly
+        // optimal iterate a unit distance from its converged value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        LowerClip( solution.s, sqrtEps*Max(Nrm2(solution.s),Real(1)) );
+        LowerClip( solution.z, sqrtEps*Max(Nrm2(solution.z),Real(1)) );
         return;
     }
 
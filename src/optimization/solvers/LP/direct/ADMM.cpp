@@ -249,6 +249,20 @@ Int ADMM
     DistMatrix<Real> g(grid), xTmp(grid), y(grid), t(grid);
     Zeros( g, m+n, 1 );
     PartitionDown( g, xTmp, y, n );
+    // When requested (and when the MPI implementation provides non-blocking
+    // collectives), the convergence test is pipelined: the local
+    // contributions to its norms are combined with a single non-blocking
+    // allreduce which is only completed after the next solve, so that the
+    // reduction latencies are hidden behind computation at the price of
+    // testing residuals which are one iteration stale.
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const bool pipeline = ctrl.pipelineConvergence;
+#else
+    const bool pipeline = false;
+#endif
+    mpi::Request<Real> normRequest;
+    bool normsPending = false;
+    Real localNormSquares[5], globalNormSquares[5];
     DistMatrix<Real> x(grid), u(grid), zOld(grid), xHat(grid);
     Zeros( z, n, 1 );
     Zeros( u, n, 1 );
@@ -301,6 +315,57 @@ Int ADMM
         u += xHat;
         u -= z;
 
+        if( pipeline )
+        {
+            // Finish combining the previous iteration's norms and apply its
+            // (one iteration stale) convergence test
+            bool converged = false;
+            if( normsPending )
+            {
+                mpi::Wait( normRequest );
+                normsPending = false;
+                const Real rNorm = Sqrt(globalNormSquares[0]);
+                const Real sNorm = Abs(ctrl.rho)*Sqrt(globalNormSquares[1]);
+                const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
+                    ctrl.relTol*
+                    Max(Sqrt(globalNormSquares[2]),Sqrt(globalNormSquares[3]));
+                const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
+                    ctrl.relTol*Abs(ctrl.rho)*Sqrt(globalNormSquares[4]);
+                if( ctrl.print && grid.Rank() == 0 )
+                    cout << numIter-1 << ": "
+                      << "||x-z||_2=" << rNorm << ", "
+                      << "epsPri=" << epsPri << ", "
+                      << "|rho| ||z-zOld||_2=" << sNorm << ", "
+                      << "epsDual=" << epsDual << endl;
+                converged = ( rNorm < epsPri && sNorm < epsDual );
+            }
+            if( converged )
+                break;
+
+            // Queue the reduction of this iteration's local contributions
+            t = xTmp;
+            t -= z;
+            Real normLoc = FrobeniusNorm( t.LockedMatrix() );
+            localNormSquares[0] = normLoc*normLoc;
+            t = z;
+            t -= zOld;
+            normLoc = FrobeniusNorm( t.LockedMatrix() );
+            localNormSquares[1] = normLoc*normLoc;
+            normLoc = FrobeniusNorm( xTmp.LockedMatrix() );
+            localNormSquares[2] = normLoc*normLoc;
+            normLoc = FrobeniusNorm( z.LockedMatrix() );
+            localNormSquares[3] = normLoc*normLoc;
+            normLoc = FrobeniusNorm( u.LockedMatrix() );
+            localNormSquares[4] = normLoc*normLoc;
+            mpi::IAllReduce
+            ( localNormSquares, globalNormSquares, 5, grid.VCComm(),
+              normRequest );
+            normsPending = true;
+
+            ++numIter;
+            continue;
+        }
+
         const Real objective = Dot( c, xTmp );
 
         // rNorm := || x - z ||_2
@@ -336,6 +401,8 @@ Int ADMM
             break;
         ++numIter;
     }
+    if( normsPending )
+        mpi::Wait( normRequest );
     if( ctrl.maxIter == numIter && grid.Rank() == 0 )
         cout << "ADMM failed to converge" << endl;
     x = xTmp;
@@ -813,6 +813,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const bool outputRoot = true;
     if( ctrl.outerEquil )
     {
@@ -1253,6 +1254,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Grid& grid = problem.A.Grid();
     if( ctrl.outerEquil )
     {
@@ -1878,6 +1880,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     if( ctrl.outerEquil )
     {
         DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> equilibratedProblem;
@@ -2545,6 +2548,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     if( ctrl.outerEquil )
     {
         DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
@@ -48,6 +48,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
 
     // Equilibrate the QP by diagonally scaling [A;G]
     auto A = APre;
@@ -349,6 +350,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
     Timer timer;
@@ -726,6 +728,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
 
     // Equilibrate the QP by diagonally scaling [A;G]
     auto Q = QPre;
@@ -1111,6 +1114,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
 
     //const Real selInvTol = Pow(eps,Real(-0.25));
     const Real selInvTol = 0;
@@ -100,6 +100,15 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the cone,
+        // as iterates inherited from a nearly converged solve lie almost on
+        // its boundary. The entrywise clip is preferred over the standard
+        // shift here since the latter would move every entry of a nearly
+        // optimal iterate a unit distance from its converged value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        LowerClip( s, sqrtEps*Max(Nrm2(s),Real(1)) );
+        LowerClip( z, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
@@ -224,6 +233,15 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the cone,
+        // as iterates inherited from a nearly converged solve lie almost on
+        // its boundary. The entrywise clip is preferred over the standard
+        // shift here since the latter would move every entry of a nearly
+        // optimal iterate a unit distance from its converged value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        LowerClip( s, sqrtEps*Max(Nrm2(s),Real(1)) );
+        LowerClip( z, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
@@ -348,6 +366,15 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the cone,
+        // as iterates inherited from a nearly converged solve lie almost on
+        // its boundary. The entrywise clip is preferred over the standard
+        // shift here since the latter would move every entry of a nearly
+        // optimal iterate a unit distance from its converged value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        LowerClip( s, sqrtEps*Max(Nrm2(s),Real(1)) );
+        LowerClip( z, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
@@ -492,6 +519,15 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the cone,
+        // as iterates inherited from a nearly converged solve lie almost on
+        // its boundary. The entrywise clip is preferred over the standard
+        // shift here since the latter would move every entry of a nearly
+        // optimal iterate a unit distance from its converged value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        LowerClip( s, sqrtEps*Max(Nrm2(s),Real(1)) );
+        LowerClip( z, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
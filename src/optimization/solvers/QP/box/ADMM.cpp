@@ -177,6 +177,20 @@ ADMM
 
     // Start the ADMM
     Int numIter=0;
+    // When requested (and when the MPI implementation provides non-blocking
+    // collectives), the convergence test is pipelined: the local
+    // contributions to its norms are combined with a single non-blocking
+    // allreduce which is only completed after the next solve, so that the
+    // reduction latencies are hidden behind computation at the price of
+    // testing residuals which are one iteration stale.
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const bool pipeline = ctrl.pipelineConvergence;
+#else
+    const bool pipeline = false;
+#endif
+    mpi::Request<Real> normRequest;
+    bool normsPending = false;
+    Real localNormSquares[5], globalNormSquares[5];
     DistMatrix<Real> X(grid), U(grid), T(grid), ZOld(grid), XHat(grid);
     Zeros( Z, n, k );
     Zeros( U, n, k );
@@ -215,6 +229,57 @@ ADMM
         U += XHat;
         U -= Z;
 
+        if( pipeline )
+        {
+            // Finish combining the previous iteration's norms and apply its
+            // (one iteration stale) convergence test
+            bool converged = false;
+            if( normsPending )
+            {
+                mpi::Wait( normRequest );
+                normsPending = false;
+                const Real rNorm = Sqrt(globalNormSquares[0]);
+                const Real sNorm = Abs(ctrl.rho)*Sqrt(globalNormSquares[1]);
+                const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
+                    ctrl.relTol*
+                    Max(Sqrt(globalNormSquares[2]),Sqrt(globalNormSquares[3]));
+                const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
+                    ctrl.relTol*Abs(ctrl.rho)*Sqrt(globalNormSquares[4]);
+                if( ctrl.print && grid.Rank() == 0 )
+                    cout << numIter-1 << ": "
+                      << "||X-Z||_F=" << rNorm << ", "
+                      << "epsPri=" << epsPri << ", "
+                      << "|rho| ||Z-ZOld||_F=" << sNorm << ", "
+                      << "epsDual=" << epsDual << endl;
+                converged = ( rNorm < epsPri && sNorm < epsDual );
+            }
+            if( converged )
+                break;
+
+            // Queue the reduction of this iteration's local contributions
+            T = X;
+            T -= Z;
+            Real normLoc = FrobeniusNorm( T.LockedMatrix() );
+            localNormSquares[0] = normLoc*normLoc;
+            T = Z;
+            T -= ZOld;
+            normLoc = FrobeniusNorm( T.LockedMatrix() );
+            localNormSquares[1] = normLoc*normLoc;
+            normLoc = FrobeniusNorm( X.LockedMatrix() );
+            localNormSquares[2] = normLoc*normLoc;
+            normLoc = FrobeniusNorm( Z.LockedMatrix() );
+            localNormSquares[3] = normLoc*normLoc;
+            normLoc = FrobeniusNorm( U.LockedMatrix() );
+            localNormSquares[4] = normLoc*normLoc;
+            mpi::IAllReduce
+            ( localNormSquares, globalNormSquares, 5, grid.VCComm(),
+              normRequest );
+            normsPending = true;
+
+            ++numIter;
+            continue;
+        }
+
         // rNorm := || x - z ||_2
         T = X;
         T -= Z;
@@ -254,6 +319,8 @@ ADMM
             break;
         ++numIter;
     }
+    if( normsPending )
+        mpi::Wait( normRequest );
     if( ctrl.maxIter == numIter )
         RuntimeError("ADMM failed to converge");
     return numIter;
@@ -44,6 +44,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
 
     // Equilibrate the QP by diagonally scaling A
     auto Q = QPre;
@@ -385,6 +386,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
 
@@ -764,6 +766,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
 
     // Equilibrate the QP by diagonally scaling A
     auto Q = QPre;
@@ -1196,6 +1199,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
     Timer timer;
@@ -98,6 +98,15 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the cone,
+        // as iterates inherited from a nearly converged solve lie almost on
+        // its boundary. The entrywise clip is preferred over the standard
+        // shift here since the latter would move every entry of a nearly
+        // optimal iterate a unit distance from its converged value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        LowerClip( x, sqrtEps*Max(Nrm2(x),Real(1)) );
+        LowerClip( z, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
@@ -206,6 +215,15 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the cone,
+        // as iterates inherited from a nearly converged solve lie almost on
+        // its boundary. The entrywise clip is preferred over the standard
+        // shift here since the latter would move every entry of a nearly
+        // optimal iterate a unit distance from its converged value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        LowerClip( x, sqrtEps*Max(Nrm2(x),Real(1)) );
+        LowerClip( z, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
@@ -322,6 +340,15 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the cone,
+        // as iterates inherited from a nearly converged solve lie almost on
+        // its boundary. The entrywise clip is preferred over the standard
+        // shift here since the latter would move every entry of a nearly
+        // optimal iterate a unit distance from its converged value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        LowerClip( x, sqrtEps*Max(Nrm2(x),Real(1)) );
+        LowerClip( z, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
@@ -463,6 +490,15 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the cone,
+        // as iterates inherited from a nearly converged solve lie almost on
+        // its boundary. The entrywise clip is preferred over the standard
+        // shift here since the latter would move every entry of a nearly
+        // optimal iterate a unit distance from its converged value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        LowerClip( x, sqrtEps*Max(Nrm2(x),Real(1)) );
+        LowerClip( z, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
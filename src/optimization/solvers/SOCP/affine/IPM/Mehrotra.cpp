@@ -49,6 +49,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Real eps = limits::Epsilon<Real>();
 
     auto A = APre;
@@ -386,6 +387,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Real eps = limits::Epsilon<Real>();
     const bool onlyLower = true;
     const Int cutoffPar = 1000;
@@ -764,6 +766,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Real eps = limits::Epsilon<Real>();
     const bool onlyLower = false;
     // TODO(poulson): Move into the control structure
@@ -1215,6 +1218,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Real eps = limits::Epsilon<Real>();
     const bool onlyLower = false;
     // TODO(poulson): Move these into the control structur
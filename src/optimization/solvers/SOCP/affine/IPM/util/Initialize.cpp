@@ -101,6 +101,16 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the
+        // product cone, as iterates inherited from a nearly converged solve
+        // lie almost on its boundary. A small lower bound on the eigenvalues
+        // is preferred over the standard shift here since the latter would
+        // move a nearly optimal iterate a unit distance from its converged
+        // value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        soc::PushInto( s, orders, firstInds, sqrtEps*Max(Nrm2(s),Real(1)) );
+        soc::PushInto( z, orders, firstInds, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
@@ -225,6 +235,16 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the
+        // product cone, as iterates inherited from a nearly converged solve
+        // lie almost on its boundary. A small lower bound on the eigenvalues
+        // is preferred over the standard shift here since the latter would
+        // move a nearly optimal iterate a unit distance from its converged
+        // value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        soc::PushInto( s, orders, firstInds, sqrtEps*Max(Nrm2(s),Real(1)) );
+        soc::PushInto( z, orders, firstInds, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
@@ -357,6 +377,16 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the
+        // product cone, as iterates inherited from a nearly converged solve
+        // lie almost on its boundary. A small lower bound on the eigenvalues
+        // is preferred over the standard shift here since the latter would
+        // move a nearly optimal iterate a unit distance from its converged
+        // value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        soc::PushInto( s, orders, firstInds, sqrtEps*Max(Nrm2(s),Real(1)) );
+        soc::PushInto( z, orders, firstInds, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
@@ -512,6 +542,16 @@ void Initialize
     if( primalInit && dualInit )
     {
         // TODO(poulson): Perform a consistency check
+        //
+        // Push the warm-started pair slightly into the interior of the
+        // product cone, as iterates inherited from a nearly converged solve
+        // lie almost on its boundary. A small lower bound on the eigenvalues
+        // is preferred over the standard shift here since the latter would
+        // move a nearly optimal iterate a unit distance from its converged
+        // value.
+        const Real sqrtEps = Sqrt(limits::Epsilon<Real>());
+        soc::PushInto( s, orders, firstInds, sqrtEps*Max(Nrm2(s),Real(1)) );
+        soc::PushInto( z, orders, firstInds, sqrtEps*Max(Nrm2(z),Real(1)) );
         return;
     }
 
@@ -43,6 +43,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Int n = c.Height();
 
     Matrix<Real> G;
@@ -73,6 +74,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Int n = c.Height();
     const Grid& grid = c.Grid();
 
@@ -104,6 +106,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Int n = c.Height();
 
     SparseMatrix<Real> G;
@@ -134,6 +137,7 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    ProfileRegion profRegion("Mehrotra");
     const Int n = c.Height();
     const Grid& grid = A.Grid();
 
@@ -33,11 +33,23 @@ void Broadcast
               LogicError("Inconsistency in orders and firstInds");
         )
 
-        const Field x0 = x(i);
-        for( Int j=i+1; j<i+order; ++j )
-            x(j) = x0;
+        // Broadcast over the maximal run of contiguous cones of this order
+        // with loops strided over the packed buffer, which avoids paying a
+        // branch-heavy scalar loop for every member of a long sequence of
+        // small cones
+        Int runEnd = i + order;
+        while( runEnd < height && orders(runEnd) == order )
+            runEnd += order;
+        const Int numCones = (runEnd-i) / order;
+        Field* xBuf = &x(i);
+        for( Int k=1; k<order; ++k )
+        {
+            EL_SIMD
+            for( Int c=0; c<numCones; ++c )
+                xBuf[c*order+k] = xBuf[c*order];
+        }
 
-        i += order;
+        i = runEnd;
     }
 }
 
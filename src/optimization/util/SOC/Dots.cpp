@@ -45,10 +45,36 @@ void Dots
               LogicError("Inconsistency in orders and firstInds");
         )
 
-        // Compute the inner-product between two SOC members and broadcast
-        // the result over an equivalently-sized z_i
-        z(i) = blas::Dot( order, &x(i), 1, &y(i), 1 );
-        i += order;
+        // Find the maximal run of contiguous cones of this order (the run
+        // length is divisible by 'order' since 'orders' is broadcast over
+        // each cone), so that large numbers of small cones can be processed
+        // with strided loops over the packed buffer rather than one BLAS
+        // call apiece
+        Int runEnd = i + order;
+        while( runEnd < height && orders(runEnd) == order )
+            runEnd += order;
+        const Int numCones = (runEnd-i) / order;
+
+        if( numCones == 1 )
+        {
+            // Compute the inner-product between two SOC members and broadcast
+            // the result over an equivalently-sized z_i
+            z(i) = blas::Dot( order, &x(i), 1, &y(i), 1 );
+        }
+        else
+        {
+            const Real* xBuf = &x(i);
+            const Real* yBuf = &y(i);
+                  Real* zBuf = &z(i);
+            for( Int k=0; k<order; ++k )
+            {
+                EL_SIMD
+                for( Int c=0; c<numCones; ++c )
+                    zBuf[c*order] += xBuf[c*order+k]*yBuf[c*order+k];
+            }
+        }
+
+        i = runEnd;
     }
 }
 
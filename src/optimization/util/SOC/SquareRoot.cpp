@@ -39,12 +39,28 @@ void SquareRoot
               LogicError("Inconsistency in orders and firstInds");
         )
 
-        const Real eta0 = Sqrt(x(i)+Sqrt(d(i)))/Sqrt(Real(2));
-        xRoot(i) = eta0;
+        // Handle the maximal run of contiguous cones of this order with
+        // strided loops over the packed buffer so that the roots of many
+        // small cones are computed without per-cone loop overhead
+        Int runEnd = i + order;
+        while( runEnd < height && orders(runEnd) == order )
+            runEnd += order;
+        const Int numCones = (runEnd-i) / order;
+        const Real* xBuf = &x(i);
+        const Real* dBuf = &d(i);
+              Real* xRootBuf = &xRoot(i);
+        const Real sqrtTwo = Sqrt(Real(2));
+        EL_SIMD
+        for( Int c=0; c<numCones; ++c )
+            xRootBuf[c*order] = Sqrt(xBuf[c*order]+Sqrt(dBuf[c*order]))/sqrtTwo;
         for( Int k=1; k<order; ++k )
-            xRoot(i+k) = x(i+k)/(2*eta0);
+        {
+            EL_SIMD
+            for( Int c=0; c<numCones; ++c )
+                xRootBuf[c*order+k] = xBuf[c*order+k]/(2*xRootBuf[c*order]);
+        }
 
-        i += order;
+        i = runEnd;
     }
 }
 
@@ -0,0 +1,302 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#include <fstream>
+
+// An integration-level scaling regression harness: each scenario runs a
+// composed pipeline (rather than a single kernel) with its phases wrapped
+// in profiler regions, and the per-phase times of the slowest rank are
+// compared against a versioned baseline file. Typical usage is
+//
+//   mpirun -np 4 Scaling --n 2000 --baselines baselines --record
+//   ... commit under test ...
+//   mpirun -np 4 Scaling --n 2000 --baselines baselines
+//
+// at each rank count and problem size of interest; the baseline files are
+// keyed by scenario, rank count, and size, so weak and strong scaling
+// sweeps each maintain their own history. A phase slower than the recorded
+// baseline by more than the threshold fails the run.
+
+namespace {
+
+const int baselineVersion = 1;
+
+// Sparse interior-point solve of a primal-feasible direct-form LP whose
+// constraint matrix stacks a banded random block against an identity (so
+// that it has full row rank)
+void SparseIPMScenario( Int n, const Grid& grid )
+{
+    ProfileRegion scenario("SparseIPM");
+    typedef double Real;
+    const Int m = n/2;
+
+    DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>> problem;
+    DirectLPSolution<DistMultiVec<Real>> solution;
+    {
+        ProfileRegion phase("Assemble");
+        problem.A.SetGrid( grid );
+        problem.b.SetGrid( grid );
+        problem.c.SetGrid( grid );
+        Zeros( problem.A, m, n+m );
+        const Int localHeight = problem.A.LocalHeight();
+        const Int firstLocalRow = problem.A.FirstLocalRow();
+        problem.A.Reserve( 4*localHeight );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = iLoc + firstLocalRow;
+            problem.A.QueueLocalUpdate( iLoc, i, SampleUniform<Real>(1,2) );
+            problem.A.QueueLocalUpdate
+            ( iLoc, (i+1) % n, SampleUniform<Real>(0,1) );
+            problem.A.QueueLocalUpdate
+            ( iLoc, (i+n/2) % n, SampleUniform<Real>(0,1) );
+            problem.A.QueueLocalUpdate( iLoc, n+i, Real(1) );
+        }
+        problem.A.ProcessLocalQueues();
+
+        // b = A xFeas and c = zFeas - A^T yFeas make (xFeas,yFeas,zFeas)
+        // primal-dual feasible
+        DistMultiVec<Real> xFeas(grid), yFeas(grid);
+        Ones( xFeas, n+m, 1 );
+        Uniform( yFeas, m, 1 );
+        Zeros( problem.b, m, 1 );
+        Multiply( NORMAL, Real(1), problem.A, xFeas, Real(0), problem.b );
+        Ones( problem.c, n+m, 1 );
+        Multiply
+        ( TRANSPOSE, Real(-1), problem.A, yFeas, Real(1), problem.c );
+    }
+    {
+        ProfileRegion phase("Solve");
+        lp::direct::Ctrl<Real> ctrl(true);
+        LP( problem, solution, ctrl );
+    }
+}
+
+// Dense Hermitian eigensolve followed by the application of the computed
+// basis to a block of vectors
+void DenseEigScenario( Int n, const Grid& grid )
+{
+    ProfileRegion scenario("DenseEig");
+    typedef double Real;
+    const Int numVecs = 16;
+
+    DistMatrix<Real> A(grid);
+    {
+        ProfileRegion phase("Assemble");
+        HermitianUniformSpectrum( A, n, Real(-1), Real(1) );
+    }
+    DistMatrix<Real,VR,STAR> w(grid);
+    DistMatrix<Real> Q(grid);
+    {
+        ProfileRegion phase("Eig");
+        HermitianEig( LOWER, A, w, Q );
+    }
+    {
+        ProfileRegion phase("BackTransform");
+        DistMatrix<Real> X(grid), Y(grid);
+        Uniform( X, n, numVecs );
+        Gemm( NORMAL, NORMAL, Real(1), Q, X, Y );
+    }
+}
+
+// QR-based least squares on a tall dense matrix, including the residual
+// evaluation
+void LeastSquaresScenario( Int n, const Grid& grid )
+{
+    ProfileRegion scenario("LeastSquares");
+    typedef double Real;
+    const Int m = 2*n;
+    const Int numRHS = 8;
+
+    DistMatrix<Real> A(grid), B(grid), X(grid);
+    {
+        ProfileRegion phase("Assemble");
+        Uniform( A, m, n );
+        Uniform( B, m, numRHS );
+    }
+    {
+        ProfileRegion phase("Solve");
+        LeastSquares( NORMAL, A, B, X );
+    }
+    {
+        ProfileRegion phase("Residual");
+        DistMatrix<Real> R(B);
+        Gemm( NORMAL, NORMAL, Real(-1), A, X, Real(1), R );
+        const Real residNorm = FrobeniusNorm( R );
+        if( grid.Rank() == 0 )
+            Output("|| A X - B ||_F = ",residNorm);
+    }
+}
+
+string BaselineFilename
+( const string& dir, const string& scenario, int commSize, Int n )
+{
+    ostringstream os;
+    os << dir << "/scaling-" << scenario << "-np" << commSize
+       << "-n" << n << ".baseline";
+    return os.str();
+}
+
+void WriteBaseline
+( const string& filename,
+  const vector<ProfileTiming>& timings,
+  const string& scenario, int commSize, Int n )
+{
+    std::ofstream file( filename.c_str() );
+    if( !file )
+        RuntimeError
+        ("Could not open baseline file ",filename," for writing");
+    file.precision( 17 );
+    file << "# Elemental scaling baseline, format version "
+         << baselineVersion << "\n"
+         << "# scenario=" << scenario << " ranks=" << commSize
+         << " n=" << n << "\n";
+    for( const auto& timing : timings )
+        file << timing.path << '\t' << timing.maxTime << '\t'
+             << timing.numCalls << '\n';
+    Output("Recorded ",timings.size()," region(s) into ",filename);
+}
+
+int CompareBaseline
+( const string& filename,
+  const vector<ProfileTiming>& timings,
+  double threshold )
+{
+    std::ifstream file( filename.c_str() );
+    if( !file )
+    {
+        Output
+        ("No baseline at ",filename,"; rerun with --record to create one");
+        return 0;
+    }
+    std::map<string,double> baseline;
+    string line;
+    while( std::getline( file, line ) )
+    {
+        if( line.empty() || line[0] == '#' )
+            continue;
+        const size_t tab = line.find( '\t' );
+        if( tab == string::npos )
+            continue;
+        baseline[line.substr(0,tab)] =
+          strtod( line.c_str()+tab+1, nullptr );
+    }
+
+    // Phases faster than the noise floor in both runs are not judged
+    const double noiseFloor = 1e-3;
+    int numRegressed = 0;
+    for( const auto& timing : timings )
+    {
+        auto it = baseline.find( timing.path );
+        if( it == baseline.end() )
+        {
+            Output
+            ("note: ",timing.path," has no baseline entry; "
+             "rerun with --record after reviewing");
+            continue;
+        }
+        if( timing.maxTime < noiseFloor && it->second < noiseFloor )
+            continue;
+        const double ratio =
+          ( it->second > 0 ? timing.maxTime/it->second : 1 );
+        if( ratio > threshold )
+        {
+            Output
+            ("REGRESSION: ",timing.path," took ",timing.maxTime,
+             " seconds against a baseline of ",it->second," (",ratio,"x)");
+            ++numRegressed;
+        }
+        else if( ratio < 1/threshold )
+            Output
+            ("improvement: ",timing.path," took ",timing.maxTime,
+             " seconds against a baseline of ",it->second,
+             "; consider re-recording");
+    }
+    return numRegressed;
+}
+
+} // anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    int numRegressed = 0;
+    try
+    {
+        const string scenario =
+          Input("--scenario","scenario to run (all, ipm, eig, or lsq)",
+            string("all"));
+        const Int n = Input("--n","base problem size",200);
+        const string baselineDir =
+          Input("--baselines",
+            "directory of baseline files (empty disables the comparison)",
+            string(""));
+        const bool record =
+          Input("--record","overwrite the baseline instead of comparing?",
+            false);
+        const double threshold =
+          Input("--threshold","slowdown ratio considered a regression",1.25);
+        const Int numWarmups =
+          Input("--warmup","number of unprofiled warmup runs",1);
+        ProcessInput();
+        PrintInputReport();
+
+        if( scenario != "all" && scenario != "ipm" &&
+            scenario != "eig" && scenario != "lsq" )
+            LogicError("Unrecognized scenario \"",scenario,"\"");
+
+        const Grid grid( comm );
+        auto runScenarios = [&]()
+        {
+            if( scenario == "all" || scenario == "ipm" )
+                SparseIPMScenario( n, grid );
+            if( scenario == "all" || scenario == "eig" )
+                DenseEigScenario( n, grid );
+            if( scenario == "all" || scenario == "lsq" )
+                LeastSquaresScenario( n, grid );
+        };
+
+        // Warm up (populating caches, pools, and communication plans) and
+        // then profile a single measured run
+        for( Int run=0; run<numWarmups; ++run )
+            runScenarios();
+        ClearProfile();
+        EnableProfiling();
+        runScenarios();
+        DisableProfiling();
+
+        ProfileReport( cout, comm );
+        const auto timings = ProfileTimings( comm );
+
+        if( baselineDir != "" )
+        {
+            if( commRank == 0 )
+            {
+                const string filename =
+                  BaselineFilename( baselineDir, scenario, commSize, n );
+                if( record )
+                    WriteBaseline( filename, timings, scenario, commSize, n );
+                else
+                    numRegressed =
+                      CompareBaseline( filename, timings, threshold );
+            }
+            mpi::Broadcast( &numRegressed, 1, 0, comm );
+            if( numRegressed > 0 && commRank == 0 )
+                Output
+                (numRegressed," phase(s) regressed beyond ",threshold,"x");
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return ( numRegressed > 0 ? 1 : 0 );
+}